@@ -26,8 +26,12 @@ endif()
 
 ie_dependent_option (ENABLE_ONEDNN_FOR_GPU "Enable oneDNN with GPU support" ON "ENABLE_ONEDNN_FOR_GPU_DEFAULT" OFF)
 
+ie_dependent_option (ENABLE_ONEDNN_FOR_GPU_PRIMITIVE_CACHE "Enable the process-wide primitive cache of oneDNN for GPU, so the identical primitives of the GPU programs are created once per device" ON "ENABLE_ONEDNN_FOR_GPU" OFF)
+
 ie_option (ENABLE_PROFILING_ITT "Build with ITT tracing. Optionally configure pre-built ittnotify library though INTEL_VTUNE_DIR variable." OFF)
 
+ie_option (ENABLE_PROFILING_TRACE "Build with the built-in tracer of the ITT annotated tasks, which writes the timeline in the Chrome tracing format to OPENVINO_TRACE_FILE and the task statistics to OPENVINO_TRACE_STATS_FILE." OFF)
+
 ie_option_enum(ENABLE_PROFILING_FILTER "Enable or disable ITT counter groups.\
 Supported values:\
  ALL - enable all ITT counters (default value)\
@@ -0,0 +1,57 @@
+#include <openvino/runtime/core.hpp>
+#include <openvino/runtime/intel_gpu/ocl/va.hpp>
+#include <openvino/runtime/intel_gpu/properties.hpp>
+#include <openvino/core/preprocess/pre_post_process.hpp>
+
+
+int main() {
+//! [part4]
+
+// ...
+
+
+// initialize the objects
+ov::runtime::Core core;
+auto model = core.read_model(xmlFileName);
+
+// the batch of the model is the number of the surfaces inferred at once
+ov::preprocess::PrePostProcessor p(model);
+p.input().tensor().set_element_type(ov::element::u8)
+                  .set_color_format(ov::preprocess::ColorFormat::NV12_TWO_PLANES, {"y", "uv"})
+                  .set_memory_type(GPU_CONFIG_KEY(SURFACE));
+p.input().preprocess().convert_color(ov::preprocess::ColorFormat::BGR);
+p.input().model().set_layout("NCHW");
+model = p.build();
+
+VADisplay disp = get_VA_Device();
+// create the shared context object
+auto shared_va_context = ov::runtime::intel_gpu::ocl::VAContext(core, disp);
+// compile model within a shared context
+auto compiled_model = core.compile_model(model, shared_va_context);
+
+auto input_y = model->get_parameters().at(0)->output(0).get_any_name();
+auto input_uv = model->get_parameters().at(1)->output(0).get_any_name();
+
+
+// decode/inference loop
+for (int i = 0; i < nframes; i += batch) {
+//     ...
+    std::vector<ov::runtime::Tensor> y_tensors, uv_tensors;
+    for (int b = 0; b < batch; b++) {
+        // execute decoding and obtain decoded surface handle
+        decoder.DecodeFrame();
+        VASurfaceID va_surface = decoder.get_VA_output_surface();
+        // wrap the planes of the decoder output into remote tensors, no data is copied
+        auto nv12_tensor = shared_va_context.create_tensor_nv12(ieInHeight, ieInWidth, va_surface);
+        y_tensors.push_back(nv12_tensor.first);
+        uv_tensors.push_back(nv12_tensor.second);
+    }
+    // every surface is an item of the batch consumed by the color conversion of the plugin
+    inferRequests[currentFrame].set_tensors(input_y, y_tensors);
+    inferRequests[currentFrame].set_tensors(input_uv, uv_tensors);
+    inferRequests[currentFrame].start_async();
+    inferRequests[prevFrame].wait();
+}
+//! [part4]
+return 0;
+}
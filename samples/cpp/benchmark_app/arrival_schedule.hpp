@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// @brief arrival processes of the open-loop mode
+static constexpr char poissonArrival[] = "poisson";
+static constexpr char constantArrival[] = "constant";
+
+/// @brief Responsible for the arrival times of the requests in the open-loop mode, relative to the start of the
+/// measurement. The requests arrive at the target rate regardless of the completion of the previous ones.
+class ArrivalSchedule {
+public:
+    /// @param arrival "poisson", "constant" or a path to a trace file with an arrival time in milliseconds per line
+    /// @param qps the target rate of the "poisson" and "constant" arrivals, the trace ignores it
+    ArrivalSchedule(const std::string& arrival, double qps)
+        : _qps(qps),
+          _isTrace(isTrace(arrival)),
+          _isPoisson(arrival == poissonArrival) {
+        if (_isTrace) {
+            readTrace(arrival);
+        } else if (_qps <= 0) {
+            throw std::logic_error("The target QPS must be positive for the \"" + arrival + "\" arrivals.");
+        } else if (_isPoisson) {
+            _intervalMs = std::exponential_distribution<double>(_qps / 1000.0);
+        }
+    }
+
+    static bool isTrace(const std::string& arrival) {
+        return arrival != poissonArrival && arrival != constantArrival;
+    }
+
+    /// @brief returns false if the trace is over, otherwise the arrival time of the next request
+    bool next(std::chrono::nanoseconds& arrivalTime) {
+        if (_isTrace) {
+            if (_next == _trace.size()) {
+                return false;
+            }
+            _timeMs = _trace[_next++];
+        } else {
+            // the first request arrives at the start
+            if (_next++ > 0) {
+                _timeMs += _isPoisson ? _intervalMs(_generator) : 1000.0 / _qps;
+            }
+        }
+        arrivalTime = std::chrono::nanoseconds(static_cast<int64_t>(_timeMs * 1000000.0));
+        return true;
+    }
+
+    /// @brief the number of the requests of the trace
+    size_t size() const {
+        return _trace.size();
+    }
+
+    bool traceDriven() const {
+        return _isTrace;
+    }
+
+private:
+    void readTrace(const std::string& path) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            throw std::logic_error("Cannot open the arrival trace " + path +
+                                   ", please set -arrival to \"poisson\", \"constant\" or to a trace file.");
+        }
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+            const double timeMs = std::stod(line);
+            if (timeMs < 0 || (!_trace.empty() && timeMs < _trace.back())) {
+                throw std::logic_error("The arrival times of the trace " + path +
+                                       " must be non-negative and non-decreasing.");
+            }
+            _trace.push_back(timeMs);
+        }
+        if (_trace.empty()) {
+            throw std::logic_error("The arrival trace " + path + " is empty.");
+        }
+    }
+
+    double _qps;
+    bool _isTrace;
+    bool _isPoisson;
+    std::vector<double> _trace;
+    size_t _next = 0;
+    double _timeMs = 0;
+    // a fixed seed, so the runs with the same options issue the same arrivals
+    std::mt19937_64 _generator{0};
+    std::exponential_distribution<double> _intervalMs;
+};
@@ -31,6 +31,13 @@ static const char model_message[] =
     "Required. Path to an .xml/.onnx file with a trained model or to a .blob files with "
     "a trained compiled model.";
 
+/// @brief message for the multi-model mode
+static const char models_config_message[] =
+    "Optional. Path to a config of the models to benchmark concurrently in one Core instead of -m, a model per line"
+    " as key=value pairs: \"model=<path> device=<device> hint=<throughput/latency> qps=<float> nireq=<integer>\"."
+    " Only the model is required, a qps of 0 (default) means the closed loop. Each model runs alone, then all of them"
+    " run concurrently for the -t duration, and the latency and throughput of both phases are reported per model.";
+
 /// @brief message for performance hint
 static const char hint_message[] =
     "Optional. Performance hint (optimize for latency or throughput). "
@@ -83,6 +90,24 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for the target rate of the open-loop mode
+static const char qps_message[] =
+    "Optional. Target rate of the requests in queries per second. Enables the open-loop mode: the requests arrive"
+    " at their scheduled times regardless of the completion of the previous ones, and the latency is measured from"
+    " the scheduled arrival, including the queueing for an idle infer request. The -nireq option sets the maximum"
+    " number of the requests in flight. The default value is 0 (closed loop).";
+
+/// @brief message for the arrival process of the open-loop mode
+static const char arrival_message[] =
+    "Optional. Arrival process of the open-loop mode: \"poisson\" (default), \"constant\" interval or a path to a trace"
+    " file with the arrival time of a request in milliseconds per line. A trace enables the open-loop mode and"
+    " ignores -qps.";
+
+/// @brief message for the latency SLO
+static const char slo_message[] =
+    "Optional. Latency SLO in milliseconds. Reports the goodput: the rate and the share of the requests completed"
+    " within the SLO.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -141,8 +166,15 @@ static const char progress_message[] =
 // @brief message for performance counters option
 static const char pc_message[] = "Optional. Report performance counters.";
 
+// @brief message for hardware counters option
+static const char hw_counters_message[] =
+    "Optional. Report the hardware counters of the measurement read with perf_event (Linux only): the IPC, the LLC"
+    " misses per inference and the memory bandwidth estimated from the LLC misses, in total and per stream.";
+
 // @brief message for performance counters for sequence option
-static const char pcseq_message[] = "Optional. Report latencies for each shape in -data_shape sequence.";
+static const char pcseq_message[] =
+    "Optional. Report latencies for each shape in -data_shape sequence. The first inference at a shape is reported"
+    " apart from the steady state latencies of the shape.";
 
 #ifdef HAVE_DEVICE_MEM_SUPPORT
 // @brief message for switching memory allocation type option
@@ -177,6 +209,10 @@ static const char data_shape_message[] =
     " or \"input1[1,192][1,384],input2[1,192][1,384],input3[1,192][1,384],input4[1,192][1,384]\"."
     " If network shapes are all static specifying the option will cause an exception.";
 
+static const char data_shape_histogram_message[] =
+    "Optional. Path to a file with the relative frequency of each shape of -data_shape per line. The shapes are"
+    " sampled from the histogram instead of being inferred in turn. Requires the full mode.";
+
 static const char layout_message[] =
     "Optional. Prompts how network layouts should be treated by application. "
     "For example, \"input1[NCHW],input2[NC]\" or \"[NCHW]\" in case of one input size.";
@@ -185,6 +221,12 @@ static const char layout_message[] =
 static const char cache_dir_message[] = "Optional. Enables caching of loaded models to specified directory. "
                                         "List of devices which support caching is shown at the end of this message.";
 
+// @brief message for the cold start mode
+static const char cold_start_message[] =
+    "Optional. Number of the cold start runs instead of the performance measurement. Each run creates a fresh Core,"
+    " drops the page cache if it is permitted (Linux, root), reads the model, loads it to the device and infers it"
+    " once. With -cache_dir the runs are repeated to load the network from the cache, after a run which fills it.";
+
 // @brief message for single load network
 static const char load_from_file_message[] = "Optional. Loads model from file directly without ReadNetwork."
                                              "All CNNNetwork options (like re-shape) will be ignored";
@@ -235,6 +277,9 @@ DEFINE_string(i, "", input_message);
 /// It is a required parameter
 DEFINE_string(m, "", model_message);
 
+/// @brief Define parameter for the models config of the multi-model mode <br>
+DEFINE_string(models_config, "", models_config_message);
+
 /// @brief Define execution mode
 DEFINE_string(hint, "", hint_message);
 
@@ -273,6 +318,15 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Target rate of the open-loop mode, 0 means the closed loop
+DEFINE_double(qps, 0, qps_message);
+
+/// @brief Arrival process of the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Latency SLO in milliseconds, 0 means no goodput is reported
+DEFINE_double(slo, 0, slo_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -301,6 +355,9 @@ DEFINE_bool(progress, false, progress_message);
 /// @brief Define flag for showing performance counters <br>
 DEFINE_bool(pc, false, pc_message);
 
+/// @brief Define flag for reporting hardware counters <br>
+DEFINE_bool(hw_counters, false, hw_counters_message);
+
 /// @brief Define flag for showing performance sequence counters <br>
 DEFINE_bool(pcseq, false, pcseq_message);
 
@@ -323,6 +380,9 @@ DEFINE_string(shape, "", shape_message);
 /// @brief Define flag for input blob shape <br>
 DEFINE_string(data_shape, "", data_shape_message);
 
+/// @brief Define flag for the histogram of the input blob shapes <br>
+DEFINE_string(data_shape_histogram, "", data_shape_histogram_message);
+
 /// @brief Define flag for layout shape <br>
 DEFINE_string(layout, "", layout_message);
 
@@ -344,6 +404,9 @@ DEFINE_string(iop, "", iop_message);
 /// @brief Define parameter for cache model dir <br>
 DEFINE_string(cache_dir, "", cache_dir_message);
 
+/// @brief Define parameter for the number of the cold start runs <br>
+DEFINE_uint32(cold_start, 0, cold_start_message);
+
 /// @brief Define flag for load network from model file by name without ReadNetwork <br>
 DEFINE_bool(load_from_file, false, load_from_file_message);
 
@@ -366,6 +429,7 @@ static void showUsage() {
     std::cout << std::endl;
     std::cout << "    -h, --help                " << help_message << std::endl;
     std::cout << "    -m \"<path>\"               " << model_message << std::endl;
+    std::cout << "    -models_config \"<path>\"   " << models_config_message << std::endl;
     std::cout << "    -i \"<path>\"               " << input_message << std::endl;
     std::cout << "    -d \"<device>\"             " << target_device_message << std::endl;
     std::cout << "    -l \"<absolute_path>\"      " << custom_cpu_library_message << std::endl;
@@ -381,10 +445,15 @@ static void showUsage() {
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -data_shape             " << data_shape_message << std::endl;
+    std::cout << "    -data_shape_histogram     " << data_shape_histogram_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
+    std::cout << "    -cold_start \"<integer>\"   " << cold_start_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << "    -arrival \"<process/path>\" " << arrival_message << std::endl;
+    std::cout << "    -slo \"<float>\"            " << slo_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -399,6 +468,7 @@ static void showUsage() {
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
     std::cout << "    -pcseq                    " << pcseq_message << std::endl;
+    std::cout << "    -hw_counters              " << hw_counters_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
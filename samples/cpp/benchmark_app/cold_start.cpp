@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <fstream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#    include <unistd.h>
+#endif
+
+#include "inference_engine.hpp"
+
+#include <samples/slog.hpp>
+
+#include "cold_start.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace benchmark_app {
+
+namespace {
+
+/// @brief the times of the stages of the runs, in milliseconds
+using StageTimes = std::vector<std::pair<std::string, std::vector<double>>>;
+
+/// @brief drops the clean pages of the page cache, so the model and the cache are read from the disk, it requires the
+/// root permissions and is done on Linux only
+bool dropPageCache() {
+#ifdef __linux__
+    sync();
+    std::ofstream dropCaches("/proc/sys/vm/drop_caches");
+    dropCaches << "1";
+    dropCaches.close();
+    return !dropCaches.fail();
+#else
+    return false;
+#endif
+}
+
+InferenceEngine::Core createCore(const std::map<std::string, std::map<std::string, std::string>>& config,
+                                 const std::string& cacheDir) {
+    InferenceEngine::Core ie;
+    for (auto&& item : config) {
+        ie.SetConfig(item.second, item.first);
+    }
+    if (!cacheDir.empty()) {
+        ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+    }
+    return ie;
+}
+
+double inferOnce(InferenceEngine::ExecutableNetwork& network) {
+    auto startTime = Time::now();
+    auto request = network.CreateInferRequest();
+    request.Infer();
+    return get_duration_ms_till_now(startTime);
+}
+
+/// @brief the stages are the reading of the model, which runs the frontend, the loading, which runs the
+/// transformations and the compilation of the plugin, and the first inference
+void runWithoutCache(const std::string& model,
+                     const std::string& device,
+                     const std::map<std::string, std::map<std::string, std::string>>& config,
+                     StageTimes& times) {
+    auto startTime = Time::now();
+    auto ie = createCore(config, "");
+    times[0].second.push_back(get_duration_ms_till_now(startTime));
+
+    startTime = Time::now();
+    auto network = ie.ReadNetwork(model);
+    times[1].second.push_back(get_duration_ms_till_now(startTime));
+
+    startTime = Time::now();
+    auto executableNetwork = ie.LoadNetwork(network, device);
+    times[2].second.push_back(get_duration_ms_till_now(startTime));
+
+    times[3].second.push_back(inferOnce(executableNetwork));
+}
+
+/// @brief the loading from the file reads the model only to compute the hash if the cache misses, so on the hit it is
+/// the hashing of the model file and the import of the network
+void runWithCache(const std::string& model,
+                  const std::string& device,
+                  const std::map<std::string, std::map<std::string, std::string>>& config,
+                  const std::string& cacheDir,
+                  StageTimes& times) {
+    auto startTime = Time::now();
+    auto ie = createCore(config, cacheDir);
+    times[0].second.push_back(get_duration_ms_till_now(startTime));
+
+    startTime = Time::now();
+    auto executableNetwork = ie.LoadNetwork(model, device);
+    times[1].second.push_back(get_duration_ms_till_now(startTime));
+
+    times[2].second.push_back(inferOnce(executableNetwork));
+}
+
+void report(const std::string& mode, StageTimes& times, const std::shared_ptr<StatisticsReport>& statistics) {
+    slog::info << "Cold start " << mode << ":" << slog::endl;
+    std::vector<double> totals(times.front().second.size(), 0.0);
+    for (auto& stage : times) {
+        for (size_t i = 0; i < totals.size(); ++i) {
+            totals[i] += stage.second[i];
+        }
+    }
+    times.emplace_back("total", totals);
+    for (auto& stage : times) {
+        LatencyMetrics metrics(stage.second);
+        slog::info << "\t" << stage.first << ": median " << double_to_string(metrics.percentile(50)) << " ms (min "
+                   << double_to_string(metrics.min()) << " ms, max " << double_to_string(metrics.max()) << " ms)"
+                   << slog::endl;
+        if (statistics) {
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                          {"cold start " + mode + " " + stage.first + " median (ms)",
+                                           double_to_string(metrics.percentile(50))},
+                                          {"cold start " + mode + " " + stage.first + " max (ms)",
+                                           double_to_string(metrics.max())},
+                                      });
+        }
+    }
+}
+
+}  // namespace
+
+void benchmarkColdStart(const std::string& model,
+                        const std::string& device,
+                        const std::map<std::string, std::map<std::string, std::string>>& config,
+                        const std::string& cacheDir,
+                        uint32_t runs,
+                        const std::shared_ptr<StatisticsReport>& statistics) {
+    bool pageCacheDropped = true;
+    auto dropCache = [&pageCacheDropped] {
+        if (pageCacheDropped && !dropPageCache()) {
+            slog::warn << "The page cache can't be dropped, the files are read from the memory if they are cached"
+                       << slog::endl;
+            pageCacheDropped = false;
+        }
+    };
+
+    StageTimes withoutCache = {{"create core", {}},
+                               {"read network", {}},
+                               {"load network", {}},
+                               {"first inference", {}}};
+    for (uint32_t run = 0; run < runs; ++run) {
+        dropCache();
+        runWithoutCache(model, device, config, withoutCache);
+    }
+    report("without cache", withoutCache, statistics);
+
+    if (cacheDir.empty()) {
+        return;
+    }
+    // fills the cache, the model isn't changed between the runs, so they hit it
+    StageTimes fillCache = {{"create core", {}}, {"load network", {}}, {"first inference", {}}};
+    runWithCache(model, device, config, cacheDir, fillCache);
+    report("filling cache", fillCache, statistics);
+
+    StageTimes withCache = {{"create core", {}}, {"import network", {}}, {"first inference", {}}};
+    for (uint32_t run = 0; run < runs; ++run) {
+        dropCache();
+        runWithCache(model, device, config, cacheDir, withCache);
+    }
+    report("with cache", withCache, statistics);
+}
+
+}  // namespace benchmark_app
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+// clang-format off
+#include "statistics_report.hpp"
+// clang-format on
+
+namespace benchmark_app {
+
+/**
+ * @brief Benchmarks the cold start of the model: each run creates a fresh Core, drops the page cache if it is
+ * permitted, reads the model, loads it to the device and infers it once. With the cache directory, the runs are
+ * repeated to load the network from the cache, after a run which fills it.
+ * @param config The configs of the devices, set to each Core
+ * @param cacheDir The cache directory, the runs with the cache are skipped if it is empty
+ * @param runs The number of the runs of each mode
+ */
+void benchmarkColdStart(const std::string& model,
+                        const std::string& device,
+                        const std::map<std::string, std::map<std::string, std::string>>& config,
+                        const std::string& cacheDir,
+                        uint32_t runs,
+                        const std::shared_ptr<StatisticsReport>& statistics);
+
+}  // namespace benchmark_app
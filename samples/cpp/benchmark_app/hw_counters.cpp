@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+#include <samples/slog.hpp>
+
+#include "hw_counters.hpp"
+// clang-format on
+
+#ifdef __linux__
+
+namespace {
+
+int openCounter(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // the members of the group follow the leader
+    attr.disabled = groupFd == -1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+}  // namespace
+
+HardwareCounters::HardwareCounters() {
+    const std::pair<const char*, uint64_t> counters[] = {
+        {"cycles", PERF_COUNT_HW_CPU_CYCLES},
+        {"instructions", PERF_COUNT_HW_INSTRUCTIONS},
+        {"LLC references", PERF_COUNT_HW_CACHE_REFERENCES},
+        {"LLC misses", PERF_COUNT_HW_CACHE_MISSES},
+    };
+    for (auto&& counter : counters) {
+        const int fd = openCounter(counter.second, _fds.empty() ? -1 : _fds.front());
+        if (fd == -1) {
+            slog::warn << "Can't open the " << counter.first << " hardware counter: " << std::strerror(errno)
+                       << slog::endl;
+            if (_fds.empty()) {
+                return;
+            }
+            continue;
+        }
+        _fds.push_back(fd);
+        _names.push_back(counter.first);
+    }
+}
+
+HardwareCounters::~HardwareCounters() {
+    for (auto fd : _fds) {
+        close(fd);
+    }
+}
+
+void HardwareCounters::start() {
+    if (available()) {
+        ioctl(_fds.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(_fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+void HardwareCounters::stop() {
+    if (available()) {
+        ioctl(_fds.front(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+std::map<std::string, double> HardwareCounters::read() const {
+    std::map<std::string, double> counts;
+    for (size_t i = 0; i < _fds.size(); ++i) {
+        // the value, the time enabled and the time running
+        uint64_t values[3] = {};
+        if (::read(_fds[i], values, sizeof(values)) != sizeof(values) || values[2] == 0) {
+            continue;
+        }
+        counts[_names[i]] = static_cast<double>(values[0]) * values[1] / values[2];
+    }
+    return counts;
+}
+
+#else
+
+HardwareCounters::HardwareCounters() {
+    slog::warn << "The hardware counters are supported on Linux only" << slog::endl;
+}
+
+HardwareCounters::~HardwareCounters() = default;
+
+void HardwareCounters::start() {}
+
+void HardwareCounters::stop() {}
+
+std::map<std::string, double> HardwareCounters::read() const {
+    return {};
+}
+
+#endif
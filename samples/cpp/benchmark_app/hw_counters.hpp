@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+/// @brief Responsible for the hardware counters of the process: the cycles, instructions, LLC references and misses
+/// read with perf_event on Linux. The counters are opened before the inference threads are created, since they are
+/// inherited only by the threads created after, and count in the user space, which is permitted by the default
+/// perf_event_paranoid. The counters are unavailable on the other OSes or if the kernel rejects them.
+class HardwareCounters {
+public:
+    HardwareCounters();
+    ~HardwareCounters();
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    bool available() const {
+        return !_fds.empty();
+    }
+
+    /// @brief resets and enables the counters of all the threads
+    void start();
+
+    /// @brief disables the counters of all the threads
+    void stop();
+
+    /// @brief returns the counts since the start, scaled if the counters were multiplexed
+    std::map<std::string, double> read() const;
+
+private:
+    std::vector<int> _fds;
+    std::vector<std::string> _names;
+};
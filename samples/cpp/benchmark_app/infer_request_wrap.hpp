@@ -23,7 +23,8 @@
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, size_t group_id, bool first_in_group, const double latency)>
+    QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution
 /// time.
@@ -37,16 +38,23 @@ public:
         : _request(net.CreateInferRequest()),
           _id(id),
           _lat_group_id(0),
+          _first_in_group(false),
           _callbackQueue(callbackQueue),
           outputClBuffer() {
         _request.SetCompletionCallback([&]() {
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, getExecutionTimeInMilliseconds());
+            _callbackQueue(_id, _lat_group_id, _first_in_group, getExecutionTimeInMilliseconds());
         });
     }
 
     void startAsync() {
-        _startTime = Time::now();
+        startAsync(Time::now());
+    }
+
+    /// @brief starts the request, its latency is counted from the arrival time, e.g. the scheduled one of the
+    /// open-loop mode, so it includes the queueing before the start
+    void startAsync(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
         _request.StartAsync();
     }
 
@@ -55,10 +63,14 @@ public:
     }
 
     void infer() {
-        _startTime = Time::now();
+        infer(Time::now());
+    }
+
+    void infer(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, _lat_group_id, _first_in_group, getExecutionTimeInMilliseconds());
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -78,8 +90,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
-    void setLatencyGroupId(size_t id) {
+    /// @param first_in_group - the request is the first inference of the group, e.g. the first one at a new data
+    /// shape, so its latency is kept apart from the steady state
+    void setLatencyGroupId(size_t id, bool first_in_group = false) {
         _lat_group_id = id;
+        _first_in_group = first_in_group;
     }
 
     // in case of using GPU memory we need to allocate CL buffer for
@@ -95,6 +110,7 @@ private:
     Time::time_point _endTime;
     size_t _id;
     size_t _lat_group_id;
+    bool _first_in_group;
     QueueCallbackFunction _callbackQueue;
     std::map<std::string, ::gpu::BufferType> outputClBuffer;
 };
@@ -113,10 +129,12 @@ public:
                                                                         this,
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
-                                                                        std::placeholders::_3)));
+                                                                        std::placeholders::_3,
+                                                                        std::placeholders::_4)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
+        _first_latency_groups.resize(lat_group_n);
         resetTimes();
     }
 
@@ -137,17 +155,20 @@ public:
         for (auto& group : _latency_groups) {
             group.clear();
         }
+        for (auto& group : _first_latency_groups) {
+            group.clear();
+        }
     }
 
     double getDurationInMilliseconds() {
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
-    void putIdleRequest(size_t id, size_t lat_group_id, const double latency) {
+    void putIdleRequest(size_t id, size_t lat_group_id, bool first_in_group, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
         if (enable_lat_groups) {
-            _latency_groups[lat_group_id].push_back(latency);
+            (first_in_group ? _first_latency_groups : _latency_groups)[lat_group_id].push_back(latency);
         }
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
@@ -176,10 +197,16 @@ public:
         return _latencies;
     }
 
+    /// @brief the latencies of the groups without the first inferences of the groups
     std::vector<std::vector<double>> getLatencyGroups() {
         return _latency_groups;
     }
 
+    /// @brief the latencies of the first inferences of the groups, see InferReqWrap::setLatencyGroupId()
+    std::vector<std::vector<double>> getFirstLatencyGroups() {
+        return _first_latency_groups;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -190,5 +217,6 @@ private:
     Time::time_point _endTime;
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
+    std::vector<std::vector<double>> _first_latency_groups;
     bool enable_lat_groups;
 };
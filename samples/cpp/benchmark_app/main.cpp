@@ -6,7 +6,9 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -21,9 +23,13 @@
 #include "samples/common.hpp"
 #include "samples/slog.hpp"
 
+#include "arrival_schedule.hpp"
 #include "benchmark_app.hpp"
+#include "cold_start.hpp"
+#include "hw_counters.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "multi_model.hpp"
 #include "progress_bar.hpp"
 #include "remote_blobs_filling.hpp"
 #include "statistics_report.hpp"
@@ -45,15 +51,21 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_models_config.empty()) {
         showUsage();
-        throw std::logic_error("Model is required but not set. Please set -m option.");
+        throw std::logic_error("Model is required but not set. Please set -m or -models_config option.");
     }
 
     if (FLAGS_latency_percentile > 100 || FLAGS_latency_percentile < 1) {
         showUsage();
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
     }
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("The target QPS is incorrect. Please set -qps option to a positive value or to 0.");
+    }
+    if (FLAGS_slo < 0) {
+        throw std::logic_error("The latency SLO is incorrect. Please set -slo option to a positive value.");
+    }
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
@@ -124,6 +136,12 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
+        // the counters are opened before the core creates the inference threads, so the threads inherit them
+        std::unique_ptr<HardwareCounters> hwCounters;
+        if (FLAGS_hw_counters) {
+            hwCounters.reset(new HardwareCounters());
+        }
+
         bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
         if (isNetworkCompiled) {
             slog::info << "Network is compiled" << slog::endl;
@@ -374,6 +392,29 @@ int main(int argc, char* argv[]) {
             ie.SetConfig({{CONFIG_KEY(CACHE_DIR), FLAGS_cache_dir}});
         }
 
+        if (FLAGS_cold_start != 0) {
+            // the runs create their own cores, so only the config of the devices is used
+            benchmark_app::benchmarkColdStart(FLAGS_m,
+                                              device_name,
+                                              config,
+                                              FLAGS_cache_dir,
+                                              FLAGS_cold_start,
+                                              statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
+        if (!FLAGS_models_config.empty()) {
+            // the models of the config are loaded and measured by their own steps
+            auto models = benchmark_app::parseModelsConfig(FLAGS_models_config);
+            uint32_t duration_seconds = FLAGS_t != 0 ? FLAGS_t : deviceDefaultDeviceDurationInSeconds(device_name);
+            benchmark_app::benchmarkModels(ie, models, duration_seconds, statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         bool isDynamicNetwork = false;
         if (FLAGS_load_from_file && !isNetworkCompiled) {
             next_step();
@@ -579,10 +620,18 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // Open-loop arrivals
+        std::unique_ptr<ArrivalSchedule> arrivals;
+        if (FLAGS_qps > 0 || isFlagSetInCommandLine("arrival")) {
+            arrivals.reset(new ArrivalSchedule(FLAGS_arrival, FLAGS_qps));
+        }
+        const bool replayTrace = arrivals && arrivals->traceDriven() && FLAGS_niter == 0 && FLAGS_t == 0;
+
         // Iteration limit
-        uint32_t niter = FLAGS_niter;
+        uint32_t niter = replayTrace ? static_cast<uint32_t>(arrivals->size()) : FLAGS_niter;
         size_t shape_groups_num = app_inputs_info.size();
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        // the open loop issues the requests at their arrival times, so they are not aligned
+        if ((niter > 0) && (FLAGS_api == "async") && !arrivals) {
             if (shape_groups_num > nireq) {
                 niter = ((niter + shape_groups_num - 1) / shape_groups_num) * shape_groups_num;
                 if (FLAGS_niter != niter) {
@@ -604,7 +653,7 @@ int main(int argc, char* argv[]) {
         if (FLAGS_t != 0) {
             // time limit
             duration_seconds = FLAGS_t;
-        } else if (FLAGS_niter == 0) {
+        } else if (FLAGS_niter == 0 && !replayTrace) {
             // default time limit
             duration_seconds = deviceDefaultDeviceDurationInSeconds(device_name);
         }
@@ -624,6 +673,24 @@ int main(int argc, char* argv[]) {
                     {"number of parallel infer requests", std::to_string(nireq)},
                     {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                 });
+            if (arrivals) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                              {"arrival", FLAGS_arrival},
+                                          });
+                if (!arrivals->traceDriven()) {
+                    statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                              {
+                                                  {"target QPS", double_to_string(FLAGS_qps)},
+                                              });
+                }
+            }
+            if (FLAGS_slo > 0) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                              {"latency SLO (ms)", double_to_string(FLAGS_slo)},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -702,6 +769,14 @@ int main(int argc, char* argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        if (arrivals) {
+            ss << ", open loop: ";
+            if (arrivals->traceDriven()) {
+                ss << "arrivals from " << FLAGS_arrival;
+            } else {
+                ss << FLAGS_qps << " QPS " << FLAGS_arrival << " arrivals";
+            }
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << getDurationInMilliseconds(duration_seconds) << " ms duration";
@@ -790,7 +865,8 @@ int main(int argc, char* argv[]) {
 
         inferRequestsQueue.waitAll();
 
-        auto duration_ms = double_to_string(inferRequestsQueue.getLatencies()[0]);
+        const double firstLatency = inferRequestsQueue.getLatencies()[0];
+        auto duration_ms = double_to_string(firstLatency);
         slog::info << "First inference took " << duration_ms << " ms" << slog::endl;
 
         if (statistics) {
@@ -799,7 +875,32 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.resetTimes();
 
+        // the first inference at a data shape also pays for the compilation of the shape, the warming up inferred
+        // the first one
+        std::vector<bool> shapeGroupInferred(app_inputs_info.size(), false);
+        shapeGroupInferred[0] = true;
+        std::vector<size_t> shapeGroupIterations(app_inputs_info.size(), 0);
+        std::unique_ptr<std::discrete_distribution<size_t>> shapeGroupDistribution;
+        // a fixed seed, so the runs with the same options infer the same stream of the shapes
+        std::mt19937 shapeGroupGenerator(0);
+        if (!FLAGS_data_shape_histogram.empty()) {
+            auto weights = loadDataShapeHistogram(FLAGS_data_shape_histogram);
+            if (weights.size() != app_inputs_info.size()) {
+                throw std::logic_error("The data shape histogram has " + std::to_string(weights.size()) +
+                                       " weights, while -data_shape sets " + std::to_string(app_inputs_info.size()) +
+                                       " shapes.");
+            }
+            if (inferenceOnly) {
+                throw std::logic_error(
+                    "The data shape histogram requires the full mode, please set -inference_only=false.");
+            }
+            shapeGroupDistribution.reset(new std::discrete_distribution<size_t>(weights.begin(), weights.end()));
+        }
+
         size_t processedFramesN = 0;
+        if (hwCounters) {
+            hwCounters->start();
+        }
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
@@ -809,28 +910,47 @@ int main(int argc, char* argv[]) {
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && iteration % nireq != 0 && !arrivals)) {
+            // the request arrives at its scheduled time, the wait for an idle request is its queueing
+            Time::time_point arrivalTime;
+            if (arrivals) {
+                std::chrono::nanoseconds offset;
+                if (!arrivals->next(offset) ||
+                    (duration_nanoseconds != 0LL && (uint64_t)offset.count() >= duration_nanoseconds &&
+                     (niter == 0LL || iteration >= niter))) {
+                    break;
+                }
+                arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(offset);
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
             }
 
             if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+                const size_t shapeGroup = shapeGroupDistribution ? (*shapeGroupDistribution)(shapeGroupGenerator)
+                                                                 : iteration % app_inputs_info.size();
+                auto inputs = app_inputs_info[shapeGroup];
 
                 if (FLAGS_pcseq) {
-                    inferRequest->setLatencyGroupId(iteration % app_inputs_info.size());
+                    inferRequest->setLatencyGroupId(shapeGroup, !shapeGroupInferred[shapeGroup]);
                 }
+                shapeGroupInferred[shapeGroup] = true;
 
                 if (isDynamicNetwork) {
                     batchSize = getBatchSize(inputs);
                 }
 
+                // the blobs of the shape group follow each other with the step of the number of the groups
                 for (auto& item : inputs) {
                     auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                    const auto& blobs = inputsData.at(inputName);
+                    const auto& data =
+                        blobs[(shapeGroup + app_inputs_info.size() * shapeGroupIterations[shapeGroup]) % blobs.size()];
                     inferRequest->setBlob(inputName, data);
                 }
+                ++shapeGroupIterations[shapeGroup];
 
                 if (useGpuMem) {
                     auto outputBlobs = ::gpu::getRemoteOutputBlobs(exeNetwork, inferRequest->getOutputClBuffer());
@@ -841,7 +961,11 @@ int main(int argc, char* argv[]) {
             }
 
             if (FLAGS_api == "sync") {
-                inferRequest->infer();
+                if (arrivals) {
+                    inferRequest->infer(arrivalTime);
+                } else {
+                    inferRequest->infer();
+                }
             } else {
                 // As the inference request is currently idle, the wait() adds no
                 // additional overhead (and should return immediately). The primary
@@ -850,7 +974,11 @@ int main(int argc, char* argv[]) {
                 // well, but as it uses just error codes it has no details like ‘what()’
                 // method of `std::exception` So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (arrivals) {
+                    inferRequest->startAsync(arrivalTime);
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             ++iteration;
 
@@ -873,18 +1001,59 @@ int main(int argc, char* argv[]) {
 
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
+        if (hwCounters) {
+            hwCounters->stop();
+        }
 
         LatencyMetrics generalLatency(inferRequestsQueue.getLatencies());
-        std::vector<LatencyMetrics> groupLatencies = {};
+        // the steady state latencies of the data shape groups and the latencies of their first inferences
+        std::vector<std::vector<double>> groupLatencies = {};
+        std::vector<std::vector<double>> groupFirstLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
-            for (auto lats : inferRequestsQueue.getLatencyGroups()) {
-                groupLatencies.push_back(LatencyMetrics(lats));
-            }
+            groupLatencies = inferRequestsQueue.getLatencyGroups();
+            groupFirstLatencies = inferRequestsQueue.getFirstLatencyGroups();
+            groupFirstLatencies[0] = {firstLatency};
         }
 
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / generalLatency.percentile(FLAGS_latency_percentile)
-                                           : 1000.0 * processedFramesN / totalDuration;
+        // the open loop is paced by the arrivals, so its throughput is the achieved rate
+        double fps = (FLAGS_api == "sync" && !arrivals)
+                         ? batchSize * 1000.0 / generalLatency.percentile(FLAGS_latency_percentile)
+                         : 1000.0 * processedFramesN / totalDuration;
+        double achievedQps = 1000.0 * iteration / totalDuration;
+        // the goodput counts only the requests completed within the SLO
+        size_t withinSlo = FLAGS_slo > 0 ? generalLatency.countWithin(FLAGS_slo) : 0;
+        double sloShare = iteration > 0 ? 100.0 * withinSlo / iteration : 0.0;
+        double goodput = fps * sloShare / 100.0;
+
+        // the hardware counters normalized per inference and per stream, the bandwidth is the one of the LLC misses
+        StatisticsReport::Parameters hwResults;
+        if (hwCounters && hwCounters->available() && iteration > 0) {
+            auto counts = hwCounters->read();
+            for (auto&& count : counts) {
+                hwResults.push_back({count.first + " per inference", double_to_string(count.second / iteration)});
+            }
+            if (counts.count("cycles") && counts.count("instructions") && counts.at("cycles") > 0) {
+                hwResults.push_back({"IPC", double_to_string(counts.at("instructions") / counts.at("cycles"))});
+            }
+            if (counts.count("LLC misses")) {
+                constexpr double cacheLineBytes = 64.0;
+                const double bandwidth = counts.at("LLC misses") * cacheLineBytes / (totalDuration * 1000000.0);
+                hwResults.push_back({"LLC miss bandwidth (GB/s)", double_to_string(bandwidth)});
+                size_t streams = 0;
+                for (auto& nstreams : device_nstreams) {
+                    try {
+                        streams += std::stoul(nstreams.second);
+                    } catch (const std::exception&) {
+                        // the number is unknown, e.g. AUTO
+                    }
+                }
+                if (streams > 0) {
+                    hwResults.push_back(
+                        {"LLC miss bandwidth per stream (GB/s)", double_to_string(bandwidth / streams)});
+                }
+            }
+        }
 
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -916,6 +1085,24 @@ int main(int argc, char* argv[]) {
                                           {
                                               {"Max latency (ms)", double_to_string(generalLatency.max())},
                                           });
+                if (arrivals) {
+                    // the tail of the latency under the load
+                    for (size_t p : {90, 99}) {
+                        statistics->addParameters(
+                            StatisticsReport::Category::EXECUTION_RESULTS,
+                            {
+                                {"latency (" + std::to_string(p) + " percentile) (ms)",
+                                 double_to_string(generalLatency.percentile(p))},
+                            });
+                    }
+                }
+                if (FLAGS_slo > 0) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                  {"requests within SLO (%)", double_to_string(sloShare)},
+                                                  {"goodput", double_to_string(goodput)},
+                                              });
+                }
 
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -931,30 +1118,48 @@ int main(int argc, char* argv[]) {
                         statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                                   {
                                                       {data_shapes_string, ""},
+                                                      {"Count", std::to_string(groupLatencies[i].size() +
+                                                                               groupFirstLatencies[i].size())},
                                                   });
+                        if (!groupFirstLatencies[i].empty()) {
+                            statistics->addParameters(
+                                StatisticsReport::Category::EXECUTION_RESULTS,
+                                {
+                                    {"First inference (ms)", double_to_string(groupFirstLatencies[i].front())},
+                                });
+                        }
+                        // the shape could be inferred only once or not at all, e.g. if it is sampled rarely
+                        if (groupLatencies[i].empty()) {
+                            continue;
+                        }
+                        LatencyMetrics groupLatency(groupLatencies[i]);
                         statistics->addParameters(
                             StatisticsReport::Category::EXECUTION_RESULTS,
                             {
-                                {latency_label,
-                                 double_to_string(groupLatencies[i].percentile(FLAGS_latency_percentile))},
+                                {latency_label, double_to_string(groupLatency.percentile(FLAGS_latency_percentile))},
                             });
                         statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                                   {
-                                                      {"Average (ms)", double_to_string(groupLatencies[i].average())},
+                                                      {"Average (ms)", double_to_string(groupLatency.average())},
                                                   });
                         statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                                   {
-                                                      {"Min (ms)", double_to_string(groupLatencies[i].min())},
+                                                      {"Min (ms)", double_to_string(groupLatency.min())},
                                                   });
                         statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                                   {
-                                                      {"Max (ms)", double_to_string(groupLatencies[i].max())},
+                                                      {"Max (ms)", double_to_string(groupLatency.max())},
                                                   });
                     }
                 }
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {{"throughput", double_to_string(fps)}});
+            if (arrivals) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {{"achieved QPS", double_to_string(achievedQps)}});
+            }
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, hwResults);
         }
         progressBar.finish();
 
@@ -1003,6 +1208,12 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency: " << slog::endl;
             generalLatency.logTotal(FLAGS_latency_percentile);
+            if (arrivals) {
+                slog::info << "\t90 percentile:    " << double_to_string(generalLatency.percentile(90)) << " ms"
+                           << slog::endl;
+                slog::info << "\t99 percentile:    " << double_to_string(generalLatency.percentile(99)) << " ms"
+                           << slog::endl;
+            }
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
@@ -1017,11 +1228,33 @@ int main(int argc, char* argv[]) {
                     }
                     slog::info << slog::endl;
 
-                    groupLatencies[i].logTotal(FLAGS_latency_percentile);
+                    slog::info << "\tCount:  " << groupLatencies[i].size() + groupFirstLatencies[i].size()
+                               << " iterations" << slog::endl;
+                    if (!groupFirstLatencies[i].empty()) {
+                        slog::info << "\tFirst:  " << double_to_string(groupFirstLatencies[i].front()) << " ms"
+                                   << slog::endl;
+                    }
+                    if (!groupLatencies[i].empty()) {
+                        LatencyMetrics(groupLatencies[i]).logTotal(FLAGS_latency_percentile);
+                    }
                 }
             }
         }
         slog::info << "Throughput: " << double_to_string(fps) << " FPS" << slog::endl;
+        if (arrivals) {
+            slog::info << "Achieved QPS: " << double_to_string(achievedQps) << slog::endl;
+        }
+        if (!hwResults.empty()) {
+            slog::info << "Hardware counters:" << slog::endl;
+            for (auto& result : hwResults) {
+                slog::info << "\t" << result.first << ": " << result.second << slog::endl;
+            }
+        }
+        if (FLAGS_slo > 0 && device_name.find("MULTI") == std::string::npos) {
+            slog::info << "Goodput:    " << double_to_string(goodput) << " FPS (" << double_to_string(sloShare)
+                       << "% of the requests within the SLO of " << double_to_string(FLAGS_slo) << " ms)"
+                       << slog::endl;
+        }
 
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
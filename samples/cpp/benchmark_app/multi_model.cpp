@@ -0,0 +1,279 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <fstream>
+#include <future>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <samples/slog.hpp>
+
+#include "arrival_schedule.hpp"
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "multi_model.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace benchmark_app {
+
+namespace {
+
+struct ModelRun {
+    explicit ModelRun(const ModelConfig& config) : config(config) {}
+
+    const ModelConfig& config;
+    InferenceEngine::ExecutableNetwork network;
+    std::unique_ptr<InferRequestsQueue> requests;
+    size_t batchSize = 1;
+};
+
+struct PhaseResult {
+    std::vector<double> latencies;
+    size_t iterations = 0;
+    double durationMs = 0;
+};
+
+std::string toPerformanceHint(const std::string& hint) {
+    if (hint == "throughput" || hint == "tput") {
+        return CONFIG_VALUE(THROUGHPUT);
+    }
+    if (hint == "latency") {
+        return CONFIG_VALUE(LATENCY);
+    }
+    if (!hint.empty()) {
+        throw std::logic_error("Incorrect performance hint " + hint +
+                               " in the models config, please set it to either `throughput`(tput) or `latency'.");
+    }
+    return hint;
+}
+
+void loadModel(InferenceEngine::Core& ie, ModelRun& run) {
+    std::map<std::string, std::string> config;
+    const auto hint = toPerformanceHint(run.config.hint);
+    if (!hint.empty()) {
+        config[CONFIG_KEY(PERFORMANCE_HINT)] = hint;
+    }
+    auto startTime = Time::now();
+    run.network = ie.LoadNetwork(run.config.model, run.config.device, config);
+    slog::info << "Load network " << run.config.model << " to " << run.config.device << " took "
+               << double_to_string(get_duration_ms_till_now(startTime)) << " ms" << slog::endl;
+
+    uint32_t nireq = run.config.nireq;
+    if (nireq == 0) {
+        nireq = run.network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    }
+    run.requests.reset(new InferRequestsQueue(run.network, nireq, 1, false));
+
+    // the inputs are filled once with the random data, as in the inference only mode
+    auto inputsInfo = getInputsInfo<InferenceEngine::InputInfo::CPtr>("",
+                                                                      "",
+                                                                      0,
+                                                                      "",
+                                                                      "",
+                                                                      "",
+                                                                      run.network.GetInputsInfo());
+    run.batchSize = getBatchSize(inputsInfo[0]);
+    auto inputsData = getBlobsStaticCase({}, run.batchSize, inputsInfo[0], nireq);
+    size_t i = 0;
+    for (auto& request : run.requests->requests) {
+        for (auto& item : inputsData) {
+            InferenceEngine::Blob::Ptr requestBlob = request->getBlob(item.first);
+            copyBlobData(requestBlob, item.second[i % item.second.size()]);
+        }
+        ++i;
+    }
+}
+
+PhaseResult runModel(ModelRun& run, const Time::time_point& startTime, uint64_t durationNanoseconds) {
+    std::unique_ptr<ArrivalSchedule> arrivals;
+    if (run.config.qps > 0) {
+        arrivals.reset(new ArrivalSchedule(poissonArrival, run.config.qps));
+    }
+    std::this_thread::sleep_until(startTime);
+    run.requests->resetTimes();
+
+    PhaseResult result;
+    while (true) {
+        Time::time_point arrivalTime;
+        if (arrivals) {
+            std::chrono::nanoseconds offset;
+            arrivals->next(offset);
+            if ((uint64_t)offset.count() >= durationNanoseconds) {
+                break;
+            }
+            arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(offset);
+            std::this_thread::sleep_until(arrivalTime);
+        } else if ((uint64_t)std::chrono::duration_cast<ns>(Time::now() - startTime).count() >= durationNanoseconds) {
+            break;
+        }
+        auto request = run.requests->getIdleRequest();
+        // rethrows the error of the previous inference of the request
+        request->wait();
+        if (arrivals) {
+            request->startAsync(arrivalTime);
+        } else {
+            request->startAsync();
+        }
+        ++result.iterations;
+    }
+    run.requests->waitAll();
+
+    result.latencies = run.requests->getLatencies();
+    result.durationMs = run.requests->getDurationInMilliseconds();
+    if (result.latencies.empty()) {
+        throw std::logic_error("No inference of " + run.config.model + " completed, please increase -t or qps.");
+    }
+    return result;
+}
+
+void report(const std::string& label,
+            size_t batchSize,
+            PhaseResult& result,
+            const std::shared_ptr<StatisticsReport>& statistics) {
+    LatencyMetrics latency(result.latencies);
+    const double fps = 1000.0 * result.iterations * batchSize / result.durationMs;
+    slog::info << "\t" << label << ": median " << double_to_string(latency.percentile(50)) << " ms, 99 percentile "
+               << double_to_string(latency.percentile(99)) << " ms, throughput " << double_to_string(fps) << " FPS"
+               << slog::endl;
+    if (statistics) {
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {
+                                      {label + " Median latency (ms)", double_to_string(latency.percentile(50))},
+                                      {label + " latency (99 percentile) (ms)",
+                                       double_to_string(latency.percentile(99))},
+                                      {label + " throughput", double_to_string(fps)},
+                                  });
+    }
+}
+
+}  // namespace
+
+std::vector<ModelConfig> parseModelsConfig(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open the models config " + path);
+    }
+    std::vector<ModelConfig> models;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream tokens(line);
+        std::string token;
+        ModelConfig model;
+        bool empty = true;
+        while (tokens >> token) {
+            if (token.front() == '#') {
+                break;
+            }
+            empty = false;
+            const auto pos = token.find('=');
+            if (pos == std::string::npos) {
+                throw std::logic_error("Incorrect token " + token + " of the models config, key=value is expected.");
+            }
+            const auto key = token.substr(0, pos);
+            const auto value = token.substr(pos + 1);
+            if (key == "model") {
+                model.model = value;
+            } else if (key == "device") {
+                model.device = value;
+            } else if (key == "hint") {
+                model.hint = value;
+            } else if (key == "qps") {
+                model.qps = std::stod(value);
+            } else if (key == "nireq") {
+                model.nireq = static_cast<uint32_t>(std::stoul(value));
+            } else {
+                throw std::logic_error("Unknown key " + key + " of the models config.");
+            }
+        }
+        if (empty) {
+            continue;
+        }
+        if (model.model.empty()) {
+            throw std::logic_error("The model is not set in the line \"" + line + "\" of the models config.");
+        }
+        if (model.qps < 0) {
+            throw std::logic_error("The qps of " + model.model + " must be positive or 0 for the closed loop.");
+        }
+        models.push_back(model);
+    }
+    if (models.empty()) {
+        throw std::logic_error("The models config " + path + " has no models.");
+    }
+    return models;
+}
+
+void benchmarkModels(InferenceEngine::Core& ie,
+                     const std::vector<ModelConfig>& models,
+                     uint32_t durationSeconds,
+                     const std::shared_ptr<StatisticsReport>& statistics) {
+    std::vector<std::unique_ptr<ModelRun>> runs;
+    for (auto& model : models) {
+        runs.emplace_back(new ModelRun(model));
+        loadModel(ie, *runs.back());
+    }
+
+    // warming up - out of scope
+    for (auto& run : runs) {
+        run->requests->getIdleRequest()->startAsync();
+        run->requests->waitAll();
+    }
+
+    const auto durationNanoseconds = getDurationInNanoseconds(durationSeconds);
+    std::vector<PhaseResult> solo;
+    for (auto& run : runs) {
+        slog::info << "Benchmarking " << run->config.model << " alone for "
+                   << getDurationInMilliseconds(durationSeconds) << " ms" << slog::endl;
+        solo.push_back(runModel(*run, Time::now(), durationNanoseconds));
+    }
+
+    slog::info << "Benchmarking " << runs.size() << " models concurrently for "
+               << getDurationInMilliseconds(durationSeconds) << " ms" << slog::endl;
+    // the models start together after all the threads are spawned
+    const auto startTime = Time::now() + std::chrono::milliseconds(100);
+    std::vector<std::future<PhaseResult>> futures;
+    for (auto& run : runs) {
+        auto model = run.get();
+        futures.push_back(std::async(std::launch::async, [model, startTime, durationNanoseconds] {
+            return runModel(*model, startTime, durationNanoseconds);
+        }));
+    }
+    std::vector<PhaseResult> concurrent;
+    for (auto& future : futures) {
+        concurrent.push_back(future.get());
+    }
+
+    for (size_t i = 0; i < runs.size(); ++i) {
+        const auto& config = runs[i]->config;
+        const std::string label = std::to_string(i + 1) + ". " + config.model + " on " + config.device;
+        slog::info << label << (config.qps > 0 ? ", " + double_to_string(config.qps) + " QPS" : ", closed loop")
+                   << slog::endl;
+        report(label + " solo", runs[i]->batchSize, solo[i], statistics);
+        report(label + " concurrent", runs[i]->batchSize, concurrent[i], statistics);
+
+        LatencyMetrics soloLatency(solo[i].latencies);
+        LatencyMetrics concurrentLatency(concurrent[i].latencies);
+        const double latencyRatio = concurrentLatency.percentile(50) / soloLatency.percentile(50);
+        const double throughputRatio =
+            (concurrent[i].iterations / concurrent[i].durationMs) / (solo[i].iterations / solo[i].durationMs);
+        slog::info << "\tinterference: median latency x" << double_to_string(latencyRatio) << ", throughput x"
+                   << double_to_string(throughputRatio) << slog::endl;
+        if (statistics) {
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                          {label + " median latency ratio", double_to_string(latencyRatio)},
+                                          {label + " throughput ratio", double_to_string(throughputRatio)},
+                                      });
+        }
+    }
+}
+
+}  // namespace benchmark_app
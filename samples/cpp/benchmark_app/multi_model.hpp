@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "inference_engine.hpp"
+
+#include "statistics_report.hpp"
+// clang-format on
+
+namespace benchmark_app {
+
+/// @brief The model of the multi-model mode, a line of the models config
+struct ModelConfig {
+    std::string model;
+    std::string device = "CPU";
+    std::string hint;
+    double qps = 0;  // 0 means the closed loop
+    uint32_t nireq = 0;  // 0 means the optimal number of the device
+};
+
+/// @brief Parses the models config: a model per line as whitespace-separated key=value pairs with the "model", "device",
+/// "hint" (throughput or latency), "qps" and "nireq" keys, e.g. "model=a.xml device=CPU hint=latency qps=50"
+std::vector<ModelConfig> parseModelsConfig(const std::string& path);
+
+/**
+ * @brief Benchmarks the models in the core: each model runs alone, then all of them run concurrently, each from its
+ * own thread. Reports the latency and throughput of each model in both phases and the interference: the ratio of the
+ * concurrent median latency to the solo one.
+ * @param durationSeconds The duration of each phase
+ */
+void benchmarkModels(InferenceEngine::Core& ie,
+                     const std::vector<ModelConfig>& models,
+                     uint32_t durationSeconds,
+                     const std::shared_ptr<StatisticsReport>& statistics);
+
+}  // namespace benchmark_app
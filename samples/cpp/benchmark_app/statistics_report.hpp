@@ -59,6 +59,11 @@ public:
         return latencies.back();
     }
 
+    /// @brief the number of the latencies not greater than the threshold, e.g. an SLO
+    size_t countWithin(double threshold) {
+        return std::upper_bound(latencies.begin(), latencies.end(), threshold) - latencies.begin();
+    }
+
     void logTotal(size_t p) {
         std::string percentileStr = (p == 50) ? "\tMedian:  " : "\t" + std::to_string(p) + " percentile:    ";
         slog::info << percentileStr << double_to_string(percentile(p)) << " ms" << slog::endl;
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <fstream>
 #include <map>
 #include <regex>
 #include <string>
@@ -107,6 +108,31 @@ std::vector<float> splitFloat(const std::string& s, char delim) {
     return result;
 }
 
+std::vector<double> loadDataShapeHistogram(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open the data shape histogram " + filename);
+    }
+    std::vector<double> weights;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        const double weight = std::stod(line);
+        if (weight < 0) {
+            throw std::logic_error("The weights of the data shape histogram " + filename + " must be non-negative.");
+        }
+        weights.push_back(weight);
+    }
+    if (std::all_of(weights.begin(), weights.end(), [](double weight) {
+            return weight == 0;
+        })) {
+        throw std::logic_error("The data shape histogram " + filename + " has no positive weights.");
+    }
+    return weights;
+}
+
 std::vector<std::string> parseDevices(const std::string& device_string) {
     std::string comma_separated_devices = device_string;
     auto colon = comma_separated_devices.find(":");
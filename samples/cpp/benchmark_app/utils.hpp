@@ -74,6 +74,7 @@ std::vector<ngraph::Dimension> parsePartialShape(const std::string& partial_shap
 InferenceEngine::SizeVector parseTensorShape(const std::string& data_shape);
 std::pair<std::string, std::vector<std::string>> parseInputFiles(const std::string& file_paths_string);
 std::map<std::string, std::vector<std::string>> parseInputArguments(const std::vector<std::string>& args);
+std::vector<double> loadDataShapeHistogram(const std::string& filename);
 
 template <typename T>
 std::map<std::string, std::vector<std::string>> parseInputParameters(const std::string parameter_string,
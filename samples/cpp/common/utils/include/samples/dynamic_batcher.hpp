@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file with the dynamic batcher, which coalesces the samples of the application into batches
+ * @file dynamic_batcher.hpp
+ */
+
+#pragma once
+
+// clang-format off
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "openvino/openvino.hpp"
+// clang-format on
+
+/**
+ * @class DynamicBatcher
+ * @brief The DynamicBatcher class coalesces the samples submitted by many threads into the batches of a compiled model.
+ * The samples are collected until the max batch is reached or the max delay since the first of them runs out, then the
+ * batch is padded to the batch of the model, inferred and scattered to the futures of the samples.
+ * The submission is lock-free, the inputs of the samples are set with set_input_tensors, so the batch isn't copied
+ * together by the batcher, and the outputs of a sample are the views of the outputs of its batch.
+ * The batch is the first dimension of the inputs and outputs of the model, which must be static, e.g. set with
+ * ov::set_batch before the model is compiled.
+ */
+class DynamicBatcher {
+public:
+    /// @brief the tensors of a sample by the indices of the inputs or outputs of the model, with the batch 1
+    using Tensors = std::vector<ov::runtime::Tensor>;
+
+    /**
+     * @brief A constructor. Creates the infer requests and starts the batching thread
+     * @param compiled_model The model compiled with the batch
+     * @param max_batch The max number of the samples in a batch, 0 for the batch of the model
+     * @param max_delay The max time the first sample of a batch waits for the others
+     * @param nireq The number of the infer requests, which infer the batches in parallel
+     */
+    DynamicBatcher(ov::runtime::CompiledModel& compiled_model,
+                   size_t max_batch,
+                   std::chrono::microseconds max_delay,
+                   size_t nireq = 1);
+
+    /**
+     * @brief A destructor. Infers the samples submitted before and stops the batching thread
+     */
+    ~DynamicBatcher();
+
+    DynamicBatcher(const DynamicBatcher&) = delete;
+    DynamicBatcher& operator=(const DynamicBatcher&) = delete;
+
+    /**
+     * @brief Submits a sample, it can be called from any number of threads
+     * @param inputs The input tensors of the sample, they must not be changed until the future is ready
+     * @return The future of the output tensors of the sample
+     */
+    std::future<Tensors> submit(Tensors inputs);
+
+private:
+    struct Item {
+        Tensors inputs;
+        std::promise<Tensors> promise;
+        std::chrono::steady_clock::time_point arrival;
+        Item* next = nullptr;
+    };
+
+    struct Slot {
+        ov::runtime::InferRequest request;
+        std::vector<std::unique_ptr<Item>> items;
+    };
+
+    void run();
+    void drain();
+    void infer(Slot& slot);
+    void complete(Slot& slot, std::exception_ptr exception);
+
+    size_t _batch = 0;
+    size_t _max_batch = 0;
+    std::chrono::microseconds _max_delay;
+    std::vector<ov::Output<const ov::Node>> _outputs;
+    // zeros with the batch 1 per input, which pad the batches which are not full
+    Tensors _padding;
+
+    // the stack of the submitted items, which the batching thread takes at once
+    std::atomic<Item*> _head{nullptr};
+    // the items taken from the stack in the order of the submission, used by the batching thread only
+    std::deque<std::unique_ptr<Item>> _pending;
+
+    std::vector<std::unique_ptr<Slot>> _slots;
+    std::mutex _mutex;
+    // wakes the batching thread on the first submitted item, an idle request or the stop
+    std::condition_variable _cv;
+    std::vector<Slot*> _idle;
+    bool _stop = false;
+    std::thread _thread;
+};
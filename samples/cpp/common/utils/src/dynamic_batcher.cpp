@@ -0,0 +1,197 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "samples/dynamic_batcher.hpp"
+// clang-format on
+
+DynamicBatcher::DynamicBatcher(ov::runtime::CompiledModel& compiled_model,
+                               size_t max_batch,
+                               std::chrono::microseconds max_delay,
+                               size_t nireq)
+    : _max_delay(max_delay),
+      _outputs(compiled_model.outputs()) {
+    for (auto&& input : compiled_model.inputs()) {
+        if (input.get_partial_shape().is_dynamic() || input.get_shape().empty()) {
+            throw std::logic_error("The dynamic batcher requires the static inputs with the batch dimension");
+        }
+        auto shape = input.get_shape();
+        if (_batch != 0 && shape[0] != _batch) {
+            throw std::logic_error("The inputs of the model have the different batches");
+        }
+        _batch = shape[0];
+        shape[0] = 1;
+        ov::runtime::Tensor padding(input.get_element_type(), shape);
+        std::memset(padding.data(), 0, padding.get_byte_size());
+        _padding.push_back(padding);
+    }
+    if (_padding.empty()) {
+        throw std::logic_error("The dynamic batcher requires a model with the inputs");
+    }
+    _max_batch = max_batch == 0 ? _batch : std::min(max_batch, _batch);
+
+    for (size_t i = 0; i < std::max<size_t>(nireq, 1); ++i) {
+        _slots.emplace_back(new Slot{compiled_model.create_infer_request(), {}});
+        Slot* slot = _slots.back().get();
+        slot->request.set_callback([this, slot](std::exception_ptr exception) {
+            complete(*slot, exception);
+        });
+        _idle.push_back(slot);
+    }
+    _thread = std::thread(&DynamicBatcher::run, this);
+}
+
+DynamicBatcher::~DynamicBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_one();
+    _thread.join();
+}
+
+std::future<DynamicBatcher::Tensors> DynamicBatcher::submit(Tensors inputs) {
+    if (inputs.size() != _padding.size()) {
+        throw std::logic_error("The sample has " + std::to_string(inputs.size()) + " inputs, the model has " +
+                               std::to_string(_padding.size()));
+    }
+    std::unique_ptr<Item> item(new Item);
+    item->inputs = std::move(inputs);
+    item->arrival = std::chrono::steady_clock::now();
+    auto future = item->promise.get_future();
+
+    Item* head = _head.load(std::memory_order_relaxed);
+    do {
+        item->next = head;
+    } while (!_head.compare_exchange_weak(head, item.get(), std::memory_order_release, std::memory_order_relaxed));
+    item.release();
+    // the batching thread waits only if the stack is empty, so only the first item wakes it
+    if (head == nullptr) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _cv.notify_one();
+    }
+    return future;
+}
+
+void DynamicBatcher::drain() {
+    Item* head = _head.exchange(nullptr, std::memory_order_acquire);
+    // the stack is in the reverse order of the submission
+    std::vector<Item*> items;
+    for (; head != nullptr; head = head->next) {
+        items.push_back(head);
+    }
+    for (auto it = items.rbegin(); it != items.rend(); ++it) {
+        _pending.emplace_back(*it);
+    }
+}
+
+void DynamicBatcher::run() {
+    auto submitted = [this] {
+        return _stop || _head.load(std::memory_order_relaxed) != nullptr;
+    };
+    while (true) {
+        drain();
+        if (_pending.empty()) {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (_stop && _head.load(std::memory_order_relaxed) == nullptr) {
+                break;
+            }
+            _cv.wait(lock, submitted);
+            continue;
+        }
+
+        // waits for the others till the max delay of the first one, the stop flushes the samples at once
+        const auto deadline = _pending.front()->arrival + _max_delay;
+        while (_pending.size() < _max_batch) {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (_stop || !_cv.wait_until(lock, deadline, submitted)) {
+                break;
+            }
+            lock.unlock();
+            drain();
+        }
+
+        Slot* slot = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this] {
+                return !_idle.empty();
+            });
+            slot = _idle.back();
+            _idle.pop_back();
+        }
+        const size_t size = std::min(_pending.size(), _max_batch);
+        for (size_t i = 0; i < size; ++i) {
+            slot->items.push_back(std::move(_pending.front()));
+            _pending.pop_front();
+        }
+        infer(*slot);
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] {
+        return _idle.size() == _slots.size();
+    });
+}
+
+void DynamicBatcher::infer(Slot& slot) {
+    try {
+        for (size_t i = 0; i < _padding.size(); ++i) {
+            Tensors tensors;
+            tensors.reserve(_batch);
+            for (auto&& item : slot.items) {
+                tensors.push_back(item->inputs[i]);
+            }
+            tensors.resize(_batch, _padding[i]);
+            slot.request.set_input_tensors(i, tensors);
+        }
+        // the outputs are allocated per batch, so the views of the previous batches stay valid
+        for (size_t i = 0; i < _outputs.size(); ++i) {
+            ov::runtime::Tensor output(_outputs[i].get_element_type(), _outputs[i].get_shape());
+            slot.request.set_output_tensor(i, output);
+        }
+        slot.request.start_async();
+    } catch (...) {
+        complete(slot, std::current_exception());
+    }
+}
+
+void DynamicBatcher::complete(Slot& slot, std::exception_ptr exception) {
+    std::vector<Tensors> outputs(slot.items.size());
+    if (!exception) {
+        try {
+            for (size_t i = 0; i < _outputs.size(); ++i) {
+                auto batched = slot.request.get_output_tensor(i);
+                const auto shape = batched.get_shape();
+                for (size_t k = 0; k < slot.items.size(); ++k) {
+                    ov::Coordinate begin(shape.size(), 0), end(shape);
+                    begin[0] = k;
+                    end[0] = k + 1;
+                    outputs[k].emplace_back(batched, begin, end);
+                }
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+    for (size_t k = 0; k < slot.items.size(); ++k) {
+        if (exception) {
+            slot.items[k]->promise.set_exception(exception);
+        } else {
+            slot.items[k]->promise.set_value(std::move(outputs[k]));
+        }
+    }
+    slot.items.clear();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _idle.push_back(&slot);
+    }
+    _cv.notify_one();
+}
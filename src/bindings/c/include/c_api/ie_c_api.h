@@ -58,6 +58,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -705,6 +706,61 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_wait(ie_infer
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size);
 
+/**
+ * @brief Starts asynchronous inference of several infer requests with one call.
+ * @ingroup InferRequest
+ * @param infer_requests An array of pointers to ie_infer_request_t instances.
+ * @param num_requests The number of the infer requests in the array.
+ * @return Status code of the operation: OK(0) for success. On failure, only the requests before the failed one are started.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_requests_infer_async(ie_infer_request_t **infer_requests, const size_t num_requests);
+
+/**
+ * @brief Creates a queue the completions of asynchronous requests are pushed to, as an alternative to the callbacks.
+ * Use the ie_completion_queue_free() method to free memory.
+ * @ingroup InferRequest
+ * @param queue A pointer to the newly created ie_completion_queue_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by ie_completion_queue_t instance. The requests pushing to the queue must be freed or completed before.
+ * @ingroup InferRequest
+ * @param queue A pointer to the ie_completion_queue_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Gets the file descriptor which is readable while the queue is not empty, to be polled along with the other descriptors.
+ * The descriptor is owned by the queue and must not be read or closed.
+ * @ingroup InferRequest
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param fd A pointer to the file descriptor.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED if the OS has no eventfd.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_get_fd(const ie_completion_queue_t *queue, int *fd);
+
+/**
+ * @brief Pops the earliest completion from the queue without blocking.
+ * @ingroup InferRequest
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param args A pointer to the args the completed request was bound to the queue with.
+ * @param infer_status A pointer to the status of the completed inference.
+ * @return Status code of the operation: OK(0) for success, RESULT_NOT_READY if the queue is empty.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_pop(ie_completion_queue_t *queue, void **args, IEStatusCode *infer_status);
+
+/**
+ * @brief Makes the infer request push its completions to the queue instead of calling a callback.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param args The args the completions of the request are pushed with, to identify it.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *args);
+
 /** @} */ // end of InferRequest
 
 // Network
@@ -15,6 +15,12 @@
 #include <memory>
 #include <streambuf>
 #include <istream>
+#include <deque>
+#include <mutex>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "ie_compound_blob.h"
@@ -46,6 +52,16 @@ struct ie_infer_request {
     IE::InferRequest object;
 };
 
+/**
+ * @struct ie_completion_queue
+ * @brief This struct queues the completions of asynchronous infer requests, the eventfd is readable while it is not empty
+ */
+struct ie_completion_queue {
+    std::mutex mutex;
+    std::deque<std::pair<void *, IEStatusCode>> completions;
+    int fd = -1;
+};
+
 /**
  * @struct ie_blob
  * @brief This struct represents a universal container in the Inference Engine
@@ -1337,6 +1353,115 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_infer_requests_infer_async(ie_infer_request_t **infer_requests, const size_t num_requests) {
+    if (infer_requests == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    for (size_t i = 0; i < num_requests; ++i) {
+        if (infer_requests[i] == nullptr) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        try {
+            infer_requests[i]->object.StartAsync();
+        } CATCH_IE_EXCEPTIONS
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::unique_ptr<ie_completion_queue_t> completion_queue(new ie_completion_queue_t);
+#ifdef __linux__
+    completion_queue->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (completion_queue->fd == -1) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+#endif
+    *queue = completion_queue.release();
+
+    return IEStatusCode::OK;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+#ifdef __linux__
+        if (*queue && (*queue)->fd != -1) {
+            close((*queue)->fd);
+        }
+#endif
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_completion_queue_get_fd(const ie_completion_queue_t *queue, int *fd) {
+    if (queue == nullptr || fd == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    if (queue->fd == -1) {
+        return IEStatusCode::NOT_IMPLEMENTED;
+    }
+    *fd = queue->fd;
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_pop(ie_completion_queue_t *queue, void **args, IEStatusCode *infer_status) {
+    if (queue == nullptr || args == nullptr || infer_status == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->completions.empty()) {
+        return IEStatusCode::RESULT_NOT_READY;
+    }
+    *args = queue->completions.front().first;
+    *infer_status = queue->completions.front().second;
+    queue->completions.pop_front();
+#ifdef __linux__
+    // resets the counter, so the fd is not readable until the next completion
+    if (queue->completions.empty()) {
+        uint64_t counter = 0;
+        ssize_t size = read(queue->fd, &counter, sizeof(counter));
+        (void)size;
+    }
+#endif
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *args) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || queue == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        std::function<void(IE::InferRequest, IE::StatusCode)> fun = [=](IE::InferRequest, IE::StatusCode code) {
+            auto it = status_map.find(code);
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->completions.emplace_back(args, it != status_map.end() ? it->second : IEStatusCode::UNEXPECTED);
+#ifdef __linux__
+            // the write is done under the lock, so the fd is readable exactly while the queue is not empty
+            const uint64_t increment = 1;
+            ssize_t size = write(queue->fd, &increment, sizeof(increment));
+            (void)size;
+#endif
+        };
+        infer_request->object.SetCompletionCallback(fun);
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -12,6 +12,9 @@
 #include <inference_engine.hpp>
 #include "test_model_repo.hpp"
 #include <fstream>
+#ifdef __linux__
+#include <poll.h>
+#endif
 
 std::string xml_std = TestDataHelpers::generate_model_path("test_model", "test_model_fp32.xml"),
             bin_std = TestDataHelpers::generate_model_path("test_model", "test_model_fp32.bin"),
@@ -1677,6 +1680,77 @@ TEST(ie_infer_set_completion_callback, setCallback) {
     ie_core_free(&core);
 }
 
+TEST(ie_completion_queue, inferAsyncBatchToQueue) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_completion_queue_t *queue = nullptr;
+    IE_ASSERT_OK(ie_completion_queue_create(&queue));
+
+    cv::Mat image = cv::imread(input_image);
+    const size_t num_requests = 2;
+    int ids[num_requests] = {0, 1};
+    ie_infer_request_t *infer_requests[num_requests] = {nullptr, nullptr};
+    for (size_t i = 0; i < num_requests; ++i) {
+        IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_requests[i]));
+        EXPECT_NE(nullptr, infer_requests[i]);
+
+        ie_blob_t *blob = nullptr;
+        IE_EXPECT_OK(ie_infer_request_get_blob(infer_requests[i], "data", &blob));
+        Mat2Blob(image, blob);
+        ie_blob_free(&blob);
+
+        IE_EXPECT_OK(ie_infer_request_set_completion_queue(infer_requests[i], queue, &ids[i]));
+    }
+
+    void *args = nullptr;
+    IEStatusCode infer_status = IEStatusCode::OK;
+    EXPECT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_pop(queue, &args, &infer_status));
+
+    IE_EXPECT_OK(ie_infer_requests_infer_async(infer_requests, num_requests));
+
+    if (!HasFatalFailure()) {
+        int completed[num_requests] = {0, 0};
+        for (size_t i = 0; i < num_requests; ++i) {
+#ifdef __linux__
+            int fd = -1;
+            IE_EXPECT_OK(ie_completion_queue_get_fd(queue, &fd));
+            pollfd poll_fd = {fd, POLLIN, 0};
+            EXPECT_EQ(1, poll(&poll_fd, 1, -1));
+#else
+            IE_EXPECT_OK(ie_infer_request_wait(infer_requests[i], -1));
+#endif
+            while (ie_completion_queue_pop(queue, &args, &infer_status) == IEStatusCode::OK) {
+                IE_EXPECT_OK(infer_status);
+                ++completed[*static_cast<int *>(args)];
+            }
+        }
+        EXPECT_EQ(1, completed[0]);
+        EXPECT_EQ(1, completed[1]);
+    }
+
+    for (size_t i = 0; i < num_requests; ++i) {
+        ie_infer_request_free(&infer_requests[i]);
+    }
+    ie_completion_queue_free(&queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_blob_make_memory_nv12, makeNV12Blob) {
     dimensions_t dim_y = {4, {1, 1, 8, 12}}, dim_uv = {4, {1, 2, 4, 6}};
     tensor_desc tensor_y, tensor_uv;
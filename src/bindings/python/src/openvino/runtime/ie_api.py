@@ -22,8 +22,12 @@ def tensor_from_file(path: str) -> Tensor:
     return Tensor(np.fromfile(path, dtype=np.uint8))
 
 
-def normalize_inputs(py_dict: dict, py_types: dict) -> dict:
-    """Normalize a dictionary of inputs to Tensors."""
+def normalize_inputs(py_dict: dict, py_types: dict, shared_memory: bool = False) -> dict:
+    """Normalize a dictionary of inputs to Tensors.
+
+    With shared_memory the inputs are normalized to C contiguous numpy arrays of the port types
+    instead, the arrays which already are such are passed as is and shared with the request.
+    """
     for k, val in py_dict.items():
         if not isinstance(k, (str, int)):
             raise TypeError("Incompatible key type for tensor named: {}".format(k))
@@ -31,11 +35,12 @@ def normalize_inputs(py_dict: dict, py_types: dict) -> dict:
             ov_type = py_types[k]
         except KeyError:
             raise KeyError("Port for tensor named {} was not found!".format(k))
-        py_dict[k] = (
-            val
-            if isinstance(val, Tensor)
-            else Tensor(np.array(val, get_dtype(ov_type)))
-        )
+        if isinstance(val, Tensor):
+            py_dict[k] = val
+        elif shared_memory:
+            py_dict[k] = np.require(val, get_dtype(ov_type), "C")
+        else:
+            py_dict[k] = Tensor(np.array(val, get_dtype(ov_type)))
     return py_dict
 
 
@@ -55,17 +60,28 @@ def get_input_types(obj: Union[InferRequestBase, CompiledModelBase]) -> dict:
 class InferRequest(InferRequestBase):
     """InferRequest wrapper."""
 
-    def infer(self, inputs: dict = None) -> dict:
-        """Infer wrapper for InferRequest."""
+    def infer(self, inputs: dict = None, shared_memory: bool = False) -> dict:
+        """Infer wrapper for InferRequest.
+
+        With shared_memory the results are the numpy views of the output tensors instead of the
+        copies: they stay valid after the request is destroyed, but the next inference of the
+        request overwrites them.
+        """
         inputs = (
             {} if inputs is None else normalize_inputs(inputs, get_input_types(self))
         )
-        return super().infer(inputs)
+        return super().infer(inputs, shared_memory)
 
     def start_async(self, inputs: dict = None, userdata: Any = None) -> None:
-        """Asynchronous infer wrapper for InferRequest."""
+        """Asynchronous infer wrapper for InferRequest.
+
+        The C contiguous numpy arrays of the port types are used without a copy, so they must not
+        be modified until the request is completed.
+        """
         inputs = (
-            {} if inputs is None else normalize_inputs(inputs, get_input_types(self))
+            {}
+            if inputs is None
+            else normalize_inputs(inputs, get_input_types(self), shared_memory=True)
         )
         super().start_async(inputs, userdata)
 
@@ -77,12 +93,16 @@ class CompiledModel(CompiledModelBase):
         """Create new InferRequest object."""
         return InferRequest(super().create_infer_request())
 
-    def infer_new_request(self, inputs: dict = None) -> dict:
-        """Infer wrapper for CompiledModel."""
+    def infer_new_request(self, inputs: dict = None, shared_memory: bool = False) -> dict:
+        """Infer wrapper for CompiledModel.
+
+        With shared_memory the results are the numpy views of the output tensors of the new
+        request instead of the copies, they keep its output memory alive.
+        """
         inputs = (
             {} if inputs is None else normalize_inputs(inputs, get_input_types(self))
         )
-        return super().infer_new_request(inputs)
+        return super().infer_new_request(inputs, shared_memory)
 
 
 class AsyncInferQueue(AsyncInferQueueBase):
@@ -93,14 +113,18 @@ class AsyncInferQueue(AsyncInferQueueBase):
         return InferRequest(super().__getitem__(i))
 
     def start_async(self, inputs: dict = None, userdata: Any = None) -> None:
-        """Asynchronous infer wrapper for AsyncInferQueue."""
-        inputs = (
-            {}
-            if inputs is None
-            else normalize_inputs(
-                inputs, get_input_types(self[self.get_idle_request_id()])
-            )
-        )
+        """Asynchronous infer wrapper for AsyncInferQueue.
+
+        The C contiguous numpy arrays of the port types are used without a copy, so they must not
+        be modified until the request is completed.
+        """
+        if inputs is None:
+            inputs = {}
+        else:
+            # All the requests are of the same model, so their input types are mapped once
+            if "_input_types" not in self.__dict__:
+                self._input_types = get_input_types(self[0])
+            inputs = normalize_inputs(inputs, self._input_types, shared_memory=True)
         super().start_async(inputs, userdata)
 
 
@@ -9,9 +9,11 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -57,6 +59,21 @@ public:
         return _idle_handles.front();
     }
 
+    size_t pop_idle_request_id() {
+        // Takes the idle handle under the same lock it is waited for, so the concurrent
+        // start_async calls and callbacks can't race for it
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] {
+            return !(_idle_handles.empty());
+        });
+        if (_errors.size() > 0)
+            throw _errors.front();
+        auto handle = _idle_handles.front();
+        _idle_handles.pop();
+        return handle;
+    }
+
     void wait_all() {
         // Wait for all requests to return with callback thus updating
         // _idle_handles so it matches the size of requests
@@ -73,8 +90,11 @@ public:
         for (size_t handle = 0; handle < _requests.size(); handle++) {
             _requests[handle]._request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
-                // Add idle handle to queue
-                _idle_handles.push(handle);
+                {
+                    // Add idle handle to queue
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _idle_handles.push(handle);
+                }
                 // Notify locks in getIdleRequestId() or waitAll() functions
                 _cv.notify_one();
             });
@@ -82,29 +102,69 @@ public:
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        _callback = f_callback;
         for (size_t handle = 0; handle < _requests.size(); handle++) {
-            _requests[handle]._request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
+            _requests[handle]._request.set_callback([this, handle](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
-                try {
-                    if (exception_ptr) {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _finished_handles.push({handle, exception_ptr});
+                    // The thread which holds the GIL already runs the Python callbacks,
+                    // it runs this one too, so this thread returns to the inference at once
+                    if (_dispatching) {
+                        return;
+                    }
+                    _dispatching = true;
+                }
+                dispatch_callbacks();
+            });
+        }
+    }
+
+    void dispatch_callbacks() {
+        // Acquire GIL once for all the requests finished meanwhile
+        py::gil_scoped_acquire acquire;
+        while (true) {
+            std::queue<std::pair<size_t, std::exception_ptr>> finished_handles;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_finished_handles.empty()) {
+                    _dispatching = false;
+                    return;
+                }
+                std::swap(finished_handles, _finished_handles);
+            }
+            for (; !finished_handles.empty(); finished_handles.pop()) {
+                auto handle = finished_handles.front().first;
+                auto exception_ptr = finished_handles.front().second;
+                std::unique_ptr<py::error_already_set> error;
+                if (exception_ptr) {
+                    try {
                         std::rethrow_exception(exception_ptr);
+                    } catch (const std::exception& e) {
+                        PyErr_SetString(PyExc_RuntimeError, e.what());
+                        error.reset(new py::error_already_set());
+                    }
+                } else {
+                    // Execute Python function
+                    try {
+                        _callback(_requests[handle], _user_ids[handle]);
+                    } catch (py::error_already_set py_error) {
+                        assert(PyErr_Occurred());
+                        error.reset(new py::error_already_set(py_error));
                     }
-                } catch (const std::exception& e) {
-                    throw ov::Exception(e.what());
                 }
-                // Acquire GIL, execute Python function
-                py::gil_scoped_acquire acquire;
-                try {
-                    f_callback(_requests[handle], _user_ids[handle]);
-                } catch (py::error_already_set py_error) {
-                    assert(PyErr_Occurred());
-                    _errors.push(py_error);
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (error) {
+                        _errors.push(*error);
+                    }
+                    // Add idle handle to queue
+                    _idle_handles.push(handle);
                 }
-                // Add idle handle to queue
-                _idle_handles.push(handle);
                 // Notify locks in getIdleRequestId() or waitAll() functions
-                _cv.notify_one();
-            });
+                _cv.notify_all();
+            }
         }
     }
 
@@ -114,6 +174,10 @@ public:
     std::mutex _mutex;
     std::condition_variable _cv;
     std::queue<py::error_already_set> _errors;
+    py::function _callback;
+    // The handles of the requests finished while the Python callbacks were running
+    std::queue<std::pair<size_t, std::exception_ptr>> _finished_handles;
+    bool _dispatching = false;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -146,14 +210,13 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.def(
         "start_async",
         [](AsyncInferQueue& self, const py::dict inputs, py::object userdata) {
-            // getIdleRequestId function has an intention to block InferQueue
+            // pop_idle_request_id function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            self._idle_handles.pop();
+            auto handle = self.pop_idle_request_id();
             // Set new inputs label/id from user
             self._user_ids[handle] = userdata;
-            // Update inputs if there are any
-            Common::set_request_tensors(self._requests[handle]._request, inputs);
+            // Update inputs if there are any, the numpy arrays are shared and kept alive by the request
+            Common::set_request_tensors(self._requests[handle]._request, inputs, self._requests[handle]._shared_inputs);
             // Now GIL can be released - we are NOT working with Python objects in this block
             {
                 py::gil_scoped_release release;
@@ -173,6 +173,29 @@ void set_request_tensors(ov::runtime::InferRequest& request, const py::dict& inp
     }
 }
 
+void set_request_tensors(ov::runtime::InferRequest& request, const py::dict& inputs, py::dict& shared_inputs) {
+    for (auto&& input : inputs) {
+        ov::runtime::Tensor tensor;
+        if (py::isinstance<py::array>(input.second)) {
+            auto array = input.second.cast<py::array>();
+            bool is_contiguous = C_CONTIGUOUS == (array.flags() & C_CONTIGUOUS);
+            tensor = Common::tensor_from_numpy(array, is_contiguous);
+            if (is_contiguous) {
+                shared_inputs[input.first] = array;
+            }
+        } else {
+            tensor = Common::cast_to_tensor(input.second);
+        }
+        if (py::isinstance<py::str>(input.first)) {
+            request.set_tensor(input.first.cast<std::string>(), tensor);
+        } else if (py::isinstance<py::int_>(input.first)) {
+            request.set_input_tensor(input.first.cast<size_t>(), tensor);
+        } else {
+            throw py::type_error("Incompatible key type for tensor named: " + input.first.cast<std::string>());
+        }
+    }
+}
+
 PyAny from_ov_any(const ov::Any& any) {
     // Check for py::object
     if (any.is<py::object>()) {
@@ -315,10 +338,20 @@ uint32_t get_optimal_number_of_requests(const ov::runtime::CompiledModel& actual
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::runtime::InferRequest& request) {
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::runtime::InferRequest& request,
+                         bool shared_memory) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::runtime::Tensor t{request.get_tensor(out)};
+        if (shared_memory) {
+            res[py::cast(out)] = py::array(Common::ov_type_to_dtype().at(t.get_element_type()),
+                                           t.get_shape(),
+                                           t.get_strides(),
+                                           t.data(),
+                                           py::cast(t));
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
@@ -40,11 +40,19 @@ const Containers::TensorIndexMap cast_to_tensor_index_map(const py::dict& inputs
 
 void set_request_tensors(ov::runtime::InferRequest& request, const py::dict& inputs);
 
+// Sets the numpy arrays of the inputs without a copy if they are C contiguous, the arrays are kept in
+// shared_inputs by their keys, so they live while the request may read them
+void set_request_tensors(ov::runtime::InferRequest& request, const py::dict& inputs, py::dict& shared_inputs);
+
 PyAny from_ov_any(const ov::Any& any);
 
 uint32_t get_optimal_number_of_requests(const ov::runtime::CompiledModel& actual);
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::runtime::InferRequest& request);
+// With shared_memory the arrays are the views of the output tensors, which keep the memory alive, so they stay valid
+// after the request is destroyed, but the next inference of the request overwrites them
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::runtime::InferRequest& request,
+                         bool shared_memory = false);
 
 // Use only with classes that are not creatable by users on Python's side, because
 // Objects created in Python that are wrapped with such wrapper will cause memory leaks.
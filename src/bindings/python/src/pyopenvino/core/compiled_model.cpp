@@ -29,14 +29,15 @@ void regclass_CompiledModel(py::module m) {
 
     cls.def(
         "infer_new_request",
-        [](ov::runtime::CompiledModel& self, const py::dict& inputs) {
+        [](ov::runtime::CompiledModel& self, const py::dict& inputs, bool shared_memory) {
             auto request = self.create_infer_request();
             // Update inputs if there are any
             Common::set_request_tensors(request, inputs);
             request.infer();
-            return Common::outputs_to_dict(self.outputs(), request);
+            return Common::outputs_to_dict(self.outputs(), request, shared_memory);
         },
-        py::arg("inputs"));
+        py::arg("inputs"),
+        py::arg("shared_memory") = false);
 
     cls.def("export_model", &ov::runtime::CompiledModel::export_model, py::arg("model_stream"));
 
@@ -46,6 +46,26 @@ void regclass_InferRequest(py::module m) {
         },
         py::arg("outputs"));
 
+    cls.def(
+        "set_output_arrays",
+        [](InferRequestWrapper& self, const py::dict& outputs) {
+            for (auto&& output : outputs) {
+                auto array = output.second.cast<py::array>();
+                // The outputs are written to the array, so it must be C contiguous
+                auto tensor = Common::tensor_from_numpy(array, true);
+                if (py::isinstance<py::str>(output.first)) {
+                    self._request.set_tensor(output.first.cast<std::string>(), tensor);
+                } else if (py::isinstance<py::int_>(output.first)) {
+                    self._request.set_output_tensor(output.first.cast<size_t>(), tensor);
+                } else {
+                    throw py::type_error("Incompatible key type for tensor named: " +
+                                         output.first.cast<std::string>());
+                }
+                self._shared_outputs[output.first] = array;
+            }
+        },
+        py::arg("outputs"));
+
     cls.def(
         "set_input_tensors",
         [](InferRequestWrapper& self, const py::dict& inputs) {
@@ -58,22 +78,23 @@ void regclass_InferRequest(py::module m) {
 
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool shared_memory) {
             // Update inputs if there are any
             Common::set_request_tensors(self._request, inputs);
             // Call Infer function
             self._start_time = Time::now();
             self._request.infer();
             self._end_time = Time::now();
-            return Common::outputs_to_dict(self._outputs, self._request);
+            return Common::outputs_to_dict(self._outputs, self._request, shared_memory);
         },
-        py::arg("inputs"));
+        py::arg("inputs"),
+        py::arg("shared_memory") = false);
 
     cls.def(
         "start_async",
         [](InferRequestWrapper& self, const py::dict& inputs, py::object& userdata) {
-            // Update inputs if there are any
-            Common::set_request_tensors(self._request, inputs);
+            // Update inputs if there are any, the numpy arrays are shared and kept alive by the request
+            Common::set_request_tensors(self._request, inputs, self._shared_inputs);
             if (!userdata.is(py::none())) {
                 if (self.user_callback_defined) {
                     self.userdata = userdata;
@@ -271,4 +292,8 @@ void regclass_InferRequest(py::module m) {
     cls.def_property_readonly("results", [](InferRequestWrapper& self) {
         return Common::outputs_to_dict(self._outputs, self._request);
     });
+
+    cls.def_property_readonly("shared_results", [](InferRequestWrapper& self) {
+        return Common::outputs_to_dict(self._outputs, self._request, true);
+    });
 }
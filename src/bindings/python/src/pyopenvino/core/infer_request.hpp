@@ -43,6 +43,10 @@ public:
     ov::runtime::InferRequest _request;
     std::vector<ov::Output<const ov::Node>> _inputs;
     std::vector<ov::Output<const ov::Node>> _outputs;
+    // The numpy arrays the input tensors share the memory with, by the keys they were set with
+    py::dict _shared_inputs;
+    // The numpy arrays set as the output tensors, by the keys they were set with
+    py::dict _shared_outputs;
 
     Time::time_point _start_time;
     Time::time_point _end_time;
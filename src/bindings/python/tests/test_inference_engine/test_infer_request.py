@@ -261,6 +261,32 @@ def test_infer_queue_fail_on_py_func(device):
     assert "unsupported operand type(s) for +" in str(e.value)
 
 
+def test_infer_queue_shared_inputs(device):
+    jobs = 8
+    num_request = 4
+    core = Core()
+    func = core.read_model(test_net_xml, test_net_bin)
+    exec_net = core.compile_model(func, device)
+    infer_queue = AsyncInferQueue(exec_net, num_request)
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        results[job_id] = np.copy(request.get_output_tensor().data)
+
+    img = read_image()
+    # the arrays which are not C contiguous or of another type are converted
+    inputs = [img, np.asfortranarray(img), img.astype(np.float64)]
+    infer_queue.set_callback(callback)
+    for i in range(jobs):
+        infer_queue.start_async({"data": inputs[i % len(inputs)]}, i)
+    infer_queue.wait_all()
+
+    request = exec_net.create_infer_request()
+    expected = request.infer({0: img})
+    for result in results:
+        assert np.allclose(result, list(expected.values())[0])
+
+
 @pytest.mark.parametrize("data_type",
                          [np.float32,
                           np.int32,
@@ -327,6 +353,38 @@ def test_get_results(device):
     assert np.allclose(list(outputs.values()), list(request.results.values()))
 
 
+def test_shared_results(device):
+    core = Core()
+    func = core.read_model(test_net_xml, test_net_bin)
+    exec_net = core.compile_model(func, device)
+    img = read_image()
+    request = exec_net.create_infer_request()
+    outputs = request.infer({0: img})
+    shared_outputs = request.infer({0: img}, shared_memory=True)
+    output_tensor = request.get_output_tensor()
+    assert np.shares_memory(list(shared_outputs.values())[0], output_tensor.data)
+    assert np.shares_memory(list(request.shared_results.values())[0], output_tensor.data)
+    assert not np.shares_memory(list(request.results.values())[0], output_tensor.data)
+    assert np.allclose(list(outputs.values()), list(shared_outputs.values()))
+    new_outputs = exec_net.infer_new_request({0: img}, shared_memory=True)
+    assert np.allclose(list(outputs.values()), list(new_outputs.values()))
+
+
+def test_set_output_arrays(device):
+    core = Core()
+    func = core.read_model(test_net_xml, test_net_bin)
+    exec_net = core.compile_model(func, device)
+    img = read_image()
+    request = exec_net.create_infer_request()
+    outputs = request.infer({0: img})
+    output_tensor = request.get_output_tensor()
+    output = np.zeros_like(output_tensor.data)
+    request.set_output_arrays({0: output})
+    request.infer({0: img})
+    assert np.shares_memory(request.get_output_tensor().data, output)
+    assert np.allclose(list(outputs.values())[0], output)
+
+
 def test_results_async_infer(device):
     jobs = 8
     num_request = 4
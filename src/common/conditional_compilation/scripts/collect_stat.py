@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2018-2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+#     The main purpose of this script is collecting the statistics for the conditional compilation.
+# Every model is inferred once by the benchmark_app built with SELECTIVE_BUILD=COLLECT under
+# the IntelSEAPI collector, which produces the CSV files with the used OpenVINO parts
+# for the ccheader.py to build the minimal runtime of the deployment.
+#
+#     Usage: collect_stat.py [-h] --sea_runtool PATH --collector_dir PATH --benchmark_app PATH
+#                            --models PATH[ PATH...] [--device DEVICE] --out DIR
+#
+#     Mandatory arguments:
+#   --sea_runtool PATH    sea_runtool.py of the IntelSEAPI collector
+#   --collector_dir PATH  directory of the IntelSEAPI library
+#   --benchmark_app PATH  benchmark_app built with SELECTIVE_BUILD=COLLECT
+#   --models PATH[ PATH...]
+#                         models of the deployment
+#   --out DIR             directory of the collected CSV files
+#
+#     Optional arguments:
+#   --device DEVICE       device the models are inferred on, CPU by default
+
+import argparse, subprocess, sys
+from pathlib import Path
+
+
+def collect(sea_runtool, collector_dir, benchmark_app, model, device, out):
+    cmd = [sys.executable, str(sea_runtool),
+           '--output', str(out / Path(model).stem),
+           '--bindir', str(collector_dir),
+           '!', str(benchmark_app), '-m', str(model), '-d', device, '-niter', '1', '-nireq', '1']
+    print(' '.join(cmd))
+    return subprocess.run(cmd).returncode
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--sea_runtool', type=Path, required=True, metavar='PATH',
+                        help='sea_runtool.py of the IntelSEAPI collector')
+    parser.add_argument('--collector_dir', type=Path, required=True, metavar='PATH',
+                        help='directory of the IntelSEAPI library')
+    parser.add_argument('--benchmark_app', type=Path, required=True, metavar='PATH',
+                        help='benchmark_app built with SELECTIVE_BUILD=COLLECT')
+    parser.add_argument('--models', type=Path, nargs='+', required=True, metavar='PATH',
+                        help='models of the deployment')
+    parser.add_argument('--device', default='CPU', help='device the models are inferred on')
+    parser.add_argument('--out', type=Path, required=True, metavar='DIR',
+                        help='directory of the collected CSV files')
+    args = parser.parse_args()
+
+    args.out.mkdir(parents=True, exist_ok=True)
+    failed = [model for model in args.models
+              if collect(args.sea_runtool, args.collector_dir, args.benchmark_app, model, args.device, args.out)]
+    if failed:
+        sys.exit('The statistics are not collected for: ' + ', '.join(str(model) for model in failed))
+
+    print('The minimal runtime for the models is built with: '
+          '-DSELECTIVE_BUILD=ON -DSELECTIVE_BUILD_STAT={}'.format(args.out / '*.csv'))
+
+
+if __name__ == '__main__':
+    main()
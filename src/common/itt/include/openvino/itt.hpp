@@ -10,8 +10,10 @@
 #pragma once
 #include <openvino/function_name.hpp>
 #include <openvino/util/pp.hpp>
+#include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
 
 /** @ingroup ie_dev_profiling
   * @brief openvino namespace
@@ -34,6 +36,21 @@ namespace openvino
          */
         typedef struct handle_ {} *handle_t;
 
+        /**
+         * @struct TaskStats
+         * @ingroup ie_dev_profiling
+         * @brief The statistics of the task recorded by the built-in tracer, the times are in nanoseconds.
+         */
+        struct TaskStats
+        {
+            std::string domain;
+            std::string task;
+            uint64_t count = 0;
+            uint64_t total = 0;
+            uint64_t min = 0;
+            uint64_t max = 0;
+        };
+
 /**
  * @cond
  */
@@ -44,6 +61,12 @@ namespace openvino
             void taskBegin(domain_t d, handle_t t);
             void taskEnd(domain_t d);
             void threadName(const char* name);
+            uint64_t timestamp() noexcept;
+            void taskRecord(domain_t d, handle_t t, uint64_t beginTimestamp);
+            bool dumpTrace(const char* path);
+            bool enableTrace(bool enabled);
+            std::vector<TaskStats> taskStats();
+            bool dumpTaskStats(const char* path);
         }
 /**
  * @endcond
@@ -65,6 +88,84 @@ namespace openvino
             internal::threadName(name.c_str());
         }
 
+        /**
+         * @fn uint64_t timestamp()
+         * @ingroup ie_dev_profiling
+         * @brief Returns the time stamp of the built-in tracer, e.g. to record the task which has begun on other thread.
+         * @return The time stamp in nanoseconds, 0 if the tracer is not enabled
+         */
+        inline uint64_t timestamp() noexcept
+        {
+            return internal::timestamp();
+        }
+
+        /**
+         * @fn void taskRecord(domain_t d, handle_t t, uint64_t beginTimestamp)
+         * @ingroup ie_dev_profiling
+         * @brief Records the task which has begun at the given time and ends now to the built-in tracer,
+         * e.g. the time the task has waited in the queue.
+         * @param d [in] The domain of the task
+         * @param t [in] The annotation handle of the task
+         * @param beginTimestamp [in] The time stamp returned by timestamp() at the beginning of the task
+         */
+        inline void taskRecord(domain_t d, handle_t t, uint64_t beginTimestamp)
+        {
+            internal::taskRecord(d, t, beginTimestamp);
+        }
+
+        /**
+         * @fn bool dumpTrace(const char* path)
+         * @ingroup ie_dev_profiling
+         * @brief Writes the tasks recorded by the built-in tracer to the file in the Chrome tracing format, which is
+         * opened by chrome://tracing and Perfetto.
+         * @details The tracer is built with ENABLE_PROFILING_TRACE and enabled at runtime by the OPENVINO_TRACE_FILE
+         * environment variable, the trace is written to that file at exit and on SIGUSR1 as well. Every thread keeps
+         * its last OPENVINO_TRACE_BUFFER_SIZE (65536 by default) tasks. It is enabled by OPENVINO_TRACE_STATS_FILE
+         * as well, which gets the task statistics, or by enableTrace().
+         * @param path [in] The file path
+         * @return `false` if the tracer is not enabled or the file can't be written
+         */
+        inline bool dumpTrace(const char* path)
+        {
+            return internal::dumpTrace(path);
+        }
+
+        /**
+         * @fn bool enableTrace(bool enabled)
+         * @ingroup ie_dev_profiling
+         * @brief Starts or stops recording the tasks by the built-in tracer, e.g. to profile a part of the production
+         * run without the ITT collector. The tasks recorded before are kept.
+         * @param enabled [in] `true` to record the tasks
+         * @return `false` if the tracer is not built
+         */
+        inline bool enableTrace(bool enabled)
+        {
+            return internal::enableTrace(enabled);
+        }
+
+        /**
+         * @fn std::vector<TaskStats> taskStats()
+         * @ingroup ie_dev_profiling
+         * @brief Aggregates the tasks kept by the built-in tracer by the domains and the names.
+         * @return The statistics of the tasks sorted by the total time, empty if the tracer is not built
+         */
+        inline std::vector<TaskStats> taskStats()
+        {
+            return internal::taskStats();
+        }
+
+        /**
+         * @fn bool dumpTaskStats(const char* path)
+         * @ingroup ie_dev_profiling
+         * @brief Writes the statistics returned by taskStats() to the CSV file, the times are in microseconds.
+         * @param path [in] The file path
+         * @return `false` if the tracer is not built or the file can't be written
+         */
+        inline bool dumpTaskStats(const char* path)
+        {
+            return internal::dumpTaskStats(path);
+        }
+
         inline handle_t handle(char const *name)
         {
             return internal::handle(name);
@@ -9,10 +9,450 @@
 #include <ittnotify.h>
 #endif
 
+#ifdef ENABLE_PROFILING_TRACE
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <csignal>
+#include <thread>
+#include <unistd.h>
+#endif
+#endif
+
 namespace openvino {
 namespace itt {
 namespace internal {
 
+#ifdef ENABLE_PROFILING_TRACE
+
+namespace trace {
+
+/**
+ * @brief The built-in tracer, records the annotated tasks to the ring buffers of the threads.
+ * Recording doesn't allocate and doesn't lock: the buffer is allocated at the first recorded task of the thread, which
+ * is its only writer, and the readers skip the events overwritten while they are copied. The tracer is enabled at
+ * runtime, the disabled one only keeps the nesting of the tasks.
+ */
+class Tracer {
+public:
+    struct Event {
+        const void* task;
+        const void* domain;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    struct ThreadEvents {
+        ThreadEvents(uint32_t id, size_t capacity) : id{id}, capacity{capacity} {}
+
+        ~ThreadEvents() {
+            delete[] buffer.load();
+        }
+
+        void record(const Event& event) {
+            auto events = buffer.load(std::memory_order_relaxed);
+            if (events == nullptr) {
+                events = new Event[capacity];
+                buffer.store(events, std::memory_order_release);
+            }
+            const auto index = recorded.load(std::memory_order_relaxed);
+            events[index % capacity] = event;
+            recorded.store(index + 1, std::memory_order_release);
+        }
+
+        // copies the last recorded events, they may be written by the thread meanwhile
+        void read(std::vector<Event>& result) const {
+            result.clear();
+            const auto events = buffer.load(std::memory_order_acquire);
+            if (events == nullptr) {
+                return;
+            }
+            const auto last = recorded.load(std::memory_order_acquire);
+            auto first = last > capacity ? last - capacity : 0;
+            for (auto i = first; i < last; ++i) {
+                result.push_back(events[i % capacity]);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // the thread overwrites the oldest event when it records the next one
+            const auto written = recorded.load(std::memory_order_relaxed) + 1;
+            const auto overwritten = written > capacity ? written - capacity : 0;
+            if (overwritten > first) {
+                result.erase(result.begin(), result.begin() + std::min(overwritten - first, last - first));
+            }
+        }
+
+        const uint32_t id;
+        const size_t capacity;
+        std::atomic<Event*> buffer{nullptr};
+        std::atomic<uint64_t> recorded{0};
+        std::mutex mutex;
+        std::string name;
+        // the tasks of the thread which have begun, only the thread uses them
+        std::array<Event, 64> begun;
+        size_t depth = 0;
+    };
+
+    /**
+     * @brief Returns the tracer, it is enabled by the OPENVINO_TRACE_FILE and OPENVINO_TRACE_STATS_FILE environment
+     * variables or by enable()
+     */
+    static Tracer& get() noexcept {
+        // never destroyed, so the threads which are still running at exit can record the tasks
+        static Tracer* tracer = create();
+        return *tracer;
+    }
+
+    static uint64_t now() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    bool enabled() const noexcept {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void enable(bool enabled) noexcept {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    ThreadEvents& threadEvents() {
+        static thread_local ThreadEvents* events = nullptr;
+        if (events == nullptr) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _threads.emplace_back(new ThreadEvents{static_cast<uint32_t>(_threads.size()), _capacity});
+            events = _threads.back().get();
+        }
+        return *events;
+    }
+
+    const void* name(const void* handle, const char* name) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (handle == nullptr) {
+            // the tracer is built without ITT, so the interned name is the handle
+            handle = &*_interned.emplace(name).first;
+        }
+        _names.emplace(handle, name);
+        return handle;
+    }
+
+    bool dump(const char* path) {
+        std::ofstream file(path);
+        if (!file) {
+            return false;
+        }
+        std::unordered_map<const void*, std::string> names;
+        std::vector<ThreadEvents*> threads;
+        snapshot(names, threads);
+        auto nameOf = [&](const void* handle) -> std::string {
+            return escape(nameOrUnknown(names, handle));
+        };
+        file << "{\"traceEvents\":[";
+        const char* separator = "\n";
+        std::vector<Event> events;
+        for (auto&& thread : threads) {
+            std::string threadName;
+            {
+                std::lock_guard<std::mutex> lock(thread->mutex);
+                threadName = thread->name;
+            }
+            thread->read(events);
+            if (!threadName.empty()) {
+                file << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << _pid
+                     << ",\"tid\":" << thread->id << ",\"args\":{\"name\":\"" << escape(threadName) << "\"}}";
+                separator = ",\n";
+            }
+            for (auto&& event : events) {
+                file << separator << "{\"name\":\"" << nameOf(event.task) << "\",\"cat\":\"" << nameOf(event.domain)
+                     << "\",\"ph\":\"X\",\"pid\":" << _pid << ",\"tid\":" << thread->id
+                     << ",\"ts\":" << microseconds(event.begin) << ",\"dur\":" << microseconds(event.end - event.begin)
+                     << "}";
+                separator = ",\n";
+            }
+        }
+        file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return static_cast<bool>(file);
+    }
+
+    std::vector<TaskStats> stats() {
+        std::unordered_map<const void*, std::string> names;
+        std::vector<ThreadEvents*> threads;
+        snapshot(names, threads);
+        std::map<std::pair<const void*, const void*>, TaskStats> aggregated;
+        std::vector<Event> events;
+        for (auto&& thread : threads) {
+            thread->read(events);
+            for (auto&& event : events) {
+                const auto duration = event.end - event.begin;
+                auto inserted = aggregated.emplace(std::make_pair(event.domain, event.task), TaskStats{});
+                auto& stats = inserted.first->second;
+                if (inserted.second) {
+                    stats.domain = nameOrUnknown(names, event.domain);
+                    stats.task = nameOrUnknown(names, event.task);
+                    stats.min = duration;
+                }
+                ++stats.count;
+                stats.total += duration;
+                stats.min = std::min(stats.min, duration);
+                stats.max = std::max(stats.max, duration);
+            }
+        }
+        std::vector<TaskStats> result;
+        for (auto&& stats : aggregated) {
+            result.push_back(std::move(stats.second));
+        }
+        std::sort(result.begin(), result.end(), [](const TaskStats& lhs, const TaskStats& rhs) {
+            return lhs.total > rhs.total;
+        });
+        return result;
+    }
+
+    bool dumpStats(const char* path) {
+        std::ofstream file(path);
+        if (!file) {
+            return false;
+        }
+        file << "domain,task,count,total_us,average_us,min_us,max_us\n";
+        for (auto&& stats : this->stats()) {
+            file << csv(stats.domain) << ',' << csv(stats.task) << ',' << stats.count << ','
+                 << microseconds(stats.total) << ',' << microseconds(stats.total / stats.count) << ','
+                 << microseconds(stats.min) << ',' << microseconds(stats.max) << '\n';
+        }
+        return static_cast<bool>(file);
+    }
+
+private:
+    Tracer(std::string path, std::string statsPath, size_t capacity)
+        : _path{std::move(path)},
+          _statsPath{std::move(statsPath)},
+          _capacity{capacity} {
+#ifdef _WIN32
+        _pid = _getpid();
+#else
+        _pid = getpid();
+#endif
+        _enabled = !_path.empty() || !_statsPath.empty();
+    }
+
+    static Tracer* create() {
+        auto getenv = [](const char* name) {
+            const char* value = std::getenv(name);
+            return std::string{value ? value : ""};
+        };
+        size_t capacity = 1 << 16;
+        if (const char* size = std::getenv("OPENVINO_TRACE_BUFFER_SIZE")) {
+            capacity = std::max<size_t>(std::strtoul(size, nullptr, 10), 1);
+        }
+        auto tracer = new Tracer{getenv("OPENVINO_TRACE_FILE"), getenv("OPENVINO_TRACE_STATS_FILE"), capacity};
+        if (tracer->_enabled) {
+            std::atexit([] {
+                get().dumpFiles();
+            });
+#ifndef _WIN32
+            tracer->dumpOnSignal();
+#endif
+        }
+        return tracer;
+    }
+
+    void dumpFiles() {
+        if (!_path.empty()) {
+            dump(_path.c_str());
+        }
+        if (!_statsPath.empty()) {
+            dumpStats(_statsPath.c_str());
+        }
+    }
+
+#ifndef _WIN32
+    void dumpOnSignal() {
+        static int fds[2] = {-1, -1};
+        if (pipe(fds) != 0) {
+            return;
+        }
+        // the handler only wakes the thread up, since writing the file is not async-signal-safe
+        std::thread([] {
+            char signaled;
+            for (;;) {
+                auto result = read(fds[0], &signaled, 1);
+                if (result > 0) {
+                    get().dumpFiles();
+                } else if (result == 0 || errno != EINTR) {
+                    return;
+                }
+            }
+        }).detach();
+        struct sigaction action = {};
+        action.sa_handler = [](int) {
+            const char signaled = 1;
+            auto result = write(fds[1], &signaled, 1);
+            static_cast<void>(result);
+        };
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        sigaction(SIGUSR1, &action, nullptr);
+    }
+#endif
+
+    void snapshot(std::unordered_map<const void*, std::string>& names, std::vector<ThreadEvents*>& threads) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        names = _names;
+        for (auto&& thread : _threads) {
+            threads.push_back(thread.get());
+        }
+    }
+
+    static std::string nameOrUnknown(const std::unordered_map<const void*, std::string>& names, const void* handle) {
+        auto it = names.find(handle);
+        return it == names.end() ? std::string{"unknown"} : it->second;
+    }
+
+    static std::string microseconds(uint64_t nanoseconds) {
+        auto result = std::to_string(nanoseconds / 1000) + '.';
+        auto fraction = std::to_string(nanoseconds % 1000);
+        return result + std::string(3 - fraction.size(), '0') + fraction;
+    }
+
+    static std::string escape(const std::string& name) {
+        std::string result;
+        for (auto c : name) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+                result += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                result += ' ';
+            } else {
+                result += c;
+            }
+        }
+        return result;
+    }
+
+    static std::string csv(const std::string& name) {
+        if (name.find_first_of(",\"\n") == std::string::npos) {
+            return name;
+        }
+        std::string result = "\"";
+        for (auto c : name) {
+            if (c == '"') {
+                result += '"';
+            }
+            result += c;
+        }
+        return result + '"';
+    }
+
+    const std::string _path;
+    const std::string _statsPath;
+    const size_t _capacity;
+    int _pid = 0;
+    std::atomic<bool> _enabled{false};
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<ThreadEvents>> _threads;
+    std::unordered_set<std::string> _interned;
+    std::unordered_map<const void*, std::string> _names;
+};
+
+inline const void* name(const void* handle, const char* name) {
+    return Tracer::get().name(handle, name);
+}
+
+inline void begin(domain_t d, handle_t t) {
+    auto& tracer = Tracer::get();
+    auto& events = tracer.threadEvents();
+    if (events.depth < events.begun.size()) {
+        // the task which has begun while the tracer is disabled is not recorded
+        events.begun[events.depth] = {t, d, tracer.enabled() ? Tracer::now() : 0, 0};
+    }
+    ++events.depth;
+}
+
+inline void end() {
+    auto& tracer = Tracer::get();
+    auto& events = tracer.threadEvents();
+    if (events.depth == 0) {
+        return;
+    }
+    if (--events.depth < events.begun.size()) {
+        auto event = events.begun[events.depth];
+        if (event.begin != 0 && tracer.enabled()) {
+            event.end = Tracer::now();
+            events.record(event);
+        }
+    }
+}
+
+inline void threadName(const char* name) {
+    auto& events = Tracer::get().threadEvents();
+    std::lock_guard<std::mutex> lock(events.mutex);
+    events.name = name;
+}
+
+}  // namespace trace
+
+uint64_t timestamp() noexcept {
+    return trace::Tracer::get().enabled() ? trace::Tracer::now() : 0;
+}
+
+void taskRecord(domain_t d, handle_t t, uint64_t beginTimestamp) {
+    auto& tracer = trace::Tracer::get();
+    if (beginTimestamp != 0 && tracer.enabled()) {
+        tracer.threadEvents().record({t, d, beginTimestamp, trace::Tracer::now()});
+    }
+}
+
+bool dumpTrace(const char* path) {
+    return trace::Tracer::get().dump(path);
+}
+
+bool enableTrace(bool enabled) {
+    trace::Tracer::get().enable(enabled);
+    return true;
+}
+
+std::vector<TaskStats> taskStats() {
+    return trace::Tracer::get().stats();
+}
+
+bool dumpTaskStats(const char* path) {
+    return trace::Tracer::get().dumpStats(path);
+}
+
+#else
+
+namespace trace {
+inline const void* name(const void* handle, const char*) { return handle; }
+inline void begin(domain_t, handle_t) {}
+inline void end() {}
+inline void threadName(const char*) {}
+}  // namespace trace
+
+uint64_t timestamp() noexcept { return 0; }
+
+void taskRecord(domain_t, handle_t, uint64_t) {}
+
+bool dumpTrace(const char*) { return false; }
+
+bool enableTrace(bool) { return false; }
+
+std::vector<TaskStats> taskStats() { return {}; }
+
+bool dumpTaskStats(const char*) { return false; }
+
+#endif  // ENABLE_PROFILING_TRACE
+
 #ifdef ENABLE_PROFILING_ITT
 
 static size_t callStackDepth() {
@@ -24,14 +464,18 @@ static size_t callStackDepth() {
 static thread_local uint32_t call_stack_depth = 0;
 
 domain_t domain(char const* name) {
-    return reinterpret_cast<domain_t>(__itt_domain_create(name));
+    // without the collector ITT has no handles, so the ones of the tracer are used
+    auto d = trace::name(__itt_domain_create(name), name);
+    return reinterpret_cast<domain_t>(const_cast<void*>(d));
 }
 
 handle_t handle(char const* name) {
-    return reinterpret_cast<handle_t>(__itt_string_handle_create(name));
+    auto h = trace::name(__itt_string_handle_create(name), name);
+    return reinterpret_cast<handle_t>(const_cast<void*>(h));
 }
 
 void taskBegin(domain_t d, handle_t t) {
+    trace::begin(d, t);
     if (!callStackDepth() || call_stack_depth++ < callStackDepth())
         __itt_task_begin(reinterpret_cast<__itt_domain*>(d),
                         __itt_null,
@@ -40,25 +484,31 @@ void taskBegin(domain_t d, handle_t t) {
 }
 
 void taskEnd(domain_t d) {
+    trace::end();
     if (!callStackDepth() || --call_stack_depth < callStackDepth())
         __itt_task_end(reinterpret_cast<__itt_domain*>(d));
 }
 
 void threadName(const char* name) {
+    trace::threadName(name);
     __itt_thread_set_name(name);
 }
 
 #else
 
-domain_t domain(char const *) { return nullptr; }
+domain_t domain(char const* name) {
+    return reinterpret_cast<domain_t>(const_cast<void*>(trace::name(nullptr, name)));
+}
 
-handle_t handle(char const *) { return nullptr; }
+handle_t handle(char const* name) {
+    return reinterpret_cast<handle_t>(const_cast<void*>(trace::name(nullptr, name)));
+}
 
-void taskBegin(domain_t, handle_t) { }
+void taskBegin(domain_t d, handle_t t) { trace::begin(d, t); }
 
-void taskEnd(domain_t) { }
+void taskEnd(domain_t) { trace::end(); }
 
-void threadName(const char *) { }
+void threadName(const char* name) { trace::threadName(name); }
 
 #endif  // ENABLE_PROFILING_ITT
 
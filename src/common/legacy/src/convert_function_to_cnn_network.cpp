@@ -5,6 +5,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 #include <regex>
 #include <sstream>
@@ -1810,7 +1811,8 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
     // we collect this nodes and then throw an exception with the list
     // of dynamic nodes.
     std::stringstream err_log;
-    for (const auto & node : graph->get_ordered_ops()) {
+    const auto ordered_ops = graph->get_ordered_ops();
+    for (const auto & node : ordered_ops) {
         bool is_dynamic = false;
         for (const auto & input : node->inputs()) {
             if (input.get_partial_shape().is_dynamic()) {
@@ -1891,6 +1893,16 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
         unique_names[node->get_friendly_name()] = node;
     }
 
+    // The layers are found by their nodes while connecting them, not by names in the network
+    std::unordered_map<const ngraph::Node*, CNNLayerPtr> node_to_layer;
+    node_to_layer.reserve(nodes.size());
+    const auto find_layer = [&node_to_layer](const std::shared_ptr<ngraph::Node>& node) -> const CNNLayerPtr& {
+        const auto found = node_to_layer.find(node.get());
+        if (found == node_to_layer.end())
+            IE_THROW() << "Cannot find layer with name: " << node->get_friendly_name();
+        return found->second;
+    };
+
     // Create layers and output data
     for (const auto &layer : nodes) {
         if (isInternalLayer(layer, keep_constants)) continue;
@@ -2002,10 +2014,11 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
             }
         }
         cnnNetworkImpl->addLayer(cnnLayer);
+        node_to_layer.emplace(layer.get(), cnnLayer);
     }
 
     // Set input data
-    for (const auto &layer : graph->get_ordered_ops()) {
+    for (const auto &layer : ordered_ops) {
         if (std::dynamic_pointer_cast<::ngraph::op::ReadValueBase>(layer))
             continue;
         if (std::dynamic_pointer_cast<::ngraph::op::Result>(layer)) {
@@ -2027,15 +2040,8 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
                 }
             }
 
-            CNNLayerPtr prevCnnLayer;
-            StatusCode ret = cnnNetworkImpl->getLayerByName(input->get_friendly_name().c_str(), prevCnnLayer, nullptr);
-            if (ret != OK)
-                IE_THROW() << "Cannot find layer with name: " << input->get_friendly_name();
-
-            CNNLayerPtr cnnLayer;
-            ret = cnnNetworkImpl->getLayerByName(layer->get_friendly_name().c_str(), cnnLayer, nullptr);
-            if (ret != OK)
-                IE_THROW() << "Cannot find layer with name: " << layer->get_friendly_name();
+            const CNNLayerPtr& prevCnnLayer = find_layer(input);
+            const CNNLayerPtr& cnnLayer = find_layer(layer);
 
             auto inIndex = layer->input(i).get_index();
             if (cnnLayer->insData.size() <= (inIndex - count_of_skipped) ||
@@ -13,6 +13,7 @@ namespace pass {
 namespace low_precision {
 
 class LP_TRANSFORMATIONS_API AlignQuantizationIntervals;
+class DequantizationCache;
 
 }  // namespace low_precision
 }  // namespace pass
@@ -21,5 +22,10 @@ class LP_TRANSFORMATIONS_API AlignQuantizationIntervals;
 class ngraph::pass::low_precision::AlignQuantizationIntervals : public ngraph::pass::FunctionPass {
 public:
     NGRAPH_RTTI_DECLARATION;
+    // the cache is shared by the markup passes, which don't change the graph, a local one is used if it isn't set
+    explicit AlignQuantizationIntervals(const std::shared_ptr<DequantizationCache>& dequantizationCache = nullptr);
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+
+private:
+    std::shared_ptr<DequantizationCache> dequantizationCache;
 };
@@ -14,6 +14,7 @@ namespace pass {
 namespace low_precision {
 
 class LP_TRANSFORMATIONS_API AlignQuantizationParameters;
+class DequantizationCache;
 
 }  // namespace low_precision
 }  // namespace pass
@@ -22,5 +23,10 @@ class LP_TRANSFORMATIONS_API AlignQuantizationParameters;
 class ngraph::pass::low_precision::AlignQuantizationParameters : public ngraph::pass::FunctionPass {
 public:
     NGRAPH_RTTI_DECLARATION;
+    // the cache is shared by the markup passes, which don't change the graph, a local one is used if it isn't set
+    explicit AlignQuantizationParameters(const std::shared_ptr<DequantizationCache>& dequantizationCache = nullptr);
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+
+private:
+    std::shared_ptr<DequantizationCache> dequantizationCache;
 };
@@ -0,0 +1,45 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <utility>
+
+#include <ngraph/node.hpp>
+#include "low_precision/common/fake_quantize_dequantization.hpp"
+#include "low_precision/network_helper.hpp"
+
+namespace ngraph {
+namespace pass {
+namespace low_precision {
+
+// The dequantization operations found by NetworkHelper::getDequantization on the node inputs.
+// The cache is valid while the graph isn't changed, e.g. during the markup passes, which change the runtime info only.
+class DequantizationCache {
+public:
+    const FakeQuantizeDequantization& get(const std::shared_ptr<const Node>& node, const size_t parentIndex) {
+        const auto key = std::make_pair(node.get(), parentIndex);
+        auto it = dequantizations.find(key);
+        if (it == dequantizations.end()) {
+            it = dequantizations.emplace(key, NetworkHelper::getDequantization(node, parentIndex)).first;
+        }
+        return it->second;
+    }
+
+    static FakeQuantizeDequantization get(
+        const std::shared_ptr<DequantizationCache>& cache,
+        const std::shared_ptr<const Node>& node,
+        const size_t parentIndex) {
+        return cache == nullptr ? NetworkHelper::getDequantization(node, parentIndex) : cache->get(node, parentIndex);
+    }
+
+private:
+    std::map<std::pair<const Node*, size_t>, FakeQuantizeDequantization> dequantizations;
+};
+
+}  // namespace low_precision
+}  // namespace pass
+}  // namespace ngraph
@@ -14,6 +14,7 @@
 
 #include "low_precision/lpt_visibility.hpp"
 #include "low_precision/network_helper.hpp"
+#include "low_precision/common/dequantization_cache.hpp"
 #include "low_precision/lpt_itt.hpp"
 
 namespace ngraph {
@@ -30,7 +31,8 @@ class PropagateThroughPrecisionPreserved;
 template <typename AttributeType>
 class ngraph::pass::low_precision::PropagateThroughPrecisionPreserved : public ngraph::pass::MatcherPass {
 public:
-    PropagateThroughPrecisionPreserved() {
+    explicit PropagateThroughPrecisionPreserved(const std::shared_ptr<DequantizationCache>& dequantizationCache = nullptr)
+        : dequantizationCache(dequantizationCache) {
         ngraph::graph_rewrite_callback callback = [&](pattern::Matcher& m) {
             auto node = m.get_match_root();
             if (transformation_callback(node)) {
@@ -79,6 +81,8 @@ public:
     }
 
 private:
+    std::shared_ptr<DequantizationCache> dequantizationCache;
+
     ov::Any getSourceOutputAttribute(const Input<Node>& input) {
         auto input2 = input;
         auto output = input2.get_source_output();
@@ -93,8 +97,8 @@ private:
     std::vector<ov::Any> getParentInputRestrictions(
         const std::shared_ptr<ngraph::Node> node) {
         std::vector<ov::Any> parentAttributes;
-        auto getInput = [](const std::shared_ptr<ngraph::Node>& node, const size_t index) -> Input<Node> {
-            const auto dequantization = NetworkHelper::getDequantization(node, index);
+        auto getInput = [this](const std::shared_ptr<ngraph::Node>& node, const size_t index) -> Input<Node> {
+            const auto dequantization = DequantizationCache::get(dequantizationCache, node, index);
             if (!dequantization.empty() &&
                 ov::is_type<opset1::Convert>(dequantization.data.get_node()) &&
                 (dequantization.data.get_node()->get_input_size() == 1ul) &&
@@ -14,6 +14,7 @@
 #include <low_precision/lpt_visibility.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include "network_helper.hpp"
+#include "low_precision/common/dequantization_cache.hpp"
 
 namespace ngraph {
 namespace pass {
@@ -29,7 +30,8 @@ class PropagateToInput;
 template <typename AttributeType>
 class ngraph::pass::low_precision::PropagateToInput : public ngraph::pass::MatcherPass {
 public:
-    PropagateToInput() {
+    explicit PropagateToInput(const std::shared_ptr<DequantizationCache>& dequantizationCache = nullptr)
+        : dequantizationCache(dequantizationCache) {
         ngraph::graph_rewrite_callback callback = [&](pattern::Matcher& m) {
             auto node = m.get_match_root();
             if (transformation_callback(node)) {
@@ -68,10 +70,12 @@ public:
     }
 
 private:
+    std::shared_ptr<DequantizationCache> dequantizationCache;
+
     // TODO: possible duplicate: PropagateThroughPrecisionPreserved::getParentInputRestrictions
     ov::Any getSourceOutputAttribute(const Input<Node>& input) {
-        auto getInput = [](const Input<Node>& input) {
-            const auto dequantization = NetworkHelper::getDequantization(input.get_node()->shared_from_this(), input.get_index());
+        auto getInput = [this](const Input<Node>& input) {
+            const auto dequantization = DequantizationCache::get(dequantizationCache, input.get_node()->shared_from_this(), input.get_index());
             if (!dequantization.empty() &&
                 ov::is_type<opset1::Convert>(dequantization.data.get_node()) &&
                 (dequantization.data.get_node()->get_input_size() == 1ul) &&
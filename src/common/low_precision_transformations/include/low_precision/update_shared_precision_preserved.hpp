@@ -11,6 +11,7 @@
 #include <ngraph/variant.hpp>
 
 #include "low_precision/network_helper.hpp"
+#include "low_precision/common/dequantization_cache.hpp"
 #include "low_precision/lpt_itt.hpp"
 #include "low_precision/lpt_visibility.hpp"
 
@@ -28,7 +29,8 @@ class UpdateSharedPrecisionPreserved;
 template <typename AttributeType, typename ExpectedAttributeType = AttributeType>
 class ngraph::pass::low_precision::UpdateSharedPrecisionPreserved : public ngraph::pass::MatcherPass {
 public:
-    UpdateSharedPrecisionPreserved() {
+    explicit UpdateSharedPrecisionPreserved(const std::shared_ptr<DequantizationCache>& dequantizationCache = nullptr)
+        : dequantizationCache(dequantizationCache) {
         ngraph::graph_rewrite_callback callback = [&](pattern::Matcher& m) {
             auto node = m.get_match_root();
 
@@ -81,8 +83,10 @@ public:
     }
 
 private:
+    std::shared_ptr<DequantizationCache> dequantizationCache;
+
     Input<Node> getDequantizationInput(const Input<Node>& input) {
-        const auto dequantization = NetworkHelper::getDequantization(input.get_node()->shared_from_this(), input.get_index());
+        const auto dequantization = DequantizationCache::get(dequantizationCache, input.get_node()->shared_from_this(), input.get_index());
         if (!dequantization.empty() &&
             (ov::is_type<opset1::Convert>(dequantization.data.get_node())) &&
             ov::is_type<opset1::FakeQuantize>(dequantization.data.get_node()->get_input_node_ptr(0))) {
@@ -8,18 +8,23 @@
 #include "low_precision/create_attribute.hpp"
 #include "low_precision/propagate_through_precision_preserved.hpp"
 #include "low_precision/rt_info/intervals_alignment_attribute.hpp"
+#include "low_precision/common/dequantization_cache.hpp"
 
 using namespace ngraph;
 using namespace ngraph::pass::low_precision;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::low_precision::AlignQuantizationIntervals, "AlignQuantizationIntervals", 0);
 
+ngraph::pass::low_precision::AlignQuantizationIntervals::AlignQuantizationIntervals(const std::shared_ptr<DequantizationCache>& dequantizationCache) :
+    dequantizationCache(dequantizationCache) {}
+
 bool ngraph::pass::low_precision::AlignQuantizationIntervals::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
+    const auto cache = dequantizationCache == nullptr ? std::make_shared<DequantizationCache>() : dequantizationCache;
     std::shared_ptr<ngraph::pass::GraphRewrite> intervalsAlignment = manager.register_pass<ngraph::pass::GraphRewrite>();
     intervalsAlignment->add_matcher<low_precision::CreateAttribute<IntervalsAlignmentAttribute, opset1::FakeQuantize>>();
-    intervalsAlignment->add_matcher<low_precision::PropagateThroughPrecisionPreserved<IntervalsAlignmentAttribute>>();
+    intervalsAlignment->add_matcher<low_precision::PropagateThroughPrecisionPreserved<IntervalsAlignmentAttribute>>(cache);
     manager.run_passes(f);
     return false;
 }
@@ -9,19 +9,24 @@
 #include "low_precision/rt_info/quantization_alignment_attribute.hpp"
 #include "low_precision/rt_info/per_tensor_quantization_attribute.hpp"
 #include "low_precision/update_shared_precision_preserved.hpp"
+#include "low_precision/common/dequantization_cache.hpp"
 
 using namespace ngraph;
 using namespace ngraph::pass::low_precision;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::low_precision::AlignQuantizationParameters, "AlignQuantizationParameters", 0);
 
+ngraph::pass::low_precision::AlignQuantizationParameters::AlignQuantizationParameters(const std::shared_ptr<DequantizationCache>& dequantizationCache) :
+    dequantizationCache(dequantizationCache) {}
+
 bool ngraph::pass::low_precision::AlignQuantizationParameters::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
+    const auto cache = dequantizationCache == nullptr ? std::make_shared<DequantizationCache>() : dequantizationCache;
     std::shared_ptr<ngraph::pass::GraphRewrite> propagation = manager.register_pass<ngraph::pass::GraphRewrite>();
     propagation->add_matcher<low_precision::CreateAttribute<QuantizationAlignmentAttribute>>();
-    propagation->add_matcher<low_precision::PropagateThroughPrecisionPreserved<QuantizationAlignmentAttribute>>();
-    propagation->add_matcher<low_precision::UpdateSharedPrecisionPreserved<QuantizationAlignmentAttribute, PerTensorQuantizationAttribute>>();
+    propagation->add_matcher<low_precision::PropagateThroughPrecisionPreserved<QuantizationAlignmentAttribute>>(cache);
+    propagation->add_matcher<low_precision::UpdateSharedPrecisionPreserved<QuantizationAlignmentAttribute, PerTensorQuantizationAttribute>>(cache);
     manager.run_passes(f);
     return false;
 }
@@ -24,6 +24,7 @@
 #include "low_precision/markup_avg_pool_precision_preserved.hpp"
 #include "low_precision/propagate_precisions.hpp"
 #include "low_precision/align_quantization_parameters.hpp"
+#include "low_precision/common/dequantization_cache.hpp"
 
 #include "transformations/common_optimizations/lin_op_sequence_fusion.hpp"
 #include "low_precision/fold_convert.hpp"
@@ -177,13 +178,15 @@ bool ngraph::pass::low_precision::MarkupOptimizations::run_on_model(const std::s
     if (!quantizationRestrictions.empty()) {
         markup.register_pass<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
     }
+    // the markup passes change the runtime info only, so the dequantization operations are looked up once for them all
+    const auto dequantizationCache = std::make_shared<DequantizationCache>();
     if (ngraph::op::util::has_op_with_type<ngraph::opset1::AvgPool>(f)) {
-        markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>();
+        markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>(dequantizationCache);
     }
-    markup.register_pass<low_precision::PropagatePrecisions>();
+    markup.register_pass<low_precision::PropagatePrecisions>(dequantizationCache);
     if (ngraph::op::util::has_op_with_type<ngraph::opset1::Concat>(f)) {
-        markup.register_pass<low_precision::AlignQuantizationIntervals>();
-        markup.register_pass<low_precision::AlignQuantizationParameters>();
+        markup.register_pass<low_precision::AlignQuantizationIntervals>(dequantizationCache);
+        markup.register_pass<low_precision::AlignQuantizationParameters>(dequantizationCache);
     }
     markup.run_passes(f);
     return false;
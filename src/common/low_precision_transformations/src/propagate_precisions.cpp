@@ -11,19 +11,24 @@
 #include "low_precision/rt_info/precisions_attribute.hpp"
 #include "low_precision/propagate_through_precision_preserved.hpp"
 #include "low_precision/propagate_to_input.hpp"
+#include "low_precision/common/dequantization_cache.hpp"
 
 using namespace ngraph;
 using namespace ngraph::pass::low_precision;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::low_precision::PropagatePrecisions, "PropagatePrecisions", 0);
 
+ngraph::pass::low_precision::PropagatePrecisions::PropagatePrecisions(const std::shared_ptr<DequantizationCache>& dequantizationCache) :
+    dequantizationCache(dequantizationCache) {}
+
 bool ngraph::pass::low_precision::PropagatePrecisions::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
+    const auto cache = dequantizationCache == nullptr ? std::make_shared<DequantizationCache>() : dequantizationCache;
     std::shared_ptr<ngraph::pass::GraphRewrite> precisionsPropagation = manager.register_pass<ngraph::pass::GraphRewrite>();
     precisionsPropagation->add_matcher<low_precision::CreateAttribute<PrecisionsAttribute, opset1::FakeQuantize>>(AttributeSource::OutputPort);
-    precisionsPropagation->add_matcher<low_precision::PropagateThroughPrecisionPreserved<PrecisionsAttribute>>();
-    precisionsPropagation->add_matcher<low_precision::PropagateToInput<PrecisionsAttribute>>();
+    precisionsPropagation->add_matcher<low_precision::PropagateThroughPrecisionPreserved<PrecisionsAttribute>>(cache);
+    precisionsPropagation->add_matcher<low_precision::PropagateToInput<PrecisionsAttribute>>(cache);
     manager.run_passes(f);
     return false;
 }
@@ -5,6 +5,8 @@
 #include "pruning.hpp"
 #include "mask_attribute.hpp"
 
+#include <algorithm>
+
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/opsets/opset5.hpp>
@@ -22,6 +24,7 @@ class GroupConvolution;
 class GroupConvolutionReshape;
 class Elementwise;
 class PassThrough;
+class Reshape;
 class StopPropagation;
 class FakeQuantize;
 class Concat;
@@ -137,7 +140,7 @@ public:
             auto weights_mask = getMask(m_weights);
             if (!weights_mask) {
                 // Setting mask only if weights are constant
-                if (ngraph::is_type<opset6::Constant>(m_output.get_node_shared_ptr())) {
+                if (ngraph::is_type<opset6::Constant>(m_weights.get_node_shared_ptr())) {
                     weights_mask = std::make_shared<Mask>(weights_shape.size());
                     setMask(m_weights, weights_mask);
                 } else {
@@ -582,6 +585,89 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::Reshape : public MatcherPass {
+public:
+    Reshape() {
+        auto reshape = pattern::wrap_type<opset6::Reshape, opset6::Squeeze, opset6::Unsqueeze>(pattern::has_static_shape());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_output = pattern_map.at(reshape);
+            const auto & m_input = m_output.get_node_shared_ptr()->input_value(0);
+
+            // Reshapes on Group Convolution weights are handled by GroupConvolutionReshape
+            for (const auto & consumer : m_output.get_target_inputs()) {
+                if (ngraph::is_type<opset6::GroupConvolution>(consumer.get_node()) && consumer.get_index() == 1) {
+                    return false;
+                }
+            }
+
+            auto input_mask = getMask(m_input);
+            if (!input_mask || m_input.get_partial_shape().is_dynamic()) {
+                return false;
+            }
+
+            // Only Reshapes keeping the batch (0) and channel (1) dims are supported, as the channels are
+            // the only dims the masks prune. Example: [N, C, H, W] -> [N, C, H * W] or [N, C, 1, 1] -> [N, C].
+            const auto & inp_shape = m_input.get_shape();
+            const auto & out_shape = m_output.get_shape();
+            if (inp_shape.size() < 2 || out_shape.size() < 2 ||
+                inp_shape[0] != out_shape[0] || inp_shape[1] != out_shape[1]) {
+                return false;
+            }
+
+            // To allow pruning of the channels the channel value in the Reshape Shape constant
+            // is replaced by 0 (copy from input) or -1.
+            if (auto reshape_ptr = std::dynamic_pointer_cast<opset6::Reshape>(m_output.get_node_shared_ptr())) {
+                auto old_shape_const = std::dynamic_pointer_cast<opset6::Constant>(reshape_ptr->get_input_node_shared_ptr(1));
+                if (!old_shape_const) {
+                    return false;
+                }
+                auto shape_value = old_shape_const->cast_vector<int64_t>();
+                const bool special_zero = reshape_ptr->get_special_zero();
+                if (shape_value[1] != -1 && !(special_zero && shape_value[1] == 0)) {
+                    if (special_zero) {
+                        shape_value[1] = 0;
+                    } else if (std::find(shape_value.begin(), shape_value.end(), -1) == shape_value.end()) {
+                        shape_value[1] = -1;
+                    } else {
+                        return false;
+                    }
+                    auto new_const = opset6::Constant::create(old_shape_const->get_element_type(),
+                                                              old_shape_const->get_shape(), shape_value);
+                    new_const->set_friendly_name(old_shape_const->get_friendly_name());
+                    ngraph::copy_runtime_info(old_shape_const, new_const);
+                    reshape_ptr->input(1).replace_source_output(new_const);
+                }
+            }
+
+            auto input_mask_row = input_mask.get();
+            auto output_mask = std::make_shared<Mask>(out_shape.size());
+            auto output_mask_row = output_mask.get();
+
+            // Propagating mask from channel (1) dim in Reshape input to channel (1) dim in Reshape output and back
+            input_mask->add_callback([output_mask_row](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(1) = output_mask_row->at(1);
+                return true;
+            }, output_mask);
+            output_mask->add_callback([input_mask_row](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(1) = input_mask_row->at(1);
+                return true;
+            }, input_mask);
+
+            if (!output_mask->apply_callback(input_mask)) {
+                return false;
+            }
+
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(reshape, "ReshapeChannelsMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
 class ngraph::pass::mask_propagation::StopPropagation : public MatcherPass {
 public:
     StopPropagation() {
@@ -610,6 +696,7 @@ ngraph::pass::PropagateMasks::PropagateMasks() {
     add_matcher<mask_propagation::GroupConvolution>();
     add_matcher<mask_propagation::Elementwise>();
     add_matcher<mask_propagation::PassThrough>();
+    add_matcher<mask_propagation::Reshape>();
     add_matcher<mask_propagation::FakeQuantize>();
     add_matcher<mask_propagation::Concat>();
     add_matcher<mask_propagation::StopPropagation>();
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 
 #include "pruning.hpp"
@@ -15,9 +16,61 @@
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ShrinkWeights, "ShrinkWeights", 0);
 
+#ifdef ENABLE_OPENVINO_DEBUG
+// Returns the number of FLOPs (2 per multiply-accumulate) of the Convolution/GroupConvolution or 0 for other nodes
+static int64_t get_conv_flops(const std::shared_ptr<ngraph::Node> & node) {
+    if (!ngraph::is_type<ngraph::opset6::Convolution>(node) && !ngraph::is_type<ngraph::opset6::GroupConvolution>(node)) {
+        return 0;
+    }
+    const auto & weights_shape = node->get_input_partial_shape(1);
+    const auto & output_shape = node->get_output_partial_shape(0);
+    if (weights_shape.is_dynamic() || output_shape.is_dynamic()) {
+        return 0;
+    }
+    // every output element accumulates the weights of one output channel:
+    // [O, I, X, Y] for Convolution and [G, O, I, X, Y] for GroupConvolution
+    const auto & weights = weights_shape.get_shape();
+    const auto out_channels_count = ngraph::is_type<ngraph::opset6::GroupConvolution>(node) ? weights[0] * weights[1] : weights[0];
+    return 2 * static_cast<int64_t>(ngraph::shape_size(output_shape.get_shape()) * ngraph::shape_size(weights) / out_channels_count);
+}
+
+// Returns the FLOPs of the output channels of the Convolution which filters are all zeros,
+// i.e. the reduction the pruning could achieve if every zero filter of the Convolution was removed
+static int64_t get_zero_filters_flops(const std::shared_ptr<ngraph::Node> & node) {
+    if (!ngraph::is_type<ngraph::opset6::Convolution>(node)) {
+        return 0;
+    }
+    const auto flops = get_conv_flops(node);
+    auto weights = ngraph::get_constant_from_source(node->input_value(1));
+    if (!flops || !weights) {
+        return 0;
+    }
+    const auto values = weights->cast_vector<double>();
+    const auto out_channels_count = weights->get_shape()[0];
+    const auto filter_size = values.size() / out_channels_count;
+    int64_t zero_filters_count{0};
+    for (size_t out_channel = 0; out_channel < out_channels_count; ++out_channel) {
+        const auto filter_begin = values.begin() + out_channel * filter_size;
+        if (std::all_of(filter_begin, filter_begin + filter_size, [](const double & value) { return value == 0; })) {
+            zero_filters_count++;
+        }
+    }
+    return flops * zero_filters_count / static_cast<int64_t>(out_channels_count);
+}
+#endif
+
+
 bool ngraph::pass::ShrinkWeights::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
     int64_t reduced_weights_count{0};
     int64_t total_weights_count{0};
+#ifdef ENABLE_OPENVINO_DEBUG
+    int64_t total_flops_count{0};
+    int64_t zero_filters_flops_count{0};
+    for (const auto & node : f->get_ordered_ops()) {
+        total_flops_count += get_conv_flops(node);
+        zero_filters_flops_count += get_zero_filters_flops(node);
+    }
+#endif
     for (const auto & node : f->get_ordered_ops()) {
         // calculate shape for every node in graph as the input shape may change
         // during Constant shrinking
@@ -91,5 +144,18 @@ bool ngraph::pass::ShrinkWeights::run_on_model(const std::shared_ptr<ngraph::Fun
     }
     NGRAPH_DEBUG << "[ INFO ]   TOTAL WEIGHTS: " << total_weights_count << std::endl;
     NGRAPH_DEBUG << "[ INFO ] REDUCED WEIGHTS: " << reduced_weights_count << std::endl;
+#ifdef ENABLE_OPENVINO_DEBUG
+    // The achievable reduction counts the zero filters of the Convolutions only, while the achieved one also includes
+    // the input channels of the consumers, so an achieved reduction lower than the achievable one means that
+    // the masks of some zero filters were invalidated during the propagation.
+    int64_t pruned_flops_count{total_flops_count};
+    for (const auto & node : f->get_ordered_ops()) {
+        node->validate_and_infer_types();
+        pruned_flops_count -= get_conv_flops(node);
+    }
+    NGRAPH_DEBUG << "[ INFO ]          TOTAL FLOPS: " << total_flops_count << std::endl;
+    NGRAPH_DEBUG << "[ INFO ] ACHIEVABLE FLOPS REDUCTION: " << zero_filters_flops_count << std::endl;
+    NGRAPH_DEBUG << "[ INFO ]   ACHIEVED FLOPS REDUCTION: " << pruned_flops_count << std::endl;
+#endif
     return true;
 }
@@ -619,6 +619,12 @@ template void nv12ToRgbRowImpl(neon_tag, const uint8_t** y_rows, const uint8_t*
 template void i420ToRgbRowImpl(neon_tag, const uint8_t** y_rows, const uint8_t* u_row,
                                const uint8_t* v_row, uint8_t** out_rows, const int buf_width);
 
+template void nv12ToRgbPlanesRowImpl(neon_tag, const uint8_t** y_rows, const uint8_t* uv_row,
+                                     uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width);
+
+template void i420ToRgbPlanesRowImpl(neon_tag, const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row,
+                                     uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width);
+
 template void splitRowImpl<neon_tag, uint8_t, 2>(neon_tag, const uint8_t* in, std::array<uint8_t*, 2>& outs, const int length);
 template void splitRowImpl<neon_tag, float, 2>(neon_tag, const float* in, std::array<float*, 2>& outs, const int length);
 template void splitRowImpl<neon_tag, uint8_t, 3>(neon_tag, const uint8_t* in, std::array<uint8_t*, 3>& outs, const int length);
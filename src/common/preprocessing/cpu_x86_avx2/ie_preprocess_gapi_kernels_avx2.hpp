@@ -52,6 +52,14 @@ template<typename isa_tag_t>
 void i420ToRgbRowImpl(isa_tag_t, const uint8_t** y_rows, const uint8_t* u_row,
                       const uint8_t* v_row, uint8_t** out_rows, const int buf_width);
 
+template<typename isa_tag_t>
+void nv12ToRgbPlanesRowImpl(isa_tag_t, const uint8_t** y_rows, const uint8_t* uv_row,
+                            uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width);
+
+template<typename isa_tag_t>
+void i420ToRgbPlanesRowImpl(isa_tag_t, const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row,
+                            uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width);
+
 template<typename isa_tag_t, typename T, int chs>
 void splitRowImpl(isa_tag_t, const T* in, std::array<T*, chs>& outs, const int length);
 
@@ -1264,6 +1264,12 @@ template void nv12ToRgbRowImpl(sse42_tag, const uint8_t** y_rows, const uint8_t*
 template void i420ToRgbRowImpl(sse42_tag, const uint8_t** y_rows, const uint8_t* u_row,
                                const uint8_t* v_row, uint8_t** out_rows, const int buf_width);
 
+template void nv12ToRgbPlanesRowImpl(sse42_tag, const uint8_t** y_rows, const uint8_t* uv_row,
+                                     uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width);
+
+template void i420ToRgbPlanesRowImpl(sse42_tag, const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row,
+                                     uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width);
+
 template void splitRowImpl<sse42_tag, uchar, 2>(sse42_tag, const uint8_t* in, std::array<uint8_t*, 2>& outs, const int length);
 template void splitRowImpl<sse42_tag, float, 2>(sse42_tag, const float* in, std::array<float*, 2>& outs, const int length);
 template void splitRowImpl<sse42_tag, uchar, 3>(sse42_tag, const uint8_t* in, std::array<uint8_t*, 3>& outs, const int length);
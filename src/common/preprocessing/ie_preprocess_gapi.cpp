@@ -5,6 +5,8 @@
 #include <utility>
 #include <vector>
 #include <algorithm>
+#include <list>
+#include <mutex>
 #include <cstdlib>
 #include <tuple>
 #include <string>
@@ -456,8 +458,7 @@ class PlanarColorConversions {
                                            Layout,
                                            ResizeAlgorithm) {
         // in_layout is always NCHW
-        auto interleaved_rgb = gapi::NV12toRGB::on(inputs[0], inputs[1]);
-        return split({interleaved_rgb}, 3);
+        return to_vec(gapi::NV12toRGBp::on(inputs[0], inputs[1]));
     }
 
     static std::vector<cv::GMat> NV12toBGR(const std::vector<cv::GMat>& inputs,
@@ -474,8 +475,7 @@ class PlanarColorConversions {
                                            Layout,
                                            ResizeAlgorithm) {
         // in_layout is always NCHW
-        auto interleaved_rgb = gapi::I420toRGB::on(inputs[0], inputs[1], inputs[2]);
-        return split({interleaved_rgb}, 3);
+        return to_vec(gapi::I420toRGBp::on(inputs[0], inputs[1], inputs[2]));
     }
 
     static std::vector<cv::GMat> I420toBGR(const std::vector<cv::GMat>& inputs,
@@ -686,7 +686,64 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+struct PreprocEngine::CompiledGraphs {
+    CompiledGraphs(cv::GComputation computation, size_t slices)
+        : computation(std::move(computation)), compiled(slices), rois(slices) {}
+
+    cv::GComputation computation;
+    std::vector<cv::GCompiled> compiled;
+    // the output ROI each object is compiled for
+    std::vector<cv::gapi::own::Rect> rois;
+};
+
+namespace {
+// The compiled graphs of every descriptor take a few kilobytes per thread slice
+constexpr size_t compiledGraphsCacheCapacity = 32;
+
+template <typename CallDesc, typename Graphs>
+struct CompiledGraphsCache {
+    std::mutex mutex;
+    // the most recently used graphs come first, the same call may be cached several times for the concurrent requests
+    std::list<std::pair<CallDesc, std::shared_ptr<Graphs>>> entries;
+};
+
+template <typename CallDesc, typename Graphs>
+CompiledGraphsCache<CallDesc, Graphs>& compiledGraphsCache() {
+    // never destroyed, since the engines return their graphs when they are destroyed, which may happen at exit
+    static auto cache = new CompiledGraphsCache<CallDesc, Graphs>;
+    return *cache;
+}
+}  // anonymous namespace
+
+std::shared_ptr<PreprocEngine::CompiledGraphs> PreprocEngine::takeCachedGraphs(const CallDesc &call) {
+    auto& cache = compiledGraphsCache<CallDesc, CompiledGraphs>();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    for (auto it = cache.entries.begin(); it != cache.entries.end(); ++it) {
+        if (it->first == call) {
+            auto graphs = std::move(it->second);
+            cache.entries.erase(it);
+            return graphs;
+        }
+    }
+    return nullptr;
+}
+
+void PreprocEngine::cacheGraphs(const CallDesc &call, std::shared_ptr<CompiledGraphs> graphs) {
+    auto& cache = compiledGraphsCache<CallDesc, CompiledGraphs>();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.emplace_front(call, std::move(graphs));
+    if (cache.entries.size() > compiledGraphsCacheCapacity) {
+        cache.entries.pop_back();
+    }
+}
+
+PreprocEngine::PreprocEngine() = default;
+
+PreprocEngine::~PreprocEngine() {
+    if (_lastCall && _lastComp) {
+        cacheGraphs(*_lastCall, std::move(_lastComp));
+    }
+}
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -815,7 +872,7 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+void PreprocEngine::executeGraph(CompiledGraphs& graphs,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
@@ -824,31 +881,39 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 #if IE_THREAD == IE_THREAD_OMP
         omp_serial ? 1 :    // disable threading for OpenMP if was asked for
 #endif
-        0;                  // use all available threads
+        parallel_get_max_threads();  // use all available threads, e.g. the ones of the stream of the request
 
     // to suppress unused warnings
     (void)(omp_serial);
 
+    // the graphs may be compiled by the engine of a request which has less threads
+    if (graphs.compiled.size() < static_cast<size_t>(thread_num)) {
+        graphs.compiled.resize(thread_num);
+        graphs.rois.resize(thread_num);
+    }
+
     // Split the whole graph into `total_slices` slices, where
     // `total_slices` is provided by the parallel runtime and assumed
     // to be number of threads used.  However it is not guaranteed
     // that an actual number of threads will be as assumed, so it
     // possible that all slices are processed by the same thread.
     //
+    // If there are enough batch items, the slices process the whole items, otherwise every slice processes
+    // its rows of each item.
+    //
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+        using cv::gapi::own::Rect;
 
-            using cv::gapi::own::Rect;
+        // current design implies all images in batch are equal
+        const auto& input_plane_mats = batched_input_plane_mats[0];
+        const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            // current design implies all images in batch are equal
-            const auto& input_plane_mats = batched_input_plane_mats[0];
-            const auto& output_plane_mats = batched_output_plane_mats[0];
+        const bool split_batch = batch_size > 1 && batch_size >= total_slices;
 
+        Rect roi{0, 0, output_plane_mats[0].cols, output_plane_mats[0].rows};
+        if (!split_batch) {
             auto lines_per_thread = output_plane_mats[0].rows / total_slices;
             const auto remainder = output_plane_mats[0].rows % total_slices;
 
@@ -866,22 +931,30 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 
             if (lines_per_thread <= 0) return;  // no job for current thread
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
+            roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
+        }
+
+        auto& compiled = graphs.compiled[slice_n];
+        if (!compiled || Update::RESHAPE == update || !(graphs.rois[slice_n] == roi)) {
+            //  need to compile (or reshape) own object for a particular ROI
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
             // TODO: make a ROI a runtime argument to avoid
             // recompilations
             auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
-                compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
+            if (!compiled) {
+                compiled = graphs.computation.compile(descrs_of(input_plane_mats), std::move(args));
             } else {
-                IE_ASSERT(compiled);
                 compiled.reshape(descrs_of(input_plane_mats), std::move(args));
             }
+            graphs.rois[slice_n] = roi;
         }
 
-        for (int i = 0; i < batch_size; ++i) {
+        const int first = split_batch ? slice_n : 0;
+        const int step = split_batch ? total_slices : 1;
+        for (int i = first; i < batch_size; i += step) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
 
@@ -948,32 +1021,41 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         IE_THROW()  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
+    Update update = needUpdate(thisCall);
 
-    Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
+        if (auto cached = takeCachedGraphs(thisCall)) {
+            // the graphs compiled for exactly this call are ready to use
+            if (_lastComp) {
+                cacheGraphs(*_lastCall, std::move(_lastComp));
+            }
+            _lastComp = std::move(cached);
+            update = Update::NOTHING;
+        } else if (Update::REBUILD == update) {
             //  rebuild the graph
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+            if (_lastComp) {
+                cacheGraphs(*_lastCall, std::move(_lastComp));
+            }
             // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
             auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(custom_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt));
+            _lastComp = std::make_shared<CompiledGraphs>(buildGraph(custom_desc,
+                                                                    out_desc,
+                                                                    in_layout,
+                                                                    out_layout,
+                                                                    algorithm,
+                                                                    in_fmt,
+                                                                    out_fmt),
+                                                         parallel_get_max_threads());
         }
+        // on RESHAPE the graphs of the last call are reshaped for this one
+        _lastCall = cv::util::make_optional(std::move(thisCall));
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+    executeGraph(*_lastComp, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 }
 
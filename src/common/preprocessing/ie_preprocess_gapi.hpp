@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -25,8 +26,13 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
+    // The computation compiled for the call and its objects compiled per thread slice. Only one engine uses them at a
+    // time: the engines which are not using them return them to the cache shared by all engines, so the engines of
+    // the other infer requests and the calls which alternate between the descriptors don't compile the graphs again
+    struct CompiledGraphs;
+
     Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    std::shared_ptr<CompiledGraphs> _lastComp;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -36,7 +42,10 @@ class PreprocEngine {
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
 
-    void executeGraph(Opt<cv::GComputation>& lastComputation,
+    static std::shared_ptr<CompiledGraphs> takeCachedGraphs(const CallDesc &call);
+    static void cacheGraphs(const CallDesc &call, std::shared_ptr<CompiledGraphs> graphs);
+
+    void executeGraph(CompiledGraphs& graphs,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
@@ -50,6 +59,7 @@ class PreprocEngine {
 
 public:
     PreprocEngine();
+    ~PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
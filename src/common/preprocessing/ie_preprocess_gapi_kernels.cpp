@@ -343,6 +343,63 @@ struct typed_i420_to_rgb_row {
 };
 }  // namespace
 
+namespace {
+
+inline void yuv420BlockToRgbPlanes(const uint8_t u, const uint8_t v, const uint8_t** y_rows,
+                                   uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int i) {
+    int ruv, guv, buv;
+    uvToRGBuv(u, v, ruv, guv, buv);
+
+    for (int y = 0; y < 2; y++) {
+        for (int x = 0; x < 2; x++) {
+            yRGBuvToRGB(y_rows[y][i + x], ruv, guv, buv, r_rows[y][i + x], g_rows[y][i + x], b_rows[y][i + x]);
+        }
+    }
+}
+
+inline void nv12ToRgbPlanesRowImpl(scalar_tag, const uint8_t** y_rows, const uint8_t* uv_row,
+                                   uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width) {
+    for (int i = 0; i < buf_width; i += 2) {
+        yuv420BlockToRgbPlanes(uv_row[i], uv_row[i + 1], y_rows, r_rows, g_rows, b_rows, i);
+    }
+}
+
+inline void i420ToRgbPlanesRowImpl(scalar_tag, const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row,
+                                   uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width) {
+    for (int i = 0; i < buf_width; i += 2) {
+        yuv420BlockToRgbPlanes(u_row[i / 2], v_row[i / 2], y_rows, r_rows, g_rows, b_rows, i);
+    }
+}
+
+template<typename isa_tag_t>
+struct typed_nv12_to_rgb_planes_row {
+    using p_f = void (*)(const uint8_t** y_rows, const uint8_t* uv_row,
+                         uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width);
+
+    template <typename type>
+    p_f operator()(type_to_type<type>) {
+        return [](const uint8_t** y_rows, const uint8_t* uv_row,
+                  uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width) {
+            nv12ToRgbPlanesRowImpl(isa_tag_t{}, y_rows, uv_row, r_rows, g_rows, b_rows, buf_width);
+        };
+    }
+};
+
+template<typename isa_tag_t>
+struct typed_i420_to_rgb_planes_row {
+    using p_f = void (*)(const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row,
+                         uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width);
+
+    template <typename type>
+    p_f operator()(type_to_type<type>) {
+        return [](const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row,
+                  uint8_t** r_rows, uint8_t** g_rows, uint8_t** b_rows, const int buf_width) {
+            i420ToRgbPlanesRowImpl(isa_tag_t{}, y_rows, u_row, v_row, r_rows, g_rows, b_rows, buf_width);
+        };
+    }
+};
+}  // namespace
+
 namespace linear {
 struct Mapper {
     typedef short alpha_type;
@@ -1340,6 +1397,66 @@ GAPI_FLUID_KERNEL(FI420toRGB, I420toRGB, false) {
     }
 };
 
+// NV12 to RGB straight to the planes, without the interleaved image which is split into them then
+GAPI_FLUID_KERNEL(FNV12toRGBp, NV12toRGBp, false) {
+    static const int Window = 1;
+    static const int LPI = 2;
+    static const auto Kind = cv::GFluidKernel::Kind::YUV420toRGB;
+
+    static void run(const cv::gapi::fluid::View & in_y,
+                    const cv::gapi::fluid::View & in_uv,
+                    cv::gapi::fluid::Buffer & out_r,
+                    cv::gapi::fluid::Buffer & out_g,
+                    cv::gapi::fluid::Buffer & out_b) {
+        GAPI_DbgAssert(is_cv_type_in_list<nv12_to_rgb_supported_types>(out_r.meta().depth));
+
+        const uchar* uv_row = in_uv.InLineB(0);
+        const uchar* y_rows[2] = { in_y.InLineB(0), in_y.InLineB(1) };
+        uchar* r_rows[2] = { out_r.OutLineB(0), out_r.OutLineB(1) };
+        uchar* g_rows[2] = { out_g.OutLineB(0), out_g.OutLineB(1) };
+        uchar* b_rows[2] = { out_b.OutLineB(0), out_b.OutLineB(1) };
+
+        const auto rowFunc = type_dispatch<nv12_to_rgb_supported_types>(out_r.meta().depth, cv_type_id{},
+                                                                        typed_nv12_to_rgb_planes_row<isa_tag_t>{},
+                                                                        nullptr);
+
+        GAPI_DbgAssert(rowFunc);
+
+        rowFunc(y_rows, uv_row, r_rows, g_rows, b_rows, out_r.length());
+    }
+};
+
+GAPI_FLUID_KERNEL(FI420toRGBp, I420toRGBp, false) {
+    static const int Window = 1;
+    static const int LPI = 2;
+    static const auto Kind = cv::GFluidKernel::Kind::YUV420toRGB;
+
+    static void run(const cv::gapi::fluid::View & in_y,
+                    const cv::gapi::fluid::View & in_u,
+                    const cv::gapi::fluid::View & in_v,
+                    cv::gapi::fluid::Buffer & out_r,
+                    cv::gapi::fluid::Buffer & out_g,
+                    cv::gapi::fluid::Buffer & out_b) {
+        GAPI_DbgAssert(is_cv_type_in_list<i420_to_rgb_supported_types>(out_r.meta().depth));
+        GAPI_DbgAssert(in_u.length() == in_v.length());
+
+        const uchar* u_row = in_u.InLineB(0);
+        const uchar* v_row = in_v.InLineB(0);
+        const uchar* y_rows[2] = { in_y.InLineB(0), in_y.InLineB(1) };
+        uchar* r_rows[2] = { out_r.OutLineB(0), out_r.OutLineB(1) };
+        uchar* g_rows[2] = { out_g.OutLineB(0), out_g.OutLineB(1) };
+        uchar* b_rows[2] = { out_b.OutLineB(0), out_b.OutLineB(1) };
+
+        const auto rowFunc = type_dispatch<i420_to_rgb_supported_types>(out_r.meta().depth, cv_type_id{},
+                                                                        typed_i420_to_rgb_planes_row<isa_tag_t>{},
+                                                                        nullptr);
+
+        GAPI_DbgAssert(rowFunc);
+
+        rowFunc(y_rows, u_row, v_row, r_rows, g_rows, b_rows, out_r.length());
+    }
+};
+
 GAPI_FLUID_KERNEL(FSplit2, Split2, false) {
     static const int LPI = 4;
     static const int Window = 1;
@@ -1866,6 +1983,8 @@ struct CC_and_MergeISA {
     inline bool operator()(type_to_type<isa_tag_t>) {
         pckg.include<typename choose_impl<isa_tag_t>::FI420toRGB>();
         pckg.include<typename choose_impl<isa_tag_t>::FNV12toRGB>();
+        pckg.include<typename choose_impl<isa_tag_t>::FI420toRGBp>();
+        pckg.include<typename choose_impl<isa_tag_t>::FNV12toRGBp>();
         pckg.include<typename choose_impl<isa_tag_t>::FChanToPlane>();
         pckg.include<typename choose_impl<isa_tag_t>::FMerge2>();
         pckg.include<typename choose_impl<isa_tag_t>::FMerge3>();
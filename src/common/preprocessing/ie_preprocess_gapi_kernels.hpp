@@ -189,6 +189,22 @@ namespace gapi {
         }
     };
 
+    G_TYPED_KERNEL_M(NV12toRGBp, <GMat3(cv::GMat, cv::GMat)>, "com.intel.ie.nv12torgbp") {
+        static std::tuple<cv::GMatDesc, cv::GMatDesc, cv::GMatDesc> outMeta(cv::GMatDesc in_y, cv::GMatDesc in_uv) {
+            const auto out_desc = NV12toRGB::outMeta(in_y, in_uv).withType(CV_8U, 1);
+            return std::make_tuple(out_desc, out_desc, out_desc);
+        }
+    };
+
+    G_TYPED_KERNEL_M(I420toRGBp, <GMat3(cv::GMat, cv::GMat, cv::GMat)>, "com.intel.ie.i420torgbp") {
+        static std::tuple<cv::GMatDesc, cv::GMatDesc, cv::GMatDesc> outMeta(cv::GMatDesc in_y,
+                                                                            cv::GMatDesc in_u,
+                                                                            cv::GMatDesc in_v) {
+            const auto out_desc = I420toRGB::outMeta(in_y, in_u, in_v).withType(CV_8U, 1);
+            return std::make_tuple(out_desc, out_desc, out_desc);
+        }
+    };
+
     G_TYPED_KERNEL(ConvertDepth, <cv::GMat(cv::GMat, int depth)>, "com.intel.ie.ConvertDepth") {
         static cv::GMatDesc outMeta(const cv::GMatDesc& in, int depth) {
             GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F);
@@ -416,6 +416,92 @@ CV_ALWAYS_INLINE void i420ToRgbRowImpl(isa_tag_t, const uint8_t** srcY, const ui
     }
 }
 
+#if MANUAL_SIMD
+// converts 2 * nlanes pixels of 2 rows given the U and V values of their nlanes 2x2 blocks and stores the R, G, B planes
+CV_ALWAYS_INLINE void yuv420ToRgbPlanes(const v_uint8& u, const v_uint8& v,
+                                        const uchar** srcY, uchar** dstR, uchar** dstG, uchar** dstB,
+                                        const int i) {
+    constexpr int nlanes = v_uint8::nlanes;
+
+    v_uint8 vy[4];
+    v_load_deinterleave(srcY[0] + i, vy[0], vy[1]);
+    v_load_deinterleave(srcY[1] + i, vy[2], vy[3]);
+
+    v_int32 ruv[4], guv[4], buv[4];
+    uvToRGBuv(u, v, ruv, guv, buv);
+
+    v_uint8 r[4], g[4], b[4];
+    for (int k = 0; k < 4; k++) {
+        yRGBuvToRGB(vy[k], ruv, guv, buv, r[k], g[k], b[k]);
+    }
+
+    // [even pixels...], [odd pixels...] => [pixels 0...nlanes-1], [pixels nlanes...2*nlanes-1]
+    for (int y = 0; y < 2; y++) {
+        v_uint8 lo, hi;
+        v_zip(r[2 * y], r[2 * y + 1], lo, hi);
+        vx_store(dstR[y] + i, lo);
+        vx_store(dstR[y] + i + nlanes, hi);
+        v_zip(g[2 * y], g[2 * y + 1], lo, hi);
+        vx_store(dstG[y] + i, lo);
+        vx_store(dstG[y] + i + nlanes, hi);
+        v_zip(b[2 * y], b[2 * y + 1], lo, hi);
+        vx_store(dstB[y] + i, lo);
+        vx_store(dstB[y] + i + nlanes, hi);
+    }
+}
+#endif
+
+CV_ALWAYS_INLINE void yuv420ToRgbPlanes(const uchar u, const uchar v,
+                                        const uchar** srcY, uchar** dstR, uchar** dstG, uchar** dstB,
+                                        const int i) {
+    int ruv, guv, buv;
+    uvToRGBuv(u, v, ruv, guv, buv);
+
+    for (int y = 0; y < 2; y++) {
+        for (int x = 0; x < 2; x++) {
+            yRGBuvToRGB(srcY[y][i + x], ruv, guv, buv, dstR[y][i + x], dstG[y][i + x], dstB[y][i + x]);
+        }
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void nv12ToRgbPlanesRowImpl(isa_tag_t, const uchar** srcY, const uchar* srcUV,
+                                             uchar** dstR, uchar** dstG, uchar** dstB, const int width) {
+    int i = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_uint8::nlanes;
+
+    for (; i <= width - 2 * nlanes; i += 2 * nlanes) {
+        v_uint8 u, v;
+        v_load_deinterleave(srcUV + i, u, v);
+        yuv420ToRgbPlanes(u, v, srcY, dstR, dstG, dstB, i);
+    }
+#endif
+
+    for (; i < width; i += 2) {
+        yuv420ToRgbPlanes(srcUV[i], srcUV[i + 1], srcY, dstR, dstG, dstB, i);
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void i420ToRgbPlanesRowImpl(isa_tag_t, const uchar** srcY, const uchar* srcU, const uchar* srcV,
+                                             uchar** dstR, uchar** dstG, uchar** dstB, const int width) {
+    int i = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_uint8::nlanes;
+
+    for (; i <= width - 2 * nlanes; i += 2 * nlanes) {
+        yuv420ToRgbPlanes(vx_load(srcU + i / 2), vx_load(srcV + i / 2), srcY, dstR, dstG, dstB, i);
+    }
+#endif
+
+    for (; i < width; i += 2) {
+        yuv420ToRgbPlanes(srcU[i / 2], srcV[i / 2], srcY, dstR, dstG, dstB, i);
+    }
+}
+
 //------------------------------------------------------------------------------
 
 // vertical pass
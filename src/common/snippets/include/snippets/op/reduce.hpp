@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Reduce
+ * @brief Generated by Canonicalization for a reduction over the innermost dimension.
+ * The output keeps the rank of the input and has the innermost dimension equal to 1.
+ * The value is accumulated in a dedicated vector register during a pass over the innermost dimension
+ * and is available only for the operations executed during the next passes.
+ * @ingroup snippets
+ */
+class Reduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Reduce", "SnippetsOpset");
+
+    Reduce(const Output<Node>& x);
+    Reduce() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+};
+
+/**
+ * @interface ReduceSum
+ * @brief Sum of the elements along the innermost dimension
+ * @ingroup snippets
+ */
+class ReduceSum : public Reduce {
+public:
+    OPENVINO_OP("ReduceSum", "SnippetsOpset", ngraph::snippets::op::Reduce);
+
+    ReduceSum(const Output<Node>& x);
+    ReduceSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ReduceSum>(new_args.at(0));
+    }
+};
+
+/**
+ * @interface ReduceMax
+ * @brief Maximum of the elements along the innermost dimension
+ * @ingroup snippets
+ */
+class ReduceMax : public Reduce {
+public:
+    OPENVINO_OP("ReduceMax", "SnippetsOpset", ngraph::snippets::op::Reduce);
+
+    ReduceMax(const Output<Node>& x);
+    ReduceMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ReduceMax>(new_args.at(0));
+    }
+};
+
+/**
+ * @interface ScalarReduceSum
+ * @brief Generated by Canonicalization for a scalar accumulation of the tail elements
+ * @ingroup snippets
+ */
+class ScalarReduceSum : public ReduceSum {
+public:
+    OPENVINO_OP("ScalarReduceSum", "SnippetsOpset", ngraph::snippets::op::ReduceSum);
+
+    ScalarReduceSum(const Output<Node>& x);
+    ScalarReduceSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ScalarReduceSum>(new_args.at(0));
+    }
+};
+
+/**
+ * @interface ScalarReduceMax
+ * @brief Generated by Canonicalization for a scalar accumulation of the tail elements
+ * @ingroup snippets
+ */
+class ScalarReduceMax : public ReduceMax {
+public:
+    OPENVINO_OP("ScalarReduceMax", "SnippetsOpset", ngraph::snippets::op::ReduceMax);
+
+    ScalarReduceMax(const Output<Node>& x);
+    ScalarReduceMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ScalarReduceMax>(new_args.at(0));
+    }
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
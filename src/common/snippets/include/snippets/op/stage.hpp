@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "snippets/emitter.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Stage
+ * @brief Generated by Canonicalization for subgraphs with reductions and represents one pass over the innermost dimension.
+ * The Stage initializes the accumulators of its reductions, runs the enclosed Tiles, reduces the accumulators horizontally
+ * and moves back the data pointers which are read again by the next stages.
+ * @ingroup snippets
+ */
+class Stage : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Stage", "SnippetsOpset");
+
+    Stage(const std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>& region);
+    Stage() = default;
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> region;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        auto stage = std::make_shared<Stage>(region);
+        stage->reductions = reductions;
+        stage->rewind_ptrs = rewind_ptrs;
+        stage->compile_params = compile_params;
+        return stage;
+    }
+    // reductions accumulated during the stage
+    NodeVector reductions;
+    // indexes of the data pointers which have to be moved back to the row start after the stage
+    std::vector<size_t> rewind_ptrs;
+    const void *compile_params = nullptr;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -90,6 +90,9 @@ public:
 
     std::shared_ptr<Subgraph> make_canonical_from_this();
 
+    /// Returns true if the body reduces data over the innermost dimension, so the kernel makes several passes over each row
+    bool has_reductions() const;
+
     snippets::Schedule generate(const BlockedShapeVector& output_shapes, const BlockedShapeVector& input_shapes,
                                 ngraph::pass::Manager opt = ngraph::pass::Manager(), const void* compile_params = nullptr);
     snippets::Schedule generate(const BlockedShapeVector& output_shapes, const BlockedShapeVector& input_shapes,
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @brief Checks if the node is Softmax or MVN over the innermost dimension only, so it could be decomposed by DecomposeReductions
+ * @ingroup snippets
+ */
+bool is_innermost_reduction(const std::shared_ptr<const Node>& node);
+
+/**
+ * @interface DecomposeReductions
+ * @brief Decomposes Softmax and MVN over the innermost dimension to ReduceSum/ReduceMax and elementwise operations.
+ * Softmax(x) = Exp(x - ReduceMax(x)) / ReduceSum(Exp(x - ReduceMax(x)))
+ * MVN(x) = (x - mean) / Sqrt(ReduceSum((x - mean)^2) / N + eps), mean = ReduceSum(x) / N
+ * The pass is used to convert model to a canonical form for code generation
+ * @ingroup snippets
+ */
+class DecomposeReductions: public ngraph::pass::MatcherPass {
+public:
+    DecomposeReductions();
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
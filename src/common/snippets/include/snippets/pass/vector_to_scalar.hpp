@@ -35,6 +35,18 @@ public:
     ReplaceStoresWithScalarStores();
 };
 
+/**
+ * @interface ReplaceReductionsWithScalarReductions
+ * @brief Replaces vector reductions with scalar versions.
+ * The scalar versions accumulate only the lowest lane of the input.
+ * Used for tail generation
+ * @ingroup snippets
+ */
+class ReplaceReductionsWithScalarReductions: public ngraph::pass::MatcherPass {
+public:
+    ReplaceReductionsWithScalarReductions();
+};
+
 } // namespace pass
 } // namespace snippets
 } // namespace ngraph
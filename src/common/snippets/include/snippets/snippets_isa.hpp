@@ -18,6 +18,8 @@
 #include "op/scalarload.hpp"
 #include "op/scalarstore.hpp"
 #include "op/powerstatic.hpp"
+#include "op/reduce.hpp"
+#include "op/stage.hpp"
 #include "op/store.hpp"
 #include "op/tile.hpp"
 #include "op/vectorload.hpp"
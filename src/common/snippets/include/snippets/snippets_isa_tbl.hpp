@@ -24,6 +24,11 @@ NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
 
+NGRAPH_OP(ReduceSum, ngraph::snippets::op)
+NGRAPH_OP(ReduceMax, ngraph::snippets::op)
+NGRAPH_OP(ScalarReduceSum, ngraph::snippets::op)
+NGRAPH_OP(ScalarReduceMax, ngraph::snippets::op)
+
 // Layout-oblivious from opset1
 
 // opset completeness
@@ -8,6 +8,7 @@
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/stage.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
@@ -38,6 +39,51 @@ auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph:
     return std::make_pair(rin, rout);
 }
 
+namespace {
+using EmitterCode = std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>;
+
+// Values of reductions are available only after a complete pass over the innermost dimension, so the operations are split
+// into stages: the stage of an operation is the number of reductions it depends on in a row. Every reduction and store
+// is emitted in its own stage together with all the non-reduction operations it depends on, these operations are
+// recomputed if they are required by several stages. Returns the stages each operation should be emitted in.
+auto get_stages(const ngraph::NodeVector& ops) -> std::map<const ngraph::Node*, std::set<size_t>> {
+    std::map<const ngraph::Node*, size_t> level;
+    for (const auto& op : ops) {
+        size_t op_level = 0;
+        for (const auto& input : op->input_values()) {
+            const auto source = input.get_node();
+            const size_t source_level = level.count(source) ? level[source] : 0;
+            op_level = std::max(op_level, source_level + (ov::is_type<ngraph::snippets::op::Reduce>(source) ? 1 : 0));
+        }
+        level[op.get()] = op_level;
+    }
+
+    std::map<const ngraph::Node*, std::set<size_t>> stages;
+    std::function<void(const ngraph::Node*, size_t)> mark = [&](const ngraph::Node* n, size_t stage) {
+        if (!stages[n].insert(stage).second)
+            return;
+        for (const auto& input : n->input_values()) {
+            if (!ov::is_type<ngraph::snippets::op::Reduce>(input.get_node()))
+                mark(input.get_node(), stage);
+        }
+    };
+    for (const auto& op : ops) {
+        if (ov::is_type<ngraph::snippets::op::Reduce>(op) || ov::is_type<ngraph::snippets::op::Store>(op))
+            mark(op.get(), level[op.get()]);
+    }
+    return stages;
+}
+
+auto get_num_stages(const std::map<const ngraph::Node*, std::set<size_t>>& stages) -> size_t {
+    size_t num_stages = 1;
+    for (const auto& op_stages : stages) {
+        if (!op_stages.second.empty())
+            num_stages = std::max(num_stages, *op_stages.second.rbegin() + 1);
+    }
+    return num_stages;
+}
+} // namespace
+
 ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov::Model>& m,
                                                              const void* compile_params) const {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator::generate")
@@ -52,8 +98,9 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
 
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
-    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
-    for (auto n : m->get_ordered_ops()) {
+    const auto ops = m->get_ordered_ops();
+    EmitterCode lowered;
+    for (auto n : ops) {
         lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
@@ -63,29 +110,73 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     ngraph::pass::Manager mng;
     mng.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
     mng.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    mng.register_pass<ngraph::snippets::pass::ReplaceReductionsWithScalarReductions>();
     mng.run_passes(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> scalar_lowered;
-    for (auto n : m_scalar->get_ordered_ops()) {
+    const auto scalar_ops = m_scalar->get_ordered_ops();
+    EmitterCode scalar_lowered;
+    for (auto n : scalar_ops) {
         scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D")
 
     // wrapping into tiles1D
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles1D;
-    auto tile = std::make_shared<ngraph::snippets::op::Tile>(lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                                   std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
-    tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                    std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+    auto wrap_into_tiles1D = [&](const EmitterCode& vector_code, const EmitterCode& scalar_code) -> EmitterCode {
+        EmitterCode tiles1D;
+        auto tile = std::make_shared<ngraph::snippets::op::Tile>(vector_code);
+        tile->compile_params = compile_params;
+        tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                       std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
+        tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_code);
+        tile->compile_params = compile_params;
+        tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                        std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+        return tiles1D;
+    };
+
+    EmitterCode tiles1D;
+    const auto stages = get_stages(ops);
+    const auto scalar_stages = get_stages(scalar_ops);
+    const size_t num_stages = get_num_stages(stages);
+    if (num_stages == 1) {
+        tiles1D = wrap_into_tiles1D(lowered, scalar_lowered);
+    } else {
+        // every stage is a separate pass over the innermost dimension
+        auto select = [](const ngraph::NodeVector& ops, const EmitterCode& code,
+                         const std::map<const ngraph::Node*, std::set<size_t>>& stages, size_t stage) {
+            EmitterCode selected;
+            for (size_t i = 0; i < ops.size(); i++) {
+                auto it = stages.find(ops[i].get());
+                if (it != stages.end() && it->second.count(stage))
+                    selected.push_back(code[i]);
+            }
+            return selected;
+        };
+        for (size_t k = 0; k < num_stages; k++) {
+            auto stage = std::make_shared<ngraph::snippets::op::Stage>(
+                wrap_into_tiles1D(select(ops, lowered, stages, k), select(scalar_ops, scalar_lowered, scalar_stages, k)));
+            stage->compile_params = compile_params;
+            for (const auto& op : ops) {
+                const auto it = stages.find(op.get());
+                if (it == stages.end() || !it->second.count(k))
+                    continue;
+                if (ov::is_type<ngraph::snippets::op::Reduce>(op))
+                    stage->reductions.push_back(op);
+                // loads post increment data pointers, so the pointers read again by the next stages are moved back
+                if (ov::is_type<ngraph::snippets::op::Load>(op) && !ov::is_type<ngraph::snippets::op::BlockedLoad>(op) &&
+                    *op->get_input_shape(0).rbegin() != 1 && *it->second.rbegin() > k) {
+                    stage->rewind_ptrs.push_back(op->get_rt_info()["effectiveAddress"].as<int64_t>());
+                }
+            }
+            tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Stage::get_type_info_static())(stage),
+                                             std::make_pair(std::vector<size_t>{nptrs}, std::vector<size_t>{})));
+        }
+    }
 
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles2D;
-    tile = std::make_shared<ngraph::snippets::op::Tile>(tiles1D);
+    EmitterCode tiles2D;
+    auto tile = std::make_shared<ngraph::snippets::op::Tile>(tiles1D);
     tile->compile_params = compile_params;
     tiles2D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
                                      std::make_pair(std::vector<size_t>({1, 0, nptrs, 0}), std::vector<size_t>{})));
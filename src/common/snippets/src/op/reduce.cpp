@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/reduce.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Reduce::Reduce(const Output<Node>& x) : Op({x}) {
+}
+
+bool snippets::op::Reduce::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+void snippets::op::Reduce::validate_and_infer_types() {
+    auto shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, shape.rank().is_static() && shape.rank().get_length() > 0,
+                          "Reduce expects an input with static non-zero rank, got ", shape);
+    shape[shape.rank().get_length() - 1] = 1;
+    set_output_type(0, get_input_element_type(0), shape);
+}
+
+snippets::op::ReduceSum::ReduceSum(const Output<Node>& x) : Reduce(x) {
+    constructor_validate_and_infer_types();
+}
+
+snippets::op::ReduceMax::ReduceMax(const Output<Node>& x) : Reduce(x) {
+    constructor_validate_and_infer_types();
+}
+
+snippets::op::ScalarReduceSum::ScalarReduceSum(const Output<Node>& x) : ReduceSum(x) {
+}
+
+snippets::op::ScalarReduceMax::ScalarReduceMax(const Output<Node>& x) : ReduceMax(x) {
+}
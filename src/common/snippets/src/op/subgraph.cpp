@@ -10,6 +10,7 @@
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/load_movebroadcast_to_broadcastload.hpp"
 #include "snippets/pass/assign_registers.hpp"
+#include "snippets/pass/decompose_reductions.hpp"
 
 #include <ngraph/pass/manager.hpp>
 #include <openvino/pass/serialize.hpp>
@@ -131,6 +132,14 @@ std::shared_ptr<snippets::op::Subgraph> snippets::op::Subgraph::make_canonical_f
     return snippet;
 }
 
+bool snippets::op::Subgraph::has_reductions() const {
+    const auto& ops = m_body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& op) {
+        return ov::is_type<snippets::op::Reduce>(op) ||
+               ov::is_type<opset1::Softmax>(op) || ov::is_type<ngraph::op::v8::Softmax>(op) || ov::is_type<ngraph::op::v6::MVN>(op);
+    });
+}
+
 // We also can think of canonization as of pass to copy original subgraph and transforming it to canonical form suitable for code generation
 // pass actual parameters and results shapes to generate for as well as channel mapping,
 // Todo: we need to distinguish between 5d tensors that represents <N, C, H, W, c> and <N, C, D, H, W> somehow like locked dimensions
@@ -144,6 +153,22 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
     NODE_VALIDATION_CHECK(this, output_shapes.size() == m_body->get_results().size(),
         "number of results for snippet doesn't match passed to generate method: ", output_shapes.size(), " vs ", m_body->get_results().size(), ".");
 
+    // reductions are decomposed before the reshape below, since their axes are defined for the original ranks
+    if (has_reductions()) {
+        // the decomposition depends on the reduced dims, so the actual shapes are set first. The subgraphs with reductions
+        // are executed in planar layout only, so the passed shapes are not blocked
+        for (size_t i = 0; i < m_body->get_parameters().size(); i++) {
+            auto param = m_body->get_parameters()[i];
+            if (param->get_partial_shape().is_dynamic())
+                m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), std::get<0>(input_shapes[i])));
+        }
+        m_body->validate_nodes_and_infer_types();
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<snippets::pass::DecomposeReductions>();
+        manager.run_passes(m_body);
+    }
+
     // replace only constants which are actually should be represented as scalars during code generation and probably move this step a bit later
     for (auto op : m_body->get_ordered_ops()) {
         if (auto constant = ngraph::as_type_ptr<opset1::Constant>(op)) {
@@ -160,11 +185,13 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
     // TODO: store blocking into to Parameter's rt_info for future propagation
     for (size_t i = 0; i < m_body->get_parameters().size(); i++) {
         auto param = m_body->get_parameters()[i];
-        if (param->get_shape().size() < 4) {
+        if (param->get_partial_shape().rank().get_length() < 4) {
+            // such ranks are not blocked, so the dynamic parameters simply get the actual dims
+            const auto param_shape = param->get_partial_shape().is_static() ? param->get_shape() : std::get<0>(input_shapes[i]);
             std::vector<size_t> shape(4, 1);
-            std::copy(param->get_shape().begin(), param->get_shape().end(), &shape.at(4 - (param->get_shape().size() == 0 ? 1 : param->get_shape().size())) );
+            std::copy(param_shape.begin(), param_shape.end(), &shape.at(4 - (param_shape.size() == 0 ? 1 : param_shape.size())) );
             m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), ngraph::Shape(shape)));
-        } else if (param->get_shape().size() >= 4) {
+        } else {
             if (param->get_element_type() != std::get<2>(input_shapes[i])) {
                 throw ngraph::ngraph_error("changes in presision. Is it legal??");
             }
@@ -108,13 +108,33 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         live_intervals.insert(std::make_pair(i, find_last_use(i)));
     }
 
+    // Accumulators of reductions live during the whole pass over the innermost dimension, so they get
+    // dedicated registers from the top of the bank and don't take part in the allocation below
+    const int num_vec_regs = 16;
+    std::map<Reg, Reg> register_map;
+    std::set<Reg> reserved;
+    for (size_t i = 0; i < stmts.size(); i++) {
+        if (ov::is_type<snippets::op::Reduce>(stmts[i])) {
+            const Reg reg = num_vec_regs - 1 - reserved.size();
+            register_map[i] = reg;
+            reserved.insert(reg);
+        }
+    }
+    if (reserved.size() >= num_vec_regs)
+        throw ngraph_error("cannot allocate registers for reductions of a snippet");
+
     // http://web.cs.ucla.edu/~palsberg/course/cs132/linearscan.pdf
     std::multiset<std::pair<int, int>, by_ending> active;
-    std::map<Reg, Reg> register_map;
     std::stack<Reg> bank;
-    for (int i = 0; i < 16; i++) bank.push(16-1-i);
+    for (int i = 0; i < num_vec_regs; i++) {
+        if (!reserved.count(num_vec_regs-1-i))
+            bank.push(num_vec_regs-1-i);
+    }
+    const size_t bank_size = bank.size();
 
     for (auto interval : live_intervals) {
+        if (ov::is_type<snippets::op::Reduce>(stmts[interval.first]))
+            continue;
         // check expired
         while (!active.empty()) {
             auto x = *active.begin();
@@ -125,7 +145,7 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
             bank.push(register_map[x.first]);
         }
         // allocate
-        if (active.size() == 16) {
+        if (active.size() == bank_size) {
             throw ngraph_error("caanot allocate registers for a snippet ");
         } else {
             register_map[interval.first] = bank.top();
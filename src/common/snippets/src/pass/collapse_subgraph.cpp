@@ -7,6 +7,7 @@
 
 #include "snippets/pass/collapse_subgraph.hpp"
 #include "snippets/op/subgraph.hpp"
+#include "snippets/pass/decompose_reductions.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
@@ -33,6 +34,9 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // dynamic dimensions of different outputs can't be matched before the actual shapes are known
+    if (std::any_of(outputs.begin(), outputs.end(), [](const Output<const Node>& output) { return output.get_partial_shape().is_dynamic(); }))
+        return outputs.size() > 1;
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -104,8 +108,9 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
 
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
     auto supported = [](descriptor::Tensor& t) -> bool {
+        // the kernels are generated for the actual shapes, but their rank must be known to define the schedule
         return t.get_element_type() == ngraph::element::f32 &&
-               t.get_partial_shape().is_static();
+               t.get_partial_shape().rank().is_static();
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
@@ -117,7 +122,11 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    // MVN axes are checked by is_innermost_reduction(), only the data precision matters
+    auto is_axes = [&n](const Input<const Node>& in) -> bool {
+        return in.get_index() > 0 && ov::is_type<ngraph::op::v6::MVN>(n);
+    };
+    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  is_axes(in) || supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -164,7 +173,7 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
 } // namespace
 
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    return (is_layout_oblivious(node) || is_innermost_reduction(node)) && has_supported_in_out(node);
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "remarks.hpp"
+
+#include "snippets/pass/decompose_reductions.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+namespace {
+auto decompose_softmax(const ngraph::Output<ngraph::Node>& data) -> std::shared_ptr<ngraph::Node> {
+    using namespace ngraph;
+    auto max = std::make_shared<snippets::op::ReduceMax>(data);
+    auto exp = std::make_shared<opset1::Exp>(std::make_shared<opset1::Subtract>(data, max));
+    auto sum = std::make_shared<snippets::op::ReduceSum>(exp);
+    return std::make_shared<opset1::Divide>(exp, sum);
+}
+
+auto decompose_mvn(const std::shared_ptr<ngraph::opset6::MVN>& mvn) -> std::shared_ptr<ngraph::Node> {
+    using namespace ngraph;
+    const auto data = mvn->input_value(0);
+    const auto inv_size = opset1::Constant::create(element::f32, Shape{1}, {1.f / static_cast<float>(data.get_shape().back())});
+    auto mean = std::make_shared<opset1::Multiply>(std::make_shared<snippets::op::ReduceSum>(data), inv_size);
+    auto diff = std::make_shared<opset1::Subtract>(data, mean);
+    if (!mvn->get_normalize_variance())
+        return diff;
+
+    auto variance = std::make_shared<opset1::Multiply>(
+        std::make_shared<snippets::op::ReduceSum>(std::make_shared<opset1::Multiply>(diff, diff)), inv_size);
+    const auto eps = opset1::Constant::create(element::f32, Shape{1}, {mvn->get_eps()});
+    std::shared_ptr<Node> denominator;
+    if (mvn->get_eps_mode() == op::MVNEpsMode::INSIDE_SQRT) {
+        denominator = std::make_shared<opset1::Sqrt>(std::make_shared<opset1::Add>(variance, eps));
+    } else {
+        denominator = std::make_shared<opset1::Add>(std::make_shared<opset1::Sqrt>(variance), eps);
+    }
+    return std::make_shared<opset1::Divide>(diff, denominator);
+}
+} // namespace
+
+bool ngraph::snippets::pass::is_innermost_reduction(const std::shared_ptr<const Node>& node) {
+    const auto rank = node->get_input_partial_shape(0).rank();
+    if (rank.is_dynamic() || rank.get_length() == 0)
+        return false;
+    const auto last_axis = rank.get_length() - 1;
+    if (auto softmax = ov::as_type_ptr<const opset1::Softmax>(node)) {
+        return static_cast<int64_t>(softmax->get_axis()) == last_axis;
+    } else if (auto softmax = ov::as_type_ptr<const opset8::Softmax>(node)) {
+        const auto axis = softmax->get_axis();
+        return (axis < 0 ? axis + rank.get_length() : axis) == last_axis;
+    } else if (auto mvn = ov::as_type_ptr<const opset6::MVN>(node)) {
+        const auto axes = ov::as_type_ptr<const opset1::Constant>(mvn->get_input_node_shared_ptr(1));
+        if (!axes)
+            return false;
+        const auto values = axes->cast_vector<int64_t>();
+        return values.size() == 1 && (values[0] < 0 ? values[0] + rank.get_length() : values[0]) == last_axis;
+    }
+    return false;
+}
+
+ngraph::snippets::pass::DecomposeReductions::DecomposeReductions() {
+    MATCHER_SCOPE(DecomposeReductions);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax, ngraph::opset6::MVN>()),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::DecomposeReductions")
+            auto root = m.get_match_root();
+            const auto rank = root->get_input_partial_shape(0).rank();
+            NGRAPH_CHECK(rank.is_static() && root->get_input_partial_shape(0).is_static(),
+                         "DecomposeReductions supports only static shapes");
+            NGRAPH_CHECK(ngraph::snippets::pass::is_innermost_reduction(root),
+                         "DecomposeReductions supports only reductions over the innermost dimension");
+
+            std::shared_ptr<ngraph::Node> decomposed;
+            if (auto mvn = ov::as_type_ptr<ngraph::opset6::MVN>(root)) {
+                decomposed = decompose_mvn(mvn);
+            } else {
+                decomposed = decompose_softmax(root->input_value(0));
+            }
+            remark(2) << "Decompose " << root->get_type_name() << " " << root->get_friendly_name() << std::endl;
+
+            decomposed->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, ngraph::NodeVector{decomposed});
+            ngraph::replace_node(root, decomposed);
+            return true;
+        });
+}
@@ -40,3 +40,25 @@ ngraph::snippets::pass::ReplaceStoresWithScalarStores::ReplaceStoresWithScalarSt
             return true;
         });
 }
+
+ngraph::snippets::pass::ReplaceReductionsWithScalarReductions::ReplaceReductionsWithScalarReductions() {
+    MATCHER_SCOPE(ReplaceReductionsWithScalarReductions);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::snippets::op::ReduceSum, ngraph::snippets::op::ReduceMax>()),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ReplaceReductionsWithScalarReductions_callback")
+            auto root = m.get_match_root();
+            if (ov::is_type<ngraph::snippets::op::ScalarReduceSum>(root) || ov::is_type<ngraph::snippets::op::ScalarReduceMax>(root))
+                return false;
+            std::shared_ptr<ngraph::Node> reduce;
+            if (ov::is_type<ngraph::snippets::op::ReduceSum>(root)) {
+                reduce = std::make_shared<ngraph::snippets::op::ScalarReduceSum>(root->input_value(0));
+            } else {
+                reduce = std::make_shared<ngraph::snippets::op::ScalarReduceMax>(root->input_value(0));
+            }
+            reduce->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, reduce);
+            ngraph::replace_node(root, reduce);
+            return true;
+        });
+}
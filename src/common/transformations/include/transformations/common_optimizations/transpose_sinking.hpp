@@ -22,6 +22,10 @@ class TRANSFORMATIONS_API TransposeEltwise;
 class TRANSFORMATIONS_API TransposeReduction;
 class TRANSFORMATIONS_API TransposeFQReduction;
 class TRANSFORMATIONS_API TransposeFuse;
+class TRANSFORMATIONS_API TransposeUnary;
+class TRANSFORMATIONS_API TransposeBinaryEltwise;
+class TRANSFORMATIONS_API TransposeConcat;
+class TRANSFORMATIONS_API TransposeSplit;
 
 }  // namespace pass
 }  // namespace ngraph
@@ -79,7 +83,51 @@ public:
 
 /**
  * @ingroup ie_transformation_common_api
- * @brief TransposeSinking transformation sinks Transposes through known operations
+ * @brief TransposeUnary transformation sinks Transpose through unary elementwise operations
+ */
+class ngraph::pass::TransposeUnary : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeUnary();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeBinaryEltwise transformation replaces Transposes with the same order on both inputs
+ * of binary elementwise operation with a single Transpose on its output
+ */
+class ngraph::pass::TransposeBinaryEltwise : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeBinaryEltwise();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeConcat transformation replaces Transposes with the same order on all inputs
+ * of Concat with a single Transpose on its output
+ */
+class ngraph::pass::TransposeConcat : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeConcat();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeSplit transformation sinks Transpose through Split or VariadicSplit in case
+ * each output of the split is consumed by a single Transpose, so the sunk Transposes get fused with them
+ */
+class ngraph::pass::TransposeSplit : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeSplit();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeSinking transformation sinks Transposes through known operations until they
+ * get fused or eliminated. Transposes are sunk only when that does not increase their number.
  */
 class ngraph::pass::TransposeSinking: public ngraph::pass::GraphRewrite {
 public:
@@ -89,6 +137,22 @@ public:
         add_matcher<ngraph::pass::TransposeReduction>();
         add_matcher<ngraph::pass::TransposeConvert>();
         add_matcher<ngraph::pass::TransposeEltwise>();
+        add_matcher<ngraph::pass::TransposeUnary>();
+        add_matcher<ngraph::pass::TransposeBinaryEltwise>();
+        add_matcher<ngraph::pass::TransposeConcat>();
+        add_matcher<ngraph::pass::TransposeSplit>();
         add_matcher<ngraph::pass::TransposeFuse>();
     }
+
+    bool run_on_model(const std::shared_ptr<ngraph::Function>& f) override;
+
+    /**
+     * @brief Returns the number of Transposes eliminated by the last run of the transformation
+     */
+    size_t get_eliminated_transposes_count() const {
+        return m_eliminated_transposes;
+    }
+
+private:
+    size_t m_eliminated_transposes = 0;
 };
@@ -115,8 +115,7 @@ bool ngraph::pass::MOCTransformations::run_on_model(const std::shared_ptr<ngraph
 
     manager.register_pass<ngraph::pass::BroadcastElementwiseFusion>();
 
-    auto transpose_sinking = manager.register_pass<ngraph::pass::GraphRewrite>();
-    transpose_sinking->add_matcher<ngraph::pass::TransposeSinking>();
+    auto transpose_sinking = manager.register_pass<ngraph::pass::TransposeSinking>();
     // SplitSqueezeConcatFusion should work in same GraphRewrite as TransposesSinking,
     // because it replaces pattern that may contain Transposes which must be optimized before
     // the transformation and it also inserts Transpose that can be optimized by TransposeSinking
@@ -6,12 +6,15 @@
 #include "transformations/common_optimizations/transpose_sinking.hpp"
 #include "transformations/utils/utils.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
+#include <ngraph/log.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/opsets/opset7.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <numeric>
 
@@ -21,6 +24,10 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeEltwise, "TransposeEltwise", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeReduction, "TransposeReduction", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeFQReduction, "TransposeFQReduction", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeFuse, "TransposeFuse", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeUnary, "TransposeUnary", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeBinaryEltwise, "TransposeBinaryEltwise", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeConcat, "TransposeConcat", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeSplit, "TransposeSplit", 0);
 
 using namespace ngraph;
 
@@ -60,8 +67,33 @@ std::shared_ptr<ngraph::opset6::Constant> get_reversed_order_constant(const std:
             ngraph::element::i64, ngraph::Shape{reverse_order.size()}, reverse_order);
 }
 
+// Returns the order of the Transpose node if it is a Constant, otherwise an empty vector
+std::vector<int64_t> get_transpose_order(const std::shared_ptr<ngraph::Node>& transpose) {
+    auto order_const = std::dynamic_pointer_cast<ngraph::opset7::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!order_const)
+        return {};
+    return order_const->cast_vector<int64_t>();
+}
+
+size_t count_transposes(const std::shared_ptr<ngraph::Function>& f) {
+    const auto& ops = f->get_ops();
+    return static_cast<size_t>(std::count_if(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& node) {
+        return ngraph::is_type<ngraph::opset7::Transpose>(node);
+    }));
+}
+
 } // namespace
 
+bool ngraph::pass::TransposeSinking::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    const auto transposes_before = count_transposes(f);
+    const bool rewritten = GraphRewrite::run_on_model(f);
+    const auto transposes_after = count_transposes(f);
+    m_eliminated_transposes = transposes_before > transposes_after ? transposes_before - transposes_after : 0;
+    NGRAPH_DEBUG << "TransposeSinking eliminated " << m_eliminated_transposes << " of " << transposes_before
+                 << " Transposes in " << f->get_friendly_name();
+    return rewritten;
+}
+
 ngraph::pass::TransposeEltwise::TransposeEltwise() {
     MATCHER_SCOPE(TransposeEltwise);
 
@@ -304,3 +336,196 @@ ngraph::pass::TransposeFuse::TransposeFuse() {
     auto m = std::make_shared<ngraph::pattern::Matcher>(transpose_2, matcher_name);
     register_matcher(m, matcher_pass_callback);
 }
+
+ngraph::pass::TransposeUnary::TransposeUnary() {
+    MATCHER_SCOPE(TransposeUnary);
+
+    auto transpose_label = pattern::wrap_type<opset7::Transpose>({pattern::any_input(),
+                                                                  pattern::wrap_type<opset7::Constant>()},
+                                                                  pattern::consumers_count(1));
+    auto unary_label = pattern::wrap_type<op::util::UnaryElementwiseArithmetic, opset7::Clamp, opset7::Elu,
+                                          opset7::SoftPlus, opset7::Mish, opset7::LogicalNot>({transpose_label});
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        const auto &pattern_to_output = m.get_pattern_value_map();
+        auto transpose = pattern_to_output.at(transpose_label).get_node_shared_ptr();
+        auto unary = pattern_to_output.at(unary_label).get_node_shared_ptr();
+
+        auto new_unary = unary->clone_with_new_inputs({transpose->input_value(0)});
+        auto new_transpose = transpose->clone_with_new_inputs({new_unary, transpose->input_value(1)});
+        register_new_node(new_transpose);
+
+        new_transpose->set_friendly_name(unary->get_friendly_name());
+        copy_runtime_info({transpose, unary}, {new_unary, new_transpose});
+        replace_node(unary, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(unary_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeBinaryEltwise::TransposeBinaryEltwise() {
+    MATCHER_SCOPE(TransposeBinaryEltwise);
+
+    auto transpose_a_label = pattern::wrap_type<opset7::Transpose>({pattern::any_input(pattern::has_static_rank()),
+                                                                    pattern::wrap_type<opset7::Constant>()});
+    auto transpose_b_label = pattern::wrap_type<opset7::Transpose>({pattern::any_input(pattern::has_static_rank()),
+                                                                    pattern::wrap_type<opset7::Constant>()});
+    auto eltwise_label = pattern::wrap_type<op::util::BinaryElementwiseArithmetic,
+                                            op::util::BinaryElementwiseComparison,
+                                            op::util::BinaryElementwiseLogical>({transpose_a_label, transpose_b_label});
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        const auto &pattern_to_output = m.get_pattern_value_map();
+        auto transpose_a = pattern_to_output.at(transpose_a_label).get_node_shared_ptr();
+        auto transpose_b = pattern_to_output.at(transpose_b_label).get_node_shared_ptr();
+        auto eltwise = pattern_to_output.at(eltwise_label).get_node_shared_ptr();
+
+        // the Transposes must go away with the eltwise, otherwise their number grows
+        const auto single_consumer = [&eltwise](const std::shared_ptr<Node>& transpose) {
+            for (const auto& consumer : transpose->output(0).get_target_inputs()) {
+                if (consumer.get_node() != eltwise.get())
+                    return false;
+            }
+            return true;
+        };
+        if (!single_consumer(transpose_a) || !single_consumer(transpose_b))
+            return false;
+
+        // Transposes of constants are left to ConstantFolding; TransposeEltwise moves them back otherwise
+        if (ov::is_type<opset7::Constant>(transpose_a->get_input_node_ptr(0)) ||
+            ov::is_type<opset7::Constant>(transpose_b->get_input_node_ptr(0)))
+            return false;
+
+        const auto order = get_transpose_order(transpose_a);
+        if (order.empty() || order != get_transpose_order(transpose_b))
+            return false;
+
+        // with equal ranks the broadcasting of the inputs does not depend on the order of their axes
+        const auto& input_a = transpose_a->input_value(0);
+        const auto& input_b = transpose_b->input_value(0);
+        if (input_a.get_partial_shape().rank().get_length() != static_cast<int64_t>(order.size()) ||
+            input_b.get_partial_shape().rank().get_length() != static_cast<int64_t>(order.size()))
+            return false;
+
+        auto new_eltwise = eltwise->clone_with_new_inputs({input_a, input_b});
+        auto new_transpose = transpose_a->clone_with_new_inputs({new_eltwise, transpose_a->input_value(1)});
+        register_new_node(new_transpose);
+
+        new_transpose->set_friendly_name(eltwise->get_friendly_name());
+        copy_runtime_info({transpose_a, transpose_b, eltwise}, {new_eltwise, new_transpose});
+        replace_node(eltwise, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(eltwise_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeConcat::TransposeConcat() {
+    MATCHER_SCOPE(TransposeConcat);
+
+    auto concat_label = pattern::wrap_type<opset7::Concat>(pattern::has_static_rank());
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        auto concat = std::dynamic_pointer_cast<opset7::Concat>(m.get_match_root());
+        if (!concat || concat->get_input_size() == 0)
+            return false;
+
+        std::vector<int64_t> order;
+        OutputVector new_inputs;
+        NodeVector transposes;
+        for (const auto& input : concat->input_values()) {
+            auto transpose = std::dynamic_pointer_cast<opset7::Transpose>(input.get_node_shared_ptr());
+            if (!transpose || transpose->output(0).get_target_inputs().size() != 1)
+                return false;
+            if (ov::is_type<opset7::Constant>(transpose->get_input_node_ptr(0)))
+                return false;
+            const auto transpose_order = get_transpose_order(transpose);
+            if (transpose_order.empty() || (!order.empty() && transpose_order != order))
+                return false;
+            order = transpose_order;
+            new_inputs.push_back(transpose->input_value(0));
+            transposes.push_back(transpose);
+        }
+
+        const auto rank = concat->get_output_partial_shape(0).rank();
+        if (rank.get_length() != static_cast<int64_t>(order.size()))
+            return false;
+        const auto axis = ngraph::normalize_axis(concat.get(), concat->get_axis(), rank);
+
+        auto new_concat = std::make_shared<opset7::Concat>(new_inputs, order[axis]);
+        auto new_transpose = transposes[0]->clone_with_new_inputs({new_concat, transposes[0]->input_value(1)});
+        register_new_node(new_transpose);
+
+        new_transpose->set_friendly_name(concat->get_friendly_name());
+        transposes.push_back(concat);
+        copy_runtime_info(transposes, {new_concat, new_transpose});
+        replace_node(concat, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(concat_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeSplit::TransposeSplit() {
+    MATCHER_SCOPE(TransposeSplit);
+
+    auto transpose_label = pattern::wrap_type<opset7::Transpose>({pattern::any_input(pattern::has_static_rank()),
+                                                                  pattern::wrap_type<opset7::Constant>()},
+                                                                  pattern::consumers_count(1));
+    auto split_label = pattern::wrap_type<opset7::Split>({transpose_label, pattern::wrap_type<opset7::Constant>()});
+    auto variadic_split_label = pattern::wrap_type<opset7::VariadicSplit>({transpose_label,
+                                                                           pattern::wrap_type<opset7::Constant>(),
+                                                                           pattern::any_input()});
+    auto split_or_variadic_split = std::make_shared<pattern::op::Or>(OutputVector{split_label, variadic_split_label});
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        const auto &pattern_to_output = m.get_pattern_value_map();
+        auto transpose = pattern_to_output.at(transpose_label).get_node_shared_ptr();
+        auto split = m.get_match_root();
+
+        const auto order = get_transpose_order(transpose);
+        if (order.empty())
+            return false;
+
+        // each output gets a Transpose after sinking, so it is only profitable when they fuse with the existing ones
+        for (const auto& output : split->outputs()) {
+            const auto& consumers = output.get_target_inputs();
+            if (consumers.size() != 1)
+                return false;
+            auto consumer = consumers.begin()->get_node();
+            if (!ov::is_type<opset7::Transpose>(consumer) ||
+                !ov::is_type<opset7::Constant>(consumer->get_input_node_ptr(1)))
+                return false;
+        }
+
+        auto axis_const = std::dynamic_pointer_cast<opset7::Constant>(split->get_input_node_shared_ptr(1));
+        const auto rank = transpose->get_input_partial_shape(0).rank();
+        if (!axis_const || ov::shape_size(axis_const->get_shape()) != 1 ||
+            rank.get_length() != static_cast<int64_t>(order.size()))
+            return false;
+        const auto axis = ngraph::normalize_axis(split.get(), axis_const->cast_vector<int64_t>()[0], rank);
+
+        auto new_axis = opset7::Constant::create(axis_const->get_element_type(), {}, {order[axis]});
+        OutputVector new_split_inputs = split->input_values();
+        new_split_inputs[0] = transpose->input_value(0);
+        new_split_inputs[1] = new_axis;
+        auto new_split = split->clone_with_new_inputs(new_split_inputs);
+        new_split->set_friendly_name(split->get_friendly_name());
+
+        NodeVector new_ops{new_axis, new_split};
+        for (size_t i = 0; i < split->get_output_size(); ++i) {
+            auto new_transpose = register_new_node<opset7::Transpose>(new_split->output(i), transpose->input_value(1));
+            new_ops.push_back(new_transpose);
+            split->output(i).replace(new_transpose->output(0));
+        }
+        copy_runtime_info({transpose, split}, new_ops);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(split_or_variadic_split, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory mapped files
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief The file content mapped into the process memory.
+ * The mapping is private: the pages are shared with the page cache (and so with other processes mapping
+ * the same file) until they are written, the writes are never propagated to the file.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into the process memory.
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory, the mapping is released with the last reference
+ * @throws Exception if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char name specified into the process memory.
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory, the mapping is released with the last reference
+ * @throws Exception if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
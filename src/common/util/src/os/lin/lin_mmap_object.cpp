@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+namespace util {
+namespace {
+
+class MapHolder : public MappedMemory {
+public:
+    explicit MapHolder(const std::string& path) {
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw_error("Cannot open file", path);
+        }
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1) {
+            close(fd);
+            throw_error("Cannot get the size of file", path);
+        }
+        m_size = static_cast<size_t>(sb.st_size);
+
+        if (m_size > 0) {
+            // the file descriptor is not needed to keep the mapping alive
+            void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            const int mmap_errno = errno;
+            close(fd);
+            if (data == MAP_FAILED) {
+                errno = mmap_errno;
+                throw_error("Cannot map file", path);
+            }
+            m_data = static_cast<char*>(data);
+        } else {
+            close(fd);
+        }
+    }
+
+    ~MapHolder() override {
+        if (m_data) {
+            munmap(m_data, m_size);
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    static void throw_error(const char* message, const std::string& path) {
+        std::stringstream ss;
+        ss << message << " '" << path << "': " << std::strerror(errno);
+        throw std::runtime_error(ss.str());
+    }
+
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+}  // namespace
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    return std::make_shared<MapHolder>(path);
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(ov::util::wstring_to_string(path));
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+#include <windows.h>
+
+namespace ov {
+namespace util {
+namespace {
+
+class MapHolder : public MappedMemory {
+public:
+    // takes the ownership of the opened file handle, the path is used for the error messages only
+    MapHolder(HANDLE file, const std::string& path) : m_file(file) {
+        if (m_file == INVALID_HANDLE_VALUE) {
+            throw_error("Cannot open file", path);
+        }
+
+        LARGE_INTEGER file_size = {};
+        if (!GetFileSizeEx(m_file, &file_size)) {
+            release();
+            throw_error("Cannot get the size of file", path);
+        }
+        m_size = static_cast<size_t>(file_size.QuadPart);
+
+        if (m_size > 0) {
+            // the copy-on-write view shares the pages with the system file cache until they are written
+            m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            if (m_mapping == nullptr) {
+                release();
+                throw_error("Cannot create file mapping for", path);
+            }
+            m_data = static_cast<char*>(MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0));
+            if (m_data == nullptr) {
+                release();
+                throw_error("Cannot map file", path);
+            }
+        }
+    }
+
+    ~MapHolder() override {
+        release();
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    void release() noexcept {
+        if (m_data) {
+            UnmapViewOfFile(m_data);
+            m_data = nullptr;
+        }
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+            m_mapping = nullptr;
+        }
+        if (m_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_file);
+            m_file = INVALID_HANDLE_VALUE;
+        }
+    }
+
+    static void throw_error(const char* message, const std::string& path) {
+        std::stringstream ss;
+        ss << message << " '" << path << "', error code: " << GetLastError();
+        throw std::runtime_error(ss.str());
+    }
+
+    HANDLE m_file;
+    HANDLE m_mapping = nullptr;
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+}  // namespace
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    return std::make_shared<MapHolder>(file, path);
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    HANDLE file = CreateFileW(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    return std::make_shared<MapHolder>(file, ov::util::wstring_to_string(path));
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
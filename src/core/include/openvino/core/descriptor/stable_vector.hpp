@@ -0,0 +1,176 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace descriptor {
+/// \brief The vector of the descriptors of a node which keeps their addresses when it grows, the descriptors refer to
+/// each other by pointers. Unlike std::deque, it allocates only the descriptors it holds: the deque preallocates
+/// a block of hundreds of bytes, which is most of the memory of a node with a few inputs and outputs.
+template <typename T>
+class StableVector {
+public:
+    template <typename Value, typename BaseIterator>
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator() = default;
+        explicit Iterator(BaseIterator it) : m_it(it) {}
+
+        reference operator*() const {
+            return **m_it;
+        }
+        pointer operator->() const {
+            return m_it->get();
+        }
+        reference operator[](difference_type n) const {
+            return *m_it[n];
+        }
+        Iterator& operator++() {
+            ++m_it;
+            return *this;
+        }
+        Iterator operator++(int) {
+            return Iterator(m_it++);
+        }
+        Iterator& operator--() {
+            --m_it;
+            return *this;
+        }
+        Iterator operator--(int) {
+            return Iterator(m_it--);
+        }
+        Iterator& operator+=(difference_type n) {
+            m_it += n;
+            return *this;
+        }
+        Iterator& operator-=(difference_type n) {
+            m_it -= n;
+            return *this;
+        }
+        Iterator operator+(difference_type n) const {
+            return Iterator(m_it + n);
+        }
+        Iterator operator-(difference_type n) const {
+            return Iterator(m_it - n);
+        }
+        difference_type operator-(const Iterator& other) const {
+            return m_it - other.m_it;
+        }
+        bool operator==(const Iterator& other) const {
+            return m_it == other.m_it;
+        }
+        bool operator!=(const Iterator& other) const {
+            return m_it != other.m_it;
+        }
+        bool operator<(const Iterator& other) const {
+            return m_it < other.m_it;
+        }
+
+    private:
+        BaseIterator m_it;
+    };
+
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<T, typename std::vector<std::unique_ptr<T>>::const_iterator>;
+    using const_iterator = Iterator<const T, typename std::vector<std::unique_ptr<T>>::const_iterator>;
+
+    StableVector() = default;
+    StableVector(StableVector&&) = default;
+    StableVector& operator=(StableVector&&) = default;
+
+    StableVector(const StableVector& other) {
+        *this = other;
+    }
+
+    StableVector& operator=(const StableVector& other) {
+        if (this != &other) {
+            std::vector<std::unique_ptr<T>> elements;
+            elements.reserve(other.m_elements.size());
+            for (const auto& element : other.m_elements) {
+                elements.emplace_back(new T(*element));
+            }
+            m_elements = std::move(elements);
+        }
+        return *this;
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        m_elements.emplace_back(new T(std::forward<Args>(args)...));
+        return *m_elements.back();
+    }
+
+    void clear() noexcept {
+        m_elements.clear();
+    }
+
+    size_type size() const noexcept {
+        return m_elements.size();
+    }
+
+    bool empty() const noexcept {
+        return m_elements.empty();
+    }
+
+    reference operator[](size_type i) {
+        return *m_elements[i];
+    }
+
+    const_reference operator[](size_type i) const {
+        return *m_elements[i];
+    }
+
+    reference at(size_type i) {
+        return *m_elements.at(i);
+    }
+
+    const_reference at(size_type i) const {
+        return *m_elements.at(i);
+    }
+
+    reference back() {
+        return *m_elements.back();
+    }
+
+    const_reference back() const {
+        return *m_elements.back();
+    }
+
+    iterator begin() noexcept {
+        return iterator(m_elements.cbegin());
+    }
+
+    iterator end() noexcept {
+        return iterator(m_elements.cend());
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(m_elements.cbegin());
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(m_elements.cend());
+    }
+
+private:
+    std::vector<std::unique_ptr<T>> m_elements;
+};
+}  // namespace descriptor
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
 
@@ -54,7 +55,7 @@ public:
         } else {
             write_values(values);
         }
-        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+        update_identical_flags(false, false);
     }
 
     /// \brief Create uninitialized constant
@@ -68,7 +69,7 @@ public:
     template <class T, class = typename std::enable_if<std::is_fundamental<T>::value>::type>
     Constant(const element::Type& type, const Shape& shape, T value) : Constant(type, shape) {
         fill_data(type, value);
-        m_all_elements_bitwise_identical = true;
+        update_identical_flags(true, true);
     }
 
     template <typename T>
@@ -372,6 +373,10 @@ public:
     }
 
     bool get_all_data_elements_bitwise_identical() const {
+        // checked on the first call, so reading a model does not touch the weights it maps from the file
+        if (!m_all_elements_bitwise_identical_checked) {
+            update_identical_flags(true, are_all_data_elements_bitwise_identical());
+        }
         return m_all_elements_bitwise_identical;
     }
     std::string convert_value_to_string(size_t index) const;
@@ -709,7 +714,13 @@ private:
     element::Type m_element_type;
     Shape m_shape{};
     std::shared_ptr<ngraph::runtime::AlignedBuffer> m_data;
-    bool m_all_elements_bitwise_identical;
+    void update_identical_flags(bool is_checked, bool identical_value) const {
+        m_all_elements_bitwise_identical = identical_value;
+        m_all_elements_bitwise_identical_checked = is_checked;
+    }
+
+    mutable std::atomic_bool m_all_elements_bitwise_identical{false};
+    mutable std::atomic_bool m_all_elements_bitwise_identical_checked{false};
     bool m_alloc_buffer_on_visit_attributes = true;
 };
 }  // namespace v0
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -13,17 +15,35 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *        The independent nodes with large constant inputs are evaluated in parallel, and the
+ *        folded nodes are released as soon as the graph is folded past them.
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
+    /**
+     * @brief The statistics of all the runs of the pass
+     */
+    struct Statistics {
+        size_t folded_nodes = 0;            //!< The nodes replaced with the constants
+        size_t folded_bytes = 0;            //!< The bytes of the constants the nodes are replaced with
+        std::chrono::microseconds time{0};  //!< The wall time of the runs
+    };
+
     OPENVINO_RTTI("ConstantFolding");
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 
+    const Statistics& get_statistics() const {
+        return m_statistics;
+    }
+
 private:
+    bool fold_model(const std::shared_ptr<ov::Model>& f);
     void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node, const Output<Node>& replacement);
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& f);
+
+    Statistics m_statistics;
 };
 
 OPENVINO_API void disable_constant_folding(const std::shared_ptr<Node>& node);
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -14,6 +16,22 @@
 
 namespace ov {
 namespace pass {
+/// \brief The profile of the pass executed by pass::Manager
+struct PassProfile {
+    /// \brief The name of the pass
+    std::string name;
+    /// \brief The wall time of the pass
+    std::chrono::microseconds wall_time{0};
+    /// \brief The nodes the pass visited, they are counted by GraphRewrite and NodePass based passes only
+    size_t nodes_visited = 0;
+    /// \brief The rewrites the pass applied: the matcher passes or the node passes which returned true
+    size_t rewrites_applied = 0;
+    /// \brief The peak of the tensor data allocated by the core during the pass (e.g. for the folded constants),
+    /// over the bytes allocated when the pass started. The allocations are process-wide, so the passes running
+    /// concurrently are included.
+    size_t peak_allocated_bytes = 0;
+};
+
 class OPENVINO_API Manager {
 public:
     Manager();
@@ -57,6 +75,17 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable collecting the profile of each executed pass
+    /// \param new_state Value "true" enables the profiling; "false", otherwise
+    void set_per_pass_profiling(bool new_state);
+
+    /// \return The profiles of the passes executed by the last run_passes() call with the profiling enabled, in
+    /// order of the execution. The nested passes (e.g. the ones run by a GraphRewrite or by another Manager) are
+    /// accounted to the outer pass.
+    const std::vector<PassProfile>& get_profile() const {
+        return m_profile;
+    }
+
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations based on some conditions. In some cases plugins may want not to
@@ -110,6 +139,8 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_per_pass_profiling = false;
+    std::vector<PassProfile> m_profile;
 };
 }  // namespace pass
 }  // namespace ov
@@ -147,6 +147,13 @@ public:
      * @return `true` if current Allocator object is initialized, `false` - otherwise
      */
     explicit operator bool() const noexcept;
+
+    /**
+     * @brief Sets the implementation used by the default constructed Allocator objects, e.g. by the Tensors created
+     * without an allocator. The allocators constructed before keep their implementation.
+     * @param impl The implementation to use, `nullptr` restores the default based on `new` `delete` c++ calls
+     */
+    static void set_default(const AllocatorImpl::Ptr& impl);
 };
 }  // namespace runtime
 }  // namespace ov
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides the pooled Allocator implementation
+ *
+ * @file openvino/runtime/pooled_allocator.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "openvino/core/core_visibility.hpp"
+#include "openvino/runtime/allocator.hpp"
+
+namespace ov {
+namespace runtime {
+
+/**
+ * @brief The allocator which keeps the released buffers to reuse them for the next allocations of the same size class
+ *
+ * The sizes are rounded up to the size classes, four per a power of two, so a buffer wastes at most a quarter of its
+ * size. The released buffers are cached by the releasing thread first and are moved to the pool shared by all the
+ * threads when the thread cache is full. The buffers above the maximum pooled size and the ones with the alignment
+ * above 64 bytes are allocated and released directly.
+ */
+class OPENVINO_API PooledAllocator : public AllocatorImpl {
+public:
+    /**
+     * @brief The limits of the pool
+     */
+    struct Config {
+        /// @brief The maximum size of the pooled buffer, the larger ones aren't cached
+        size_t max_pooled_size = size_t{1} << 30;
+        /// @brief The maximum bytes cached by the shared pool, the buffers above it are released to the system
+        size_t max_cached_bytes = size_t{512} << 20;
+        /// @brief The maximum bytes cached by a thread, 0 disables the thread caches
+        size_t thread_cache_bytes = size_t{32} << 20;
+    };
+
+    /**
+     * @brief The statistics of the allocator
+     */
+    struct Statistics {
+        /// @brief The bytes requested by the buffers allocated at the moment
+        size_t live_bytes;
+        /// @brief The maximum of the live bytes since the creation or the last reset_peak()
+        size_t peak_live_bytes;
+        /// @brief The bytes of the released buffers cached by the pool and the thread caches
+        size_t cached_bytes;
+        /// @brief The number of the allocations served from the cached buffers
+        size_t reused_allocations;
+        /// @brief The number of the allocations requested from the system
+        size_t system_allocations;
+    };
+
+    /// @brief Constructs the allocator with the default limits
+    PooledAllocator();
+
+    /**
+     * @brief Constructs the allocator
+     * @param config The limits of the pool
+     */
+    explicit PooledAllocator(const Config& config);
+
+    PooledAllocator(const PooledAllocator&) = delete;
+    PooledAllocator& operator=(const PooledAllocator&) = delete;
+
+    /// @brief Releases the cached buffers, the thread caches of the other threads are released by their next use
+    /// or the thread exit
+    ~PooledAllocator();
+
+    /**
+     * @brief Allocates memory
+     *
+     * @param bytes The size in bytes at least to allocate
+     * @param alignment The alignment of storage, should be a power of two
+     * @return Handle to the allocated resource
+     * @throw Exception if the alignment is not a power of two or the system can't allocate the memory
+     */
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t)) override;
+
+    /**
+     * @brief Returns the buffer to the cache. The size and the alignment are stored by the buffer, so they may be
+     * omitted.
+     * @param handle The handle to free
+     * @param bytes The size in bytes that was passed into allocate() method or 0
+     * @param alignment The alignment of storage that was passed into allocate() method
+     */
+    void deallocate(void* handle, const size_t bytes = 0, size_t alignment = alignof(max_align_t)) override;
+
+    /**
+     * @brief Compares with other AllocatorImpl
+     * @param other Other instance of allocator
+     * @return `true` if other is the same PooledAllocator
+     */
+    bool is_equal(const AllocatorImpl& other) const override;
+
+    /**
+     * @brief Gets the statistics of the allocator
+     * @return The statistics at the moment
+     */
+    Statistics get_statistics() const;
+
+    /**
+     * @brief Restarts the peak of the live bytes from the live bytes at the moment
+     */
+    void reset_peak();
+
+    /**
+     * @brief Releases the buffers cached by the shared pool and by the thread cache of the calling thread
+     */
+    void release_cached();
+
+private:
+    // The pool is shared with the thread caches, so it may outlive the allocator
+    struct Pool;
+    std::shared_ptr<Pool> _pool;
+};
+
+}  // namespace runtime
+}  // namespace ov
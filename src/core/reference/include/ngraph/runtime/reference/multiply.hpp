@@ -8,6 +8,7 @@
 
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph {
@@ -15,9 +16,11 @@ namespace runtime {
 namespace reference {
 template <typename T>
 void multiply(const T* arg0, const T* arg1, T* out, size_t count) {
-    for (size_t i = 0; i < count; i++) {
-        out[i] = arg0[i] * arg1[i];
-    }
+    parallel_for(count, parallel_min_bytes / sizeof(T), [arg0, arg1, out](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            out[i] = arg0[i] * arg1[i];
+        }
+    });
 }
 
 template <typename T>
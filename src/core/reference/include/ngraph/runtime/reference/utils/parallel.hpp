@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief The minimal number of bytes of the output a thread produces, so the tensors smaller than 2 MB are processed
+/// on the calling thread only.
+constexpr size_t parallel_min_bytes = 1 << 20;
+
+/// \brief Splits [0, work_amount) into the chunks of at least min_chunk items and calls func(begin, end) for each
+/// chunk on its own thread, the calling thread processes the first chunk.
+///
+/// \param work_amount The number of the items.
+/// \param min_chunk The minimal number of the items of a chunk.
+/// \param func The functor, it is called concurrently for the disjoint ranges. The first exception it throws is
+///             rethrown after all the chunks are processed.
+template <typename F>
+void parallel_for(size_t work_amount, size_t min_chunk, const F& func) {
+    static const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    const size_t threads = std::min(max_threads, work_amount / std::max<size_t>(min_chunk, 1));
+    if (threads < 2) {
+        if (work_amount != 0) {
+            func(size_t{0}, work_amount);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(threads);
+    auto run = [&](size_t chunk) {
+        const auto begin = work_amount / threads * chunk + std::min(chunk, work_amount % threads);
+        const auto end = begin + work_amount / threads + (chunk < work_amount % threads ? 1 : 0);
+        try {
+            func(begin, end);
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    size_t chunk = 1;
+    try {
+        for (; chunk < threads; ++chunk) {
+            workers.emplace_back(run, chunk);
+        }
+    } catch (const std::system_error&) {
+        // the chunks of the threads which could not be started are processed by the calling thread below
+    }
+    for (size_t i = chunk; i < threads; ++i) {
+        run(i);
+    }
+    run(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
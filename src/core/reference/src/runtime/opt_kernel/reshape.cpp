@@ -9,6 +9,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
@@ -214,7 +215,10 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size) {
     if (no_axis_reordering(in_axis_order)) {
-        std::memcpy(out, in, shape_size(in_shape) * elem_size);
+        const auto size = shape_size(in_shape) * elem_size;
+        reference::parallel_for(size, reference::parallel_min_bytes, [&](size_t begin, size_t end) {
+            std::memcpy(out + begin, in + begin, end - begin);
+        });
         return;
     }
 
@@ -4,8 +4,11 @@
 
 #include "ngraph/runtime/reference/concat.hpp"
 
+#include <algorithm>
 #include <cstring>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
@@ -32,18 +35,24 @@ void concat(const std::vector<const char*>& args,
     }
 
     const auto& shape_sizes = calculate_shape_sizes(in_shapes);
+    const size_t step_size = shape_size(out_shape) / std::max<size_t>(steps, 1);
+    if (step_size == 0) {
+        return;
+    }
 
-    size_t out_offset = 0;
-    for (size_t step = 0; step < steps; ++step) {
-        for (size_t in_index = 0; in_index < args.size(); ++in_index) {
-            const size_t size = shape_sizes[in_index] / steps;
-            const size_t in_offset = step * size;
+    parallel_for(steps, parallel_min_bytes / (step_size * elem_size) + 1, [&](size_t begin, size_t end) {
+        size_t out_offset = begin * step_size;
+        for (size_t step = begin; step < end; ++step) {
+            for (size_t in_index = 0; in_index < args.size(); ++in_index) {
+                const size_t size = shape_sizes[in_index] / steps;
+                const size_t in_offset = step * size;
 
-            std::memcpy(&out[out_offset * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
+                std::memcpy(&out[out_offset * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
 
-            out_offset += size;
+                out_offset += size;
+            }
         }
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
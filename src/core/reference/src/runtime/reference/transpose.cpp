@@ -6,25 +6,134 @@
 
 #include <cfenv>
 #include <cmath>
+#include <cstring>
 #include <numeric>
 #include <vector>
 
-#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+namespace {
+struct Dimension {
+    size_t size;
+    size_t in_stride;
+};
+
+// the dimensions of the output with the strides of the input in bytes, the ones of size 1 are dropped and the
+// neighbours which stay neighbours in the input are merged
+std::vector<Dimension> get_transposed_dimensions(const Shape& data_shape,
+                                                 size_t element_size,
+                                                 const int64_t* axes_order) {
+    const auto rank = data_shape.size();
+    std::vector<size_t> in_strides(rank);
+    size_t stride = element_size;
+    for (size_t i = rank; i > 0; --i) {
+        in_strides[i - 1] = stride;
+        stride *= data_shape[i - 1];
+    }
+
+    std::vector<Dimension> dimensions;
+    for (size_t i = 0; i < rank; ++i) {
+        const Dimension dimension{data_shape[axes_order[i]], in_strides[axes_order[i]]};
+        if (dimension.size == 1) {
+            continue;
+        }
+        if (!dimensions.empty() && dimensions.back().in_stride == dimension.in_stride * dimension.size) {
+            dimensions.back().size *= dimension.size;
+            dimensions.back().in_stride = dimension.in_stride;
+        } else {
+            dimensions.push_back(dimension);
+        }
+    }
+    return dimensions;
+}
+
+template <typename T>
+void copy_strided(const char* in, char* out, size_t count, size_t in_stride) {
+    auto dst = reinterpret_cast<T*>(out);
+    for (size_t i = 0; i < count; ++i, in += in_stride) {
+        std::memcpy(dst + i, in, sizeof(T));
+    }
+}
+
+void copy_strided(const char* in, char* out, size_t count, size_t in_stride, size_t element_size) {
+    switch (element_size) {
+    case 1:
+        copy_strided<uint8_t>(in, out, count, in_stride);
+        break;
+    case 2:
+        copy_strided<uint16_t>(in, out, count, in_stride);
+        break;
+    case 4:
+        copy_strided<uint32_t>(in, out, count, in_stride);
+        break;
+    case 8:
+        copy_strided<uint64_t>(in, out, count, in_stride);
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i, in += in_stride, out += element_size) {
+            std::memcpy(out, in, element_size);
+        }
+        break;
+    }
+}
+}  // namespace
+
 void transpose(const char* data,
                char* out,
                const Shape& data_shape,
                size_t element_size,
                const int64_t* axes_order,
                Shape out_shape) {
-    // To reuse opt_kernel::reshape axes order vector has to be converted to AxisVector
     // Negative axes are not supported, it is validated by transpose evaluate method
-    std::vector<size_t> axis_vector(axes_order, axes_order + data_shape.size());
-    runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+    const auto dimensions = get_transposed_dimensions(data_shape, element_size, axes_order);
+    const auto size = shape_size(data_shape) * element_size;
+    if (size == 0) {
+        return;
+    }
+    if (dimensions.empty() || (dimensions.size() == 1 && dimensions.back().in_stride == element_size)) {
+        parallel_for(size, parallel_min_bytes, [&](size_t begin, size_t end) {
+            std::memcpy(out + begin, data + begin, end - begin);
+        });
+        return;
+    }
+
+    // the rows of the output are the copies of the input rows when the last axis stays in place, each row is
+    // gathered with the stride of the input otherwise
+    const auto& row = dimensions.back();
+    const bool contiguous_rows = row.in_stride == element_size;
+    const auto row_bytes = row.size * element_size;
+    const auto rows = size / row_bytes;
+    const auto outer_rank = dimensions.size() - 1;
+    parallel_for(rows, parallel_min_bytes / row_bytes + 1, [&](size_t begin, size_t end) {
+        // the coordinate of the first row of the chunk
+        std::vector<size_t> coordinate(outer_rank);
+        const char* in = data;
+        for (size_t i = outer_rank, index = begin; i > 0; --i) {
+            coordinate[i - 1] = index % dimensions[i - 1].size;
+            index /= dimensions[i - 1].size;
+            in += coordinate[i - 1] * dimensions[i - 1].in_stride;
+        }
+        for (size_t r = begin; r < end; ++r) {
+            char* dst = out + r * row_bytes;
+            if (contiguous_rows) {
+                std::memcpy(dst, in, row_bytes);
+            } else {
+                copy_strided(in, dst, row.size, row.in_stride, element_size);
+            }
+            for (size_t i = outer_rank; i > 0; --i) {
+                in += dimensions[i - 1].in_stride;
+                if (++coordinate[i - 1] < dimensions[i - 1].size) {
+                    break;
+                }
+                coordinate[i - 1] = 0;
+                in -= dimensions[i - 1].size * dimensions[i - 1].in_stride;
+            }
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -213,10 +213,10 @@ bool ngraph::is_post_dominated(Node* X, Node* Y) {
     return true;
 }
 
-std::vector<std::shared_ptr<ngraph::Node>> ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes,
-                                                               NodeMap& node_map) {
-    // for each node in topological order
-    auto sorted_nodes = topological_sort(nodes);
+namespace {
+// clones the nodes which are already in topological order
+void clone_ordered_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& sorted_nodes, ngraph::NodeMap& node_map) {
+    using namespace ngraph;
     for (const auto& node : sorted_nodes) {
         if (node_map.count(node.get()) == 0) {
             // get (already) cloned arguments and clone the node
@@ -236,8 +236,7 @@ std::vector<std::shared_ptr<ngraph::Node>> ngraph::clone_nodes(const std::vector
             auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
             // There is a friendly name for this node so copy it
             cloned_node->set_friendly_name(node->get_friendly_name());
-            auto rt_info = node->get_rt_info();
-            cloned_node->get_rt_info() = rt_info;
+            cloned_node->get_rt_info() = node->get_rt_info();
 
             for (auto output : node->outputs()) {
                 const auto& output_rt_info = output.get_rt_info();
@@ -250,6 +249,13 @@ std::vector<std::shared_ptr<ngraph::Node>> ngraph::clone_nodes(const std::vector
             node_map[node.get()] = cloned_node;
         }
     }
+}
+}  // namespace
+
+std::vector<std::shared_ptr<ngraph::Node>> ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes,
+                                                               NodeMap& node_map) {
+    // for each node in topological order
+    clone_ordered_nodes(topological_sort(nodes), node_map);
 
     // create and return vector of cloned nodes
     // order matches input vector (not necessarily topological)
@@ -311,8 +317,9 @@ std::shared_ptr<ov::Model> ov::clone_model(const ov::Model& func) {
 }
 
 std::shared_ptr<ov::Model> ov::clone_model(const ov::Model& func, ngraph::NodeMap& node_map) {
-    // clone model operations
-    ngraph::clone_nodes(func.get_ops(), node_map);
+    // clone model operations, the cached topological order of the model saves the traversal and the sort.
+    // Constant data buffers are not copied: the cloned constants share them with the original ones
+    clone_ordered_nodes(func.get_ordered_ops(), node_map);
 
     // clone variables
     auto variables = func.get_variables();
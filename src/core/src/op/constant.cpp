@@ -48,7 +48,7 @@ ov::op::v0::Constant::Constant(const shared_ptr<ngraph::runtime::Tensor>& tensor
         constructor_validate_and_infer_types();
         allocate_buffer();
         tensor->read(get_data_ptr_nc(), tensor->get_size_in_bytes());
-        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+        update_identical_flags(false, false);
     }
     constructor_validate_and_infer_types();
 }
@@ -126,7 +126,7 @@ ov::op::v0::Constant::Constant(const element::Type& type,
         case Type_t::dynamic:
             throw std::runtime_error("deserialize unsupported type dynamic");
         }
-        m_all_elements_bitwise_identical = true;
+        update_identical_flags(true, true);
     } else {
         switch (m_element_type) {
         case Type_t::boolean:
@@ -182,7 +182,7 @@ ov::op::v0::Constant::Constant(const element::Type& type,
         case Type_t::dynamic:
             throw std::runtime_error("deserialize unsupported type dynamic");
         }
-        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+        update_identical_flags(false, false);
     }
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
@@ -203,14 +203,14 @@ ov::op::v0::Constant::Constant(const element::Type& type, const ov::Shape& shape
     : Constant(type, shape) {
     size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
     std::memcpy(get_data_ptr_nc(), data, size);
-    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+    update_identical_flags(false, false);
 }
 
 ov::op::v0::Constant::Constant(const Constant& other) {
     m_element_type = other.m_element_type;
     m_shape = other.m_shape;
     m_data = other.m_data;
-    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    update_identical_flags(other.m_all_elements_bitwise_identical_checked, other.m_all_elements_bitwise_identical);
     constructor_validate_and_infer_types();
 }
 
@@ -221,7 +221,7 @@ ov::op::v0::Constant::Constant(const Constant& other, const ov::Shape& new_shape
     m_element_type = other.m_element_type;
     m_shape = new_shape;
     m_data = other.m_data;
-    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    update_identical_flags(other.m_all_elements_bitwise_identical_checked, other.m_all_elements_bitwise_identical);
     constructor_validate_and_infer_types();
 }
 
@@ -540,7 +540,7 @@ bool ov::op::v0::Constant::visit_attributes(AttributeVisitor& visitor) {
         allocate_buffer();
     }
     visitor.on_attribute("value", m_data);
-    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+    update_identical_flags(false, false);
     return true;
 }
 
@@ -4,54 +4,219 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
 #include <ngraph/op/constant.hpp>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 #include "ngraph/validation_util.hpp"
+#include "perf_counters.hpp"
 
 using namespace std;
 
+namespace {
+// The nodes of the same level of the graph don't depend on each other, so they can be folded in parallel
+std::vector<ov::NodeVector> get_levels(const std::shared_ptr<ov::Model>& f) {
+    std::vector<ov::NodeVector> levels;
+    std::unordered_map<ov::Node*, size_t> level_of;
+    for (auto& node : f->get_ordered_ops()) {
+        size_t level = 0;
+        for (const auto& input : node->input_values()) {
+            level = std::max(level, level_of[input.get_node()] + 1);
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            level = std::max(level, level_of[dependency.get()] + 1);
+        }
+        level_of[node.get()] = level;
+        if (levels.size() <= level) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(std::move(node));
+    }
+    return levels;
+}
+
+// Splits the nodes to the groups of their indices which don't share the inputs: folding may create the nodes
+// consuming the inputs (e.g. ConvertLike), so the nodes sharing an input are folded by the same thread
+std::vector<std::vector<size_t>> get_independent_groups(const ov::NodeVector& nodes) {
+    std::vector<size_t> parent(nodes.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    std::function<size_t(size_t)> find_root = [&](size_t i) {
+        return parent[i] == i ? i : parent[i] = find_root(parent[i]);
+    };
+    std::unordered_map<ov::Node*, size_t> consumer_of;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        for (const auto& input : nodes[i]->input_values()) {
+            auto consumer = consumer_of.emplace(input.get_node(), i);
+            if (!consumer.second) {
+                parent[find_root(i)] = find_root(consumer.first->second);
+            }
+        }
+    }
+    std::vector<std::vector<size_t>> groups;
+    std::unordered_map<size_t, size_t> group_of;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        auto group = group_of.emplace(find_root(i), groups.size());
+        if (group.second) {
+            groups.emplace_back();
+        }
+        groups[group.first->second].push_back(i);
+    }
+    return groups;
+}
+
+size_t get_constant_inputs_bytes(const ov::NodeVector& nodes, const std::vector<size_t>& group) {
+    size_t bytes = 0;
+    for (auto i : group) {
+        for (const auto& input : nodes[i]->input_values()) {
+            if (auto constant = ov::as_type<ngraph::op::Constant>(input.get_node())) {
+                bytes += constant->get_byte_size();
+            }
+        }
+    }
+    return bytes;
+}
+
+// The folding of the smaller groups is not worth a thread
+constexpr size_t parallel_folding_min_bytes = 1 << 16;
+
+struct FoldingResult {
+    bool folded = false;
+    ov::OutputVector replacements;
+};
+
+FoldingResult fold(const std::shared_ptr<ov::Node>& node) {
+    FoldingResult result;
+    result.replacements.resize(node->get_output_size());
+    result.folded = node->constant_fold(result.replacements, node->input_values());
+    return result;
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    const auto start = std::chrono::steady_clock::now();
+    bool rewritten = fold_model(f);
+    m_statistics.time +=
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::fold_model(const std::shared_ptr<ov::Model>& f) {
     bool rewritten = pre_calculated_values_folding(f);
 
-    for (const auto& node : f->get_ordered_ops()) {
+    auto& work_counters = pass_work_counters();
+    // the nodes are released level by level, so the folded nodes and the constants they consumed are freed while the
+    // rest of the graph is folded
+    auto levels = get_levels(f);
+    for (auto& level : levels) {
         if (rewritten) {
-            node->validate_and_infer_types();
+            for (const auto& node : level) {
+                node->validate_and_infer_types();
+            }
         }
+        work_counters.nodes_visited += level.size();
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
+        std::vector<FoldingResult> results(level.size());
+        auto fold_group = [&](const std::vector<size_t>& group) {
+            for (auto i : group) {
+                results[i] = fold(level[i]);
+            }
+        };
+        std::vector<std::vector<size_t>> parallel_groups;
+        for (auto& group : get_independent_groups(level)) {
+            if (get_constant_inputs_bytes(level, group) >= parallel_folding_min_bytes) {
+                parallel_groups.push_back(std::move(group));
+            } else {
+                fold_group(group);
+            }
+        }
+        if (parallel_groups.size() == 1) {
+            fold_group(parallel_groups.front());
+        } else if (!parallel_groups.empty()) {
+            std::atomic<size_t> next_group{0};
+            auto fold_groups = [&] {
+                for (auto group = next_group++; group < parallel_groups.size(); group = next_group++) {
+                    fold_group(parallel_groups[group]);
+                }
+            };
+            const size_t threads_num =
+                std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), parallel_groups.size());
+            std::vector<std::future<void>> workers;
+            for (size_t i = 1; i < threads_num; ++i) {
+                workers.push_back(std::async(std::launch::async, fold_groups));
+            }
+            std::exception_ptr error;
+            try {
+                fold_groups();
+            } catch (...) {
+                error = std::current_exception();
+                // stop the other threads at their current group
+                next_group = parallel_groups.size();
+            }
+            for (auto& worker : workers) {
+                try {
+                    worker.get();
+                } catch (...) {
+                    if (!error) {
+                        error = std::current_exception();
                     }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
+                    next_group = parallel_groups.size();
                 }
             }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(sub_graph_ind));
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        for (size_t node_index = 0; node_index < level.size(); ++node_index) {
+            const auto& node = level[node_index];
+            auto& result = results[node_index];
+            if (result.folded) {
+                auto& replacements = result.replacements;
+                NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             node);
+
+                for (size_t i = 0; i < replacements.size(); ++i) {
+                    auto node_output = node->output(i);
+                    auto replacement = replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                        if (replacements.size() == 1) {
+                            replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+                        } else {
+                            replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                                 std::to_string(i));
+                        }
+                        node_output.replace(replacement);
+                        // Propagate runtime info attributes to replacement consumer nodes
+                        copy_runtime_info_to_target_inputs(node, replacement);
+
+                        if (auto constant = ov::as_type<ngraph::op::Constant>(replacement.get_node())) {
+                            m_statistics.folded_bytes += constant->get_byte_size();
+                        }
+                        rewritten = true;
+                    }
+                }
+                ++m_statistics.folded_nodes;
+                ++work_counters.rewrites;
+            } else {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
+                    size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                    for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                        rewritten |= fold_model(sub_graph_node->get_function(sub_graph_ind));
+                    }
                 }
             }
         }
+        level.clear();
     }
 
     return rewritten;
@@ -16,6 +16,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -57,6 +58,36 @@ PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
+
+// Collects the types of the nodes which the pattern root can match, returns false if the root can match a node of
+// any type
+bool collect_root_types(const std::shared_ptr<Node>& root, std::vector<DiscreteTypeInfo>& types) {
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to gen actual root node we need to take it's parent.
+    if (auto any_output = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
+        return collect_root_types(any_output->input_value(0).get_node_shared_ptr(), types);
+    }
+    if (auto wrap_type = std::dynamic_pointer_cast<pattern::op::WrapType>(root)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        types.insert(types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    // a node matched by Or is matched by one of its alternatives
+    if (ov::is_type<pattern::op::Or>(root)) {
+        for (const auto& alternative : root->input_values()) {
+            if (!collect_root_types(alternative.get_node_shared_ptr(), types)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    // the other patterns (e.g. pattern::op::Label) have predicates which can match any type
+    if (std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
+        return false;
+    }
+    types.push_back(root->get_type_info());
+    return true;
+}
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -86,8 +117,9 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers with a type based root node are dispatched by the node type, the rest of the Matchers (e.g. the ones
+    // rooted by pattern::op::Label or MatcherPasses without Matcher) are tried for every node
+    std::vector<size_t> any_type_matchers;
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
@@ -96,38 +128,44 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
+            any_type_matchers.push_back(matcher_index);
+            continue;
         }
 
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+        // if root is an operation from opset, has pattern::op::WrapType type or is pattern::op::Or of them then we
+        // can extract its types and use them in unordered_map as keys for fast MatcherPass search. Otherwise type is
+        // unknown and the matcher is tried for every node.
+        std::vector<DiscreteTypeInfo> root_types;
+        if (collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            for (const auto& root_type_info : root_types) {
+                type_to_matcher[root_type_info].push_back(matcher_index);
             }
         } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            any_type_matchers.push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // The complete list of matchers for the node type: the ones of the type, of its parents and of any type in order
+    // of the registration. It is collected once per type, when the first node of the type is processed.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> matchers_of_type;
+    auto get_matchers_of_type = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto cached = matchers_of_type.find(type_info);
+        if (cached != matchers_of_type.end()) {
+            return cached->second;
+        }
+        auto matchers = any_type_matchers;
+        for (auto node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto type_matchers = type_to_matcher.find(*node_type_info);
+            if (type_matchers != type_to_matcher.end()) {
+                matchers.insert(matchers.end(), type_matchers->second.begin(), type_matchers->second.end());
+            }
+        }
+        std::sort(matchers.begin(), matchers.end());
+        // WrapType may contain both the type and its parent
+        matchers.erase(std::unique(matchers.begin(), matchers.end()), matchers.end());
+        return matchers_of_type.emplace(type_info, std::move(matchers)).first->second;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -160,9 +198,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
+    auto& work_counters = pass_work_counters();
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -170,6 +206,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         auto node = weak_node.lock();
         if (!node)
             continue;
+        ++work_counters.nodes_visited;
 
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
@@ -183,47 +220,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers_of_type(node->get_type_info())) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                ++work_counters.rewrites;
+                break;
             }
         }
     }
@@ -22,6 +22,7 @@
 #include "ngraph/util.hpp"
 #include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
+#include "runtime/allocation_statistics.hpp"
 
 using namespace std;
 
@@ -32,6 +33,27 @@ PerfCounters& perf_counters() {
     static PerfCounters counters;
     return counters;
 }
+
+// Measures the peak of the allocated bytes during the pass and then continues the measurement of the outer pass
+class ScopedAllocationPeak {
+public:
+    ScopedAllocationPeak()
+        : m_allocated(ngraph::runtime::allocation_statistics::current()),
+          m_outer_peak(ngraph::runtime::allocation_statistics::restart_peak()) {}
+
+    ~ScopedAllocationPeak() {
+        ngraph::runtime::allocation_statistics::restore_peak(m_outer_peak);
+    }
+
+    size_t peak() const {
+        const auto peak = ngraph::runtime::allocation_statistics::peak();
+        return peak > m_allocated ? peak - m_allocated : 0;
+    }
+
+private:
+    size_t m_allocated;
+    size_t m_outer_peak;
+};
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -48,6 +70,10 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::set_per_pass_profiling(bool new_state) {
+    m_per_pass_profiling = new_state;
+}
+
 void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::Manager::run_passes");
@@ -59,6 +85,10 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     ngraph::stopwatch overall_timer;
     overall_timer.start();
     bool function_changed = false;
+    if (m_per_pass_profiling) {
+        m_profile.clear();
+    }
+    auto& work_counters = pass::pass_work_counters();
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -68,6 +98,11 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::nGraphPass_LT, pass::perf_counters()[pass->get_type_info()]);
 
         pass_timer.start();
+        const auto work_counters_before = work_counters;
+        std::unique_ptr<pass::ScopedAllocationPeak> allocation_peak;
+        if (m_per_pass_profiling) {
+            allocation_peak.reset(new pass::ScopedAllocationPeak);
+        }
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
@@ -104,7 +139,11 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 continue;
             }
             for (const shared_ptr<Node>& n : func->get_ops()) {
-                function_changed |= node_pass->run_on_node(n);
+                ++work_counters.nodes_visited;
+                if (node_pass->run_on_node(n)) {
+                    function_changed = true;
+                    ++work_counters.rewrites;
+                }
             }
         }
 
@@ -124,6 +163,15 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
         index++;
         pass_timer.stop();
+        if (m_per_pass_profiling) {
+            PassProfile profile;
+            profile.name = pass->get_name();
+            profile.wall_time = std::chrono::microseconds(pass_timer.get_microseconds());
+            profile.nodes_visited = work_counters.nodes_visited - work_counters_before.nodes_visited;
+            profile.rewrites_applied = work_counters.rewrites - work_counters_before.rewrites;
+            profile.peak_allocated_bytes = allocation_peak->peak();
+            m_profile.push_back(std::move(profile));
+        }
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
@@ -12,5 +12,10 @@ openvino::itt::handle_t PerfCounters::operator[](::ngraph::Node::type_info_t con
         return it->second;
     return m_counters[&type_inf] = openvino::itt::handle(type_inf.name);
 }
+
+PassWorkCounters& pass_work_counters() noexcept {
+    static thread_local PassWorkCounters counters;
+    return counters;
+}
 }  // namespace pass
 }  // namespace ov
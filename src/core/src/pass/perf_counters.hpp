@@ -26,5 +26,15 @@ private:
     std::mutex m_mutex;
     counters_map m_counters;
 };
+
+/// \brief The work done by the passes running on the thread, pass::Manager attributes the increments to the pass it
+/// runs. The nodes are counted by GraphRewrite and NodePass based passes only.
+struct PassWorkCounters {
+    size_t nodes_visited = 0;
+    size_t rewrites = 0;
+};
+
+/// \return The counters of the calling thread
+PassWorkCounters& pass_work_counters() noexcept;
 }  // namespace pass
 }  // namespace ov
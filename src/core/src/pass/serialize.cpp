@@ -62,17 +62,36 @@ std::string translate_type_name(const std::string& name) {
 
 size_t hash_combine(const void* v, int64_t size) {
     constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
+    // The data are hashed in the independent lanes, which are combined at the end: the lanes don't wait for each
+    // other, so the hash of the large constants is limited by the memory bandwidth rather than by the latency of
+    // the combination. The hash is used only to find the duplicate constants, so it doesn't have to be the same
+    // as the one of the single lane.
+    constexpr size_t lanes = 4;
+    size_t seeds[lanes] = {static_cast<size_t>(size), 0, 0, 0};
+    const auto data = static_cast<const char*>(v);
+    const auto cels = static_cast<size_t>(size) / cel_size;
     // The constant value used as a magic number has been
     // traditionally used e.g. in boost library's hash_combine.
     // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    size_t i = 0;
+    for (; i + lanes <= cels; i += lanes) {
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            size_t d;
+            std::memcpy(&d, data + (i + lane) * cel_size, cel_size);
+            seeds[lane] ^= d + 0x9e3779b9 + (seeds[lane] << 6) + (seeds[lane] >> 2);
+        }
+    }
+    auto seed = seeds[0];
+    for (size_t lane = 1; lane < lanes; ++lane) {
+        seed ^= seeds[lane] + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    for (; i < cels; ++i) {
+        size_t d;
+        std::memcpy(&d, data + i * cel_size, cel_size);
+        seed ^= d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     }
     size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
+    std::memcpy(&last_bytes, data + cels * cel_size, size % cel_size);
     seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     return seed;
 }
@@ -81,7 +100,6 @@ class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data),
@@ -95,25 +113,45 @@ public:
             m_binary_output.write(ptr, size);
             return offset;
         }
-        // This hash is weak (but efficient) and must be replace with some other
-        // more stable hash algorithm. For example current hash algorithms gives
-        // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
-        const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions) &&
-            memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
-            return found->second.first;
+        // Only the constants of the same size can be identical, so the constant is hashed only when the one of its
+        // size has been written: most of the weights have unique sizes, and they are read once, by the write.
+        auto& written = m_written_of_size[size];
+        if (written.unhashed.second != nullptr || !written.hashed.empty()) {
+            if (written.unhashed.second != nullptr) {
+                written.hashed.emplace(hash_combine(written.unhashed.second, size), written.unhashed);
+                written.unhashed = {};
+            }
+            // This hash is weak (but efficient) and must be replace with some other
+            // more stable hash algorithm. For example current hash algorithms gives
+            // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
+            // values when finding a match in hash map.
+            const HashValue hash = hash_combine(ptr, size);
+            const auto found = written.hashed.equal_range(hash);
+            for (auto it = found.first; it != found.second; ++it) {
+                if (memcmp(static_cast<void const*>(ptr), it->second.second, size) == 0) {
+                    return it->second.first;
+                }
+            }
+            m_binary_output.write(ptr, size);
+            written.hashed.emplace(hash, ConstWritePosition{offset, static_cast<void const*>(ptr)});
+        } else {
+            m_binary_output.write(ptr, size);
+            written.unhashed = {offset, static_cast<void const*>(ptr)};
         }
 
-        m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
-
         return offset;
     }
 
 private:
-    ConstWritePositions m_hash_to_file_positions;
+    using ConstWritePosition = std::pair<FilePosition, void const*>;
+
+    struct ConstWritePositions {
+        // the first constant of the size, it is hashed when the second one is written
+        ConstWritePosition unhashed{0, nullptr};
+        std::unordered_multimap<HashValue, ConstWritePosition> hashed;
+    };
+
+    std::unordered_map<size_t, ConstWritePositions> m_written_of_size;
     std::ostream& m_binary_output;
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
@@ -1054,7 +1092,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool compress_constants = true) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1075,7 +1114,7 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, compress_constants);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
@@ -1250,13 +1289,25 @@ public:
     }
 
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
+        constexpr auto cel_size = static_cast<std::streamsize>(sizeof(uint64_t));
+        std::streamsize n64 = n / cel_size;
         std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+        // Using 64-bit values executes much faster than char, the sum doesn't depend on the order of the values,
+        // so they are summed up in the independent accumulators, which the compiler can vectorize
+        uint64_t sums[4] = {0, 0, 0, 0};
+        for (; i + 4 <= n64; i += 4) {
+            for (std::streamsize lane = 0; lane < 4; ++lane) {
+                uint64_t value;
+                std::memcpy(&value, s + (i + lane) * cel_size, cel_size);
+                sums[lane] += value;
+            }
+        }
+        for (; i < n64; ++i) {
+            uint64_t value;
+            std::memcpy(&value, s + i * cel_size, cel_size);
+            sums[0] += value;
         }
+        m_res += sums[0] + sums[1] + sums[2] + sums[3];
 
         std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
         for (i = 0; i < rest; i++) {
@@ -1273,8 +1324,9 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     std::ostream xml(&xmlHash);
     std::ostream bin(&binHash);
 
-    // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    // Determinism is important for hash calculation. The duplicate constants are not looked for: it would read
+    // every constant once more to hash and compare it, while hashing the duplicate again costs the same.
+    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true, false);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "ngraph/util.hpp"
+#include "runtime/allocation_statistics.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -19,6 +20,7 @@ runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment) : m_by
     m_byte_size = std::max<size_t>(1, byte_size);
     size_t allocation_size = m_byte_size + alignment;
     m_allocated_buffer = static_cast<char*>(ngraph_malloc(allocation_size));
+    allocation_statistics::allocated(m_byte_size);
     m_aligned_buffer = m_allocated_buffer;
     size_t mod = (alignment != 0) ? size_t(m_aligned_buffer) % alignment : 0;
 
@@ -39,6 +41,7 @@ runtime::AlignedBuffer::AlignedBuffer(AlignedBuffer&& other)
 
 runtime::AlignedBuffer::~AlignedBuffer() {
     if (m_allocated_buffer != nullptr) {
+        allocation_statistics::deallocated(m_byte_size);
         free(m_allocated_buffer);
     }
 }
@@ -46,6 +49,7 @@ runtime::AlignedBuffer::~AlignedBuffer() {
 runtime::AlignedBuffer& runtime::AlignedBuffer::operator=(AlignedBuffer&& other) {
     if (this != &other) {
         if (m_allocated_buffer != nullptr) {
+            allocation_statistics::deallocated(m_byte_size);
             free(m_allocated_buffer);
         }
         m_allocated_buffer = other.m_allocated_buffer;
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "runtime/allocation_statistics.hpp"
+
+#include <atomic>
+
+namespace ngraph {
+namespace runtime {
+namespace allocation_statistics {
+namespace {
+std::atomic<size_t> current_bytes{0};
+std::atomic<size_t> peak_bytes{0};
+
+void update_peak(size_t value) noexcept {
+    auto peak = peak_bytes.load(std::memory_order_relaxed);
+    while (peak < value && !peak_bytes.compare_exchange_weak(peak, value, std::memory_order_relaxed)) {
+    }
+}
+}  // namespace
+
+void allocated(size_t size) noexcept {
+    update_peak(current_bytes.fetch_add(size, std::memory_order_relaxed) + size);
+}
+
+void deallocated(size_t size) noexcept {
+    current_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+size_t current() noexcept {
+    return current_bytes.load(std::memory_order_relaxed);
+}
+
+size_t peak() noexcept {
+    return peak_bytes.load(std::memory_order_relaxed);
+}
+
+size_t restart_peak() noexcept {
+    return peak_bytes.exchange(current_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void restore_peak(size_t peak) noexcept {
+    update_peak(peak);
+}
+}  // namespace allocation_statistics
+}  // namespace runtime
+}  // namespace ngraph
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ngraph {
+namespace runtime {
+/// \brief The process-wide statistics of the tensor data allocated by AlignedBuffer and HostTensor, e.g. by the
+/// constant folding. The data shared with the caller (e.g. the mapped weights) is not counted.
+namespace allocation_statistics {
+/// \brief Records the allocation of the size bytes
+void allocated(size_t size) noexcept;
+
+/// \brief Records the deallocation of the size bytes
+void deallocated(size_t size) noexcept;
+
+/// \return The bytes allocated at the moment
+size_t current() noexcept;
+
+/// \return The maximum of the bytes allocated since the last restart_peak()
+size_t peak() noexcept;
+
+/// \brief Restarts the peak from the bytes allocated at the moment
+/// \return The peak before the restart, pass it to restore_peak() to continue the outer measurement
+size_t restart_peak() noexcept;
+
+/// \brief Continues the measurement interrupted by restart_peak(): the peak becomes the maximum of the current and
+/// the returned one
+void restore_peak(size_t peak) noexcept;
+}  // namespace allocation_statistics
+}  // namespace runtime
+}  // namespace ngraph
@@ -4,6 +4,8 @@
 
 #include "openvino/runtime/allocator.hpp"
 
+#include <mutex>
+
 #include "blob_allocator.hpp"
 #include "ie_allocator.hpp"
 #include "ie_common.h"
@@ -12,7 +14,26 @@
 namespace ov {
 namespace runtime {
 
-Allocator::Allocator() : _impl{std::make_shared<BlobAllocator>()} {}
+namespace {
+std::mutex& default_impl_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+AllocatorImpl::Ptr& default_impl() {
+    static AllocatorImpl::Ptr impl;
+    return impl;
+}
+
+AllocatorImpl::Ptr get_default_impl() {
+    std::lock_guard<std::mutex> lock{default_impl_mutex()};
+    if (default_impl())
+        return default_impl();
+    return std::make_shared<BlobAllocator>();
+}
+}  // namespace
+
+Allocator::Allocator() : _impl{get_default_impl()} {}
 
 Allocator::~Allocator() {
     _impl = {};
@@ -61,5 +82,10 @@ Allocator::operator bool() const noexcept {
     return (!!_impl);
 }
 
+void Allocator::set_default(const AllocatorImpl::Ptr& impl) {
+    std::lock_guard<std::mutex> lock{default_impl_mutex()};
+    default_impl() = impl;
+}
+
 }  // namespace runtime
 }  // namespace ov
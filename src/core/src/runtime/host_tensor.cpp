@@ -9,6 +9,7 @@
 
 #include "ngraph/op/constant.hpp"
 #include "ngraph/util.hpp"
+#include "runtime/allocation_statistics.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -57,6 +58,7 @@ void runtime::HostTensor::allocate_buffer() {
         size_t allocation_size = m_buffer_size + alignment + 1;
         uint8_t* allocated_buffer_pool = static_cast<uint8_t*>(ngraph_malloc(allocation_size));
         m_allocated_buffer_pool = allocated_buffer_pool;
+        allocation_statistics::allocated(m_buffer_size);
         size_t mod = size_t(allocated_buffer_pool) % alignment;
         if (mod == 0) {
             m_aligned_buffer_pool = allocated_buffer_pool;
@@ -82,6 +84,7 @@ void runtime::HostTensor::initialize(const std::shared_ptr<op::v0::Constant>& co
 runtime::HostTensor::~HostTensor() {
     NGRAPH_SUPPRESS_DEPRECATED_START
     if (m_allocated_buffer_pool != nullptr) {
+        allocation_statistics::deallocated(m_buffer_size);
         ngraph_free(m_allocated_buffer_pool);
     }
     NGRAPH_SUPPRESS_DEPRECATED_END
@@ -0,0 +1,294 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/pooled_allocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace runtime {
+
+namespace {
+constexpr size_t block_alignment = 64;
+constexpr size_t min_class_size = 64;
+constexpr size_t direct_class = std::numeric_limits<size_t>::max();
+
+// Precedes the returned pointer, so the buffer is released without the size and the alignment from the caller
+struct BlockHeader {
+    size_t size_class;
+    size_t bytes;
+    size_t offset;
+};
+
+BlockHeader* header_of(void* handle) {
+    return reinterpret_cast<BlockHeader*>(handle) - 1;
+}
+
+// The first class is 64 bytes, then four classes per a power of two: 80, 96, 112, 128, 160, ...
+size_t size_class_of(size_t bytes) {
+    if (bytes <= min_class_size)
+        return 0;
+    size_t power = 6;
+    while ((size_t{1} << (power + 1)) < bytes)
+        ++power;
+    const size_t step = (size_t{1} << power) / 4;
+    const size_t k = (bytes - (size_t{1} << power) + step - 1) / step;
+    return (power - 6) * 4 + k;
+}
+
+size_t class_size(size_t size_class) {
+    if (size_class == 0)
+        return min_class_size;
+    const size_t power = 6 + (size_class - 1) / 4;
+    const size_t k = (size_class - 1) % 4 + 1;
+    return (size_t{1} << power) + k * ((size_t{1} << power) / 4);
+}
+
+void* allocate_block(size_t size, size_t alignment, size_t size_class) {
+    OPENVINO_ASSERT(size <= std::numeric_limits<size_t>::max() - alignment - sizeof(BlockHeader),
+                    "Can not allocate storage for at least ",
+                    size,
+                    " bytes");
+    auto raw = static_cast<char*>(::operator new(size + alignment + sizeof(BlockHeader), std::nothrow));
+    OPENVINO_ASSERT(raw != nullptr, "Can not allocate storage for at least ", size, " bytes");
+    const auto address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(BlockHeader);
+    const auto offset = static_cast<size_t>((address + alignment - 1) / alignment * alignment - address) +
+                        sizeof(BlockHeader);
+    void* handle = raw + offset;
+    *header_of(handle) = {size_class, 0, offset};
+    return handle;
+}
+
+void free_block(void* handle) {
+    ::operator delete(static_cast<char*>(handle) - header_of(handle)->offset);
+}
+
+void update_peak(std::atomic<size_t>& peak, size_t value) {
+    auto current = peak.load(std::memory_order_relaxed);
+    while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+}  // namespace
+
+struct PooledAllocator::Pool : public std::enable_shared_from_this<PooledAllocator::Pool> {
+    // The buffers released by a thread, the cache holds the pool so the buffers are returned even if the allocator is
+    // destroyed before the thread
+    struct ThreadCache {
+        explicit ThreadCache(const std::shared_ptr<Pool>& pool) : pool{pool} {}
+
+        std::shared_ptr<Pool> pool;
+        std::vector<std::vector<void*>> blocks;
+        size_t bytes = 0;
+
+        ~ThreadCache() {
+            pool->return_blocks(*this);
+        }
+    };
+
+    explicit Pool(const Config& config) : config{config} {}
+
+    ~Pool() {
+        for (auto&& blocks : free_blocks)
+            for (auto block : blocks)
+                free_block(block);
+    }
+
+    static std::vector<std::unique_ptr<ThreadCache>>& thread_caches() {
+        static thread_local std::vector<std::unique_ptr<ThreadCache>> caches;
+        return caches;
+    }
+
+    ThreadCache* thread_cache() {
+        if (config.thread_cache_bytes == 0)
+            return nullptr;
+        auto& caches = thread_caches();
+        for (auto&& cache : caches)
+            if (cache->pool.get() == this)
+                return cache.get();
+        // The caches of the destroyed allocators are released by the first thread cache of the next allocator
+        caches.erase(std::remove_if(caches.begin(),
+                                    caches.end(),
+                                    [](const std::unique_ptr<ThreadCache>& cache) {
+                                        return cache->pool->closed.load();
+                                    }),
+                     caches.end());
+        caches.emplace_back(new ThreadCache{shared_from_this()});
+        return caches.back().get();
+    }
+
+    void release_thread_cache() {
+        auto& caches = thread_caches();
+        caches.erase(std::remove_if(caches.begin(),
+                                    caches.end(),
+                                    [this](const std::unique_ptr<ThreadCache>& cache) {
+                                        return cache->pool.get() == this;
+                                    }),
+                     caches.end());
+    }
+
+    void* pop(size_t size_class) {
+        if (auto cache = thread_cache()) {
+            if (size_class < cache->blocks.size() && !cache->blocks[size_class].empty()) {
+                auto block = cache->blocks[size_class].back();
+                cache->blocks[size_class].pop_back();
+                cache->bytes -= class_size(size_class);
+                cached_bytes -= class_size(size_class);
+                return block;
+            }
+        }
+        std::lock_guard<std::mutex> lock{mutex};
+        if (size_class < free_blocks.size() && !free_blocks[size_class].empty()) {
+            auto block = free_blocks[size_class].back();
+            free_blocks[size_class].pop_back();
+            pool_bytes -= class_size(size_class);
+            cached_bytes -= class_size(size_class);
+            return block;
+        }
+        return nullptr;
+    }
+
+    void push(void* block, size_t size_class) {
+        cached_bytes += class_size(size_class);
+        if (auto cache = thread_cache()) {
+            if (cache->blocks.size() <= size_class)
+                cache->blocks.resize(size_class + 1);
+            cache->blocks[size_class].push_back(block);
+            cache->bytes += class_size(size_class);
+            if (cache->bytes > config.thread_cache_bytes)
+                return_blocks(*cache);
+            return;
+        }
+        std::lock_guard<std::mutex> lock{mutex};
+        push_to_pool(block, size_class);
+    }
+
+    // Moves the buffers of the thread cache to the pool under a single lock
+    void return_blocks(ThreadCache& cache) {
+        std::lock_guard<std::mutex> lock{mutex};
+        for (size_t size_class = 0; size_class < cache.blocks.size(); ++size_class) {
+            for (auto block : cache.blocks[size_class])
+                push_to_pool(block, size_class);
+            cache.blocks[size_class].clear();
+        }
+        cache.bytes = 0;
+    }
+
+    void push_to_pool(void* block, size_t size_class) {
+        const auto size = class_size(size_class);
+        if (closed || pool_bytes + size > config.max_cached_bytes) {
+            cached_bytes -= size;
+            free_block(block);
+            return;
+        }
+        if (free_blocks.size() <= size_class)
+            free_blocks.resize(size_class + 1);
+        free_blocks[size_class].push_back(block);
+        pool_bytes += size;
+    }
+
+    void release_pool() {
+        std::lock_guard<std::mutex> lock{mutex};
+        for (auto&& blocks : free_blocks) {
+            for (auto block : blocks)
+                free_block(block);
+            blocks.clear();
+        }
+        cached_bytes -= pool_bytes;
+        pool_bytes = 0;
+    }
+
+    const Config config;
+    std::atomic<bool> closed{false};
+    std::atomic<size_t> live_bytes{0};
+    std::atomic<size_t> peak_live_bytes{0};
+    std::atomic<size_t> cached_bytes{0};
+    std::atomic<size_t> reused_allocations{0};
+    std::atomic<size_t> system_allocations{0};
+
+    std::mutex mutex;
+    std::vector<std::vector<void*>> free_blocks;
+    size_t pool_bytes = 0;
+};
+
+PooledAllocator::PooledAllocator() : PooledAllocator{Config{}} {}
+
+PooledAllocator::PooledAllocator(const Config& config) : _pool{std::make_shared<Pool>(config)} {}
+
+PooledAllocator::~PooledAllocator() {
+    _pool->closed = true;
+    _pool->release_thread_cache();
+    _pool->release_pool();
+}
+
+void* PooledAllocator::allocate(const size_t bytes, const size_t alignment) {
+    OPENVINO_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0,
+                    "Alignment should be a power of two. alignment: ",
+                    alignment);
+    void* handle = nullptr;
+    if (alignment > block_alignment || bytes > _pool->config.max_pooled_size) {
+        handle = allocate_block(bytes, alignment, direct_class);
+        ++_pool->system_allocations;
+    } else {
+        const auto size_class = size_class_of(bytes);
+        handle = _pool->pop(size_class);
+        if (handle != nullptr) {
+            ++_pool->reused_allocations;
+        } else {
+            handle = allocate_block(class_size(size_class), block_alignment, size_class);
+            ++_pool->system_allocations;
+        }
+    }
+    header_of(handle)->bytes = bytes;
+    update_peak(_pool->peak_live_bytes, _pool->live_bytes += bytes);
+    return handle;
+}
+
+void PooledAllocator::deallocate(void* handle, const size_t bytes, size_t) {
+    if (handle == nullptr)
+        return;
+    const auto header = header_of(handle);
+    OPENVINO_ASSERT(bytes == 0 || bytes == header->bytes,
+                    "The size ",
+                    bytes,
+                    " differs from the allocated one ",
+                    header->bytes);
+    _pool->live_bytes -= header->bytes;
+    if (header->size_class == direct_class)
+        free_block(handle);
+    else
+        _pool->push(handle, header->size_class);
+}
+
+bool PooledAllocator::is_equal(const AllocatorImpl& other) const {
+    auto other_pooled_allocator = dynamic_cast<const PooledAllocator*>(&other);
+    return other_pooled_allocator != nullptr && other_pooled_allocator->_pool == _pool;
+}
+
+PooledAllocator::Statistics PooledAllocator::get_statistics() const {
+    return {_pool->live_bytes.load(),
+            _pool->peak_live_bytes.load(),
+            _pool->cached_bytes.load(),
+            _pool->reused_allocations.load(),
+            _pool->system_allocations.load()};
+}
+
+void PooledAllocator::reset_peak() {
+    _pool->peak_live_bytes = _pool->live_bytes.load();
+}
+
+void PooledAllocator::release_cached() {
+    _pool->release_thread_cache();
+    _pool->release_pool();
+}
+
+}  // namespace runtime
+}  // namespace ov
@@ -1717,3 +1717,19 @@ TEST(constant, hold_host_tensor) {
     const void* constDataPtr = constOp->get_data_ptr();
     ASSERT_EQ(constDataPtr, hostDataPtr);
 }
+
+TEST(constant, all_data_elements_bitwise_identical) {
+    op::Constant identical(element::f32, Shape{4}, vector<float>{2, 2, 2, 2});
+    EXPECT_TRUE(identical.get_all_data_elements_bitwise_identical());
+    op::Constant different(element::f32, Shape{4}, vector<float>{2, 2, 3, 2});
+    EXPECT_FALSE(different.get_all_data_elements_bitwise_identical());
+    op::Constant uniform(element::i8, Shape{2, 3}, 5);
+    EXPECT_TRUE(uniform.get_all_data_elements_bitwise_identical());
+    EXPECT_FALSE(op::Constant(different, Shape{2, 2}).get_all_data_elements_bitwise_identical());
+
+    auto tensor = std::make_shared<runtime::HostTensor>(element::i32, Shape{2, 2});
+    vector<int32_t> values{7, 7, 7, 7};
+    tensor->write(values.data(), tensor->get_size_in_bytes());
+    auto shared = std::make_shared<op::Constant>(tensor);
+    EXPECT_TRUE(shared->get_all_data_elements_bitwise_identical());
+}
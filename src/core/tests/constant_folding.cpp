@@ -63,6 +63,42 @@ TEST(constant_folding, acosh) {
     EXPECT_TRUE(test::all_close_f(expected, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(constant_folding, independent_large_subgraphs) {
+    // large enough to fold the branches in parallel, the shared constant puts two of them to one group
+    Shape shape_in{1 << 15};
+    const size_t branches = 8;
+
+    auto shared = op::Constant::create(element::f32, shape_in, {1});
+    OutputVector results;
+    for (size_t i = 0; i < branches; ++i) {
+        auto constant = op::Constant::create(element::f32, shape_in, {static_cast<float>(i)});
+        auto one = i < 2 ? shared : op::Constant::create(element::f32, shape_in, {1});
+        auto add = make_shared<op::v1::Add>(constant, one);
+        auto negative = make_shared<op::Negative>(add);
+        negative->set_friendly_name("test" + std::to_string(i));
+        results.push_back(negative);
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    auto constant_folding = pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f), branches);
+    for (size_t i = 0; i < branches; ++i) {
+        auto new_const = ov::as_type_ptr<op::Constant>(f->get_results()[i]->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        EXPECT_EQ(new_const->get_friendly_name(), "test" + std::to_string(i));
+        EXPECT_EQ(new_const->cast_vector<float>(), vector<float>(shape_size(shape_in), -1.f - i));
+    }
+
+    const auto& statistics = constant_folding->get_statistics();
+    EXPECT_EQ(statistics.folded_nodes, 2 * branches);
+    EXPECT_EQ(statistics.folded_bytes, 2 * branches * shape_size(shape_in) * sizeof(float));
+}
+
 TEST(constant_folding, asinh) {
     Shape shape_in{2, 4, 1};
 
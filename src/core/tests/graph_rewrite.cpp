@@ -7,6 +7,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -223,6 +225,27 @@ public:
     }
 };
 
+class OrBasedTestPass : public ngraph::pass::MatcherPass {
+public:
+    OrBasedTestPass() : MatcherPass() {
+        auto multiply = ngraph::pattern::wrap_type<opset3::Multiply>();
+        auto divide = std::make_shared<ngraph::opset3::Divide>(std::make_shared<ngraph::pattern::op::Label>(),
+                                                               std::make_shared<ngraph::pattern::op::Label>());
+        auto root = std::make_shared<ngraph::pattern::op::Or>(OutputVector{multiply, divide});
+        ngraph::graph_rewrite_callback callback = [this](pattern::Matcher& m) {
+            if (transformation_callback(m.get_match_root())) {
+                auto relu = std::make_shared<ngraph::opset3::Relu>(m.get_match_root()->input_value(0));
+                ngraph::replace_node(m.get_match_root(), relu);
+                return true;
+            }
+            return false;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(root, "TestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
 TEST(GraphRewriteTest, TypeBasedMatcherPassCallback) {
     auto f = get_function();
 
@@ -243,6 +266,16 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassCallbackDerived) {
     ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
 }
 
+TEST(GraphRewriteTest, OrBasedMatcherPassCallbackDerived) {
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<OrBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
 TEST(GraphRewriteTest, TypeBasedMatcherPassOrder1) {
     auto f = get_derived_function();
 
@@ -265,6 +298,35 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndAnyTypeMatcherPassOrder1) {
+    auto f = get_function();
+    const auto ops_count = f->get_ordered_ops().size();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(order.size(), ops_count);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
+TEST(GraphRewriteTest, TypeBasedAndAnyTypeMatcherPassOrder2) {
+    auto f = get_function();
+    const auto ops_count = f->get_ordered_ops().size();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.run_on_function(f);
+
+    // the Divide is rewritten by the first matcher, so the second one doesn't see it
+    ASSERT_EQ(order.size(), ops_count - 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_function();
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace {
+class MmapObjectTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        file_name = ::testing::TempDir() + "mmap_object_test.bin";
+        ofstream file(file_name, ios::binary);
+        file << content;
+    }
+
+    void TearDown() override {
+        remove(file_name.c_str());
+    }
+
+    const string content = "memory mapped weights";
+    string file_name;
+};
+}  // namespace
+
+TEST_F(MmapObjectTest, content) {
+    auto mapped = ov::util::load_mmap_object(file_name);
+    ASSERT_EQ(mapped->size(), content.size());
+    EXPECT_EQ(string(mapped->data(), mapped->size()), content);
+}
+
+TEST_F(MmapObjectTest, private_writes) {
+    {
+        auto mapped = ov::util::load_mmap_object(file_name);
+        mapped->data()[0] = 'M';
+        EXPECT_EQ(mapped->data()[0], 'M');
+    }
+    // the writes to the mapped memory never reach the file
+    auto mapped = ov::util::load_mmap_object(file_name);
+    EXPECT_EQ(string(mapped->data(), mapped->size()), content);
+}
+
+TEST(mmap_object, not_existing_file) {
+    EXPECT_ANY_THROW(ov::util::load_mmap_object("not_existing_file.bin"));
+}
@@ -9,6 +9,7 @@
 #include <shared_node_info.hpp>
 #include <test_common.hpp>
 
+#include "openvino/core/graph_util.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/opsets/opset8.hpp"
 
@@ -1523,3 +1524,20 @@ TEST(model, set_batch_size_validation_throw) {
         FAIL() << "Expected ov::Exception";
     }
 }
+
+TEST(model, clone_model_shares_constant_data) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 4});
+    auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 4}, {1.f, 2.f, 3.f, 4.f});
+    auto add = std::make_shared<ov::opset8::Add>(arg0, weights);
+    auto relu = std::make_shared<ov::opset8::Relu>(add);
+    auto f = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{arg0});
+
+    std::unordered_map<ov::Node*, std::shared_ptr<ov::Node>> node_map;
+    auto clone = ov::clone_model(*f, node_map);
+
+    EXPECT_EQ(clone->get_ops().size(), f->get_ops().size());
+    auto cloned_weights = ov::as_type_ptr<ov::opset8::Constant>(node_map.at(weights.get()));
+    ASSERT_NE(cloned_weights, nullptr);
+    EXPECT_NE(cloned_weights, weights);
+    EXPECT_EQ(cloned_weights->get_data_ptr(), weights->get_data_ptr());
+}
@@ -143,3 +143,23 @@ TEST(node_input_output, input_set_argument) {
     EXPECT_EQ(add->input(0).get_shape(), Shape{3});
     EXPECT_EQ(add->input(1).get_shape(), Shape{1});
 }
+
+TEST(node_input_output, descriptors_stay_connected_when_added) {
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    auto concat = make_shared<op::Concat>(OutputVector{x}, 0);
+    auto relu = make_shared<op::Relu>(x);
+
+    // the inputs and the outputs are added one by one, the connected ones must keep their addresses
+    for (size_t i = 1; i < 64; ++i) {
+        concat->set_argument(i, relu);
+    }
+    x->set_output_size(64);
+    ASSERT_EQ(concat->get_input_size(), 64);
+    EXPECT_EQ(concat->input_value(0), x->output(0));
+    EXPECT_EQ(relu->input_value(0), x->output(0));
+    EXPECT_EQ(x->output(0).get_target_inputs().size(), 2);
+    EXPECT_EQ(relu->output(0).get_target_inputs().size(), 63);
+    for (size_t i = 1; i < 64; ++i) {
+        EXPECT_EQ(concat->input_value(i), relu->output(0));
+    }
+}
@@ -2,6 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <onnx/onnx_pb.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+
 #include "default_opset.hpp"
 #include "engines_util/test_case.hpp"
 #include "engines_util/test_engines.hpp"
@@ -123,3 +130,53 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_sanitize_path) {
 
     test_case.run();
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_large_raw_data_referred_in_model_file) {
+    // the raw data of the initializer is large enough not to be read when the model file is parsed
+    const size_t size = 4096;
+    std::vector<float> data(size);
+    std::iota(data.begin(), data.end(), 0.f);
+
+    ONNX_NAMESPACE::ModelProto model_proto;
+    model_proto.set_ir_version(7);
+    model_proto.add_opset_import()->set_version(13);
+    auto graph = model_proto.mutable_graph();
+    graph->set_name("large_raw_data");
+    auto node = graph->add_node();
+    node->set_op_type("Add");
+    node->add_input("A");
+    node->add_input("B");
+    node->add_output("Y");
+    auto initializer = graph->add_initializer();
+    initializer->set_name("B");
+    initializer->set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    initializer->add_dims(size);
+    initializer->set_raw_data(data.data(), size * sizeof(float));
+    for (auto value_info : {graph->add_input(), graph->add_output()}) {
+        auto tensor_type = value_info->mutable_type()->mutable_tensor_type();
+        tensor_type->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(size);
+    }
+    graph->mutable_input(0)->set_name("A");
+    graph->mutable_output(0)->set_name("Y");
+
+    const auto path = ::testing::TempDir() + "onnx_large_raw_data.onnx";
+    {
+        std::ofstream file{path, std::ios::out | std::ios::binary};
+        ASSERT_TRUE(model_proto.SerializeToOstream(&file));
+    }
+    {
+        const auto function = onnx_import::import_onnx_model(path);
+
+        std::vector<float> expected(data);
+        std::transform(expected.begin(), expected.end(), expected.begin(), [](float value) {
+            return value + 1.f;
+        });
+        auto test_case = test::TestCase(function, s_device);
+        test_case.add_input<float>(std::vector<float>(size, 1.f));
+        test_case.add_expected_output<float>(Shape{size}, expected);
+
+        test_case.run();
+    }
+    std::remove(path.c_str());
+}
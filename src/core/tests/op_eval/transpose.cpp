@@ -4,6 +4,7 @@
 
 #include "ngraph/op/transpose.hpp"
 
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -212,3 +213,33 @@ TEST(op_eval, eval_negative_axes_transpose) {
         FAIL() << "Failed for unexpected reason";
     }
 }
+
+TEST(op_eval, eval_large_transpose) {
+    // large enough to be split between the threads
+    const Shape data_shape{3, 512, 7, 131};
+    const std::vector<int32_t> perm{3, 1, 0, 2};
+    std::vector<int32_t> data(shape_size(data_shape));
+    std::iota(data.begin(), data.end(), 0);
+
+    const Shape out_shape{131, 512, 3, 7};
+    std::vector<int32_t> expected_result;
+    expected_result.reserve(data.size());
+    for (size_t a = 0; a < out_shape[0]; ++a)
+        for (size_t b = 0; b < out_shape[1]; ++b)
+            for (size_t c = 0; c < out_shape[2]; ++c)
+                for (size_t d = 0; d < out_shape[3]; ++d)
+                    expected_result.push_back(static_cast<int32_t>(((c * 512 + b) * 7 + d) * 131 + a));
+
+    auto data_param = make_shared<op::Parameter>(element::i32, PartialShape::dynamic());
+    auto axes_order = make_shared<op::Parameter>(element::i32, PartialShape{Dimension::dynamic()});
+    auto x_transpose = make_shared<op::v1::Transpose>(data_param, axes_order);
+    auto function = make_shared<Function>(NodeVector{x_transpose}, ParameterVector{data_param, axes_order});
+
+    auto result_tensor = make_shared<HostTensor>();
+    ASSERT_TRUE(function->evaluate({result_tensor},
+                                   {make_host_tensor<element::Type_t::i32>(data_shape, data),
+                                    make_host_tensor<element::Type_t::i32>(Shape{perm.size()}, perm)}));
+
+    EXPECT_EQ(result_tensor->get_shape(), out_shape);
+    EXPECT_EQ(read_vector<int32_t>(result_tensor), expected_result);
+}
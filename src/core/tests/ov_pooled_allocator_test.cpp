@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/pooled_allocator.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using OVPooledAllocatorTest = ::testing::Test;
+
+TEST_F(OVPooledAllocatorTest, canAllocateAndDeallocate) {
+    ov::runtime::Allocator allocator{std::make_shared<ov::runtime::PooledAllocator>()};
+    void* ptr = nullptr;
+    ASSERT_NO_THROW(ptr = allocator.allocate(0));
+    ASSERT_NO_THROW(allocator.deallocate(ptr));
+    ASSERT_NO_THROW(ptr = allocator.allocate(10000));
+    reinterpret_cast<char*>(ptr)[9999] = 11;
+    EXPECT_EQ(reinterpret_cast<char*>(ptr)[9999], 11);
+    ASSERT_NO_THROW(allocator.deallocate(ptr, 10000));
+}
+
+TEST_F(OVPooledAllocatorTest, reusesReleasedBuffersOfSameSizeClass) {
+    auto pool = std::make_shared<ov::runtime::PooledAllocator>();
+    void* first = pool->allocate(1000);
+    pool->deallocate(first);
+    EXPECT_EQ(pool->get_statistics().cached_bytes, 1024);
+    void* second = pool->allocate(1020);
+    EXPECT_EQ(first, second);
+    void* other_class = pool->allocate(1100);
+    EXPECT_NE(first, other_class);
+    auto statistics = pool->get_statistics();
+    EXPECT_EQ(statistics.reused_allocations, 1);
+    EXPECT_EQ(statistics.system_allocations, 2);
+    EXPECT_EQ(statistics.cached_bytes, 0);
+    pool->deallocate(second);
+    pool->deallocate(other_class);
+}
+
+TEST_F(OVPooledAllocatorTest, respectsAlignment) {
+    auto pool = std::make_shared<ov::runtime::PooledAllocator>();
+    for (size_t alignment : {size_t{1}, size_t{16}, size_t{64}, size_t{4096}}) {
+        void* ptr = pool->allocate(100, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0);
+        pool->deallocate(ptr, 100, alignment);
+    }
+    ASSERT_THROW(pool->allocate(100, 3), ov::Exception);
+}
+
+TEST_F(OVPooledAllocatorTest, countsLiveAndPeakBytes) {
+    auto pool = std::make_shared<ov::runtime::PooledAllocator>();
+    void* first = pool->allocate(100);
+    void* second = pool->allocate(300);
+    EXPECT_EQ(pool->get_statistics().live_bytes, 400);
+    pool->deallocate(second);
+    auto statistics = pool->get_statistics();
+    EXPECT_EQ(statistics.live_bytes, 100);
+    EXPECT_EQ(statistics.peak_live_bytes, 400);
+    pool->reset_peak();
+    EXPECT_EQ(pool->get_statistics().peak_live_bytes, 100);
+    pool->deallocate(first);
+    EXPECT_EQ(pool->get_statistics().live_bytes, 0);
+    pool->release_cached();
+    EXPECT_EQ(pool->get_statistics().cached_bytes, 0);
+}
+
+TEST_F(OVPooledAllocatorTest, doesNotCacheBuffersAboveLimits) {
+    ov::runtime::PooledAllocator::Config config;
+    config.max_pooled_size = 1024;
+    config.max_cached_bytes = 0;
+    config.thread_cache_bytes = 0;
+    auto pool = std::make_shared<ov::runtime::PooledAllocator>(config);
+    pool->deallocate(pool->allocate(2048));
+    pool->deallocate(pool->allocate(512));
+    EXPECT_EQ(pool->get_statistics().cached_bytes, 0);
+    pool->deallocate(pool->allocate(512));
+    EXPECT_EQ(pool->get_statistics().reused_allocations, 0);
+}
+
+TEST_F(OVPooledAllocatorTest, canDeallocateFromOtherThread) {
+    auto pool = std::make_shared<ov::runtime::PooledAllocator>();
+    void* ptr = pool->allocate(1000);
+    std::thread{[&] {
+        pool->deallocate(ptr);
+    }}.join();
+    EXPECT_EQ(pool->get_statistics().live_bytes, 0);
+    // The exited thread returned its cache to the shared pool
+    pool->deallocate(pool->allocate(1000));
+    EXPECT_EQ(pool->get_statistics().reused_allocations, 1);
+}
+
+TEST_F(OVPooledAllocatorTest, canBeSetAsDefault) {
+    auto pool = std::make_shared<ov::runtime::PooledAllocator>();
+    ov::runtime::Allocator::set_default(pool);
+    {
+        ov::runtime::Tensor tensor{ov::element::f32, {1, 3, 8, 8}};
+        EXPECT_EQ(pool->get_statistics().live_bytes, tensor.get_byte_size());
+    }
+    ov::runtime::Allocator::set_default(nullptr);
+    EXPECT_EQ(pool->get_statistics().live_bytes, 0);
+    EXPECT_EQ(pool->get_statistics().peak_live_bytes, 3 * 8 * 8 * sizeof(float));
+    ov::runtime::Allocator allocator;
+    EXPECT_FALSE(allocator == ov::runtime::Allocator{pool});
+}
@@ -157,6 +157,24 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsTimesTwoMultipleOc
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
 
+TEST_F(SerializatioConstantCompressionTest, IdenticalPrefixDifferentSizes) {
+    const ov::Shape shape_a{2, 2, 2};
+    const ov::Shape shape_b{2, 2};
+
+    auto A = ov::opset8::Constant::create(ov::element::i32, shape_a, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto B = ov::opset8::Constant::create(ov::element::i32, shape_b, {1, 2, 3, 4});
+    auto C = ov::opset8::Constant::create(ov::element::i32, shape_b, {1, 2, 3, 4});
+
+    auto ngraph_a = std::make_shared<ov::Model>(ov::NodeVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == (ov::shape_size(shape_a) + ov::shape_size(shape_b)) * sizeof(int32_t));
+}
+
 TEST_F(SerializatioConstantCompressionTest, NonIdenticalConstants) {
     constexpr int unique_const_count = 2;
     const ov::Shape shape{2, 2, 2};
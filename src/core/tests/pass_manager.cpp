@@ -11,7 +11,9 @@
 #include "gtest/gtest.h"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -41,4 +43,52 @@ public:
         return false;
     }
 };
+
+class AllocatingPass : public pass::FunctionPass {
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override {
+        auto constant = op::Constant::create(element::f32, Shape{1024}, {0});
+        return false;
+    }
+};
+
+class ReluToAbs : public pass::MatcherPass {
+public:
+    ReluToAbs() {
+        auto relu = pattern::wrap_type<op::Relu>();
+        matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto relu = m.get_match_root();
+            auto abs = std::make_shared<op::Abs>(relu->input_value(0));
+            replace_node(relu, abs);
+            return true;
+        };
+        register_matcher(std::make_shared<pattern::Matcher>(relu, "ReluToAbs"), callback);
+    }
+};
 }  // namespace
+
+TEST(pass_manager, per_pass_profiling) {
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto relu = std::make_shared<op::Relu>(std::make_shared<op::Relu>(data));
+    auto f = std::make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_per_pass_profiling(true);
+    pass_manager.register_pass<ReluToAbs>();
+    pass_manager.register_pass<AllocatingPass>();
+    pass_manager.run_passes(f);
+
+    const auto& profile = pass_manager.get_profile();
+    ASSERT_EQ(profile.size(), 2);
+    EXPECT_EQ(profile[0].nodes_visited, 4);
+    EXPECT_EQ(profile[0].rewrites_applied, 2);
+    EXPECT_EQ(profile[1].nodes_visited, 0);
+    EXPECT_EQ(profile[1].rewrites_applied, 0);
+    EXPECT_GE(profile[1].peak_allocated_bytes, 1024 * sizeof(float));
+
+    // the profile is of the last run only
+    pass_manager.run_passes(f);
+    ASSERT_EQ(pass_manager.get_profile().size(), 2);
+    EXPECT_EQ(pass_manager.get_profile()[0].rewrites_applied, 0);
+}
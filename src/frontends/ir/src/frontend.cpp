@@ -12,6 +12,7 @@
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
 
@@ -199,6 +200,23 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
 
     if (!weights_path.empty()) {
+        // The weights file is mapped rather than read, so the constants refer to the file pages directly: the pages are
+        // loaded on demand and shared with the page cache, i.e. with the other processes which load the same model.
+        // The reading is kept as a fallback for the file systems which don't support the mapping.
+        std::shared_ptr<ov::util::MappedMemory> mapped_weights;
+        try {
+            mapped_weights = ov::util::load_mmap_object(weights_path);
+        } catch (const std::exception&) {
+            mapped_weights.reset();
+        }
+        if (mapped_weights && mapped_weights->size() > 0) {
+            weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                mapped_weights->data(),
+                mapped_weights->size(),
+                mapped_weights);
+            return create_input_model();
+        }
+
         std::ifstream bin_stream;
         bin_stream.open(weights_path, std::ios::binary);
         if (!bin_stream.is_open())
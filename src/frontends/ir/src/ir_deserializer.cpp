@@ -4,9 +4,11 @@
 
 #include "ir_deserializer.hpp"
 
+#include <exception>
 #include <pugixml.hpp>
 
 #include "ie_ngraph_utils.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "rt_info_deserializer.hpp"
@@ -426,13 +428,30 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
+    // Parse the layers in parallel, the DOM is only read
+    std::vector<pugi::xml_node> layers;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layers.push_back(node); }
+    std::vector<GenericLayerParams> layers_params(layers.size());
+    std::vector<std::exception_ptr> layers_errors(layers.size());
+    InferenceEngine::parallel_for(layers.size(), [&](size_t i) {
+        try {
+            layers_params[i] = parseGenericParams(layers[i]);
+        } catch (...) {
+            layers_errors[i] = std::current_exception();
+        }
+    });
+
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+    for (size_t i = 0; i < layers.size(); ++i) {
+        // the error of the first invalid layer is reported, as if they were parsed one by one
+        if (layers_errors[i]) {
+            std::rethrow_exception(layers_errors[i]);
+        }
+        const auto& node = layers[i];
+        auto& node_param = layers_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -443,6 +462,8 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             order.push_back(node_param.layerId);
             edges[node_param.layerId] = {};
         }
+        const auto layer_id = node_param.layerId;
+        params[layer_id] = {node, std::move(node_param)};
     }
 
     // Read all edges and store them for further usage
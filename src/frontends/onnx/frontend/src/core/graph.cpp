@@ -12,6 +12,7 @@
 #include "core/value_info.hpp"
 #include "default_opset.hpp"
 #include "exceptions.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "onnx_framework_node.hpp"
@@ -74,12 +75,23 @@ Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
       m_cache{std::move(cache)},
       m_telemetry(telemetry) {
     std::map<std::string, Tensor> initializers;
-    // Process all initializers in the graph
+    std::vector<const ONNX_NAMESPACE::TensorProto*> named_initializers;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
+            named_initializers.push_back(&initializer_tensor);
+            initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor});
+        }
+    }
+    // Process all initializers in the graph, decoding their data takes most of the import of the large models, so
+    // the Constant nodes are created in parallel
+    std::vector<std::shared_ptr<default_opset::Constant>> constants(named_initializers.size());
+    std::vector<std::exception_ptr> initializers_errors(named_initializers.size());
+    InferenceEngine::parallel_for(named_initializers.size(), [&](size_t i) {
+        const auto& initializer_tensor = *named_initializers[i];
+        try {
             Tensor tensor = Tensor{initializer_tensor};
             std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
+            // For each initializer create a Constant node
             try {
                 ng_constant = tensor.get_ng_constant();
             } catch (const error::invalid_external_data&) {
@@ -94,10 +106,19 @@ Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
                 ng_constant = default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
             }
 
-            initializers.emplace(initializer_tensor.name(), tensor);
             ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+            constants[i] = std::move(ng_constant);
+        } catch (...) {
+            initializers_errors[i] = std::current_exception();
+        }
+    });
+    // the cache is filled in the order of the model, and the error of the first invalid initializer is reported, as
+    // if they were processed one by one
+    for (size_t i = 0; i < named_initializers.size(); ++i) {
+        if (initializers_errors[i]) {
+            std::rethrow_exception(initializers_errors[i]);
         }
+        m_cache->emplace_node(named_initializers[i]->name(), std::move(constants[i]));
     }
 
     // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
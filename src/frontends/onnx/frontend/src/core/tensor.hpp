@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -81,7 +82,8 @@ inline std::vector<T> get_external_data(const ONNX_NAMESPACE::TensorProto& tenso
     const auto tensor_external_data = TensorExternalData(tensor);
     const auto raw_data = tensor_external_data.load_external_data();
 
-    return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+    const auto it = raw_data->get_ptr<T>();
+    return std::vector<T>(it, it + (raw_data->size() / onnx_common::get_onnx_data_size(tensor.data_type())));
 }
 
 bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor) {
@@ -459,7 +461,19 @@ public:
 private:
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        std::shared_ptr<ngraph::op::Constant> constant;
+        if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto) && !m_tensor_proto->has_segment()) {
+            // the constant refers to the mapped external file, so the weights are neither read nor copied here
+            const auto data = detail::TensorExternalData(*m_tensor_proto).load_external_data();
+            if (data->size() == shape_size(m_shape) * type.size()) {
+                using Buffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+                auto buffer = std::make_shared<Buffer>(data->get_ptr<char>(), data->size(), data);
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+            }
+        }
+        if (!constant) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
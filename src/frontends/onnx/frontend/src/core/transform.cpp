@@ -106,13 +106,28 @@ void ngraph::onnx_import::transform::expand_onnx_functions(ONNX_NAMESPACE::Model
     }
 }
 
+std::string ngraph::onnx_import::transform::get_external_data_full_path(const std::string& location,
+                                                                         const std::string& model_path) {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    const auto model_dir_path = file_util::get_directory(model_path);
+    const auto santized_external_data_relative_path = file_util::sanitize_path(location);
+    // the path of the model in the current directory has no directory part
+    auto external_data_full_path = model_dir_path == model_path
+                                       ? santized_external_data_relative_path
+                                       : file_util::path_join(model_dir_path, santized_external_data_relative_path);
+
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    file_util::convert_path_win_style(external_data_full_path);
+#endif
+    NGRAPH_SUPPRESS_DEPRECATED_END
+    return external_data_full_path;
+}
+
 void ngraph::onnx_import::transform::update_external_data_paths(ONNX_NAMESPACE::ModelProto& model_proto,
                                                                 const std::string& model_path) {
-    NGRAPH_SUPPRESS_DEPRECATED_START
     if (model_path.empty()) {
         return;
     }
-    const auto model_dir_path = file_util::get_directory(model_path);
     auto graph_proto = model_proto.mutable_graph();
     for (auto& initializer_tensor : *graph_proto->mutable_initializer()) {
         const auto location_key_value_index = 0;
@@ -120,18 +135,11 @@ void ngraph::onnx_import::transform::update_external_data_paths(ONNX_NAMESPACE::
             initializer_tensor.data_location() ==
                 ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
             const auto external_data_relative_path = initializer_tensor.external_data(location_key_value_index).value();
-            const auto santized_external_data_relative_path = file_util::sanitize_path(external_data_relative_path);
-            auto external_data_full_path = file_util::path_join(model_dir_path, santized_external_data_relative_path);
-
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-            file_util::convert_path_win_style(external_data_full_path);
-#endif
-
             // Set full paths to the external file
-            initializer_tensor.mutable_external_data(location_key_value_index)->set_value(external_data_full_path);
+            initializer_tensor.mutable_external_data(location_key_value_index)
+                ->set_value(get_external_data_full_path(external_data_relative_path, model_path));
         }
     }
-    NGRAPH_SUPPRESS_DEPRECATED_END
 }
 
 void ngraph::onnx_import::transform::fixup_legacy_operators(ONNX_NAMESPACE::ModelProto& model_proto) {
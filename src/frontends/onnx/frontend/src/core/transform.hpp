@@ -10,6 +10,12 @@ namespace ngraph {
 namespace onnx_import {
 namespace transform {
 
+/// \brief Returns the full filesystem path of the external data file.
+///
+/// \param location The location of the external data, relative to the model file.
+/// \param model_path Filesystem path to the ONNX model file.
+std::string get_external_data_full_path(const std::string& location, const std::string& model_path);
+
 /// \brief Replace external_data path in tensors with full path to data file.
 ///
 /// Paths to external data files are stored as relative to model path.
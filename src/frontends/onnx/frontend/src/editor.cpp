@@ -7,8 +7,10 @@
 #include <onnx/onnx_pb.h>
 #include <onnx/shape_inference/implementation.h>
 
+#include <algorithm>
 #include <fstream>
 
+#include "core/transform.hpp"
 #include "detail/subgraph_extraction.hpp"
 #include "edge_mapper.hpp"
 #include "ngraph/file_util.hpp"
@@ -17,6 +19,7 @@
 #include "onnx_common/utils.hpp"
 #include "utils/common.hpp"
 #include "utils/onnx_internal.hpp"
+#include "utils/tensor_external_data.hpp"
 
 using namespace ov;
 using namespace ov::onnx_editor;
@@ -174,6 +177,43 @@ void modify_initializer(TensorProto& initializer,
         tensor_type->set_elem_type(initializer.data_type());
     }
 }
+/// \brief Returns the model in which the initializers referring to the raw data in the model file itself, see
+///        onnx_common::parse_from_file, hold their data, so the model can be saved elsewhere.
+std::shared_ptr<ModelProto> load_model_file_references(const std::shared_ptr<ModelProto>& model_proto,
+                                                       const std::string& model_path) {
+    if (model_path.empty()) {
+        return model_proto;
+    }
+    const auto model_file_name = model_path.substr(model_path.find_last_of("/\\") + 1);
+    const auto model_file_path =
+        ngraph::onnx_import::transform::get_external_data_full_path(model_file_name, model_path);
+    const auto refers_to_model_file = [&](const TensorProto& tensor) {
+        if (!tensor.has_data_location() || tensor.data_location() != TensorProto_DataLocation_EXTERNAL ||
+            tensor.external_data_size() == 0) {
+            return false;
+        }
+        // the location is the full path once the model is converted, see transform::update_external_data_paths
+        const auto& location = tensor.external_data(0).value();
+        return location == model_file_name || location == model_file_path;
+    };
+    const auto& initializers = model_proto->graph().initializer();
+    if (std::none_of(initializers.begin(), initializers.end(), refers_to_model_file)) {
+        return model_proto;
+    }
+
+    auto loaded_model_proto = std::make_shared<ModelProto>(*model_proto);
+    for (auto& initializer : *loaded_model_proto->mutable_graph()->mutable_initializer()) {
+        if (refers_to_model_file(initializer)) {
+            initializer.mutable_external_data(0)->set_value(model_file_path);
+            const auto data = ngraph::onnx_import::detail::TensorExternalData(initializer).load_external_data();
+            initializer.clear_external_data();
+            initializer.clear_data_location();
+            initializer.set_raw_data(data->get_ptr<char>(), data->size());
+        }
+    }
+    return loaded_model_proto;
+}
+
 class InferShapesAutoRelease {
 public:
     InferShapesAutoRelease(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto)
@@ -253,13 +293,15 @@ const std::string& onnx_editor::ONNXModelEditor::model_path() const {
 }
 
 void onnx_editor::ONNXModelEditor::serialize(const std::string& out_file_path) const {
+    // the data is loaded before the file is opened, which may be the original one
+    const auto model_proto = load_model_file_references(m_pimpl->m_model_proto, m_model_path);
     std::ofstream out_file{out_file_path, std::ios::out | std::ios::binary};
 
     if (!out_file.is_open()) {
         throw ov::Exception("Could not open the file: " + out_file_path);
     };
 
-    if (!m_pimpl->m_model_proto->SerializeToOstream(&out_file)) {
+    if (!model_proto->SerializeToOstream(&out_file)) {
         throw ov::Exception("Could not serialize the model to: " + out_file_path);
     } else {
         out_file.close();
@@ -432,7 +474,7 @@ bool onnx_editor::ONNXModelEditor::is_output(const OutputEdge& edge) const {
 }
 
 std::string onnx_editor::ONNXModelEditor::model_string() const {
-    return m_pimpl->m_model_proto->SerializeAsString();
+    return load_model_file_references(m_pimpl->m_model_proto, m_model_path)->SerializeAsString();
 }
 
 std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
@@ -29,7 +29,9 @@ std::shared_ptr<Function> import_onnx_model(const std::string& file_path) {
                            ". Could not open the file.");
     };
 
-    return import_onnx_model(model_stream, file_path);
+    auto model_proto =
+        std::make_shared<ONNX_NAMESPACE::ModelProto>(onnx_common::parse_from_file_stream(model_stream, file_path));
+    return detail::import_onnx_model(model_proto, file_path);
 }
 
 std::set<std::string> get_supported_operators(std::int64_t version, const std::string& domain) {
@@ -5,12 +5,16 @@
 #include "utils/tensor_external_data.hpp"
 
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ngraph {
 namespace onnx_import {
@@ -19,16 +23,66 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
     for (const auto& entry : tensor.external_data()) {
         if (entry.key() == "location")
             m_data_location = entry.value();
+        // the offsets and lengths of the weights of the large models don't fit into int
         if (entry.key() == "offset")
-            m_offset = std::stoi(entry.value());
+            m_offset = std::stoull(entry.value());
         if (entry.key() == "length")
-            m_data_length = std::stoi(entry.value());
+            m_data_length = std::stoull(entry.value());
         if (entry.key() == "checksum")
-            m_sha1_digest = std::stoi(entry.value());
+            m_sha1_digest = std::stoull(entry.value());
     }
 }
 
-std::string TensorExternalData::load_external_data() const {
+namespace {
+using MappedMemoryPtr = std::shared_ptr<ov::util::MappedMemory>;
+
+/// \brief Maps the file once for all its tensors, the mapping is released with the last constant referring to it.
+MappedMemoryPtr get_mapped_file(const std::string& location) {
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<ov::util::MappedMemory>> mapped_files;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& mapped_file = mapped_files[location];
+    auto memory = mapped_file.lock();
+    if (!memory) {
+        NGRAPH_SUPPRESS_DEPRECATED_START
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+        memory = ov::util::load_mmap_object(ov::util::string_to_wstring(location));
+#else
+        memory = ov::util::load_mmap_object(location);
+#endif
+        NGRAPH_SUPPRESS_DEPRECATED_END
+        mapped_file = memory;
+    }
+    // the expired mappings of the other files are dropped not to grow the map over the imports
+    for (auto it = mapped_files.begin(); it != mapped_files.end();) {
+        it = it->second.expired() ? mapped_files.erase(it) : std::next(it);
+    }
+    return memory;
+}
+}  // namespace
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> TensorExternalData::load_external_data() const {
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    MappedMemoryPtr mapped_file;
+    try {
+        mapped_file = get_mapped_file(m_data_location);
+    } catch (const std::exception&) {
+        // e.g. the file system doesn't support the mapping, the data is read then
+    }
+    if (mapped_file) {
+        if (m_offset > mapped_file->size() || m_data_length > mapped_file->size() - m_offset)
+            throw error::invalid_external_data{*this};
+        // default value of m_data_length is 0, which means the data till the end of the file
+        const auto length = m_data_length == 0 ? mapped_file->size() - m_offset : m_data_length;
+        return std::make_shared<ngraph::runtime::SharedBuffer<MappedMemoryPtr>>(mapped_file->data() + m_offset,
+                                                                                 length,
+                                                                                 mapped_file);
+    }
+
     NGRAPH_SUPPRESS_DEPRECATED_START
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     std::wstring path = ov::util::string_to_wstring(m_data_location);
@@ -40,29 +94,18 @@ std::string TensorExternalData::load_external_data() const {
     if (external_data_stream.fail())
         throw error::invalid_external_data{*this};
 
-    std::streamsize read_data_length;
-    if (m_data_length == 0)  // read entire file
-        read_data_length = external_data_stream.tellg();
-    else
-        read_data_length = m_data_length;
+    const uint64_t file_size = external_data_stream.tellg();
+    if (m_offset > file_size || m_data_length > file_size - m_offset)
+        throw error::invalid_external_data{*this};
+    const auto read_data_length = m_data_length == 0 ? file_size - m_offset : m_data_length;
 
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
-    }
     // default value of m_offset is 0
     external_data_stream.seekg(m_offset, std::ios::beg);
 
-    if (m_sha1_digest != 0) {
-        NGRAPH_WARN << "SHA1 checksum is not supported";
-    }
-
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
-    external_data_stream.close();
+    auto read_data = std::make_shared<ngraph::runtime::AlignedBuffer>(read_data_length);
+    external_data_stream.read(read_data->get_ptr<char>(), read_data_length);
+    if (external_data_stream.fail())
+        throw error::invalid_external_data{*this};
 
     return read_data;
 }
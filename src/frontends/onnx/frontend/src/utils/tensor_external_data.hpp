@@ -6,6 +6,11 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <cstdint>
+#include <memory>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
@@ -16,12 +21,14 @@ public:
 
     /// \brief      Load external data from tensor passed to constructor
     ///
-    /// \note       If read data from external file fails,
+    /// \note       The external file is mapped into the memory, the returned buffer refers to the mapped pages which
+    ///             are loaded on demand. The mapping of a file is shared by all its tensors and is released with
+    ///             the last buffer referring to it. The data is read if the file can't be mapped.
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into a std::string
-    std::string load_external_data() const;
+    /// \return     The buffer of the external binary data
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> load_external_data() const;
 
     /// \brief      Represets parameter of external data as string
     ///
@@ -30,9 +37,9 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
-    int m_sha1_digest = 0;
+    uint64_t m_offset = 0;
+    uint64_t m_data_length = 0;
+    uint64_t m_sha1_digest = 0;
 };
 }  // namespace detail
 }  // namespace onnx_import
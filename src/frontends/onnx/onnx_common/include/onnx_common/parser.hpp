@@ -15,6 +15,10 @@ namespace ngraph {
 namespace onnx_common {
 /// \brief   Parses an ONNX model from a file located on a storage device.
 ///
+/// \note    The file is parsed as a stream, and the large raw data of the initializers of the main graph is not read.
+///          It is referred to as the external data which is located in the model file itself, so the constants are
+///          created from the mapped file, and the size of the model isn't limited to 2 GB.
+///
 /// \param   file_path    Path to the file containing an ONNX model.
 ///
 /// \return  The parsed in-memory representation of the ONNX model
@@ -23,6 +27,14 @@ ONNX_NAMESPACE::ModelProto parse_from_file(const std::string& file_path);
 ONNX_NAMESPACE::ModelProto parse_from_file(const std::wstring& file_path);
 #endif
 
+/// \brief   Parses an ONNX model from the stream of a file, which is opened at its beginning, see parse_from_file.
+///
+/// \param   file_stream  The stream of the file containing an ONNX model.
+/// \param   file_path    Path to the file.
+///
+/// \return  The parsed in-memory representation of the ONNX model
+ONNX_NAMESPACE::ModelProto parse_from_file_stream(std::istream& file_stream, const std::string& file_path);
+
 /// \brief   Parses an ONNX model from a stream (representing for example a file)
 ///
 /// \param   model_stream  Path to the file containing an ONNX model.
@@ -8,12 +8,194 @@
 #include <google/protobuf/text_format.h>
 #include <onnx/onnx_pb.h>
 
+#include <cstdint>
 #include <ngraph/file_util.hpp>
 
 #include "ngraph/except.hpp"
 
 namespace ngraph {
 namespace onnx_common {
+namespace {
+// the wire format tags of the fields of the messages which are read by the parser itself
+constexpr uint64_t model_graph_tag = (7 << 3) | 2;         // ModelProto.graph
+constexpr uint64_t graph_initializer_tag = (5 << 3) | 2;   // GraphProto.initializer
+constexpr uint64_t tensor_raw_data_tag = (9 << 3) | 2;     // TensorProto.raw_data
+constexpr uint64_t min_referenced_raw_data_size = 1 << 12;
+
+/// \brief Reads the protobuf wire format from the stream. Unlike google::protobuf::io::CodedInputStream it doesn't
+///        limit the size of the stream to 2 GB.
+class WireFormatReader {
+public:
+    explicit WireFormatReader(std::istream& stream) : m_stream(stream) {}
+
+    uint64_t position() const {
+        return m_position;
+    }
+
+    bool at_end() {
+        return m_stream.peek() == std::char_traits<char>::eof();
+    }
+
+    uint64_t read_varint() {
+        uint64_t value = 0;
+        for (uint64_t shift = 0; shift < 64; shift += 7) {
+            const auto byte = m_stream.get();
+            if (byte == std::char_traits<char>::eof()) {
+                throw_error();
+            }
+            ++m_position;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        throw_error();
+    }
+
+    void read(std::string& bytes, uint64_t size) {
+        const auto offset = bytes.size();
+        bytes.resize(offset + size);
+        if (size != 0 && !m_stream.read(&bytes[offset], size)) {
+            throw_error();
+        }
+        m_position += size;
+    }
+
+    void skip(uint64_t size) {
+        if (!m_stream.seekg(size, std::ios::cur)) {
+            throw_error();
+        }
+        m_position += size;
+    }
+
+    /// \brief Reads the field which follows the tag and appends it to the bytes of the message
+    void copy_field(uint64_t tag, std::string& bytes) {
+        append_varint(bytes, tag);
+        switch (tag & 7) {
+        case 0:
+            append_varint(bytes, read_varint());
+            break;
+        case 1:
+            read(bytes, 8);
+            break;
+        case 2: {
+            const auto size = read_varint();
+            append_varint(bytes, size);
+            read(bytes, size);
+            break;
+        }
+        case 5:
+            read(bytes, 4);
+            break;
+        default:
+            throw_error();
+        }
+    }
+
+    static void append_varint(std::string& bytes, uint64_t value) {
+        for (; value >= 0x80; value >>= 7) {
+            bytes.push_back(static_cast<char>(value | 0x80));
+        }
+        bytes.push_back(static_cast<char>(value));
+    }
+
+    [[noreturn]] static void throw_error() {
+        throw ngraph_error("Error during import of ONNX model provided as input stream "
+                           " with binary protobuf message.");
+    }
+
+private:
+    std::istream& m_stream;
+    uint64_t m_position = 0;
+};
+
+void parse_tensor(WireFormatReader& reader,
+                  uint64_t end,
+                  const std::string& location,
+                  ONNX_NAMESPACE::TensorProto& tensor) {
+    std::string bytes;
+    uint64_t raw_data_offset = 0;
+    uint64_t raw_data_size = 0;
+    bool raw_data_referenced = false;
+    while (reader.position() < end) {
+        const auto tag = reader.read_varint();
+        if (tag != tensor_raw_data_tag) {
+            reader.copy_field(tag, bytes);
+            continue;
+        }
+        const auto size = reader.read_varint();
+        // the last value of the field is the one which is parsed
+        raw_data_referenced = size >= min_referenced_raw_data_size;
+        if (raw_data_referenced) {
+            raw_data_offset = reader.position();
+            raw_data_size = size;
+            reader.skip(size);
+        } else {
+            WireFormatReader::append_varint(bytes, tag);
+            WireFormatReader::append_varint(bytes, size);
+            reader.read(bytes, size);
+        }
+    }
+    if (reader.position() != end || !tensor.ParseFromString(bytes)) {
+        WireFormatReader::throw_error();
+    }
+    if (raw_data_referenced) {
+        tensor.clear_raw_data();
+        tensor.clear_external_data();
+        tensor.set_data_location(ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL);
+        const std::pair<const char*, std::string> external_data[] = {{"location", location},
+                                                                     {"offset", std::to_string(raw_data_offset)},
+                                                                     {"length", std::to_string(raw_data_size)}};
+        for (const auto& entry : external_data) {
+            auto key_value = tensor.add_external_data();
+            key_value->set_key(entry.first);
+            key_value->set_value(entry.second);
+        }
+    }
+}
+
+void parse_graph(WireFormatReader& reader,
+                 uint64_t end,
+                 const std::string& location,
+                 ONNX_NAMESPACE::GraphProto& graph) {
+    std::string bytes;
+    while (reader.position() < end) {
+        const auto tag = reader.read_varint();
+        if (tag == graph_initializer_tag) {
+            const auto size = reader.read_varint();
+            parse_tensor(reader, reader.position() + size, location, *graph.add_initializer());
+        } else {
+            reader.copy_field(tag, bytes);
+        }
+    }
+    // the initializers are the only repeated field which is added before, so their order is kept
+    if (reader.position() != end || !graph.MergeFromString(bytes)) {
+        WireFormatReader::throw_error();
+    }
+}
+
+/// \brief Parses the model file, the large raw data of the initializers of the main graph isn't read but referred
+///        to as the external data in the model file itself, the location is the name of the file.
+ONNX_NAMESPACE::ModelProto parse_referring_raw_data(std::istream& model_stream, const std::string& location) {
+    WireFormatReader reader{model_stream};
+    ONNX_NAMESPACE::ModelProto model_proto;
+    std::string bytes;
+    while (!reader.at_end()) {
+        const auto tag = reader.read_varint();
+        if (tag == model_graph_tag) {
+            const auto size = reader.read_varint();
+            parse_graph(reader, reader.position() + size, location, *model_proto.mutable_graph());
+        } else {
+            reader.copy_field(tag, bytes);
+        }
+    }
+    if (!model_proto.MergeFromString(bytes)) {
+        WireFormatReader::throw_error();
+    }
+    return model_proto;
+}
+}  // namespace
+
 ONNX_NAMESPACE::ModelProto parse_from_file(const std::string& file_path) {
     std::ifstream file_stream{file_path, std::ios::in | std::ios::binary};
 
@@ -21,7 +203,7 @@ ONNX_NAMESPACE::ModelProto parse_from_file(const std::string& file_path) {
         throw ngraph_error("Could not open the file: " + file_path);
     };
 
-    auto model_proto = parse_from_istream(file_stream);
+    auto model_proto = parse_from_file_stream(file_stream, file_path);
     file_stream.close();
     return model_proto;
 }
@@ -36,12 +218,19 @@ ONNX_NAMESPACE::ModelProto parse_from_file(const std::wstring& file_path) {
         NGRAPH_SUPPRESS_DEPRECATED_END
     };
 
-    auto model_proto = parse_from_istream(file_stream);
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    auto model_proto = parse_from_file_stream(file_stream, file_util::wstring_to_string(file_path));
+    NGRAPH_SUPPRESS_DEPRECATED_END
     file_stream.close();
     return model_proto;
 }
 #endif
 
+ONNX_NAMESPACE::ModelProto parse_from_file_stream(std::istream& file_stream, const std::string& file_path) {
+    // the locations of the external data are relative to the directory of the model
+    return parse_referring_raw_data(file_stream, file_path.substr(file_path.find_last_of("/\\") + 1));
+}
+
 ONNX_NAMESPACE::ModelProto parse_from_istream(std::istream& model_stream) {
     if (!model_stream.good()) {
         model_stream.clear();
@@ -4,14 +4,17 @@
 
 #include "input_model.hpp"
 
+#include <cstring>
 #include <fstream>
 #include <queue>
 
 #include "decoder.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -58,7 +61,9 @@ public:
 private:
     void loadPlaces();
     template <typename T>
-    void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadConsts(const std::basic_string<T>& folder_with_weights,
+                    std::istream* weight_stream,
+                    const std::shared_ptr<ov::util::MappedMemory>& mapped_weights = nullptr);
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
     std::vector<std::shared_ptr<OpPlace>> m_op_places;
@@ -163,6 +168,21 @@ bool read_tensor(std::istream& is, char* data, size_t len) {
     return true;
 }
 
+/// \brief Returns the data of the tensor at the offset of the mapped params file, moves the offset to the next tensor
+char* get_mapped_tensor(ov::util::MappedMemory& mapped_weights, size_t& offset, size_t len) {
+    // the tensor is stored the same way as read_tensor reads it
+    const size_t header_size = 16;
+    uint32_t dims_len = 0;
+    if (offset + header_size + sizeof(dims_len) > mapped_weights.size())
+        return nullptr;
+    std::memcpy(&dims_len, mapped_weights.data() + offset + header_size, sizeof(dims_len));
+    const auto data_offset = offset + header_size + sizeof(dims_len) + dims_len;
+    if (data_offset + len > mapped_weights.size())
+        return nullptr;
+    offset = data_offset + len;
+    return mapped_weights.data() + data_offset;
+}
+
 template <typename T>
 std::basic_string<T> get_const_path(const std::basic_string<T>& folder_with_weights, const std::string& name) {
     return folder_with_weights + paddle::get_path_sep<T>() + name;
@@ -178,16 +198,13 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_file) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (paddle::endsWith(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<T>() + "__model__";
     }
@@ -196,16 +213,14 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path,
+                                          std::basic_string<wchar_t>* weights_file) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (paddle::endsWith(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -262,7 +277,10 @@ std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::determine_cut_
 
 template <typename T>
 void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
-                                            std::istream* weight_stream) {
+                                            std::istream* weight_stream,
+                                            const std::shared_ptr<ov::util::MappedMemory>& mapped_weights) {
+    // the offset of the next tensor in the mapped params file, the tensors are stored in the order of their names
+    size_t mapped_offset = 0;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -276,6 +294,20 @@ void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_w
         Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
         const auto& type = TYPE_MAP[tensor.data_type()];
         const auto& data_length = shape_size(shape) * type.size();
+        if (mapped_weights) {
+            // the constant refers to the mapped file, so the data is neither read nor copied
+            const auto data = get_mapped_tensor(*mapped_weights, mapped_offset, data_length);
+            FRONT_END_GENERAL_CHECK(data != nullptr,
+                                    "File containing constant with name ",
+                                    name,
+                                    " wasn't successfully read.");
+            using SharedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+            auto buffer = std::make_shared<SharedBuffer>(data, data_length, mapped_weights);
+            auto const_node = std::make_shared<opset7::Constant>(type, shape, buffer);
+            const_node->set_friendly_name(name);
+            m_tensor_values[name] = const_node;
+            continue;
+        }
         std::vector<uint8_t> tensor_data(data_length);
 
         bool read_succeed = false;
@@ -307,8 +339,8 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
       m_input_model(input_model),
       m_telemetry(telemetry) {
     std::string empty_str;
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_path;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_path), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -321,6 +353,26 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         version >= 2000000 || version == 0,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
+    if (!weights_path.empty()) {
+        // The combined params file is mapped rather than read, so the constants refer to the file pages which are
+        // loaded on demand. The reading is kept as a fallback for the file systems which don't support the mapping.
+        std::shared_ptr<ov::util::MappedMemory> mapped_weights;
+        try {
+            mapped_weights = ov::util::load_mmap_object(weights_path);
+        } catch (const std::exception&) {
+            mapped_weights.reset();
+        }
+        if (mapped_weights && mapped_weights->size() > 0) {
+            loadConsts(std::basic_string<T>{}, nullptr, mapped_weights);
+            return;
+        }
+    }
+    std::ifstream weights_stream;
+    if (!weights_path.empty()) {
+        weights_stream.open(weights_path, std::ios::binary);
+        // Don't throw error if file isn't opened
+        // It may mean that model don't have constants
+    }
     if (weights_stream && weights_stream.is_open()) {
         loadConsts(std::basic_string<T>{}, &weights_stream);
     } else {
@@ -28,52 +28,49 @@ const std::map<::tensorflow::DataType, ov::element::Type>& TYPE_MAP() {
 }  // namespace
 
 ov::Any DecoderProto::get_attribute(const std::string& name, const std::type_info& type_info) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
-        return {};
-    }
+    const auto& attr = decode_attribute_helper(name);
 
     if (type_info == typeid(std::string)) {
-        return attrs[0].s();
+        return attr.s();
     } else if (type_info == typeid(int64_t)) {
-        return attrs[0].i();
+        return attr.i();
     } else if (type_info == typeid(std::vector<int64_t>)) {
         std::vector<int64_t> longs;
-        longs.reserve(attrs[0].list().i_size());
-        for (size_t idx = 0; idx < attrs[0].list().i_size(); ++idx) {
-            longs.push_back(attrs[0].list().i(idx));
+        longs.reserve(attr.list().i_size());
+        for (size_t idx = 0; idx < attr.list().i_size(); ++idx) {
+            longs.push_back(attr.list().i(idx));
         }
         return longs;
     } else if (type_info == typeid(int32_t)) {
-        return static_cast<int32_t>(attrs[0].i());
+        return static_cast<int32_t>(attr.i());
     } else if (type_info == typeid(std::vector<int32_t>)) {
         std::vector<int32_t> ints;
-        ints.reserve(attrs[0].list().i_size());
-        for (size_t idx = 0; idx < attrs[0].list().i_size(); ++idx) {
-            ints.push_back(static_cast<int32_t>(attrs[0].list().i(idx)));
+        ints.reserve(attr.list().i_size());
+        for (size_t idx = 0; idx < attr.list().i_size(); ++idx) {
+            ints.push_back(static_cast<int32_t>(attr.list().i(idx)));
         }
         return ints;
     } else if (type_info == typeid(float)) {
-        return attrs[0].f();
+        return attr.f();
     } else if (type_info == typeid(std::vector<float>)) {
         std::vector<float> floats;
-        floats.reserve(attrs[0].list().i_size());
-        for (size_t idx = 0; idx < attrs[0].list().i_size(); ++idx) {
-            floats.push_back(attrs[0].list().f(idx));
+        floats.reserve(attr.list().i_size());
+        for (size_t idx = 0; idx < attr.list().i_size(); ++idx) {
+            floats.push_back(attr.list().f(idx));
         }
         return floats;
     } else if (type_info == typeid(ov::element::Type)) {
-        auto data_type = attrs[0].type();
+        auto data_type = attr.type();
         return TYPE_MAP().at(data_type);
     } else if (type_info == typeid(bool)) {
-        return attrs[0].b();
+        return attr.b();
     } else if (type_info == typeid(::tensorflow::DataType)) {
-        return attrs[0].type();
+        return attr.type();
     } else if (type_info == typeid(::tensorflow::TensorProto)) {
-        return attrs[0].tensor();
+        return attr.tensor();
     } else if (type_info == typeid(::ov::PartialShape)) {
         std::vector<ov::Dimension> dims;
-        auto tf_shape = attrs[0].shape();
+        auto tf_shape = attr.shape();
         for (int i = 0; i < tf_shape.dim_size(); i++) {
             dims.push_back(tf_shape.dim(i).size());
         }
@@ -85,6 +82,10 @@ ov::Any DecoderProto::get_attribute(const std::string& name, const std::type_inf
     return {};
 }
 
+const ::tensorflow::TensorProto& DecoderProto::get_tensor_attribute(const std::string& name) const {
+    return decode_attribute_helper(name).tensor();
+}
+
 size_t DecoderProto::get_input_size() const {
     return m_node_def->input_size();
 }
@@ -112,16 +113,16 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
+const ::tensorflow::AttrValue& DecoderProto::decode_attribute_helper(const std::string& name) const {
+    // the attributes are not copied, the values of the Const nodes hold the whole tensors
+    const auto& attr_map = m_node_def->attr();
     FRONT_END_GENERAL_CHECK(attr_map.contains(name),
                             "An error occurred while parsing the ",
                             name,
                             " attribute of ",
                             this->get_op_type(),
                             "node");
-    auto value = m_node_def->attr().at(name);
-    return {value};
+    return attr_map.at(name);
 }
 }  // namespace tensorflow
 }  // namespace frontend
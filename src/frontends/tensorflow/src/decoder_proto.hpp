@@ -22,6 +22,9 @@ public:
 
     ov::Any get_attribute(const std::string& name, const std::type_info& type_info) const override;
 
+    // returns the tensor of the attribute (e.g. the value of Const) in place, ov::Any holds the copy of it
+    const ::tensorflow::TensorProto& get_tensor_attribute(const std::string& name) const;
+
     size_t get_input_size() const override;
 
     void get_input_node(size_t input_port_idx,
@@ -33,7 +36,7 @@ public:
     const std::string& get_op_name() const override;
 
 private:
-    std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
+    const ::tensorflow::AttrValue& decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
 };
 }  // namespace tensorflow
@@ -4,7 +4,12 @@
 
 #include "openvino/frontend/tensorflow/frontend.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "op_table.hpp"
 #include "openvino/frontend/tensorflow/graph_iterator.hpp"
 #include "openvino/pass/manager.hpp"
@@ -43,6 +48,50 @@ void translate_framework_node(const std::shared_ptr<FrameworkNode>& node,
         old_output->replace(*new_output);
     }
 }
+/// \brief Stores the data of the identical constants once, the frozen graphs have many of them, e.g. the shapes
+class ConstantDeduplicator {
+public:
+    /// \brief Returns the constant which refers to the data of the first identical one, or the given one
+    std::shared_ptr<ov::opset8::Constant> deduplicate(const std::shared_ptr<ov::opset8::Constant>& constant) {
+        const auto size = constant->get_byte_size();
+        if (size < min_deduplicated_bytes) {
+            return constant;
+        }
+        const auto data = constant->get_data_ptr<char>();
+        auto& identical_by_hash = m_constants[get_hash(constant->get_element_type(), data, size)];
+        for (const auto& identical : identical_by_hash) {
+            if (identical->get_element_type() == constant->get_element_type() && identical->get_byte_size() == size &&
+                std::memcmp(identical->get_data_ptr(), data, size) == 0) {
+                using SharedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::opset8::Constant>>;
+                auto buffer =
+                    std::make_shared<SharedBuffer>(const_cast<char*>(identical->get_data_ptr<char>()), size, identical);
+                auto shared =
+                    std::make_shared<ov::opset8::Constant>(constant->get_element_type(), constant->get_shape(), buffer);
+                set_node_name(constant->get_friendly_name(), shared);
+                return shared;
+            }
+        }
+        identical_by_hash.push_back(constant);
+        return constant;
+    }
+
+private:
+    static size_t get_hash(const ov::element::Type& type, const char* data, size_t size) {
+        size_t seed = type.hash() ^ size;
+        for (size_t i = 0; i < size; i += sizeof(uint64_t)) {
+            uint64_t word = 0;
+            std::memcpy(&word, data + i, std::min(sizeof(word), size - i));
+            seed ^= static_cast<size_t>(word) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+
+    // the smaller constants take less memory than the buffers referring to the others
+    static constexpr size_t min_deduplicated_bytes = 256;
+    std::unordered_map<size_t, std::vector<std::shared_ptr<ov::opset8::Constant>>> m_constants;
+};
+
+constexpr size_t ConstantDeduplicator::min_deduplicated_bytes;
 }  // namespace
 
 FrontEnd::FrontEnd() : m_op_translators(tensorflow::op::get_supported_ops()) {}
@@ -64,6 +113,7 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
     const auto& model_outputs = model_tf->get_outputs();
     const auto& model_frozen_inputs = model_tf->get_tensor_values();
     std::map<const std::string, const std::function<ov::OutputVector(const NodeContext&)>> translate_map;
+    ConstantDeduplicator constant_deduplicator;
 
     const auto& TRANSLATE_OP_MAP = m_op_translators;
     if (no_conversion) {
@@ -181,6 +231,12 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
             }
         }
 
+        if (operation_decoder->get_op_type() == "Const" && ng_outputs.size() == 1) {
+            if (auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(ng_outputs[0].get_node_shared_ptr())) {
+                ng_outputs[0] = constant_deduplicator.deduplicate(constant);
+            }
+        }
+
         // register OV node outputs in the map for new operation node
         for (const auto& output : ng_outputs) {
             if (auto result = std::dynamic_pointer_cast<ov::opset8::Result>(output.get_node_shared_ptr())) {
@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include <cstring>
+
+#include "decoder_proto.hpp"
 #include "graph_iterator_proto.hpp"
 #include "node_context.hpp"
 #include "openvino/core/validation_util.hpp"
@@ -92,26 +95,42 @@ template <typename T, typename VecT = T>
 void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_shape, std::vector<VecT>* values) {
     TENSORFLOW_OP_VALIDATION(node, node.get_op_type() == "Const", "Node is expected to be Constant.");
     auto dt = node.get_attribute<::tensorflow::DataType>("dtype");
-    auto tensor_proto = node.get_attribute<::tensorflow::TensorProto>("value");
+    // the tensor of the protobuf decoder is read from the attribute in place, the other decoders return its copy
+    ov::Any value;
+    const ::tensorflow::TensorProto* tensor_proto_ptr = nullptr;
+    if (const auto decoder = dynamic_cast<const DecoderProto*>(node.get_decoder())) {
+        tensor_proto_ptr = &decoder->get_tensor_attribute("value");
+    } else {
+        value = node.get_decoder()->get_attribute("value", typeid(::tensorflow::TensorProto));
+        TENSORFLOW_OP_VALIDATION(node, !value.empty(), "Const node has no value.");
+        tensor_proto_ptr = &value.as<::tensorflow::TensorProto>();
+    }
+    const auto& tensor_proto = *tensor_proto_ptr;
     const ::tensorflow::TensorShapeProto& shape = tensor_proto.tensor_shape();
     ov::PartialShape pshape;
     tf_shape_to_ov_shape(shape, &pshape);
     *const_tensor_shape = pshape.get_shape();
     TENSORFLOW_OP_VALIDATION(node, pshape.is_static(), "Dynamic shapes are not supported in Constant conversion.");
-    auto tensor_content = tensor_proto.tensor_content();
-    std::vector<char> tensor_values_plain(tensor_content.begin(), tensor_content.end());
-    const T* tensor_values = reinterpret_cast<const T*>(tensor_values_plain.data());
+    const auto& tensor_content = tensor_proto.tensor_content();
 
-    if (!tensor_values_plain.empty() && tensor_proto.has_tensor_shape()) {
+    if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
         // When tensor_shape is set, theoretically the representation of the data
         // could be compressed. So, before copying values to the returned vector,
         // make sure no compression happens.
-        // if (shape.dim_size() == 1 && shape.dim(0).size() == tensor_values_plain.size()/sizeof(T)) {
-        values->insert(values->end(), tensor_values, tensor_values + tensor_values_plain.size() / sizeof(T));
+        // if (shape.dim_size() == 1 && shape.dim(0).size() == tensor_content.size()/sizeof(T)) {
+        // the content may be unaligned for T, so it is copied by bytes
+        const auto offset = values->size();
+        const auto count = tensor_content.size() / sizeof(T);
+        values->resize(offset + count);
+        for (size_t i = 0; i < count; ++i) {
+            T element;
+            std::memcpy(&element, tensor_content.data() + i * sizeof(T), sizeof(T));
+            (*values)[offset + i] = element;
+        }
         return;
         //}
     }
-    const auto tensor_content_size = tensor_proto.tensor_content().size();
+    const auto tensor_content_size = tensor_content.size();
     if (tensor_content_size % sizeof(VecT)) {
         std::cerr << "[ ERROR ] tensor_content_size (" << tensor_content_size << ") is not a multiple of "
                   << sizeof(VecT);
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <exception>
 #include <future>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -14,13 +16,25 @@
 #include <utility>
 #include <vector>
 
+#include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
+#include "openvino/itt.hpp"
 #include "threading/ie_immediate_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
 
 namespace InferenceEngine {
 
+namespace details {
+/**
+ * @cond
+ */
+OV_ITT_DOMAIN(AsyncInferRequestDomain, "AsyncInferRequest");
+/**
+ * @endcond
+ */
+}  // namespace details
+
 /**
  * @ingroup ie_dev_api_async_infer_request_api
  * @brief Base class with default implementation of asynchronous multi staged inference request.
@@ -100,9 +114,21 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
             _state = InferState::Busy;
         }
         if (state != InferState::Stop) {
+            // the executable network is set after the request is created
+            if (_statistics == nullptr && _exeNetwork != nullptr) {
+                _statistics = _exeNetwork->GetInferRequestsStatistics();
+            }
+            if (_statistics != nullptr) {
+                _statistics->Start();
+            }
+            _startTime = std::chrono::steady_clock::now();
+            _queueWaitRecorded = false;
             try {
                 f();
             } catch (...) {
+                if (_statistics != nullptr) {
+                    _statistics->Abort();
+                }
                 _promise.set_exception(std::current_exception());
                 std::lock_guard<std::mutex> lock{_mutex};
                 _state = InferState::Idle;
@@ -221,6 +247,26 @@ public:
         });
     }
 
+    void StartAsyncSets(const std::vector<std::map<std::string, Blob::Ptr>>& blobSets) override {
+        if (blobSets.empty()) {
+            IE_THROW() << "No sets of blobs to infer";
+        }
+        for (auto&& blob : blobSets.front()) {
+            SetBlob(blob.first, blob.second);
+        }
+        InferImpl([&] {
+            // the next sets are set by the pipeline, which starts itself again after each inference
+            _blobSets.assign(std::next(blobSets.begin()), blobSets.end());
+            _nextBlobSet = 0;
+            try {
+                StartAsync_ThreadUnsafe();
+            } catch (...) {
+                _blobSets.clear();
+                throw;
+            }
+        });
+    }
+
     void Infer() override {
         DisableCallbackGuard disableCallbackGuard{this};
         InferImpl([&] {
@@ -273,6 +319,24 @@ public:
         _callback = std::move(callback);
     }
 
+    void SetDeadline(const std::chrono::steady_clock::time_point& deadline) override {
+        CheckState();
+        IInferRequestInternal::SetDeadline(deadline);
+        _syncRequest->SetDeadline(deadline);
+    }
+
+    void SetPriority(IStreamsExecutor::TaskPriority priority) override {
+        CheckState();
+        IInferRequestInternal::SetPriority(priority);
+        _syncRequest->SetPriority(priority);
+    }
+
+    void SetRequestedOutputs(const std::vector<std::string>& names) override {
+        CheckState();
+        IInferRequestInternal::SetRequestedOutputs(names);
+        _syncRequest->SetRequestedOutputs(names);
+    }
+
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override {
         CheckState();
         return _syncRequest->QueryState();
@@ -315,7 +379,7 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        RunStage(firstStageExecutor, MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
     }
 
     /**
@@ -374,6 +438,23 @@ protected:
     }
 
 private:
+    /**
+     * @brief Runs the stage task, the streams executors schedule it by the priority of the request and the network of
+     * the request is the preemption group, so the inferences of the same network don't preempt one another
+     * @param[in]  executor The stage executor
+     * @param[in]  task The stage task
+     */
+    void RunStage(const ITaskExecutor::Ptr& executor, Task task) {
+        auto streamsExecutor = dynamic_cast<IStreamsExecutor*>(executor.get());
+        if (streamsExecutor != nullptr) {
+            streamsExecutor->runWithPriority(std::move(task),
+                                             GetPriority(),
+                                             _syncRequest->getPointerToExecutableNetworkInternal().get());
+        } else {
+            executor->run(std::move(task));
+        }
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -389,8 +470,19 @@ private:
     Task MakeNextStageTask(const Pipeline::iterator itStage,
                            const Pipeline::iterator itEndStage,
                            const ITaskExecutor::Ptr callbackExecutor) {
+        // the time the stage waits for its executor, it is recorded by the built-in tracer only
+        const auto queuedTimestamp = openvino::itt::timestamp();
         return std::bind(
-            [this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
+            [this, itStage, itEndStage, queuedTimestamp](ITaskExecutor::Ptr& callbackExecutor) mutable {
+                openvino::itt::taskRecord(details::AsyncInferRequestDomain(),
+                                          openvino::itt::handle<struct QueueWaitTask>("QueueWait"),
+                                          queuedTimestamp);
+                if (!_queueWaitRecorded) {
+                    _queueWaitRecorded = true;
+                    if (_statistics != nullptr) {
+                        _statistics->RecordQueueWait(MicrosecondsSinceStart());
+                    }
+                }
                 std::exception_ptr currentException = nullptr;
                 auto& thisStage = *itStage;
                 auto itNextStage = itStage + 1;
@@ -402,14 +494,26 @@ private:
                         auto& nextStage = *itNextStage;
                         auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                         IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                        RunStage(nextStageExecutor,
+                                 MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    } else if (_nextBlobSet < _blobSets.size()) {
+                        for (auto&& blob : _blobSets[_nextBlobSet++]) {
+                            _syncRequest->SetBlob(blob.first, blob.second);
+                        }
+                        _syncRequest->checkBlobs();
+                        StartAsync_ThreadUnsafe();
+                        return;
                     }
                 } catch (...) {
                     currentException = std::current_exception();
                 }
 
                 if ((itEndStage == itNextStage) || (nullptr != currentException)) {
+                    _blobSets.clear();
                     auto lastStageTask = [this, currentException]() mutable {
+                        if (_statistics != nullptr) {
+                            _statistics->Complete(MicrosecondsSinceStart());
+                        }
                         auto promise = std::move(_promise);
                         Callback callback;
                         {
@@ -445,9 +549,22 @@ private:
             std::move(callbackExecutor));
     }
 
+    uint64_t MicrosecondsSinceStart() const {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _startTime)
+                .count());
+    }
+
     std::promise<void> _promise;
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    // the sets of blobs of StartAsyncSets which are not inferred yet
+    std::vector<std::map<std::string, Blob::Ptr>> _blobSets;
+    size_t _nextBlobSet = 0;
+    // the statistics of the executable network and the start of the inference, the busy request uses them
+    std::shared_ptr<InferRequestsStatistics> _statistics;
+    std::chrono::steady_clock::time_point _startTime;
+    bool _queueWaitRecorded = false;
 };
 }  // namespace InferenceEngine
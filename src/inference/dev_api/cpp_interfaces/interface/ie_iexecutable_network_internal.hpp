@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "cpp/ie_cnn_network.h"
+#include "cpp_interfaces/interface/ie_infer_requests_statistics.hpp"
 #include "cpp_interfaces/interface/ie_ivariable_state_internal.hpp"
 #include "ie_parameter.hpp"
 #include "ie_remote_context.hpp"
@@ -148,6 +149,21 @@ public:
      */
     virtual std::shared_ptr<RemoteContext> GetContext() const;
 
+    /**
+     * @brief Compiles the variant of the network for other input shapes. The variant shares the weights and the other
+     * shape independent data with the network, so only the shape dependent parts are compiled.
+     * @param shapes The new shapes of the inputs by their names, the inputs without the shapes keep their ones
+     * @return The independent executable network of the new shapes
+     */
+    virtual std::shared_ptr<IExecutableNetworkInternal> Reshape(const std::map<std::string, ov::PartialShape>& shapes);
+
+    /**
+     * @brief Gets the statistics of the inference requests, they are recorded by AsyncInferRequestThreadSafeDefault
+     * and reported as METRIC_KEY(INFER_REQUESTS_STATISTICS)
+     * @return A shared pointer to the statistics
+     */
+    const std::shared_ptr<InferRequestsStatistics>& GetInferRequestsStatistics() const noexcept;
+
 protected:
     ~IExecutableNetworkInternal() = default;
 
@@ -183,6 +199,9 @@ protected:
      * @note Needed to correctly handle ownership between objects.
      */
     std::shared_ptr<IInferencePlugin> _plugin;
+
+private:
+    std::shared_ptr<InferRequestsStatistics> _inferRequestsStatistics = std::make_shared<InferRequestsStatistics>();
 };
 
 /**
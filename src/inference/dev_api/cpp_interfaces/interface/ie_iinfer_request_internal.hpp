@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -15,6 +17,7 @@
 #include "ie_preprocess_data.hpp"
 #include "openvino/core/node_output.hpp"
 #include "so_ptr.hpp"
+#include "threading/ie_istreams_executor.hpp"
 
 namespace InferenceEngine {
 
@@ -71,6 +74,49 @@ public:
      */
     virtual void Cancel();
 
+    /**
+     * @brief Sets the deadline the following inferences must be completed by
+     * @param deadline - the point in time, std::chrono::steady_clock::time_point::max() means no deadline
+     */
+    virtual void SetDeadline(const std::chrono::steady_clock::time_point& deadline);
+
+    /**
+     * @brief Gets the deadline of the inference request
+     * @return The deadline set by SetDeadline, std::chrono::steady_clock::time_point::max() if there is no deadline
+     */
+    std::chrono::steady_clock::time_point GetDeadline() const {
+        return _deadline._value.load();
+    }
+
+    /**
+     * @brief Sets the priority the following asynchronous inferences are scheduled with by the streams executors
+     * @param priority - the priority of the inferences, the HIGH ones preempt the others at the plugin checkpoints
+     */
+    virtual void SetPriority(IStreamsExecutor::TaskPriority priority);
+
+    /**
+     * @brief Gets the priority of the inference request
+     * @return The priority set by SetPriority, IStreamsExecutor::TaskPriority::NORMAL by default
+     */
+    IStreamsExecutor::TaskPriority GetPriority() const {
+        return _priority;
+    }
+
+    /**
+     * @brief Selects the outputs the following inferences compute, the plugins may skip the layers the other outputs
+     * only depend on. The blobs of the other outputs are not updated by these inferences.
+     * @param names - the names of the network outputs, an empty vector selects all the outputs
+     */
+    virtual void SetRequestedOutputs(const std::vector<std::string>& names);
+
+    /**
+     * @brief Gets the outputs selected by SetRequestedOutputs
+     * @return The names of the selected outputs, an empty vector if all the outputs are computed
+     */
+    const std::vector<std::string>& GetRequestedOutputs() const {
+        return _requestedOutputs;
+    }
+
     /**
      * @brief Queries performance measures per layer to get feedback of what is the most time consuming layer.
      *  Note: not all plugins may provide meaningful data
@@ -163,6 +209,15 @@ public:
      */
     virtual void StartAsync();
 
+    /**
+     * @brief Starts the inferences of the sets of blobs one after another as one asynchronous job: the blobs of a set are
+     * set before its inference, the callback is called and the request becomes ready once after the last one or the
+     * first failed one. Default implementation throws "Not implemented" exception
+     * @param blobSets - per inference, the input and output blobs by the names as in SetBlob. The outputs which are not
+     * set in a set are shared with the previous inferences
+     */
+    virtual void StartAsyncSets(const std::vector<std::map<std::string, Blob::Ptr>>& blobSets);
+
     /**
      * @brief The minimal asynchronous inference function to be implemented by plugins.
      * It starts inference of specified input(s) in asynchronous mode
@@ -241,6 +296,22 @@ public:
     const std::vector<std::shared_ptr<const ov::Node>>& GetInputs() const;
     const std::vector<std::shared_ptr<const ov::Node>>& GetOutputs() const;
 
+    /**
+     * @brief Gets the name of the blob of the model input as in SetBlob/GetBlob, the names are precomputed for the
+     * ports of GetInputs()
+     * @param idx The index of the input in GetInputs()
+     * @return The name of the blob
+     */
+    const std::string& GetInputBlobName(size_t idx) const;
+
+    /**
+     * @brief Gets the name of the blob of the model output as in SetBlob/GetBlob, the names are precomputed for the
+     * ports of GetOutputs()
+     * @param idx The index of the output in GetOutputs()
+     * @return The name of the blob
+     */
+    const std::string& GetOutputBlobName(size_t idx) const;
+
 protected:
     /**
      * @brief Destroys the object.
@@ -303,6 +374,22 @@ protected:
      */
     virtual void checkBlobsForBatch(const std::string& name, const std::vector<Blob::Ptr>& blobs);
 
+    /**
+     * @brief Checks whether the blob is the one validated by SetBlob for the name and is still set as is (the same
+     * descriptor and data), so the blob set again may skip the validation and the rebinding
+     * @param name - a name of input or output blob.
+     * @param blob - the blob to check
+     * @return `True` if the blob was validated, `false` otherwise
+     */
+    bool isBlobValidated(const std::string& name, const Blob::Ptr& blob) const;
+
+    /**
+     * @brief Remembers the blob validated and set by SetBlob for the name, see isBlobValidated
+     * @param name - a name of input or output blob.
+     * @param blob - the validated blob, empty to forget the validated blob of the name
+     */
+    void setBlobValidated(const std::string& name, const Blob::Ptr& blob);
+
     InferenceEngine::InputsDataMap _networkInputs;    //!< Holds information about network inputs info
     InferenceEngine::OutputsDataMap _networkOutputs;  //!< Holds information about network outputs data
     InferenceEngine::BlobMap _inputs;                 //!< A map of user passed blobs for network inputs
@@ -322,7 +409,29 @@ protected:
     Callback _callback;  //!< A callback
 
 private:
+    struct ValidatedBlob {
+        Blob::Ptr blob;
+        TensorDesc desc;
+        const void* data;
+    };
+
+    std::vector<std::string> _parameterNames;                   //!< The blob names of _parameters
+    std::vector<std::string> _resultNames;                      //!< The blob names of _results
+    std::map<std::string, ValidatedBlob> _validatedBlobs;       //!< The blobs validated by SetBlob
     void* _userData = nullptr;
+    // copyable, as the asynchronous requests copy the state of the synchronous ones
+    struct Deadline {
+        Deadline() = default;
+        Deadline(const Deadline& other) : _value{other._value.load()} {}
+        Deadline& operator=(const Deadline& other) {
+            _value = other._value.load();
+            return *this;
+        }
+        std::atomic<std::chrono::steady_clock::time_point> _value{std::chrono::steady_clock::time_point::max()};
+    };
+    Deadline _deadline;
+    IStreamsExecutor::TaskPriority _priority = IStreamsExecutor::TaskPriority::NORMAL;
+    std::vector<std::string> _requestedOutputs;
 };
 
 /**
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the statistics of the inference requests of an executable network
+ * @file ie_infer_requests_statistics.hpp
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The statistics of the inference requests of an executable network: the histograms of the latency and of
+ * the time waiting for the executor, and the number of the requests in flight.
+ * @ingroup ie_dev_api_exec_network_api
+ *
+ * The requests record it without locks, so it is always collected. The histograms are log-linear: the values below 8
+ * have the exact buckets, and every power of two above has 8 buckets, so the relative error of the percentiles is
+ * within 12.5%.
+ */
+class INFERENCE_ENGINE_API_CLASS(InferRequestsStatistics) {
+public:
+    /**
+     * @brief A shared pointer to InferRequestsStatistics
+     */
+    using Ptr = std::shared_ptr<InferRequestsStatistics>;
+
+    /**
+     * @brief The histogram of the values in microseconds
+     */
+    class INFERENCE_ENGINE_API_CLASS(Histogram) {
+    public:
+        /**
+         * @brief Records the value
+         * @param value The value
+         */
+        void Record(uint64_t value) noexcept;
+
+        /**
+         * @brief Adds the statistics of the histogram to the map
+         * @param prefix The prefix of the keys, e.g. "LATENCY_US"
+         * @param statistics The map the <prefix>_SUM, <prefix>_MAX, <prefix>_P50, <prefix>_P90, <prefix>_P99,
+         * <prefix>_P999 and, per non-empty bucket, <prefix>_BUCKET_<upper bound> keys are added to
+         * @return The number of the recorded values
+         */
+        uint64_t Report(const std::string& prefix, std::map<std::string, uint64_t>& statistics) const;
+
+        /**
+         * @brief Returns the index of the bucket of the value
+         * @param value The value
+         * @return The index of the bucket
+         */
+        static size_t BucketIndex(uint64_t value) noexcept;
+
+        /**
+         * @brief Returns the largest value of the bucket
+         * @param index The index of the bucket
+         * @return The inclusive upper bound of the bucket
+         */
+        static uint64_t BucketUpperBound(size_t index) noexcept;
+
+        static constexpr size_t subBuckets = 8;  //!< The buckets per power of two, the first 8 values are exact
+        static constexpr size_t bucketsCount = subBuckets + (64 - 3) * subBuckets;  //!< The buckets of 64-bit values
+
+    private:
+        std::array<std::atomic<uint64_t>, bucketsCount> _buckets = {};
+        std::atomic<uint64_t> _sum{0};
+        std::atomic<uint64_t> _max{0};
+    };
+
+    /**
+     * @brief Called when the inference request is started, before it waits for the executor
+     */
+    void Start() noexcept;
+
+    /**
+     * @brief Records the time the started inference request waited for the executor of its first stage
+     * @param microseconds The time in microseconds
+     */
+    void RecordQueueWait(uint64_t microseconds) noexcept;
+
+    /**
+     * @brief Called when the started inference request is completed, with or without an error
+     * @param microseconds The time since the start in microseconds
+     */
+    void Complete(uint64_t microseconds) noexcept;
+
+    /**
+     * @brief Called when the started inference request failed to be executed, it is not counted in the latency
+     */
+    void Abort() noexcept;
+
+    /**
+     * @brief Returns the statistics, see METRIC_KEY(INFER_REQUESTS_STATISTICS)
+     * @return The map of the statistics
+     */
+    std::map<std::string, uint64_t> GetStatistics() const;
+
+private:
+    Histogram _latency;
+    Histogram _queueWait;
+    std::atomic<uint64_t> _inFlight{0};
+    std::atomic<uint64_t> _maxInFlight{0};
+};
+
+}  // namespace InferenceEngine
@@ -9,6 +9,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -45,6 +49,13 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Time in microseconds the idle threads of the CPU Executor Streams spin waiting for a task before they are
+ * parked, trading the CPU time for the wakeup latency of the tasks (0, no spinning, by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_SPIN_WAIT_US);
+
 /**
  * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
  * stream
@@ -52,6 +63,323 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines whether the CPU runtime parameters cache is shared between all the streams of an executable network
+ * (YES/NO, NO by default). The shared cache is split into per-stream number of independently locked shards.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARED);
+
+/**
+ * @brief Enables warm start of dynamic shape networks (YES/NO, NO by default). The sets of input shapes the network was
+ * inferred with are stored to the CACHE_DIR folder and the shape specific executors are created in advance by the next
+ * load or import of the same network.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPES_WARM_START);
+
+/**
+ * @brief Limits the number of the CPU streams intermediate tensors workspaces kept in the physical memory at the same time.
+ * The workspaces of the idle streams above the limit are released to the OS and restored on the next inference.
+ * Zero (default) means no limit.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WORKSPACE_POOL_CAPACITY);
+
+/**
+ * @brief Defines how the constant weights of CPU networks are placed on NUMA nodes:
+ * CPU_WEIGHTS_REPLICATE_ALL (default) - every NUMA node keeps its own copy of the weights,
+ * CPU_WEIGHTS_REPLICATE_BY_SIZE - every node keeps its own copy of the weights not bigger than CPU_WEIGHTS_REPLICATION_THRESHOLD,
+ * the bigger ones are stored once and shared by all the nodes,
+ * CPU_WEIGHTS_REPLICATE_NONE - all the weights are stored once and shared by all the nodes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_REPLICATION);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_REPLICATE_ALL);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_REPLICATE_BY_SIZE);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_REPLICATE_NONE);
+
+/**
+ * @brief Defines the size in bytes of the biggest weights tensor replicated per NUMA node by the
+ * CPU_WEIGHTS_REPLICATE_BY_SIZE policy (1 MB by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_REPLICATION_THRESHOLD);
+
+/**
+ * @brief Enables sharing of the CPU networks weights between all the networks of the process (YES/NO, NO by default).
+ * The weights are identified by the network content hash, so the identical reordered weights of the same model loaded
+ * several times (e.g. with different number of streams) are stored once.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_SHARING_BY_CONTENT);
+
+/**
+ * @brief Executes the inferences of the CPU network by the streams shared with the other networks of the process with
+ * the same streams configuration, rather than by its own streams (YES/NO, NO by default). The networks are scheduled
+ * by CPU_NETWORK_PRIORITY, then by CPU_NETWORK_WEIGHT
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS);
+
+/**
+ * @brief The priority of the CPU network executed by the shared streams, 0 is the highest one as for the
+ * AUTO_NETWORK_PRIORITY (unsigned integer, 0 by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NETWORK_PRIORITY);
+
+/**
+ * @brief The share of the shared streams time of the CPU network among the networks of the same priority
+ * (positive integer, 1 by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NETWORK_WEIGHT);
+
+/**
+ * @brief The number of the threads of the pool executing the callbacks of the inference requests of the CPU networks,
+ * which is shared by the networks of the same pool configuration, so the streams never execute the user code
+ * (unsigned integer, 0 by default: each network with streams has its own callback thread, and the network without
+ * streams executes the callbacks by the inference thread)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CALLBACK_THREADS);
+
+/**
+ * @brief The first logical core the threads of the CPU_CALLBACK_THREADS pool are pinned to, one thread per core,
+ * e.g. the cores left by the streams (integer, -1 by default: the threads are not pinned)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CALLBACK_THREADS_OFFSET);
+
+/**
+ * @brief The number of the threads of the CPU network executing the preprocessing and the precision conversion of the
+ * inputs of the asynchronous inference requests as the separate stage, so the next request prepares its inputs while the
+ * stream computes the current one (unsigned integer, 0 by default: the stream prepares the inputs)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INPUTS_PREPARATION_THREADS);
+
+/**
+ * @brief Trades the throughput and the memory for the stable latency of every inference of the CPU network
+ * (PluginConfigParams::YES or PluginConfigParams::NO (default)): the intermediate tensors workspace is locked in the RAM
+ * (or at least prefaulted) at the compilation, the constants are prepared at the compilation, and the stream threads
+ * are pinned to the cores and spin waiting for the requests rather than sleeping (unless CPU_BIND_THREAD or
+ * CPU_STREAMS_SPIN_WAIT_US is set explicitly). The memory allocations and the primitives preparations left to the
+ * inference are reported by the CPU_LATE_ALLOCATIONS metric
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_DETERMINISTIC);
+
+/**
+ * @brief Enables dependency-aware execution of independent graph branches in parallel inside one CPU stream
+ * (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief Enables the graph level selection of the nodes layouts which minimizes the total volume of the data moved by
+ * the inserted reorders, instead of the greedy per node selection (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_GLOBAL_LAYOUT_SELECTION);
+
+/**
+ * @brief Defines when the constant nodes of CPU graphs (constant folding and weights repacking) are executed:
+ * CPU_CONSTANTS_ON_COMPILE (default) - during the network loading,
+ * CPU_CONSTANTS_ON_FIRST_INFERENCE - by the first inference of the graph, so the graphs which are never executed
+ * (e.g. not taken If branches) don't prepare their constants at all,
+ * CPU_CONSTANTS_IN_BACKGROUND - asynchronously right after the graph creation, the first inference waits for them
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CONSTANTS_PREPARATION);
+DECLARE_CONFIG_VALUE(CPU_CONSTANTS_ON_COMPILE);
+DECLARE_CONFIG_VALUE(CPU_CONSTANTS_ON_FIRST_INFERENCE);
+DECLARE_CONFIG_VALUE(CPU_CONSTANTS_IN_BACKGROUND);
+
+/**
+ * @brief Comma separated list of the batch sizes (e.g. "1,2,4,8,16,32,64", empty by default) the primitives of the CPU
+ * Convolution nodes with the dynamic batch only are precompiled for on the network loading. A batch of any size is
+ * executed as a sequence of the precompiled buckets, so no primitives are created during the inference.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_BATCH_BUCKETS);
+
+/**
+ * @brief Keeps the int8/int4 weights of the CPU FullyConnected nodes, which are decompressed by the Convert->[Subtract]->Multiply
+ * subgraph with per output channel or group-wise scales, compressed in the memory. The weights are decompressed in the registers
+ * by the FullyConnected kernel instead of being folded to fp32 at the network loading (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_DECOMPRESSION);
+
+/**
+ * @brief Fuses the attention blocks MatMul(Softmax(MatMul(Q, K) [* scale] [+ mask]), V) of the CPU networks into a single
+ * node, so the scores matrix is not materialized in memory. The fused node uses the reference kernel which is slower than
+ * the oneDNN MatMuls for the short sequences, so the fusion is experimental (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_ATTENTION_FUSION);
+
+/**
+ * @brief The max density (the ratio of the non-zero weights) of the fp32 constant weights of the CPU FullyConnected nodes, which
+ * are stored as the masks of the non-zero weights and the non-zero weights only, so the FullyConnected kernel reads less weights
+ * memory. The weights are analyzed at the network loading (floating point number in [0, 1], 0 (disabled) by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_DENSITY);
+
+/**
+ * @brief Quantizes the activations of the fp32 CPU FullyConnected nodes with the constant weights at the runtime, so the
+ * networks without the calibrated FakeQuantize operations use the int8 compute: every row (token) of the activations is
+ * quantized to u8 with its own scale and zero point, the weights are quantized to s8 per output channel at the network
+ * loading (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_QUANTIZATION);
+
+/**
+ * @brief Enables the mixed precision of the CPU networks with ENFORCE_BF16: the numerically sensitive nodes (Softmax, MVN,
+ * NormalizeL2, Reduce and the like) and the nodes following them up to the next compute heavy node are kept in fp32, so
+ * the precision changes only at the inputs of the compute heavy nodes (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_MIXED_PRECISION);
+
+/**
+ * @brief The comma separated names of the nodes of the CPU networks with ENFORCE_BF16 which are kept in fp32,
+ * e.g. the ones a calibration on the validation set found sensitive (empty by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_FP32_NODES);
+
+/**
+ * @brief Time budget in milliseconds of the measured tuning of the CPU streams and threads for the THROUGHPUT/LATENCY
+ * performance hints. A few configurations around the heuristic choice are run at the network loading, the fastest one is
+ * persisted per model and machine under KEY_CACHE_DIR and reused by the next loads (unsigned integer, 0 (disabled) by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HINTS_TUNING_TIME_LIMIT);
+
+/**
+ * @brief Maximum number of bytes of the GPU memory buffers kept by the engine after they are released by the networks,
+ * so the networks created later reuse them instead of the new allocations. The intermediate buffers are allocated by size
+ * classes (4 classes per power of two) when it is set (unsigned integer, 0 (disabled) by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_MEMORY_CACHE_CAPACITY);
+
+/**
+ * @brief Share the intermediate buffers between all the GPU networks of the context, so the memory of the activations is
+ * the maximum of the networks instead of the sum. Valid only when the networks are never executed concurrently, e.g. the
+ * stages of a pipeline executed one after another with a single stream (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_SHARED_ACTIVATIONS);
+
+/**
+ * @brief Maximum number of the compiled programs kept by the GPU plugin for the models loaded with distinct input shapes,
+ * so loading a reshaped model again with the shapes it was already compiled for skips the transformations and the program
+ * build. The programs are evicted in the least recently used order (unsigned integer, 0 (disabled) by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_SHAPES_CACHE_SIZE);
+
+/**
+ * @brief Every Nth inference of each GPU infer request records the per-primitive GPU timestamps, the performance counters
+ * are averaged over the sampled inferences. Unlike KEY_PERF_COUNT, the other inferences keep the usual synchronization of
+ * the queue, so it's cheap enough to be kept on in production (unsigned integer, 0 (disabled) by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_PROFILING_SAMPLING_RATE);
+
+/**
+ * @brief Time budget in milliseconds of the GPU on-line tuning (KEY_TUNING_MODE is TUNING_CREATE or TUNING_RETUNE) of a single
+ * primitive. The candidate implementations are measured in the priority order until it's exceeded (0 (no limit) by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_TUNING_TIME_LIMIT);
+
+/**
+ * @brief Number of the in-order GPU queues the independent branches of a network are scheduled to. The queues are synchronized
+ * by the markers at the joins of the branches only, so the branches may run concurrently. More than one queue makes the context
+ * created by the plugin use the in-order queues (unsigned integer, 1 by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(GPU_QUEUES_NUM);
+
+/**
+ * @brief Latency budget in milliseconds of a request of the automatic batching. When it's set, the time a batch is collected
+ * for is adapted per worker to the measured arrival interval of the requests and the batched and the batch1 execution times,
+ * instead of the fixed KEY_AUTO_BATCH_TIMEOUT (unsigned integer, 0 (disabled) by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_BUDGET);
+
+/**
+ * @brief Enables the compilation of the smaller batches of the automatic batching (each is a quarter of the previous one,
+ * e.g. 4 for the batch 16), so the requests collected by the timeout are executed with the smallest batch that fits them,
+ * rather than one by one with batch1 (PluginConfigParams::YES or PluginConfigParams::NO (default))
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LADDER);
+
+/**
+ * @brief Maximum number of the asynchronous infer requests a subgraph of the HETERO executable network executes at once.
+ * The rest wait in the queue of the subgraph, so the requests are pipelined through the devices of the subgraphs without
+ * overloading one of them (unsigned integer, 0 (no limit) by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(HETERO_PIPELINE_STAGE_REQUESTS);
+
+/**
+ * @brief Assigns the layers of a HETERO network without the user affinities to the devices minimizing the estimated
+ * latency: the execution of the layers on the devices and the transfers of the tensors between them, rather than to the
+ * first fallback device supporting them (PluginConfigParams::YES or PluginConfigParams::NO (default))
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(HETERO_COST_BASED_PARTITIONING);
+
+/**
+ * @brief Splits a HETERO network without the user affinities to the ranges of the layers executed by the fallback devices
+ * in their order, e.g. "GPU.0,GPU.1" or "GPU,CPU", balancing the slowest stage, so the asynchronous requests are
+ * pipelined through the devices, and the weights of a stage fit the HETERO_DEVICES_MEMORY_CAP of its device
+ * (PluginConfigParams::YES or PluginConfigParams::NO (default)). Has priority over HETERO_COST_BASED_PARTITIONING
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(HETERO_PIPELINE_PARTITIONING);
+
+/**
+ * @brief The compute throughput of the HETERO fallback devices for the cost based partitioning, as
+ * "<device>:<multiply-accumulate operations per microsecond>,..." list (by the device type if not listed)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(HETERO_DEVICES_PERFORMANCE);
+
+/**
+ * @brief The limit of the weights bytes the cost based partitioning assigns to the HETERO fallback devices, as
+ * "<device>:<bytes>,..." list (no limit if not listed)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(HETERO_DEVICES_MEMORY_CAP);
+
+/**
+ * @brief The precision the FP32 tensors are transferred in between the subgraphs of a HETERO network executed by
+ * the different devices: "FP16" or "BF16", or empty (default) to transfer them as is. The producer device converts
+ * the tensor before the transfer and the consumer device converts it back, so the transferred bytes are halved at
+ * the cost of the precision of the tensor
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(HETERO_TRANSFER_PRECISION);
+
+/**
+ * @brief Comma separated names of the layers whose output tensors are transferred in the HETERO_TRANSFER_PRECISION,
+ * e.g. the ones known to keep the accuracy. Empty (default) applies it to all the tensors crossing the devices
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(HETERO_TRANSFER_LAYERS);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -64,11 +392,165 @@ DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
  */
 DECLARE_CONFIG_KEY(MULTI_WORK_MODE_AS_AUTO);
 
+/**
+ * @brief Enables the load aware scheduling of the MULTI device (YES/NO, NO by default). The tasks are scheduled to the device
+ * with the least expected completion time estimated by the moving average latency and the number of the busy requests of
+ * the devices, so a faster device which is busy takes the pending tasks over the idle slower ones
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(MULTI_LOAD_AWARE_SCHEDULING);
+
+/**
+ * @brief Keeps the CPU network, which executes the first inferences of the AUTO device while the selected device loads
+ * the network, as the overflow device after the switch: the requests are executed on it when the selected device has
+ * no idle infer requests (PluginConfigParams::YES or PluginConfigParams::NO (default))
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_CPU_HELP_OVERFLOW);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
 DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
 
+/**
+ * @brief The time in milliseconds the Core keeps the list of the available devices enumerated by the plugins, which is
+ * set by Core::SetConfig without a device name (unsigned integer, 0 by default: the devices are enumerated by every
+ * GetAvailableDevices call)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AVAILABLE_DEVICES_CACHE_TTL);
+
+/**
+ * @brief Whether the Core caches the models converted by the frontends other than IR in CACHE_DIR, which is set by
+ * Core::SetConfig without a device name (YES / NO, NO by default). A model read again from the same files is read as
+ * the cached IR without the conversion.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CACHE_CONVERTED_MODELS);
+
 }  // namespace PluginConfigInternalParams
 
+namespace Metrics {
+
+/**
+ * @brief Metric to get hits, misses and evictions counters of the CPU runtime parameters cache of an executable network
+ * as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_RUNTIME_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the reorders inserted into the CPU graph of an executable network with the estimated number
+ * of bytes each of them reads and writes per inference as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_REORDERS_BYTES, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the nodes of the CPU graph of an executable network which execute on the AMX tiles with their
+ * implementation types as `std::map<std::string, std::string>`, empty on the platforms without AMX
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_AMX_NODES, std::map<std::string, std::string>);
+
+/**
+ * @brief Metric to get the number of streams ("<CORE>_STREAMS" keys), executed tasks ("<CORE>_TASKS" keys) and busy time
+ * in microseconds ("<CORE>_BUSY_TIME_US" keys) of the CPU streams executor of an executable network per core type
+ * ("BIG", "LITTLE" or "ANY" for the non hybrid CPUs) as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_STREAMS_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the number of the memory allocations ("ALLOCATIONS" key) and the primitives preparations, which
+ * may include the JIT code generation, ("PREPARATIONS" key) made during the inferences of the CPU executable network,
+ * rather than at its compilation, as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_LATE_ALLOCATIONS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the number of the compiled kernels batches ("BATCHES" key), kernels ("KERNELS" key), kernels loaded
+ * from the cache ("LOADED_KERNELS" key), total build time in microseconds ("BUILD_TIME_US" key) and the number of kernels
+ * and build time of every batch ("BATCH_<bucket>_<part>_KERNELS", "BATCH_<bucket>_<part>_TIME_US" keys) of the GPU
+ * executable network as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(GPU_KERNELS_BUILD_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the number of bytes of the CPU plugin weights resident in the per NUMA node caches ("NUMA_<id>" keys)
+ * and in the cache shared by all the nodes ("SHARED" key) as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_WEIGHTS_RESIDENT_BYTES, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the allocations, reuses and evictions counters, the used, peak used, cached and peak cached bytes
+ * and the fragmentation percent of the GPU memory cache (see GPU_MEMORY_CACHE_CAPACITY) of all the plugin contexts
+ * as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(GPU_MEMORY_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the batch size ("BATCH_SIZE" key) and, per worker request of the automatic batching, the current
+ * timeout in milliseconds ("WORKER_<id>_TIMEOUT_MS" keys), the number of the executed full batches ("WORKER_<id>_BATCHES"),
+ * of the timeouts ("WORKER_<id>_TIMEOUTS") and of the requests executed with batch1 at the timeouts
+ * ("WORKER_<id>_TIMED_OUT_REQUESTS"), and the average arrival interval of the requests, batched and batch1 execution times
+ * in microseconds ("WORKER_<id>_ARRIVAL_INTERVAL_US", "WORKER_<id>_BATCH_LATENCY_US", "WORKER_<id>_SINGLE_LATENCY_US"),
+ * and the bytes of the inputs copied by the host to the batched blobs or gathered by the device from the requests' blobs,
+ * in total and for the last batch ("WORKER_<id>_COPIED_BYTES", "WORKER_<id>_GATHERED_BYTES",
+ * "WORKER_<id>_LAST_BATCH_COPIED_BYTES", "WORKER_<id>_LAST_BATCH_GATHERED_BYTES"), and the number of the timed out requests
+ * executed with the smaller compiled batches of the KEY_AUTO_BATCH_LADDER ("WORKER_<id>_LADDER_REQUESTS") and of these
+ * batches ("WORKER_<id>_LADDER_BATCHES") as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the handoff of the AUTO device from the CPU network executing the first inferences to the selected
+ * device: the time in microseconds since the network loading began till the first completed inference
+ * ("FIRST_INFERENCE_TIME_US" key), till the selected device loaded the network ("ACTUAL_DEVICE_READY_TIME_US") and till its
+ * first completed inference ("ACTUAL_DEVICE_FIRST_INFERENCE_TIME_US"), zero if not happened yet, and the number of the
+ * inferences executed on the CPU ("CPU_HELP_INFERENCES"), on it after the selected device loaded the network
+ * ("CPU_HELP_INFERENCES_AFTER_SWITCH") and on the selected device ("ACTUAL_DEVICE_INFERENCES")
+ * as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_HANDOFF_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get, per subgraph of the HETERO executable network, the number of the asynchronous inferences
+ * ("STAGE_<id>_INFERENCES" keys), their average latency and time waiting for the subgraph in microseconds
+ * ("STAGE_<id>_LATENCY_US", "STAGE_<id>_WAIT_US"), the biggest number of the waiting requests ("STAGE_<id>_MAX_QUEUED")
+ * and the limit of the requests executed at once ("STAGE_<id>_REQUESTS", see HETERO_PIPELINE_STAGE_REQUESTS)
+ * as `std::map<std::string, uint64_t>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HETERO_PIPELINE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the devices the layers of the HETERO executable network are assigned to
+ * as `std::map<std::string, std::string>`
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION, std::map<std::string, std::string>);
+
+/**
+ * @brief Metric to get, for the asynchronous inference requests of any executable network, the number of the completed
+ * inferences ("INFERENCES" key), of the requests started and not completed yet ("IN_FLIGHT") and the biggest one
+ * ("MAX_IN_FLIGHT"), and the histograms of the latency and of the time waiting for the executor of the first stage in
+ * microseconds: the sum, max and 50, 90, 99 and 99.9 percentiles ("LATENCY_US_SUM", "LATENCY_US_MAX", "LATENCY_US_P50",
+ * "LATENCY_US_P90", "LATENCY_US_P99", "LATENCY_US_P999" and the same "QUEUE_WAIT_US_*" keys), which are the upper bounds
+ * of the buckets within 12.5% of the value, and the counts of the non-empty buckets ("LATENCY_US_BUCKET_<upper bound>",
+ * "QUEUE_WAIT_US_BUCKET_<upper bound>") as `std::map<std::string, uint64_t>`.
+ * The metric is served by ExecutableNetwork itself, the requests derived from AsyncInferRequestThreadSafeDefault record it
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(INFER_REQUESTS_STATISTICS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
+
 }  // namespace InferenceEngine
@@ -219,7 +219,8 @@ public:
 
     /**
      * @deprecated Use ImportNetwork(std::istream& networkModel, const std::map<std::string, std::string>& config)
-     * @brief Creates an executable network from an previously exported network
+     * @brief Creates an executable network from an previously exported network. The file is mapped into the memory
+     * and imported through MappedMemoryStream if possible, so the plugin may refer to its data in place.
      * @param modelFileName - path to the location of the exported file
      * @param config A string -> string map of parameters
      * @return An Executable network
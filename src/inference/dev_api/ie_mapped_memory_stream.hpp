@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the input stream over the memory mapped file
+ * @file ie_mapped_memory_stream.hpp
+ */
+
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+
+#include "ie_api.h"
+#include "ie_blob.h"
+#include "openvino/util/mmap_object.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The input stream over the memory mapped file, e.g. the compiled blob read from the model cache.
+ * @ingroup ie_dev_api
+ *
+ * The plugin gets it as the common `std::istream` in `ImportNetwork`, so the plugins which read the stream don't
+ * have to be changed. The plugin which knows about it can find it with `dynamic_cast` and refer to the large data
+ * (e.g. the weights) in place rather than copy them out of the stream:
+ * @code
+ * if (auto mappedStream = dynamic_cast<InferenceEngine::MappedMemoryStream*>(&networkModel)) {
+ *     weights = mappedStream->makeBlob(weightsOffset, weightsSize);  // no copy, keeps the mapping alive
+ * }
+ * @endcode
+ */
+class INFERENCE_ENGINE_API_CLASS(MappedMemoryStream) : public std::istream {
+public:
+    /**
+     * @brief Constructor
+     * @param memory The mapped memory, the positions of the stream are the offsets in it
+     */
+    explicit MappedMemoryStream(std::shared_ptr<ov::util::MappedMemory> memory);
+
+    /**
+     * @brief A destructor
+     */
+    ~MappedMemoryStream() override;
+
+    /**
+     * @brief Returns the mapped memory of the stream
+     * @return The mapped memory, it is valid while there is a reference to it
+     */
+    const std::shared_ptr<ov::util::MappedMemory>& memory() const noexcept;
+
+    /**
+     * @brief Creates the U8 blob which refers to a part of the mapped memory without a copy
+     * @param offset The offset of the data in the mapped memory, e.g. the stream position
+     * @param size The size of the data in bytes
+     * @return The blob, it keeps the mapping alive until it is destroyed
+     */
+    Blob::Ptr makeBlob(size_t offset, size_t size) const;
+
+private:
+    class MappedBuffer : public std::streambuf {
+    public:
+        explicit MappedBuffer(char* data, size_t size);
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+    };
+
+    std::shared_ptr<ov::util::MappedMemory> _memory;
+    MappedBuffer _buffer;
+};
+
+}  // namespace InferenceEngine
@@ -12,6 +12,8 @@
 #include <memory>
 #include <string>
 
+#include <vector>
+
 #include "threading/ie_istreams_executor.hpp"
 
 namespace InferenceEngine {
@@ -20,7 +22,10 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single queue. A new task wakes up the idle stream which
+ *        executed the recent tasks the fastest, so the faster (e.g. Big cores) streams are preferred.
+ *        The prioritized tasks wait in the separate queues: the HIGH priority tasks are taken before all the others and
+ *        are executed by the preempted lower priority tasks if no stream is idle, the LOW priority ones after all.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -44,10 +49,29 @@ public:
 
     void Execute(Task task) override;
 
+    void runWithPriority(Task task, TaskPriority priority, const void* group) override;
+
+    bool Preempt() override;
+
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Execution statistics of a stream
+     */
+    struct StreamStatistics {
+        Config::PreferredCoreType coreType = Config::PreferredCoreType::ANY;  //!< BIG or LITTLE for the hybrid CPUs
+        uint64_t tasks = 0;                                                    //!< Number of the executed tasks
+        uint64_t busyTimeUs = 0;                                               //!< Total tasks execution time
+    };
+
+    /**
+     * @brief Returns the statistics of the streams executing the tasks pushed with run()
+     * @return The vector of statistics per stream
+     */
+    std::vector<StreamStatistics> GetStreamsStatistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -17,6 +17,7 @@
 
 #include "threading/ie_istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
+#include "threading/ie_streams_scheduler.hpp"
 
 namespace InferenceEngine {
 
@@ -29,6 +30,12 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                      unsigned int priority,
+                                                      unsigned int weight);
+
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -40,6 +47,8 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> cpuStreamsExecutors;
+    std::vector<std::pair<IStreamsExecutor::Config, StreamsScheduler::Ptr>> sharedStreamsSchedulers;
+    std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> sharedCPUStreamsExecutors;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
 };
@@ -83,6 +92,26 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns the executor of a model sharing the streams with the other models of the same streams
+     * configuration, the tasks of the models are scheduled by their priorities and weights (see StreamsScheduler)
+     * @param config The streams configuration shared by the models
+     * @param priority The priority of the model, 0 is the highest one
+     * @param weight The share of the streams time of the model among the models of the same priority
+     * @return The executor of the model
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                      unsigned int priority,
+                                                      unsigned int weight);
+
+    /**
+     * @brief Returns the executor shared by all its users of the same streams configuration, e.g. the pool of the
+     * threads executing the callbacks of the inference requests of several models
+     * @param config The streams configuration
+     * @return The executor
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     /**
      * @cond
      */
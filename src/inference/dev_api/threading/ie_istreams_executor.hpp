@@ -103,6 +103,8 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        int _spinWaitUs = 0;  //!< Time the idle stream thread spins waiting for a task before it is parked, so the
+                              //!< new tasks are picked up without the wakeup latency. No spinning by default
 
         /**
          * @brief      A constructor with arguments
@@ -156,6 +158,35 @@ public:
      * @param task A task to start
      */
     virtual void Execute(Task task) = 0;
+
+    /**
+     * @brief The priority of the tasks run by runWithPriority()
+     */
+    enum class TaskPriority : std::uint8_t {
+        LOW,     //!< Is started after the other waiting tasks
+        NORMAL,  //!< The priority of the tasks run by run()
+        HIGH,    //!< Is started before the other waiting tasks and preempts the running tasks of the lower priority
+    };
+
+    /**
+     * @brief Runs the task with the priority. The waiting tasks of the higher priority are started first, and the
+     *        tasks of the lower priority running in all the streams let the waiting HIGH priority tasks execute at
+     *        their preemption points (see Preempt()). Default implementation ignores the priority.
+     * @param task A task to start
+     * @param priority The priority of the task
+     * @param group The tasks of the same group (e.g. of the same model) don't preempt one another, as the nested task
+     *        may wait for the resources the preempted task holds. The tasks without the group are not preempted.
+     */
+    virtual void runWithPriority(Task task, TaskPriority priority, const void* group);
+
+    /**
+     * @brief A preemption point of the task running in a stream (e.g. between the nodes of the inference): executes
+     *        the waiting HIGH priority tasks of the other groups in the calling thread if the task has the lower
+     *        priority and no stream is idle, so the preempted task resumes after them with its progress preserved.
+     *        Default implementation does nothing.
+     * @return `True` if any task was executed, `false` otherwise
+     */
+    virtual bool Preempt();
 };
 
 }  // namespace InferenceEngine
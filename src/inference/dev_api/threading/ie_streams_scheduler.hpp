@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_streams_scheduler.hpp
+ * @brief A header file for the scheduler of the tasks of several models on the shared streams
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class StreamsScheduler
+ * @ingroup ie_dev_api_threading
+ * @brief Shares a streams executor between several models, so they don't oversubscribe the cores with their own
+ *        streams. Every model gets its executor and queue of the tasks. The scheduler executes as many tasks at once as
+ *        the shared executor has streams, the next task is taken from the model of the highest priority, and the models
+ *        of the same priority share the streams time in proportion to their weights (weighted fair queuing).
+ *        The HIGH priority tasks (see IStreamsExecutor::runWithPriority) don't wait in the model queues.
+ */
+class INFERENCE_ENGINE_API_CLASS(StreamsScheduler) : public std::enable_shared_from_this<StreamsScheduler> {
+public:
+    /**
+     * @brief A shared pointer to a StreamsScheduler object
+     */
+    using Ptr = std::shared_ptr<StreamsScheduler>;
+
+    /**
+     * @brief Constructor
+     * @param executor The shared streams executor
+     * @param streams The number of the streams of the executor, the maximal number of the tasks executed at once
+     */
+    StreamsScheduler(const IStreamsExecutor::Ptr& executor, int streams);
+
+    /**
+     * @brief A class destructor, waits for the scheduled tasks
+     */
+    ~StreamsScheduler();
+
+    /**
+     * @brief Creates the executor of a model, which shares the streams with the other models of the scheduler
+     * @param priority The priority of the model, 0 is the highest one, as the AUTO_NETWORK_PRIORITY
+     * @param weight The share of the streams time of the model among the models of the same priority
+     * @return The executor of the model, the tasks are executed by the streams of the shared executor
+     */
+    IStreamsExecutor::Ptr CreateModelExecutor(unsigned int priority, unsigned int weight);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header for properties
+ * of the memory contexts for the CPU plugin
+ *
+ * @file cpu_params.hpp
+ */
+#pragma once
+
+#include <string>
+
+namespace InferenceEngine {
+namespace CPUContextParams {
+/**
+ * @def CPU_PARAM_KEY(name)
+ * @brief Shortcut for defining configuration keys
+ */
+#define CPU_PARAM_KEY(name) ::InferenceEngine::CPUContextParams::PARAM_##name
+
+/**
+ * @def DECLARE_CPU_PARAM_KEY(name, ...)
+ * @brief Shortcut for defining object parameter keys
+ */
+#define DECLARE_CPU_PARAM_KEY(name, ...) static constexpr auto PARAM_##name = #name
+
+/**
+ * @brief This key identifies the ov::runtime::Allocator the context allocates the input, output and intermediate
+ * tensors of the networks compiled with it from, e.g. to get them from the huge pages.
+ * The default allocator is used if the key is absent.
+ */
+DECLARE_CPU_PARAM_KEY(ALLOCATOR, ov::runtime::Allocator);
+
+/**
+ * @brief This key identifies the NUMA node the memory allocated from the context is bound to,
+ * -1 (the default) doesn't bind it
+ */
+DECLARE_CPU_PARAM_KEY(NUMA_NODE_ID, int);
+
+}  // namespace CPUContextParams
+}  // namespace InferenceEngine
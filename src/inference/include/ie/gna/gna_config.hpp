@@ -48,6 +48,14 @@ DECLARE_GNA_CONFIG_KEY(SCALE_FACTOR);
  */
 DECLARE_GNA_CONFIG_KEY(PRECISION);
 
+/**
+ * @brief Comma separated names of the layers which keep the Int16 weights when the precision is I8,
+ * e.g. the layers which lose the accuracy on the calibration set of the application with the Int8 weights.
+ * The rest of the layers use the Int8 weights, so the bandwidth is reduced where the accuracy allows it.
+ * It is not applied to the Int8 inputs and to the networks with FakeQuantize layers. The default value is empty.
+ */
+DECLARE_GNA_CONFIG_KEY(PRECISION_I16_LAYERS);
+
 /**
  * @brief if turned on, dump GNA firmware model into specified file
  */
@@ -135,6 +135,17 @@ public:
      */
     InferRequest create_infer_request();
 
+    /**
+     * @brief Compiles the model for other input shapes. The new compiled model shares the weights and the other shape
+     * independent data with this one, so it's compiled faster and takes less memory than the compilation of the
+     * reshaped model, e.g. to serve the inputs of a few fixed resolutions with the static shapes.
+     *
+     * @note This compiled model stays valid. Plugins without the support throw ov::Exception.
+     * @param partial_shapes The new shapes of the inputs by their tensor names, the other inputs keep their shapes
+     * @return The compiled model of the new shapes
+     */
+    CompiledModel reshape(const std::map<std::string, PartialShape>& partial_shapes);
+
     /**
      * @brief Exports the current executable network.
      *
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -173,6 +174,40 @@ public:
                                 const RemoteContext& context,
                                 const ConfigMap& config = {});
 
+    /**
+     * @brief Creates an executable network from a model object asynchronously.
+     *
+     * The models are compiled by the bounded pool of the threads of the Core, so the application can compile several
+     * models at once without threads of its own. The identical requests in flight (the same model object, device and
+     * config) are compiled once and get the same executable network. The requests of the same model with caching
+     * enabled are serialized by the cache entry, so the later ones import the network from the cache.
+     *
+     * @param model Model object acquired from Core::read_model
+     * @param device_name Name of device to load model to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @return The future of the executable network, it rethrows the exception of the compilation
+     */
+    std::shared_future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                          const std::string& device_name,
+                                                          const ConfigMap& config = {});
+
+    /**
+     * @brief Reads model and creates an executable network from IR or ONNX file asynchronously.
+     *
+     * The same as compile_model_async for the model object, the identical requests in flight are the ones of the same
+     * model path, device and config.
+     *
+     * @param model_path path to model
+     * @param device_name Name of device to load model to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @return The future of the executable network, it rethrows the exception of the compilation
+     */
+    std::shared_future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                          const std::string& device_name,
+                                                          const ConfigMap& config = {});
+
     /**
      * @brief Registers extension
      * @deprecated This method is deprecated. Please use other add_extension methods
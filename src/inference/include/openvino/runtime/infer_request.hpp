@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -47,6 +48,15 @@ class OPENVINO_RUNTIME_API InferRequest {
     friend class ov::runtime::CompiledModel;
 
 public:
+    /**
+     * @brief The priority of the inference request, see set_priority()
+     */
+    enum class Priority {
+        LOW,     //!< The inferences yield the streams to the other ones
+        NORMAL,  //!< The default priority
+        HIGH     //!< The latency critical inferences, they preempt the running inferences of the other models
+    };
+
     /// @brief Default constructor
     InferRequest() = default;
 
@@ -244,6 +254,36 @@ public:
      */
     void cancel();
 
+    /**
+     * @brief Sets the deadline of the inference request. The inference which is still running when the deadline
+     * is exceeded is aborted by the plugin the same way as the canceled one, so ov::runtime::Cancelled is thrown.
+     *
+     * @note The deadline is applied to all the following inferences until another one is set,
+     * std::chrono::steady_clock::time_point::max() disables it. Plugins without the deadline support ignore it.
+     * @param deadline The point in time the inference must be completed by
+     */
+    void set_deadline(const std::chrono::steady_clock::time_point& deadline);
+
+    /**
+     * @brief Sets the priority the asynchronous inferences of the request are scheduled with. The HIGH priority
+     * inference doesn't wait for the running inferences of the other models, they are suspended between their layers
+     * while it runs and then resumed.
+     *
+     * @note The priority is applied to all the following inferences until another one is set.
+     * Plugins without the priority support ignore it.
+     * @param priority The priority of the inferences
+     */
+    void set_priority(Priority priority);
+
+    /**
+     * @brief Selects the outputs the following inferences compute. The plugins execute only the layers the selected
+     * outputs depend on, the tensors of the other outputs keep their previous content.
+     *
+     * @note Plugins without the output selection support compute all the outputs.
+     * @param outputs The outputs of the model to compute, an empty vector selects all of them
+     */
+    void set_requested_outputs(const std::vector<ov::Output<const ov::Node>>& outputs);
+
     /**
      * @brief Queries performance measures per layer to get feedback of what is the most time consuming layer
      *
@@ -259,6 +299,18 @@ public:
      */
     void start_async();
 
+    /**
+     * @brief Starts the inferences of several sets of tensors one after another in asynchronous mode, as one job
+     *
+     * It saves the task submissions and callback dispatches of starting the request per set: the tensors of a set are
+     * set before its inference, and the callback is called and the request becomes ready once, after the last
+     * inference or the first failed one.
+     * @note It returns immediately. To get the outputs of every set, set the output tensors in the sets, the outputs
+     * which are not set are shared by the inferences.
+     * @param tensor_sets Per inference, the input and output tensors by the names of their ports
+     */
+    void start_async(const std::vector<std::map<std::string, Tensor>>& tensor_sets);
+
     /**
      * @brief Waits for the result to become available. Blocks until the result
      * becomes available
@@ -9,15 +9,186 @@
 #    include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "ie_parallel.hpp"
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+namespace {
+
+// the dims of the copy with the strides (in elements) of both the blobs
+struct StridedDim {
+    size_t size;
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+// the transposed inner dims are copied by the square tiles which fit the L1 cache
+constexpr size_t copy_tile = 16;
+// the smaller copies are not split between the threads
+constexpr size_t parallel_copy_threshold = 64 * 1024;
+
+// Removes the dims of size 1, orders the dims by the destination strides (so the writes are sequential)
+// and merges the adjacent dims which are dense in both the blobs
+std::vector<StridedDim> normalize_dims(std::vector<StridedDim> dims) {
+    dims.erase(std::remove_if(dims.begin(),
+                              dims.end(),
+                              [](const StridedDim& dim) {
+                                  return dim.size == 1;
+                              }),
+               dims.end());
+    std::stable_sort(dims.begin(), dims.end(), [](const StridedDim& l, const StridedDim& r) {
+        return l.dst_stride > r.dst_stride;
+    });
+    std::vector<StridedDim> merged;
+    for (const auto& dim : dims) {
+        if (!merged.empty() && merged.back().src_stride == dim.src_stride * dim.size &&
+            merged.back().dst_stride == dim.dst_stride * dim.size) {
+            merged.back().size *= dim.size;
+            merged.back().src_stride = dim.src_stride;
+            merged.back().dst_stride = dim.dst_stride;
+        } else {
+            merged.push_back(dim);
+        }
+    }
+    return merged;
+}
+
+// Copies the N-D array of the element size T between the strided buffers.
+// The outer dims are split between the threads, the inner dim is copied as a contiguous row if it is dense
+// in both the blobs, or transposed by tiles with the dim dense in the source (e.g. NCHW <-> NHWC).
+template <typename T>
+void strided_copy(const T* src, T* dst, std::vector<StridedDim> dims) {
+    dims = normalize_dims(std::move(dims));
+    if (dims.empty()) {
+        *dst = *src;
+        return;
+    }
+
+    const StridedDim inner = dims.back();
+    dims.pop_back();
+
+    // the dim read sequentially when the inner dim is written sequentially
+    auto transposed = std::find_if(dims.begin(), dims.end(), [](const StridedDim& dim) {
+        return dim.src_stride == 1;
+    });
+    const bool with_tiles = inner.dst_stride == 1 && inner.src_stride != 1 && transposed != dims.end();
+    StridedDim tiled = {1, 0, 0};
+    if (with_tiles) {
+        tiled = *transposed;
+        dims.erase(transposed);
+    }
+    const size_t tiles = (tiled.size + copy_tile - 1) / copy_tile;
+
+    const size_t outer = std::accumulate(dims.begin(), dims.end(), tiles, [](size_t count, const StridedDim& dim) {
+        return count * dim.size;
+    });
+
+    auto copy_outer = [&](size_t idx) {
+        const size_t tile = idx % tiles;
+        idx /= tiles;
+        const T* src_ptr = src;
+        T* dst_ptr = dst;
+        for (auto dim = dims.rbegin(); dim != dims.rend(); dim++) {
+            const size_t i = idx % dim->size;
+            idx /= dim->size;
+            src_ptr += i * dim->src_stride;
+            dst_ptr += i * dim->dst_stride;
+        }
+
+        if (with_tiles) {
+            const size_t t_begin = tile * copy_tile;
+            const size_t t_end = std::min(tiled.size, t_begin + copy_tile);
+            for (size_t i_begin = 0; i_begin < inner.size; i_begin += copy_tile) {
+                const size_t i_end = std::min(inner.size, i_begin + copy_tile);
+                for (size_t t = t_begin; t < t_end; t++) {
+                    const T* src_row = src_ptr + t;
+                    T* dst_row = dst_ptr + t * tiled.dst_stride;
+                    for (size_t i = i_begin; i < i_end; i++)
+                        dst_row[i] = src_row[i * inner.src_stride];
+                }
+            }
+        } else if (inner.src_stride == 1 && inner.dst_stride == 1) {
+            std::memcpy(dst_ptr, src_ptr, inner.size * sizeof(T));
+        } else {
+            for (size_t i = 0; i < inner.size; i++)
+                dst_ptr[i * inner.dst_stride] = src_ptr[i * inner.src_stride];
+        }
+    };
+
+    const size_t elements = outer / tiles * tiled.size * inner.size;
+    if (outer == 1 || elements < parallel_copy_threshold) {
+        for (size_t idx = 0; idx < outer; idx++)
+            copy_outer(idx);
+    } else {
+        parallel_for(outer, copy_outer);
+    }
+}
+
+// The strides of the blob in the order of its dims
+SizeVector dims_strides(const TensorDesc& desc) {
+    const auto& blk_desc = desc.getBlockingDesc();
+    const auto& order = blk_desc.getOrder();
+    if (order.size() != desc.getDims().size())
+        IE_THROW() << "Unimplemented blob transformation for the blocked layout";
+    SizeVector strides(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        strides[order[i]] = blk_desc.getStrides()[i];
+    return strides;
+}
+
+void blob_copy_nd(Blob::Ptr src, Blob::Ptr dst) {
+    const auto& src_desc = src->getTensorDesc();
+    const auto& dst_desc = dst->getTensorDesc();
+    const auto& dims = src_desc.getDims();
+    const auto src_strides = dims_strides(src_desc);
+    const auto dst_strides = dims_strides(dst_desc);
+
+    std::vector<StridedDim> strided_dims(dims.size());
+    for (size_t i = 0; i < dims.size(); i++)
+        strided_dims[i] = {dims[i], src_strides[i], dst_strides[i]};
+
+    const auto src_offset = src_desc.getBlockingDesc().getOffsetPadding();
+    const auto dst_offset = dst_desc.getBlockingDesc().getOffsetPadding();
+    switch (src_desc.getPrecision().size()) {
+    case 1:
+        strided_copy(src->cbuffer().as<const uint8_t*>() + src_offset,
+                     dst->buffer().as<uint8_t*>() + dst_offset,
+                     std::move(strided_dims));
+        break;
+    case 2:
+        strided_copy(src->cbuffer().as<const uint16_t*>() + src_offset,
+                     dst->buffer().as<uint16_t*>() + dst_offset,
+                     std::move(strided_dims));
+        break;
+    case 4:
+        strided_copy(src->cbuffer().as<const uint32_t*>() + src_offset,
+                     dst->buffer().as<uint32_t*>() + dst_offset,
+                     std::move(strided_dims));
+        break;
+    case 8:
+        strided_copy(src->cbuffer().as<const uint64_t*>() + src_offset,
+                     dst->buffer().as<uint64_t*>() + dst_offset,
+                     std::move(strided_dims));
+        break;
+    default:
+        IE_THROW() << "Unsupported blob transformation for precision " << src_desc.getPrecision();
+    }
+}
+
+}  // namespace
+
+#ifdef HAVE_SSE
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
+static bool blob_copy_4d_sse42_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
     auto* src_ptr = src->buffer().as<data_t*>();
@@ -49,7 +220,6 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
 
     dst_ptr += dst_blk_desc.getOffsetPadding();
 
-#ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
@@ -63,7 +233,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
                                     static_cast<int>(N),
                                     static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -77,7 +247,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      static_cast<int>(N),
                                      static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
+            return true;
         }
     }
 
@@ -94,7 +264,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
                                     static_cast<int>(N),
                                     static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -108,76 +278,30 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      static_cast<int>(N),
                                      static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
-        }
-    }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
-
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
-    } else {
-        for (size_t i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
+            return true;
         }
     }
+    return false;
 }
 
-static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
+static inline bool blob_copy_4d_sse42(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->getTensorDesc().getPrecision()) {
     case Precision::FP32:
     case Precision::I32:
     case Precision::U32:
-        blob_copy_4d_t<Precision::FP32>(src, dst);
-        break;
-
-    case Precision::FP16:
-    case Precision::U16:
-    case Precision::I16:
-        blob_copy_4d_t<Precision::U16>(src, dst);
-        break;
+        return blob_copy_4d_sse42_t<Precision::FP32>(src, dst);
 
     case Precision::U8:
     case Precision::I8:
-        blob_copy_4d_t<Precision::U8>(src, dst);
-        break;
+        return blob_copy_4d_sse42_t<Precision::U8>(src, dst);
 
     default:
-        IE_THROW() << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
+        return false;
     }
 }
 
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
+static bool blob_copy_5d_sse42_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
     const auto& src_blk_desc = src->getTensorDesc().getBlockingDesc();
@@ -210,7 +334,6 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
     const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
 
-#ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
@@ -227,7 +350,7 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
                                     static_cast<int>(D),
                                     static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -244,7 +367,7 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      static_cast<int>(D),
                                      static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
+            return true;
         }
     }
 
@@ -264,7 +387,7 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
                                     static_cast<int>(D),
                                     static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -281,76 +404,28 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      static_cast<int>(D),
                                      static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
-        }
-    }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        for (size_t i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
+            return true;
         }
     }
+    return false;
 }
 
-static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
+static inline bool blob_copy_5d_sse42(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->getTensorDesc().getPrecision()) {
     case Precision::FP32:
     case Precision::I32:
     case Precision::U32:
-        blob_copy_5d_t<Precision::FP32>(src, dst);
-        break;
-
-    case Precision::FP16:
-    case Precision::U16:
-    case Precision::I16:
-        blob_copy_5d_t<Precision::U16>(src, dst);
-        break;
+        return blob_copy_5d_sse42_t<Precision::FP32>(src, dst);
 
     case Precision::U8:
     case Precision::I8:
-        blob_copy_5d_t<Precision::U8>(src, dst);
-        break;
+        return blob_copy_5d_sse42_t<Precision::U8>(src, dst);
 
     default:
-        IE_THROW() << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
+        return false;
     }
 }
+#endif  // HAVE_SSE
 
 void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->buffer() == nullptr)
@@ -366,12 +441,16 @@ void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getDims() != dst->getTensorDesc().getDims())
         IE_THROW() << "Unimplemented blob transformation from different shapes ";
 
-    if (src->getTensorDesc().getDims().size() == 4)
-        blob_copy_4d(src, dst);
-    else if (src->getTensorDesc().getDims().size() == 5)
-        blob_copy_5d(src, dst);
-    else
-        IE_THROW() << "Unimplemented blob transformation. Only 4d or 5d supported.";
+#ifdef HAVE_SSE
+    // the copies of the interleaved 3 channels use the SSE4.2 kernels
+    const auto rank = src->getTensorDesc().getDims().size();
+    if (rank == 4 && blob_copy_4d_sse42(src, dst))
+        return;
+    if (rank == 5 && blob_copy_5d_sse42(src, dst))
+        return;
+#endif  // HAVE_SSE
+
+    blob_copy_nd(src, dst);
 }
 
 }  // namespace InferenceEngine
@@ -6,6 +6,7 @@
 
 #include "cpp/exception2status.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_common.h"
 #include "ie_executable_network_base.hpp"
 #include "ie_remote_context.hpp"
@@ -33,6 +34,18 @@ namespace InferenceEngine {
         OPENVINO_ASSERT(false, "Unexpected exception");                          \
     }
 
+namespace {
+
+// the statistics of the inference requests are recorded for any plugin, so they are not asked from it
+Parameter GetMetricOf(const IExecutableNetworkInternal& impl, const std::string& name) {
+    if (name == METRIC_KEY(INFER_REQUESTS_STATISTICS)) {
+        return impl.GetInferRequestsStatistics()->GetStatistics();
+    }
+    return impl.GetMetric(name);
+}
+
+}  // namespace
+
 ExecutableNetwork::~ExecutableNetwork() {
     _impl = {};
 }
@@ -98,7 +111,7 @@ Parameter ExecutableNetwork::GetConfig(const std::string& name) const {
 }
 
 Parameter ExecutableNetwork::GetMetric(const std::string& name) const {
-    EXEC_NET_CALL_STATEMENT(return {_impl->GetMetric(name), _so});
+    EXEC_NET_CALL_STATEMENT(return {GetMetricOf(*_impl, name), _so});
 }
 
 RemoteContext::Ptr ExecutableNetwork::GetContext() const {
@@ -203,6 +216,17 @@ InferRequest CompiledModel::create_infer_request() {
     OV_EXEC_NET_CALL_STATEMENT(return {_impl->CreateInferRequest(), _so});
 }
 
+CompiledModel CompiledModel::reshape(const std::map<std::string, PartialShape>& partial_shapes) {
+    OV_EXEC_NET_CALL_STATEMENT({
+        // the plugins take the shapes by the friendly names of the parameters, as ie::CNNNetwork::reshape
+        std::map<std::string, PartialShape> shapes;
+        for (const auto& shape : partial_shapes) {
+            shapes.emplace(input(shape.first).get_node()->get_friendly_name(), shape.second);
+        }
+        return {_impl->Reshape(shapes), _so};
+    });
+}
+
 void CompiledModel::export_model(std::ostream& networkModel) {
     OV_EXEC_NET_CALL_STATEMENT(_impl->Export(networkModel));
 }
@@ -216,7 +240,7 @@ ie::Parameter CompiledModel::get_config(const std::string& name) const {
 }
 
 ie::Parameter CompiledModel::get_metric(const std::string& name) const {
-    OV_EXEC_NET_CALL_STATEMENT(return {_impl->GetMetric(name), _so});
+    OV_EXEC_NET_CALL_STATEMENT(return {ie::GetMetricOf(*_impl, name), _so});
 }
 
 RemoteContext CompiledModel::get_context() const {
@@ -240,6 +240,33 @@ std::string get_legacy_name_from_port(const ov::Output<const ov::Node>& port) {
     return ngraph::op::util::create_ie_output_name(p);
 }
 
+// The ports of the model inputs and outputs use the names precomputed by the request
+std::string get_legacy_name_from_port(const InferenceEngine::IInferRequestInternal& impl,
+                                      const ov::Output<const ov::Node>& port) {
+    if (port.get_index() == 0) {
+        const auto& inputs = impl.GetInputs();
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (inputs[i].get() == port.get_node())
+                return impl.GetInputBlobName(i);
+        }
+        const auto& outputs = impl.GetOutputs();
+        for (size_t i = 0; i < outputs.size(); i++) {
+            if (outputs[i].get() == port.get_node())
+                return impl.GetOutputBlobName(i);
+        }
+    }
+    return get_legacy_name_from_port(port);
+}
+
+InferenceEngine::Blob::Ptr get_blob_by_name(InferenceEngine::IInferRequestInternal& impl, const std::string& name) {
+    OPENVINO_ASSERT(!impl.GetBlobs(name),
+                    "get_tensor shall not be used together with batched "
+                    "set_tensors/set_input_tensors for name '",
+                    name,
+                    "'");
+    return impl.GetBlob(name);
+}
+
 }  // namespace
 
 namespace ov {
@@ -256,7 +283,7 @@ InferRequest::InferRequest(const ie::IInferRequestInternal::Ptr& impl, const std
 }
 
 void InferRequest::set_tensor(const ov::Output<const ov::Node>& port, const Tensor& tensor) {
-    OV_INFER_REQ_CALL_STATEMENT({ _impl->SetBlob(get_legacy_name_from_port(port), tensor._impl); });
+    OV_INFER_REQ_CALL_STATEMENT({ _impl->SetBlob(get_legacy_name_from_port(*_impl, port), tensor._impl); });
 }
 
 void InferRequest::set_tensor(const ov::Output<ov::Node>& port, const Tensor& tensor) {
@@ -288,7 +315,7 @@ void InferRequest::set_tensors(const ov::Output<const ov::Node>& port, const std
     std::transform(tensors.begin(), tensors.end(), std::back_inserter(impls), [](const Tensor& item) {
         return item._impl;
     });
-    OV_INFER_REQ_CALL_STATEMENT({ _impl->SetBlobs(get_legacy_name_from_port(port), impls); })
+    OV_INFER_REQ_CALL_STATEMENT({ _impl->SetBlobs(get_legacy_name_from_port(*_impl, port), impls); })
 }
 
 void InferRequest::set_input_tensor(size_t idx, const Tensor& tensor) {
@@ -300,16 +327,15 @@ void InferRequest::set_input_tensor(size_t idx, const Tensor& tensor) {
                         " was not found! The model has only ",
                         inputs.size(),
                         " inputs.");
-        set_tensor(inputs.at(idx)->output(0), tensor);
+        _impl->SetBlob(_impl->GetInputBlobName(idx), tensor._impl);
     });
 }
 
 void InferRequest::set_input_tensor(const Tensor& tensor) {
     OV_INFER_REQ_CALL_STATEMENT({
-        const auto inputs = _impl->GetInputs();
-        OPENVINO_ASSERT(inputs.size() == 1,
+        OPENVINO_ASSERT(_impl->GetInputs().size() == 1,
                         "set_input_tensor() must be called on a function with exactly one parameter.");
-        set_tensor(inputs.at(0)->output(0), tensor);
+        _impl->SetBlob(_impl->GetInputBlobName(0), tensor._impl);
     });
 }
 
@@ -344,30 +370,20 @@ void InferRequest::set_output_tensor(size_t idx, const Tensor& tensor) {
                         " was not found! The model has only ",
                         outputs.size(),
                         " outputs.");
-        set_tensor(outputs.at(idx)->output(0), tensor);
+        _impl->SetBlob(_impl->GetOutputBlobName(idx), tensor._impl);
     });
 }
 
 void InferRequest::set_output_tensor(const Tensor& tensor) {
     OV_INFER_REQ_CALL_STATEMENT({
-        const auto outputs = _impl->GetOutputs();
-        OPENVINO_ASSERT(outputs.size() == 1,
+        OPENVINO_ASSERT(_impl->GetOutputs().size() == 1,
                         "set_output_tensor() must be called on a function with exactly one parameter.");
-        set_tensor(outputs.at(0)->output(0), tensor);
+        _impl->SetBlob(_impl->GetOutputBlobName(0), tensor._impl);
     });
 }
 
 Tensor InferRequest::get_tensor(const ov::Output<const ov::Node>& port) {
-    OV_INFER_REQ_CALL_STATEMENT({
-        const auto& name = get_legacy_name_from_port(port);
-        OPENVINO_ASSERT(!_impl->GetBlobs(name),
-                        "get_tensor shall not be used together with batched "
-                        "set_tensors/set_input_tensors for name '",
-                        name,
-                        "'");
-        auto blob = _impl->GetBlob(name);
-        return {blob, _so};
-    });
+    OV_INFER_REQ_CALL_STATEMENT({ return {get_blob_by_name(*_impl, get_legacy_name_from_port(*_impl, port)), _so}; });
 }
 
 Tensor InferRequest::get_tensor(const ov::Output<ov::Node>& port) {
@@ -384,30 +400,28 @@ Tensor InferRequest::get_tensor(const std::string& name) {
 }
 
 Tensor InferRequest::get_input_tensor(size_t idx) {
-    OV_INFER_REQ_CALL_STATEMENT({ return get_tensor(_impl->GetInputs().at(idx)->output(0)); });
+    OV_INFER_REQ_CALL_STATEMENT({ return {get_blob_by_name(*_impl, _impl->GetInputBlobName(idx)), _so}; });
 }
 
 Tensor InferRequest::get_output_tensor(size_t idx) {
-    OV_INFER_REQ_CALL_STATEMENT({ return get_tensor(_impl->GetOutputs().at(idx)->output(0)); });
+    OV_INFER_REQ_CALL_STATEMENT({ return {get_blob_by_name(*_impl, _impl->GetOutputBlobName(idx)), _so}; });
 }
 
 Tensor InferRequest::get_input_tensor() {
     OV_INFER_REQ_CALL_STATEMENT({
-        const auto inputs = _impl->GetInputs();
-        if (inputs.size() != 1) {
+        if (_impl->GetInputs().size() != 1) {
             throw ov::Exception("get_input_tensor() must be called on a function with exactly one parameter.");
         }
-        return get_tensor(inputs.at(0)->output(0));
+        return {get_blob_by_name(*_impl, _impl->GetInputBlobName(0)), _so};
     });
 }
 
 Tensor InferRequest::get_output_tensor() {
     OV_INFER_REQ_CALL_STATEMENT({
-        const auto outputs = _impl->GetOutputs();
-        if (outputs.size() != 1) {
+        if (_impl->GetOutputs().size() != 1) {
             throw ov::Exception("get_output_tensor() must be called on a function with exactly one parameter.");
         }
-        return get_tensor(outputs.at(0)->output(0));
+        return {get_blob_by_name(*_impl, _impl->GetOutputBlobName(0)), _so};
     });
 }
 
@@ -419,6 +433,37 @@ void InferRequest::cancel() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->Cancel();)
 }
 
+void InferRequest::set_deadline(const std::chrono::steady_clock::time_point& deadline) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->SetDeadline(deadline);)
+}
+
+void InferRequest::set_priority(Priority priority) {
+    OV_INFER_REQ_CALL_STATEMENT({
+        switch (priority) {
+        case Priority::LOW:
+            _impl->SetPriority(ie::IStreamsExecutor::TaskPriority::LOW);
+            break;
+        case Priority::HIGH:
+            _impl->SetPriority(ie::IStreamsExecutor::TaskPriority::HIGH);
+            break;
+        default:
+            _impl->SetPriority(ie::IStreamsExecutor::TaskPriority::NORMAL);
+            break;
+        }
+    })
+}
+
+void InferRequest::set_requested_outputs(const std::vector<ov::Output<const ov::Node>>& outputs) {
+    OV_INFER_REQ_CALL_STATEMENT({
+        std::vector<std::string> names;
+        names.reserve(outputs.size());
+        for (const auto& output : outputs) {
+            names.push_back(get_legacy_name_from_port(*_impl, output));
+        }
+        _impl->SetRequestedOutputs(names);
+    })
+}
+
 std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
     OV_INFER_REQ_CALL_STATEMENT({
         auto ieInfos = _impl->GetPerformanceCounts();
@@ -461,6 +506,23 @@ void InferRequest::start_async() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->StartAsync();)
 }
 
+void InferRequest::start_async(const std::vector<std::map<std::string, Tensor>>& tensor_sets) {
+    OV_INFER_REQ_CALL_STATEMENT({
+        std::vector<std::map<std::string, ie::Blob::Ptr>> blobSets;
+        for (auto&& tensors : tensor_sets) {
+            std::map<std::string, ie::Blob::Ptr> blobs;
+            for (auto&& tensor : tensors) {
+                ov::Output<const ov::Node> port;
+                OPENVINO_ASSERT(::getPort(port, tensor.first, {_impl->GetInputs(), _impl->GetOutputs()}),
+                                "Port for tensor name " + tensor.first + " was not found.");
+                blobs.emplace(get_legacy_name_from_port(port), tensor.second._impl);
+            }
+            blobSets.push_back(std::move(blobs));
+        }
+        _impl->StartAsyncSets(blobSets);
+    })
+}
+
 void InferRequest::wait() {
     OPENVINO_ASSERT(_impl != nullptr, "InferRequest was not initialized.");
     try {
@@ -107,6 +107,15 @@ std::shared_ptr<RemoteContext> IExecutableNetworkInternal::GetContext() const {
     IE_THROW(NotImplemented);
 }
 
+std::shared_ptr<IExecutableNetworkInternal> IExecutableNetworkInternal::Reshape(
+    const std::map<std::string, ov::PartialShape>&) {
+    IE_THROW(NotImplemented);
+}
+
+const std::shared_ptr<InferRequestsStatistics>& IExecutableNetworkInternal::GetInferRequestsStatistics() const noexcept {
+    return _inferRequestsStatistics;
+}
+
 std::shared_ptr<IInferRequestInternal> IExecutableNetworkInternal::CreateInferRequestImpl(
     InputsDataMap networkInputs,
     OutputsDataMap networkOutputs) {
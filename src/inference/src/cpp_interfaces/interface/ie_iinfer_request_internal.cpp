@@ -59,12 +59,14 @@ IInferRequestInternal::IInferRequestInternal(const std::vector<std::shared_ptr<c
     for (const auto& param : _parameters) {
         const auto& input = create_old_input_data(param->output(0));
         _networkInputs[input->name()] = input;
+        _parameterNames.push_back(input->name());
     }
 
     for (const auto& result : _results) {
         auto input = result->input_value(0);
         const auto& output = create_old_data(ov::Output<const ov::Node>(input.get_node(), input.get_index()));
         _networkOutputs[output->getName()] = output;
+        _resultNames.push_back(output->getName());
     }
 }
 
@@ -81,6 +83,22 @@ void IInferRequestInternal::Cancel() {
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::SetDeadline(const std::chrono::steady_clock::time_point& deadline) {
+    _deadline._value = deadline;
+}
+
+void IInferRequestInternal::SetPriority(IStreamsExecutor::TaskPriority priority) {
+    _priority = priority;
+}
+
+void IInferRequestInternal::SetRequestedOutputs(const std::vector<std::string>& names) {
+    for (const auto& name : names) {
+        if (_networkOutputs.find(name) == _networkOutputs.end())
+            IE_THROW(NotFound) << "Failed to find output with name: '" << name << "'";
+    }
+    _requestedOutputs = names;
+}
+
 std::map<std::string, InferenceEngineProfileInfo> IInferRequestInternal::GetPerformanceCounts() const {
     IE_THROW(NotImplemented);
 }
@@ -92,6 +110,8 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& us
     }
     if (!userBlob)
         IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
+    if (isBlobValidated(name, userBlob))
+        return;
     InputInfo::Ptr foundInput;
     DataPtr foundOutput;
     const bool isInput = findInputAndOutputBlobByName(name, foundInput, foundOutput);
@@ -137,6 +157,7 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& us
             devBlob = userBlob;
         }
         _batched_inputs.erase(name);
+        setBlobValidated(name, preProcRequired ? nullptr : userBlob);
     } else {
         if (compoundBlobPassed) {
             IE_THROW(NotImplemented) << "cannot set compound blob: supported only for input pre-processing";
@@ -158,6 +179,7 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& us
         //     IE_THROW(ParameterMismatch) << "Failed to set Blob with layout not corresponding to user output layout";
         // }
         _outputs[name] = userBlob;
+        setBlobValidated(name, userBlob);
     }
 }
 
@@ -175,6 +197,7 @@ void IInferRequestInternal::SetBlobs(const std::string& name, const std::vector<
 
     checkBlobsForBatch(name, blobs);
 
+    setBlobValidated(name, nullptr);
     SetBlobsImpl(name, std::make_shared<BatchedBlob>(blobs));
 }
 
@@ -378,8 +401,9 @@ Blob::Ptr IInferRequestInternal::GetBlob(const std::string& name) {
 }
 
 BatchedBlob::Ptr IInferRequestInternal::GetBlobs(const std::string& name) {
-    if (_batched_inputs.count(name)) {
-        return _batched_inputs.at(name);
+    auto it = _batched_inputs.find(name);
+    if (it != _batched_inputs.end()) {
+        return it->second;
     }
     return nullptr;
 }
@@ -393,6 +417,8 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& da
         IE_THROW() << "Pre-process can't be set to output blob";
     }
 
+    // the blob is validated again against the new pre-processing
+    setBlobValidated(name, nullptr);
     SetBlob(name, data);
 }
 
@@ -423,6 +449,10 @@ void IInferRequestInternal::StartAsyncImpl() {
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::StartAsyncSets(const std::vector<std::map<std::string, Blob::Ptr>>&) {
+    IE_THROW(NotImplemented);
+}
+
 StatusCode IInferRequestInternal::Wait(int64_t millis_timeout) {
     IE_THROW(NotImplemented);
 }
@@ -539,11 +569,38 @@ void IInferRequestInternal::checkBlob(const Blob::Ptr& blob,
 }
 
 void IInferRequestInternal::checkBlobs() {
+    // the blobs validated by SetBlob are checked already
     for (auto const& input : _inputs) {
-        checkBlob(input.second, input.first, true);
+        if (!isBlobValidated(input.first, input.second))
+            checkBlob(input.second, input.first, true);
     }
     for (auto const& output : _outputs) {
-        checkBlob(output.second, output.first, false);
+        if (!isBlobValidated(output.first, output.second))
+            checkBlob(output.second, output.first, false);
+    }
+}
+
+bool IInferRequestInternal::isBlobValidated(const std::string& name, const Blob::Ptr& blob) const {
+    auto validated = _validatedBlobs.find(name);
+    if (validated == _validatedBlobs.end() || validated->second.blob != blob)
+        return false;
+    // the blob may be replaced since, e.g. by the pre-processing or the batched blobs set for the name
+    if (_preProcData.find(name) != _preProcData.end() || _batched_inputs.find(name) != _batched_inputs.end())
+        return false;
+    auto input = _inputs.find(name);
+    auto output = _outputs.find(name);
+    if ((input == _inputs.end() || input->second != blob) && (output == _outputs.end() || output->second != blob))
+        return false;
+    // the tensor may be reshaped or reallocated by the user since
+    return validated->second.desc == blob->getTensorDesc() &&
+           validated->second.data == blob->cbuffer().as<const void*>();
+}
+
+void IInferRequestInternal::setBlobValidated(const std::string& name, const Blob::Ptr& blob) {
+    if (blob) {
+        _validatedBlobs[name] = {blob, blob->getTensorDesc(), blob->cbuffer().as<const void*>()};
+    } else {
+        _validatedBlobs.erase(name);
     }
 }
 
@@ -621,4 +678,14 @@ const std::vector<std::shared_ptr<const ov::Node>>& IInferRequestInternal::GetIn
 const std::vector<std::shared_ptr<const ov::Node>>& IInferRequestInternal::GetOutputs() const {
     return _results;
 }
+
+const std::string& IInferRequestInternal::GetInputBlobName(size_t idx) const {
+    OPENVINO_ASSERT(idx < _parameterNames.size(), "Input port for index ", idx, " was not found");
+    return _parameterNames[idx];
+}
+
+const std::string& IInferRequestInternal::GetOutputBlobName(size_t idx) const {
+    OPENVINO_ASSERT(idx < _resultNames.size(), "Output port for index ", idx, " was not found");
+    return _resultNames[idx];
+}
 }  // namespace InferenceEngine
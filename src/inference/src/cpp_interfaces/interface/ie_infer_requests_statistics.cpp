@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpp_interfaces/interface/ie_infer_requests_statistics.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace InferenceEngine {
+
+constexpr size_t InferRequestsStatistics::Histogram::subBuckets;
+constexpr size_t InferRequestsStatistics::Histogram::bucketsCount;
+
+namespace {
+
+void UpdateMax(std::atomic<uint64_t>& max, uint64_t value) noexcept {
+    auto current = max.load(std::memory_order_relaxed);
+    while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+size_t HighestBit(uint64_t value) noexcept {
+    size_t bit = 0;
+    for (size_t shift = 32; shift != 0; shift /= 2) {
+        if (value >> shift) {
+            value >>= shift;
+            bit += shift;
+        }
+    }
+    return bit;
+}
+
+}  // namespace
+
+size_t InferRequestsStatistics::Histogram::BucketIndex(uint64_t value) noexcept {
+    if (value < subBuckets) {
+        return static_cast<size_t>(value);
+    }
+    // 3 bits after the highest one select the sub-bucket of the power of two
+    const auto shift = HighestBit(value) - 3;
+    return subBuckets + shift * subBuckets + static_cast<size_t>((value >> shift) & (subBuckets - 1));
+}
+
+uint64_t InferRequestsStatistics::Histogram::BucketUpperBound(size_t index) noexcept {
+    if (index < subBuckets) {
+        return index;
+    }
+    const auto shift = (index - subBuckets) / subBuckets;
+    const uint64_t subBucket = (index - subBuckets) % subBuckets;
+    // wraps around to the max value for the last bucket
+    return ((subBuckets + subBucket + 1) << shift) - 1;
+}
+
+void InferRequestsStatistics::Histogram::Record(uint64_t value) noexcept {
+    _buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+    UpdateMax(_max, value);
+}
+
+uint64_t InferRequestsStatistics::Histogram::Report(const std::string& prefix,
+                                                    std::map<std::string, uint64_t>& statistics) const {
+    // the buckets are read one by one while the requests record, so the snapshot is consistent with itself only
+    std::vector<uint64_t> buckets(bucketsCount);
+    uint64_t count = 0;
+    for (size_t i = 0; i < bucketsCount; ++i) {
+        buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+        count += buckets[i];
+    }
+    const auto max = _max.load(std::memory_order_relaxed);
+    statistics[prefix + "_SUM"] = _sum.load(std::memory_order_relaxed);
+    statistics[prefix + "_MAX"] = max;
+    const std::pair<const char*, uint64_t> percentiles[] = {{"_P50", 500}, {"_P90", 900}, {"_P99", 990}, {"_P999", 999}};
+    for (auto&& percentile : percentiles) {
+        // the value of the rank ceil(count * permille / 1000), it is not greater than the max one
+        const auto rank = (count * percentile.second + 999) / 1000;
+        uint64_t value = 0;
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < bucketsCount && count != 0; ++i) {
+            cumulative += buckets[i];
+            if (cumulative >= rank) {
+                value = std::min(BucketUpperBound(i), max);
+                break;
+            }
+        }
+        statistics[prefix + percentile.first] = value;
+    }
+    for (size_t i = 0; i < bucketsCount; ++i) {
+        if (buckets[i] != 0) {
+            statistics[prefix + "_BUCKET_" + std::to_string(BucketUpperBound(i))] = buckets[i];
+        }
+    }
+    return count;
+}
+
+void InferRequestsStatistics::Start() noexcept {
+    UpdateMax(_maxInFlight, _inFlight.fetch_add(1, std::memory_order_relaxed) + 1);
+}
+
+void InferRequestsStatistics::RecordQueueWait(uint64_t microseconds) noexcept {
+    _queueWait.Record(microseconds);
+}
+
+void InferRequestsStatistics::Complete(uint64_t microseconds) noexcept {
+    _latency.Record(microseconds);
+    _inFlight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void InferRequestsStatistics::Abort() noexcept {
+    _inFlight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::map<std::string, uint64_t> InferRequestsStatistics::GetStatistics() const {
+    std::map<std::string, uint64_t> statistics;
+    statistics["INFERENCES"] = _latency.Report("LATENCY_US", statistics);
+    _queueWait.Report("QUEUE_WAIT_US", statistics);
+    statistics["IN_FLIGHT"] = _inFlight.load(std::memory_order_relaxed);
+    statistics["MAX_IN_FLIGHT"] = _maxInFlight.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+}  // namespace InferenceEngine
@@ -24,6 +24,7 @@
 #include "ie_icore.hpp"
 #include "ie_iextension.h"
 #include "ie_input_info.hpp"
+#include "ie_mapped_memory_stream.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ie_parameter.hpp"
 #include "openvino/core/deprecated.hpp"
@@ -223,6 +224,19 @@ std::shared_ptr<RemoteContext> IInferencePlugin::GetDefaultContext(const ParamMa
 std::shared_ptr<IExecutableNetworkInternal> IInferencePlugin::ImportNetwork(
     const std::string& modelFileName,
     const std::map<std::string, std::string>& config) {
+    // The plugin may refer to the data of the mapped blob in place, so the processes importing the same file
+    // (e.g. in the shared memory: /dev/shm or a memfd by its /proc/<pid>/fd path) share the pages of the weights
+    std::shared_ptr<ov::util::MappedMemory> memory;
+    try {
+        memory = ov::util::load_mmap_object(modelFileName);
+    } catch (const std::exception&) {
+        // e.g. the file system doesn't support the mapping, the blob is read as the stream
+    }
+    if (memory && memory->size() != 0) {
+        MappedMemoryStream networkStream(memory);
+        return ImportNetwork(networkStream, config);
+    }
+
     std::ifstream blobFile(modelFileName, std::ios::binary);
 
     if (!blobFile.is_open()) {
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx2.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+namespace {
+constexpr size_t vlen = 8;
+}  // namespace
+
+size_t f16tof32Arrays_avx2(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    const size_t vnelem = nelem / vlen * vlen;
+    for (size_t i = 0; i < vnelem; i += vlen) {
+        const __m256 x = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(x, vscale), vbias));
+    }
+    return vnelem;
+}
+
+// The hardware conversion rounds to the nearest even and keeps the denormals and the infinities,
+// so the conversion of PrecisionUtils::f32tof16 (rounding the halves up, flushing the denormals and
+// saturating the values out of the f16 range) is repeated with the integer operations
+size_t f32tof16Arrays_avx2(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    const __m256i expMaskF32 = _mm256_set1_epi32(0x7F800000);
+    const __m256i mantMaskF32 = _mm256_set1_epi32(0x007FFFFF);
+    const __m256i absMask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i signMaskF16 = _mm256_set1_epi32(0x8000);
+    const __m256i expMaskF16 = _mm256_set1_epi32(0x7C00);
+    const __m256i nanBitF16 = _mm256_set1_epi32(0x0200);
+    const __m256i maskF16 = _mm256_set1_epi32(0xFFFF);
+    const __m256i minF16 = _mm256_set1_epi32(1 << 10);
+    const __m256i maxF16 = _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m256i expBiasDiff = _mm256_set1_epi32((127 - 15) << 23);
+
+    const __m256 halfULPScale = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23));
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 halfMin16 = _mm256_mul_ps(min16, _mm256_set1_ps(0.5f));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    const size_t vnelem = nelem / vlen * vlen;
+    for (size_t i = 0; i < vnelem; i += vlen) {
+        const __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), vscale), vbias);
+        const __m256i u = _mm256_castps_si256(x);
+        const __m256i s = _mm256_and_si256(_mm256_srli_epi32(u, 16), signMaskF16);
+        const __m256i a = _mm256_and_si256(u, absMask);
+        const __m256i exp = _mm256_and_si256(a, expMaskF32);
+
+        // NAN and INF
+        const __m256i isNanInf = _mm256_cmpeq_epi32(exp, expMaskF32);
+        const __m256i isInf = _mm256_cmpeq_epi32(_mm256_and_si256(a, mantMaskF32), _mm256_setzero_si256());
+        const __m256i nan = _mm256_and_si256(_mm256_or_si256(_mm256_or_si256(s, _mm256_srli_epi32(a, 23 - 10)), nanBitF16),
+                                             maskF16);
+        const __m256i nanInf = _mm256_blendv_epi8(nan, _mm256_or_si256(s, expMaskF16), isInf);
+
+        // round to nearest f16 by adding half of its ULP
+        const __m256 v = _mm256_add_ps(_mm256_castsi256_ps(a), _mm256_mul_ps(_mm256_castsi256_ps(exp), halfULPScale));
+        __m256i h = _mm256_or_si256(_mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(v), expBiasDiff), 23 - 10), s);
+        h = _mm256_blendv_epi8(h, _mm256_or_si256(maxF16, s), _mm256_castps_si256(_mm256_cmp_ps(v, max16, _CMP_GE_OQ)));
+        h = _mm256_blendv_epi8(h, _mm256_or_si256(minF16, s), _mm256_castps_si256(_mm256_cmp_ps(v, min16, _CMP_LT_OQ)));
+        h = _mm256_blendv_epi8(h, s, _mm256_castps_si256(_mm256_cmp_ps(v, halfMin16, _CMP_LT_OQ)));
+        h = _mm256_blendv_epi8(h, nanInf, isNanInf);
+
+        // all the values fit 16 bits, the packed halves of the lanes are gathered to the low 128 bits
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(h, h), 0xD8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(packed));
+    }
+    return vnelem;
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdlib.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+//------------------------------------------------------------------------
+//
+// FP16 conversions manually vectored for AVX2 and F16C (w/o threads)
+//
+// The functions convert the whole vectors of the arrays and return the
+// number of the converted elements, the tail is left to the caller
+//
+//------------------------------------------------------------------------
+
+size_t f16tof32Arrays_avx2(float* dst, const short* src, size_t nelem, float scale, float bias);
+
+size_t f32tof16Arrays_avx2(short* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -16,6 +16,7 @@
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/util/mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -62,6 +63,25 @@ public:
      */
     virtual void readCacheEntry(const std::string& id, StreamReader reader) = 0;
 
+    /**
+     * @brief Function passing the cache entry mapped into the memory
+     *
+     */
+    using MappedReader = std::function<void(const std::shared_ptr<ov::util::MappedMemory>&)>;
+    /**
+     * @brief Callback when Inference Engine intends to read network from cache without copying it
+     *
+     * Client may map the cache entry into the memory and call reader(memory), so the plugin can refer to the
+     * data (e.g. the weights) in place. The optional counterpart of readCacheEntry, which is used otherwise.
+     *
+     * @param id Id of cache (hash of the network)
+     * @param reader Lambda function to be called when the cache entry is mapped
+     * @return `true` if the reader has been called, `false` if the entry can't be mapped
+     */
+    virtual bool readMappedCacheEntry(const std::string& id, MappedReader reader) {
+        return false;
+    }
+
     /**
      * @brief Callback when Inference Engine intends to remove cache entry
      *
@@ -100,8 +120,22 @@ public:
 
 private:
     void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // The entry is written aside and then replaces the old one, so the old one stays valid for the networks
+        // which still refer to its mapping
+        auto blobFileName = getBlobFile(id);
+        auto tempFileName = blobFileName + ".tmp";
+        {
+            std::ofstream stream(tempFileName, std::ios_base::binary | std::ofstream::out);
+            try {
+                writer(stream);
+            } catch (...) {
+                stream.close();
+                std::remove(tempFileName.c_str());
+                throw;
+            }
+        }
+        std::remove(blobFileName.c_str());
+        std::rename(tempFileName.c_str(), blobFileName.c_str());
     }
 
     void readCacheEntry(const std::string& id, StreamReader reader) override {
@@ -112,6 +146,25 @@ private:
         }
     }
 
+    bool readMappedCacheEntry(const std::string& id, MappedReader reader) override {
+        auto blobFileName = getBlobFile(id);
+        if (!FileUtils::fileExist(blobFileName)) {
+            return false;
+        }
+        std::shared_ptr<ov::util::MappedMemory> memory;
+        try {
+            memory = ov::util::load_mmap_object(blobFileName);
+        } catch (const std::exception&) {
+            // e.g. the file system doesn't support the mapping, the entry is read as the stream
+            return false;
+        }
+        if (memory->size() == 0) {
+            return false;
+        }
+        reader(memory);
+        return true;
+    }
+
     void removeCacheEntry(const std::string& id) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName))
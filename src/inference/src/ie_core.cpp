@@ -6,10 +6,18 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "cnn_network_ngraph_impl.hpp"
@@ -23,6 +31,7 @@
 #include "ie_cache_manager.hpp"
 #include "ie_icore.hpp"
 #include "ie_itt.hpp"
+#include "ie_mapped_memory_stream.hpp"
 #include "ie_network_reader.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
@@ -128,6 +137,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         struct CacheConfig {
             std::string _cacheDir;
             std::shared_ptr<ie::ICacheManager> _cacheManager;
+            bool _cacheConvertedModels = false;
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
@@ -144,6 +154,38 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY_INTERNAL(AVAILABLE_DEVICES_CACHE_TTL));
+            if (it != config.end()) {
+                int ttl = -1;
+                try {
+                    ttl = std::stoi(it->second);
+                } catch (const std::exception&) {
+                }
+                if (ttl < 0) {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(AVAILABLE_DEVICES_CACHE_TTL)
+                               << ". Expected only non-negative integer numbers";
+                }
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _availableDevicesCacheTTL = std::chrono::milliseconds{ttl};
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY_INTERNAL(CACHE_CONVERTED_MODELS));
+            if (it != config.end()) {
+                if (it->second != CONFIG_VALUE(YES) && it->second != CONFIG_VALUE(NO)) {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CACHE_CONVERTED_MODELS)
+                               << ". Expected only YES/NO";
+                }
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _cacheConfig._cacheConvertedModels = it->second == CONFIG_VALUE(YES);
+                config.erase(it);
+            }
+        }
+
+        std::chrono::milliseconds getAvailableDevicesCacheTTL() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _availableDevicesCacheTTL;
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -155,6 +197,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::chrono::milliseconds _availableDevicesCacheTTL{0};
     };
 
     // Core settings (cache config, etc)
@@ -195,6 +238,23 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
+    // to create the plugin of a device once, while the plugins of the different devices are created in parallel
+    mutable std::map<std::string, std::shared_ptr<std::mutex>> pluginsCreationMutexes;
+
+    struct AvailableDevices {
+        std::mutex mutex;
+        std::vector<std::string> devices;
+        std::chrono::steady_clock::time_point time;
+        bool valid = false;
+        uint64_t generation = 0;  // of the registry, so the list enumerated before its change is not cached
+    };
+    mutable AvailableDevices availableDevices;
+
+    void InvalidateAvailableDevices() const {
+        std::lock_guard<std::mutex> lock(availableDevices.mutex);
+        availableDevices.valid = false;
+        ++availableDevices.generation;
+    }
 
     const bool newAPI;
 
@@ -276,7 +336,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
         OPENVINO_ASSERT(cacheManager != nullptr);
         try {
-            cacheManager->readCacheEntry(blobId, [&](std::istream& networkStream) {
+            auto readStreamAndImport = [&](std::istream& networkStream) {
                 OV_ITT_SCOPE(FIRST_INFERENCE,
                              ie::itt::domains::IE_LT,
                              "Core::LoadNetworkFromCache::ReadStreamAndImport");
@@ -298,7 +358,17 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 execNetwork = context ? plugin.import_model(networkStream, context, config)
                                       : plugin.import_model(networkStream, config);
                 networkIsImported = true;
-            });
+            };
+            // The mapped blob is not copied, the plugin may refer to the weights in place
+            bool isMapped = cacheManager->readMappedCacheEntry(
+                blobId,
+                [&](const std::shared_ptr<ov::util::MappedMemory>& memory) {
+                    ie::MappedMemoryStream networkStream(memory);
+                    readStreamAndImport(networkStream);
+                });
+            if (!isMapped) {
+                cacheManager->readCacheEntry(blobId, readStreamAndImport);
+            }
         } catch (const HeaderException&) {
             // For these exceptions just remove old cache and set that import didn't work
             cacheManager->removeCacheEntry(blobId);
@@ -441,6 +511,7 @@ public:
                 pluginRegistry[deviceName] = desc;
             }
         }
+        InvalidateAvailableDevices();
     }
 
 #ifdef OPENVINO_STATIC_LIBRARY
@@ -462,6 +533,7 @@ public:
             PluginDescriptor desc{value.m_create_plugin_func, value.m_default_config, value.m_create_extension_func};
             pluginRegistry[deviceName] = desc;
         }
+        InvalidateAvailableDevices();
     }
 
 #endif
@@ -472,7 +544,9 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        const auto cacheConfig = coreConfig.getCacheConfig();
+        const auto& cacheDir = cacheConfig._cacheConvertedModels ? cacheConfig._cacheDir : std::string{};
+        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI, cacheDir);
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model, const ie::Blob::CPtr& weights) const override {
@@ -757,37 +831,63 @@ public:
      * If there more than one device of specific type, they are enumerated with .# suffix.
      */
     std::vector<std::string> GetAvailableDevices() const override {
-        std::vector<std::string> devices;
+        const auto ttl = coreConfig.getAvailableDevicesCacheTTL();
+        uint64_t generation = 0;
+        {
+            std::lock_guard<std::mutex> lock(availableDevices.mutex);
+            if (availableDevices.valid && std::chrono::steady_clock::now() - availableDevices.time < ttl) {
+                return availableDevices.devices;
+            }
+            generation = availableDevices.generation;
+        }
+        const auto time = std::chrono::steady_clock::now();
         const std::string propertyName = METRIC_KEY(AVAILABLE_DEVICES);
 
-        for (auto&& deviceName : GetListOfDevicesInRegistry()) {
-            std::vector<std::string> devicesIDs;
-            try {
-                const ie::Parameter p = GetMetric(deviceName, propertyName);
-                devicesIDs = p.as<std::vector<std::string>>();
-            } catch (const ie::Exception&) {
-                // plugin is not created by e.g. invalid env
-            } catch (const ov::Exception&) {
-                // plugin is not created by e.g. invalid env
-            } catch (const std::runtime_error&) {
-                // plugin is not created by e.g. invalid env
-            } catch (const std::exception& ex) {
-                IE_THROW() << "An exception is thrown while trying to create the " << deviceName
-                           << " device and call GetMetric: " << ex.what();
-            } catch (...) {
-                IE_THROW() << "Unknown exception is thrown while trying to create the " << deviceName
-                           << " device and call GetMetric";
-            }
+        // the plugins are loaded and query their devices in parallel, so the slow ones don't delay the others
+        const auto deviceNames = GetListOfDevicesInRegistry();
+        std::vector<std::future<std::vector<std::string>>> devicesIDs;
+        for (auto&& deviceName : deviceNames) {
+            devicesIDs.push_back(std::async(std::launch::async, [this, deviceName, propertyName] {
+                std::vector<std::string> devicesIDs;
+                try {
+                    const ie::Parameter p = GetMetric(deviceName, propertyName);
+                    devicesIDs = p.as<std::vector<std::string>>();
+                } catch (const ie::Exception&) {
+                    // plugin is not created by e.g. invalid env
+                } catch (const ov::Exception&) {
+                    // plugin is not created by e.g. invalid env
+                } catch (const std::runtime_error&) {
+                    // plugin is not created by e.g. invalid env
+                } catch (const std::exception& ex) {
+                    IE_THROW() << "An exception is thrown while trying to create the " << deviceName
+                               << " device and call GetMetric: " << ex.what();
+                } catch (...) {
+                    IE_THROW() << "Unknown exception is thrown while trying to create the " << deviceName
+                               << " device and call GetMetric";
+                }
+                return devicesIDs;
+            }));
+        }
 
-            if (devicesIDs.size() > 1) {
-                for (auto&& deviceID : devicesIDs) {
+        std::vector<std::string> devices;
+        for (size_t i = 0; i < deviceNames.size(); ++i) {
+            const auto& deviceName = deviceNames[i];
+            const auto deviceIDs = devicesIDs[i].get();
+            if (deviceIDs.size() > 1) {
+                for (auto&& deviceID : deviceIDs) {
                     devices.push_back(deviceName + '.' + deviceID);
                 }
-            } else if (!devicesIDs.empty()) {
+            } else if (!deviceIDs.empty()) {
                 devices.push_back(deviceName);
             }
         }
 
+        std::lock_guard<std::mutex> lock(availableDevices.mutex);
+        if (ttl.count() != 0 && generation == availableDevices.generation) {
+            availableDevices.devices = devices;
+            availableDevices.time = time;
+            availableDevices.valid = true;
+        }
         return devices;
     }
 
@@ -812,113 +912,136 @@ public:
     ov::runtime::InferencePlugin GetCPPPluginByName(const std::string& pluginName) const {
         OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "CoreImpl::GetCPPPluginByName");
 
-        std::lock_guard<std::mutex> lock(pluginsMutex);
         auto deviceName = pluginName;
         if (deviceName == ov::DEFAULT_DEVICE_NAME)
             deviceName = "AUTO";
-        auto it = pluginRegistry.find(deviceName);
-        if (it == pluginRegistry.end()) {
-            if (pluginName == ov::DEFAULT_DEVICE_NAME)
-                IE_THROW() << "No device is provided, so AUTO device is used by default, which failed loading.";
-            else
-                IE_THROW() << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
-        }
-
-        // Plugin is in registry, but not created, let's create
-        auto it_plugin = plugins.find(deviceName);
-        if (it_plugin == plugins.end()) {
-            PluginDescriptor desc = it->second;
-            std::shared_ptr<void> so;
-            try {
-                ov::runtime::InferencePlugin plugin;
+        PluginDescriptor desc;
+        std::shared_ptr<std::mutex> creationMutex;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto it = pluginRegistry.find(deviceName);
+            if (it == pluginRegistry.end()) {
+                if (pluginName == ov::DEFAULT_DEVICE_NAME)
+                    IE_THROW() << "No device is provided, so AUTO device is used by default, which failed loading.";
+                else
+                    IE_THROW() << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
+            auto it_plugin = plugins.find(deviceName);
+            if (it_plugin != plugins.end()) {
+                return it_plugin->second;
+            }
+            auto& mutex = pluginsCreationMutexes[deviceName];
+            if (mutex == nullptr) {
+                mutex = std::make_shared<std::mutex>();
+            }
+            creationMutex = mutex;
+            desc = it->second;
+        }
 
-                if (desc.pluginCreateFunc) {  // static OpenVINO case
-                    std::shared_ptr<ie::IInferencePlugin> plugin_impl;
-                    desc.pluginCreateFunc(plugin_impl);
-                    plugin = InferencePlugin{plugin_impl, {}};
-                } else {
-                    so = ov::util::load_shared_object(desc.libraryLocation.c_str());
-                    std::shared_ptr<ie::IInferencePlugin> plugin_impl;
-                    reinterpret_cast<InferenceEngine::CreatePluginEngineFunc*>(
-                        ov::util::get_symbol(so, InferenceEngine::create_plugin_function))(plugin_impl);
-                    plugin = InferencePlugin{plugin_impl, so};
-                }
+        // Plugin is in registry, but not created, let's create it without locking the other devices
+        std::lock_guard<std::mutex> creationLock(*creationMutex);
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto it_plugin = plugins.find(deviceName);
+            if (it_plugin != plugins.end()) {
+                return it_plugin->second;
+            }
+        }
+        std::shared_ptr<void> so;
+        try {
+            ov::runtime::InferencePlugin plugin;
+
+            if (desc.pluginCreateFunc) {  // static OpenVINO case
+                std::shared_ptr<ie::IInferencePlugin> plugin_impl;
+                desc.pluginCreateFunc(plugin_impl);
+                plugin = InferencePlugin{plugin_impl, {}};
+            } else {
+                so = ov::util::load_shared_object(desc.libraryLocation.c_str());
+                std::shared_ptr<ie::IInferencePlugin> plugin_impl;
+                reinterpret_cast<InferenceEngine::CreatePluginEngineFunc*>(
+                    ov::util::get_symbol(so, InferenceEngine::create_plugin_function))(plugin_impl);
+                plugin = InferencePlugin{plugin_impl, so};
+            }
+
+            {
+                plugin.set_name(deviceName);
+
+                // Set Inference Engine class reference to plugins
+                std::weak_ptr<ie::ICore> mutableCore = std::const_pointer_cast<ie::ICore>(shared_from_this());
+                plugin.set_core(mutableCore);
+            }
 
-                {
-                    plugin.set_name(deviceName);
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            // the config could be set while the plugin was created
+            auto it = pluginRegistry.find(deviceName);
+            if (it != pluginRegistry.end()) {
+                desc.defaultConfig = it->second.defaultConfig;
+            }
 
-                    // Set Inference Engine class reference to plugins
-                    std::weak_ptr<ie::ICore> mutableCore = std::const_pointer_cast<ie::ICore>(shared_from_this());
-                    plugin.set_core(mutableCore);
+            // Add registered extensions to new plugin
+            allowNotImplemented([&]() {
+                for (const auto& ext : extensions) {
+                    plugin.add_extension(ext);
                 }
+            });
 
-                // Add registered extensions to new plugin
-                allowNotImplemented([&]() {
-                    for (const auto& ext : extensions) {
-                        plugin.add_extension(ext);
+            // configuring
+            {
+                if (DeviceSupportsCacheDir(plugin)) {
+                    auto cacheConfig = coreConfig.getCacheConfig();
+                    if (cacheConfig._cacheManager) {
+                        desc.defaultConfig[CONFIG_KEY(CACHE_DIR)] = cacheConfig._cacheDir;
                     }
-                });
+                }
+                allowNotImplemented([&]() {
+                    // Add device specific value to support device_name.device_id cases
+                    std::vector<std::string> supportedConfigKeys =
+                        plugin.get_metric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
+                    auto config_iter = std::find(supportedConfigKeys.begin(),
+                                                 supportedConfigKeys.end(),
+                                                 CONFIG_KEY_INTERNAL(CONFIG_DEVICE_ID));
+                    const bool supportsConfigDeviceID = config_iter != supportedConfigKeys.end();
+                    const std::string deviceKey =
+                        supportsConfigDeviceID ? CONFIG_KEY_INTERNAL(CONFIG_DEVICE_ID) : CONFIG_KEY(DEVICE_ID);
 
-                // configuring
-                {
-                    if (DeviceSupportsCacheDir(plugin)) {
-                        auto cacheConfig = coreConfig.getCacheConfig();
-                        if (cacheConfig._cacheManager) {
-                            desc.defaultConfig[CONFIG_KEY(CACHE_DIR)] = cacheConfig._cacheDir;
+                    for (auto pluginDesc : pluginRegistry) {
+                        InferenceEngine::DeviceIDParser parser(pluginDesc.first);
+                        if (pluginDesc.first.find(deviceName) != std::string::npos &&
+                            !parser.getDeviceID().empty()) {
+                            pluginDesc.second.defaultConfig[deviceKey] = parser.getDeviceID();
+                            plugin.set_config(pluginDesc.second.defaultConfig);
                         }
                     }
-                    allowNotImplemented([&]() {
-                        // Add device specific value to support device_name.device_id cases
-                        std::vector<std::string> supportedConfigKeys =
-                            plugin.get_metric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
-                        auto config_iter = std::find(supportedConfigKeys.begin(),
-                                                     supportedConfigKeys.end(),
-                                                     CONFIG_KEY_INTERNAL(CONFIG_DEVICE_ID));
-                        const bool supportsConfigDeviceID = config_iter != supportedConfigKeys.end();
-                        const std::string deviceKey =
-                            supportsConfigDeviceID ? CONFIG_KEY_INTERNAL(CONFIG_DEVICE_ID) : CONFIG_KEY(DEVICE_ID);
-
-                        for (auto pluginDesc : pluginRegistry) {
-                            InferenceEngine::DeviceIDParser parser(pluginDesc.first);
-                            if (pluginDesc.first.find(deviceName) != std::string::npos &&
-                                !parser.getDeviceID().empty()) {
-                                pluginDesc.second.defaultConfig[deviceKey] = parser.getDeviceID();
-                                plugin.set_config(pluginDesc.second.defaultConfig);
-                            }
-                        }
-                        plugin.set_config(desc.defaultConfig);
-                    });
-
-                    allowNotImplemented([&]() {
-                        for (auto&& extensionLocation : desc.listOfExtentions) {
-                            plugin.add_extension(std::make_shared<ie::Extension>(extensionLocation));
-                        }
-                    });
-                }
+                    plugin.set_config(desc.defaultConfig);
+                });
 
-                // add plugin as extension itself
-                if (desc.extensionCreateFunc) {  // static OpenVINO case
-                    try {
-                        ie::IExtensionPtr ext;
-                        desc.extensionCreateFunc(ext);
-                        AddExtensionUnsafe(ext);
-                    } catch (const ie::GeneralError&) {
-                        // the same extension can be registered multiple times - ignore it!
+                allowNotImplemented([&]() {
+                    for (auto&& extensionLocation : desc.listOfExtentions) {
+                        plugin.add_extension(std::make_shared<ie::Extension>(extensionLocation));
                     }
-                } else {
-                    TryToRegisterLibraryAsExtensionUnsafe(desc.libraryLocation);
-                }
+                });
+            }
 
-                return plugins.emplace(deviceName, plugin).first->second;
-            } catch (const ie::Exception& ex) {
-                IE_THROW() << "Failed to create plugin " << ov::util::from_file_path(desc.libraryLocation)
-                           << " for device " << deviceName << "\n"
-                           << "Please, check your environment\n"
-                           << ex.what() << "\n";
+            // add plugin as extension itself
+            if (desc.extensionCreateFunc) {  // static OpenVINO case
+                try {
+                    ie::IExtensionPtr ext;
+                    desc.extensionCreateFunc(ext);
+                    AddExtensionUnsafe(ext);
+                } catch (const ie::GeneralError&) {
+                    // the same extension can be registered multiple times - ignore it!
+                }
+            } else {
+                TryToRegisterLibraryAsExtensionUnsafe(desc.libraryLocation);
             }
-        } else {
-            return it_plugin->second;
-        };
+
+            return plugins.emplace(deviceName, plugin).first->second;
+        } catch (const ie::Exception& ex) {
+            IE_THROW() << "Failed to create plugin " << ov::util::from_file_path(desc.libraryLocation) << " for device "
+                       << deviceName << "\n"
+                       << "Please, check your environment\n"
+                       << ex.what() << "\n";
+        }
     }
 
     /**
@@ -933,6 +1056,7 @@ public:
         }
 
         plugins.erase(deviceName);
+        InvalidateAvailableDevices();
     }
 
     /**
@@ -963,6 +1087,7 @@ public:
 
         PluginDescriptor desc{pluginPath};
         pluginRegistry[deviceName] = desc;
+        InvalidateAvailableDevices();
     }
 
     /**
@@ -1500,6 +1625,80 @@ namespace runtime {
 class Core::Impl : public CoreImpl {
 public:
     Impl() : ov::runtime::CoreImpl(true) {}
+
+    ~Impl() override {
+        {
+            std::lock_guard<std::mutex> lock(_compileMutex);
+            _compileStopped = true;
+        }
+        _compileQueueCondVar.notify_all();
+        // the queued compilations are finished, so their futures are not broken
+        for (auto&& thread : _compileThreads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * @brief Schedules the compilation to the bounded pool of the compile threads
+     * @param key Identifies the request, the identical requests in flight share the compilation
+     * @param compile Compiles the model
+     */
+    std::shared_future<CompiledModel> CompileModelAsync(const std::string& key, std::function<CompiledModel()> compile) {
+        std::lock_guard<std::mutex> lock(_compileMutex);
+        auto inFlight = _compilationsInFlight.find(key);
+        if (inFlight != _compilationsInFlight.end()) {
+            return inFlight->second;
+        }
+        auto promise = std::make_shared<std::promise<CompiledModel>>();
+        std::shared_future<CompiledModel> future = promise->get_future().share();
+        _compilationsInFlight.emplace(key, future);
+        _compileQueue.emplace_back([this, key, compile, promise] {
+            try {
+                promise->set_value(compile());
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+            std::lock_guard<std::mutex> lock(_compileMutex);
+            _compilationsInFlight.erase(key);
+        });
+        const auto maxCompileThreads = std::max(1u, std::min(4u, std::thread::hardware_concurrency()));
+        if (_idleCompileThreads == 0 && _compileThreads.size() < maxCompileThreads) {
+            _compileThreads.emplace_back([this] {
+                CompileLoop();
+            });
+        }
+        _compileQueueCondVar.notify_one();
+        return future;
+    }
+
+private:
+    void CompileLoop() {
+        for (;;) {
+            std::function<void()> compile;
+            {
+                std::unique_lock<std::mutex> lock(_compileMutex);
+                ++_idleCompileThreads;
+                _compileQueueCondVar.wait(lock, [this] {
+                    return _compileStopped || !_compileQueue.empty();
+                });
+                --_idleCompileThreads;
+                if (_compileQueue.empty()) {
+                    return;
+                }
+                compile = std::move(_compileQueue.front());
+                _compileQueue.pop_front();
+            }
+            compile();
+        }
+    }
+
+    std::mutex _compileMutex;
+    std::condition_variable _compileQueueCondVar;
+    std::deque<std::function<void()>> _compileQueue;
+    std::map<std::string, std::shared_future<CompiledModel>> _compilationsInFlight;
+    std::vector<std::thread> _compileThreads;
+    unsigned int _idleCompileThreads = 0;
+    bool _compileStopped = false;
 };
 
 Core::Core(const std::string& xmlConfigFile) {
@@ -1588,6 +1787,55 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+namespace {
+
+std::string compileRequestKey(const std::string& model,
+                              const std::string& deviceName,
+                              const std::map<std::string, std::string>& config) {
+    std::stringstream key;
+    key << model << '\n' << deviceName;
+    for (auto&& value : config) {
+        key << '\n' << value.first << '=' << value.second;
+    }
+    return key.str();
+}
+
+}  // namespace
+
+std::shared_future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                            const std::string& deviceName,
+                                                            const ConfigMap& config) {
+    // the model is alive while it is compiled, so its address identifies it in the requests in flight
+    std::stringstream modelKey;
+    modelKey << "model:" << model.get();
+    // the compile threads are joined by the destructor of the Impl
+    auto impl = _impl.get();
+    OV_CORE_CALL_STATEMENT({
+        return _impl->CompileModelAsync(compileRequestKey(modelKey.str(), deviceName, config),
+                                        [impl, model, deviceName, config]() -> CompiledModel {
+                                            OV_CORE_CALL_STATEMENT({
+                                                auto exec = impl->LoadNetwork(toCNN(model), deviceName, config);
+                                                return {exec._ptr, exec._so};
+                                            });
+                                        });
+    });
+}
+
+std::shared_future<CompiledModel> Core::compile_model_async(const std::string& modelPath,
+                                                            const std::string& deviceName,
+                                                            const ConfigMap& config) {
+    auto impl = _impl.get();
+    OV_CORE_CALL_STATEMENT({
+        return _impl->CompileModelAsync(compileRequestKey("path:" + modelPath, deviceName, config),
+                                        [impl, modelPath, deviceName, config]() -> CompiledModel {
+                                            OV_CORE_CALL_STATEMENT({
+                                                auto exec = impl->LoadNetwork(modelPath, deviceName, config);
+                                                return {exec._ptr, exec._so};
+                                            });
+                                        });
+    });
+}
+
 void Core::add_extension(const ie::IExtensionPtr& extension) {
     OV_CORE_CALL_STATEMENT(_impl->AddExtension(extension););
 }
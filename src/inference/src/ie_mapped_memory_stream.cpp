@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mapped_memory_stream.hpp"
+
+#include <utility>
+
+#include "ie_allocator.hpp"
+#include "ie_common.h"
+
+namespace InferenceEngine {
+namespace {
+
+/**
+ * @brief The allocator which "allocates" the data of a blob in the mapped memory
+ */
+class MappedMemoryAllocator : public IAllocator {
+public:
+    MappedMemoryAllocator(std::shared_ptr<ov::util::MappedMemory> memory, size_t offset)
+        : _memory{std::move(memory)},
+          _offset{offset} {}
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        if (_offset + size > _memory->size()) {
+            return nullptr;
+        }
+        return _memory->data() + _offset;
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+
+private:
+    std::shared_ptr<ov::util::MappedMemory> _memory;
+    size_t _offset = 0;
+};
+
+}  // namespace
+
+MappedMemoryStream::MappedBuffer::MappedBuffer(char* data, size_t size) {
+    setg(data, data, data + size);
+}
+
+MappedMemoryStream::MappedBuffer::pos_type MappedMemoryStream::MappedBuffer::seekoff(off_type off,
+                                                                                    std::ios_base::seekdir dir,
+                                                                                    std::ios_base::openmode which) {
+    if (!(which & std::ios_base::in)) {
+        return pos_type(off_type(-1));
+    }
+    char* base = nullptr;
+    switch (dir) {
+    case std::ios_base::beg:
+        base = eback();
+        break;
+    case std::ios_base::cur:
+        base = gptr();
+        break;
+    case std::ios_base::end:
+        base = egptr();
+        break;
+    default:
+        return pos_type(off_type(-1));
+    }
+    const off_type position = (base - eback()) + off;
+    if (position < 0 || position > egptr() - eback()) {
+        return pos_type(off_type(-1));
+    }
+    setg(eback(), eback() + position, egptr());
+    return pos_type(position);
+}
+
+MappedMemoryStream::MappedBuffer::pos_type MappedMemoryStream::MappedBuffer::seekpos(pos_type pos,
+                                                                                    std::ios_base::openmode which) {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+MappedMemoryStream::MappedMemoryStream(std::shared_ptr<ov::util::MappedMemory> memory)
+    : std::istream{nullptr},
+      _memory{std::move(memory)},
+      _buffer{_memory ? _memory->data() : nullptr, _memory ? _memory->size() : 0} {
+    rdbuf(&_buffer);
+}
+
+MappedMemoryStream::~MappedMemoryStream() = default;
+
+const std::shared_ptr<ov::util::MappedMemory>& MappedMemoryStream::memory() const noexcept {
+    return _memory;
+}
+
+Blob::Ptr MappedMemoryStream::makeBlob(size_t offset, size_t size) const {
+    if (!_memory || offset > _memory->size() || size > _memory->size() - offset) {
+        IE_THROW() << "The range [" << offset << ", " << offset + size << ") is out of the mapped memory";
+    }
+    auto blob = make_shared_blob<uint8_t>(TensorDesc{Precision::U8, {size}, Layout::C},
+                                          std::make_shared<MappedMemoryAllocator>(_memory, offset));
+    blob->allocate();
+    return blob;
+}
+
+}  // namespace InferenceEngine
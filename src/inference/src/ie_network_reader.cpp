@@ -4,12 +4,19 @@
 
 #include "ie_network_reader.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <fstream>
+#include <functional>
 #include <istream>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <string>
+#include <vector>
 
 #include "cnn_network_ngraph_impl.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -31,6 +38,10 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/core/version.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/util/file_util.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "so_ptr.hpp"
 #include "transformations/rt_info/old_api_map_order_attribute.hpp"
@@ -428,13 +439,171 @@ std::vector<ov::Extension::Ptr> wrap_old_extensions(const std::vector<InferenceE
     return extensions;
 }
 
+template <typename T>
+uint64_t hash_combine(uint64_t seed, const T& a) {
+    // Hash combine formula from boost
+    return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+uint64_t hash_file_content(uint64_t seed, const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    OPENVINO_ASSERT(file, "Cannot open the file ", path);
+    std::string chunk(1 << 20, '\0');
+    while (file) {
+        file.read(&chunk[0], chunk.size());
+        const auto read = static_cast<size_t>(file.gcount());
+        if (read != chunk.size())
+            chunk.resize(read);
+        seed = hash_combine(seed, chunk);
+    }
+    return seed;
+}
+
+/**
+ * @brief Hashes the files of the model directory the model refers to by the relative path, e.g. the ONNX external data.
+ * A file is referenced if its relative path occurs in the model file, a subdirectory is visited only if its relative
+ * path occurs there too, so the unrelated files of the directory are neither hashed nor listed recursively
+ */
+uint64_t hash_referenced_files(uint64_t seed, const std::string& modelPath, const std::string& binPath) {
+    std::ifstream file(modelPath, std::ios::binary);
+    OPENVINO_ASSERT(file, "Cannot open the file ", modelPath);
+    const std::string model((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::string modelDir = ov::util::get_directory(modelPath);
+    if (modelDir == modelPath)
+        modelDir = ".";
+    else if (modelDir.empty())
+        modelDir = "/";
+
+    std::function<void(const std::string&, const std::string&)> visit = [&](const std::string& dir,
+                                                                             const std::string& prefix) {
+        std::vector<std::pair<std::string, bool>> entries;
+        ov::util::iterate_files(
+            dir,
+            [&](const std::string& path, bool is_dir) {
+                entries.emplace_back(path, is_dir);
+            },
+            false,
+            true);
+        // the order of the directory listing is not defined
+        std::sort(entries.begin(), entries.end());
+        for (const auto& entry : entries) {
+            const auto relativePath = prefix + ov::util::get_file_name(entry.first);
+            if (entry.first == modelPath || entry.first == binPath || model.find(relativePath) == std::string::npos)
+                continue;
+            if (entry.second) {
+                visit(entry.first, relativePath + "/");
+            } else {
+                seed = hash_combine(seed, relativePath);
+                seed = hash_file_content(seed, entry.first);
+            }
+        }
+    };
+    visit(modelDir, "");
+    return seed;
+}
+
+/**
+ * @brief Hashes the extensions the model is converted with. Only the operation extensions are identified by their
+ * content (the type of the operation), so the other ones, e.g. the conversion extensions, make the model not cacheable
+ * @return false if the model is not cacheable
+ */
+bool hash_extensions(uint64_t& seed,
+                     const std::vector<IExtensionPtr>& exts,
+                     const std::vector<ov::Extension::Ptr>& ov_exts) {
+    auto extensions = wrap_old_extensions(exts);
+    extensions.insert(extensions.end(), ov_exts.begin(), ov_exts.end());
+    for (const auto& ext : extensions) {
+        const auto op_ext = std::dynamic_pointer_cast<ov::BaseOpExtension>(ext);
+        if (!op_ext)
+            return false;
+        seed = hash_combine(seed, op_ext->get_type_info());
+    }
+    return true;
+}
+
+/**
+ * @brief The name of the converted model in the cache directory, it depends on the content of the model files and of
+ * the files the model refers to, the extensions, the frontend and the OpenVINO build
+ * @return empty string if the model is not cacheable
+ */
+std::string converted_model_cache_name(const std::string& modelPath,
+                                       const std::string& binPath,
+                                       const std::string& frontendName,
+                                       const std::vector<IExtensionPtr>& exts,
+                                       const std::vector<ov::Extension::Ptr>& ov_exts) {
+    uint64_t seed = 0;
+    if (!hash_extensions(seed, exts, ov_exts))
+        return {};
+    seed = hash_file_content(seed, modelPath);
+    if (!binPath.empty())
+        seed = hash_file_content(seed, binPath);
+    seed = hash_referenced_files(seed, modelPath, binPath);
+    seed = hash_combine(seed, frontendName);
+    seed = hash_combine(seed, std::string(ov::get_openvino_version().buildNumber));
+    return "converted_" + frontendName + "_" + std::to_string(seed);
+}
+
+/**
+ * @brief The suffix of the temporary files, unique for the concurrent writers of the same cached model, both of the
+ * process and of the other processes sharing the cache directory
+ */
+std::string unique_temp_suffix() {
+    static std::atomic<uint64_t> counter{0};
+    std::random_device random;
+    return ".tmp" + std::to_string(random()) + "_" + std::to_string(counter++);
+}
+
+ov::frontend::InputModel::Ptr load_cached_model(ov::frontend::FrontEnd::Ptr& FE,
+                                                const std::string& xmlPath,
+                                                const std::string& binPath,
+                                                const std::vector<IExtensionPtr>& exts,
+                                                const std::vector<ov::Extension::Ptr>& ov_exts) {
+    if (!FileUtils::fileExist(xmlPath) || !FileUtils::fileExist(binPath))
+        return nullptr;
+    try {
+        FE = get_frontend_manager().load_by_framework("ir");
+        FE->add_extension(ov_exts);
+        if (!exts.empty())
+            FE->add_extension(wrap_old_extensions(exts));
+        return FE->load(ov::AnyVector{xmlPath, binPath});
+    } catch (const std::exception&) {
+        // the model is converted again and the cached one is replaced
+        return nullptr;
+    }
+}
+
+void cache_converted_model(const std::shared_ptr<ov::Model>& model,
+                           const std::string& xmlPath,
+                           const std::string& binPath) {
+    // the files are renamed when they are complete, so a concurrent reader doesn't see the partial ones. The rename
+    // replaces the file atomically, the one written by a concurrent writer has the same content (the same key).
+    // If the rename fails (e.g. on Windows the target exists) the cached model is already in place
+    const auto suffix = unique_temp_suffix();
+    const auto tmpXmlPath = xmlPath + suffix;
+    const auto tmpBinPath = binPath + suffix;
+    try {
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::Serialize>(tmpXmlPath, tmpBinPath);
+        manager.run_passes(model);
+        if (std::rename(tmpBinPath.c_str(), binPath.c_str()) == 0 &&
+            std::rename(tmpXmlPath.c_str(), xmlPath.c_str()) == 0)
+            return;
+    } catch (const std::exception&) {
+        // the model can't be cached, e.g. it has the operations which are not serializable
+    }
+    std::remove(tmpXmlPath.c_str());
+    std::remove(tmpBinPath.c_str());
+}
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath,
                                 const std::string& binPath,
                                 const std::vector<IExtensionPtr>& exts,
                                 const std::vector<ov::Extension::Ptr>& ov_exts,
-                                bool newAPI) {
+                                bool newAPI,
+                                const std::string& cacheDir) {
 #ifdef ENABLE_IR_V7_READER
     // IR v7 obsolete code
     {
@@ -475,6 +644,19 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
     }
 
     FE = manager.load_by_model(params);
+    std::string cachedXmlPath, cachedBinPath;
+    const auto cachedName = FE && !cacheDir.empty() && FE->get_name() != "ir"
+                                ? converted_model_cache_name(modelPath, binPath, FE->get_name(), exts, ov_exts)
+                                : std::string{};
+    if (!cachedName.empty()) {
+        cachedXmlPath = FileUtils::makePath(cacheDir, cachedName + ".xml");
+        cachedBinPath = FileUtils::makePath(cacheDir, cachedName + ".bin");
+        auto cachedFE = FE;
+        if (auto cachedModel = load_cached_model(cachedFE, cachedXmlPath, cachedBinPath, exts, ov_exts)) {
+            auto ngFunc = cachedFE->convert(cachedModel);
+            return convert_to_cnnnetwork(ngFunc, exts, newAPI);
+        }
+    }
     if (FE) {
         FE->add_extension(ov_exts);
         if (!exts.empty())
@@ -484,6 +666,8 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
 
     if (inputModel) {
         auto ngFunc = FE->convert(inputModel);
+        if (!cachedXmlPath.empty())
+            cache_converted_model(ngFunc, cachedXmlPath, cachedBinPath);
         return convert_to_cnnnetwork(ngFunc, exts, newAPI);
     }
 
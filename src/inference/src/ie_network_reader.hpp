@@ -22,13 +22,16 @@ namespace details {
  * @param exts vector with extensions
  * @param ov_exts vector with OpenVINO extensions
  * @param newAPI Whether this function is called from OpenVINO 2.0 API
+ * @param cacheDir The directory the models converted by the frontends other than IR are cached in as IR, so the next
+ * reads of the same files skip the conversion; if it is empty, the models are not cached
  * @return CNNNetwork
  */
 CNNNetwork ReadNetwork(const std::string& modelPath,
                        const std::string& binPath,
                        const std::vector<IExtensionPtr>& exts,
                        const std::vector<ov::Extension::Ptr>& ov_exts,
-                       bool newAPI);
+                       bool newAPI,
+                       const std::string& cacheDir = {});
 /**
  * @brief Reads IR xml and bin (with the same name) files
  * @param model string with IR
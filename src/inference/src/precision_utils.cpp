@@ -6,21 +6,68 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+#include "ie_system_conf.h"
+#ifdef HAVE_AVX2
+#    include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+// the large arrays (e.g. the weights of the FP16 models) are converted by the blocks in parallel
+constexpr size_t conversionBlockSize = 64 * 1024;
+
+template <typename F>
+void convertByBlocks(size_t nelem, const F& convert) {
+    const size_t nblocks = (nelem + conversionBlockSize - 1) / conversionBlockSize;
+    if (nblocks <= 1) {
+        convert(0, nelem);
+        return;
     }
+    parallel_for(nblocks, [&](size_t block) {
+        const size_t begin = block * conversionBlockSize;
+        convert(begin, std::min(nelem, begin + conversionBlockSize));
+    });
+}
+
+}  // namespace
+
+void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+#ifdef HAVE_AVX2
+    static const bool withAVX2 = with_cpu_x86_avx2();
+#endif
+
+    convertByBlocks(nelem, [&](size_t begin, size_t end) {
+#ifdef HAVE_AVX2
+        if (withAVX2)
+            begin += f16tof32Arrays_avx2(dst + begin, _src + begin, end - begin, scale, bias);
+#endif
+        for (size_t i = begin; i < end; i++) {
+            dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+        }
+    });
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
+#ifdef HAVE_AVX2
+    static const bool withAVX2 = with_cpu_x86_avx2();
+#endif
+
+    convertByBlocks(nelem, [&](size_t begin, size_t end) {
+#ifdef HAVE_AVX2
+        if (withAVX2)
+            begin += f32tof16Arrays_avx2(dst + begin, src + begin, end - begin, scale, bias);
+#endif
+        for (size_t i = begin; i < end; i++) {
+            dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+        }
+    });
 }
 
 // Function to convert F32 into F16
@@ -4,10 +4,14 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -25,6 +29,80 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue (D. Vyukov's), a cell sequence number tells whether
+ *        the cell is ready to be written or read by the position of the producer or the consumer
+ */
+template <typename T>
+class MPMCQueue {
+public:
+    explicit MPMCQueue(size_t capacity) : _cells{new Cell[capacity]}, _mask{capacity - 1} {
+        assert((capacity & _mask) == 0 && "the capacity should be a power of two");
+        for (size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(T& value) {
+        auto position = _enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[position & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (difference == 0) {
+                if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            } else if (difference < 0) {
+                return false;  // full
+            } else {
+                position = _enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& value) {
+        auto position = _dequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[position & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+            if (difference == 0) {
+                if (_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            } else if (difference < 0) {
+                return false;  // empty
+            } else {
+                position = _dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_value = {};
+        cell->_sequence.store(position + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> _sequence;
+        T _value;
+    };
+    std::unique_ptr<Cell[]> _cells;
+    const size_t _mask;
+    // the producers and the consumers don't share the cache line
+    alignas(64) std::atomic<size_t> _enqueuePosition{0};
+    alignas(64) std::atomic<size_t> _dequeuePosition{0};
+};
+
+// the tasks over the capacity wait in the queue guarded by the mutex
+constexpr size_t taskQueueCapacity = 1024;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -87,6 +165,7 @@ struct CPUStreamsExecutor::Impl {
                         _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{}
                                                                     .set_core_type(selected_core_type)
                                                                     .set_max_concurrency(concurrency)});
+                        _coreType = _impl->_config._threadPreferredCoreType;
                     }
                 } else {
                     // assigning the stream to the core type in the round-robin fashion
@@ -105,6 +184,10 @@ struct CPUStreamsExecutor::Impl {
                     _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{}
                                                                 .set_core_type(selected_core_type)
                                                                 .set_max_concurrency(concurrency)});
+                    if (custom::info::core_types().size() > 1)
+                        _coreType = selected_core_type == custom::info::core_types().back()
+                                        ? Config::PreferredCoreType::BIG
+                                        : Config::PreferredCoreType::LITTLE;
                 }
             } else if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{_numaNodeId, concurrency}});
@@ -172,6 +255,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl = nullptr;
         int _streamId = 0;
         int _numaNodeId = 0;
+        Config::PreferredCoreType _coreType = Config::PreferredCoreType::ANY;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -180,8 +264,30 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    /**
+     * @brief The thread serving a stream for the tasks of the common queue and of its local queue. The tasks pushed by
+     *        the stream itself (e.g. the next stages of the inference pipeline) go to the local queue, so they are
+     *        executed by the same stream, unless the idle streams of the same NUMA node steal them
+     */
+    struct Worker {
+        explicit Worker(Impl* owner) : _owner{owner} {}
+        Impl* _owner;
+        std::condition_variable _condVar;
+        bool _idle = false;      // waits for a task, guarded by the Impl::_mutex
+        bool _notified = false;  // woken up for a new task, guarded by the Impl::_mutex
+        std::mutex _localMutex;
+        std::deque<Task> _localTasks;  // guarded by the _localMutex
+        std::atomic<int> _localTasksNumber{0};
+        std::atomic<int> _numaNodeId{-1};
+        std::atomic<int> _coreType{Config::PreferredCoreType::ANY};
+        std::atomic<uint64_t> _tasks{0};
+        std::atomic<uint64_t> _busyTimeUs{0};
+        std::atomic<uint64_t> _avgTaskTimeUs{0};  // exponential moving average of the recent tasks execution time
+    };
+
     explicit Impl(const Config& config)
         : _config{config},
+          _taskQueue{taskQueueCapacity},
           _streams([this] {
               return std::make_shared<Impl::Stream>(this);
           }) {
@@ -215,35 +321,260 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _workers.emplace_back(new Worker{this});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                auto& worker = *_workers[streamId];
+                // the stream is created right away, so its core type is known before the first task
+                auto& stream = *(_streams.local());
+                worker._coreType = stream._coreType;
+                worker._numaNodeId = stream._numaNodeId;
+                _currentWorker = &worker;
+                for (;;) {
                     Task task;
-                    {
+                    if (!Pop(worker, task) && _config._spinWaitUs > 0) {
+                        // latency sensitive deployments spin for a while before the thread is parked
+                        const auto deadline =
+                            std::chrono::steady_clock::now() + std::chrono::microseconds(_config._spinWaitUs);
+                        while (!Pop(worker, task) && !_isStopped && std::chrono::steady_clock::now() < deadline) {
+                            std::this_thread::yield();
+                        }
+                    }
+                    if (!task) {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        worker._idle = true;
+                        _parkedWorkers++;
+                        // the producers check the parked workers after publishing the tasks, so nothing is missed
+                        if (!HasTasks(worker) && !_isStopped) {
+                            worker._condVar.wait(lock, [&] {
+                                return worker._notified || _isStopped;
+                            });
                         }
+                        _parkedWorkers--;
+                        worker._idle = false;
+                        worker._notified = false;
+                        if (_isStopped && !HasTasks(worker))
+                            break;
+                        continue;
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        const auto start = std::chrono::steady_clock::now();
+                        Execute(task, stream);
+                        const uint64_t time = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - start).count();
+                        const uint64_t avgTime = worker._tasks ? (worker._avgTaskTimeUs * 7 + time) / 8 : time;
+                        worker._avgTaskTimeUs = avgTime;
+                        worker._busyTimeUs += time;
+                        worker._tasks++;
                     }
                 }
+                _currentWorker = nullptr;
             });
         }
     }
 
+    // the priority and the group of the task executed by the thread, see runWithPriority()
+    struct TaskInfo {
+        TaskPriority _priority;
+        const void* _group;
+    };
+
+    struct CurrentTask {
+        explicit CurrentTask(const TaskInfo* task) : _previous{_currentTask} {
+            _currentTask = task;
+        }
+        ~CurrentTask() {
+            _currentTask = _previous;
+        }
+        const TaskInfo* _previous;
+    };
+
+    struct PrioritizedTask {
+        Task _task;
+        const void* _group;
+    };
+
+    void Enqueue(Task task, TaskPriority priority, const void* group) {
+        Task prioritizedTask = [task, priority, group] {
+            const TaskInfo info{priority, group};
+            CurrentTask current{&info};
+            task();
+        };
+        if (priority == TaskPriority::NORMAL) {
+            Enqueue(std::move(prioritizedTask));
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_prioritizedMutex);
+            auto& tasks = priority == TaskPriority::HIGH ? _highTasks : _lowTasks;
+            tasks.push_back({std::move(prioritizedTask), group});
+        }
+        (priority == TaskPriority::HIGH ? _highTasksNumber : _lowTasksNumber)++;
+        if (_parkedWorkers > 0) {
+            Wake(-1);
+        }
+    }
+
+    // takes the first task not of the excluded group, nullptr excludes nothing
+    bool PopPrioritized(std::deque<PrioritizedTask>& tasks,
+                        std::atomic<int>& tasksNumber,
+                        const void* excludedGroup,
+                        Task& task) {
+        if (tasksNumber <= 0)
+            return false;
+        std::lock_guard<std::mutex> lock(_prioritizedMutex);
+        for (auto it = tasks.begin(); it != tasks.end(); ++it) {
+            if (excludedGroup == nullptr || it->_group != excludedGroup) {
+                task = std::move(it->_task);
+                tasks.erase(it);
+                tasksNumber--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Preempt() {
+        const auto worker = _currentWorker;
+        const auto current = _currentTask;
+        // only the stream threads preempt their tasks, the HIGH priority and the ungrouped tasks are not preempted
+        if (worker == nullptr || worker->_owner != this || current == nullptr || current->_group == nullptr ||
+            current->_priority == TaskPriority::HIGH)
+            return false;
+        bool preempted = false;
+        Task task;
+        // the idle streams take the waiting tasks themselves
+        while (_highTasksNumber > 0 && _parkedWorkers == 0 &&
+               PopPrioritized(_highTasks, _highTasksNumber, current->_group, task)) {
+            try {
+                task();
+            } catch (...) {
+            }
+            task = {};
+            preempted = true;
+        }
+        return preempted;
+    }
+
     void Enqueue(Task task) {
+        auto local = (_currentWorker != nullptr && _currentWorker->_owner == this) ? _currentWorker : nullptr;
+        if (local != nullptr) {
+            {
+                std::lock_guard<std::mutex> lock(local->_localMutex);
+                local->_localTasks.push_back(std::move(task));
+            }
+            local->_localTasksNumber++;
+        } else {
+            if (!_taskQueue.TryPush(task)) {
+                std::lock_guard<std::mutex> lock(_overflowMutex);
+                _overflowTasks.push_back(std::move(task));
+            }
+            _queuedTasksNumber++;
+        }
+        if (_parkedWorkers > 0) {
+            // the local task is executed by its stream anyway, so only the streams which may steal it are woken up
+            Wake(local != nullptr ? local->_numaNodeId.load() : -1);
+        }
+    }
+
+    // the idle stream which executed the recent tasks the fastest takes the task,
+    // the streams without the history are ordered by the core type, so the Big cores are tried first
+    void Wake(int numaNodeId) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        Worker* selected = nullptr;
+        for (auto& worker : _workers) {
+            if (!worker->_idle || worker->_notified)
+                continue;
+            if (numaNodeId >= 0 && worker->_numaNodeId != numaNodeId)
+                continue;
+            if (!selected || isFaster(*worker, *selected))
+                selected = worker.get();
+        }
+        if (selected) {
+            selected->_notified = true;
+            selected->_condVar.notify_one();
+        }
+    }
+
+    bool HasTasks(const Worker& worker) const {
+        if (_queuedTasksNumber > 0 || worker._localTasksNumber > 0 || _highTasksNumber > 0 || _lowTasksNumber > 0)
+            return true;
+        for (auto& other : _workers) {
+            if (other->_numaNodeId == worker._numaNodeId && other->_localTasksNumber > 0)
+                return true;
+        }
+        return false;
+    }
+
+    // the HIGH priority tasks first, then the local tasks, the common ones, the tasks stolen from the streams of the
+    // same NUMA node, and the LOW priority tasks the last
+    bool Pop(Worker& worker, Task& task) {
+        if (PopPrioritized(_highTasks, _highTasksNumber, nullptr, task))
+            return true;
+        if (PopLocal(worker, task, true))
+            return true;
+        if (_queuedTasksNumber > 0) {
+            bool popped = _taskQueue.TryPop(task);
+            if (!popped) {
+                std::lock_guard<std::mutex> lock(_overflowMutex);
+                if (!_overflowTasks.empty()) {
+                    task = std::move(_overflowTasks.front());
+                    _overflowTasks.pop_front();
+                    popped = true;
+                }
+            }
+            if (popped) {
+                _queuedTasksNumber--;
+                return true;
+            }
+        }
+        for (auto& other : _workers) {
+            if (other.get() != &worker && other->_numaNodeId == worker._numaNodeId && PopLocal(*other, task, false))
+                return true;
+        }
+        return PopPrioritized(_lowTasks, _lowTasksNumber, nullptr, task);
+    }
+
+    static bool PopLocal(Worker& worker, Task& task, bool owner) {
+        if (worker._localTasksNumber <= 0)
+            return false;
+        std::lock_guard<std::mutex> lock(worker._localMutex);
+        if (worker._localTasks.empty())
+            return false;
+        // the owner keeps the order of its tasks, the thieves take the most recent ones
+        if (owner) {
+            task = std::move(worker._localTasks.front());
+            worker._localTasks.pop_front();
+        } else {
+            task = std::move(worker._localTasks.back());
+            worker._localTasks.pop_back();
+        }
+        worker._localTasksNumber--;
+        return true;
+    }
+
+    static bool isFaster(const Worker& lhs, const Worker& rhs) {
+        const bool lhsMeasured = lhs._tasks != 0;
+        const bool rhsMeasured = rhs._tasks != 0;
+        if (lhsMeasured && rhsMeasured)
+            return lhs._avgTaskTimeUs < rhs._avgTaskTimeUs;
+        // the streams without the history are tried first to be measured
+        if (lhsMeasured != rhsMeasured)
+            return !lhsMeasured;
+        return lhs._coreType > rhs._coreType;
+    }
+
+    void Stop() {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _isStopped = true;
+        }
+        for (auto& worker : _workers) {
+            worker->_condVar.notify_all();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -281,9 +612,20 @@ struct CPUStreamsExecutor::Impl {
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
     std::mutex _mutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    MPMCQueue<Task> _taskQueue;
+    std::mutex _overflowMutex;
+    std::deque<Task> _overflowTasks;
+    std::atomic<int> _queuedTasksNumber{0};
+    std::mutex _prioritizedMutex;
+    std::deque<PrioritizedTask> _highTasks;  // guarded by the _prioritizedMutex
+    std::deque<PrioritizedTask> _lowTasks;   // guarded by the _prioritizedMutex
+    std::atomic<int> _highTasksNumber{0};
+    std::atomic<int> _lowTasksNumber{0};
+    std::atomic<int> _parkedWorkers{0};
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::atomic<bool> _isStopped{false};
+    static thread_local Worker* _currentWorker;
+    static thread_local const TaskInfo* _currentTask;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -296,6 +638,9 @@ struct CPUStreamsExecutor::Impl {
 #endif
 };
 
+thread_local CPUStreamsExecutor::Impl::Worker* CPUStreamsExecutor::Impl::_currentWorker = nullptr;
+thread_local const CPUStreamsExecutor::Impl::TaskInfo* CPUStreamsExecutor::Impl::_currentTask = nullptr;
+
 int CPUStreamsExecutor::GetStreamId() {
     auto stream = _impl->_streams.local();
     return stream->_streamId;
@@ -309,11 +654,7 @@ int CPUStreamsExecutor::GetNumaNodeId() {
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
+    _impl->Stop();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -321,6 +662,18 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
     }
 }
 
+std::vector<CPUStreamsExecutor::StreamStatistics> CPUStreamsExecutor::GetStreamsStatistics() const {
+    std::vector<StreamStatistics> statistics;
+    for (const auto& worker : _impl->_workers) {
+        StreamStatistics stream;
+        stream.coreType = static_cast<Config::PreferredCoreType>(worker->_coreType.load());
+        stream.tasks = worker->_tasks;
+        stream.busyTimeUs = worker->_busyTimeUs;
+        statistics.push_back(stream);
+    }
+    return statistics;
+}
+
 void CPUStreamsExecutor::Execute(Task task) {
     _impl->Defer(std::move(task));
 }
@@ -333,4 +686,16 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::runWithPriority(Task task, TaskPriority priority, const void* group) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority, group);
+    }
+}
+
+bool CPUStreamsExecutor::Preempt() {
+    return _impl->Preempt();
+}
+
 }  // namespace InferenceEngine
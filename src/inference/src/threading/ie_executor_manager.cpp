@@ -23,6 +23,21 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     return foundEntry->second;
 }
 
+namespace {
+
+bool isSameStreamsConfig(const IStreamsExecutor::Config& executorConfig, const IStreamsExecutor::Config& config) {
+    return executorConfig._name == config._name && executorConfig._streams == config._streams &&
+           executorConfig._threadsPerStream == config._threadsPerStream &&
+           executorConfig._threadBindingType == config._threadBindingType &&
+           executorConfig._threadBindingStep == config._threadBindingStep &&
+           executorConfig._threadBindingOffset == config._threadBindingOffset &&
+           executorConfig._spinWaitUs == config._spinWaitUs &&
+           (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
+            executorConfig._threadPreferredCoreType == config._threadPreferredCoreType);
+}
+
+}  // namespace
+
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
@@ -30,21 +45,38 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name && executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
-            if (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
-                executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
-                return executor;
+        if (isSameStreamsConfig(it.first, config))
+            return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
     cpuStreamsExecutors.emplace_back(std::make_pair(config, newExec));
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                                       unsigned int priority,
+                                                                       unsigned int weight) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    for (const auto& it : sharedStreamsSchedulers) {
+        if (isSameStreamsConfig(it.first, config))
+            return it.second->CreateModelExecutor(priority, weight);
+    }
+    auto scheduler = std::make_shared<StreamsScheduler>(std::make_shared<CPUStreamsExecutor>(config), config._streams);
+    sharedStreamsSchedulers.emplace_back(std::make_pair(config, scheduler));
+    return scheduler->CreateModelExecutor(priority, weight);
+}
+
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    for (const auto& it : sharedCPUStreamsExecutors) {
+        if (isSameStreamsConfig(it.first, config))
+            return it.second;
+    }
+    auto newExec = std::make_shared<CPUStreamsExecutor>(config);
+    sharedCPUStreamsExecutors.emplace_back(std::make_pair(config, newExec));
+    return newExec;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -61,6 +93,8 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedStreamsSchedulers.clear();
+        sharedCPUStreamsExecutors.clear();
     } else {
         executors.erase(id);
         cpuStreamsExecutors.erase(
@@ -70,6 +104,20 @@ void ExecutorManagerImpl::clear(const std::string& id) {
                                return it.first._name == id;
                            }),
             cpuStreamsExecutors.end());
+        sharedStreamsSchedulers.erase(
+            std::remove_if(sharedStreamsSchedulers.begin(),
+                           sharedStreamsSchedulers.end(),
+                           [&](const std::pair<IStreamsExecutor::Config, StreamsScheduler::Ptr>& it) {
+                               return it.first._name == id;
+                           }),
+            sharedStreamsSchedulers.end());
+        sharedCPUStreamsExecutors.erase(
+            std::remove_if(sharedCPUStreamsExecutors.begin(),
+                           sharedCPUStreamsExecutors.end(),
+                           [&](const std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>& it) {
+                               return it.first._name == id;
+                           }),
+            sharedCPUStreamsExecutors.end());
     }
 }
 
@@ -134,4 +182,14 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                                   unsigned int priority,
+                                                                   unsigned int weight) {
+    return _impl.getSharedCPUStreamsExecutor(config, priority, weight);
+}
+
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,209 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_streams_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+struct StreamsScheduler::Impl {
+    struct QueuedTask {
+        Task _task;
+        IStreamsExecutor::TaskPriority _priority;
+        const void* _group;
+    };
+
+    struct ModelQueue {
+        unsigned int _priority = 0;
+        double _weight = 1;
+        // the streams time used by the model over its weight, the model with the smallest one goes first
+        double _virtualTimeUs = 0;
+        std::deque<QueuedTask> _tasks;
+        bool _detached = false;
+    };
+    using ModelQueuePtr = std::shared_ptr<ModelQueue>;
+
+    Impl(const IStreamsExecutor::Ptr& executor, int streams)
+        : _executor{executor},
+          _maxTasks{std::max(streams, 1)} {}
+
+    void Push(const ModelQueuePtr& queue, QueuedTask task) {
+        std::vector<std::pair<ModelQueuePtr, QueuedTask>> tasks;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (queue->_tasks.empty()) {
+                // the idle model doesn't save the time up
+                queue->_virtualTimeUs = std::max(queue->_virtualTimeUs, _virtualTimeUs);
+            }
+            if (task._priority == IStreamsExecutor::TaskPriority::HIGH) {
+                // the latency critical task doesn't wait for a free stream, the executor preempts the running ones
+                ++_tasksInFlight;
+                tasks.emplace_back(queue, std::move(task));
+            } else {
+                queue->_tasks.push_back(std::move(task));
+                tasks = Dispatch();
+            }
+        }
+        Run(std::move(tasks));
+    }
+
+    void Complete(const ModelQueuePtr& queue, double durationUs) {
+        std::vector<std::pair<ModelQueuePtr, QueuedTask>> tasks;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            queue->_virtualTimeUs += durationUs / queue->_weight;
+            --_tasksInFlight;
+            tasks = Dispatch();
+            if (_tasksInFlight == 0) {
+                _idle.notify_all();
+            }
+        }
+        Run(std::move(tasks));
+    }
+
+    // takes the tasks to execute while the streams are free, called under the lock
+    std::vector<std::pair<ModelQueuePtr, QueuedTask>> Dispatch() {
+        std::vector<std::pair<ModelQueuePtr, QueuedTask>> tasks;
+        while (_tasksInFlight < _maxTasks) {
+            ModelQueuePtr next;
+            for (auto&& queue : _queues) {
+                if (queue->_tasks.empty())
+                    continue;
+                if (!next || queue->_priority < next->_priority ||
+                    (queue->_priority == next->_priority && queue->_virtualTimeUs < next->_virtualTimeUs)) {
+                    next = queue;
+                }
+            }
+            if (!next)
+                break;
+            _virtualTimeUs = std::max(_virtualTimeUs, next->_virtualTimeUs);
+            tasks.emplace_back(next, std::move(next->_tasks.front()));
+            next->_tasks.pop_front();
+            ++_tasksInFlight;
+        }
+        _queues.remove_if([](const ModelQueuePtr& queue) {
+            return queue->_detached && queue->_tasks.empty();
+        });
+        return tasks;
+    }
+
+    void Run(std::vector<std::pair<ModelQueuePtr, QueuedTask>> tasks) {
+        for (auto&& task : tasks) {
+            auto queue = std::move(task.first);
+            auto modelTask = std::move(task.second._task);
+            _executor->runWithPriority([this, queue, modelTask] {
+                struct Completion {
+                    ~Completion() {
+                        auto duration = std::chrono::steady_clock::now() - _start;
+                        _impl->Complete(_queue, std::chrono::duration<double, std::micro>(duration).count());
+                    }
+                    Impl* _impl;
+                    ModelQueuePtr _queue;
+                    std::chrono::steady_clock::time_point _start;
+                } completion{this, queue, std::chrono::steady_clock::now()};
+                modelTask();
+            }, task.second._priority, task.second._group);
+        }
+    }
+
+    void WaitIdle() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _idle.wait(lock, [this] {
+            return _tasksInFlight == 0 && std::all_of(_queues.begin(), _queues.end(), [](const ModelQueuePtr& queue) {
+                       return queue->_tasks.empty();
+                   });
+        });
+    }
+
+    class ModelStreamsExecutor : public IStreamsExecutor {
+    public:
+        ModelStreamsExecutor(const StreamsScheduler::Ptr& scheduler,
+                             Impl* impl,
+                             unsigned int priority,
+                             unsigned int weight)
+            : _scheduler{scheduler},
+              _impl{impl},
+              _queue{std::make_shared<ModelQueue>()} {
+            _queue->_priority = priority;
+            _queue->_weight = std::max(weight, 1u);
+            std::lock_guard<std::mutex> lock(_impl->_mutex);
+            _queue->_virtualTimeUs = _impl->_virtualTimeUs;
+            _impl->_queues.push_back(_queue);
+        }
+
+        ~ModelStreamsExecutor() override {
+            std::lock_guard<std::mutex> lock(_impl->_mutex);
+            _queue->_detached = true;
+            if (_queue->_tasks.empty()) {
+                _impl->_queues.remove(_queue);
+            }
+        }
+
+        void run(Task task) override {
+            _impl->Push(_queue, {std::move(task), TaskPriority::NORMAL, nullptr});
+        }
+
+        void runWithPriority(Task task, TaskPriority priority, const void* group) override {
+            _impl->Push(_queue, {std::move(task), priority, group});
+        }
+
+        bool Preempt() override {
+            return _impl->_executor->Preempt();
+        }
+
+        void Execute(Task task) override {
+            _impl->_executor->Execute(std::move(task));
+        }
+
+        int GetStreamId() override {
+            return _impl->_executor->GetStreamId();
+        }
+
+        int GetNumaNodeId() override {
+            return _impl->_executor->GetNumaNodeId();
+        }
+
+    private:
+        StreamsScheduler::Ptr _scheduler;
+        Impl* _impl;
+        ModelQueuePtr _queue;
+    };
+
+    IStreamsExecutor::Ptr _executor;
+    const int _maxTasks;
+    int _tasksInFlight = 0;
+    double _virtualTimeUs = 0;
+    std::list<ModelQueuePtr> _queues;
+    std::mutex _mutex;
+    std::condition_variable _idle;
+};
+
+StreamsScheduler::StreamsScheduler(const IStreamsExecutor::Ptr& executor, int streams)
+    : _impl{new Impl{executor, streams}} {
+    if (executor == nullptr) {
+        IE_THROW() << "The streams scheduler requires an executor";
+    }
+}
+
+StreamsScheduler::~StreamsScheduler() {
+    _impl->WaitIdle();
+    // joins the threads, which may still complete the tasks
+    _impl->_executor.reset();
+}
+
+IStreamsExecutor::Ptr StreamsScheduler::CreateModelExecutor(unsigned int priority, unsigned int weight) {
+    return std::make_shared<Impl::ModelStreamsExecutor>(shared_from_this(), _impl.get(), priority, weight);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+
+#include "device_perf_cache.hpp"
+#include "file_utils.h"
+#include "utils/log_util.hpp"
+
+namespace MultiDevicePlugin {
+
+namespace {
+// the weight of the history in the average, so the device changes (e.g. the drivers updates) are caught up with
+constexpr uint64_t maxInferencesWeight = 1000;
+}  // namespace
+
+DevicePerfCache::DevicePerfCache(const std::string& cacheDir, const std::string& modelKey)
+    : _filePath{FileUtils::makePath(cacheDir, modelKey + ".auto_perf")} {
+    std::ifstream file(_filePath);
+    std::string uniqueName;
+    Record record;
+    while (file >> uniqueName >> record.latencyUs >> record.inferences >> record.requests) {
+        if (record.latencyUs > 0 && record.inferences && record.requests)
+            _records[uniqueName] = record;
+    }
+}
+
+bool DevicePerfCache::Get(const std::string& uniqueName, Record& record) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _records.find(uniqueName);
+    if (it == _records.end())
+        return false;
+    record = it->second;
+    return true;
+}
+
+void DevicePerfCache::Update(const std::string& uniqueName, double latencyUs, uint64_t inferences, unsigned int requests) {
+    if (latencyUs <= 0 || !inferences || !requests)
+        return;
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& record = _records[uniqueName];
+    const auto total = record.inferences + inferences;
+    record.latencyUs = (record.latencyUs * record.inferences + latencyUs * inferences) / total;
+    record.inferences = std::min(total, maxInferencesWeight);
+    record.requests = requests;
+}
+
+void DevicePerfCache::Save() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_records.empty())
+        return;
+    std::ofstream file(_filePath, std::ios::trunc);
+    if (!file.is_open()) {
+        LOG_WARNING("[AUTOPLUGIN]:failed to save the device performance to %s", _filePath.c_str());
+        return;
+    }
+    for (const auto& record : _records) {
+        file << record.first << " " << record.second.latencyUs << " " << record.second.inferences << " "
+             << record.second.requests << std::endl;
+    }
+}
+
+std::string DevicePerfCache::ComputeModelKey(const std::string& modelPath,
+                                             const InferenceEngine::CNNNetwork& network,
+                                             const std::string& performanceHint) {
+    std::stringstream key;
+    if (!modelPath.empty()) {
+        key << modelPath;
+    } else if (auto function = network.getFunction()) {
+        key << function->get_friendly_name();
+        for (const auto& op : function->get_ordered_ops()) {
+            key << op->get_type_name();
+            for (size_t i = 0; i < op->get_output_size(); i++)
+                key << op->get_output_partial_shape(i) << op->get_output_element_type(i);
+        }
+    }
+    key << performanceHint;
+    return std::to_string(std::hash<std::string>{}(key.str()));
+}
+
+}  // namespace MultiDevicePlugin
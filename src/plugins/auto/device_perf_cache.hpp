@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <cpp/ie_cnn_network.h>
+
+#ifdef  MULTIUNITTEST
+#define MOCKTESTMACRO virtual
+#define MultiDevicePlugin MockMultiDevicePlugin
+#else
+#define MOCKTESTMACRO
+#endif
+
+namespace MultiDevicePlugin {
+
+/**
+ * @brief The performance of a network measured per device (by the unique name) by the AUTO executable networks,
+ * persisted as a "<model key>.auto_perf" text file under the CACHE_DIR, so the next loads of the network select the device
+ * by the measurements rather than by the static priority
+ */
+class DevicePerfCache {
+public:
+    struct Record {
+        double latencyUs = 0;        // the average latency of an inference
+        uint64_t inferences = 0;     // the number of the measured inferences (capped, so the new measurements matter)
+        unsigned int requests = 0;   // the number of the infer requests executed on the device in parallel
+    };
+
+    DevicePerfCache(const std::string& cacheDir, const std::string& modelKey);
+
+    bool Get(const std::string& uniqueName, Record& record) const;
+    void Update(const std::string& uniqueName, double latencyUs, uint64_t inferences, unsigned int requests);
+    void Save() const;
+
+    static std::string ComputeModelKey(const std::string& modelPath,
+                                       const InferenceEngine::CNNNetwork& network,
+                                       const std::string& performanceHint);
+
+private:
+    std::string _filePath;
+    std::map<std::string, Record> _records;
+    mutable std::mutex _mutex;
+};
+
+}  // namespace MultiDevicePlugin
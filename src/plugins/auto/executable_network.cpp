@@ -3,6 +3,7 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -85,6 +86,9 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto loadAwareScheduling = _config.find(CONFIG_KEY_INTERNAL(MULTI_LOAD_AWARE_SCHEDULING));
+    _loadAwareScheduling = loadAwareScheduling != _config.end() &&
+                           loadAwareScheduling->second.as<std::string>() == PluginConfigParams::YES;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -118,6 +122,9 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
     idleWorkerRequests.set_capacity(numRequests);
+    if (_loadAwareScheduling) {
+        _deviceLoads[device]._numRequests = numRequests;
+    }
     for (auto&& workerRequest : workerRequests) {
         workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
         auto* workerRequestPtr = &workerRequest;
@@ -126,6 +133,21 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
             [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
                 IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                if (!exceptionPtr) {
+                    workerRequestPtr->_latencySumUs += std::chrono::duration<double, std::micro>(
+                            std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count();
+                    workerRequestPtr->_numInferences++;
+                    if (_workModeIsAUTO)
+                        RecordHandoffInference(device);
+                    if (_loadAwareScheduling) {
+                        auto& avgLatencyUs = _deviceLoads.at(device)._avgLatencyUs;
+                        const auto latencyUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count());
+                        avgLatencyUs = avgLatencyUs ? (avgLatencyUs * 7 + latencyUs) / 8 : (std::max)(latencyUs, uint64_t{1});
+                    }
+                }
+                if (_loadAwareScheduling)
+                    _deviceLoads.at(device)._busyRequests--;
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -135,8 +157,10 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
                     // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                     // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                     Task t;
-                    if (_inferPipelineTasks.try_pop(t))
+                    if (_inferPipelineTasks.try_pop(t)) {
+                        _numQueuedTasks--;
                         ScheduleToWorkerInferRequest(std::move(t));
+                    }
                     else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
                         ScheduleToWorkerInferRequest(std::move(t), device);
                 }
@@ -157,7 +181,8 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
                                                            , _multiPlugin(plugin)
                                                            , _context(context)
                                                            , _workModeIsAUTO(true)
-                                                           , _network(network) {
+                                                           , _network(network)
+                                                           , _loadStartTime(std::chrono::steady_clock::now()) {
     if (_multiPlugin->GetCore() == nullptr) {
         IE_THROW() << "Please, work with " << _multiPlugin->GetName() << " device via InferencEngine::Core object";
     }
@@ -176,8 +201,15 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
     _loadContext[ACTUALDEVICE].isEnabled = true;
     _loadContext[ACTUALDEVICE].networkPrecision = GetNetworkPrecision(network);
     _loadContext[ACTUALDEVICE].metaDevices = metaDevices;
-    _loadContext[ACTUALDEVICE].deviceInfo = _multiPlugin->SelectDevice(metaDevices,
-            _loadContext[ACTUALDEVICE].networkPrecision, _context.modelPriority);
+    if (!_context.cacheDir.empty()) {
+        _perfCache = std::make_shared<DevicePerfCache>(_context.cacheDir,
+                DevicePerfCache::ComputeModelKey(modelPath, network, _context.performanceHint));
+        _loadContext[ACTUALDEVICE].deviceInfo = _multiPlugin->SelectDeviceByPerf(metaDevices, *_perfCache,
+                _context.performanceHint, _loadContext[ACTUALDEVICE].networkPrecision, _context.modelPriority);
+    } else {
+        _loadContext[ACTUALDEVICE].deviceInfo = _multiPlugin->SelectDevice(metaDevices,
+                _loadContext[ACTUALDEVICE].networkPrecision, _context.modelPriority);
+    }
     LOG_INFO("[AUTOPLUGIN]:select device:%s", _loadContext[ACTUALDEVICE].deviceInfo.deviceName.c_str());
     bool isActualDevCPU =
         _loadContext[ACTUALDEVICE].deviceInfo.deviceName.find("CPU") != std::string::npos;
@@ -219,6 +251,9 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
                                             contextPtr->deviceInfo.config.end());
                           }
                           contextPtr->isAlready = true;
+                          if (contextPtr == &_loadContext[ACTUALDEVICE]) {
+                              _actualReadyTimeUs = GetTimeSinceLoadUs();
+                          }
                           auto& deviceName = contextPtr->deviceInfo.deviceName;
                           LOG_INFO("[AUTOPLUGIN]:device:%s loading Network finished",
                                   deviceName.c_str());
@@ -280,6 +315,11 @@ void MultiDeviceExecutableNetwork::TryToLoadNetWork(AutoLoadContext& context,
     auto& deviceConfig = context.deviceInfo.config;
     auto& deviceList = context.metaDevices;
     bool curDevIsCPU = (device.find("CPU") != std::string::npos);
+    auto itSharedStreams = deviceConfig.find(CONFIG_KEY_INTERNAL(CPU_SHARED_STREAMS));
+    if (curDevIsCPU && itSharedStreams != deviceConfig.end() && itSharedStreams->second == CONFIG_VALUE(YES)) {
+        // the network shares the CPU streams with the other networks by the AUTO priority
+        deviceConfig.insert({CONFIG_KEY_INTERNAL(CPU_NETWORK_PRIORITY), std::to_string(_context.modelPriority)});
+    }
     try {
         if (!modelPath.empty()) {
             context.executableNetwork = _core->LoadNetwork(modelPath, device, deviceConfig);
@@ -421,6 +461,14 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             // _acceleratorDevice could be the same as _cpuDevice, such as AUTO:CPU
             if (_loadContext[ACTUALDEVICE].isAlready) {
                 devices.push_back(_loadContext[ACTUALDEVICE].deviceInfo);
+                // the CPU_HELP requests still take the tasks the actual device has no idle requests for, till its
+                // first inference completes (the first inferences of e.g. GPU are slow), or always if it's the overflow
+                if (_loadContext[CPU].isEnabled && _loadContext[CPU].isAlready &&
+                    (_context.cpuHelpOverflow || !_actualFirstInferenceTimeUs)) {
+                    auto deviceInfo = _loadContext[CPU].deviceInfo;
+                    deviceInfo.deviceName = _loadContext[CPU].workName;
+                    devices.push_back(std::move(deviceInfo));
+                }
             } else {
                 // replace deviceName with workName, so schedule can select correct
                 // idleWorkerQueue
@@ -435,19 +483,56 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             return _devicePriorities;
         }();
     }
+    const bool loadAware = _loadAwareScheduling && preferred_device.empty();
+    if (loadAware)
+        devices = OrderDevicesByLoad(devices);
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
         if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+            if (_loadAwareScheduling)
+                _deviceLoads.at(device.deviceName)._busyRequests++;
             return;
         }
+        // the device expected to complete the task first is busy, so it takes the task from the queue once its request
+        // is idle, rather than the slower devices take it now
+        if (loadAware)
+            break;
     }
 
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    if (!preferred_device.empty()) {
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    } else {
+        _numQueuedTasks++;
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
+}
+
+std::vector<DeviceInformation> MultiDeviceExecutableNetwork::OrderDevicesByLoad(const std::vector<DeviceInformation>& devices) const {
+    // the expected completion time of the task on a device is its latency, plus the time till one of its requests
+    // completes and the already queued tasks are executed if all of them are busy.
+    // the devices not measured yet go first, so every device is measured
+    const double queued = (std::max)(_numQueuedTasks.load(), 0);
+    std::vector<std::pair<double, const DeviceInformation*>> expected;
+    for (auto&& device : devices) {
+        const auto& load = _deviceLoads.at(device.deviceName);
+        const double latencyUs = load._avgLatencyUs;
+        const auto numRequests = (std::max)(load._numRequests, 1u);
+        double time = latencyUs;
+        if (load._busyRequests >= static_cast<int>(numRequests))
+            time += latencyUs * (1 + queued) / numRequests;
+        expected.emplace_back(time, &device);
+    }
+    // the equally loaded devices keep the priority order
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const std::pair<double, const DeviceInformation*>& a, const std::pair<double, const DeviceInformation*>& b) {
+                         return a.first < b.first;
+                     });
+    std::vector<DeviceInformation> ordered;
+    for (auto&& device : expected)
+        ordered.push_back(*device.second);
+    return ordered;
 }
 
 bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
@@ -483,6 +568,9 @@ MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
         }
         _multiPlugin->UnregisterPriority(_context.modelPriority,
                 _loadContext[ACTUALDEVICE].deviceInfo.uniqueName);
+        if (_perfCache) {
+            SavePerfMeasurements();
+        }
     }
     {
         std::lock_guard<std::mutex> lock(_mutex);
@@ -498,6 +586,54 @@ MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
     _workerRequests.clear();
 }
 
+void MultiDeviceExecutableNetwork::SavePerfMeasurements() {
+    // all the requests are completed by now, as the async requests wait for their tasks on the destruction
+    for (int i = 0; i < CONTEXTNUM; i++) {
+        auto& context = _loadContext[i];
+        auto workers = _workerRequests.find(context.workName);
+        if (!context.isEnabled || !context.isLoadSuccess || workers == _workerRequests.end()) {
+            continue;
+        }
+        double latencySumUs = 0;
+        uint64_t numInferences = 0;
+        for (auto& workerRequest : workers->second) {
+            latencySumUs += workerRequest._latencySumUs;
+            numInferences += workerRequest._numInferences;
+        }
+        if (numInferences) {
+            _perfCache->Update(context.deviceInfo.uniqueName, latencySumUs / numInferences, numInferences,
+                               static_cast<unsigned int>(workers->second.size()));
+        }
+    }
+    _perfCache->Save();
+}
+
+uint64_t MultiDeviceExecutableNetwork::GetTimeSinceLoadUs() const {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - _loadStartTime).count();
+    // zero is reserved for "not happened yet"
+    return (std::max)(static_cast<uint64_t>(elapsed), static_cast<uint64_t>(1));
+}
+
+void MultiDeviceExecutableNetwork::RecordHandoffInference(const std::string& workName) {
+    uint64_t notYet = 0;
+    _firstInferenceTimeUs.compare_exchange_strong(notYet, GetTimeSinceLoadUs());
+    if (workName == _loadContext[CPU].workName) {
+        _cpuHelpInferences++;
+        if (_loadContext[ACTUALDEVICE].isAlready)
+            _cpuHelpInferencesAfterSwitch++;
+    } else {
+        _actualInferences++;
+        notYet = 0;
+        if (_actualFirstInferenceTimeUs.compare_exchange_strong(notYet, GetTimeSinceLoadUs()) &&
+            _loadContext[CPU].isEnabled) {
+            LOG_INFO("[AUTOPLUGIN]:the first inference on %s completed, CPU_HELP executed %lu inferences",
+                     _loadContext[ACTUALDEVICE].deviceInfo.deviceName.c_str(),
+                     static_cast<unsigned long>(_cpuHelpInferences.load()));
+        }
+    }
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> MultiDeviceExecutableNetwork::GetContext() const {
     if (_workModeIsAUTO) {
         WaitActualNetworkReady();
@@ -662,6 +798,16 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetConfig(const std::st
 
 InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::string &name) const {
     if (_workModeIsAUTO) {
+        if (name == METRIC_KEY(AUTO_HANDOFF_STATISTICS)) {
+            std::map<std::string, uint64_t> stats;
+            stats["FIRST_INFERENCE_TIME_US"] = _firstInferenceTimeUs;
+            stats["ACTUAL_DEVICE_READY_TIME_US"] = _actualReadyTimeUs;
+            stats["ACTUAL_DEVICE_FIRST_INFERENCE_TIME_US"] = _actualFirstInferenceTimeUs;
+            stats["CPU_HELP_INFERENCES"] = _cpuHelpInferences;
+            stats["CPU_HELP_INFERENCES_AFTER_SWITCH"] = _cpuHelpInferencesAfterSwitch;
+            stats["ACTUAL_DEVICE_INFERENCES"] = _actualInferences;
+            IE_SET_METRIC_RETURN(AUTO_HANDOFF_STATISTICS, stats);
+        }
         if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
             unsigned int real = 0;
             if (_loadContext[ACTUALDEVICE].isAlready) {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <unordered_map>
 #include <map>
@@ -17,6 +18,7 @@
 #include "threading/ie_itask_executor.hpp"
 #include "threading/ie_executor_manager.hpp"
 #include "ie_icore.hpp"
+#include "device_perf_cache.hpp"
 
 #ifdef  MULTIUNITTEST
 #define MOCKTESTMACRO virtual
@@ -44,6 +46,9 @@ struct DeviceInformation {
 struct AutoContext {
     bool           needPerfCounters = {false};
     unsigned int   modelPriority = 0;
+    std::string    cacheDir;            // the device performance measurements are persisted to, if set
+    std::string    performanceHint;
+    bool           cpuHelpOverflow = {false};  // the CPU_HELP requests are used after the switch if the device has no idle ones
 };
 
 struct AutoLoadContext {
@@ -82,8 +87,18 @@ public:
         InferenceEngine::SoIInferRequestInternal  _inferRequest;
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
+        // the latency measurements, each is updated by the request's own callback only
+        std::chrono::steady_clock::time_point     _startTime;
+        double                                    _latencySumUs = 0;
+        uint64_t                                  _numInferences = 0;
     };
     using NotBusyWorkerRequests = InferenceEngine::ThreadSafeBoundedQueue<WorkerInferRequest*>;
+    // the load of a device tracked by the load aware scheduling of the MULTI
+    struct DeviceLoad {
+        std::atomic<uint64_t>                     _avgLatencyUs = {0};  // the moving average, zero till measured
+        std::atomic<int>                          _busyRequests = {0};
+        unsigned int                              _numRequests = 0;
+    };
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::SoExecutableNetworkInternal>&        networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
@@ -139,6 +154,10 @@ private:
     void TryToLoadNetWork(AutoLoadContext& context,
                           const std::string& modelPath,
                           const InferenceEngine::CNNNetwork& network);
+    void SavePerfMeasurements();
+    std::vector<DeviceInformation> OrderDevicesByLoad(const std::vector<DeviceInformation>& devices) const;
+    void RecordHandoffInference(const std::string& workName);
+    uint64_t GetTimeSinceLoadUs() const;
 
 private:
     std::shared_ptr<InferenceEngine::ICore>                             _core;
@@ -153,6 +172,19 @@ private:
     mutable AutoLoadContext                                             _loadContext[CONTEXTNUM];
     mutable std::mutex                                                  _confMutex;
     const InferenceEngine::CNNNetwork                                   _network;
+    std::shared_ptr<DevicePerfCache>                                    _perfCache;
+    // the handoff from CPU_HELP to the actual device, the times are since the load began, zero till they happen
+    std::chrono::steady_clock::time_point                               _loadStartTime;
+    std::atomic<uint64_t>                                               _firstInferenceTimeUs = {0};
+    std::atomic<uint64_t>                                               _actualReadyTimeUs = {0};
+    std::atomic<uint64_t>                                               _actualFirstInferenceTimeUs = {0};
+    std::atomic<uint64_t>                                               _cpuHelpInferences = {0};
+    std::atomic<uint64_t>                                               _cpuHelpInferencesAfterSwitch = {0};
+    std::atomic<uint64_t>                                               _actualInferences = {0};
+    // the load aware scheduling of the MULTI, the loads are created with the workers, so the map isn't modified later
+    bool                                                                _loadAwareScheduling = {false};
+    DeviceMap<DeviceLoad>                                               _deviceLoads;
+    std::atomic<int>                                                    _numQueuedTasks = {0};
 };
 
 }  // namespace MultiDevicePlugin
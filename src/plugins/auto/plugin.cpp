@@ -61,6 +61,9 @@ namespace {
                     res.push_back(PluginConfigParams::KEY_PERF_COUNT);
                     res.push_back(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS);
                     res.push_back(MultiDeviceConfigParams::KEY_AUTO_NETWORK_PRIORITY);
+                    res.push_back(PluginConfigParams::KEY_CACHE_DIR);
+                    res.push_back(CONFIG_KEY_INTERNAL(AUTO_CPU_HELP_OVERFLOW));
+                    res.push_back(CONFIG_KEY_INTERNAL(MULTI_LOAD_AWARE_SCHEDULING));
                     return res;
                 }();
 }  // namespace
@@ -304,6 +307,15 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         metaDevices = ParseMetaDevices(priorities->second, fullConfig);
         multiNetworkConfig.insert(*priorities);
     }
+    auto loadAwareScheduling = fullConfig.find(CONFIG_KEY_INTERNAL(MULTI_LOAD_AWARE_SCHEDULING));
+    if (loadAwareScheduling != fullConfig.end()) {
+        if (loadAwareScheduling->second != PluginConfigParams::YES &&
+            loadAwareScheduling->second != PluginConfigParams::NO) {
+            IE_THROW() << "Unsupported config value: " << loadAwareScheduling->second
+                       << " for key: " << loadAwareScheduling->first;
+        }
+        multiNetworkConfig.insert(*loadAwareScheduling);
+    }
 
     DeviceMap<SoExecutableNetworkInternal> executableNetworkPerDevice;
     std::mutex load_mutex;
@@ -508,6 +520,47 @@ DeviceInformation MultiDeviceInferencePlugin::SelectDevice(const std::vector<Dev
     return *ptrSelectDevice;
 }
 
+DeviceInformation MultiDeviceInferencePlugin::SelectDeviceByPerf(const std::vector<DeviceInformation>& metaDevices,
+        const DevicePerfCache& perfCache, const std::string& performanceHint,
+        const std::string& networkPrecision, unsigned int priority) {
+    OV_ITT_SCOPED_TASK(itt::domains::MULTIPlugin, "MultiDeviceInferencePlugin::SelectDeviceByPerf");
+    auto selected = SelectDevice(metaDevices, networkPrecision, priority);
+    // the device selected by the priority is kept until it's measured, so every candidate is measured once at least
+    DevicePerfCache::Record record;
+    if (!perfCache.Get(selected.uniqueName, record)) {
+        return selected;
+    }
+
+    // the throughput is estimated as the number of the parallel requests per the latency of a request
+    const bool throughput = performanceHint == PluginConfigParams::THROUGHPUT;
+    auto score = [throughput](const DevicePerfCache::Record& r) {
+        return (throughput ? r.requests : 1) / r.latencyUs;
+    };
+    // another device is selected only if it's noticeably better, so the selection doesn't flap on the noise
+    double bestScore = 1.1 * score(record);
+    const DeviceInformation* best = nullptr;
+    for (auto& device : metaDevices) {
+        if (device.uniqueName != selected.uniqueName && perfCache.Get(device.uniqueName, record) && score(record) > bestScore) {
+            bestScore = score(record);
+            best = &device;
+        }
+    }
+    if (!best) {
+        return selected;
+    }
+
+    LOG_INFO("[AUTOPLUGIN]:device:%s is selected instead of %s by the measured performance",
+            best->uniqueName.c_str(), selected.uniqueName.c_str());
+    UnregisterPriority(priority, selected.uniqueName);
+    try {
+        return SelectDevice({*best}, networkPrecision, priority);
+    } catch (const std::exception&) {
+        // e.g. the network precision is not supported by the device anymore
+        RegisterPriority(priority, selected.uniqueName);
+        return selected;
+    }
+}
+
 void MultiDeviceInferencePlugin::UnregisterPriority(const unsigned int& priority,
         const std::string& deviceName) {
     std::lock_guard<std::mutex> lck(_mtx);
@@ -591,8 +644,26 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
                 IE_THROW() << "Unsupported config value: " << kvp.second
                            << " for key: " << kvp.first;
             }
+        } else if (kvp.first == PluginConfigParams::KEY_CACHE_DIR) {
+            context.cacheDir = kvp.second;
+        } else if (kvp.first == CONFIG_KEY_INTERNAL(MULTI_LOAD_AWARE_SCHEDULING)) {
+            if (kvp.second != PluginConfigParams::YES && kvp.second != PluginConfigParams::NO) {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
+        } else if (kvp.first == CONFIG_KEY_INTERNAL(AUTO_CPU_HELP_OVERFLOW)) {
+            if (kvp.second == PluginConfigParams::YES) {
+                context.cpuHelpOverflow = true;
+            } else if (kvp.second == PluginConfigParams::NO) {
+                context.cpuHelpOverflow = false;
+            } else {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
         } else if (std::find(perf_hints_configs.begin(), perf_hints_configs.end(), kvp.first) != perf_hints_configs.end()) {
             PerfHintsConfig::CheckConfigAndValue(kvp);
+            if (kvp.first == PluginConfigParams::KEY_PERFORMANCE_HINT)
+                context.performanceHint = kvp.second;
         } else if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), kvp.first)) {
             IE_THROW() << "Unsupported config key: " << kvp.first;
         } else if (kvp.first.find("AUTO_") == 0) {
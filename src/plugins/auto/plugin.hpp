@@ -48,6 +48,11 @@ public:
     std::string GetDeviceList(const std::map<std::string, std::string>& config) const;
     MOCKTESTMACRO DeviceInformation SelectDevice(const std::vector<DeviceInformation>& metaDevices,
             const std::string& networkPrecision = METRIC_VALUE(FP32), unsigned int priority = 0);
+    DeviceInformation SelectDeviceByPerf(const std::vector<DeviceInformation>& metaDevices,
+                                         const DevicePerfCache& perfCache,
+                                         const std::string& performanceHint,
+                                         const std::string& networkPrecision = METRIC_VALUE(FP32),
+                                         unsigned int priority = 0);
     void UnregisterPriority(const unsigned int& priority, const std::string& deviceName);
     void RegisterPriority(const unsigned int& priority, const std::string& deviceName);
 
@@ -21,7 +21,39 @@
 namespace AutoBatchPlugin {
 using namespace InferenceEngine;
 
-std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CONFIG_KEY(AUTO_BATCH_TIMEOUT)};
+std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+                                                 CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_BUDGET,
+                                                 PluginConfigInternalParams::KEY_AUTO_BATCH_LADDER};
+
+namespace {
+double movingAverage(double average, double value) {
+    return average == 0 ? value : 0.9 * average + 0.1 * value;
+}
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// copies the slice 'srcId' of the 'src' batched by 'srcBatch' to the slice 'dstId' of the 'dst' batched by 'dstBatch',
+// the blobs that are not batched (e.g. constants) are copied as a whole
+void copyBatchSlice(const Blob::CPtr& src, size_t srcId, size_t srcBatch, const Blob::Ptr& dst, size_t dstId, size_t dstBatch) {
+    const size_t srcSlice = src->byteSize() / srcBatch;
+    const size_t dstSlice = dst->byteSize() / dstBatch;
+    auto bufferSrc = src->cbuffer();
+    auto ptrSrc = bufferSrc.as<const char*>();
+    auto bufferDst = dst->buffer();
+    auto ptrDst = bufferDst.as<char*>();
+    if (srcSlice == dstSlice) {
+        ptrSrc += srcId * srcSlice;
+        ptrDst += dstId * dstSlice;
+        if (ptrSrc != ptrDst)
+            memcpy(ptrDst, ptrSrc, srcSlice);
+    } else if (src->byteSize() == dst->byteSize() && ptrSrc != ptrDst) {
+        memcpy(ptrDst, ptrSrc, src->byteSize());
+    }
+}
+}  // namespace
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob, size_t batch_id, size_t batch_num) {
@@ -176,17 +208,26 @@ void AutoBatchInferRequest::SetBlobsToAnotherRequest(SoIInferRequestInternal& re
     }
 }
 
-void AutoBatchInferRequest::CopyInputsIfNeeded() {
-    for (const auto& it : _networkInputs) {
-        auto& name = it.first;
-        // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
-    }
+bool AutoBatchInferRequest::IsInputInBatchedBlob(const std::string& name) {
+    // this request is already in BUSY state, so using the internal functions safely
+    auto src = GetBlob(name);
+    const auto& dst = _myBatchedRequestWrapper._batchedInputs.at(name);
+    auto ptrDst = dst->buffer().as<char*>();
+    auto ptrSrc = src->cbuffer().as<const char*>();
+    ptrdiff_t szDst = dst->byteSize();
+    ptrdiff_t szSrc = src->byteSize();
+    ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+    return (ptrDst + offset) == ptrSrc;
 }
 
-void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
-                                             InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+size_t AutoBatchInferRequest::CopyInputIfNeeded(const std::string& name) {
+    // this request is already in BUSY state, so using the internal functions safely
+    return CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._batchedInputs.at(name), true);
+}
+
+size_t AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                                               InferenceEngine::Blob::Ptr dst,
+                                               bool bInput) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -196,15 +237,15 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     if (bInput) {
         ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
-            return;
-        else
-            memcpy(ptrDst + offset, ptrSrc, szSrc);
+            return 0;
+        memcpy(ptrDst + offset, ptrSrc, szSrc);
+        return szSrc;
     } else {
         ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
-            return;
-        else
-            memcpy(ptrDst, ptrSrc + offset, szDst);
+            return 0;
+        memcpy(ptrDst, ptrSrc + offset, szDst);
+        return szDst;
     }
 }
 
@@ -216,6 +257,22 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     }
 }
 
+void AutoBatchInferRequest::CopyInputsToAnotherRequest(SoIInferRequestInternal& req, size_t slot, size_t batch) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        copyBatchSlice(GetBlob(name), 0, 1, req->GetBlob(name), slot, batch);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromAnotherRequest(SoIInferRequestInternal& req, size_t slot, size_t batch) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // to the batched blob, as the outputs are copied from it to this request's blobs on the completion
+        copyBatchSlice(req->GetBlob(name), slot, batch, _myBatchedRequestWrapper._batchedOutputs.at(name), _batchId, _batchSize);
+    }
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchInferRequest::GetPerformanceCounts() const {
     return _perfMap;
 }
@@ -237,6 +294,15 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             t.first = _this;
             t.second = std::move(task);
             workerInferRequest._tasks.push(t);
+            {
+                std::lock_guard<std::mutex> lock(workerInferRequest._statsMutex);
+                auto now = std::chrono::steady_clock::now();
+                if (workerInferRequest._lastArrival != std::chrono::steady_clock::time_point{}) {
+                    const double interval = std::chrono::duration<double, std::milli>(now - workerInferRequest._lastArrival).count();
+                    workerInferRequest._arrivalIntervalMs = movingAverage(workerInferRequest._arrivalIntervalMs, interval);
+                }
+                workerInferRequest._lastArrival = now;
+            }
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = workerInferRequest._tasks.size();
             if (sz == workerInferRequest._batchSize) {
@@ -269,11 +335,13 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
-    const bool needPerfCounters)
+    const bool needPerfCounters,
+    const std::vector<std::pair<int, InferenceEngine::SoExecutableNetworkInternal>>& ladderNetworks)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _ladderNetworks{ladderNetworks},
       _config{config},
       _needPerfCounters{needPerfCounters} {
     // WA for gcc 4.8 ( fails compilation with member init-list)
@@ -281,6 +349,9 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     if (time_out != config.end())
         _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto latency_budget = config.find(PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_BUDGET);
+    if (latency_budget != config.end())
+        _latencyBudget = ParseLatencyBudgetValue(latency_budget->second.as<std::string>());
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -298,6 +369,95 @@ unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s)
     return val;
 }
 
+unsigned int AutoBatchExecutableNetwork::ParseLatencyBudgetValue(const std::string& s) {
+    auto val = std::stoi(s);
+    if (val < 0)
+        IE_THROW(ParameterMismatch) << "Value for the " << PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_BUDGET
+                                    << " should be unsigned int";
+    return val;
+}
+
+void AutoBatchExecutableNetwork::UpdateTimeout(WorkerInferRequest& workerRequest) const {
+    const int budget = _latencyBudget;
+    if (!budget) {
+        workerRequest._timeOut = _timeOut.load();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(workerRequest._statsMutex);
+    // the requests of a full batch are executed batched, the rest are executed with batch1 at the timeout,
+    // so the wait is bounded by the budget minus the slower of the two
+    const double wait = budget - std::max(workerRequest._batchLatencyMs, workerRequest._singleLatencyMs);
+    // the time the batch is expected to be collected for at the current arrival rate
+    const double fill = workerRequest._arrivalIntervalMs * (workerRequest._batchSize - 1);
+    int timeout = 1;
+    if (wait > 1 && fill <= wait)
+        timeout = static_cast<int>(wait);
+    // otherwise the batch is not collected within the budget at all, so the requests shouldn't wait for it
+    workerRequest._timeOut = timeout;
+}
+
+void AutoBatchExecutableNetwork::PrepareBatchedInputs(WorkerInferRequest& workerRequest,
+                                                      const std::vector<AutoBatchInferRequest*>& requests) const {
+    size_t copied = 0, gathered = 0;
+    for (const auto& it : _networkInputs) {
+        const auto& name = it.first;
+        const auto& batched = workerRequest._batchedInputs.at(name);
+        std::vector<Blob::Ptr> blobs;
+        size_t notInPlace = 0;
+        bool sliced = true;
+        for (auto request : requests) {
+            blobs.push_back(request->GetBlob(name));
+            sliced &= blobs.back()->byteSize() * requests.size() == batched->byteSize();
+            if (!request->IsInputInBatchedBlob(name))
+                notInPlace += blobs.back()->byteSize();
+        }
+        if (notInPlace && sliced && !workerRequest._gatherUnsupported) {
+            // the device assembles the batch from the requests' blobs, instead of the copying to the batched blob
+            try {
+                workerRequest._inferRequestBatched->SetBlobs(name, blobs);
+                workerRequest._gatheredInputs.insert(name);
+                gathered += notInPlace;
+                continue;
+            } catch (const std::exception&) {
+                workerRequest._gatherUnsupported = true;
+            }
+        }
+        if (workerRequest._gatheredInputs.erase(name))
+            workerRequest._inferRequestBatched->SetBlob(name, batched);
+        if (notInPlace) {
+            for (auto request : requests)
+                copied += request->CopyInputIfNeeded(name);
+        }
+    }
+    workerRequest._copiedBytes += copied;
+    workerRequest._gatheredBytes += gathered;
+    workerRequest._lastBatchCopiedBytes = copied;
+    workerRequest._lastBatchGatheredBytes = gathered;
+}
+
+void AutoBatchExecutableNetwork::StartLadderRequest(
+    WorkerInferRequest::LadderRequest& ladderRequest,
+    const std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>>& tasks,
+    const std::function<void()>& onCompleted) {
+    // the slots of the batch above the tasks keep the stale data, their outputs are ignored
+    const size_t batch = ladderRequest._batchSize;
+    for (size_t n = 0; n < tasks.size(); n++)
+        tasks[n].first->_inferRequest->CopyInputsToAnotherRequest(ladderRequest._inferRequest, n, batch);
+    ladderRequest._inferRequest->SetCallback([&ladderRequest, tasks, batch, onCompleted](std::exception_ptr p) {
+        for (size_t n = 0; n < tasks.size(); n++) {
+            auto& request = tasks[n].first->_inferRequest;
+            if (p)
+                request->_exceptionPtr = p;
+            else
+                request->CopyOutputsFromAnotherRequest(ladderRequest._inferRequest, n, batch);
+            tasks[n].second();
+            onCompleted();
+        }
+    });
+    ladderRequest._inferRequest->StartAsync();
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
     return _network->GetContext();
 }
@@ -314,10 +474,26 @@ InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateIn
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
+        for (const auto& it : networkInputs) {
+            workerRequestPtr->_batchedInputs[it.first] = workerRequestPtr->_inferRequestBatched->GetBlob(it.first);
+        }
+        for (const auto& it : networkOutputs) {
+            workerRequestPtr->_batchedOutputs[it.first] = workerRequestPtr->_inferRequestBatched->GetBlob(it.first);
+        }
+        for (const auto& ladderNetwork : _ladderNetworks) {
+            workerRequestPtr->_ladderRequests.push_back(
+                {{ladderNetwork.second->CreateInferRequest(), ladderNetwork.second._so}, ladderNetwork.first});
+        }
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                {
+                    std::lock_guard<std::mutex> lock(workerRequestPtr->_statsMutex);
+                    workerRequestPtr->_batchLatencyMs =
+                        movingAverage(workerRequestPtr->_batchLatencyMs, elapsedMs(workerRequestPtr->_batchStart));
+                }
+                workerRequestPtr->_numBatches++;
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -330,9 +506,10 @@ InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateIn
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
             while (1) {
                 std::cv_status status;
+                UpdateTimeout(*workerRequestPtr);
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(workerRequestPtr->_timeOut));
                 }
                 if (_terminate) {
                     break;
@@ -342,33 +519,68 @@ InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateIn
                     const int sz = workerRequestPtr->_tasks.size();
                     if (sz == workerRequestPtr->_batchSize) {
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+                        std::vector<AutoBatchInferRequest*> requests;
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completionTasks[n] = std::move(t.second);
-                            t.first->_inferRequest->CopyInputsIfNeeded();
+                            requests.push_back(t.first->_inferRequest.get());
+                        }
+                        PrepareBatchedInputs(*workerRequestPtr, requests);
+                        {
+                            std::lock_guard<std::mutex> lock(workerRequestPtr->_statsMutex);
+                            workerRequestPtr->_batchStart = std::chrono::steady_clock::now();
                         }
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
+                        // timeout to collect the batch is over, have to execute the requests with the smaller batch
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                        // popping all tasks collected by the moment of the time-out, the ones that don't fit the
+                        // largest compiled smaller batch (if any) are executed each with batch1
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
+                        auto onCompleted = [sz, &arrived, &all_completed]() {
+                            if (sz == ++arrived)
+                                all_completed.set_value();
+                        };
+                        const auto start = std::chrono::steady_clock::now();
+                        // counted before the requests are completed, so the statistics are consistent with the results
+                        workerRequestPtr->_numTimeouts++;
+                        workerRequestPtr->_numTimedOutRequests += sz;
+                        int n = 0;
+                        if (sz > 1 && !workerRequestPtr->_ladderRequests.empty()) {
+                            auto& ladder = workerRequestPtr->_ladderRequests;
+                            auto ladderRequest = std::find_if(ladder.begin(), ladder.end(), [sz](const WorkerInferRequest::LadderRequest& r) {
+                                return r._batchSize >= sz;
+                            });
+                            if (ladderRequest == ladder.end())
+                                ladderRequest = std::prev(ladder.end());
+                            std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> ladderTasks;
+                            for (; n < std::min(sz, ladderRequest->_batchSize); n++) {
+                                IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                                ladderTasks.push_back(std::move(t));
+                            }
+                            workerRequestPtr->_numLadderBatches++;
+                            workerRequestPtr->_numLadderRequests += n;
+                            StartLadderRequest(*ladderRequest, ladderTasks, onCompleted);
+                        }
+                        for (; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, onCompleted](std::exception_ptr p) {
                                     if (p)
                                         t.first->_inferRequest->_exceptionPtr = p;
                                     t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
+                                    onCompleted();
                                 });
                             t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
                             t.first->_inferRequestWithoutBatch->StartAsync();
                         }
                         all_completed_future.get();
+                        {
+                            std::lock_guard<std::mutex> lock(workerRequestPtr->_statsMutex);
+                            workerRequestPtr->_singleLatencyMs = movingAverage(workerRequestPtr->_singleLatencyMs, elapsedMs(start));
+                        }
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -400,12 +612,17 @@ std::shared_ptr<ngraph::Function> AutoBatchExecutableNetwork::GetExecGraphInfo()
 }
 
 void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) {
-    auto timeout = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
-    if (timeout == config.end() || config.size() > 1) {
-        IE_THROW() << "The only config that can be changed on the fly for the AutoBatching the is the "
-                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
-    } else {
-        _timeOut = ParseTimeoutValue(timeout->second.as<std::string>());
+    for (auto&& kvp : config) {
+        if (kvp.first == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+            _timeOut = ParseTimeoutValue(kvp.second.as<std::string>());
+        } else if (kvp.first == PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_BUDGET) {
+            _latencyBudget = ParseLatencyBudgetValue(kvp.second.as<std::string>());
+        } else {
+            IE_THROW() << "The only configs that can be changed on the fly for the AutoBatching are the "
+                       << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " and the "
+                       << PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_BUDGET;
+        }
+        _config[kvp.first] = kvp.second;
     }
 }
 
@@ -441,15 +658,39 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, reqs);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _network->GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(AUTO_BATCH_STATISTICS)) {
+        std::map<std::string, uint64_t> statistics;
+        statistics["BATCH_SIZE"] = _device.batchForDevice;
+        for (size_t i = 0; i < _workerRequests.size(); ++i) {
+            auto& worker = *_workerRequests[i];
+            const auto prefix = "WORKER_" + std::to_string(i) + "_";
+            statistics[prefix + "TIMEOUT_MS"] = worker._timeOut;
+            statistics[prefix + "BATCHES"] = worker._numBatches;
+            statistics[prefix + "TIMEOUTS"] = worker._numTimeouts;
+            statistics[prefix + "TIMED_OUT_REQUESTS"] = worker._numTimedOutRequests;
+            statistics[prefix + "COPIED_BYTES"] = worker._copiedBytes;
+            statistics[prefix + "GATHERED_BYTES"] = worker._gatheredBytes;
+            statistics[prefix + "LAST_BATCH_COPIED_BYTES"] = worker._lastBatchCopiedBytes;
+            statistics[prefix + "LAST_BATCH_GATHERED_BYTES"] = worker._lastBatchGatheredBytes;
+            statistics[prefix + "LADDER_BATCHES"] = worker._numLadderBatches;
+            statistics[prefix + "LADDER_REQUESTS"] = worker._numLadderRequests;
+            std::lock_guard<std::mutex> lock(worker._statsMutex);
+            statistics[prefix + "ARRIVAL_INTERVAL_US"] = static_cast<uint64_t>(worker._arrivalIntervalMs * 1000);
+            statistics[prefix + "BATCH_LATENCY_US"] = static_cast<uint64_t>(worker._batchLatencyMs * 1000);
+            statistics[prefix + "SINGLE_LATENCY_US"] = static_cast<uint64_t>(worker._singleLatencyMs * 1000);
+        }
+        IE_SET_METRIC_RETURN(AUTO_BATCH_STATISTICS, statistics);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS,
                              {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
-                              METRIC_KEY(SUPPORTED_CONFIG_KEYS)});
+                              METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+                              METRIC_KEY(AUTO_BATCH_STATISTICS)});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
-                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
+                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                              PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_BUDGET});  // only the timeouts can be changed on the fly
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -566,15 +807,18 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || name == PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_BUDGET) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception& e) {
                 IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                    << " Expecting unsigned int value for " << name << " got " << val;
             }
+        } else if (name == PluginConfigInternalParams::KEY_AUTO_BATCH_LADDER) {
+            if (val != PluginConfigParams::YES && val != PluginConfigParams::NO)
+                IE_THROW(ParameterMismatch) << " Expecting YES or NO value for " << name << " got " << val;
         }
     }
 }
@@ -669,8 +913,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
-    InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
-    if (metaDevice.batchForDevice > 1) {
+    auto loadWithBatch = [&](int batch) -> InferenceEngine::SoExecutableNetworkInternal {
         try {
             CNNNetwork clonedNetwork(InferenceEngine::details::cloneNetwork(network));
             const InputsDataMap inputInfo = clonedNetwork.getInputsInfo();
@@ -683,28 +926,43 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
                     layout == InferenceEngine::Layout::NCHW || layout == InferenceEngine::Layout::NHWC ||
                     layout == InferenceEngine::Layout::NDHWC) {
                     assert(1 == shapes[item.first][0]);  // do not reshape/re-batch originally batched networks
-                    shapes[item.first][0] = metaDevice.batchForDevice;
+                    shapes[item.first][0] = batch;
                 }
             }
             clonedNetwork.reshape(shapes);
-            executableNetworkWithBatch =
-                ctx ? GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, ctx, deviceConfig)
-                    : GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, deviceName, deviceConfig);
+            return ctx ? GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, ctx, deviceConfig)
+                       : GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, deviceName, deviceConfig);
         } catch (...) {
-            executableNetworkWithBatch = {nullptr, nullptr};
+            return {nullptr, nullptr};
         }
-    }
+    };
+
+    InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
+    if (metaDevice.batchForDevice > 1)
+        executableNetworkWithBatch = loadWithBatch(metaDevice.batchForDevice);
 
     if (!executableNetworkWithBatch) {
         executableNetworkWithBatch = executableNetworkWithoutBatch;
         metaDevice.batchForDevice = 1;
     }
 
+    // the smaller batches the timed out requests are executed with, the ones failed to compile are just skipped
+    std::vector<std::pair<int, InferenceEngine::SoExecutableNetworkInternal>> ladderNetworks;
+    const auto ladder = fullConfig.find(PluginConfigInternalParams::KEY_AUTO_BATCH_LADDER);
+    if (ladder != fullConfig.end() && ladder->second == PluginConfigParams::YES) {
+        for (int batch = metaDevice.batchForDevice / 4; batch > 1; batch /= 4) {
+            auto executableNetwork = loadWithBatch(batch);
+            if (executableNetwork)
+                ladderNetworks.insert(ladderNetworks.begin(), {batch, executableNetwork});
+        }
+    }
+
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
                                                         metaDevice,
                                                         networkConfig,
-                                                        enablePerfCounters);
+                                                        enablePerfCounters,
+                                                        ladderNetworks);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(
@@ -6,8 +6,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -29,6 +32,7 @@ struct DeviceInformation {
     int batchForDevice;
 };
 
+class AutoBatchInferRequest;
 class AutoBatchAsyncInferRequest;
 class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
@@ -43,6 +47,38 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+
+        // the measurements the adaptive timeout is computed from (moving averages in ms), guarded by the _statsMutex
+        std::mutex _statsMutex;
+        std::chrono::steady_clock::time_point _lastArrival;
+        std::chrono::steady_clock::time_point _batchStart;
+        double _arrivalIntervalMs = 0;
+        double _batchLatencyMs = 0;
+        double _singleLatencyMs = 0;
+        std::atomic_int _timeOut = {1000};  // in ms
+        std::atomic_size_t _numBatches = {0};
+        std::atomic_size_t _numTimeouts = {0};
+        std::atomic_size_t _numTimedOutRequests = {0};
+
+        // the blobs the requests' input blobs are created on top of (the batched request may hold the gathered ones)
+        std::map<std::string, InferenceEngine::Blob::Ptr> _batchedInputs;
+        // the inputs set to the batched request as the individual blobs of the requests, used by the worker thread only
+        std::set<std::string> _gatheredInputs;
+        bool _gatherUnsupported = false;
+        std::atomic_size_t _copiedBytes = {0};
+        std::atomic_size_t _gatheredBytes = {0};
+        std::atomic_size_t _lastBatchCopiedBytes = {0};
+        std::atomic_size_t _lastBatchGatheredBytes = {0};
+
+        // the requests of the smaller compiled batches (in the ascending order) the timed out requests are executed with
+        struct LadderRequest {
+            InferenceEngine::SoIInferRequestInternal _inferRequest;
+            int _batchSize;
+        };
+        std::vector<LadderRequest> _ladderRequests;
+        std::map<std::string, InferenceEngine::Blob::Ptr> _batchedOutputs;
+        std::atomic_size_t _numLadderBatches = {0};
+        std::atomic_size_t _numLadderRequests = {0};
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -50,7 +86,8 @@ public:
         const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithoutBatch,
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
-        const bool needPerfCounters = false);
+        const bool needPerfCounters = false,
+        const std::vector<std::pair<int, InferenceEngine::SoExecutableNetworkInternal>>& ladderNetworks = {});
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
@@ -65,15 +102,23 @@ public:
 
 protected:
     static unsigned int ParseTimeoutValue(const std::string&);
+    static unsigned int ParseLatencyBudgetValue(const std::string&);
+    void UpdateTimeout(WorkerInferRequest& workerRequest) const;
+    void PrepareBatchedInputs(WorkerInferRequest& workerRequest, const std::vector<AutoBatchInferRequest*>& requests) const;
+    static void StartLadderRequest(WorkerInferRequest::LadderRequest& ladderRequest,
+                                   const std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>>& tasks,
+                                   const std::function<void()>& onCompleted);
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    std::vector<std::pair<int, InferenceEngine::SoExecutableNetworkInternal>> _ladderNetworks;  // ascending batch sizes
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {1000};  // in ms
+    std::atomic_int _latencyBudget = {0};  // in ms, 0 means the fixed _timeOut
 };
 
 class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -89,15 +134,19 @@ public:
 
     // Batch-Device impl specific: sets the data (blobs from the device request to the batched device request)
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
-    void CopyInputsIfNeeded();
+    bool IsInputInBatchedBlob(const std::string& name);
+    size_t CopyInputIfNeeded(const std::string& name);
     void CopyOutputsIfNeeded();
+    // Ladder impl specific: copies the data to/from the 'slot' of the batch of another (smaller) batched request
+    void CopyInputsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot, size_t batch);
+    void CopyOutputsFromAnotherRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot, size_t batch);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
 
 protected:
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfMap;
     bool _needPerfCounters = false;
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    size_t CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
     size_t _batchId;
     size_t _batchSize;
 };
@@ -4,6 +4,7 @@
 
 #include "async_infer_request.hpp"
 
+#include <chrono>
 #include <memory>
 #include <utility>
 
@@ -18,24 +19,47 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
+            explicit RequestExecutor(SoIInferRequestInternal& inferRequest, const SubgraphStage::Ptr& stage)
+                : _inferRequest(inferRequest),
+                  _stage(stage) {
                 _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
                     _exceptionPtr = exceptionPtr;
+                    if (!exceptionPtr) {
+                        _stage->Measure(std::chrono::steady_clock::now() - _startTime, _startTime - _submitTime);
+                    }
+                    // the next waiting request takes the place in the stage before this one goes to the next stage
+                    _stage->Complete();
                     auto capturedTask = std::move(_task);
                     capturedTask();
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                _exceptionPtr = nullptr;
+                _submitTime = std::chrono::steady_clock::now();
+                _stage->Run([this] {
+                    _startTime = std::chrono::steady_clock::now();
+                    try {
+                        _inferRequest->StartAsync();
+                    } catch (...) {
+                        // may be started by the completion of another request, so the error is passed to the pipeline
+                        _exceptionPtr = std::current_exception();
+                        _stage->Complete();
+                        auto capturedTask = std::move(_task);
+                        capturedTask();
+                    }
+                });
             };
             SoIInferRequestInternal& _inferRequest;
+            SubgraphStage::Ptr _stage;
             std::exception_ptr _exceptionPtr;
             Task _task;
+            std::chrono::steady_clock::time_point _submitTime;
+            std::chrono::steady_clock::time_point _startTime;
         };
 
-        auto requestExecutor =
-            std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
+        auto& subRequest = _heteroInferRequest->_inferRequests[requestId];
+        auto requestExecutor = std::make_shared<RequestExecutor>(subRequest._request, subRequest._stage);
         _pipeline.emplace_back(requestExecutor, [requestExecutor] {
             if (nullptr != requestExecutor->_exceptionPtr) {
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
@@ -28,6 +28,7 @@
 #include <memory>
 #include <unordered_set>
 #include <array>
+#include <sstream>
 #include <cstdint>
 
 #include "openvino/pass/serialize.hpp"
@@ -36,12 +37,14 @@
 #include "ie_algorithm.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "plugin.hpp"
+#include "partitioner.hpp"
 #include <ie_algorithm.hpp>
 
 #include <ngraph/function.hpp>
 #include <ngraph/variant.hpp>
 #include <ngraph/graph_util.hpp>
 #include <ngraph/op/result.hpp>
+#include <ngraph/op/convert.hpp>
 #include <ngraph/op/parameter.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/rt_info.hpp>
@@ -91,7 +94,14 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+            auto itCostBased = _config.find(CONFIG_KEY_INTERNAL(HETERO_COST_BASED_PARTITIONING));
+            auto itPipeline = _config.find(CONFIG_KEY_INTERNAL(HETERO_PIPELINE_PARTITIONING));
+            const bool pipeline = itPipeline != _config.end() && itPipeline->second == YES;
+            if (pipeline || (itCostBased != _config.end() && itCostBased->second == YES)) {
+                queryNetworkResult.supportedLayersMap = CostBasedPartition(network, clonedFunction, pipeline);
+            } else {
+                queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+            }
         } else {
             IE_THROW() << "The 'TARGET_FALLBACK' option was not defined for heterogeneous device";
         }
@@ -130,6 +140,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         if (itAffinity != queryNetworkResult.supportedLayersMap.end()) {
             affinities[node.get()] = itAffinity->second;
             devices.emplace(itAffinity->second);
+            _partition.emplace(node->get_friendly_name(), itAffinity->second);
         } else if (allEmpty) {
             IE_THROW() << "Hetero device used default fallback policy, but some layers eg: \n(Name:"
                        << node->get_friendly_name() << ", Type: " << node->get_type_name()
@@ -299,6 +310,29 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         }
     }
 
+    // The precision of the FP32 tensors transferred between the devices
+    ngraph::element::Type transferPrecision;
+    std::unordered_set<std::string> transferLayers;
+    auto itTransferPrecision = _config.find(CONFIG_KEY_INTERNAL(HETERO_TRANSFER_PRECISION));
+    if (itTransferPrecision != _config.end() && !itTransferPrecision->second.empty()) {
+        if (itTransferPrecision->second == "FP16") {
+            transferPrecision = ngraph::element::f16;
+        } else if (itTransferPrecision->second == "BF16") {
+            transferPrecision = ngraph::element::bf16;
+        } else {
+            IE_THROW() << "Wrong value " << itTransferPrecision->second << " for the key "
+                       << CONFIG_KEY_INTERNAL(HETERO_TRANSFER_PRECISION) << ", expected FP16 or BF16";
+        }
+        auto itTransferLayers = _config.find(CONFIG_KEY_INTERNAL(HETERO_TRANSFER_LAYERS));
+        if (itTransferLayers != _config.end()) {
+            std::stringstream layers{itTransferLayers->second};
+            for (std::string layer; std::getline(layers, layer, ',');) {
+                if (!layer.empty())
+                    transferLayers.emplace(layer);
+            }
+        }
+    }
+
     auto subgraphIds = CollectSubgraphs();
     // Break graph using insertion of result parameter split
     NodeMap<ngraph::Node*> subgraphParameterToPrevResult;
@@ -306,26 +340,56 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     for (auto&& input : subgraphInputs) {
         if (!ngraph::op::is_parameter(input.get_node()) && !ngraph::op::is_constant(input.get_node())) {
             auto output = input.get_source_output();
+            auto producer = output.get_node();
+            auto consumer = input.get_node();
             output.remove_target_input(input);
-            auto result = std::make_shared<ngraph::op::Result>(output);
-            result->set_friendly_name(output.get_node()->get_friendly_name() + "_" +
+            // the tensors crossing the devices are converted by the producer device and converted back by the consumer
+            // one, so both the transfer and the intermediate blob are smaller
+            const bool compress = transferPrecision != ngraph::element::undefined &&
+                                  output.get_element_type() == ngraph::element::f32 &&
+                                  affinities[producer] != affinities[consumer] &&
+                                  (transferLayers.empty() || contains(transferLayers, producer->get_friendly_name()));
+            auto resultSource = output;
+            if (compress) {
+                auto convert = std::make_shared<ngraph::op::v0::Convert>(output, transferPrecision);
+                convert->set_friendly_name(producer->get_friendly_name() + "_" + std::to_string(output.get_index()) +
+                                           "_transfer");
+                ngraph::copy_runtime_info(output.get_node_shared_ptr(), convert);
+                subgraphIds.emplace(convert.get(), subgraphIds[producer]);
+                affinities[convert.get()] = affinities[producer];
+                _partition.emplace(convert->get_friendly_name(), affinities[producer]);
+                resultSource = convert->output(0);
+            }
+            auto result = std::make_shared<ngraph::op::Result>(resultSource);
+            result->set_friendly_name(producer->get_friendly_name() + "_" +
                                       std::to_string(output.get_index()) + "_result");
             ngraph::copy_runtime_info(output.get_node_shared_ptr(), result);
             auto parameter =
-                std::make_shared<ngraph::op::Parameter>(output.get_element_type(), output.get_partial_shape());
-            parameter->set_friendly_name(input.get_node()->get_friendly_name() + "_" +
+                std::make_shared<ngraph::op::Parameter>(resultSource.get_element_type(), output.get_partial_shape());
+            parameter->set_friendly_name(consumer->get_friendly_name() + "_" +
                                          std::to_string(input.get_index()) + "_parameter");
-            ngraph::copy_runtime_info(input.get_node()->shared_from_this(), parameter);
-            input.replace_source_output(parameter->output(0));
+            ngraph::copy_runtime_info(consumer->shared_from_this(), parameter);
+            if (compress) {
+                auto convert = std::make_shared<ngraph::op::v0::Convert>(parameter, output.get_element_type());
+                convert->set_friendly_name(parameter->get_friendly_name() + "_transfer");
+                ngraph::copy_runtime_info(consumer->shared_from_this(), convert);
+                subgraphIds.emplace(convert.get(), subgraphIds[consumer]);
+                affinities[convert.get()] = affinities[consumer];
+                _partition.emplace(convert->get_friendly_name(), affinities[consumer]);
+                input.replace_source_output(convert->output(0));
+            } else {
+                input.replace_source_output(parameter->output(0));
+            }
             results.push_back(result);
-            subgraphIds.emplace(result.get(), subgraphIds[output.get_node()]);
-            subgraphIds.emplace(parameter.get(), subgraphIds[input.get_node()]);
+            subgraphIds.emplace(result.get(), subgraphIds[producer]);
+            subgraphIds.emplace(parameter.get(), subgraphIds[consumer]);
             subgraphParameterToPrevResult.emplace(parameter.get(), result.get());
+            auto resultProducer = resultSource.get_node();
             _blobNameMap.emplace(
                 parameter->get_friendly_name(),
-                output.get_node()->get_friendly_name() + ((output.get_node()->get_output_size() != 1)
-                                                              ? ("." + std::to_string(output.get_index()))
-                                                              : std::string{}));
+                resultProducer->get_friendly_name() + ((resultProducer->get_output_size() != 1)
+                                                           ? ("." + std::to_string(resultSource.get_index()))
+                                                           : std::string{}));
         }
     }
 
@@ -488,6 +552,63 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                                                  network._device,
                                                                  metaDevices[network._device]);
     }
+    InitStages();
+}
+
+namespace {
+
+template <typename T>
+std::map<std::string, T> ParseDevicesValues(const std::map<std::string, std::string>& config, const std::string& key) {
+    auto it = config.find(key);
+    if (it == config.end() || it->second.empty()) {
+        return {};
+    }
+    try {
+        return CostBasedPartitioner::ParseDevicesValues<T>(it->second);
+    } catch (const InferenceEngine::Exception& ex) {
+        IE_THROW() << ex.what() << " for the key " << key;
+    }
+}
+
+}  // namespace
+
+std::map<std::string, std::string> HeteroExecutableNetwork::CostBasedPartition(
+    const InferenceEngine::CNNNetwork& network,
+    const std::shared_ptr<const ngraph::Function>& function,
+    bool pipeline) const {
+    auto queryResults = _heteroPlugin->QueryNetworkByDevice(network, _config);
+    auto fallbackDevices = DeviceIDParser::getHeteroDevices(_config.at("TARGET_FALLBACK"));
+    std::map<std::string, std::unordered_set<std::string>> supportedLayers;
+    for (auto&& deviceName : fallbackDevices) {
+        auto& layers = supportedLayers[deviceName];
+        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+            layers.emplace(layerQueryResult.first);
+        }
+    }
+
+    auto performance = ParseDevicesValues<double>(_config, CONFIG_KEY_INTERNAL(HETERO_DEVICES_PERFORMANCE));
+    auto memoryCaps = ParseDevicesValues<uint64_t>(_config, CONFIG_KEY_INTERNAL(HETERO_DEVICES_MEMORY_CAP));
+
+    CostBasedPartitioner partitioner{fallbackDevices, performance, memoryCaps};
+    auto partition = pipeline ? partitioner.PartitionPipeline(function, supportedLayers)
+                              : partitioner.Partition(function, supportedLayers);
+    return {partition.begin(), partition.end()};
+}
+
+void HeteroExecutableNetwork::InitStages() {
+    unsigned int maxRequests = 0;
+    auto it = _config.find(CONFIG_KEY_INTERNAL(HETERO_PIPELINE_STAGE_REQUESTS));
+    if (it != _config.end()) {
+        try {
+            maxRequests = static_cast<unsigned int>(std::stoul(it->second));
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value " << it->second << " for the key "
+                       << CONFIG_KEY_INTERNAL(HETERO_PIPELINE_STAGE_REQUESTS) << ", expected unsigned integer";
+        }
+    }
+    for (auto&& network : _networks) {
+        network._stage = std::make_shared<SubgraphStage>(maxRequests);
+    }
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
@@ -642,6 +763,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     // save state
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
+    InitStages();
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
 }
 
@@ -783,6 +905,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
+        desc._stage = subnetwork._stage;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
@@ -796,6 +919,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
+        desc._stage = subnetwork._stage;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
@@ -815,6 +939,19 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         } else {
             result = std::string{};
         }
+    } else if (name == CONFIG_KEY_INTERNAL(HETERO_PIPELINE_STAGE_REQUESTS)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{"0"};
+    } else if (name == CONFIG_KEY_INTERNAL(HETERO_COST_BASED_PARTITIONING) ||
+               name == CONFIG_KEY_INTERNAL(HETERO_PIPELINE_PARTITIONING)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{NO};
+    } else if (name == CONFIG_KEY_INTERNAL(HETERO_DEVICES_PERFORMANCE) ||
+               name == CONFIG_KEY_INTERNAL(HETERO_DEVICES_MEMORY_CAP) ||
+               name == CONFIG_KEY_INTERNAL(HETERO_TRANSFER_PRECISION) ||
+               name == CONFIG_KEY_INTERNAL(HETERO_TRANSFER_LAYERS)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{};
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
@@ -898,7 +1035,14 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (EXEC_NETWORK_METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
-                                                     CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
+                                                     CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
+                                                     CONFIG_KEY_INTERNAL(HETERO_PIPELINE_STAGE_REQUESTS),
+                                                     CONFIG_KEY_INTERNAL(HETERO_COST_BASED_PARTITIONING),
+                                                     CONFIG_KEY_INTERNAL(HETERO_PIPELINE_PARTITIONING),
+                                                     CONFIG_KEY_INTERNAL(HETERO_DEVICES_PERFORMANCE),
+                                                     CONFIG_KEY_INTERNAL(HETERO_DEVICES_MEMORY_CAP),
+                                                     CONFIG_KEY_INTERNAL(HETERO_TRANSFER_PRECISION),
+                                                     CONFIG_KEY_INTERNAL(HETERO_TRANSFER_LAYERS)};
 
         {
             std::vector<::Metrics> pluginConfigKeys;
@@ -919,12 +1063,21 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (EXEC_NETWORK_METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // every subgraph executes its optimal number of the requests at once, while the other requests are executed
+        // by the other subgraphs, so the devices work in parallel
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (METRIC_KEY(HETERO_PIPELINE_STATISTICS) == name) {
+        std::map<std::string, uint64_t> statistics;
+        for (size_t i = 0; i < _networks.size(); ++i) {
+            _networks[i]._stage->GetStatistics("STAGE_" + std::to_string(i) + "_", statistics);
+        }
+        IE_SET_METRIC_RETURN(HETERO_PIPELINE_STATISTICS, statistics);
+    } else if (METRIC_KEY(HETERO_PARTITION) == name) {
+        IE_SET_METRIC_RETURN(HETERO_PARTITION, _partition);
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : _networks) {
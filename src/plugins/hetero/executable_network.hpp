@@ -65,11 +65,16 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    void InitStages();
+    std::map<std::string, std::string> CostBasedPartition(const InferenceEngine::CNNNetwork& network,
+                                                          const std::shared_ptr<const ngraph::Function>& function,
+                                                          bool pipeline) const;
 
     struct NetworkDesc {
         std::string _device;
         InferenceEngine::CNNNetwork _clonedNetwork;
         InferenceEngine::SoExecutableNetworkInternal _network;
+        SubgraphStage::Ptr _stage;
     };
 
     std::vector<NetworkDesc> _networks;
@@ -77,6 +82,7 @@ private:
     std::string _name;
     std::map<std::string, std::string> _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    std::map<std::string, std::string> _partition;  // the devices of the layers, empty for the imported networks
 };
 
 }  // namespace HeteroPlugin
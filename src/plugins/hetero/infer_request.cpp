@@ -6,7 +6,9 @@
 
 #include <ie_blob.h>
 #include <ie_layouts.h>
+#include <ie_remote_context.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <description_buffer.hpp>
 #include <ie_algorithm.hpp>
@@ -19,6 +21,55 @@ using namespace HeteroPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+SubgraphStage::SubgraphStage(unsigned int maxRequests) : _maxRequests{maxRequests} {}
+
+void SubgraphStage::Run(Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_maxRequests && _runningRequests >= _maxRequests) {
+            _waitingTasks.push(std::move(task));
+            _maxQueued = std::max(_maxQueued, _waitingTasks.size());
+            return;
+        }
+        _runningRequests++;
+    }
+    task();
+}
+
+void SubgraphStage::Complete() {
+    Task next;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_waitingTasks.empty()) {
+            _runningRequests--;
+            return;
+        }
+        // the completed request passes its place to the waiting one
+        next = std::move(_waitingTasks.front());
+        _waitingTasks.pop();
+    }
+    next();
+}
+
+void SubgraphStage::Measure(Duration latency, Duration wait) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _inferences++;
+    _latency += latency;
+    _wait += wait;
+}
+
+void SubgraphStage::GetStatistics(const std::string& prefix, std::map<std::string, uint64_t>& statistics) const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto averageUs = [&](Duration total) -> uint64_t {
+        return _inferences ? std::chrono::duration_cast<std::chrono::microseconds>(total).count() / _inferences : 0;
+    };
+    statistics[prefix + "INFERENCES"] = _inferences;
+    statistics[prefix + "LATENCY_US"] = averageUs(_latency);
+    statistics[prefix + "WAIT_US"] = averageUs(_wait);
+    statistics[prefix + "MAX_QUEUED"] = _maxQueued;
+    statistics[prefix + "REQUESTS"] = _maxRequests;
+}
+
 HeteroInferRequest::HeteroInferRequest(
     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
     const std::vector<std::shared_ptr<const ov::Node>>& outputs,
@@ -67,9 +118,53 @@ void HeteroInferRequest::CreateInferRequest(
         }
     });
 
+    // the remote context of every subnet, if supported
+    auto getContext = [](const SubRequestDesc& desc) -> RemoteContext::Ptr {
+        try {
+            return desc._network->GetContext();
+        } catch (const InferenceEngine::Exception&) {
+            return nullptr;
+        }
+    };
+    // the contexts of the subnets consuming every intermediate blob, null if any of them doesn't have a context
+    std::unordered_map<std::string, std::vector<RemoteContext::Ptr>> consumerContexts;
+    for (auto&& desc : _inferRequests) {
+        auto context = getContext(desc);
+        for (auto&& inputInfo : desc._network->GetInputsInfo()) {
+            if (InferenceEngine::details::contains(_networkInputs, inputInfo.first))
+                continue;
+            auto itName = subgraphInputToOutputBlobNames.find(inputInfo.first);
+            auto& intermediateBlobName = itName != subgraphInputToOutputBlobNames.end() ? itName->second : inputInfo.first;
+            consumerContexts[intermediateBlobName].push_back(context);
+        }
+    }
+
     // go over all subnet and create requests
     for (auto&& desc : _inferRequests) {
         desc._request = {desc._network->CreateInferRequest(), desc._network._so};
+        // the intermediate blobs passed between the subnets of the same device are allocated by the device,
+        // so the data stays in the device memory
+        auto context = getContext(desc);
+        if (context) {
+            for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
+                auto itConsumers = consumerContexts.find(outputInfo.first);
+                if (InferenceEngine::details::contains(_networkOutputs, outputInfo.first) ||
+                    itConsumers == consumerContexts.end() ||
+                    !std::all_of(itConsumers->second.begin(),
+                                 itConsumers->second.end(),
+                                 [&](const RemoteContext::Ptr& consumerContext) {
+                                     return consumerContext == context;
+                                 })) {
+                    continue;
+                }
+                try {
+                    auto blob = context->CreateBlob(desc._request->GetBlob(outputInfo.first)->getTensorDesc());
+                    desc._request->SetBlob(outputInfo.first, blob);
+                } catch (const InferenceEngine::Exception&) {
+                    // keep the blob of the request
+                }
+            }
+        }
         // go over all inputs and get blobs from subnet infer requests
         for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
             requestBlob(outputInfo.first, desc._request, true);
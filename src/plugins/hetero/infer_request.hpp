@@ -6,17 +6,65 @@
 
 #include <ie_common.h>
 
+#include <chrono>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <openvino/itt.hpp>
+#include <queue>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace HeteroPlugin {
 
+/**
+ * @brief A subgraph of the HETERO executable network as a stage of the pipeline of its asynchronous infer requests.
+ * Bounds the number of the requests the subgraph executes at once, the rest wait in the stage queue, so the requests
+ * flow through the devices one stage after another, and measures the latency of the stage
+ */
+class SubgraphStage {
+public:
+    using Ptr = std::shared_ptr<SubgraphStage>;
+    using Duration = std::chrono::steady_clock::duration;
+
+    /**
+     * @param maxRequests The number of the requests executed at once, zero means no bound
+     */
+    explicit SubgraphStage(unsigned int maxRequests);
+
+    /**
+     * @brief Runs the task which starts the subgraph request now, or once one of the executed requests completes
+     */
+    void Run(InferenceEngine::Task task);
+
+    /**
+     * @brief Called by the completed subgraph request, runs the next waiting task
+     */
+    void Complete();
+
+    void Measure(Duration latency, Duration wait);
+
+    /**
+     * @brief The number of the requests ("<prefix>INFERENCES"), the average latency and wait in the queue in microseconds
+     * ("<prefix>LATENCY_US", "<prefix>WAIT_US"), the biggest number of the waiting requests ("<prefix>MAX_QUEUED") and
+     * the bound ("<prefix>REQUESTS")
+     */
+    void GetStatistics(const std::string& prefix, std::map<std::string, uint64_t>& statistics) const;
+
+private:
+    const unsigned int _maxRequests;
+    unsigned int _runningRequests = 0;
+    std::queue<InferenceEngine::Task> _waitingTasks;
+    uint64_t _inferences = 0;
+    Duration _latency = Duration::zero();
+    Duration _wait = Duration::zero();
+    size_t _maxQueued = 0;
+    mutable std::mutex _mutex;
+};
+
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -25,6 +73,7 @@ public:
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
         openvino::itt::handle_t _profilingTask;
+        SubgraphStage::Ptr _stage;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
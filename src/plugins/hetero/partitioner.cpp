@@ -0,0 +1,446 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "partitioner.hpp"
+
+#include <algorithm>
+#include <ie_common.h>
+#include <limits>
+#include <ngraph/op/util/op_types.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <queue>
+#include <sstream>
+
+#include "ie_icore.hpp"
+
+using namespace HeteroPlugin;
+
+namespace {
+
+// the transfer of a tensor between the devices: the synchronization and the copy
+constexpr double transferOverheadUs = 20.;
+constexpr double transferBytesPerUs = 10000.;
+// the cost of the bytes over the memory cap starts from and is increased by till the weights fit
+constexpr double initialMemoryPenaltyUsPerByte = 1e-6;
+constexpr double memoryPenaltyStep = 4.;
+constexpr int maxMemoryPenaltySteps = 20;
+constexpr double infiniteCost = 1e15;
+
+CostBasedPartitioner::DeviceCost DefaultDeviceCost(const std::string& device) {
+    const auto deviceName = InferenceEngine::DeviceIDParser(device).getDeviceName();
+    if (deviceName == "GPU") {
+        return {500000., 10.};
+    }
+    return {50000., deviceName == "CPU" ? 2. : 10.};
+}
+
+size_t ElementsCount(const ngraph::PartialShape& shape) {
+    return shape.is_static() ? ngraph::shape_size(shape.to_shape()) : 1;
+}
+
+// the multiply-accumulate operations of the node, the elementwise ones do one per output element
+double NodeMacs(const ngraph::Node& node) {
+    double outputElements = 0;
+    for (size_t i = 0; i < node.get_output_size(); ++i) {
+        outputElements += ElementsCount(node.get_output_partial_shape(i));
+    }
+    double reduction = 1;
+    if (ngraph::is_type<ngraph::opset1::Convolution>(&node) ||
+        ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(&node)) {
+        // OIYX weights: reduced over the input channels and the kernel
+        const auto weights = node.get_input_partial_shape(1);
+        if (weights.is_static())
+            reduction = ngraph::shape_size(weights.to_shape()) / std::max<size_t>(weights.to_shape()[0], 1);
+    } else if (ngraph::is_type<ngraph::opset1::GroupConvolution>(&node) ||
+               ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(&node)) {
+        // GOIYX weights
+        const auto weights = node.get_input_partial_shape(1);
+        if (weights.is_static() && weights.rank().get_length() > 2) {
+            const auto shape = weights.to_shape();
+            reduction = ngraph::shape_size(shape) / std::max<size_t>(shape[0] * shape[1], 1);
+        }
+    } else if (auto matMul = ngraph::as_type<const ngraph::opset1::MatMul>(&node)) {
+        const auto a = node.get_input_partial_shape(0);
+        if (a.rank().is_static() && a.rank().get_length() > 0) {
+            const auto rank = a.rank().get_length();
+            const auto k = (matMul->get_transpose_a() && rank > 1) ? a[rank - 2] : a[rank - 1];
+            if (k.is_static())
+                reduction = static_cast<double>(k.get_length());
+        }
+    }
+    return outputElements * reduction;
+}
+
+uint64_t NodeWeightsBytes(const ngraph::Node& node) {
+    uint64_t bytes = 0;
+    for (auto&& input : node.inputs()) {
+        auto source = input.get_source_output();
+        if (ngraph::op::is_constant(source.get_node())) {
+            bytes += ElementsCount(source.get_partial_shape()) * source.get_element_type().size();
+        }
+    }
+    return bytes;
+}
+
+// Dinic max flow, the partition of the vertices is the minimal cut
+class MaxFlow {
+public:
+    explicit MaxFlow(size_t vertices) : _graph(vertices), _level(vertices), _next(vertices) {}
+
+    void AddEdge(size_t from, size_t to, double capacity) {
+        if (capacity <= 0)
+            return;
+        _graph[from].push_back(_edges.size());
+        _edges.push_back({to, capacity});
+        _graph[to].push_back(_edges.size());
+        _edges.push_back({from, 0});
+    }
+
+    void Run(size_t source, size_t sink) {
+        while (Levels(source, sink)) {
+            std::fill(_next.begin(), _next.end(), 0);
+            while (Augment(source, sink, std::numeric_limits<double>::max()) > 0) {
+            }
+        }
+    }
+
+    // valid after Run
+    bool IsSourceSide(size_t vertex) const {
+        return _level[vertex] >= 0;
+    }
+
+private:
+    struct Edge {
+        size_t to;
+        double capacity;
+    };
+    static constexpr double epsilon = 1e-9;
+
+    bool Levels(size_t source, size_t sink) {
+        std::fill(_level.begin(), _level.end(), -1);
+        std::queue<size_t> vertices;
+        _level[source] = 0;
+        vertices.push(source);
+        while (!vertices.empty()) {
+            auto vertex = vertices.front();
+            vertices.pop();
+            for (auto edgeId : _graph[vertex]) {
+                auto& edge = _edges[edgeId];
+                if (edge.capacity > epsilon && _level[edge.to] < 0) {
+                    _level[edge.to] = _level[vertex] + 1;
+                    vertices.push(edge.to);
+                }
+            }
+        }
+        return _level[sink] >= 0;
+    }
+
+    double Augment(size_t vertex, size_t sink, double flow) {
+        if (vertex == sink)
+            return flow;
+        for (auto& i = _next[vertex]; i < _graph[vertex].size(); ++i) {
+            auto edgeId = _graph[vertex][i];
+            auto& edge = _edges[edgeId];
+            if (edge.capacity > epsilon && _level[edge.to] == _level[vertex] + 1) {
+                auto pushed = Augment(edge.to, sink, std::min(flow, edge.capacity));
+                if (pushed > 0) {
+                    edge.capacity -= pushed;
+                    _edges[edgeId ^ 1].capacity += pushed;
+                    return pushed;
+                }
+            }
+        }
+        return 0;
+    }
+
+    std::vector<Edge> _edges;
+    std::vector<std::vector<size_t>> _graph;
+    std::vector<int> _level;
+    std::vector<size_t> _next;
+};
+
+struct Problem {
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;  // in the topological order
+    std::vector<std::vector<double>> nodeCosts;        // per node and device, infiniteCost if not supported
+    std::vector<uint64_t> weightsBytes;
+    struct Transfer {
+        size_t from;
+        size_t to;
+        double cost;
+    };
+    std::vector<Transfer> transfers;
+
+    double Energy(const std::vector<size_t>& labels) const {
+        double energy = 0;
+        for (size_t node = 0; node < labels.size(); ++node)
+            energy += nodeCosts[node][labels[node]];
+        for (auto&& transfer : transfers)
+            energy += labels[transfer.from] != labels[transfer.to] ? transfer.cost : 0;
+        return energy;
+    }
+
+    // moves the nodes to the device where it decreases the energy (alpha expansion, the transfer cost is a metric)
+    bool Expand(std::vector<size_t>& labels, size_t device) const {
+        const auto numNodes = labels.size();
+        const auto source = numNodes, sink = numNodes + 1;
+        // the costs of the node keeping the device (source side) and moving to the new one (sink side)
+        std::vector<double> keepCosts(numNodes), moveCosts(numNodes);
+        for (size_t node = 0; node < numNodes; ++node) {
+            keepCosts[node] = nodeCosts[node][labels[node]];
+            moveCosts[node] = labels[node] == device ? infiniteCost : nodeCosts[node][device];
+        }
+        MaxFlow graph(numNodes + 2);
+        for (auto&& transfer : transfers) {
+            const auto p = transfer.from, q = transfer.to;
+            const auto cost = transfer.cost;
+            // the binary energy E(xp, xq), 1 means moving to the device, decomposed to the graph edges:
+            // E = A + (C - A) xp + (D - C) xq + (B + C - A - D) (1 - xp) xq
+            const double A = labels[p] != labels[q] ? cost : 0;
+            const double B = labels[p] != device ? cost : 0;
+            const double C = device != labels[q] ? cost : 0;
+            const double D = 0;
+            if (C - A > 0)
+                moveCosts[p] += C - A;
+            else
+                keepCosts[p] += A - C;
+            keepCosts[q] += C - D;
+            graph.AddEdge(p, q, B + C - A - D);
+        }
+        for (size_t node = 0; node < numNodes; ++node) {
+            graph.AddEdge(source, node, moveCosts[node]);
+            graph.AddEdge(node, sink, keepCosts[node]);
+        }
+        graph.Run(source, sink);
+
+        auto expanded = labels;
+        for (size_t node = 0; node < numNodes; ++node) {
+            if (!graph.IsSourceSide(node))
+                expanded[node] = device;
+        }
+        if (Energy(expanded) + 1e-6 < Energy(labels)) {
+            labels = std::move(expanded);
+            return true;
+        }
+        return false;
+    }
+};
+
+Problem BuildProblem(const std::shared_ptr<const ngraph::Function>& function,
+                     const std::map<std::string, std::unordered_set<std::string>>& supportedLayers,
+                     const std::vector<std::string>& devices,
+                     const std::vector<CostBasedPartitioner::DeviceCost>& deviceCosts) {
+    // the operations supported by any device are partitioned
+    Problem problem;
+    auto& nodes = problem.nodes;
+    std::unordered_map<const ngraph::Node*, size_t> nodeIds;
+    for (auto&& node : function->get_ordered_ops()) {
+        if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
+            continue;
+        }
+        std::vector<double> costs;
+        bool supported = false;
+        const auto macs = NodeMacs(*node);
+        for (size_t device = 0; device < devices.size(); ++device) {
+            auto itSupported = supportedLayers.find(devices[device]);
+            if (itSupported != supportedLayers.end() && itSupported->second.count(node->get_friendly_name())) {
+                costs.push_back(deviceCosts[device].opOverheadUs + macs / deviceCosts[device].macsPerUs);
+                supported = true;
+            } else {
+                costs.push_back(infiniteCost);
+            }
+        }
+        if (!supported) {
+            continue;
+        }
+        nodeIds.emplace(node.get(), nodes.size());
+        nodes.push_back(node);
+        problem.nodeCosts.push_back(std::move(costs));
+        problem.weightsBytes.push_back(NodeWeightsBytes(*node));
+    }
+    for (auto&& node : nodes) {
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            auto itSource = nodeIds.find(source.get_node());
+            if (itSource == nodeIds.end()) {
+                continue;
+            }
+            const auto bytes = ElementsCount(source.get_partial_shape()) * source.get_element_type().size();
+            problem.transfers.push_back(
+                {itSource->second, nodeIds.at(node.get()), transferOverheadUs + bytes / transferBytesPerUs});
+        }
+    }
+
+    return problem;
+}
+
+}  // namespace
+
+CostBasedPartitioner::CostBasedPartitioner(const std::vector<std::string>& devices,
+                                           const std::map<std::string, double>& performance,
+                                           const std::map<std::string, uint64_t>& memoryCaps)
+    : _devices{devices} {
+    for (auto&& device : _devices) {
+        auto cost = DefaultDeviceCost(device);
+        auto itPerformance = performance.find(device);
+        if (itPerformance != performance.end()) {
+            cost.macsPerUs = itPerformance->second;
+        }
+        _costs.push_back(cost);
+        auto itCap = memoryCaps.find(device);
+        _memoryCaps.push_back(itCap != memoryCaps.end() ? itCap->second : 0);
+    }
+}
+
+std::unordered_map<std::string, std::string> CostBasedPartitioner::Partition(
+    const std::shared_ptr<const ngraph::Function>& function,
+    const std::map<std::string, std::unordered_set<std::string>>& supportedLayers) const {
+    auto problem = BuildProblem(function, supportedLayers, _devices, _costs);
+    const auto& nodes = problem.nodes;
+    const auto& weightsBytes = problem.weightsBytes;
+
+    // the first device supporting the node, as the first fit assignment does
+    std::vector<size_t> initialLabels(nodes.size());
+    for (size_t node = 0; node < nodes.size(); ++node) {
+        const auto& costs = problem.nodeCosts[node];
+        initialLabels[node] =
+            std::distance(costs.begin(), std::find_if(costs.begin(), costs.end(), [](double cost) {
+                              return cost < infiniteCost;
+                          }));
+    }
+
+    // the weights over the memory caps are penalized by the increasing cost till they fit
+    std::vector<double> memoryPenalties(_devices.size(), 0.);
+    const auto nodeCosts = problem.nodeCosts;
+    std::vector<size_t> labels;
+    for (int penaltyStep = 0;; ++penaltyStep) {
+        for (size_t node = 0; node < nodes.size(); ++node) {
+            for (size_t device = 0; device < _devices.size(); ++device) {
+                problem.nodeCosts[node][device] =
+                    nodeCosts[node][device] + memoryPenalties[device] * weightsBytes[node];
+            }
+        }
+        labels = initialLabels;
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (size_t device = 0; device < _devices.size(); ++device) {
+                changed = problem.Expand(labels, device) || changed;
+            }
+        }
+
+        std::vector<uint64_t> deviceWeights(_devices.size(), 0);
+        for (size_t node = 0; node < nodes.size(); ++node) {
+            deviceWeights[labels[node]] += weightsBytes[node];
+        }
+        bool fits = true;
+        for (size_t device = 0; device < _devices.size(); ++device) {
+            if (_memoryCaps[device] && deviceWeights[device] > _memoryCaps[device]) {
+                fits = false;
+                memoryPenalties[device] = memoryPenalties[device] ? memoryPenalties[device] * memoryPenaltyStep
+                                                                  : initialMemoryPenaltyUsPerByte;
+            }
+        }
+        if (fits) {
+            break;
+        }
+        if (penaltyStep == maxMemoryPenaltySteps) {
+            IE_THROW() << "The weights of the network don't fit the memory caps of the HETERO devices";
+        }
+    }
+
+    std::unordered_map<std::string, std::string> affinities;
+    for (size_t node = 0; node < nodes.size(); ++node) {
+        affinities.emplace(nodes[node]->get_friendly_name(), _devices[labels[node]]);
+    }
+    return affinities;
+}
+
+std::unordered_map<std::string, std::string> CostBasedPartitioner::PartitionPipeline(
+    const std::shared_ptr<const ngraph::Function>& function,
+    const std::map<std::string, std::unordered_set<std::string>>& supportedLayers) const {
+    auto problem = BuildProblem(function, supportedLayers, _devices, _costs);
+    const auto numNodes = problem.nodes.size();
+    const auto numDevices = _devices.size();
+
+    // the cost of the transfers of the tensors crossing the cut before the node
+    std::vector<double> cutCosts(numNodes + 1, 0.);
+    for (auto&& transfer : problem.transfers) {
+        cutCosts[transfer.from + 1] += transfer.cost;
+        cutCosts[transfer.to + 1] -= transfer.cost;
+    }
+    for (size_t node = 1; node <= numNodes; ++node) {
+        cutCosts[node] += cutCosts[node - 1];
+    }
+
+    // the stages are compared by the slowest stage, which limits the throughput of the pipeline, then by the latency
+    using StagesCost = std::pair<double, double>;
+    const StagesCost infeasible{infiniteCost, infiniteCost};
+    // best[device][node] is the cost of the first nodes executed by the first devices, the devices may be skipped
+    std::vector<std::vector<StagesCost>> best(numDevices + 1, std::vector<StagesCost>(numNodes + 1, infeasible));
+    std::vector<std::vector<size_t>> stageBegins(numDevices + 1, std::vector<size_t>(numNodes + 1, 0));
+    best[0][0] = {0., 0.};
+    for (size_t device = 1; device <= numDevices; ++device) {
+        for (size_t end = 0; end <= numNodes; ++end) {
+            // the device is skipped
+            best[device][end] = best[device - 1][end];
+            stageBegins[device][end] = end;
+            double stageCost = 0;
+            uint64_t stageWeights = 0;
+            for (size_t begin = end; begin-- > 0;) {
+                const auto nodeCost = problem.nodeCosts[begin][device - 1];
+                stageWeights += problem.weightsBytes[begin];
+                if (nodeCost >= infiniteCost || (_memoryCaps[device - 1] && stageWeights > _memoryCaps[device - 1])) {
+                    break;
+                }
+                stageCost += nodeCost;
+                const auto& previous = best[device - 1][begin];
+                if (previous.first >= infiniteCost) {
+                    continue;
+                }
+                const auto stageTime = stageCost + (begin ? cutCosts[begin] : 0.);
+                const StagesCost cost{std::max(previous.first, stageTime), previous.second + stageTime};
+                if (cost < best[device][end]) {
+                    best[device][end] = cost;
+                    stageBegins[device][end] = begin;
+                }
+            }
+        }
+    }
+    if (best[numDevices][numNodes].first >= infiniteCost) {
+        IE_THROW() << "The network can't be split to the pipeline stages by the HETERO devices, the layers ranges "
+                      "aren't supported by the devices or don't fit their memory caps";
+    }
+
+    std::unordered_map<std::string, std::string> affinities;
+    for (size_t device = numDevices, end = numNodes; device > 0; --device) {
+        const auto begin = stageBegins[device][end];
+        for (size_t node = begin; node < end; ++node) {
+            affinities.emplace(problem.nodes[node]->get_friendly_name(), _devices[device - 1]);
+        }
+        end = begin;
+    }
+    return affinities;
+}
+
+template <typename T>
+std::map<std::string, T> CostBasedPartitioner::ParseDevicesValues(const std::string& value) {
+    std::map<std::string, T> values;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        auto separator = item.rfind(':');
+        if (separator == std::string::npos) {
+            IE_THROW() << "Wrong value " << value << ", expected <device>:<value> list";
+        }
+        std::stringstream number(item.substr(separator + 1));
+        T parsed{};
+        if (!(number >> parsed) || parsed <= 0) {
+            IE_THROW() << "Wrong value " << value << ", expected <device>:<value> list";
+        }
+        values[item.substr(0, separator)] = parsed;
+    }
+    return values;
+}
+
+template std::map<std::string, double> CostBasedPartitioner::ParseDevicesValues<double>(const std::string&);
+template std::map<std::string, uint64_t> CostBasedPartitioner::ParseDevicesValues<uint64_t>(const std::string&);
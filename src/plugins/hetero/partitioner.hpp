@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <ngraph/function.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Assigns the operations of a network to the devices minimizing the estimated latency of the network: the sum of
+ * the estimated execution times of the operations on their devices and of the transfers of the tensors between
+ * the devices. The operations weights assigned to a device may be limited, so the rest go to the other devices
+ */
+class CostBasedPartitioner {
+public:
+    struct DeviceCost {
+        double macsPerUs;     // the compute throughput of the device, multiply-accumulate operations per microsecond
+        double opOverheadUs;  // the cost of the execution of one operation
+    };
+
+    /**
+     * @param devices The devices in the priority order, the equally good assignments prefer the first ones
+     * @param performance The compute throughput per device (MACs per microsecond), the default is by the device type
+     * @param memoryCaps The limit of the weights bytes per device, no limit for the devices not listed
+     */
+    CostBasedPartitioner(const std::vector<std::string>& devices,
+                         const std::map<std::string, double>& performance,
+                         const std::map<std::string, uint64_t>& memoryCaps);
+
+    /**
+     * @brief Returns the devices of the operations, but the constants, the parameters and the results
+     * @param supportedLayers The operations supported by every device
+     */
+    std::unordered_map<std::string, std::string> Partition(
+        const std::shared_ptr<const ngraph::Function>& function,
+        const std::map<std::string, std::unordered_set<std::string>>& supportedLayers) const;
+
+    /**
+     * @brief Splits the operations in the topological order to the ranges executed by the devices in their order (some
+     * of them may be skipped), so the requests are pipelined through the devices. The slowest stage, with the transfer
+     * of its inputs, is minimized as it limits the throughput, the weights of a stage fit the memory cap of its device
+     * @param supportedLayers The operations supported by every device
+     */
+    std::unordered_map<std::string, std::string> PartitionPipeline(
+        const std::shared_ptr<const ngraph::Function>& function,
+        const std::map<std::string, std::unordered_set<std::string>>& supportedLayers) const;
+
+    /**
+     * @brief Parses the "<device>:<value>,<device>:<value>" config values
+     */
+    template <typename T>
+    static std::map<std::string, T> ParseDevicesValues(const std::string& value);
+
+private:
+    std::vector<std::string> _devices;
+    std::vector<DeviceCost> _costs;
+    std::vector<uint64_t> _memoryCaps;  // zero means no limit
+};
+
+}  // namespace HeteroPlugin
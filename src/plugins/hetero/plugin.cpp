@@ -40,7 +40,14 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
                                                                   "TARGET_FALLBACK",
-                                                                  CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
+                                                                  CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_PIPELINE_STAGE_REQUESTS),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_COST_BASED_PARTITIONING),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_PIPELINE_PARTITIONING),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_DEVICES_PERFORMANCE),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_DEVICES_MEMORY_CAP),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_TRANSFER_PRECISION),
+                                                                  CONFIG_KEY_INTERNAL(HETERO_TRANSFER_LAYERS)};
 
     return supported_configKeys;
 }
@@ -123,6 +130,27 @@ void Engine::SetConfig(const Configs& configs) {
     }
 }
 
+std::map<std::string, QueryNetworkResult> Engine::QueryNetworkByDevice(const CNNNetwork& network,
+                                                                       const Configs& config) const {
+    auto it = config.find("TARGET_FALLBACK");
+    if (it == config.end()) {
+        IE_THROW() << "The 'TARGET_FALLBACK' option was not defined for heterogeneous device";
+    }
+    DeviceMetaInformationMap metaDevices = GetDevicePlugins(it->second, config);
+
+    auto function = network.getFunction();
+    if (function == nullptr) {
+        IE_THROW() << "HETERO device supports just ngraph network representation";
+    }
+
+    std::map<std::string, QueryNetworkResult> queryResults;
+    for (auto&& metaDevice : metaDevices) {
+        auto& deviceName = metaDevice.first;
+        queryResults[deviceName] = GetCore()->QueryNetwork(network, deviceName, metaDevice.second);
+    }
+    return queryResults;
+}
+
 QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs& config) const {
     QueryNetworkResult qr;
 
@@ -137,18 +165,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
     }
 
     std::string fallbackDevicesStr = it->second;
-    DeviceMetaInformationMap metaDevices = GetDevicePlugins(fallbackDevicesStr, tconfig);
-
-    auto function = network.getFunction();
-    if (function == nullptr) {
-        IE_THROW() << "HETERO device supports just ngraph network representation";
-    }
-
-    std::map<std::string, QueryNetworkResult> queryResults;
-    for (auto&& metaDevice : metaDevices) {
-        auto& deviceName = metaDevice.first;
-        queryResults[deviceName] = GetCore()->QueryNetwork(network, deviceName, metaDevice.second);
-    }
+    auto queryResults = QueryNetworkByDevice(network, tconfig);
 
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
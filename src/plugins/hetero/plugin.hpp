@@ -44,6 +44,13 @@ public:
         std::istream& heteroModel,
         const std::map<std::string, std::string>& config) override;
 
+    /**
+     * @brief Queries the network by every fallback device separately, the configuration must have TARGET_FALLBACK
+     */
+    std::map<std::string, InferenceEngine::QueryNetworkResult> QueryNetworkByDevice(
+        const InferenceEngine::CNNNetwork& network,
+        const Configs& config) const;
+
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback, const Configs& localConfig) const;
 
 private:
@@ -6,7 +6,9 @@
 
 #include <memory>
 #include <functional>
+#include <utility>
 #include "lru_cache.h"
+#include "cache_statistics.h"
 
 namespace MKLDNNPlugin {
 
@@ -18,14 +20,15 @@ public:
     };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual CacheStatistics getStatistics() const = 0;
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const KeyType&) and
+ *         CacheStatistics getStatistics() const interface and must have constructor of type ImplType(size_t, Args...).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -38,7 +41,8 @@ public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
 public:
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    template<typename... Args>
+    explicit CacheEntry(size_t capacity, Args&&... args) : _impl(capacity, std::forward<Args>(args)...) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -63,6 +67,10 @@ public:
         return {retVal, retStatus};
     }
 
+    CacheStatistics getStatistics() const override {
+        return _impl.getStatistics();
+    }
+
 public:
     ImplType _impl;
 };
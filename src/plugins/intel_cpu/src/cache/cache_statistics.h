@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Counters of lookups and evictions collected by a cache storage.
+ */
+
+struct CacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) noexcept {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        return *this;
+    }
+};
+
+} // namespace MKLDNNPlugin
@@ -6,6 +6,7 @@
 
 #include <list>
 #include <unordered_map>
+#include "cache_statistics.h"
 
 /**
  * @brief This is yet another implementation of a preemptive cache with LRU eviction policy.
@@ -57,9 +58,11 @@ public:
     Value get(const Key &key) {
         auto itr = _cacheMapper.find(key);
         if (itr == _cacheMapper.end()) {
+            ++_statistics.misses;
             return Value();
         }
 
+        ++_statistics.hits;
         touch(itr->second);
         return _lruList.front().second;
     }
@@ -73,6 +76,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            ++_statistics.evictions;
         }
     }
 
@@ -84,6 +88,14 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the lookup and eviction counters collected since the cache creation
+     * @return the cache statistics
+     */
+    CacheStatistics getStatistics() const noexcept {
+        return _statistics;
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
@@ -101,6 +113,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    CacheStatistics _statistics;
 };
 
 } // namespace MKLDNNPlugin
\ No newline at end of file
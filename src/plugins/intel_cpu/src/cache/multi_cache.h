@@ -7,20 +7,23 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace MKLDNNPlugin {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note This implementation is thread safe, so the same instance may be shared between several streams. In this case
+ *       the number of shards should be close to the number of streams to avoid contention on the records lookup.
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -28,9 +31,15 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param shards is the number of independently locked parts of each entry
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, size_t shards = 1) : _capacity(capacity), _shards(shards) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _shards(other._shards) {
+        std::lock_guard<std::mutex> lock(other._mutex);
+        _storage = other._storage;
+    }
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -48,6 +57,19 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Collects the lookup and eviction counters of all the entries
+    * @return the cache statistics
+    */
+    CacheStatistics getStatistics() const {
+        CacheStatistics result;
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& item : _storage) {
+            result += item.second->getStatistics();
+        }
+        return result;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -57,6 +79,8 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _shards;
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -70,9 +94,10 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _shards)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
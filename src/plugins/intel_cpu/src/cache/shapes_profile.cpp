@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shapes_profile.h"
+
+#include <functional>
+#include <sstream>
+#include <file_utils.h>
+#include <ie_common.h>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+const char profileHeader[] = "CPU_SHAPES_PROFILE 1";
+
+template <typename T>
+void hash_combine(size_t& seed, const T& v) {
+    seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+}  // namespace
+
+void ShapesProfile::add(const InputShapes& shapes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_shapes.size() < _capacity) {
+        _shapes.insert(shapes);
+    }
+}
+
+std::vector<ShapesProfile::InputShapes> ShapesProfile::get() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {_shapes.begin(), _shapes.end()};
+}
+
+bool ShapesProfile::empty() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _shapes.empty();
+}
+
+// The format is line based:
+//   CPU_SHAPES_PROFILE <version>
+//   <number of inputs>
+//   <rank> <dim_0> ... <dim_rank-1> <input name till the end of the line>
+//   ...
+void ShapesProfile::save(std::ostream& stream) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    stream << profileHeader << '\n';
+    for (const auto& shapes : _shapes) {
+        stream << shapes.size() << '\n';
+        for (const auto& input : shapes) {
+            stream << input.second.size();
+            for (const auto dim : input.second) {
+                stream << ' ' << dim;
+            }
+            stream << ' ' << input.first << '\n';
+        }
+    }
+}
+
+void ShapesProfile::load(std::istream& stream) {
+    std::string line;
+    if (!std::getline(stream, line) || line != profileHeader) {
+        IE_THROW() << "Unsupported CPU shapes profile format";
+    }
+
+    std::set<InputShapes> loaded;
+    while (std::getline(stream, line) && !line.empty()) {
+        const size_t inputsNum = std::stoul(line);
+        InputShapes shapes;
+        for (size_t i = 0; i < inputsNum; ++i) {
+            if (!std::getline(stream, line)) {
+                IE_THROW() << "CPU shapes profile is truncated";
+            }
+            std::istringstream record(line);
+            size_t rank = 0;
+            record >> rank;
+            VectorDims dims(rank);
+            for (auto& dim : dims) {
+                record >> dim;
+            }
+            record.get();  // skip the separator
+            std::string name;
+            std::getline(record, name);
+            if (record.fail() || name.empty()) {
+                IE_THROW() << "CPU shapes profile record is invalid";
+            }
+            shapes[name] = dims;
+        }
+        loaded.insert(std::move(shapes));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& shapes : loaded) {
+        if (_shapes.size() >= _capacity)
+            break;
+        _shapes.insert(shapes);
+    }
+}
+
+std::string ShapesProfile::computeKey(const std::shared_ptr<const ngraph::Function>& function) {
+    size_t seed = 0;
+    for (const auto& op : function->get_ordered_ops()) {
+        hash_combine(seed, std::string(op->get_type_name()));
+        hash_combine(seed, op->get_friendly_name());
+        for (const auto& output : op->outputs()) {
+            std::ostringstream shape;
+            shape << output.get_partial_shape();
+            hash_combine(seed, shape.str());
+        }
+    }
+    std::ostringstream key;
+    key << std::hex << seed;
+    return key.str();
+}
+
+std::string ShapesProfile::getFilePath(const std::string& cacheDir, const std::string& key) {
+    return FileUtils::makePath(cacheDir, key + ".cpu_shapes");
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include <ngraph/function.hpp>
+#include "cpu_shape.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Class collects the sets of input shapes the dynamic executable network was inferred with. The profile may be stored on disk
+ *        and loaded by the next instance of the same network to create the shape specific executors in advance (warm start).
+ *
+ * @note The class is thread safe.
+ */
+
+class ShapesProfile {
+public:
+    using InputShapes = std::map<std::string, VectorDims>;
+
+public:
+    /**
+     * @param capacity is the maximum number of the stored input shapes sets
+     */
+    explicit ShapesProfile(size_t capacity) : _capacity(capacity) {}
+
+    /**
+     * @brief Adds the set of input shapes to the profile if it is not full
+     * @param shapes are the network input shapes
+     */
+    void add(const InputShapes& shapes);
+
+    /**
+     * @brief Returns all the collected sets of input shapes
+     */
+    std::vector<InputShapes> get() const;
+
+    bool empty() const;
+
+    void save(std::ostream& stream) const;
+    void load(std::istream& stream);
+
+    /**
+     * @brief Computes the key which identifies the network in the profiles storage
+     * @param function is the network function
+     * @return string key
+     */
+    static std::string computeKey(const std::shared_ptr<const ngraph::Function>& function);
+
+    static std::string getFilePath(const std::string& cacheDir, const std::string& key);
+
+private:
+    size_t _capacity;
+    mutable std::mutex _mutex;
+    std::set<InputShapes> _shapes;
+};
+
+using ShapesProfilePtr = std::shared_ptr<ShapesProfile>;
+
+} // namespace MKLDNNPlugin
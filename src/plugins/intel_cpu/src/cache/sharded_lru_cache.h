@@ -0,0 +1,252 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "cache_statistics.h"
+
+/**
+ * @brief This is a thread safe implementation of a preemptive cache with LRU eviction policy.
+ * The records are distributed between independent shards by the key hash, each shard is protected by its own mutex,
+ * so concurrent lookups of different keys rarely contend. The LRU list of each shard is an intrusive list built on top
+ * of the preallocated pool of records, thus insertions and evictions do not allocate list nodes.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The LRU policy is applied per shard, so the record evicted on insertion is the least recently used one in its shard.
+ */
+
+namespace MKLDNNPlugin {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    using value_type = std::pair<Key, Value>;
+
+public:
+    /**
+     * @param capacity is the maximum number of records in the cache, it is evenly distributed between the shards
+     * @param shardsNum is the number of independently locked shards
+     */
+    explicit ShardedLruCache(size_t capacity, size_t shardsNum = 1) : _capacity(capacity) {
+        if (0 == _capacity) {
+            return;
+        }
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, _capacity));
+        const size_t shardCapacity = (_capacity + shardsNum - 1) / shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(Key key, Value val) {
+        if (0 == _capacity) {
+            return;
+        }
+        getShard(key).put(std::move(key), std::move(val));
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        if (0 == _capacity) {
+            _misses.fetch_add(1, std::memory_order_relaxed);
+            return Value();
+        }
+        Value result = Value();
+        if (getShard(key).get(key, result)) {
+            _hits.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _misses.fetch_add(1, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from each shard
+     * @param n number of records to be evicted per shard, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            shard->evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the lookup and eviction counters collected since the cache creation
+     * @return the cache statistics
+     */
+    CacheStatistics getStatistics() const {
+        CacheStatistics result;
+        result.hits = _hits.load(std::memory_order_relaxed);
+        result.misses = _misses.load(std::memory_order_relaxed);
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result.evictions += shard->evictions;
+        }
+        return result;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const Key &k) const {
+            return k.hash();
+        }
+    };
+
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    struct Record {
+        value_type data;
+        size_t prev = npos;
+        size_t next = npos;
+    };
+
+    struct Shard {
+        explicit Shard(size_t capacity) : capacity(capacity) {
+            pool.reserve(capacity);
+            mapper.reserve(capacity);
+        }
+
+        void put(Key key, Value val) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto mapItr = mapper.find(key);
+            if (mapItr != mapper.end()) {
+                touch(mapItr->second);
+                pool[mapItr->second].data.second = std::move(val);
+                return;
+            }
+
+            size_t idx = npos;
+            if (!freeList.empty()) {
+                idx = freeList.back();
+                freeList.pop_back();
+            } else if (pool.size() < capacity) {
+                idx = pool.size();
+                pool.emplace_back();
+            } else {
+                // reuse the least recently used record
+                idx = tail;
+                mapper.erase(pool[idx].data.first);
+                unlink(idx);
+                ++evictions;
+            }
+            pool[idx].data = {key, std::move(val)};
+            pushFront(idx);
+            mapper.insert({std::move(key), idx});
+        }
+
+        bool get(const Key& key, Value& val) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto itr = mapper.find(key);
+            if (itr == mapper.end()) {
+                return false;
+            }
+            touch(itr->second);
+            val = pool[itr->second].data.second;
+            return true;
+        }
+
+        void evict(size_t n) {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < n && tail != npos; ++i) {
+                const size_t idx = tail;
+                mapper.erase(pool[idx].data.first);
+                unlink(idx);
+                // release the stored objects right away
+                pool[idx].data = value_type();
+                freeList.push_back(idx);
+                ++evictions;
+            }
+        }
+
+        void unlink(size_t idx) {
+            auto& record = pool[idx];
+            if (record.prev != npos) {
+                pool[record.prev].next = record.next;
+            } else {
+                head = record.next;
+            }
+            if (record.next != npos) {
+                pool[record.next].prev = record.prev;
+            } else {
+                tail = record.prev;
+            }
+            record.prev = record.next = npos;
+        }
+
+        void pushFront(size_t idx) {
+            auto& record = pool[idx];
+            record.prev = npos;
+            record.next = head;
+            if (head != npos) {
+                pool[head].prev = idx;
+            }
+            head = idx;
+            if (tail == npos) {
+                tail = idx;
+            }
+        }
+
+        void touch(size_t idx) {
+            if (idx != head) {
+                unlink(idx);
+                pushFront(idx);
+            }
+        }
+
+        std::mutex mutex;
+        std::vector<Record> pool;
+        std::vector<size_t> freeList;
+        std::unordered_map<Key, size_t, key_hasher> mapper;
+        size_t head = npos;
+        size_t tail = npos;
+        size_t capacity;
+        size_t evictions = 0;
+    };
+
+    Shard& getShard(const Key& key) {
+        if (1 == _shards.size()) {
+            return *_shards.front();
+        }
+        // mix the hash bits, as the low bits are also used by the shard's own hash map
+        const auto hash = static_cast<uint64_t>(key.hash()) * 0x9E3779B97F4A7C15ull;
+        return *_shards[(hash >> 32) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::atomic<size_t> _hits{0};
+    std::atomic<size_t> _misses{0};
+    size_t _capacity;
+};
+
+} // namespace MKLDNNPlugin
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
@@ -128,6 +129,208 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED == key) {
+            if (val == PluginConfigParams::YES) rtCacheShared = true;
+            else if (val == PluginConfigParams::NO) rtCacheShared = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES == key) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION == key) {
+            if (val == PluginConfigParams::YES) globalLayoutSelection = true;
+            else if (val == PluginConfigParams::NO) globalLayoutSelection = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION == key) {
+            if (val == PluginConfigParams::YES) weightsDecompression = true;
+            else if (val == PluginConfigParams::NO) weightsDecompression = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_ATTENTION_FUSION == key) {
+            if (val == PluginConfigParams::YES) attentionFusion = true;
+            else if (val == PluginConfigParams::NO) attentionFusion = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_ATTENTION_FUSION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY == key) {
+            float val_f = -1.0f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+            }
+            if (val_f < 0.0f || val_f > 1.0f)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY
+                           << ". Expected only floating point numbers in the range [0, 1]";
+            sparseWeightsDensity = val_f;
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_QUANTIZATION == key) {
+            if (val == PluginConfigParams::YES) dynamicQuantization = true;
+            else if (val == PluginConfigParams::NO) dynamicQuantization = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_QUANTIZATION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_BF16_MIXED_PRECISION == key) {
+            if (val == PluginConfigParams::YES) bf16MixedPrecision = true;
+            else if (val == PluginConfigParams::NO) bf16MixedPrecision = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_BF16_MIXED_PRECISION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_FP32_NODES == key) {
+            std::set<std::string> nodes;
+            std::stringstream stream(val);
+            std::string node;
+            while (std::getline(stream, node, ',')) {
+                if (!node.empty())
+                    nodes.insert(node);
+            }
+            fp32Nodes = std::move(nodes);
+        } else if (PluginConfigInternalParams::KEY_CPU_CONSTANTS_PREPARATION == key) {
+            if (val == PluginConfigInternalParams::CPU_CONSTANTS_ON_COMPILE) constantsPreparation = ConstantsPreparation::OnCompile;
+            else if (val == PluginConfigInternalParams::CPU_CONSTANTS_ON_FIRST_INFERENCE) constantsPreparation = ConstantsPreparation::OnFirstInference;
+            else if (val == PluginConfigInternalParams::CPU_CONSTANTS_IN_BACKGROUND) constantsPreparation = ConstantsPreparation::InBackground;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_CONSTANTS_PREPARATION
+                           << ". Expected only "
+                           << PluginConfigInternalParams::CPU_CONSTANTS_ON_COMPILE << "/" << PluginConfigInternalParams::CPU_CONSTANTS_ON_FIRST_INFERENCE
+                           << "/" << PluginConfigInternalParams::CPU_CONSTANTS_IN_BACKGROUND;
+        } else if (PluginConfigInternalParams::KEY_CPU_BATCH_BUCKETS == key) {
+            std::vector<size_t> buckets;
+            std::stringstream stream(val);
+            std::string bucket;
+            while (std::getline(stream, bucket, ',')) {
+                long long val_i = -1;
+                try {
+                    val_i = std::stoll(bucket);
+                } catch (const std::exception&) {
+                }
+                if (val_i <= 0)
+                    IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_BATCH_BUCKETS
+                               << ". Expected only comma separated positive integer numbers";
+                buckets.push_back(static_cast<size_t>(val_i));
+            }
+            std::sort(buckets.begin(), buckets.end());
+            buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+            batchBuckets = std::move(buckets);
+        } else if (PluginConfigInternalParams::KEY_CPU_SHAPES_WARM_START == key) {
+            if (val == PluginConfigParams::YES) shapesWarmStart = true;
+            else if (val == PluginConfigParams::NO) shapesWarmStart = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHAPES_WARM_START
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_WORKSPACE_POOL_CAPACITY == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WORKSPACE_POOL_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means no limit
+            workspacePoolCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION == key) {
+            if (val == PluginConfigInternalParams::CPU_WEIGHTS_REPLICATE_ALL) weightsReplication = WeightsReplication::All;
+            else if (val == PluginConfigInternalParams::CPU_WEIGHTS_REPLICATE_BY_SIZE) weightsReplication = WeightsReplication::BySize;
+            else if (val == PluginConfigInternalParams::CPU_WEIGHTS_REPLICATE_NONE) weightsReplication = WeightsReplication::None;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION
+                           << ". Expected only "
+                           << PluginConfigInternalParams::CPU_WEIGHTS_REPLICATE_ALL << "/" << PluginConfigInternalParams::CPU_WEIGHTS_REPLICATE_BY_SIZE
+                           << "/" << PluginConfigInternalParams::CPU_WEIGHTS_REPLICATE_NONE;
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION_THRESHOLD == key) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION_THRESHOLD
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated as zero
+            weightsReplicationThreshold = static_cast<size_t>(std::max(val_i, 0ll));
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_SHARING_BY_CONTENT == key) {
+            if (val == PluginConfigParams::YES) weightsSharingByContent = true;
+            else if (val == PluginConfigParams::NO) weightsSharingByContent = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_SHARING_BY_CONTENT
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_STREAMS == key) {
+            if (val == PluginConfigParams::YES) sharedStreams = true;
+            else if (val == PluginConfigParams::NO) sharedStreams = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_STREAMS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_NETWORK_PRIORITY == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_NETWORK_PRIORITY
+                           << ". Expected only non-negative integer numbers";
+            networkPriority = static_cast<unsigned int>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_NETWORK_WEIGHT == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 1)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_NETWORK_WEIGHT
+                           << ". Expected only positive integer numbers";
+            networkWeight = static_cast<unsigned int>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_HINTS_TUNING_TIME_LIMIT == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HINTS_TUNING_TIME_LIMIT
+                           << ". Expected only non-negative integer numbers";
+            hintsTuningTimeLimit = static_cast<unsigned int>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_CALLBACK_THREADS == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_CALLBACK_THREADS
+                           << ". Expected only non-negative integer numbers";
+            callbackThreads = static_cast<unsigned int>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_CALLBACK_THREADS_OFFSET == key) {
+            int val_i = -2;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < -1)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_CALLBACK_THREADS_OFFSET
+                           << ". Expected only integer numbers not less than -1";
+            callbackThreadsOffset = val_i;
+        } else if (PluginConfigInternalParams::KEY_CPU_INPUTS_PREPARATION_THREADS == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INPUTS_PREPARATION_THREADS
+                           << ". Expected only non-negative integer numbers";
+            inputsPreparationThreads = static_cast<unsigned int>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_LATENCY_DETERMINISTIC == key) {
+            if (val == PluginConfigParams::YES) latencyDeterministic = true;
+            else if (val == PluginConfigParams::NO) latencyDeterministic = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LATENCY_DETERMINISTIC
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -136,6 +339,22 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
     if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
         streamExecutorConfig._streams = 1;
 
+    if (latencyDeterministic) {
+        // nothing is left to the first inference, and the streams neither migrate between the cores nor sleep
+        constantsPreparation = ConstantsPreparation::OnCompile;
+        // the executors of the dynamic shapes networks are created in advance for the shapes seen before
+        if (!prop.count(PluginConfigInternalParams::KEY_CPU_SHAPES_WARM_START))
+            shapesWarmStart = true;
+    #if !(defined(__APPLE__) || defined(_WIN32))
+        if (!prop.count(PluginConfigParams::KEY_CPU_BIND_THREAD) &&
+            streamExecutorConfig._threadBindingType == IStreamsExecutor::NONE)
+            streamExecutorConfig._threadBindingType = IStreamsExecutor::CORES;
+    #endif
+        constexpr int deterministicSpinWaitUs = 10000;
+        if (!prop.count(PluginConfigInternalParams::KEY_CPU_STREAMS_SPIN_WAIT_US) && streamExecutorConfig._spinWaitUs == 0)
+            streamExecutorConfig._spinWaitUs = deterministicSpinWaitUs;
+    }
+
     updateProperties();
 }
 void Config::updateProperties() {
@@ -10,6 +10,8 @@
 
 #include <string>
 #include <map>
+#include <set>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -21,12 +23,48 @@ struct Config {
         On,
     };
 
+    enum WeightsReplication {
+        All,
+        BySize,
+        None,
+    };
+
+    enum ConstantsPreparation {
+        OnCompile,
+        OnFirstInference,
+        InBackground,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 100ul;
+    bool rtCacheShared = false;
+    bool shapesWarmStart = false;
+    size_t workspacePoolCapacity = 0ul;
+    bool parallelBranches = false;
+    bool globalLayoutSelection = false;
+    bool weightsDecompression = false;
+    bool attentionFusion = false;
+    float sparseWeightsDensity = 0.0f;
+    bool dynamicQuantization = false;
+    bool bf16MixedPrecision = false;
+    std::set<std::string> fp32Nodes;
+    ConstantsPreparation constantsPreparation = ConstantsPreparation::OnCompile;
+    std::vector<size_t> batchBuckets;
+    WeightsReplication weightsReplication = WeightsReplication::All;
+    size_t weightsReplicationThreshold = 1ul << 20;
+    bool weightsSharingByContent = false;
+    bool sharedStreams = false;
+    unsigned int networkPriority = 0;
+    unsigned int networkWeight = 1;
+    unsigned int callbackThreads = 0;
+    int callbackThreadsOffset = -1;
+    unsigned int inputsPreparationThreads = 0;
+    unsigned int hintsTuningTimeLimit = 0;
+    bool latencyDeterministic = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_remote_context.h"
+#include "utils/numa_memory.h"
+
+#include <blob_factory.hpp>
+#include <cpu/cpu_params.hpp>
+#include <ie_system_conf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t bufferAlignment = 64;
+
+std::shared_ptr<void> allocateBuffer(const ov::runtime::Allocator& allocator, int numaNodeId, size_t size) {
+    // the user allocator may not support the alignment, so the buffer is aligned inside the allocation
+    auto bufferAllocator = allocator;
+    void* allocation = bufferAllocator.allocate(size + bufferAlignment - 1);
+    if (allocation == nullptr)
+        IE_THROW() << "Cannot allocate " << size << " bytes from the CPU context";
+    const auto address = (reinterpret_cast<uintptr_t>(allocation) + bufferAlignment - 1) & ~(bufferAlignment - 1);
+    void* data = reinterpret_cast<void*>(address);
+    if (numaNodeId >= 0)
+        bindToNumaNode(data, size, numaNodeId);
+    return std::shared_ptr<void>(data, [bufferAllocator, allocation](void*) mutable {
+        bufferAllocator.deallocate(allocation);
+    });
+}
+
+class CPUContextBlobAllocator : public IAllocator {
+public:
+    CPUContextBlobAllocator(const ov::runtime::Allocator& allocator, int numaNodeId)
+        : allocator(allocator), numaNodeId(numaNodeId) {}
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        try {
+            auto buffer = allocateBuffer(allocator, numaNodeId, size);
+            std::lock_guard<std::mutex> lock{guard};
+            buffers.emplace(buffer.get(), buffer);
+            return buffer.get();
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    bool free(void* handle) noexcept override {
+        // the buffer is released outside of the lock
+        std::shared_ptr<void> buffer;
+        {
+            std::lock_guard<std::mutex> lock{guard};
+            auto it = buffers.find(handle);
+            if (it == buffers.end())
+                return false;
+            buffer = std::move(it->second);
+            buffers.erase(it);
+        }
+        return true;
+    }
+
+private:
+    ov::runtime::Allocator allocator;
+    int numaNodeId;
+    std::mutex guard;
+    std::unordered_map<void*, std::shared_ptr<void>> buffers;
+};
+
+class CPURemoteBlob : public RemoteBlob {
+public:
+    CPURemoteBlob(const TensorDesc& tensorDesc, const CPURemoteContext::Ptr& context)
+        : RemoteBlob(tensorDesc), context(context), allocator(context->getBlobAllocator()) {}
+
+    ~CPURemoteBlob() override {
+        deallocate();
+    }
+
+    size_t element_size() const noexcept override {
+        return getTensorDesc().getPrecision().size();
+    }
+
+    void allocate() noexcept override {
+        if (handle == nullptr)
+            handle = allocator->alloc(byteSize());
+    }
+
+    bool deallocate() noexcept override {
+        if (handle == nullptr)
+            return false;
+        const bool released = allocator->free(handle);
+        handle = nullptr;
+        return released;
+    }
+
+    LockedMemory<void> buffer() noexcept override {
+        return LockedMemory<void>(allocator.get(), handle, 0);
+    }
+
+    LockedMemory<const void> cbuffer() const noexcept override {
+        return LockedMemory<const void>(allocator.get(), handle, 0);
+    }
+
+    LockedMemory<void> rwmap() noexcept override {
+        return buffer();
+    }
+
+    LockedMemory<const void> rmap() const noexcept override {
+        return cbuffer();
+    }
+
+    LockedMemory<void> wmap() noexcept override {
+        return buffer();
+    }
+
+    ParamMap getParams() const override {
+        return {};
+    }
+
+    std::string getDeviceName() const noexcept override {
+        return context->getDeviceName();
+    }
+
+    std::shared_ptr<RemoteContext> getContext() const noexcept override {
+        return context;
+    }
+
+protected:
+    const std::shared_ptr<IAllocator>& getAllocator() const noexcept override {
+        return allocator;
+    }
+
+    void* getHandle() const noexcept override {
+        return handle;
+    }
+
+private:
+    CPURemoteContext::Ptr context;
+    std::shared_ptr<IAllocator> allocator;
+    void* handle = nullptr;
+};
+
+}  // namespace
+
+CPURemoteContext::CPURemoteContext(const ParamMap& params) {
+    for (const auto& param : params) {
+        if (param.first == CPU_PARAM_KEY(ALLOCATOR)) {
+            if (!param.second.is<ov::runtime::Allocator>())
+                IE_THROW() << "The " << param.first << " parameter of the CPU context should be ov::runtime::Allocator";
+            allocator = param.second.as<ov::runtime::Allocator>();
+        } else if (param.first == CPU_PARAM_KEY(NUMA_NODE_ID)) {
+            if (!param.second.is<int>())
+                IE_THROW() << "The " << param.first << " parameter of the CPU context should be int";
+            numaNodeId = param.second.as<int>();
+            const auto numaNodes = getAvailableNUMANodes();
+            if (numaNodeId != -1 && std::find(numaNodes.begin(), numaNodes.end(), numaNodeId) == numaNodes.end())
+                IE_THROW() << "The CPU context NUMA node " << numaNodeId << " is not available";
+        } else {
+            IE_THROW(NotFound) << "Unsupported parameter of the CPU context: " << param.first;
+        }
+    }
+    blobAllocator = std::make_shared<CPUContextBlobAllocator>(allocator, numaNodeId);
+}
+
+RemoteBlob::Ptr CPURemoteContext::CreateBlob(const TensorDesc& tensorDesc, const ParamMap& params) {
+    if (!params.empty())
+        IE_THROW(NotImplemented) << "The CPU context blobs don't have parameters";
+    return std::make_shared<CPURemoteBlob>(tensorDesc, std::static_pointer_cast<CPURemoteContext>(shared_from_this()));
+}
+
+MemoryBlob::Ptr CPURemoteContext::CreateHostBlob(const TensorDesc& tensorDesc) {
+    auto blob = std::dynamic_pointer_cast<MemoryBlob>(make_blob_with_precision(tensorDesc, blobAllocator));
+    if (!blob)
+        IE_THROW(NotAllocated) << "Failed to create host blob in remote context for " << getDeviceName() << " device";
+    return blob;
+}
+
+ParamMap CPURemoteContext::getParams() const {
+    return {{CPU_PARAM_KEY(ALLOCATOR), allocator}, {CPU_PARAM_KEY(NUMA_NODE_ID), numaNodeId}};
+}
+
+std::shared_ptr<void> CPURemoteContext::allocate(size_t size) const {
+    return allocateBuffer(allocator, numaNodeId, size);
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+#include <ie_remote_context.hpp>
+#include <openvino/runtime/allocator.hpp>
+
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * The memory context of the CPU plugin: the input, output and intermediate tensors of the networks compiled with the
+ * context are allocated from the user allocator and bound to the NUMA node of the context
+ * (see InferenceEngine::CPUContextParams).
+ *
+ * Is a thread safe
+ */
+class CPURemoteContext : public InferenceEngine::RemoteContext {
+public:
+    typedef std::shared_ptr<CPURemoteContext> Ptr;
+
+    explicit CPURemoteContext(const InferenceEngine::ParamMap& params);
+
+    std::string getDeviceName() const noexcept override {
+        return "CPU";
+    }
+
+    InferenceEngine::RemoteBlob::Ptr CreateBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                                                const InferenceEngine::ParamMap& params = {}) override;
+
+    InferenceEngine::MemoryBlob::Ptr CreateHostBlob(const InferenceEngine::TensorDesc& tensorDesc) override;
+
+    InferenceEngine::ParamMap getParams() const override;
+
+    /**
+     * @brief Allocates the 64 bytes aligned buffer from the context memory
+     * @param size the size of the buffer in bytes
+     * @return the buffer, which is released with the last copy of the pointer
+     */
+    std::shared_ptr<void> allocate(size_t size) const;
+
+    /**
+     * @brief The allocator of the blobs allocated from the context memory
+     */
+    const std::shared_ptr<InferenceEngine::IAllocator>& getBlobAllocator() const noexcept {
+        return blobAllocator;
+    }
+
+    int getNumaNodeId() const noexcept {
+        return numaNodeId;
+    }
+
+private:
+    ov::runtime::Allocator allocator;
+    int numaNodeId = -1;
+    std::shared_ptr<InferenceEngine::IAllocator> blobAllocator;
+};
+
+}  // namespace MKLDNNPlugin
@@ -185,7 +185,8 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "MatrixNms", MatrixNms},
         { "MulticlassNms", MulticlassNms},
         { "Reference", Reference},
-        { "Subgraph", Subgraph}
+        { "Subgraph", Subgraph},
+        { "Attention", Attention}
 };
 
 Type TypeFromName(const std::string& type) {
@@ -371,6 +372,8 @@ std::string NameFromType(const Type type) {
             return "Reference";
         case Subgraph:
             return "Subgraph";
+        case Attention:
+            return "Attention";
         default:
             return "Unknown";
     }
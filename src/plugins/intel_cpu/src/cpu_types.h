@@ -101,7 +101,8 @@ enum Type {
     NonMaxSuppression,
     MatrixNms,
     MulticlassNms,
-    Subgraph
+    Subgraph,
+    Attention
 };
 
 enum Algorithm {
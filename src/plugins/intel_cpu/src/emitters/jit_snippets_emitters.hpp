@@ -7,6 +7,8 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/variant.hpp>
 
+#include <limits>
+
 #include "jit_emitter.hpp"
 using namespace Xbyak;
 namespace MKLDNNPlugin {
@@ -18,6 +20,10 @@ namespace MKLDNNPlugin {
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    // scheduling parameters of the shape-agnostic kernels, they have the same meaning as the compile time ones
+    int64_t scheduler_dims[SNIPPETS_MAX_TILE_RANK] = {};
+    int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
 };
 
 struct jit_snippets_compile_args {
@@ -25,6 +31,9 @@ struct jit_snippets_compile_args {
     int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
     std::vector<int64_t> output_dims = {};
+    // if true, the dims and offsets above are ignored and read from jit_snippets_call_args at runtime,
+    // so the kernel can be reused for any shapes with the same broadcasting pattern
+    bool shape_agnostic = false;
 };
 ///
 /// \brief    Kernel is the only entry point to Codogen Jit compilation. Kernel calculates appropriate data offsets,
@@ -108,9 +117,14 @@ private:
         h->preamble();
 
         std::vector<Reg64> regs(num_params);
-        auto init_ptrs_with_offsets = [&](Reg64 pointer, const int64_t *offsets) {
+        auto init_ptrs_with_offsets = [&](Reg64 pointer, size_t param_idx) {
+            const int64_t *offsets = &jcp.data_offsets[param_idx * harness_num_dims];
             for (int j = 0; j < harness_num_dims; j++) {
-                if (jcp.output_dims[j] != 1 && offsets[j] != 0) {
+                if (jcp.shape_agnostic) {
+                    h->mov(reg_tmp_64, h->ptr[reg_const_params + GET_OFF(data_offsets) + (param_idx * harness_num_dims + j) * sizeof(int64_t)]);
+                    h->imul(reg_tmp_64, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                    h->add(pointer, reg_tmp_64);
+                } else if (jcp.output_dims[j] != 1 && offsets[j] != 0) {
                     h->mov(reg_tmp_64, offsets[j]);
                     h->imul(reg_tmp_64, h->ptr[reg_indexes + j * sizeof(size_t)]);
                     h->add(pointer, reg_tmp_64);
@@ -123,7 +137,7 @@ private:
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
             else
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-            init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
+            init_ptrs_with_offsets(regs[i], i);
         }
 
         for (auto& c : code) {
@@ -202,6 +216,7 @@ private:
         const size_t dim = in[3]; // tile dimension: 0 - outer, 1 - inner
         const int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
         Reg64 amount = Reg64(reg64_tmp_start + num_params); // amount
+        Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param2 };
         std::array<Label, 2> for_body;
 
         // If R15 is not used, reserve it for use in scalar to avoid redundant push-pop's.
@@ -211,12 +226,19 @@ private:
         for (auto i = 0; dim == 0 && i < num_params; i++)
             regs[i] = Reg64(reg64_tmp_start + i);
         // Loop processing could be simplified in some cases
-        if (inc > jcp.scheduler_dims[dim]) {
+        if (jcp.shape_agnostic) {
+            // The work amount is known only at runtime, so the loop is always emitted.
+            // The previous tile in the dim (if any) leaves the rest of the work in the amount register
+            if (previous_inc == 0) {
+                h->mov(amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + dim * sizeof(int64_t)]);
+            }
+        } else if (inc > jcp.scheduler_dims[dim]) {
             return;
         } else if (inc == jcp.scheduler_dims[dim]) {
             for (auto& c : code) {
                 c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
             }
+            return;
         } else {
             // The previous tile has done nothing, all the work is ours
             if (previous_inc == 0 || previous_inc > jcp.scheduler_dims[dim]) {
@@ -225,31 +247,33 @@ private:
             } else if (jcp.scheduler_dims[dim] % previous_inc == 0) {
                 return;
             }// else: the previous tile has already set a proper work amount
-            h->cmp(amount, inc);
-            h->jl(for_body[0], CodeGenerator::T_NEAR);
+        }
+        h->cmp(amount, inc);
+        h->jl(for_body[0], CodeGenerator::T_NEAR);
 
-            h->L(for_body[1]);
-            {
-                h->push(amount);
-                for (auto& c : code) {
-                    c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
-                }
-                h->pop(amount);
-                // Todo: Load and Store emitters are currently implemented so they ALWAYS increment appropriate pointers
-                //   after reading/writing. This might be a problem if we need to read the same data multiple times (broadcasting shapes).
-                //   To overcome this limitation, we add appropriate negative offsets if necessary.
-                for (auto i = 0; dim == 0 && i < num_params; i++) {
-                    if (jcp.scheduler_offsets[i] != 0) {
-                        h->add(regs[i], jcp.scheduler_offsets[i]);
-                    }
+        h->L(for_body[1]);
+        {
+            h->push(amount);
+            for (auto& c : code) {
+                c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
+            }
+            h->pop(amount);
+            // Todo: Load and Store emitters are currently implemented so they ALWAYS increment appropriate pointers
+            //   after reading/writing. This might be a problem if we need to read the same data multiple times (broadcasting shapes).
+            //   To overcome this limitation, we add appropriate negative offsets if necessary.
+            for (auto i = 0; dim == 0 && i < num_params; i++) {
+                if (jcp.shape_agnostic) {
+                    h->add(regs[i], h->ptr[reg_const_params + GET_OFF(scheduler_offsets) + i * sizeof(int64_t)]);
+                } else if (jcp.scheduler_offsets[i] != 0) {
+                    h->add(regs[i], jcp.scheduler_offsets[i]);
                 }
-                    h->sub(amount, inc);
-                    h->cmp(amount, inc);
-                    h->jge(for_body[1], CodeGenerator::T_NEAR);
             }
-
-            h->L(for_body[0]);
+            h->sub(amount, inc);
+            h->cmp(amount, inc);
+            h->jge(for_body[1], CodeGenerator::T_NEAR);
         }
+
+        h->L(for_body[0]);
     }
 
     // A = <42, 17>
@@ -291,6 +315,155 @@ private:
     std::vector<std::pair<std::shared_ptr<Emitter>, ngraph::snippets::RegInfo>> code;
 };
 
+///
+/// \brief    Stage is one pass over the innermost dimension of a snippet with reductions. It is placed into the outer Tile
+/// instead of the inner Tiles and encloses its own vector and scalar Tiles:
+/// TileEmitter {            /* outer tile */
+///     StageEmitter {       /* accumulates the reductions the next stages depend on */
+///         TileEmitter {...}
+///         TileEmitter {...}
+///     }
+///     StageEmitter {...}   /* uses the reduced values, stores the results */
+/// }
+/// The Stage initializes the accumulators before the inner Tiles, reduces them horizontally and broadcasts the result
+/// to all the lanes after the Tiles, so the next stages can use them as regular vector values. The data pointers
+/// which are read again by the next stages are moved back to the row start.
+///
+/// \param      in[0]    sum number inputs and number of outputs of the node.
+///
+class StageEmitter : public jit_emitter {
+public:
+    StageEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa,
+    const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto stage = ov::as_type_ptr<ngraph::snippets::op::Stage>(n);
+        if (!stage)
+            IE_THROW() << "StageEmitter invoked with invalid op argument";
+        if (!stage->compile_params)
+            IE_THROW() << "StageEmitter invoked without compile_params";
+        code = stage->region;
+        jcp = *reinterpret_cast<const jit_snippets_compile_args*>(stage->compile_params);
+        for (auto reduction : stage->reductions) {
+            const auto regs = ngraph::snippets::getRegisters(reduction).second;
+            if (regs.size() != 1)
+                IE_THROW() << "StageEmitter got reduction with invalid register info";
+            accumulators.push_back({regs[0], ov::is_type<ngraph::snippets::op::ReduceMax>(reduction)});
+        }
+        rewind_ptrs = stage->rewind_ptrs;
+    }
+
+    size_t get_inputs_num() const override {return 0;}
+
+    void emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+              const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
+        validate_arguments(in, out, pool, gpr);
+        emit_impl(in, out, pool, gpr, nullptr);
+    }
+
+private:
+    void validate_arguments(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                            const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
+        if (in.size() != 1)
+            IE_THROW() << "StageEmitter got invalid number of inputs. Expected 1, got " << in.size();
+        if (out.size() != 0)
+            IE_THROW() << "StageEmitter got unexpected output arguments.";
+        if (in[0] > SNIPPETS_MAX_SNIPPETS_DIMS)
+            IE_THROW() << "StageEmitter supports only up to " << SNIPPETS_MAX_SNIPPETS_DIMS <<
+                       " parameters, got " << in[0];
+    }
+
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, pool, gpr);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, pool, gpr);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, pool, gpr);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        const size_t num_params = in[0];
+        const int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
+        // the work amount register of the inner tiles is free between the tiles
+        Reg64 reg_tmp = Reg64(reg64_tmp_start + num_params);
+
+        for (const auto& acc : accumulators) {
+            Vmm vmm_acc = Vmm(acc.first);
+            if (acc.second) {
+                h->mov(reg_tmp.cvt32(), mkldnn::impl::cpu::x64::float2int(-std::numeric_limits<float>::infinity()));
+                if (isa == dnnl::impl::cpu::x64::sse41)
+                    h->movd(Xmm(acc.first), reg_tmp.cvt32());
+                else
+                    h->vmovd(Xmm(acc.first), reg_tmp.cvt32());
+                h->uni_vbroadcastss(vmm_acc, Xmm(acc.first));
+            } else {
+                h->uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+            }
+        }
+
+        for (auto& c : code) {
+            c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+        }
+
+        // no other vector values are alive between the stages, so any register except the accumulators can be used
+        size_t tmp_idx = 0;
+        while (std::any_of(accumulators.begin(), accumulators.end(),
+                           [tmp_idx](const std::pair<size_t, bool>& acc) { return acc.first == tmp_idx; }))
+            tmp_idx++;
+        for (const auto& acc : accumulators) {
+            auto reduce = [&](const Xmm& dst, const Operand& src) {
+                if (acc.second)
+                    h->uni_vmaxps(dst, dst, src);
+                else
+                    h->uni_vaddps(dst, dst, src);
+            };
+            if (isa == dnnl::impl::cpu::x64::avx512_common) {
+                h->vextractf64x4(Ymm(tmp_idx), Zmm(acc.first), 1);
+                reduce(Ymm(acc.first), Ymm(tmp_idx));
+            }
+            if (isa != dnnl::impl::cpu::x64::sse41) {
+                h->vextractf128(Xmm(tmp_idx), Ymm(acc.first), 1);
+                reduce(Xmm(acc.first), Xmm(tmp_idx));
+            }
+            h->uni_vshufps(Xmm(tmp_idx), Xmm(acc.first), Xmm(acc.first), 0x4E);
+            reduce(Xmm(acc.first), Xmm(tmp_idx));
+            h->uni_vshufps(Xmm(tmp_idx), Xmm(acc.first), Xmm(acc.first), 0xB1);
+            reduce(Xmm(acc.first), Xmm(tmp_idx));
+            if (isa != dnnl::impl::cpu::x64::sse41)
+                h->uni_vbroadcastss(Vmm(acc.first), Xmm(acc.first));
+        }
+
+        if (jcp.shape_agnostic && !rewind_ptrs.empty()) {
+            Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param2 };
+            h->mov(reg_tmp, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + (SNIPPETS_MAX_TILE_RANK - 1) * sizeof(int64_t)]);
+            h->imul(reg_tmp, reg_tmp, sizeof(float));
+        }
+        for (auto ptr : rewind_ptrs) {
+            if (jcp.shape_agnostic)
+                h->sub(Reg64(static_cast<int>(ptr)), reg_tmp);
+            else
+                h->sub(Reg64(static_cast<int>(ptr)), jcp.scheduler_dims[SNIPPETS_MAX_TILE_RANK - 1] * sizeof(float));
+        }
+    }
+
+    jit_snippets_compile_args jcp;
+    std::vector<std::pair<std::shared_ptr<Emitter>, ngraph::snippets::RegInfo>> code;
+    // accumulator register and whether the reduction is max (sum otherwise)
+    std::vector<std::pair<size_t, bool>> accumulators;
+    std::vector<size_t> rewind_ptrs;
+};
+
 class NopEmitter : public jit_emitter {
 public:
     NopEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
@@ -638,4 +811,101 @@ private:
     bool shouldPostIncrement;
 };
 
-} // namespace MKLDNNPlugin
\ No newline at end of file
+} // namespace MKLDNNPlugin
+///
+/// Reduction emitters accumulate the input into the register of the reduction, which is initialized and
+/// reduced horizontally by the enclosing StageEmitter.
+///
+class ReduceEmitter : public jit_emitter {
+public:
+    ReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), is_max(ov::is_type<ngraph::snippets::op::ReduceMax>(n)) {
+    }
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                            Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src0 = Vmm(in[0]);
+        Vmm vmm_acc = Vmm(out[0]);
+        if (is_max)
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_src0);
+        else
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_src0);
+    }
+
+private:
+    bool is_max;
+};
+
+class ScalarReduceEmitter : public jit_emitter {
+public:
+    ScalarReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), is_max(ov::is_type<ngraph::snippets::op::ReduceMax>(n)) {
+    }
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const MKLDNNPlugin::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                            Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Xmm xmm_src0 = Xmm(in[0]);
+        Vmm vmm_acc = Vmm(out[0]);
+        Vmm vmm_aux = Vmm(aux_vec_idxs[0]);
+        // only the lowest lane of the input is valid, the other lanes mustn't affect the accumulator
+        if (is_max) {
+            h->uni_vbroadcastss(vmm_aux, xmm_src0);
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_aux);
+        } else {
+            h->uni_vpxor(vmm_aux, vmm_aux, vmm_aux);
+            if (isa == dnnl::impl::cpu::x64::sse41)
+                h->movss(Xmm(aux_vec_idxs[0]), xmm_src0);
+            else
+                h->vmovss(Xmm(aux_vec_idxs[0]), Xmm(aux_vec_idxs[0]), xmm_src0);
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_aux);
+        }
+    }
+
+private:
+    bool is_max;
+};
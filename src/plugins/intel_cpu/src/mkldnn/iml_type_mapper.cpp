@@ -23,6 +23,8 @@ impl_desc_type MKLDNNPlugin::parse_impl_name(std::string impl_desc_name) {
     SEARCH_WORD(ref);
     SEARCH_WORD(jit);
     SEARCH_WORD(brgconv);
+    // the brgemm based deconvolution is selected like the convolution
+    SEARCH_WORD_2(brgdeconv, brgconv);
     SEARCH_WORD(brgemm);
     if ((res & impl_desc_type::brgemm) != impl_desc_type::brgemm)
         SEARCH_WORD(gemm);
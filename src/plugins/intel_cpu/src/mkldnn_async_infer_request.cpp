@@ -9,7 +9,17 @@ MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEn
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    auto request = static_cast<MKLDNNInferRequest*>(inferRequest.get());
+    request->SetAsyncRequest(this);
+    // the inputs of the next request are prepared while the stream computes the current one
+    if (auto inputsExecutor = request->GetInputsExecutor()) {
+        _pipeline = {{inputsExecutor, [request] {
+                          request->PrepareInputs();
+                      }},
+                     {taskExecutor, [request] {
+                          request->InferImpl(true);
+                      }}};
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
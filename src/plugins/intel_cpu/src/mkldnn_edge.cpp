@@ -7,6 +7,11 @@
 #include "mkldnn_extension_utils.h"
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_input_node.h>
+#include "memory_desc/cpu_memory_desc_utils.h"
+
+#include <sstream>
+#include <unordered_set>
+#include <vector>
 
 using namespace mkldnn;
 namespace MKLDNNPlugin {
@@ -283,6 +288,33 @@ std::string MKLDNNEdge::name() const {
     return  result.str();
 }
 
+std::string MKLDNNEdge::cacheKey() const {
+    // The edge name identifies the constant path inside the network only: the networks sharing the cache (e.g. the
+    // variants of other input shapes, see MKLDNNExecNetwork::Reshape) compute the path of the same name in another
+    // layout or from other constants. So the key includes the descriptor and the data of the source constants.
+    const auto& desc = getDesc();
+    std::ostringstream key;
+    key << name() << "_" << desc.getPrecision().name() << "_" << desc.serializeFormat()
+        << "_" << MemoryDescUtils::dims2str(desc.getShape().getDims());
+    std::unordered_set<const MKLDNNNode*> visited;
+    std::vector<MKLDNNNodePtr> nodes{getParent()};
+    while (!nodes.empty()) {
+        const auto node = nodes.back();
+        nodes.pop_back();
+        if (!visited.insert(node.get()).second)
+            continue;
+        if (node->getType() == Input) {
+            const auto input = std::dynamic_pointer_cast<MKLDNNInputNode>(node);
+            if (input && input->getMemoryPtr())
+                key << "_" << input->getMemoryPtr()->GetData();
+            continue;
+        }
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            nodes.push_back(node->getParentEdgeAt(i)->getParent());
+    }
+    return key.str();
+}
+
 void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
     if (status != Status::NeedAllocation)
         return;
@@ -293,7 +325,8 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        externalMemoryKey = cacheKey();
+        auto ptr = weightsCache->findOrCreate(externalMemoryKey, alloc, false);
         memoryPtr = *ptr;
         useExternalMemory = true;
         status = Status::Allocated;
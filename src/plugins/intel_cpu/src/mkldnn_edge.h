@@ -79,6 +79,8 @@ public:
 
 private:
     std::string name() const;
+    // identifies the memory of the constant path in the weights cache
+    std::string cacheKey() const;
 
     std::weak_ptr<MKLDNNNode> parent;
     std::weak_ptr<MKLDNNNode> child;
@@ -86,6 +88,7 @@ private:
     int child_port;
 
     bool useExternalMemory = false;
+    std::string externalMemoryKey;
     MKLDNNEdgeWeakPtr memoryFromEdge;
     MKLDNNMemoryPtr memoryPtr;
     Status status = Status::Uninitialized;
@@ -5,6 +5,7 @@
 #include <ie_metric_helpers.hpp>
 #include <precision_utils.h>
 #include "mkldnn_exec_network.h"
+#include "mkldnn_plugin.h"
 
 #include "mkldnn_async_infer_request.h"
 #include "mkldnn_infer_request.h"
@@ -20,18 +21,111 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <fstream>
+#include <sstream>
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/op/util/multi_subgraph_base.hpp>
+#include <openvino/core/attribute_visitor.hpp>
 #include <transformations/utils/utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+template <typename T>
+void hash_combine(size_t& seed, const T& v) {
+    seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// Hashes the attributes of an operation, e.g. the transposition of the MatMul inputs, which determine the layout
+// of the repacked weights as well
+class AttributesHasher : public ov::AttributeVisitor {
+public:
+    explicit AttributesHasher(size_t& seed) : seed(seed) {}
+
+    // the values of the other types (the constants data, the subgraphs) are hashed separately
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        hash_combine(seed, name);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override { combine(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override { combine(name, adapter.get()); }
+
+private:
+    template <typename T>
+    void combine(const std::string& name, const T& value) {
+        hash_combine(seed, name);
+        hash_combine(seed, value);
+    }
+
+    template <typename T>
+    void combine(const std::string& name, const std::vector<T>& values) {
+        hash_combine(seed, name);
+        hash_combine(seed, values.size());
+        for (const auto& value : values)
+            hash_combine(seed, value);
+    }
+
+    size_t& seed;
+};
+
+// Hashes the topology, the shapes, the attributes of the operations and the constants data, which determine
+// the content of the weights.
+void hashFunctionContent(size_t& seed, const std::shared_ptr<const ngraph::Function>& function) {
+    for (const auto& op : function->get_ordered_ops()) {
+        hash_combine(seed, std::string(op->get_type_name()));
+        hash_combine(seed, op->get_friendly_name());
+        for (const auto& output : op->outputs()) {
+            std::ostringstream shape;
+            shape << output.get_element_type() << output.get_partial_shape();
+            hash_combine(seed, shape.str());
+        }
+        if (const auto constant = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(op)) {
+            hash_combine(seed, MKLDNNWeightsSharing::GetHashFunc().hash(
+                    static_cast<const unsigned char*>(constant->get_data_ptr()), constant->get_byte_size()));
+        } else {
+            AttributesHasher attributesHasher(seed);
+            std::const_pointer_cast<ov::Node>(op)->visit_attributes(attributesHasher);
+        }
+        if (const auto subGraphOp = std::dynamic_pointer_cast<const ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < subGraphOp->get_internal_subgraphs_size(); ++i) {
+                hashFunctionContent(seed, subGraphOp->get_function(static_cast<int>(i)));
+            }
+        }
+    }
+}
+}  // namespace
+
 InferenceEngine::IInferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                           const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
@@ -57,12 +151,17 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const CPURemoteContext::Ptr &context,
+                                     const MKLDNNExecNetwork* original,
+                                     const MKLDNNPrepackedWeights::CPtr &prepackedWeights) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
+    _context(context),
+    _prepackedWeights(prepackedWeights),
         _network(network) {
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -86,10 +185,27 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        if (_cfg.sharedStreams) {
+            _taskExecutor = ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamsExecutorConfig,
+                                                                                       _cfg.networkPriority,
+                                                                                       _cfg.networkWeight);
+        } else {
+            _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        }
 #endif
     }
-    if (0 != cfg.streamExecutorConfig._streams) {
+    if (0 != _cfg.callbackThreads) {
+        // the pool shared by the networks, so neither the streams nor the inference thread execute the callbacks
+        IStreamsExecutor::Config callbackConfig{"CPUSharedCallbackExecutor",
+                                                static_cast<int>(_cfg.callbackThreads),
+                                                1,
+                                                IStreamsExecutor::ThreadBindingType::NONE};
+        if (_cfg.callbackThreadsOffset >= 0) {
+            callbackConfig._threadBindingType = IStreamsExecutor::ThreadBindingType::CORES;
+            callbackConfig._threadBindingOffset = _cfg.callbackThreadsOffset;
+        }
+        _callbackExecutor = ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(callbackConfig);
+    } else if (0 != cfg.streamExecutorConfig._streams) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         // There is no additional threads but we still need serialize callback execution to preserve legacy behaviour
         _callbackExecutor = std::make_shared<ImmediateSerialExecutor>();
@@ -100,19 +216,72 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (0 != _cfg.inputsPreparationThreads) {
+        _inputsExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+                              IStreamsExecutor::Config{"CPUInputsExecutor",
+                                                       static_cast<int>(_cfg.inputsPreparationThreads),
+                                                       1,
+                                                       IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
+    if (original) {
+        // the constants of the same data and the constant paths computed from them are shared with the original
+        _weightsKey = original->_weightsKey;
+    } else if (_cfg.weightsSharingByContent) {
+        size_t seed = 0;
+        hashFunctionContent(seed, function);
+        // the graph options changing the weights layouts
+        hash_combine(seed, _cfg.enforceBF16);
+        hash_combine(seed, _cfg.bf16MixedPrecision);
+        for (const auto& node : _cfg.fp32Nodes)
+            hash_combine(seed, node);
+        hash_combine(seed, _cfg.batchLimit);
+        std::ostringstream key;
+        key << "content_" << std::hex << seed;
+        _weightsKey = key.str();
+    } else {
+        static std::atomic<size_t> networksCounter{0};
+        _weightsKey = "network_" + std::to_string(networksCounter++);
+    }
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    if (original && original->_rtParamsCache) {
+        // the primitives of the shapes both networks have are created once
+        _rtParamsCache = original->_rtParamsCache;
+    } else if (_cfg.rtCacheShared && streams > 1) {
+        _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, streams);
+    }
+    if (_cfg.workspacePoolCapacity != 0 && _cfg.workspacePoolCapacity < static_cast<size_t>(streams)) {
+        _workspacePool = std::make_shared<MKLDNNWorkspacePool>(_cfg.workspacePoolCapacity);
+    }
+    std::vector<ShapesProfile::InputShapes> warmUpShapes;
+    if (_cfg.shapesWarmStart && !_cfg.cache_dir.empty() && function->is_dynamic()) {
+        _shapesProfile = std::make_shared<ShapesProfile>(std::max<size_t>(_cfg.rtCacheCapacity, 1));
+        _shapesProfilePath = ShapesProfile::getFilePath(_cfg.cache_dir, ShapesProfile::computeKey(function));
+        std::ifstream profileStream(_shapesProfilePath);
+        if (profileStream.is_open()) {
+            try {
+                _shapesProfile->load(profileStream);
+                warmUpShapes = _shapesProfile->get();
+            } catch (const std::exception&) {
+                // the profile is damaged, start collecting it from scratch
+                _shapesProfile = std::make_shared<ShapesProfile>(std::max<size_t>(_cfg.rtCacheCapacity, 1));
+            }
+        }
+    }
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
         for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
+            task = [this, &warmUpShapes] {
+                auto graphLock = MKLDNNExecNetwork::GetGraph();
+                graphLock._graph.WarmUp(warmUpShapes);
             };
         }
         _taskExecutor->runAndWait(tasks);
     } else {
-        MKLDNNExecNetwork::GetGraph();
+        auto graphLock = MKLDNNExecNetwork::GetGraph();
+        graphLock._graph.WarmUp(warmUpShapes);
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -139,6 +308,18 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
+MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    if (!_shapesProfile || _shapesProfile->empty())
+        return;
+    try {
+        std::ofstream profileStream(_shapesProfilePath);
+        if (profileStream.is_open())
+            _shapesProfile->save(profileStream);
+    } catch (...) {
+        // the warm start profile is optional, so failures to store it are ignored
+    }
+}
+
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
@@ -152,11 +333,30 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
+                size_t replicationThreshold = std::numeric_limits<size_t>::max();
+                bool weightsSharingByContent = false;
+                bool threadsBound = false;
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    weightsSharingByContent = _cfg.weightsSharingByContent;
+                    threadsBound = _cfg.streamExecutorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::NONE;
+                    if (_cfg.weightsReplication == Config::WeightsReplication::BySize) {
+                        replicationThreshold = _cfg.weightsReplicationThreshold;
+                    } else if (_cfg.weightsReplication == Config::WeightsReplication::None) {
+                        replicationThreshold = 0;
+                    }
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.setSharedRuntimeCache(_rtParamsCache);
+                graphLock._graph.setWorkspacePool(_workspacePool);
+                graphLock._graph.setMemoryContext(_context);
+                graphLock._graph.setPrepackedWeights(_prepackedWeights);
+                // the streams pinned to the NUMA node keep their intermediate tensors on it
+                const bool bindToNumaNode =
+                    nullptr != streamsExecutor && threadsBound && InferenceEngine::getAvailableNUMANodes().size() > 1;
+                graphLock._graph.setNumaNodeId(bindToNumaNode ? numaNodeId : -1);
+                auto weightsCache = _numaNodesWeights.get(numaNodeId, replicationThreshold, _weightsKey, weightsSharingByContent);
+                graphLock._graph.CreateGraph(_network, extensionManager, weightsCache);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -190,6 +390,12 @@ InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferReques
     return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
 }
 
+std::shared_ptr<InferenceEngine::RemoteContext> MKLDNNExecNetwork::GetContext() const {
+    if (!_context)
+        return ExecutableNetworkThreadSafeDefault::GetContext();
+    return _context;
+}
+
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
@@ -220,6 +426,11 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_RUNTIME_CACHE_STATISTICS));
+        metrics.push_back(METRIC_KEY(CPU_REORDERS_BYTES));
+        metrics.push_back(METRIC_KEY(CPU_AMX_NODES));
+        metrics.push_back(METRIC_KEY(CPU_STREAMS_STATISTICS));
+        metrics.push_back(METRIC_KEY(CPU_LATE_ALLOCATIONS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -234,6 +445,63 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_RUNTIME_CACHE_STATISTICS)) {
+        CacheStatistics statistics;
+        std::unordered_set<const MultiCache*> visited;
+        for (auto& graph : _graphs) {
+            auto graphLock = Graph::Lock(graph);
+            auto cache = graphLock._graph.getRuntimeCache();
+            if (graphLock._graph.IsReady() && cache && visited.insert(cache.get()).second) {
+                statistics += cache->getStatistics();
+            }
+        }
+        IE_SET_METRIC_RETURN(CPU_RUNTIME_CACHE_STATISTICS, std::map<std::string, uint64_t>{
+            {"HITS", statistics.hits}, {"MISSES", statistics.misses}, {"EVICTIONS", statistics.evictions}});
+    } else if (name == METRIC_KEY(CPU_REORDERS_BYTES)) {
+        // all the streams graphs are created from the same network with the same config, so any ready one is reported
+        std::map<std::string, uint64_t> report;
+        for (auto& graph : _graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady()) {
+                report = graphLock._graph.GetReordersReport();
+                break;
+            }
+        }
+        IE_SET_METRIC_RETURN(CPU_REORDERS_BYTES, report);
+    } else if (name == METRIC_KEY(CPU_AMX_NODES)) {
+        std::map<std::string, std::string> report;
+        for (auto& graph : _graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady()) {
+                report = graphLock._graph.GetAmxNodesReport();
+                break;
+            }
+        }
+        IE_SET_METRIC_RETURN(CPU_AMX_NODES, report);
+    } else if (name == METRIC_KEY(CPU_STREAMS_STATISTICS)) {
+        // the TBB streams executor does not collect the statistics, so nothing is reported
+        std::map<std::string, uint64_t> report;
+        if (auto streamsExecutor = dynamic_cast<InferenceEngine::CPUStreamsExecutor*>(_taskExecutor.get())) {
+            for (const auto& stream : streamsExecutor->GetStreamsStatistics()) {
+                const std::string coreType =
+                    stream.coreType == IStreamsExecutor::Config::PreferredCoreType::BIG ? "BIG" :
+                    stream.coreType == IStreamsExecutor::Config::PreferredCoreType::LITTLE ? "LITTLE" : "ANY";
+                report[coreType + "_STREAMS"]++;
+                report[coreType + "_TASKS"] += stream.tasks;
+                report[coreType + "_BUSY_TIME_US"] += stream.busyTimeUs;
+            }
+        }
+        IE_SET_METRIC_RETURN(CPU_STREAMS_STATISTICS, report);
+    } else if (name == METRIC_KEY(CPU_LATE_ALLOCATIONS)) {
+        std::map<std::string, uint64_t> report{{"ALLOCATIONS", 0}, {"PREPARATIONS", 0}};
+        for (auto& graph : _graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady()) {
+                for (const auto& counter : graphLock._graph.GetLateAllocationsReport())
+                    report[counter.first] += counter.second;
+            }
+        }
+        IE_SET_METRIC_RETURN(CPU_LATE_ALLOCATIONS, report);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -286,7 +554,17 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
     return true;
 }
 
+std::shared_ptr<InferenceEngine::IExecutableNetworkInternal>
+MKLDNNExecNetwork::Reshape(const std::map<std::string, ov::PartialShape>& shapes) {
+    auto engine = std::dynamic_pointer_cast<Engine>(_plugin);
+    if (!engine)
+        IE_THROW() << "The CPU network " << _name << " is not bound to the plugin";
+    return engine->ReshapeNetwork(*this, shapes);
+}
+
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+    // the import of the blob consumes the weights prepacked by the compilation instead of repeating it
+    GetGraph()._graph.ExportPrepackedWeights(modelStream);
 }
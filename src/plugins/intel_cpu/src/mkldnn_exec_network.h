@@ -8,7 +8,9 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 
 #include "mkldnn_graph.h"
+#include "cpu_remote_context.h"
 #include "mkldnn_extension_mngr.h"
+#include "cache/shapes_profile.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -19,6 +21,8 @@
 
 namespace MKLDNNPlugin {
 
+class Engine;
+
 class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
@@ -33,8 +37,17 @@ public:
 
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
+    /**
+     * @param original the network @p network is the variant of other input shapes of (see Reshape), the variant shares
+     * the weights and the runtime parameters cache with it
+     * @param prepackedWeights the compilation results read from the export blob along with @p network (see Export)
+     */
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const CPURemoteContext::Ptr &context = nullptr, const MKLDNNExecNetwork* original = nullptr,
+                      const MKLDNNPrepackedWeights::CPtr &prepackedWeights = nullptr);
+
+    ~MKLDNNExecNetwork() override;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -42,12 +55,18 @@ public:
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
 
+    std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
+
     std::shared_ptr<ngraph::Function> GetExecGraphInfo() override;
 
     void Export(std::ostream& modelStream) override;
 
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal>
+    Reshape(const std::map<std::string, ov::PartialShape>& shapes) override;
+
 protected:
     friend class MKLDNNInferRequest;
+    friend class Engine;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
@@ -66,6 +85,28 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // runtime parameters cache shared between the streams (if enabled)
+    MultiCachePtr                               _rtParamsCache;
+    // input shapes collected for the warm start of dynamic networks (if enabled)
+    ShapesProfilePtr                            _shapesProfile;
+    std::string                                 _shapesProfilePath;
+    // limits the number of resident intermediate tensors workspaces (if enabled)
+    MKLDNNWorkspacePool::Ptr                    _workspacePool;
+    // identifies the network weights in the weights cache
+    std::string                                 _weightsKey;
+    // executes the inputs preparation stage of the asynchronous requests (if enabled)
+    InferenceEngine::ITaskExecutor::Ptr         _inputsExecutor;
+    // the memory of the input, output and intermediate tensors (if the network is compiled with a context)
+    CPURemoteContext::Ptr                       _context;
+    // the network before the transformations and its compilation config, the variants of other input shapes are
+    // compiled from them (null for the imported networks)
+    struct Source {
+        InferenceEngine::CNNNetwork             network;
+        std::map<std::string, std::string>      config;
+    };
+    std::shared_ptr<const Source>               _source;
+    // the selected primitive descriptors and the prepacked weights of the imported network (null for the compiled ones)
+    MKLDNNPrepackedWeights::CPtr                _prepackedWeights;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_extension.h"
+#include "ngraph_transformations/op/attention.hpp"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
@@ -34,6 +35,7 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
         ngraph::OpSet opset;
 
 #define NGRAPH_OP(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+        NGRAPH_OP(AttentionNode, MKLDNNPlugin)
         NGRAPH_OP(FullyConnectedNode, MKLDNNPlugin)
         NGRAPH_OP(LeakyReluNode, MKLDNNPlugin)
         NGRAPH_OP(PowerStaticNode, MKLDNNPlugin)
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <map>
 #include <vector>
@@ -13,6 +14,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <iterator>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -25,8 +27,12 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_if_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -39,6 +45,7 @@
 #include "utils/node_dumper.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
+#include "utils/numa_memory.h"
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
@@ -60,6 +67,21 @@ typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 mkldnn::engine MKLDNNGraph::eng(mkldnn::engine::kind::cpu, 0);
 
+namespace {
+// the request executed by the calling thread, it is inherited by the nested graphs
+thread_local MKLDNNInferRequest* currentRequest = nullptr;
+
+struct CurrentRequestGuard {
+    explicit CurrentRequestGuard(MKLDNNInferRequest* request) : prevRequest(currentRequest) {
+        currentRequest = request;
+    }
+    ~CurrentRequestGuard() {
+        currentRequest = prevRequest;
+    }
+    MKLDNNInferRequest* prevRequest;
+};
+}  // namespace
+
 template<typename NET>
 void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
         MKLDNNWeightsSharing::Ptr &w_cache) {
@@ -67,10 +89,10 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
 
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once and the weights are not shared with other networks
+    weightsCache = config.streamExecutorConfig._streams != 1 || config.weightsSharingByContent ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    rtParamsCache = sharedRtParamsCache ? sharedRtParamsCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
 
     Replicate(net, extMgr);
     InitGraph();
@@ -116,6 +138,7 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgr
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setBatchBuckets(config.batchBuckets);
 
         graphNodes.push_back(node);
 
@@ -213,6 +236,7 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setBatchBuckets(config.batchBuckets);
         graphNodes.push_back(node);
 
         if (op->get_type_info() == ngraph::op::v0::Parameter::get_type_info_static()) {
@@ -324,6 +348,9 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    if (config.globalLayoutSelection)
+        MinimizeReorders();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -331,10 +358,16 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecutionLevels();
+
+    InitLazyBranches();
+
     Allocate();
 
     CreatePrimitives();
 
+    InitStatesInPlace();
+
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
         graphNode->cleanup();
@@ -342,7 +375,19 @@ void MKLDNNGraph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
-    ExecuteConstantNodesOnly();
+    // with the dynamic batch the nodes limits are changed before the inference, so the constants are prepared right away
+    const auto preparation = config.enableDynamicBatch ? Config::ConstantsPreparation::OnCompile : config.constantsPreparation;
+    if (preparation == Config::ConstantsPreparation::OnCompile) {
+        ExecuteConstantNodesOnly();
+        constantsReady = true;
+    } else if (preparation == Config::ConstantsPreparation::InBackground) {
+        constantsTask = std::async(std::launch::async, [this] { ExecuteConstantNodesOnly(); });
+    }
+}
+
+void MKLDNNGraph::ExportPrepackedWeights(std::ostream& stream) {
+    PrepareConstantNodes();
+    MKLDNNPrepackedWeights::write(stream, *this);
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -373,8 +418,139 @@ void MKLDNNGraph::InitDescriptors() {
 
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
-        node->selectOptimalPrimitiveDescriptor();
+        const int prepackedIndex = prepackedWeights ? prepackedWeights->getSelectedPrimitiveDescriptor(*node) : -1;
+        if (prepackedIndex >= 0) {
+            node->selectPrimitiveDescriptorByIndex(prepackedIndex);
+        } else {
+            node->selectOptimalPrimitiveDescriptor();
+        }
+    }
+}
+
+namespace {
+// the number of bytes read and written by a reorder between the descriptors, the undefined dimensions are estimated
+// by their lower bounds
+uint64_t reorderBytes(const MemoryDesc& src, const MemoryDesc& dst) {
+    uint64_t elements = 1;
+    for (auto dim : src.getShape().getMinDims())
+        elements *= std::max<Dim>(dim, 1);
+    return elements * (src.getPrecision().size() + dst.getPrecision().size());
+}
+
+uint64_t estimateReorderBytes(const MemoryDesc& src, const MemoryDesc& dst) {
+    return dst.isCompatible(src) ? 0 : reorderBytes(src, dst);
+}
+} // namespace
+
+void MKLDNNGraph::MinimizeReorders() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::MinimizeReorders");
+
+    // The reorders on the constant paths are executed once on the network loading, so they don't count
+    auto nodeReordersBytes = [](const MKLDNNNodePtr& node, const NodeConfig& config) {
+        uint64_t bytes = 0;
+        for (size_t i = 0; i < config.inConfs.size() && i < node->getParentEdges().size(); i++) {
+            auto parentEdge = node->getParentEdgeAt(i);
+            auto parent = parentEdge->getParent();
+            auto parentPd = parent->getSelectedPrimitiveDescriptor();
+            if (parent->isConstant() || parentPd == nullptr || parentPd->getConfig().outConfs.empty())
+                continue;
+            int inNum = parentEdge->getInputNum();
+            if (inNum < 0 || inNum >= parentPd->getConfig().outConfs.size())
+                inNum = 0;
+            bytes += estimateReorderBytes(*parentPd->getConfig().outConfs[inNum].desc, *config.inConfs[i].desc);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto childEdge = node->getChildEdgeAt(i);
+            auto childPd = childEdge->getChild()->getSelectedPrimitiveDescriptor();
+            const int outNum = childEdge->getInputNum();
+            const int childInNum = childEdge->getOutputNum();
+            if (childPd == nullptr || outNum < 0 || outNum >= config.outConfs.size() ||
+                childInNum < 0 || childInNum >= childPd->getConfig().inConfs.size())
+                continue;
+            bytes += estimateReorderBytes(*config.outConfs[outNum].desc, *childPd->getConfig().inConfs[childInNum].desc);
+        }
+        return bytes;
+    };
+
+    // The alternative descriptor must differ from the selected one by the layouts only: the nodes choosing the
+    // descriptors themselves and the in-place ones are left as they are
+    auto isLayoutAlternative = [](const NodeDesc& selected, const NodeDesc& candidate) {
+        const auto& lhs = selected.getConfig();
+        const auto& rhs = candidate.getConfig();
+        if (selected.getImplementationType() != candidate.getImplementationType() ||
+            lhs.inConfs.size() != rhs.inConfs.size() || lhs.outConfs.size() != rhs.outConfs.size())
+            return false;
+        auto portsMatch = [](const std::vector<PortConfig>& lhs, const std::vector<PortConfig>& rhs) {
+            for (size_t i = 0; i < lhs.size(); i++) {
+                if (rhs[i].inPlace >= 0 || lhs[i].desc->getPrecision() != rhs[i].desc->getPrecision() ||
+                    lhs[i].desc->getShape() != rhs[i].desc->getShape())
+                    return false;
+            }
+            return true;
+        };
+        return portsMatch(lhs.inConfs, rhs.inConfs) && portsMatch(lhs.outConfs, rhs.outConfs);
+    };
+
+    // Coordinate descent over the nodes: a node switches to the layout which minimizes the reorders bytes on its own
+    // edges with the neighbours layouts fixed. Every switch strictly decreases the total bytes, so the passes converge.
+    const size_t maxPasses = 4;
+    for (size_t pass = 0; pass < maxPasses; pass++) {
+        bool changed = false;
+        for (auto& node : graphNodes) {
+            if (one_of(node->getType(), Input, Output, Reorder, Concatenation, Split, Subgraph) || node->isConstant())
+                continue;
+            const auto& descs = node->getSupportedPrimitiveDescriptors();
+            const int selected = node->selectedPrimitiveDescriptorIndex;
+            if (descs.size() < 2 || selected < 0 || selected >= static_cast<int>(descs.size()))
+                continue;
+
+            int best = selected;
+            uint64_t bestBytes = nodeReordersBytes(node, descs[selected].getConfig());
+            for (int i = 0; i < static_cast<int>(descs.size()) && bestBytes > 0; i++) {
+                if (i == selected || !isLayoutAlternative(descs[selected], descs[i]))
+                    continue;
+                const auto bytes = nodeReordersBytes(node, descs[i].getConfig());
+                if (bytes < bestBytes) {
+                    bestBytes = bytes;
+                    best = i;
+                }
+            }
+            if (best != selected) {
+                node->selectPrimitiveDescriptorByIndex(best);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+}
+
+std::map<std::string, uint64_t> MKLDNNGraph::GetReordersReport() const {
+    std::map<std::string, uint64_t> report;
+    for (const auto& node : graphNodes) {
+        if (node->getType() != Reorder)
+            continue;
+        auto reorder = std::dynamic_pointer_cast<MKLDNNReorderNode>(node);
+        if (reorder && reorder->getOptimized()) {
+            report[node->getName()] = 0;
+        } else {
+            report[node->getName()] = reorderBytes(node->getParentEdgeAt(0)->getDesc(), node->getChildEdgeAt(0)->getDesc());
+        }
+    }
+    return report;
+}
+
+std::map<std::string, std::string> MKLDNNGraph::GetAmxNodesReport() const {
+    std::map<std::string, std::string> report;
+    for (const auto& node : graphNodes) {
+        const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+        if (!selectedPd)
+            continue;
+        const auto type = selectedPd->getImplementationType();
+        if ((type & impl_desc_type::amx) == impl_desc_type::amx)
+            report[node->getName()] = node->getPrimitiveDescriptorType();
     }
+    return report;
 }
 
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
@@ -387,8 +563,17 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 
 void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExtractConstantAndExecutableNodes");
+    std::unordered_map<MKLDNNIfNode*, std::pair<std::vector<MKLDNNNodePtr>, std::vector<MKLDNNNodePtr>>> lazyBranches;
+    const auto requiredConstantNodes = prepackedOutputs.empty() ? std::unordered_set<const MKLDNNNode*>{} : GetRequiredConstantNodes();
     for (const auto& graphNode : graphNodes) {
-        if (graphNode->isConstant()) {
+        const auto lazy = lazyNodes.find(graphNode.get());
+        if (lazy != lazyNodes.end()) {
+            auto& branches = lazyBranches[static_cast<MKLDNNIfNode*>(lazy->second.ifNode.get())];
+            if (graphNode->isExecutable())
+                (lazy->second.isThen ? branches.first : branches.second).emplace_back(graphNode);
+        } else if (graphNode->isConstant()) {
+            if (!prepackedOutputs.empty() && requiredConstantNodes.count(graphNode.get()) == 0)
+                continue;
             constantGraphNodes.emplace_back(graphNode);
         } else if (CPU_DEBUG_CAPS_ALWAYS_TRUE(graphNode->isExecutable())) {
             /* @todo
@@ -399,6 +584,116 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+    for (auto& branches : lazyBranches)
+        branches.first->setLazyNodes(std::move(branches.second.first), std::move(branches.second.second));
+
+    if (parallelBranches) {
+        for (const auto& node : executableGraphNodes) {
+            const size_t level = static_cast<size_t>(execLevels.at(node.get()));
+            if (executableGraphLevels.size() <= level)
+                executableGraphLevels.resize(level + 1);
+            executableGraphLevels[level].push_back(node);
+        }
+        // levels that contain only non executable nodes are not needed
+        executableGraphLevels.erase(std::remove_if(executableGraphLevels.begin(), executableGraphLevels.end(),
+                                                   [](const std::vector<MKLDNNNodePtr>& level) { return level.empty(); }),
+                                    executableGraphLevels.end());
+    }
+}
+
+std::unordered_set<const MKLDNNNode*> MKLDNNGraph::GetRequiredConstantNodes() const {
+    // a constant node is required by the non-constant consumers of its outputs not restored from the prepacked weights
+    // and by the required constant consumers, so the nodes are checked from the consumers to the producers
+    std::unordered_set<const MKLDNNNode*> required;
+    for (auto it = graphNodes.rbegin(); it != graphNodes.rend(); ++it) {
+        const auto& node = *it;
+        if (!node->isConstant())
+            continue;
+        bool isRequired = node->getChildEdges().empty();
+        for (size_t i = 0; i < node->getChildEdges().size() && !isRequired; i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            const auto child = edge->getChild();
+            isRequired = child->isConstant() ? required.count(child.get()) != 0
+                                             : prepackedOutputs.count({node.get(), edge->getInputNum()}) == 0;
+        }
+        if (isRequired)
+            required.insert(node.get());
+    }
+    return required;
+}
+
+bool MKLDNNGraph::CanExecuteBranchesInParallel() const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches || graphHasDynamicInput)
+        return false;
+    for (const auto& node : graphNodes) {
+        // dynamic nodes share the runtime parameters cache which is not thread safe,
+        // memory nodes have an implicit order which is not expressed by edges
+        if (node->isDynamicNode() || one_of(node->getType(), MemoryInput, MemoryOutput))
+            return false;
+    }
+    return true;
+#else
+    // nested parallel regions are effective only with the TBB threading runtime
+    return false;
+#endif
+}
+
+void MKLDNNGraph::InitExecutionLevels() {
+    execLevels.clear();
+    executableGraphLevels.clear();
+    parallelBranches = CanExecuteBranchesInParallel();
+    if (!parallelBranches)
+        return;
+
+    // graphNodes are sorted topologically, so all parents are visited before their children
+    for (const auto& node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parent = node->getParentEdgeAt(i)->getParent();
+            level = std::max(level, execLevels.at(parent.get()) + 1);
+        }
+        execLevels[node.get()] = level;
+    }
+}
+
+void MKLDNNGraph::InitLazyBranches() {
+    lazyNodes.clear();
+    // the memory of the levels is shared by their timestamps, which don't account for the execution by the If node
+    if (parallelBranches)
+        return;
+
+    auto canBeLazy = [](const MKLDNNNodePtr& node) {
+        return !node->isConstant() && !node->getChildEdges().empty() &&
+               !one_of(node->getType(), Input, Output, MemoryInput, MemoryOutput);
+    };
+
+    // graphNodes are sorted topologically, so all children are visited before their parents
+    for (auto ifIt = graphNodes.rbegin(); ifIt != graphNodes.rend(); ifIt++) {
+        const auto ifNode = std::dynamic_pointer_cast<MKLDNNIfNode>(*ifIt);
+        if (!ifNode)
+            continue;
+        for (const bool isThen : {true, false}) {
+            for (auto it = std::next(ifIt); it != graphNodes.rend(); it++) {
+                const auto& node = *it;
+                if (!canBeLazy(node) || lazyNodes.count(node.get()))
+                    continue;
+                bool onlyBranch = true;
+                for (size_t i = 0; i < node->getChildEdges().size() && onlyBranch; i++) {
+                    const auto edge = node->getChildEdgeAt(i);
+                    const auto child = edge->getChild();
+                    if (child == ifNode) {
+                        onlyBranch = ifNode->isBranchOnlyInput(edge->getOutputNum(), isThen);
+                    } else {
+                        const auto lazy = lazyNodes.find(child.get());
+                        onlyBranch = lazy != lazyNodes.end() && lazy->second.ifNode == ifNode && lazy->second.isThen == isThen;
+                    }
+                }
+                if (onlyBranch)
+                    lazyNodes[node.get()] = {ifNode, isThen};
+            }
+        }
+    }
 }
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
@@ -416,7 +711,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
             auto edgePtr = node->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = weightsCache->get(edgePtr->externalMemoryKey);
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -429,7 +724,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
-    for (const auto &node : constantGraphNodes) {
+    auto executeConstantNode = [&](const MKLDNNNodePtr &node, const mkldnn::stream& stream) {
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
@@ -442,7 +737,68 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
         } else {
             ExecuteNode(node, stream);
         }
+    };
+
+    if (!CanExecuteConstantsInParallel()) {
+        for (const auto &node : constantGraphNodes) {
+            executeConstantNode(node, stream);
+        }
+        return;
     }
+
+    // the constant nodes are grouped by their distance from the constant inputs, the nodes of one group are independent,
+    // write to the own output memory and hold the locks of the own shared weights only, so they are executed in parallel
+    std::unordered_map<const MKLDNNNode*, size_t> levels;
+    std::vector<std::vector<MKLDNNNodePtr>> constantLevels;
+    for (const auto &node : constantGraphNodes) {
+        size_t level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parentLevel = levels.find(node->getParentEdgeAt(i)->getParent().get());
+            if (parentLevel != levels.end())
+                level = std::max(level, parentLevel->second + 1);
+        }
+        levels[node.get()] = level;
+        if (constantLevels.size() <= level)
+            constantLevels.resize(level + 1);
+        constantLevels[level].push_back(node);
+    }
+
+    for (const auto &level : constantLevels) {
+        if (level.size() == 1) {
+            executeConstantNode(level.front(), stream);
+            continue;
+        }
+        parallel_for(level.size(), [&](size_t i) {
+            executeConstantNode(level[i], mkldnn::stream(eng));
+        });
+    }
+}
+
+bool MKLDNNGraph::CanExecuteConstantsInParallel() const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // dynamic nodes share the runtime parameters cache which is not thread safe
+    return std::none_of(constantGraphNodes.begin(), constantGraphNodes.end(),
+                        [](const MKLDNNNodePtr& node) { return node->isDynamicNode(); });
+#else
+    // nested parallel regions are effective only with the TBB threading runtime
+    return false;
+#endif
+}
+
+void MKLDNNGraph::PrepareConstantNodes() {
+    if (constantsReady.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(constantsGuard);
+    if (constantsReady.load(std::memory_order_relaxed))
+        return;
+    if (constantsTask.valid()) {
+        // rethrows the exception of the background preparation, if any
+        constantsTask.get();
+    } else {
+        ExecuteConstantNodesOnly();
+    }
+    constantsReady.store(true, std::memory_order_release);
 }
 
 static bool isReorderAvailable(const MemoryDesc& parentDesc, const MemoryDesc& childDesc, const mkldnn::engine& eng) {
@@ -532,6 +888,10 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+static inline bool isStateEdge(const MKLDNNEdgePtr& edge) {
+    return edge->getParent()->getType() == MemoryInput || edge->getChild()->getType() == MemoryOutput;
+}
+
 static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graphEdges) {
     typedef std::unordered_map<MKLDNNEdgePtr, size_t> edge_cluster_idx_map_t;
 
@@ -589,7 +949,26 @@ void MKLDNNGraph::AllocateWithReuse() {
     for (size_t i = 0; i < edge_clusters_count;) {
         auto &cluster = edge_clusters[i];
         bool erase = false;
+        // the pooled workspace content is not preserved between inferences,
+        // so the clusters which are filled with constant data once must be allocated separately
+        const bool persistent = workspacePool && std::any_of(cluster.begin(), cluster.end(), isConstOutput);
         for (auto &edge : cluster) {
+            // the prepacked weights of the export blob are consumed in place, their constant nodes aren't executed
+            if (prepackedWeights && edge->getStatus() == MKLDNNEdge::Status::NeedAllocation && isConstOutput(edge) &&
+                edge->getParent()->getType() != Input) {
+                const auto parent = edge->getParent();
+                if (auto memory = prepackedWeights->getConstantOutput(*parent, edge->getInputNum(), edge->getDesc())) {
+                    edge->reuse(memory);
+                    prepackedOutputs.emplace(parent.get(), edge->getInputNum());
+                    erase = true;
+                    continue;
+                }
+            }
+            if (persistent && edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
+                edge->allocate();
+                erase = true;
+                continue;
+            }
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation
                 && edge->getParent()->isConstant()) {
                 if (edge->getParent()->getType() == Input) {
@@ -614,13 +993,21 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // the lazy nodes are executed at the time of their If node
+    auto execTime = [this](const MKLDNNNodePtr& node) {
+        const auto lazy = lazyNodes.find(node.get());
+        return lazy != lazyNodes.end() ? lazy->second.ifNode->execIndex : node->execIndex;
+    };
+
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // nodes of the same level may be executed simultaneously,
+            // so the level is used as a timestamp to avoid sharing of memory between them
+            int e_start = parallelBranches ? execLevels.at(edge->getParent().get()) : execTime(edge->getParent());
+            int e_finish = parallelBranches ? execLevels.at(edge->getChild().get()) : execTime(edge->getChild());
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -635,11 +1022,12 @@ void MKLDNNGraph::AllocateWithReuse() {
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
+        bool isConst = false, isOutput = false, isInput = false, isState = false;
         for (auto &edge : edge_clusters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
+            isState  |= isStateEdge(edge);
         }
 
         if (reuse_io_tensors) {
@@ -651,6 +1039,11 @@ void MKLDNNGraph::AllocateWithReuse() {
                 box.finish = -1;
             }
         }
+        // the state memories are redirected to the states buffers, so they must not share data with other edges
+        if (isState) {
+            box.start = 0;
+            box.finish = -1;
+        }
 
         box.size = div_up(box.size, alignment);
     }
@@ -659,7 +1052,32 @@ void MKLDNNGraph::AllocateWithReuse() {
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    if (memoryContext) {
+        workspaceBuffer = memoryContext->allocate(total_size);
+        memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})),
+                             workspaceBuffer.get());
+    } else if (workspacePool) {
+        workspaceArena = workspacePool->createArena(total_size);
+        memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})),
+                             workspaceArena->getData());
+    } else {
+        memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    }
+    // the workspace pages are bound before the first touch, which can happen on a thread of the other NUMA node
+    // the NUMA node of the context memory takes precedence
+    if (numaNodeId >= 0 && !(memoryContext && memoryContext->getNumaNodeId() >= 0))
+        bindToNumaNode(memWorkspace->GetData(), total_size, numaNodeId);
+
+    // the workspace pages are faulted in at the compilation rather than on the first touch by an inference
+    if (config.latencyDeterministic && total_size != 0) {
+        auto* data = memWorkspace->GetData();
+        if (lockMemory(data, total_size)) {
+            workspaceLock = std::shared_ptr<void>(data, [total_size](void* data) { unlockMemory(data, total_size); });
+        } else if (!memoryContext && !workspacePool) {
+            // the memory is not shared, so just touched if it can't be locked
+            memWorkspace->FillZero();
+        }
+    }
 
     if (edge_clusters.empty())
         return;
@@ -688,6 +1106,97 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+// Assign(Concat(ReadValue, x)) along the outer axis of the planar state, so the new state starts with the bytes of the
+// current one. The consumers of the state view the storage then, so none of them may write into its input.
+static bool isAppendedState(const MKLDNNMemoryInputNode& inputNode, const MKLDNNEdgePtr& newStateEdge) {
+    const auto concat = std::dynamic_pointer_cast<MKLDNNConcatNode>(newStateEdge->getParent());
+    if (!concat || concat->isOptimized() || concat->getParentEdgeAt(0)->getParent().get() != &inputNode)
+        return false;
+
+    const auto& dims = concat->getOutputShapeAtPort(0).getDims();
+    if (!std::all_of(dims.begin(), dims.begin() + concat->getAxis(), [](Dim dim) { return dim == 1; }))
+        return false;
+
+    const auto& concatConfig = concat->getSelectedPrimitiveDescriptor()->getConfig();
+    const auto& stateDesc = inputNode.getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc;
+    if (!stateDesc->hasLayoutType(LayoutType::ncsp) || !concatConfig.outConfs[0].desc->hasLayoutType(LayoutType::ncsp) ||
+        stateDesc->getPrecision() != concatConfig.outConfs[0].desc->getPrecision())
+        return false;
+
+    for (const auto& edge : inputNode.getChildEdgesAtPort(0)) {
+        const auto child = edge->getChild();
+        if (child->getType() == Output)
+            return false;
+        const auto& config = child->getSelectedPrimitiveDescriptor()->getConfig();
+        const int port = edge->getOutputNum();
+        if (config.inConfs[port].inPlace >= 0 ||
+            std::any_of(config.outConfs.begin(), config.outConfs.end(), [port](const PortConfig& conf) { return conf.inPlace == port; }))
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGraph::InitStatesInPlace() {
+    // all the edges sharing the data of the edge, empty if some edge views the data partially (e.g. in-place Split)
+    auto getAliases = [this](const MKLDNNEdgePtr& edge) {
+        const auto& mem = edge->getMemory();
+        const auto base = static_cast<const uint8_t*>(mem.GetPrimitive().get_data_handle());
+        const auto size = mem.GetSize();
+
+        std::vector<MKLDNNEdgePtr> aliases;
+        for (const auto& graphEdge : graphEdges) {
+            const auto& graphMem = graphEdge->getMemoryPtr();
+            if (!graphMem || !graphMem->GetPrimitivePtr())
+                continue;
+            const auto ptr = static_cast<const uint8_t*>(graphMem->GetPrimitive().get_data_handle());
+            if (ptr == base) {
+                aliases.push_back(graphEdge);
+            } else if (ptr < base + size && base < ptr + graphMem->GetSize()) {
+                return std::vector<MKLDNNEdgePtr>{};
+            }
+        }
+        return aliases;
+    };
+
+    // the edges bound to the user blobs or filled with constants cannot be redirected to the state buffers
+    auto getMemories = [](const std::vector<MKLDNNEdgePtr>& edges) {
+        std::vector<MKLDNNMemoryPtr> memories;
+        for (const auto& edge : edges) {
+            if (edge->getParent()->getType() == Input || edge->getParent()->isConstant() || edge->getChild()->getType() == Output)
+                return std::vector<MKLDNNMemoryPtr>{};
+            memories.push_back(edge->getMemoryPtr());
+        }
+        return memories;
+    };
+
+    for (const auto& node : graphNodes) {
+        if (node->getType() != MemoryOutput)
+            continue;
+        auto outputNode = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(node);
+        auto inputNode = outputNode ? dynamic_cast<MKLDNNMemoryInputNode*>(outputNode->getInputNode()) : nullptr;
+        if (!inputNode || inputNode->getChildEdges().empty())
+            continue;
+
+        // the dynamic states grow in their storages, the appended ones aren't copied into the graph
+        if (inputNode->isDynamicNode()) {
+            if (isAppendedState(*inputNode, node->getParentEdgeAt(0)))
+                inputNode->setStateAppended();
+            continue;
+        }
+
+        const auto stateEdge = inputNode->getChildEdgeAt(0);
+        const auto newStateEdge = node->getParentEdgeAt(0);
+        if (!stateEdge->getMemory().getDesc().isCompatible(newStateEdge->getMemory().getDesc()) ||
+            stateEdge->getMemory().GetPrimitive().get_data_handle() == newStateEdge->getMemory().GetPrimitive().get_data_handle())
+            continue;
+
+        const auto stateMemories = getMemories(getAliases(stateEdge));
+        const auto newStateMemories = getMemories(getAliases(newStateEdge));
+        if (!stateMemories.empty() && !newStateMemories.empty())
+            inputNode->setStateMemories(stateMemories, newStateMemories);
+    }
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -753,11 +1262,28 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
-void MKLDNNGraph::PullOutputData(BlobMap &out) {
+MKLDNNGraph::OutputsMask MKLDNNGraph::GetOutputsMask(const std::vector<std::string>& names) const {
+    if (names.empty())
+        return {};
+
+    OutputsMask outputsMask(outputNodesMap.size(), false);
+    for (const auto& name : names) {
+        const auto output = outputNodesMap.find(name);
+        if (output == outputNodesMap.end())
+            IE_THROW() << "CPU execution graph doesn't contain output node with name: " << name;
+        outputsMask[std::distance(outputNodesMap.begin(), output)] = true;
+    }
+    return outputsMask;
+}
+
+void MKLDNNGraph::PullOutputData(BlobMap &out, const OutputsMask& outputsMask) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
 
+    size_t outputIdx = 0;
     for (auto &outputMap : outputNodesMap) {
+        if (!outputsMask.empty() && !outputsMask[outputIdx++])
+            continue;
         auto name = outputMap.first;
         auto node = outputMap.second;
         auto parentEdge = node->getParentEdgeAt(0);
@@ -851,25 +1377,140 @@ inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::st
     }
 }
 
-void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
+const MKLDNNGraph::ExecutableSubset& MKLDNNGraph::GetExecutableSubset(const OutputsMask& outputsMask) {
+    auto subset = outputsSubsets.find(outputsMask);
+    if (subset != outputsSubsets.end())
+        return subset->second;
+
+    // the nodes the selected outputs and the memory nodes (and the other sinks) depend on
+    std::unordered_set<const MKLDNNNode*> required;
+    std::vector<MKLDNNNodePtr> toVisit;
+    size_t outputIdx = 0;
+    for (const auto& output : outputNodesMap) {
+        if (outputsMask[outputIdx++])
+            toVisit.push_back(output.second);
+    }
+    for (const auto& node : graphNodes) {
+        if (node->getType() != Output && node->getChildEdges().empty())
+            toVisit.push_back(node);
+    }
+    while (!toVisit.empty()) {
+        const auto node = toVisit.back();
+        toVisit.pop_back();
+        if (!required.insert(node.get()).second)
+            continue;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            toVisit.push_back(node->getParentEdgeAt(i)->getParent());
+    }
+
+    auto isRequired = [&required](const MKLDNNNodePtr& node) {
+        return required.count(node.get()) != 0;
+    };
+    ExecutableSubset executable;
+    std::copy_if(executableGraphNodes.begin(), executableGraphNodes.end(), std::back_inserter(executable.nodes), isRequired);
+    for (const auto& level : executableGraphLevels) {
+        std::vector<MKLDNNNodePtr> requiredLevel;
+        std::copy_if(level.begin(), level.end(), std::back_inserter(requiredLevel), isRequired);
+        if (!requiredLevel.empty())
+            executable.levels.push_back(std::move(requiredLevel));
+    }
+    return outputsSubsets.emplace(outputsMask, std::move(executable)).first->second;
+}
+
+void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch, const OutputsMask& outputsMask) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
+    PrepareConstantNodes();
+
+    const bool allOutputs = outputsMask.empty() || std::all_of(outputsMask.begin(), outputsMask.end(), [](bool o) { return o; });
+    const ExecutableSubset* subset = allOutputs ? nullptr : &GetExecutableSubset(outputsMask);
+    const auto& executableNodes = subset ? subset->nodes : executableGraphNodes;
+    const auto& executableLevels = subset ? subset->levels : executableGraphLevels;
+
+    if (!request)
+        request = currentRequest;
+    CurrentRequestGuard requestGuard(request);
+
     mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.debugCaps.verbose);
-        PERF(node, config.collectPerfCounters);
+    const auto allocationsBefore = MKLDNNMemory::GetThreadAllocationsCount();
+    const auto preparationsBefore = MKLDNNNode::GetThreadPreparationsCount();
+    std::atomic<uint64_t> branchesAllocations{0}, branchesPreparations{0};
+    if (parallelBranches) {
+        for (const auto& level : executableLevels) {
+            if (request)
+                request->Checkpoint();
+            if (level.size() == 1) {
+                const auto& node = level.front();
+                VERBOSE(node, config.debugCaps.verbose);
+                PERF(node, config.collectPerfCounters);
+                ExecuteNode(node, stream);
+                continue;
+            }
+            parallel_for(level.size(), [&](size_t i) {
+                CurrentRequestGuard branchRequestGuard(request);
+                const auto& node = level[i];
+                const auto nodeAllocationsBefore = MKLDNNMemory::GetThreadAllocationsCount();
+                const auto nodePreparationsBefore = MKLDNNNode::GetThreadPreparationsCount();
+                PERF(node, config.collectPerfCounters);
+                ExecuteNode(node, mkldnn::stream(eng));
+                branchesAllocations += MKLDNNMemory::GetThreadAllocationsCount() - nodeAllocationsBefore;
+                branchesPreparations += MKLDNNNode::GetThreadPreparationsCount() - nodePreparationsBefore;
+            });
+        }
+    } else {
+        for (const auto& node : executableNodes) {
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+            if (request)
+                request->Checkpoint();
+            ExecuteNode(node, stream);
+        }
     }
+    lateAllocations += MKLDNNMemory::GetThreadAllocationsCount() - allocationsBefore + branchesAllocations;
+    latePreparations += MKLDNNNode::GetThreadPreparationsCount() - preparationsBefore + branchesPreparations;
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::WarmUp(const std::vector<std::map<std::string, VectorDims>>& shapes) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::WarmUp");
+    if (!IsReady() || !hasDynamicInput())
+        return;
+    // the inference advances the states of ReadValue/Assign, so the first user inference of the stateful graph would
+    // see the states of the zero inputs
+    const bool isStateful = std::any_of(graphNodes.begin(), graphNodes.end(), [](const MKLDNNNodePtr& node) {
+        return one_of(node->getType(), MemoryInput, MemoryOutput);
+    });
+    if (isStateful)
+        return;
+
+    const auto workspaceLease = LeaseWorkspace();
+    for (const auto& inputShapes : shapes) {
+        try {
+            for (const auto& input : inputNodesMap) {
+                const auto& node = input.second;
+                if (!node->isDynamicNode())
+                    continue;
+                const auto dims = inputShapes.find(input.first);
+                if (dims == inputShapes.end())
+                    IE_THROW() << "Shape of input " << input.first << " is not specified";
+                node->redefineOutputMemory({dims->second});
+                node->getChildEdgeAt(0)->getMemoryPtr()->FillZero();
+            }
+            Infer();
+        } catch (const std::exception&) {
+            // the shapes set is not compatible with the graph anymore, just skip it
+        }
+    }
+    // the warm up is a part of the compilation
+    lateAllocations = 0;
+    latePreparations = 0;
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1196,6 +1837,7 @@ bool MKLDNNGraph::InsertNode(MKLDNNNodePtr parent, MKLDNNNodePtr child, MKLDNNNo
         node->setQuantizedGraphFlag(true);
     }
     node->setRuntimeCache(rtParamsCache);
+    node->setBatchBuckets(config.batchBuckets);
 
     if (initNode) {
         node->getSupportedDescriptors();
@@ -1252,7 +1894,39 @@ void MKLDNNGraph::EnforceBF16() {
         searchForNodesToSkip(node, nodesToSkip);
     }
 
+    /* The mixed precision keeps the numerically sensitive nodes and the nodes requested by the config in FP32,
+     * together with the nodes following them up to the next significant node, so the precision changes only once
+     * at the input of the significant node */
+    static const std::unordered_set<Type, std::hash<int>> sensitiveNodes {
+        Softmax,
+        LogSoftmax,
+        MVN,
+        NormalizeL2,
+        Reduce,
+        Math,
+    };
+
+    std::unordered_set<MKLDNNNodePtr> nodesToKeepFP32;
+    std::function<void(const MKLDNNNodePtr&)> keepFP32;
+    keepFP32 = [&](const MKLDNNNodePtr& node) -> void {
+        if (!nodesToKeepFP32.insert(node).second) // node already visited
+            return;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto& child = node->getChildEdgeAt(i)->getChild();
+            if (!significantNodes.count(child->getType())) // stop at significant nodes
+                keepFP32(child);
+        }
+    };
+
     for (const auto& node : graphNodes) {
+        if ((config.bf16MixedPrecision && sensitiveNodes.count(node->getType())) || config.fp32Nodes.count(node->getName()))
+            keepFP32(node);
+    }
+
+    for (const auto& node : graphNodes) {
+        if (nodesToKeepFP32.count(node))
+            continue;
+
         if (nodesToSkip.count(node) && !node->enforceBF16evenForGraphTail)
             continue;
 
@@ -11,11 +11,19 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "cache/multi_cache.h"
+#include "mkldnn_workspace_pool.hpp"
+#include "mkldnn_prepacked_weights.hpp"
+#include "cpu_remote_context.h"
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <future>
+#include <mutex>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
@@ -55,9 +63,40 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
-    void PullOutputData(InferenceEngine::BlobMap &out);
 
-    void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
+    /**
+     * @brief The subset of the graph outputs, the flag per output in the order of outputNodesMap.
+     * The empty mask selects all the outputs.
+     */
+    using OutputsMask = std::vector<bool>;
+
+    /**
+     * @brief Makes the mask of the outputs of the given names, all the outputs are selected by the empty names
+     */
+    OutputsMask GetOutputsMask(const std::vector<std::string>& names) const;
+
+    /**
+     * @brief Copies the outputs of the mask to the blobs of the same names, the other blobs are not touched
+     */
+    void PullOutputData(InferenceEngine::BlobMap &out, const OutputsMask& outputsMask = {});
+
+    /**
+     * @brief Executes the graph checking the cancellation and the deadline of the request between the nodes.
+     * The nested graphs (e.g. the TensorIterator and Loop bodies) executed without the request are checked against
+     * the request of the outer graph, so a long node is aborted at the iteration granularity.
+     * The request may be preempted by the HIGH priority inferences of the other networks at the same checkpoints.
+     * Only the nodes the outputs of the mask depend on are executed, the memory nodes are always executed.
+     */
+    void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1, const OutputsMask& outputsMask = {});
+
+    /**
+     * @brief Runs the dynamic graph with zero filled inputs of each of the given input shapes sets, so the shape
+     * specific executors are created and stored in the runtime cache before the first user inference.
+     * The shapes sets the graph cannot be executed with are skipped, the stateful graphs are not warmed up.
+     * @param shapes
+     * sets of input shapes
+     */
+    void WarmUp(const std::vector<std::map<std::string, VectorDims>>& shapes);
 
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
         return graphNodes;
@@ -184,17 +223,98 @@ public:
         return graphHasDynamicInput;
     }
 
+    /**
+     * @brief Sets the runtime parameters cache to be used by the graph nodes instead of the graph's own one.
+     * Must be called before the graph creation.
+     */
+    void setSharedRuntimeCache(const MultiCachePtr& cache) {
+        sharedRtParamsCache = cache;
+    }
+
+    MultiCacheCPtr getRuntimeCache() const {
+        return rtParamsCache;
+    }
+
+    /**
+     * @brief Returns the reorders inserted into the graph with the estimated number of bytes each of them reads and
+     * writes per inference. The optimized out reorders are reported with zero bytes.
+     */
+    std::map<std::string, uint64_t> GetReordersReport() const;
+
+    /**
+     * @brief Returns the nodes whose selected primitives execute on the AMX tiles with the implementation types.
+     */
+    std::map<std::string, std::string> GetAmxNodesReport() const;
+
+    /**
+     * @brief Returns the number of the memory allocations ("ALLOCATIONS") and the primitives preparations ("PREPARATIONS")
+     * made by the inferences of the graph
+     */
+    std::map<std::string, uint64_t> GetLateAllocationsReport() const {
+        return {{"ALLOCATIONS", lateAllocations}, {"PREPARATIONS", latePreparations}};
+    }
+
+    /**
+     * @brief Sets the pool which controls the residency of the intermediate tensors workspace.
+     * Must be called before the graph creation.
+     */
+    void setWorkspacePool(const MKLDNNWorkspacePool::Ptr& pool) {
+        workspacePool = pool;
+    }
+
+    /**
+     * @brief Sets the context the intermediate tensors workspace is allocated from instead of the workspace pool.
+     * Must be called before the graph creation.
+     */
+    void setMemoryContext(const CPURemoteContext::Ptr& context) {
+        memoryContext = context;
+    }
+
+    /**
+     * @brief Sets the selected primitive descriptors and the prepacked weights read from the export blob, which are used
+     * instead of the descriptors selection and the constant nodes execution. Must be called before the graph creation.
+     */
+    void setPrepackedWeights(const MKLDNNPrepackedWeights::CPtr& weights) {
+        prepackedWeights = weights;
+    }
+
+    /**
+     * @brief Writes the selected primitive descriptors and the prepacked weights of the graph to the export blob
+     */
+    void ExportPrepackedWeights(std::ostream& stream);
+
+    /**
+     * @brief Sets the NUMA node the intermediate tensors workspace is bound to, -1 to not bind it.
+     * Must be called before the graph creation.
+     */
+    void setNumaNodeId(int id) {
+        numaNodeId = id;
+    }
+
+    /**
+     * @brief Keeps the intermediate tensors workspace resident while the returned object is alive
+     */
+    MKLDNNWorkspacePool::Lease LeaseWorkspace() const {
+        return MKLDNNWorkspacePool::Lease(workspaceArena);
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
     void ForgetGraphData() {
         status = NotReady;
+        if (constantsTask.valid())
+            constantsTask.wait();
+        constantsReady = false;
         eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
 
         inputNodesMap.clear();
         outputNodesMap.clear();
+        outputsSubsets.clear();
+        lazyNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        prepackedOutputs.clear();
         _normalizePreprocMap.clear();
     }
     Status status { NotReady };
@@ -207,6 +327,20 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    MKLDNNWorkspacePool::Ptr workspacePool;
+    MKLDNNWorkspacePool::Arena::Ptr workspaceArena;
+    CPURemoteContext::Ptr memoryContext;
+    std::shared_ptr<void> workspaceBuffer;
+    // unlocks the workspace locked in the RAM before it is released
+    std::shared_ptr<void> workspaceLock;
+    int numaNodeId = -1;
+
+    MKLDNNPrepackedWeights::CPtr prepackedWeights;
+    // the outputs of the constant nodes (the node and the port) restored from the prepacked weights
+    std::set<std::pair<const MKLDNNNode*, int>> prepackedOutputs;
+
+    uint64_t lateAllocations = 0;
+    uint64_t latePreparations = 0;
 
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
@@ -224,14 +358,25 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void MinimizeReorders();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    // makes the graph read and write the variable states in the buffers of the infer request without copies
+    void InitStatesInPlace();
     void ExtractConstantAndExecutableNodes();
+    std::unordered_set<const MKLDNNNode*> GetRequiredConstantNodes() const;
+    bool CanExecuteBranchesInParallel() const;
+    void InitExecutionLevels();
+    void InitLazyBranches();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
+    bool CanExecuteConstantsInParallel() const;
     void ExecuteConstantNodesOnly() const;
+    void PrepareConstantNodes();
+    struct ExecutableSubset;
+    const ExecutableSubset& GetExecutableSubset(const OutputsMask& outputsMask);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
@@ -248,7 +393,34 @@ private:
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
 
+    // when independent branches are executed in parallel, executable nodes are grouped by their
+    // distance (in edges) from the graph inputs: all nodes of one group depend only on the previous groups
+    bool parallelBranches = false;
+    std::unordered_map<const MKLDNNNode*, int> execLevels;
+    std::vector<std::vector<MKLDNNNodePtr>> executableGraphLevels;
+
+    // the nodes only one branch of an If node depends on are executed by the If node when the branch is selected
+    struct LazyBranch {
+        MKLDNNNodePtr ifNode;
+        bool isThen;
+    };
+    std::unordered_map<const MKLDNNNode*, LazyBranch> lazyNodes;
+
+    // the executable nodes (and levels) of the outputs subsets, built by the first inference of the subset
+    struct ExecutableSubset {
+        std::vector<MKLDNNNodePtr> nodes;
+        std::vector<std::vector<MKLDNNNodePtr>> levels;
+    };
+    std::map<OutputsMask, ExecutableSubset> outputsSubsets;
+
     MultiCachePtr rtParamsCache;
+    MultiCachePtr sharedRtParamsCache;
+
+    // the constant nodes may be executed after the graph creation (see Config::ConstantsPreparation), so the first
+    // inference executes them or waits for the background task, which is declared last to be finished first on destruction
+    std::atomic<bool> constantsReady{false};
+    std::mutex constantsGuard;
+    std::future<void> constantsTask;
 
     void EnforceBF16();
 };
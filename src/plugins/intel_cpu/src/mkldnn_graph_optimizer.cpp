@@ -14,6 +14,7 @@
 #include "nodes/mkldnn_deconv_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_mvn_node.h"
 #include <nodes/mkldnn_transpose_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
@@ -47,6 +48,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "mkldnn_itt.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -58,7 +60,17 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "SelectFullyConnectedSparseWeights");
+    SelectFullyConnectedSparseWeights(graph);
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "SelectFullyConnectedDynamicQuantization");
+    SelectFullyConnectedDynamicQuantization(graph);
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -142,10 +154,22 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseReduceAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndSimpleOperation");
+    FuseColorConvertAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvertAndEltwise");
+    FuseConvertAndEltwise(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseRnnSequenceLayers");
+    FuseRnnSequenceLayers(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "reshapeRnnSeq");
     reshapeRnnSeq(graph);
     graph.RemoveDroppedNodes();
@@ -643,6 +667,287 @@ static bool BF16QuantizeNodeFusing(const MKLDNNNodePtr& parentNode, const MKLDNN
             childNode->getOriginalOutputPrecisionAtPort(0));
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableFullyConnected = [](const MKLDNNNodePtr& node) {
+        return node->getType() == FullyConnected && !node->isDynamicNode() && node->getFusedWith().empty() &&
+               one_of(node->getOriginalInputPrecisionAtPort(0), Precision::FP32, Precision::BF16);
+    };
+
+    auto isDecompressionOperation = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Eltwise || node->getChildEdges().size() != 1 || !node->getFusedWith().empty())
+            return false;
+        if (node->getAlgorithm() == EltwisePowerStatic) {
+            const auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(node);
+            return eltwise && eltwise->getAlpha() == 1.0f && eltwise->getBeta() != 0.0f;
+        }
+        return one_of(node->getAlgorithm(), EltwiseSubtract, EltwiseMultiply) && node->getParentEdges().size() == 2;
+    };
+
+    // the constant operand of the decompression operations may be converted, e.g. the u8 zero points
+    auto getConstantOperand = [](const MKLDNNNodePtr& node) -> std::shared_ptr<MKLDNNInputNode> {
+        auto constant = node;
+        if (constant->getType() == Convert && constant->getChildEdges().size() == 1)
+            constant = constant->getParentEdgesAtPort(0)[0]->getParent();
+        auto input = std::dynamic_pointer_cast<MKLDNNInputNode>(constant);
+        if (!input || !input->isConstant() || input->getChildEdges().size() != 1 || !input->getMemoryPtr())
+            return nullptr;
+        if (!one_of(input->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::I8, Precision::U8))
+            return nullptr;
+        return input;
+    };
+
+    auto getConstantValues = [](const std::shared_ptr<MKLDNNInputNode>& input) {
+        const auto memory = input->getMemoryPtr();
+        const size_t size = memory->GetShape().getElementsCount();
+        std::vector<float> values(size);
+        switch (input->getOriginalOutputPrecisionAtPort(0)) {
+            case Precision::FP32: {
+                const auto* data = static_cast<const float*>(memory->GetPtr());
+                std::copy(data, data + size, values.begin());
+                break;
+            }
+            case Precision::I8: {
+                const auto* data = static_cast<const int8_t*>(memory->GetPtr());
+                std::copy(data, data + size, values.begin());
+                break;
+            }
+            default: {
+                const auto* data = static_cast<const uint8_t*>(memory->GetPtr());
+                std::copy(data, data + size, values.begin());
+                break;
+            }
+        }
+        return values;
+    };
+
+    // removes the edges of the nodes feeding the port, the port parent is either the constant or the converted constant
+    auto removeConstantOperand = [&graph](const MKLDNNNodePtr& node, size_t port) {
+        auto edge = node->getParentEdgesAtPort(port)[0];
+        auto parent = edge->getParent();
+        edge->drop();
+        graph.RemoveEdge(edge);
+        if (parent->getType() == Convert) {
+            auto convertEdge = parent->getParentEdgesAtPort(0)[0];
+            convertEdge->drop();
+            graph.RemoveEdge(convertEdge);
+        }
+    };
+
+    for (const auto& node : graphNodes) {
+        if (!isSuitableFullyConnected(node))
+            continue;
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fcNode)
+            IE_THROW() << "Cannot cast to FullyConnected node " << node->getName();
+
+        // FullyConnected <- [Reshape] <- Multiply/Subtract/PowerStatic... <- Convert <- Constant (i8/u8)
+        auto parent = node->getParentEdgesAtPort(1)[0]->getParent();
+        MKLDNNNodePtr reshape;
+        if (parent->getType() == Reshape && parent->getChildEdges().size() == 1) {
+            reshape = parent;
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        // the decompression operations from the FullyConnected to the Convert and the ports of their data inputs
+        std::vector<std::pair<MKLDNNNodePtr, size_t>> operations;
+        while (isDecompressionOperation(parent)) {
+            // the data input is either the previous decompression operation or the converted weights of the full shape
+            size_t dataPort = 0;
+            if (parent->getAlgorithm() == EltwiseMultiply) {
+                const auto input = parent->getParentEdgesAtPort(0)[0]->getParent();
+                if (input->getType() != Eltwise &&
+                    !(input->getType() == Convert && input->getOutputShapeAtPort(0) == parent->getOutputShapeAtPort(0)))
+                    dataPort = 1;
+            }
+            operations.emplace_back(parent, dataPort);
+            parent = parent->getParentEdgesAtPort(dataPort)[0]->getParent();
+        }
+        if (operations.empty() || parent->getType() != Convert || parent->getChildEdges().size() != 1)
+            continue;
+        const auto convert = parent;
+        const auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        const auto weightsPrecision = weights->getOriginalOutputPrecisionAtPort(0);
+        if (weights->getType() != Input || !weights->isConstant() || weights->getChildEdges().size() != 1 ||
+            !one_of(weightsPrecision, Precision::I8, Precision::U8))
+            continue;
+
+        const auto& weightsDims = weights->getOutputShapeAtPort(0).getStaticDims();
+        const auto& srcDims = node->getInputShapeAtPort(0).getStaticDims();
+        const size_t OC = node->getOutputShapeAtPort(0).getStaticDims().back();
+        const size_t IC = srcDims.size() == 3 ? srcDims[2] :
+                          std::accumulate(srcDims.begin() + 1, srcDims.end(), size_t{1}, std::multiplies<size_t>());
+        if (weightsDims.size() < 2 || weightsDims[0] != OC ||
+            std::accumulate(weightsDims.begin(), weightsDims.end(), size_t{1}, std::multiplies<size_t>()) != OC * IC)
+            continue;
+
+        // the constant operands are broadcasted to the weights, the innermost axis the values vary along defines the groups
+        struct Operand {
+            Algorithm algorithm;
+            std::vector<float> values;
+            VectorDims dims;
+        };
+        std::vector<Operand> operands;
+        size_t groupAxis = 0;
+        bool isSuitable = true;
+        for (auto it = operations.rbegin(); it != operations.rend() && isSuitable; it++) {
+            const auto& operation = it->first;
+            if (operation->getAlgorithm() == EltwisePowerStatic)
+                continue;
+            const auto constant = getConstantOperand(operation->getParentEdgesAtPort(1 - it->second)[0]->getParent());
+            if (!constant) {
+                isSuitable = false;
+                break;
+            }
+            auto dims = constant->getOutputShapeAtPort(0).getStaticDims();
+            if (dims.size() > weightsDims.size()) {
+                isSuitable = false;
+                break;
+            }
+            dims.insert(dims.begin(), weightsDims.size() - dims.size(), 1);
+            for (size_t i = 0; i < dims.size(); i++) {
+                if (dims[i] == 1)
+                    continue;
+                if (dims[i] != weightsDims[i])
+                    isSuitable = false;
+                groupAxis = std::max(groupAxis, i);
+            }
+            operands.push_back({operation->getAlgorithm(), getConstantValues(constant), dims});
+        }
+        if (!isSuitable)
+            continue;
+
+        const size_t groups = std::accumulate(weightsDims.begin() + 1, weightsDims.begin() + groupAxis + 1, size_t{1}, std::multiplies<size_t>());
+        if (!MKLDNNFullyConnectedNode::isDecompressionSupported(weightsPrecision, IC / groups))
+            continue;
+
+        // decompressed = weights * scale + shift, the operations are applied from the Convert to the FullyConnected
+        std::vector<float> scales(OC * groups, 1.0f);
+        std::vector<float> shifts(OC * groups, 0.0f);
+        auto operand = operands.begin();
+        for (auto it = operations.rbegin(); it != operations.rend(); it++) {
+            const auto& operation = it->first;
+            if (operation->getAlgorithm() == EltwisePowerStatic) {
+                const auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(operation);
+                for (size_t i = 0; i < scales.size(); i++) {
+                    scales[i] *= eltwise->getBeta();
+                    shifts[i] = shifts[i] * eltwise->getBeta() + eltwise->getGamma();
+                }
+                continue;
+            }
+
+            VectorDims strides(operand->dims.size(), 1);
+            for (int i = static_cast<int>(strides.size()) - 2; i >= 0; i--)
+                strides[i] = strides[i + 1] * operand->dims[i + 1];
+            for (size_t oc = 0; oc < OC; oc++) {
+                for (size_t g = 0; g < groups; g++) {
+                    // the coordinates of the group over the weights dimensions [1, groupAxis]
+                    size_t offset = operand->dims[0] == 1 ? 0 : oc * strides[0];
+                    size_t rest = g;
+                    for (size_t i = groupAxis; i >= 1; i--) {
+                        const size_t coordinate = rest % weightsDims[i];
+                        rest /= weightsDims[i];
+                        if (operand->dims[i] != 1)
+                            offset += coordinate * strides[i];
+                    }
+
+                    const float value = operand->values[offset];
+                    const size_t idx = oc * groups + g;
+                    if (operand->algorithm == EltwiseSubtract) {
+                        shifts[idx] -= scales[idx] * value;
+                    } else {
+                        scales[idx] *= value;
+                        shifts[idx] *= value;
+                    }
+                }
+            }
+            operand++;
+        }
+        if (std::all_of(shifts.begin(), shifts.end(), [](float shift) { return shift == 0.0f; }))
+            shifts.clear();
+
+        // Constant -> FullyConnected
+        auto dropped = operations;
+        if (reshape)
+            dropped.emplace(dropped.begin(), reshape, 0);
+        dropped.emplace_back(convert, 0);
+        for (const auto& operation : dropped) {
+            for (size_t port = 1; port < operation.first->getParentEdges().size(); port++)
+                removeConstantOperand(operation.first, operation.second == 0 ? port : 0);
+            graph.DropNode(operation.first);
+            node->addOriginalLayer(operation.first->getOriginalLayers());
+        }
+        fcNode->fuseDecompression(weights->getOutputShapeAtPort(0), weightsPrecision, std::move(scales), std::move(shifts), groups);
+    }
+}
+
+void MKLDNNGraphOptimizer::SelectFullyConnectedSparseWeights(MKLDNNGraph &graph) {
+    const float maxDensity = graph.getConfig().sparseWeightsDensity;
+    if (maxDensity <= 0.0f)
+        return;
+
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() != FullyConnected || node->isDynamicNode() || !node->getFusedWith().empty() ||
+            !one_of(node->getOriginalInputPrecisionAtPort(0), Precision::FP32, Precision::BF16))
+            continue;
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fcNode)
+            IE_THROW() << "Cannot cast to FullyConnected node " << node->getName();
+        if (fcNode->withDecompression())
+            continue;
+
+        const auto weights = std::dynamic_pointer_cast<MKLDNNInputNode>(node->getParentEdgesAtPort(1)[0]->getParent());
+        if (!weights || !weights->isConstant() || !weights->getMemoryPtr() ||
+            weights->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        const auto& srcDims = node->getInputShapeAtPort(0).getStaticDims();
+        const size_t OC = node->getOutputShapeAtPort(0).getStaticDims().back();
+        const size_t IC = srcDims.size() == 3 ? srcDims[2] :
+                          std::accumulate(srcDims.begin() + 1, srcDims.end(), size_t{1}, std::multiplies<size_t>());
+        const auto memory = weights->getMemoryPtr();
+        const size_t size = memory->GetShape().getElementsCount();
+        if (size != OC * IC || !MKLDNNFullyConnectedNode::isSparseWeightsSupported(IC))
+            continue;
+
+        const auto* data = static_cast<const float*>(memory->GetPtr());
+        const size_t nonZeros = size - std::count(data, data + size, 0.0f);
+        if (static_cast<float>(nonZeros) <= maxDensity * static_cast<float>(size))
+            fcNode->useSparseWeights();
+    }
+}
+
+void MKLDNNGraphOptimizer::SelectFullyConnectedDynamicQuantization(MKLDNNGraph &graph) {
+    if (!graph.getConfig().dynamicQuantization || !MKLDNNFullyConnectedNode::isDynamicQuantizationSupported())
+        return;
+
+    for (const auto& node : graph.GetNodes()) {
+        // the int8 networks are quantized statically already, bf16 is kept as is
+        if (node->getType() != FullyConnected || node->isDynamicNode() || !node->getFusedWith().empty() ||
+            node->getOriginalInputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fcNode)
+            IE_THROW() << "Cannot cast to FullyConnected node " << node->getName();
+        if (fcNode->withDecompression() || fcNode->withSparseWeights())
+            continue;
+
+        const auto weights = std::dynamic_pointer_cast<MKLDNNInputNode>(node->getParentEdgesAtPort(1)[0]->getParent());
+        if (!weights || !weights->isConstant() || !weights->getMemoryPtr() ||
+            weights->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        const auto& srcDims = node->getInputShapeAtPort(0).getStaticDims();
+        const size_t OC = node->getOutputShapeAtPort(0).getStaticDims().back();
+        const size_t IC = srcDims.size() == 3 ? srcDims[2] :
+                          std::accumulate(srcDims.begin() + 1, srcDims.end(), size_t{1}, std::multiplies<size_t>());
+        if (weights->getMemoryPtr()->GetShape().getElementsCount() != OC * IC)
+            continue;
+
+        fcNode->useDynamicQuantization();
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1436,6 +1741,96 @@ void MKLDNNGraphOptimizer::FuseReduceAndSimpleOperation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseColorConvertAndSimpleOperation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // the pre-processing like NV12toRGB -> Convert(u8 -> f32) -> Subtract -> Divide writes the normalized image at once
+    auto isSuitableParentNode = [](const MKLDNNNodePtr& node) {
+        return node->getType() == ColorConvert && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        if (childNode->getType() == Convert) {
+            // the converter just writes the precision of the Convert, so it isn't a fused operation
+            parentNode->setOriginalOutputPrecisionAtPort(0, childNode->getOriginalOutputPrecisionAtPort(0));
+            graph.DropNode(childNode);
+            continue;
+        }
+
+        childNode->fuseInto(parentNode);
+
+        auto parentEdges = childNode->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge == nullptr)
+                IE_THROW() << "Cannot get parent edge " << childNode->getName();
+            if (p_edge->getParent()->getType() == ColorConvert)
+                continue;
+
+            graph.RemoveEdge(p_edge);
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseConvertAndEltwise(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // the eltwise loads the 8-bit integers to fp32 exactly as the convert does, so the preprocessing like
+    // Convert(u8 -> f32) -> Subtract -> Divide reads the u8 image once instead of writing and reading the fp32 copy
+    auto isSuitableConvertNode = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Convert || node->isConstant() || node->getChildEdges().size() != 1 ||
+            node->getParentEdges().size() != 1)
+            return false;
+        const auto inPrc = node->getOriginalInputPrecisionAtPort(0);
+        const auto parent = node->getParentEdgesAtPort(0)[0]->getParent();
+        // the eltwise parent would compute the fused chain in fp32 without rounding to the integers in between
+        return one_of(inPrc, Precision::U8, Precision::I8) && node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+               parent->getType() != Eltwise;
+    };
+
+    auto isSuitableEltwiseNode = [](const MKLDNNNodePtr& node, size_t port) {
+        if (node->getType() != Eltwise || !node->getFusedWith().empty() ||
+            node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        // another fp32 input keeps the execution in fp32, so the integer input is converted before it is used
+        for (size_t i = 0; i < node->getOriginalInputsNumber(); i++) {
+            if (i != port && node->getOriginalInputPrecisionAtPort(i) == Precision::FP32)
+                return true;
+        }
+        return false;
+    };
+
+    for (auto &graphNode : graphNodes) {
+        if (!isSuitableConvertNode(graphNode))
+            continue;
+
+        const auto convertNode = graphNode;
+        const auto childEdge = convertNode->getChildEdgeAt(0);
+        const auto eltwiseNode = childEdge->getChild();
+        const auto port = static_cast<size_t>(childEdge->getOutputNum());
+        if (!isSuitableEltwiseNode(eltwiseNode, port))
+            continue;
+
+        eltwiseNode->setOriginalInputPrecisionAtPort(port, convertNode->getOriginalInputPrecisionAtPort(0));
+        graph.DropNode(convertNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -2005,6 +2400,116 @@ void MKLDNNGraphOptimizer::MergeTransposeAndReorder(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseRnnSequenceLayers(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isReachable = [](const MKLDNNNodePtr& from, const MKLDNNNodePtr& to) {
+        std::vector<MKLDNNNodePtr> nodes{from};
+        std::set<MKLDNNNode*> visited;
+        while (!nodes.empty()) {
+            auto node = nodes.back();
+            nodes.pop_back();
+            if (node == to)
+                return true;
+            if (!visited.insert(node.get()).second)
+                continue;
+            for (auto& childEdge : node->getChildEdges()) {
+                if (auto edge = childEdge.lock())
+                    nodes.push_back(edge->getChild());
+            }
+        }
+        return false;
+    };
+
+    // the next layer takes the output of the sequence through the reshape, which drops the axis of the direction
+    auto getNextLayer = [&](const std::shared_ptr<MKLDNNRNN>& rnnNode) -> std::shared_ptr<MKLDNNRNN> {
+        const auto dataEdges = rnnNode->getChildEdgesAtPort(0);
+        if (dataEdges.size() != 1)
+            return nullptr;
+        const auto reshapeNode = dataEdges[0]->getChild();
+        if (reshapeNode->getType() != Reshape || reshapeNode->getChildEdges().size() != 1 || dataEdges[0]->getOutputNum() != 0)
+            return nullptr;
+        for (size_t i = 1; i < reshapeNode->getParentEdges().size(); i++) {
+            if (!reshapeNode->getParentEdgeAt(i)->getParent()->isConstant())
+                return nullptr;
+        }
+
+        const auto nextEdge = reshapeNode->getChildEdgeAt(0);
+        auto nextNode = std::dynamic_pointer_cast<MKLDNNRNN>(nextEdge->getChild());
+        if (!nextNode || nextNode->getType() != RNNSeq || nextEdge->getOutputNum() != 0 || !rnnNode->canFuseNextLayer(*nextNode))
+            return nullptr;
+
+        auto dataDims = rnnNode->getOutputShapeAtPort(0).getStaticDims();
+        if (dataDims.size() != 4 || dataDims[1] != 1)
+            return nullptr;
+        dataDims.erase(dataDims.begin() + 1);
+        if (nextNode->getInputShapeAtPort(0).getStaticDims() != dataDims)
+            return nullptr;
+
+        // the states of the next layer mustn't depend on this one, else the fused node is in a cycle, and its sequence
+        // lengths, which are dropped, must be the constant
+        for (auto& parentEdge : nextNode->getParentEdges()) {
+            auto edge = parentEdge.lock();
+            if (!edge || edge->getOutputNum() == 0)
+                continue;
+            const bool isLayerPort = nextNode->getLayerInputPort(0, edge->getOutputNum()) >= 0;
+            if ((isLayerPort && isReachable(rnnNode, edge->getParent())) || (!isLayerPort && !edge->getParent()->isConstant()))
+                return nullptr;
+        }
+        return nextNode;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto rnnNode = std::dynamic_pointer_cast<MKLDNNRNN>(graphNodes[i]);
+        if (!rnnNode || rnnNode->getType() != RNNSeq || rnnNode->isDropped())
+            continue;
+
+        // the chain is fused into its first sequence, which is before the next ones in the topological order
+        while (auto nextNode = getNextLayer(rnnNode)) {
+            const size_t layer = rnnNode->getLayersCount();
+            rnnNode->fuseNextLayer(*nextNode);
+
+            auto reshapeNode = rnnNode->getChildEdgesAtPort(0)[0]->getChild();
+            auto reshapeParentEdges = reshapeNode->getParentEdges();
+            for (auto& parentEdge : reshapeParentEdges) {
+                auto edge = parentEdge.lock();
+                if (!edge)
+                    continue;
+                edge->drop();
+                graph.RemoveEdge(edge);
+            }
+
+            auto parentEdges = nextNode->getParentEdges();
+            for (auto& parentEdge : parentEdges) {
+                auto edge = parentEdge.lock();
+                if (!edge)
+                    continue;
+                const int port = rnnNode->getLayerInputPort(layer, edge->getOutputNum());
+                if (port >= 0) {
+                    MKLDNNEdgePtr newEdge(new MKLDNNEdge(edge->getParent(), rnnNode, edge->getInputNum(), port));
+                    rnnNode->addEdge(newEdge);
+                    graph.GetEdges().push_back(newEdge);
+                }
+                edge->drop();
+                graph.RemoveEdge(edge);
+            }
+
+            auto childEdges = nextNode->getChildEdges();
+            for (auto& childEdge : childEdges) {
+                auto edge = childEdge.lock();
+                if (!edge)
+                    continue;
+                const int port = edge->getInputNum() == 0 ? 0 : rnnNode->getLayerOutputPort(layer, edge->getInputNum());
+                MKLDNNEdgePtr newEdge(new MKLDNNEdge(rnnNode, edge->getChild(), port, edge->getOutputNum()));
+                rnnNode->addEdge(newEdge);
+                graph.GetEdges().push_back(newEdge);
+                edge->drop();
+                graph.RemoveEdge(edge);
+            }
+        }
+    }
+}
+
 void MKLDNNGraphOptimizer::reshapeRnnSeq(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
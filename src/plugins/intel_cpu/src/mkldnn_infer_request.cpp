@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <algorithm>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -47,6 +48,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::CreateInferRequest() {
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(execNetwork->_taskExecutor.get());
 
     // Allocate all input blobs if shape is static, delay allocation otherwise
     for (const auto& it : _networkInputs) {
@@ -74,7 +76,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            if (memoryNode->getStorage()) {
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, memoryNode->getStorage()));
+            } else {
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store, memoryNode->isStateInPlace()));
+            }
         }
     }
 }
@@ -108,15 +114,27 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
     }
 
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+
+    const auto& childEdge = graph->getInputNodeByName(inputName)->getChildEdgeAt(0);
+    if (!needConvert && childEdge->getMemory().GetData() == srcData) {
+        transferStatistics.bytesBound += inputBlob->byteSize();
+    } else {
+        transferStatistics.bytesCopied += inputBlob->byteSize();
+    }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
+void MKLDNNPlugin::MKLDNNInferRequest::PushInputData(bool prepared) {
     for (auto input : _inputs) {
         auto inputName = input.first;
         if (!_networkInputs[inputName]) {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << inputName;
         }
         auto inputBlob = input.second;
+        if (prepared) {
+            auto preparedInput = preparedInputs.find(inputName);
+            if (preparedInput != preparedInputs.end())
+                inputBlob = preparedInput->second;
+        }
         auto& inputTensorDesc = inputBlob->getTensorDesc();
         auto inPrec = inputTensorDesc.getPrecision();
         if (graph->hasMeanImageFor(inputName) && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
@@ -139,6 +157,43 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::PrepareInputs() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "PrepareInputs");
+    execDataPreprocessing(_inputs);
+
+    InferenceEngine::BlobMap converted;
+    for (const auto& input : _inputs) {
+        const auto networkInput = _networkInputs.find(input.first);
+        // the precision of the inputs with the mean values is chosen by the graph
+        if (networkInput == _networkInputs.end() || networkInput->second->getPreProcess().getNumberOfChannels() != 0)
+            continue;
+        const auto& tensorDesc = input.second->getTensorDesc();
+        const auto inPrec = normalizeToSupportedPrecision(tensorDesc.getPrecision());
+        if (inPrec == tensorDesc.getPrecision() || inPrec == InferenceEngine::Precision::UNSPECIFIED)
+            continue;
+        const void* srcData = input.second->cbuffer().as<const void *>();
+        if (srcData == nullptr)
+            continue;
+
+        const auto layout = tensorDesc.getLayout() == InferenceEngine::ANY ? networkInput->second->getLayout() : tensorDesc.getLayout();
+        const InferenceEngine::TensorDesc convertedDesc(inPrec, tensorDesc.getDims(), layout);
+        auto previous = preparedInputs.find(input.first);
+        auto& blob = converted[input.first];
+        if (previous != preparedInputs.end() && previous->second->getTensorDesc() == convertedDesc) {
+            blob = previous->second;
+        } else {
+            blob = make_blob_with_precision(inPrec, convertedDesc);
+            blob->allocate();
+        }
+        cpu_convert(srcData, blob->buffer().as<void *>(), tensorDesc.getPrecision(), inPrec, blob->size());
+    }
+    preparedInputs = std::move(converted);
+}
+
+InferenceEngine::ITaskExecutor::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetInputsExecutor() const {
+    return execNetwork->_inputsExecutor;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
@@ -149,8 +204,21 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
+                    // the graph grows the dynamic state in the storage of the request
+                    if (cur_node->getStorage()) {
+                        cur_node->bindStorage(std::static_pointer_cast<MKLDNNVariableState>(state)->GetStorage());
+                        continue;
+                    }
+
                     auto data_ptr = state->GetState()->cbuffer().as<void*>();
+                    // the graph reads the state and writes the new one in the state buffers directly
+                    if (cur_node->isStateInPlace()) {
+                        auto variableState = std::static_pointer_cast<MKLDNNVariableState>(state);
+                        cur_node->bindState(data_ptr, variableState->GetNextStateBuffer());
+                        continue;
+                    }
+
+                    auto cur_state_mem = cur_node->getStore();
                     auto data_size = state->GetState()->byteSize();
                     auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
@@ -171,6 +239,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
+                    if (cur_node->getStorage())
+                        continue;
+                    if (cur_node->isStateInPlace()) {
+                        std::static_pointer_cast<MKLDNNVariableState>(state)->Commit();
+                        continue;
+                    }
+
                     auto cur_state_mem = cur_node->getStore();
                     auto data_ptr = state->GetState()->cbuffer().as<void*>();
                     auto data_size = state->GetState()->byteSize();
@@ -197,29 +272,44 @@ void MKLDNNPlugin::MKLDNNInferRequest::redefineMemoryForInputNodes() {
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
+    InferImpl(false);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferImpl(bool inputsPrepared) {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
+    const auto workspaceLease = graph->LeaseWorkspace();
 
     ThrowIfCanceled();
 
-    if (graph->hasDynamicInput())
+    if (graph->hasDynamicInput()) {
         redefineMemoryForInputNodes();
+        if (execNetwork->_shapesProfile) {
+            ShapesProfile::InputShapes inputShapes;
+            for (const auto& input : _inputs) {
+                inputShapes[input.first] = input.second->getTensorDesc().getDims();
+            }
+            execNetwork->_shapesProfile->add(inputShapes);
+        }
+    }
 
-    execDataPreprocessing(_inputs);
+    if (!inputsPrepared)
+        execDataPreprocessing(_inputs);
 
     changeDefaultPtr();
 
     ThrowIfCanceled();
 
-    PushInputData();
+    PushInputData(inputsPrepared);
 
     if (memoryStates.size() != 0) {
         PushStates();
     }
 
-    graph->Infer(this, m_curBatch);
+    const auto outputsMask = graph->GetOutputsMask(GetRequestedOutputs());
+    graph->Infer(this, m_curBatch, outputsMask);
 
     if (memoryStates.size() != 0) {
         PullStates();
@@ -227,7 +317,20 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     ThrowIfCanceled();
 
-    graph->PullOutputData(_outputs);
+    graph->PullOutputData(_outputs, outputsMask);
+
+    const auto& requestedOutputs = GetRequestedOutputs();
+    for (const auto& output : _outputs) {
+        if (!requestedOutputs.empty() &&
+            std::find(requestedOutputs.begin(), requestedOutputs.end(), output.first) == requestedOutputs.end())
+            continue;
+        const auto& parentEdge = graph->getOutputNodeByName(output.first)->getParentEdgeAt(0);
+        if (parentEdge->getMemory().GetData() == output.second->cbuffer().as<const void*>()) {
+            transferStatistics.bytesBound += output.second->byteSize();
+        } else {
+            transferStatistics.bytesCopied += output.second->byteSize();
+        }
+    }
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
@@ -238,12 +341,33 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin:
     return perfMap;
 }
 
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::createIOBlob(const InferenceEngine::TensorDesc& desc) const {
+    InferenceEngine::Blob::Ptr blob;
+    if (execNetwork->_context) {
+        blob = make_blob_with_precision(desc, execNetwork->_context->getBlobAllocator());
+        blob->allocate();
+        if (blob->byteSize() != 0 && blob->buffer().as<void*>() == nullptr)
+            IE_THROW(NotAllocated) << "Cannot allocate the blob from the CPU context";
+    } else {
+        blob = make_blob_with_precision(desc);
+        blob->allocate();
+    }
+    return blob;
+}
+
 InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::string& name) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "GetBlob");
 
     if (!graph || !graph->IsReady())
         IE_THROW() << "Graph is not ready!";
 
+    // the blob validated by SetBlob is returned as is
+    for (const auto* blobs : {&_inputs, &_outputs}) {
+        auto it = blobs->find(name);
+        if (it != blobs->end() && isBlobValidated(name, it->second))
+            return it->second;
+    }
+
     InferenceEngine::Blob::Ptr data;
 
     const auto &inMap = graph->inputNodesMap;
@@ -261,11 +385,10 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 InferenceEngine::TensorDesc desc = _networkInputs[name]->getTensorDesc();
                 bool isDynamic = input->second->isDynamicNode();
 
-                _inputs[name] = make_blob_with_precision(desc);
-                _inputs[name]->allocate();
+                _inputs[name] = createIOBlob(desc);
 
                 if (!isDynamic &&
-                    desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
+                    isCompatibleForBinding(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc(), desc) &&
                         graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                     externalPtr[name] = _inputs[name]->buffer();
                 }
@@ -306,8 +429,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                         InferenceEngine::TensorDesc desc = _networkOutputs[name]->getTensorDesc();
                         desc.setPrecision(normalizeToSupportedPrecision(desc.getPrecision()));
 
-                        data = make_blob_with_precision(desc);
-                        data->allocate();
+                        data = createIOBlob(desc);
                     } else {
                         const auto &expectedTensorDesc = isDynamic ? InferenceEngine::TensorDesc(desc.getPrecision(),
                                                                                                  InferenceEngine::TensorDesc::getLayoutByRank(
@@ -342,7 +464,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                     }
 
                     _outputs[name] = data;
-                    if (!isDynamic && !externalPtr.count(name) && data->getTensorDesc() == MemoryDescUtils::convertToTensorDesc(desc) &&
+                    if (!isDynamic && !externalPtr.count(name) && isCompatibleForBinding(desc, data->getTensorDesc()) &&
                         !graph->getProperty().batchLimit) {
                         externalPtr[name] = data->buffer();
                     }
@@ -372,6 +494,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
 
     if (!data)
         IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
+    // the same blob set again is checked and bound already
+    if (isBlobValidated(name, data))
+        return;
     InferenceEngine::InputInfo::Ptr foundInput;
     InferenceEngine::DataPtr foundOutput;
     const bool isInput = findInputAndOutputBlobByName(name, foundInput, foundOutput);
@@ -416,6 +541,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // Stores the given blob as ROI blob. It will be used to fill in network input during
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
+            setBlobValidated(name, nullptr);
         } else {
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
@@ -457,6 +583,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
                 externalPtr.erase(name);
             }
             _inputs[name] = data;
+            // the output of the same name is bound by GetBlob
+            setBlobValidated(name, graph->hasOutputWithName(name) ? nullptr : data);
         }
     }
     if (foundOutput) {
@@ -493,15 +621,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         }
 
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
-        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && !graph->getProperty().batchLimit) {
+        if (!isDynamic && isCompatibleForBinding(desc, blobDesc) && !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        setBlobValidated(name, data);
     }
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::isCompatibleForBinding(const MemoryDesc& graphDesc, const InferenceEngine::TensorDesc& blobDesc) {
+    // Layout is only a label here: the blob may be bound whenever its blocking descriptor (order, block dims, strides
+    // and offsets) describes exactly the same memory as the graph edge, e.g. BLOCKED blob against NCHW edge.
+    if (blobDesc.getLayout() == InferenceEngine::Layout::ANY || !graphDesc.isDefined())
+        return false;
+    return graphDesc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc));
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
@@ -644,4 +781,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::ThrowIfCanceled() const {
     if (_asyncRequest != nullptr) {
         _asyncRequest->ThrowIfCanceled();
     }
+    const auto deadline = GetDeadline();
+    if (deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() > deadline) {
+        IE_THROW(InferCancelled) << "The inference deadline is exceeded";
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::Checkpoint() const {
+    ThrowIfCanceled();
+    if (streamsExecutor != nullptr) {
+        streamsExecutor->Preempt();
+    }
 }
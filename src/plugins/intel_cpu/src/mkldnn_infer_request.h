@@ -30,6 +30,11 @@ public:
 
     void InferImpl() override;
 
+    /**
+     * @brief Executes the inference with the inputs prepared by PrepareInputs() if @p inputsPrepared is true
+     */
+    void InferImpl(bool inputsPrepared);
+
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) override;
@@ -47,13 +52,47 @@ public:
     void SetAsyncRequest(MKLDNNAsyncInferRequest* asyncRequest);
 
     /**
-     * @brief If `_asyncRequest` is initialized throw exception with `InferenceEngine::INFER_CANCELLED` status if inference request is canceled
+     * @brief If `_asyncRequest` is initialized throw exception with `InferenceEngine::INFER_CANCELLED` status if inference request is canceled.
+     * The same exception is thrown if the deadline of the request is exceeded.
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief The checkpoint of the inference between the nodes: ThrowIfCanceled() and then the waiting HIGH priority
+     * tasks of the other networks are executed by the stream instead of this inference (see IStreamsExecutor::Preempt),
+     * which resumes after them.
+     */
+    void Checkpoint() const;
+
+    /**
+     * @brief Executes the preprocessing of the inputs and converts the inputs the graph doesn't take in their precisions
+     * for the next InferImpl(true). Doesn't use the graph, so any thread executes it.
+     */
+    void PrepareInputs();
+
+    /**
+     * @brief Returns the executor of the PrepareInputs() stage of the asynchronous requests, nullptr if it is disabled
+     */
+    InferenceEngine::ITaskExecutor::Ptr GetInputsExecutor() const;
+
+    /**
+     * @brief Amount of the input and output data passed between the user blobs and the graph memory
+     */
+    struct DataTransferStatistics {
+        size_t bytesCopied = 0;  // data copied (or converted) between the user blob and the graph memory
+        size_t bytesBound = 0;   // data the graph read or wrote directly in the user blob memory
+    };
+
+    /**
+     * @brief Returns the data transfer counters accumulated by this request since its creation
+     */
+    const DataTransferStatistics& GetDataTransferStatistics() const {
+        return transferStatistics;
+    }
+
 private:
     void CreateInferRequest();
-    void PushInputData();
+    void PushInputData(bool prepared);
     void PushStates();
     void PullStates();
     void redefineMemoryForInputNodes();
@@ -61,11 +100,19 @@ private:
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    // allocates the input or output blob from the context memory of the network, if any
+    InferenceEngine::Blob::Ptr createIOBlob(const InferenceEngine::TensorDesc& desc) const;
+    static bool isCompatibleForBinding(const MemoryDesc& graphDesc, const InferenceEngine::TensorDesc& blobDesc);
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    InferenceEngine::IStreamsExecutor*  streamsExecutor = nullptr;
+    DataTransferStatistics              transferStatistics;
+    // the inputs converted by PrepareInputs(), the blobs are reused by the next requests
+    InferenceEngine::BlobMap            preparedInputs;
 };
 }  // namespace MKLDNNPlugin
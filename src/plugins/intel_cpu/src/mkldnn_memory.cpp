@@ -58,9 +58,16 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
     Create(desc, data);
 }
 
+static thread_local uint64_t threadAllocationsCount = 0;
+
+uint64_t MKLDNNMemory::GetThreadAllocationsCount() {
+    return threadAllocationsCount;
+}
+
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
     if (data == nullptr) {
         prim.reset(new memory(desc, eng));
+        threadAllocationsCount++;
 
         size_t real_size = 0;
         if (desc.data.format_kind == dnnl_format_kind_wino)
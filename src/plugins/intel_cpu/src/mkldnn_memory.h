@@ -41,6 +41,12 @@ public:
     MKLDNNMemory(MKLDNNMemory&&) = default;
     MKLDNNMemory& operator= (MKLDNNMemory&&) = default;
 
+    /**
+     * @brief Returns the number of the memory allocations made by the calling thread, so the graph detects the
+     * allocations made during the inference
+     */
+    static uint64_t GetThreadAllocationsCount();
+
     const mkldnn::memory& GetPrimitive() const {
         return *prim;
     }
@@ -11,7 +11,36 @@ using namespace InferenceEngine;
 namespace MKLDNNPlugin {
 
 void  MKLDNNVariableState::Reset() {
+    if (storage) {
+        storage->resize(initialDims);
+        storage->getMemory()->FillZero();
+        return;
+    }
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    if (storage) {
+        if (!newState || newState->getTensorDesc().getPrecision() != storage->getDesc().getPrecision())
+            IE_THROW() << "Variable state " << GetName() << " cannot be set from a blob of a different precision";
+        // the incompatible dims are rejected by the descriptor of the state
+        storage->resize(newState->getTensorDesc().getDims());
+        const auto& memory = storage->getMemory();
+        if (newState->byteSize() != memory->GetSize())
+            IE_THROW() << "Variable state " << GetName() << " cannot be set from a blob of a different size";
+        cpu_memcpy(memory->GetData(), newState->cbuffer().as<const void*>(), memory->GetSize());
+        return;
+    }
+    if (!newState || newState->byteSize() != state->byteSize())
+        IE_THROW() << "Variable state " << GetName() << " cannot be set from a blob of a different size";
+    cpu_memcpy(state->buffer(), newState->cbuffer().as<const void*>(), state->byteSize());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    if (!storage)
+        return state;
+    const auto& memory = storage->getMemory();
+    return make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(memory->getDesc()), memory->GetData());
+}
+
 }  // namespace MKLDNNPlugin
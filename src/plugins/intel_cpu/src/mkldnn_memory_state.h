@@ -7,6 +7,7 @@
 #include "cpp_interfaces/interface/ie_ivariable_state_internal.hpp"
 #include "blob_factory.hpp"
 #include "mkldnn_memory.h"
+#include "mkldnn_state_storage.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
@@ -16,14 +17,64 @@ namespace MKLDNNPlugin {
 
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
+    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage, bool doubleBuffered = false) :
             InferenceEngine::IVariableStateInternal{name} {
         state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
         state->allocate();
         cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        if (doubleBuffered) {
+            nextState = make_blob_with_precision(state->getTensorDesc());
+            nextState->allocate();
+        }
+    }
+
+    /**
+     * @brief The state with the dynamic shape, it is kept in the own growable storage bound into the graph.
+     * The default state is zero filled and empty along the undefined dims.
+     */
+    MKLDNNVariableState(std::string name, const MKLDNNStateStorage::Ptr& storage) :
+            InferenceEngine::IVariableStateInternal{name}, storage(storage->cloneEmpty()),
+            initialDims(storage->getDesc().getShape().getMinDims()) {
+        Reset();
     }
 
     void Reset() override;
+
+    /**
+     * @brief Copies the new state into the own buffer, so the buffers bound into the graph stay owned by the state
+     */
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    /**
+     * @brief The dynamic state is the view on the storage, it is valid until the next inference or SetState()
+     */
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    /**
+     * @brief The storage of the dynamic state, nullptr for the static one
+     */
+    const MKLDNNStateStorage::Ptr& GetStorage() const {
+        return storage;
+    }
+
+    /**
+     * @brief The buffer the graph writes the new state to, nullptr if the state is copied in and out of the graph
+     */
+    void* GetNextStateBuffer() const {
+        return nextState ? nextState->buffer().as<void*>() : nullptr;
+    }
+
+    /**
+     * @brief Makes the new state written by the inference current, the buffer of the previous state receives the next one
+     */
+    void Commit() {
+        std::swap(state, nextState);
+    }
+
+private:
+    InferenceEngine::Blob::Ptr nextState;
+    MKLDNNStateStorage::Ptr storage;
+    VectorDims initialDims;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -55,6 +55,7 @@
 #include <ngraph/opsets/opset1.hpp>
 
 #include <dnnl_types.h>
+#include <common/primitive_hashing_utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
@@ -515,6 +516,12 @@ void MKLDNNNode::execute(mkldnn::stream strm) {
     }
 }
 
+static thread_local uint64_t threadPreparationsCount = 0;
+
+uint64_t MKLDNNNode::GetThreadPreparationsCount() {
+    return threadPreparationsCount;
+}
+
 void MKLDNNNode::executeDynamic(mkldnn::stream strm) {
     if (needShapeInfer()) {
         redefineOutputMemory(shapeInfer());
@@ -524,6 +531,7 @@ void MKLDNNNode::executeDynamic(mkldnn::stream strm) {
             IE_ASSERT(inputShapesDefined()) << "Can't prepare params for " << getTypeStr() << " node with name: " << getName() <<
                 " since the input shapes are not defined.";
             prepareParams();
+            threadPreparationsCount++;
         }
         executeDynamicImpl(strm);
     }
@@ -1417,14 +1425,39 @@ bool MKLDNNNode::needShapeInfer() const {
     return inputShapesModified();
 }
 
+size_t MKLDNNNode::ShapeInferKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = get_vector_hash(seed, dims);
+    }
+    return seed;
+}
+
+bool MKLDNNNode::ShapeInferKey::operator==(const ShapeInferKey& rhs) const {
+    return inputDims == rhs.inputDims;
+}
+
 std::vector<VectorDims> MKLDNNNode::shapeInfer() const {
+    ShapeInferKey key;
     std::vector<Shape> shapes;
+    bool cacheable = true;
     for (size_t i = 0; i < opToShapeInfer->get_input_size(); i++) {
         shapes.push_back(opToShapeInfer->get_input_partial_shape(i).rank().get_length() == 0 ? Shape{} :
                          getParentEdgesAtPort(i)[0]->getMemory().getDesc().getShape());
+        cacheable = cacheable && shapes.back().isStatic();
+        key.inputDims.push_back(cacheable ? shapes.back().getStaticDims() : VectorDims{});
     }
 
-    auto newOutputShapes = shapeInferGeneric(shapes);
+    // the generic shape inference depends on the input shapes only, the values of the constant inputs are fixed
+    auto newOutputShapes = cacheable ? shapeInferCache.get(key) : std::vector<VectorDims>{};
+    if (newOutputShapes.empty()) {
+        newOutputShapes = shapeInferGeneric(shapes);
+        if (cacheable) {
+            shapeInferCache.put(std::move(key), newOutputShapes);
+        }
+    }
 
     IE_ASSERT(newOutputShapes.size() == outputShapes.size());
 
@@ -30,6 +30,7 @@
 #include "cpu_shape.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
 
 namespace MKLDNNPlugin {
 
@@ -364,6 +365,12 @@ public:
 
     virtual void execute(mkldnn::stream strm);
     void executeDynamic(mkldnn::stream strm);
+
+    /**
+     * @brief Returns the number of the prepareParams() calls made by the calling thread from executeDynamic(), so the
+     * graph detects the primitives prepared during the inference
+     */
+    static uint64_t GetThreadPreparationsCount();
     void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
 
     virtual void initSupportedPrimitiveDescriptors();
@@ -599,6 +606,10 @@ public:
         rtParamsCache = cache;
     }
 
+    void setBatchBuckets(const std::vector<size_t>& buckets) {
+        batchBuckets = buckets;
+    }
+
 protected:
     bool canFuseSimpleOperation(const MKLDNNNodePtr& node) const;
 
@@ -768,6 +779,10 @@ protected:
         return rtParamsCache;
     }
 
+    const std::vector<size_t>& getBatchBuckets() const {
+        return batchBuckets;
+    }
+
     std::vector<VectorDims> lastInputDims = {};
 
     std::shared_ptr<ngraph::Node> opToShapeInfer;
@@ -794,6 +809,18 @@ private:
     PerfCounters profiling;
 
     MultiCachePtr rtParamsCache;
+    std::vector<size_t> batchBuckets;
+
+    // the output dims of the generic shape inference for the recent input dims, so the models which are executed with
+    // a few input shapes by turns don't infer the shapes of the ngraph operation on every inference
+    struct ShapeInferKey {
+        std::vector<VectorDims> inputDims;
+
+        size_t hash() const;
+        bool operator==(const ShapeInferKey& rhs) const;
+    };
+    static const size_t shapeInferCacheCapacity {16};
+    mutable LruCache<ShapeInferKey, std::vector<VectorDims>> shapeInferCache {shapeInferCacheCapacity};
 
     bool isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const;
 
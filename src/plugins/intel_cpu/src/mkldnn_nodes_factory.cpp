@@ -83,6 +83,7 @@
 #include "nodes/mkldnn_non_zero.h"
 #include "nodes/mkldnn_color_convert_node.h"
 #include "nodes/subgraph.h"
+#include "nodes/mkldnn_attention_node.h"
 
 #define MKLDNN_NODE(__prim, __type) \
     registerNodeIfRequired(MKLDNNPlugin, __prim, __type, MKLDNNNodeImpl<__prim>)
@@ -174,4 +175,5 @@ MKLDNNPlugin::MKLDNNNode::NodesFactory::NodesFactory()
     MKLDNN_NODE(MKLDNNNonZeroNode, NonZero);
     MKLDNN_NODE(MKLDNNSnippetNode, Subgraph);
     MKLDNN_NODE(MKLDNNColorConvertNode, ColorConvert);
+    MKLDNN_NODE(MKLDNNAttentionNode, Attention);
 }
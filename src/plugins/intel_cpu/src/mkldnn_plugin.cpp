@@ -16,6 +16,9 @@
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
 #include <fstream>
+#include <chrono>
+#include <algorithm>
+#include <cpp/ie_infer_request.hpp>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
@@ -23,6 +26,8 @@
 #include <nodes/list.hpp>
 #include <ie_ngraph_utils.hpp>
 
+#include <transformations/hash.hpp>
+#include <ngraph/pass/manager.hpp>
 #include <transformations/opset_conversions/convert_opset3_to_opset2.hpp>
 #include <transformations/opset_conversions/convert_opset2_to_opset1.hpp>
 
@@ -115,6 +120,7 @@
 #include "nodes/mkldnn_normalize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
+#include "ngraph_transformations/weights_decompression.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
@@ -142,10 +148,13 @@ Engine::~Engine() {
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT,
-                                               const bool _enableSnippets) {
+                                               const bool _enableSnippets, const bool _enableWeightsDecompression) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
+    if (_enableWeightsDecompression) {
+        manager.register_pass<MarkWeightsDecompression>();
+    }
 
     const bool useLpt =
             _enableLPT &&
@@ -517,7 +526,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                                       });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t ) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -531,14 +540,47 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets,
+                           const bool _enableWeightsDecompression, const bool _enableAttentionFusion) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets);
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, _enableWeightsDecompression);
+    ConvertToCPUSpecificOpset(nGraphFunc, _enableAttentionFusion);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
+    return CompileNetwork(network, orig_config, nullptr);
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr
+Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
+                           const std::shared_ptr<InferenceEngine::RemoteContext> &context,
+                           const std::map<std::string, std::string> &orig_config) {
+    return CompileNetwork(network, orig_config, CastToCPUContext(context));
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> Engine::CreateContext(const InferenceEngine::ParamMap& params) {
+    return std::make_shared<CPURemoteContext>(params);
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> Engine::GetDefaultContext(const InferenceEngine::ParamMap& /*params*/) {
+    std::lock_guard<std::mutex> lock{defaultContextMutex};
+    if (!defaultContext)
+        defaultContext = std::make_shared<CPURemoteContext>(InferenceEngine::ParamMap{});
+    return defaultContext;
+}
+
+CPURemoteContext::Ptr Engine::CastToCPUContext(const std::shared_ptr<InferenceEngine::RemoteContext>& context) {
+    auto cpuContext = std::dynamic_pointer_cast<CPURemoteContext>(context);
+    if (!cpuContext)
+        IE_THROW() << "Invalid remote context type. Expected the CPU context, got the context of the " <<
+                   (context ? context->getDeviceName() : std::string{"null"}) << " device";
+    return cpuContext;
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr
+Engine::CompileNetwork(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config,
+                       const CPURemoteContext::Ptr &context, const MKLDNNExecNetwork* original) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
 
     // verification of supported input
@@ -578,18 +620,26 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& weightsDecompressionProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION);
+    const bool enableWeightsDecompression = (weightsDecompressionProp != config.end() && weightsDecompressionProp->second == PluginConfigParams::YES)
+            || engConfig.weightsDecompression;
+    const auto& attentionFusionProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_ATTENTION_FUSION);
+    const bool enableAttentionFusion = (attentionFusionProp != config.end() && attentionFusionProp->second == PluginConfigParams::YES)
+            || engConfig.attentionFusion;
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, enableWeightsDecompression);
 
     // Here the OV perf modes are turned into specific settings (as we need the network for better params selection)
     const auto& mode = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT);
+    std::string hintToTune;
     // the mode may have just arrived to the LoadNetwork, or was set with the plugins' SetConfig
-    if (mode != config.end() || !engConfig.perfHintsConfig.ovPerfHint.empty()) {
+    if (!original && (mode != config.end() || !engConfig.perfHintsConfig.ovPerfHint.empty())) {
         const auto mode_name = (mode != config.end())
                                ? PerfHintsConfig::CheckPerformanceHintValue(mode->second) : engConfig.perfHintsConfig.ovPerfHint;
         //checking streams (to avoid overriding what user might explicitly set in the incoming config or previously via SetConfig)
         const auto streams = config.find(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS);
         if (streams == config.end() && !streamsSet) {
+            hintToTune = mode_name;
             if (mode_name == CONFIG_VALUE(LATENCY)) {
                 config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
             } else if (mode_name == CONFIG_VALUE(THROUGHPUT)) {
@@ -652,17 +702,172 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
            }
         }
     }
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    ConvertToCPUSpecificOpset(nGraphFunc, enableAttentionFusion);
 
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
-    conf.readProperties(config);
+    if (original) {
+        // the variant runs with the streams and the properties of the original, the hints are already applied
+        std::lock_guard<std::mutex> lock{original->_cfgMutex};
+        conf = original->_cfg;
+    } else {
+        conf.readProperties(config);
+    }
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
+    if (conf.hintsTuningTimeLimit > 0 && (hintToTune == CONFIG_VALUE(THROUGHPUT) || hintToTune == CONFIG_VALUE(LATENCY))) {
+        TuneStreamsForHint(network, clonedNetwork, hintToTune, conf);
+    }
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, context,
+                                                           original);
+    execNetwork->_source = original ? original->_source
+                                    : std::make_shared<MKLDNNExecNetwork::Source>(MKLDNNExecNetwork::Source{
+                                          InferenceEngine::details::cloneNetwork(network), orig_config});
+    return execNetwork;
+}
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+InferenceEngine::IExecutableNetworkInternal::Ptr
+Engine::ReshapeNetwork(const MKLDNNExecNetwork& network, const std::map<std::string, ov::PartialShape>& shapes) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ReshapeNetwork");
+    if (!network._source)
+        IE_THROW(NotImplemented) << "The imported CPU network " << network._name << " can't be reshaped, "
+                                 << "compile the model to add its variants of other input shapes";
+
+    // the clone shares the constants data with the source, so they are the same ones in the weights cache
+    auto reshapedNetwork = InferenceEngine::details::cloneNetwork(network._source->network);
+    reshapedNetwork.reshape(shapes);
+    auto execNetwork = CompileNetwork(reshapedNetwork, network._source->config, network._context, &network);
+
+    SetExeNetworkInfo(execNetwork, constMapCast(reshapedNetwork.getInputsInfo()), constMapCast(reshapedNetwork.getOutputsInfo()));
+    SetExeNetworkInfo(execNetwork, reshapedNetwork.getFunction());
+    return execNetwork;
+}
+
+namespace {
+template <typename T>
+void hash_combine(uint64_t& seed, const T& value) {
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// returns the number of the inferences per second completed by the @p requests running for the @p budget
+double MeasureInferencesPerSecond(const IExecutableNetworkInternal::Ptr& execNetwork, int requests, std::chrono::milliseconds budget) {
+    std::vector<IInferRequestInternal::Ptr> inferRequests;
+    for (int i = 0; i < requests; i++) {
+        inferRequests.push_back(execNetwork->CreateInferRequest());
+        // the first inference prepares the constants and the primitives, it's not measured
+        inferRequests.back()->Infer();
+    }
+
+    size_t completed = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto& request : inferRequests)
+        request->StartAsync();
+    bool stop = false;
+    while (!stop) {
+        for (auto& request : inferRequests) {
+            request->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+            completed++;
+            stop = stop || std::chrono::steady_clock::now() - start >= budget;
+            if (!stop)
+                request->StartAsync();
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return completed / elapsed.count();
+}
+}  // namespace
+
+void Engine::TuneStreamsForHint(const CNNNetwork& network, const CNNNetwork& clonedNetwork, const std::string& hint, Config& conf) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::TuneStreamsForHint");
+    const auto numCores = getNumberOfCPUCores();
+    const int numRequests = conf.perfHintsConfig.ovPerfHintNumRequests;
+
+    // the tuned configuration is valid for the same model, hint and machine only
+    uint64_t hash = 0;
+    ngraph::pass::Manager manager;
+    manager.register_pass<ov::pass::Hash>(hash);
+    manager.run_passes(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+    hash_combine(hash, hint);
+    hash_combine(hash, numRequests);
+    hash_combine(hash, static_cast<int>(dnnl::get_effective_cpu_isa()));
+    hash_combine(hash, numCores);
+    hash_combine(hash, parallel_get_max_threads());
+    hash_combine(hash, conf.enforceBF16);
+    hash_combine(hash, conf.lpTransformsMode == Config::LPTransformsMode::On);
+    const auto tuningKey = std::to_string(hash);
+    const auto tuningFile = conf.cache_dir.empty() ? std::string() : conf.cache_dir + "/" + tuningKey + ".cpu_hints";
+
+    auto apply = [&](const std::pair<int, int>& tuned) {
+        conf.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(tuned.first)},
+                             {PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(tuned.second)}});
+    };
+
+    std::lock_guard<std::mutex> lock(tunedStreamsMutex);
+    auto cached = tunedStreams.find(tuningKey);
+    if (cached != tunedStreams.end()) {
+        apply(cached->second);
+        return;
+    }
+    if (!tuningFile.empty()) {
+        std::ifstream file(tuningFile);
+        std::pair<int, int> tuned;
+        if (file >> tuned.first >> tuned.second && tuned.first > 0 && tuned.second >= 0) {
+            tunedStreams[tuningKey] = tuned;
+            apply(tuned);
+            return;
+        }
+    }
+
+    // the candidates around the heuristic choice, (streams, threads) where 0 threads means all of them
+    const int heuristicStreams = std::max(conf.streamExecutorConfig._streams, 1);
+    std::vector<std::pair<int, int>> candidates;
+    auto addCandidate = [&](int streams, int threads) {
+        if (hint == CONFIG_VALUE(THROUGHPUT) && numRequests > 0)
+            streams = std::min(streams, numRequests);
+        streams = std::max(streams, 1);
+        if (std::find(candidates.begin(), candidates.end(), std::make_pair(streams, threads)) == candidates.end())
+            candidates.emplace_back(streams, threads);
+    };
+    addCandidate(heuristicStreams, conf.streamExecutorConfig._threads);
+    if (hint == CONFIG_VALUE(THROUGHPUT)) {
+        addCandidate(numCores, 0);
+        addCandidate(numCores / 2, 0);
+        addCandidate(heuristicStreams * 2, 0);
+        addCandidate(heuristicStreams / 2, 0);
+        addCandidate(IStreamsExecutor::Config::GetDefaultNumStreams(), 0);
+    } else {
+        addCandidate(1, 0);
+        addCandidate(1, numCores);
+    }
+
+    const auto budget = std::chrono::milliseconds(conf.hintsTuningTimeLimit) / candidates.size();
+    std::pair<int, int> best = candidates.front();
+    double bestRate = 0.0;
+    for (const auto& candidate : candidates) {
+        Config candidateConf = conf;
+        candidateConf.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(candidate.first)},
+                                      {PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(candidate.second)}});
+        auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, candidateConf, extensionManager, weightsSharing);
+        execNetwork->setNetworkInputs(clonedNetwork.getInputsInfo());
+        execNetwork->setNetworkOutputs(clonedNetwork.getOutputsInfo());
+        // the latency is measured by a single request, the throughput by a request per stream
+        const int requests = hint == CONFIG_VALUE(LATENCY) ? 1 : candidate.first;
+        const double rate = MeasureInferencesPerSecond(execNetwork, requests, budget);
+        if (rate > bestRate) {
+            bestRate = rate;
+            best = candidate;
+        }
+    }
+
+    tunedStreams[tuningKey] = best;
+    if (!tuningFile.empty()) {
+        std::ofstream file(tuningFile);
+        file << best.first << " " << best.second << std::endl;
+    }
+    apply(best);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -707,6 +912,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
             METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
             METRIC_KEY(RANGE_FOR_STREAMS),
             METRIC_KEY(IMPORT_EXPORT_SUPPORT),
+            METRIC_KEY(CPU_WEIGHTS_RESIDENT_BYTES),
         };
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
@@ -756,6 +962,12 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
     } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
         IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == METRIC_KEY(CPU_WEIGHTS_RESIDENT_BYTES)) {
+        std::map<std::string, uint64_t> residentBytes;
+        for (const auto& item : weightsSharing.getResidentBytes()) {
+            residentBytes[item.first < 0 ? "SHARED" : "NUMA_" + std::to_string(item.first)] = item.second;
+        }
+        IE_SET_METRIC_RETURN(CPU_WEIGHTS_RESIDENT_BYTES, residentBytes);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
@@ -789,7 +1001,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
         const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16 && with_cpu_x86_avx512_core()));
-        Transformation(clonedNetwork, enableLPT, enableSnippets);
+        Transformation(clonedNetwork, enableLPT, enableSnippets, conf.weightsDecompression, conf.attentionFusion);
         auto ops = clonedNetwork.getFunction()->get_ordered_ops();
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
@@ -855,6 +1067,18 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
 
 InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istream& networkModel,
                                             const std::map<std::string, std::string>& config) {
+    return ImportNetworkImpl(networkModel, config, nullptr);
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istream& networkModel,
+                                            const std::shared_ptr<InferenceEngine::RemoteContext>& context,
+                                            const std::map<std::string, std::string>& config) {
+    return ImportNetworkImpl(networkModel, config, CastToCPUContext(context));
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetworkImpl(std::istream& networkModel,
+                                            const std::map<std::string, std::string>& config,
+                                            const CPURemoteContext::Ptr& context) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "ImportNetwork");
 
     CNNNetworkDeserializer deserializer(networkModel,
@@ -864,6 +1088,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
+    // the section follows the network in the blobs exported by this version of the plugin only
+    const auto prepackedWeights = MKLDNNPrepackedWeights::read(networkModel);
 
     Config conf = engConfig;
     conf.readProperties(config);
@@ -872,7 +1098,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing);
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing, context,
+                                                           nullptr, prepackedWeights);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -9,6 +9,8 @@
 
 #include <string>
 #include <map>
+#include <mutex>
+#include <utility>
 #include <unordered_map>
 #include <memory>
 #include <functional>
@@ -26,6 +28,15 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal>
+    LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
+                       const std::shared_ptr<InferenceEngine::RemoteContext> &context,
+                       const std::map<std::string, std::string> &config) override;
+
+    std::shared_ptr<InferenceEngine::RemoteContext> CreateContext(const InferenceEngine::ParamMap& params) override;
+
+    std::shared_ptr<InferenceEngine::RemoteContext> GetDefaultContext(const InferenceEngine::ParamMap& params) override;
+
     void AddExtension(const InferenceEngine::IExtensionPtr& extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
@@ -40,11 +51,43 @@ public:
     InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
                                                      const std::map<std::string, std::string>& config) override;
 
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
+                                                     const std::shared_ptr<InferenceEngine::RemoteContext>& context,
+                                                     const std::map<std::string, std::string>& config) override;
+
+    // compiles the variant of the @p network for other input @p shapes, see MKLDNNExecNetwork::Reshape
+    InferenceEngine::IExecutableNetworkInternal::Ptr ReshapeNetwork(const MKLDNNExecNetwork& network,
+                                                                    const std::map<std::string, ov::PartialShape>& shapes);
+
 private:
+    // compiles the network, the tensors memory is allocated from the @p context if it is not null,
+    // the variant of other input shapes of the @p original network is compiled with its configuration
+    InferenceEngine::IExecutableNetworkInternal::Ptr CompileNetwork(const InferenceEngine::CNNNetwork &network,
+                                                                    const std::map<std::string, std::string> &config,
+                                                                    const CPURemoteContext::Ptr &context,
+                                                                    const MKLDNNExecNetwork* original = nullptr);
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetworkImpl(std::istream& networkModel,
+                                                                       const std::map<std::string, std::string>& config,
+                                                                       const CPURemoteContext::Ptr& context);
+
+    static CPURemoteContext::Ptr CastToCPUContext(const std::shared_ptr<InferenceEngine::RemoteContext>& context);
+
+    // replaces the streams and threads chosen for the performance @p hint by the fastest measured configuration,
+    // the result is cached per model and machine (see CPU_HINTS_TUNING_TIME_LIMIT)
+    void TuneStreamsForHint(const InferenceEngine::CNNNetwork& network, const InferenceEngine::CNNNetwork& clonedNetwork,
+                            const std::string& hint, Config& conf);
+
     Config engConfig;
-    NumaNodesWeights weightsSharing;
+    NumaNodesWeights& weightsSharing = NumaNodesWeights::getProcessWide();
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
     bool streamsSet = false;
+    // the tuned (streams, threads) per the tuning key, complements the files in the cache dir
+    std::map<std::string, std::pair<int, int>> tunedStreams;
+    std::mutex tunedStreamsMutex;
+    // the context with the default allocator, created on the first request
+    CPURemoteContext::Ptr defaultContext;
+    std::mutex defaultContextMutex;
 };
 
 }  // namespace MKLDNNPlugin
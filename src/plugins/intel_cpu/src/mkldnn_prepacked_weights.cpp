@@ -0,0 +1,225 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_prepacked_weights.hpp"
+#include "mkldnn_graph.h"
+#include "utils/general_utils.h"
+
+#include <ie_mapped_memory_stream.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+
+constexpr char sectionMagic[16] = "CPU_PREPACKED_1";
+// the prepacked weights are aligned in the section like the weights allocated by the plugin
+constexpr size_t dataAlignment = 64;
+
+size_t alignedSize(size_t size) {
+    return div_up(size, dataAlignment) * dataAlignment;
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T readValue(std::istream& stream) {
+    T value{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "The prepacked weights of the CPU network are truncated";
+    return value;
+}
+
+void writeString(std::ostream& stream, const std::string& value) {
+    writeValue<uint64_t>(stream, value.size());
+    stream.write(value.data(), value.size());
+}
+
+std::string readString(std::istream& stream) {
+    std::string value(readValue<uint64_t>(stream), '\0');
+    stream.read(&value[0], value.size());
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "The prepacked weights of the CPU network are truncated";
+    return value;
+}
+
+// the descriptor search of these nodes is the most expensive one, their selection is a pure choice of the descriptor
+bool hasStoredDescriptor(const MKLDNNNode& node) {
+    return one_of(node.getType(), Convolution, Deconvolution, FullyConnected, MatMul);
+}
+
+std::string outputKey(const std::string& nodeName, int port) {
+    return nodeName + ":" + std::to_string(port);
+}
+
+// identifies the layout of the data exactly, an empty signature means the data can't be stored
+std::string descSignature(const MemoryDesc& desc) {
+    if (!desc.isDefined() || !(desc.getType() & MemoryDescType::Blocked))
+        return {};
+    const auto blocked = desc.as<BlockedMemoryDesc>();
+    std::ostringstream signature;
+    auto appendDims = [&signature](const VectorDims& dims) {
+        for (const auto dim : dims)
+            signature << dim << ',';
+        signature << ';';
+    };
+    signature << desc.getPrecision().name() << ';';
+    appendDims(desc.getShape().getStaticDims());
+    appendDims(blocked->getBlockDims());
+    appendDims(blocked->getOrder());
+    appendDims(blocked->getStrides());
+    appendDims(blocked->getOffsetPaddingToData());
+    signature << blocked->getOffsetPadding();
+    return signature.str();
+}
+
+}  // namespace
+
+void MKLDNNPrepackedWeights::write(std::ostream& stream, const MKLDNNGraph& graph) {
+    struct Output {
+        std::string key;
+        std::string descSignature;
+        const char* data;
+        size_t size;
+    };
+    std::vector<std::pair<std::string, SelectedDescriptor>> descriptors;
+    std::vector<Output> outputs;
+    std::unordered_set<std::string> storedOutputs;
+
+    for (const auto& node : graph.GetNodes()) {
+        const auto* selected = node->getSelectedPrimitiveDescriptor();
+        if (hasStoredDescriptor(*node) && selected) {
+            const auto index = static_cast<int>(selected - node->getSupportedPrimitiveDescriptors().data());
+            descriptors.push_back({node->getName(), {index, selected->getImplementationType()}});
+        }
+
+        // the constant inputs are the network constants, which are in the blob already
+        if (!node->isConstant() || node->getType() == Input)
+            continue;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            if (edge->getChild()->isConstant())
+                continue;
+            auto key = outputKey(node->getName(), edge->getInputNum());
+            if (!storedOutputs.insert(key).second)
+                continue;
+            const auto& memory = edge->getMemory();
+            auto signature = descSignature(memory.getDesc());
+            if (signature.empty())
+                continue;
+            outputs.push_back({std::move(key), std::move(signature), static_cast<const char*>(memory.GetPtr()),
+                               memory.getDesc().getCurrentMemSize()});
+        }
+    }
+
+    stream.write(sectionMagic, sizeof(sectionMagic));
+    writeValue<uint64_t>(stream, descriptors.size());
+    for (const auto& descriptor : descriptors) {
+        writeString(stream, descriptor.first);
+        writeValue<int32_t>(stream, descriptor.second.index);
+        writeValue<int64_t>(stream, static_cast<int64_t>(descriptor.second.implType));
+    }
+    size_t dataSize = 0;
+    writeValue<uint64_t>(stream, outputs.size());
+    for (const auto& output : outputs) {
+        writeString(stream, output.key);
+        writeString(stream, output.descSignature);
+        writeValue<uint64_t>(stream, output.size);
+        dataSize += alignedSize(output.size);
+    }
+    writeValue<uint64_t>(stream, dataSize);
+    const std::vector<char> padding(dataAlignment, 0);
+    for (const auto& output : outputs) {
+        stream.write(output.data, output.size);
+        stream.write(padding.data(), alignedSize(output.size) - output.size);
+    }
+}
+
+MKLDNNPrepackedWeights::Ptr MKLDNNPrepackedWeights::read(std::istream& stream) {
+    const auto start = stream.tellg();
+    char magic[sizeof(sectionMagic)] = {};
+    stream.read(magic, sizeof(magic));
+    if (!stream.good() || !std::equal(magic, magic + sizeof(magic), sectionMagic)) {
+        // the blob exported before the section was introduced
+        stream.clear();
+        stream.seekg(start);
+        return nullptr;
+    }
+
+    auto result = std::make_shared<MKLDNNPrepackedWeights>();
+    const auto descriptorsCount = readValue<uint64_t>(stream);
+    for (uint64_t i = 0; i < descriptorsCount; i++) {
+        auto name = readString(stream);
+        const auto index = readValue<int32_t>(stream);
+        const auto implType = static_cast<impl_desc_type>(readValue<int64_t>(stream));
+        result->selectedDescriptors[std::move(name)] = {index, implType};
+    }
+    size_t offset = 0;
+    const auto outputsCount = readValue<uint64_t>(stream);
+    for (uint64_t i = 0; i < outputsCount; i++) {
+        auto key = readString(stream);
+        auto signature = readString(stream);
+        const auto size = static_cast<size_t>(readValue<uint64_t>(stream));
+        result->constantOutputs[std::move(key)] = {std::move(signature), offset, size};
+        offset += alignedSize(size);
+    }
+
+    const auto dataSize = static_cast<size_t>(readValue<uint64_t>(stream));
+    if (dataSize == 0)
+        return result;
+    const auto dataOffset = static_cast<size_t>(stream.tellg());
+    if (auto mappedStream = dynamic_cast<MappedMemoryStream*>(&stream)) {
+        // the prepacked weights refer to the mapped cache entry rather than to a copy of it
+        result->data = mappedStream->makeBlob(dataOffset, dataSize);
+        stream.seekg(dataOffset + dataSize);
+    } else {
+        result->data = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {dataSize}, Layout::C));
+        result->data->allocate();
+        stream.read(result->data->buffer(), dataSize);
+    }
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "The prepacked weights of the CPU network are truncated";
+    return result;
+}
+
+int MKLDNNPrepackedWeights::getSelectedPrimitiveDescriptor(const MKLDNNNode& node) const {
+    if (!hasStoredDescriptor(node))
+        return -1;
+    const auto it = selectedDescriptors.find(node.getName());
+    if (it == selectedDescriptors.end())
+        return -1;
+    const auto& supported = node.getSupportedPrimitiveDescriptors();
+    const auto index = it->second.index;
+    if (index < 0 || static_cast<size_t>(index) >= supported.size() ||
+        supported[index].getImplementationType() != it->second.implType)
+        return -1;
+    return index;
+}
+
+MKLDNNMemoryPtr MKLDNNPrepackedWeights::getConstantOutput(const MKLDNNNode& node, int port, const MemoryDesc& desc) const {
+    const auto it = constantOutputs.find(outputKey(node.getName(), port));
+    if (it == constantOutputs.end() || !data)
+        return nullptr;
+    const auto& output = it->second;
+    if (output.descSignature != descSignature(desc) || output.size != desc.getCurrentMemSize())
+        return nullptr;
+
+    // the data is shared by the graphs of all the streams and is never written, so the padding isn't zeroed
+    const auto* ptr = data->cbuffer().as<const uint8_t*>() + output.offset;
+    auto memory = std::make_shared<MKLDNNMemory>(node.getEngine());
+    memory->Create(desc, ptr, false);
+    return memory;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_node.h"
+
+#include <ie_blob.h>
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNGraph;
+
+/**
+ * The results of the graph compilation stored in the export blob after the network: the selected primitive descriptors
+ * of the compute heavy nodes and the constant tensors consumed by the non-constant nodes, i.e. the weights reordered
+ * (prepacked) to the layouts of the selected primitives.
+ * The import restores them instead of selecting the primitive descriptors and executing the constant nodes, the prepacked
+ * weights of the memory mapped blob are used in place. Every entry is validated against the graph being compiled, so the
+ * mismatched ones (e.g. the blob is imported on another CPU or with another config) are ignored and compiled as usual.
+ *
+ * Is a thread safe, as it isn't changed after the reading
+ */
+class MKLDNNPrepackedWeights {
+public:
+    typedef std::shared_ptr<MKLDNNPrepackedWeights> Ptr;
+    typedef std::shared_ptr<const MKLDNNPrepackedWeights> CPtr;
+
+    /**
+     * Writes the section of the graph, the constant nodes of the graph must be executed already
+     */
+    static void write(std::ostream& stream, const MKLDNNGraph& graph);
+
+    /**
+     * Reads the section from the current position of the stream, returns nullptr and restores the position
+     * if there is no section
+     */
+    static Ptr read(std::istream& stream);
+
+    /**
+     * Returns the index of the stored primitive descriptor among the supported primitive descriptors of the node
+     * or -1 if there is no matching one
+     */
+    int getSelectedPrimitiveDescriptor(const MKLDNNNode& node) const;
+
+    /**
+     * Returns the memory over the stored data of the output port of the constant node
+     * or nullptr if there is no data with the descriptor
+     */
+    MKLDNNMemoryPtr getConstantOutput(const MKLDNNNode& node, int port, const MemoryDesc& desc) const;
+
+private:
+    struct SelectedDescriptor {
+        int index;
+        impl_desc_type implType;
+    };
+
+    struct ConstantOutput {
+        std::string descSignature;
+        size_t offset;  // in the data of the section
+        size_t size;
+    };
+
+    std::unordered_map<std::string, SelectedDescriptor> selectedDescriptors;
+    // by the name of the node and the output port
+    std::unordered_map<std::string, ConstantOutput> constantOutputs;
+    // the data of the constant outputs: the part of the mapped blob or the copy of the stream
+    InferenceEngine::Blob::Ptr data;
+};
+
+}  // namespace MKLDNNPlugin
@@ -3,6 +3,8 @@
 //
 #include "mkldnn_serialize.h"
 
+#include <ie_mapped_memory_stream.hpp>
+#include <openvino/op/constant.hpp>
 #include <openvino/pass/serialize.hpp>
 
 #include <pugixml.hpp>
@@ -150,7 +152,11 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     // read blob content
     _istream.seekg(hdr.consts_offset);
-    if (hdr.consts_size) {
+    auto mappedStream = dynamic_cast<InferenceEngine::MappedMemoryStream*>(&_istream);
+    if (hdr.consts_size && mappedStream) {
+        // the constants refer to the mapped cache entry rather than to a copy of it
+        dataBlob = mappedStream->makeBlob(hdr.consts_offset, hdr.consts_size);
+    } else if (hdr.consts_size) {
         dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
             InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
         dataBlob->allocate();
@@ -163,6 +169,12 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     _istream.read(const_cast<char*>(xmlString.c_str()), hdr.model_size);
 
     network = _cnn_network_builder(xmlString, std::move(dataBlob));
+    if (hdr.consts_size && mappedStream) {
+        for (const auto& op : network.getFunction()->get_ops()) {
+            if (ov::is_type<ov::op::v0::Constant>(op))
+                op->get_rt_info()[MKLDNNMappedConstantKey] = true;
+        }
+    }
 
     // Set input and output precisions
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
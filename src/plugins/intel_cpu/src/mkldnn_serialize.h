@@ -10,6 +10,10 @@
 
 namespace MKLDNNPlugin {
 
+// The rt_info key of the constants which refer to the blob mapped into the memory by the import (e.g. from a shared
+// memory file), the graph consumes them in place
+constexpr const char* MKLDNNMappedConstantKey = "MKLDNNMappedConstant";
+
 class CNNNetworkSerializer {
 public:
     CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager);
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_state_storage.h"
+#include "nodes/common/cpu_memcpy.h"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+
+#include <algorithm>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+// the smallest buffer, so the first tokens of the sequence don't reallocate it one by one
+constexpr size_t minCapacity = 4096;
+}  // namespace
+
+MKLDNNStateStorage::MKLDNNStateStorage(const mkldnn::engine& eng, MemoryDescPtr desc)
+        : eng(eng), desc(std::move(desc)), memory(std::make_shared<MKLDNNMemory>(eng)) {}
+
+void MKLDNNStateStorage::resize(const VectorDims& dims, size_t keepBytes) {
+    auto newDesc = desc->cloneWithNewDims(dims);
+    const auto size = newDesc->getCurrentMemSize();
+    if (!buffer || size > capacity) {
+        const auto newCapacity = std::max({size, 2 * capacity, minCapacity});
+        auto newBuffer = std::make_shared<MKLDNNMemory>(eng);
+        newBuffer->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::U8, Shape(VectorDims{newCapacity})));
+        if (buffer) {
+            const auto kept = std::min(keepBytes, memory->GetSize());
+            if (kept)
+                cpu_memcpy(newBuffer->GetData(), buffer->GetData(), kept);
+            retired.push_back(buffer);
+        }
+        buffer = newBuffer;
+        capacity = newCapacity;
+    }
+    memory->Create(std::move(newDesc), buffer->GetData(), false);
+}
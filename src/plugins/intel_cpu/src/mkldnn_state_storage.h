@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_memory.h"
+
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * The storage of the state with the dynamic shape (e.g. the key and value caches growing along the sequence axis).
+ * The capacity of the buffer grows geometrically, so the state growing by a few elements per inference is reallocated
+ * O(log n) times, and the memory of the state views the first bytes of the buffer with the current dims.
+ */
+class MKLDNNStateStorage {
+public:
+    typedef std::shared_ptr<MKLDNNStateStorage> Ptr;
+
+    /**
+     * @param desc the descriptor of the state, the dims may be undefined
+     */
+    MKLDNNStateStorage(const mkldnn::engine& eng, MemoryDescPtr desc);
+
+    /**
+     * @brief Redefines the dims of the state, the buffer is reallocated only if the state doesn't fit the capacity
+     * @param dims the new dims of the state
+     * @param keepBytes the number of the leading bytes of the state preserved by the reallocation
+     */
+    void resize(const VectorDims& dims, size_t keepBytes = 0);
+
+    /**
+     * @brief The memory of the state, it is redefined by resize()
+     */
+    const MKLDNNMemoryPtr& getMemory() const {
+        return memory;
+    }
+
+    const MemoryDesc& getDesc() const {
+        return *desc;
+    }
+
+    size_t getCapacity() const {
+        return capacity;
+    }
+
+    /**
+     * @brief Makes the storage of the same descriptor without a state, it is allocated by the first resize()
+     */
+    Ptr cloneEmpty() const {
+        return std::make_shared<MKLDNNStateStorage>(eng, desc);
+    }
+
+    /**
+     * @brief Releases the buffers replaced by the reallocations. They are kept since the graph memories may still view
+     * them until the end of the inference.
+     */
+    void releaseRetired() {
+        retired.clear();
+    }
+
+private:
+    mkldnn::engine eng;
+    MemoryDescPtr desc;
+    MKLDNNMemoryPtr buffer;
+    size_t capacity = 0;
+    std::vector<MKLDNNMemoryPtr> retired;
+    MKLDNNMemoryPtr memory;
+};
+
+}  // namespace MKLDNNPlugin
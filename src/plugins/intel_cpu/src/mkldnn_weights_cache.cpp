@@ -5,11 +5,25 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <algorithm>
 #include <memory>
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
+constexpr size_t MKLDNNWeightsSharing::minPruneSize;
+
+MKLDNNWeightsSharing::MKLDNNWeightsSharing(Ptr localCache, Ptr sharedCache, size_t replicationThreshold,
+                                           std::string keyPrefix, bool contentKeys)
+    : localCache(std::move(localCache))
+    , sharedCache(std::move(sharedCache))
+    , replicationThreshold(replicationThreshold)
+    , keyPrefix(std::move(keyPrefix))
+    , contentKeys(contentKeys)
+{
+    if (!this->localCache || !this->sharedCache)
+        IE_THROW() << "Weights cache can't be created without the local and shared caches";
+}
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
@@ -32,10 +46,31 @@ void MKLDNNWeightsSharing::MKLDNNSharedMemory::valid(bool b) {
     memory->valid.store(b, std::memory_order_release);
 }
 
+MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::makeSharedMemory(const MKLDNNMemoryInfo::Ptr& ptr,
+                                                                                    MKLDNNMemoryPtr newPtr) {
+    return std::make_shared<MKLDNNSharedMemory>(ptr->valid.load(std::memory_order_relaxed)
+                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
+                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+}
+
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate(
                             const std::string& key,
                             std::function<MKLDNNMemoryPtr(void)> create,
                             bool valid) {
+    if (localCache) {
+        const auto fullKey = keyPrefix + key;
+        if (auto found = localCache->find(fullKey))
+            return found;
+        if (auto found = sharedCache->find(fullKey))
+            return found;
+
+        // the memory size is known only after the creation, so concurrent creation of the same
+        // object is possible here, insert() keeps the first stored object in such case
+        MKLDNNMemoryPtr newPtr = create();
+        auto& cache = newPtr->GetSize() > replicationThreshold ? sharedCache : localCache;
+        return cache->insert(fullKey, newPtr, valid);
+    }
+
     std::unique_lock<std::mutex> lock(guard);
     auto found = sharedWeights.find(key);
 
@@ -47,14 +82,29 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
         newPtr = create();
         ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
         sharedWeights[key] = ptr;
+        pruneExpired();
     }
 
-    return std::make_shared<MKLDNNSharedMemory>(ptr->valid.load(std::memory_order_relaxed)
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    return makeSharedMemory(ptr, newPtr);
 }
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const std::string& key) const {
+    MKLDNNSharedMemory::Ptr found;
+    if (localCache) {
+        const auto fullKey = keyPrefix + key;
+        if (!(found = localCache->find(fullKey)))
+            found = sharedCache->find(fullKey);
+    } else {
+        found = find(key);
+    }
+
+    if (!found)
+        IE_THROW() << "Unknown shared memory with key " << key;
+
+    return found;
+}
+
+MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::find(const std::string& key) const {
     std::unique_lock<std::mutex> lock(guard);
     auto found = sharedWeights.find(key);
 
@@ -63,18 +113,85 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
 
     if (found == sharedWeights.end()
         || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock())))
-        IE_THROW() << "Unknown shared memory with key " << key;
+        return nullptr;
 
-    return std::make_shared<MKLDNNSharedMemory>(ptr->valid.load(std::memory_order_relaxed)
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    return makeSharedMemory(ptr, newPtr);
+}
+
+MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::insert(const std::string& key, MKLDNNMemoryPtr newPtr, bool valid) {
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = sharedWeights.find(key);
+
+    MKLDNNMemoryInfo::Ptr ptr;
+    MKLDNNMemoryPtr storedPtr;
+
+    if (found != sharedWeights.end()
+        && (ptr = found->second) && (storedPtr = ptr->sharedMemory.lock()))
+        return makeSharedMemory(ptr, storedPtr);
+
+    ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
+    sharedWeights[key] = ptr;
+    pruneExpired();
+
+    return makeSharedMemory(ptr, newPtr);
+}
+
+void MKLDNNWeightsSharing::pruneExpired() {
+    // the cache outlives the networks, so the entries of the destroyed networks are removed here. The scan is done
+    // when the number of the entries doubles, so the insertion stays amortized constant
+    if (sharedWeights.size() < pruneSize)
+        return;
+    for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+        if (!it->second || it->second->sharedMemory.expired())
+            it = sharedWeights.erase(it);
+        else
+            ++it;
+    }
+    pruneSize = std::max(minPruneSize, 2 * sharedWeights.size());
 }
 
-NumaNodesWeights::NumaNodesWeights() {
+size_t MKLDNNWeightsSharing::getResidentBytes() const {
+    std::unique_lock<std::mutex> lock(guard);
+    size_t total = 0;
+    for (const auto& item : sharedWeights) {
+        if (item.second) {
+            if (auto memory = item.second->sharedMemory.lock())
+                total += memory->GetSize();
+        }
+    }
+    return total;
+}
+
+size_t MKLDNNWeightsSharing::getEntriesCount() const {
+    std::unique_lock<std::mutex> lock(guard);
+    return sharedWeights.size();
+}
+
+NumaNodesWeights::NumaNodesWeights()
+    : _shared_cache(std::make_shared<MKLDNNWeightsSharing>()) {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
 }
 
+NumaNodesWeights& NumaNodesWeights::getProcessWide() {
+    static NumaNodesWeights processWide;
+    return processWide;
+}
+
+MKLDNNWeightsSharing::Ptr NumaNodesWeights::get(int numa_id, size_t replicationThreshold,
+                                                const std::string& networkKey, bool contentKey) {
+    return std::make_shared<MKLDNNWeightsSharing>(operator[](numa_id), _shared_cache, replicationThreshold,
+                                                  networkKey + "_", contentKey);
+}
+
+std::map<int, size_t> NumaNodesWeights::getResidentBytes() const {
+    std::map<int, size_t> result;
+    for (const auto& item : _cache_map)
+        result[item.first] = item.second->getResidentBytes();
+    result[-1] = _shared_cache->getResidentBytes();
+    return result;
+}
+
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
     auto found = _cache_map.find(numa_id);
     if (found == _cache_map.end())
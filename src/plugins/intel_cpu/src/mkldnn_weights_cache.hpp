@@ -69,6 +69,18 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    MKLDNNWeightsSharing() = default;
+
+    /**
+     * Creates a cache that doesn't store MKLDNNMemory objects by itself, but places the objects
+     * not bigger than replicationThreshold bytes to the localCache and the bigger ones to the sharedCache.
+     * All the keys are prefixed with keyPrefix, which identifies the network the objects belong to.
+     * contentKeys means keyPrefix is computed from the network content, so the objects may be shared
+     * with other networks having the same content.
+     */
+    MKLDNNWeightsSharing(Ptr localCache, Ptr sharedCache, size_t replicationThreshold,
+                         std::string keyPrefix = {}, bool contentKeys = false);
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
@@ -93,12 +105,44 @@ public:
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Returns the total size in bytes of the alive MKLDNNMemory objects stored in the cache
+     */
+    size_t getResidentBytes() const;
+
+    /**
+     * Returns the number of the entries stored in the cache, including the ones of the released objects
+     * which are not pruned yet
+     */
+    size_t getEntriesCount() const;
+
+    /**
+     * Returns true if the objects are shared with other networks, so the keys must not depend on
+     * anything but the objects content (e.g. on the addresses of the source data)
+     */
+    bool hasContentKeys() const { return contentKeys; }
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    MKLDNNSharedMemory::Ptr find(const std::string& key) const;
+    MKLDNNSharedMemory::Ptr insert(const std::string& key, MKLDNNMemoryPtr newPtr, bool valid);
+
+    static MKLDNNSharedMemory::Ptr makeSharedMemory(const MKLDNNMemoryInfo::Ptr& ptr, MKLDNNMemoryPtr newPtr);
+    // removes the entries of the released objects, must be called under the guard
+    void pruneExpired();
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
+    static constexpr size_t minPruneSize = 256;
+    size_t pruneSize = minPruneSize;
     static const SimpleDataHash simpleCRC;
+
+    Ptr localCache;
+    Ptr sharedCache;
+    size_t replicationThreshold = 0;
+    std::string keyPrefix;
+    bool contentKeys = false;
 };
 
 /**
@@ -110,11 +154,31 @@ class NumaNodesWeights {
 public:
     NumaNodesWeights();
 
+    /**
+     * Returns the collection shared by all the CPU plugin instances of the process
+     */
+    static NumaNodesWeights& getProcessWide();
+
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * Returns the cache of the network identified by networkKey to be used by the streams of the NUMA node.
+     * It keeps in the node's own cache only the weights not bigger than replicationThreshold bytes, the bigger weights
+     * are stored once in the cache shared between all the nodes. The maximal threshold value means the full replication.
+     */
+    MKLDNNWeightsSharing::Ptr get(int numa_id, size_t replicationThreshold,
+                                  const std::string& networkKey, bool contentKey = false);
+
+    /**
+     * Returns the number of bytes resident in every NUMA node cache (non negative keys) and
+     * in the cache shared between all the nodes (key -1)
+     */
+    std::map<int, size_t> getResidentBytes() const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    MKLDNNWeightsSharing::Ptr _shared_cache;
 };
 
 }  // namespace MKLDNNPlugin
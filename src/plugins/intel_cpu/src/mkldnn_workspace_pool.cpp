@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_workspace_pool.hpp"
+
+#include <algorithm>
+#include <ie_common.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+void* allocatePages(size_t size) {
+#ifdef _WIN32
+    return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return data == MAP_FAILED ? nullptr : data;
+#endif
+}
+
+void freePages(void* data, size_t size) {
+#ifdef _WIN32
+    VirtualFree(data, 0, MEM_RELEASE);
+#else
+    munmap(data, size);
+#endif
+}
+
+// Returns physical pages to the OS, the virtual address range stays valid
+void decommitPages(void* data, size_t size) {
+#ifdef _WIN32
+    VirtualFree(data, size, MEM_DECOMMIT);
+#else
+    madvise(data, size, MADV_DONTNEED);
+#endif
+}
+
+void recommitPages(void* data, size_t size) {
+#ifdef _WIN32
+    if (!VirtualAlloc(data, size, MEM_COMMIT, PAGE_READWRITE))
+        IE_THROW() << "Cannot commit memory for the CPU graph workspace";
+#else
+    // the pages are populated on the first access
+    (void)data;
+    (void)size;
+#endif
+}
+
+}  // namespace
+
+MKLDNNWorkspacePool::Arena::Arena(const std::shared_ptr<MKLDNNWorkspacePool>& pool, size_t size)
+    : pool(pool), size(size) {
+    if (size) {
+        data = allocatePages(size);
+        if (!data)
+            IE_THROW() << "Cannot allocate " << size << " bytes for the CPU graph workspace";
+    }
+}
+
+MKLDNNWorkspacePool::Arena::~Arena() {
+    if (auto poolPtr = pool.lock())
+        poolPtr->forget(this);
+    if (data)
+        freePages(data, size);
+}
+
+MKLDNNWorkspacePool::Lease::Lease(const Arena::Ptr& arena) : arena(arena) {
+    if (!arena)
+        return;
+    if (auto pool = arena->pool.lock())
+        pool->acquire(arena.get());
+}
+
+MKLDNNWorkspacePool::Lease::~Lease() {
+    if (!arena)
+        return;
+    if (auto pool = arena->pool.lock())
+        pool->release(arena.get());
+}
+
+MKLDNNWorkspacePool::Arena::Ptr MKLDNNWorkspacePool::createArena(size_t size) {
+    auto arena = std::make_shared<Arena>(shared_from_this(), size);
+    std::lock_guard<std::mutex> lock(guard);
+    // the arena is resident right after the creation since the graph initialization touches its memory
+    residentCount++;
+    idle.push_back(arena.get());
+    shrink();
+    return arena;
+}
+
+size_t MKLDNNWorkspacePool::getResidentCount() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return residentCount;
+}
+
+void MKLDNNWorkspacePool::acquire(Arena* arena) {
+    std::lock_guard<std::mutex> lock(guard);
+    if (arena->resident) {
+        idle.remove(arena);
+    } else {
+        recommitPages(arena->data, arena->size);
+        arena->resident = true;
+        residentCount++;
+    }
+    shrink();
+}
+
+void MKLDNNWorkspacePool::release(Arena* arena) {
+    std::lock_guard<std::mutex> lock(guard);
+    idle.push_back(arena);
+    shrink();
+}
+
+void MKLDNNWorkspacePool::forget(Arena* arena) {
+    std::lock_guard<std::mutex> lock(guard);
+    if (arena->resident) {
+        idle.remove(arena);
+        residentCount--;
+    }
+}
+
+void MKLDNNWorkspacePool::shrink() {
+    while (residentCount > capacity && !idle.empty()) {
+        auto arena = idle.front();
+        idle.pop_front();
+        if (arena->data)
+            decommitPages(arena->data, arena->size);
+        arena->resident = false;
+        residentCount--;
+    }
+}
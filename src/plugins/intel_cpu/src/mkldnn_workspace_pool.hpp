@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Pool of the intermediate tensors workspaces of several graphs (streams) of one executable network.
+ *
+ * Every graph keeps its own workspace at a fixed address, so no memory rebinding is needed between inferences.
+ * The pool limits the number of workspaces which stay resident in the physical memory: the graph leases its workspace
+ * for the time of the inference, and when the number of resident workspaces exceeds the pool capacity, the physical
+ * pages of the least recently used idle workspace are returned to the OS. Thus the resident memory is bounded by
+ * the number of requests being in flight at the same time rather than by the number of streams.
+ *
+ * The workspace content is not preserved between leases, so it must not contain data which outlives an inference.
+ *
+ * Is a thread safe
+ */
+class MKLDNNWorkspacePool : public std::enable_shared_from_this<MKLDNNWorkspacePool> {
+public:
+    typedef std::shared_ptr<MKLDNNWorkspacePool> Ptr;
+
+    class Arena {
+    public:
+        typedef std::shared_ptr<Arena> Ptr;
+
+        Arena(const std::shared_ptr<MKLDNNWorkspacePool>& pool, size_t size);
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        void* getData() const noexcept {
+            return data;
+        }
+
+        size_t getSize() const noexcept {
+            return size;
+        }
+
+    private:
+        std::weak_ptr<MKLDNNWorkspacePool> pool;
+        void* data = nullptr;
+        size_t size = 0;
+        bool resident = true;
+
+        friend class MKLDNNWorkspacePool;
+    };
+
+    /**
+     * RAII object which keeps the arena resident during the inference
+     */
+    class Lease {
+    public:
+        explicit Lease(const Arena::Ptr& arena);
+        Lease(Lease&& other) noexcept : arena(std::move(other.arena)) {}
+        ~Lease();
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+    private:
+        Arena::Ptr arena;
+    };
+
+    /**
+     * @param capacity maximum number of resident workspaces
+     */
+    explicit MKLDNNWorkspacePool(size_t capacity) : capacity(capacity) {}
+
+    Arena::Ptr createArena(size_t size);
+
+    size_t getResidentCount() const;
+
+private:
+    void acquire(Arena* arena);
+    void release(Arena* arena);
+    void forget(Arena* arena);
+    void shrink();
+
+    mutable std::mutex guard;
+    size_t capacity;
+    size_t residentCount = 0;
+    // idle resident arenas, the least recently used one is at the front
+    std::list<Arena*> idle;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,134 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "attention_fusion.hpp"
+#include "op/attention.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::AttentionFusion, "AttentionFusion", 0);
+
+namespace {
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+bool getScalar(const std::shared_ptr<ngraph::Node>& node, float& value) {
+    const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node);
+    if (!constant || constant->get_element_type() != ngraph::element::f32 || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+} // namespace
+
+MKLDNNPlugin::AttentionFusion::AttentionFusion() {
+    auto m_softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(ngraph::pattern::consumers_count(1));
+    auto m_value = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto m_matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({m_softmax, m_value});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+
+        auto qkv = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output[m_matmul].get_node_shared_ptr());
+        auto softmax = pattern_to_output[m_softmax].get_node_shared_ptr();
+        if (!qkv || qkv->get_transpose_a() || qkv->get_transpose_b() || transformation_callback(qkv)) {
+            return false;
+        }
+
+        const auto scores_rank = softmax->get_output_partial_shape(0).rank();
+        if (scores_rank.is_dynamic())
+            return false;
+        int64_t axis = 0;
+        if (const auto softmax_v1 = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(softmax)) {
+            axis = static_cast<int64_t>(softmax_v1->get_axis());
+        } else if (const auto softmax_v8 = std::dynamic_pointer_cast<ngraph::opset8::Softmax>(softmax)) {
+            axis = softmax_v8->get_axis();
+        }
+        if (axis < 0)
+            axis += scores_rank.get_length();
+        if (axis != scores_rank.get_length() - 1)
+            return false;
+
+        // walk from the Softmax input up to the Q x K MatMul
+        ngraph::NodeVector fused_ops{qkv, softmax};
+        auto node = softmax->get_input_node_shared_ptr(0);
+
+        ngraph::Output<ngraph::Node> mask;
+        bool with_mask = false;
+        if (ngraph::is_type<ngraph::opset1::Add>(node) && hasSingleConsumer(node)) {
+            const auto& parent0 = node->get_input_node_shared_ptr(0);
+            const auto& parent1 = node->get_input_node_shared_ptr(1);
+            const auto isScoresProducer = [](const std::shared_ptr<ngraph::Node>& n) {
+                return ngraph::is_type<ngraph::opset1::MatMul>(n) || ngraph::is_type<ngraph::opset1::Multiply>(n) ||
+                       ngraph::is_type<ngraph::opset1::Divide>(n);
+            };
+            const size_t scores_port = isScoresProducer(parent0) || !isScoresProducer(parent1) ? 0 : 1;
+            mask = node->input_value(1 - scores_port);
+            if (node->get_output_partial_shape(0) != node->get_input_partial_shape(scores_port) ||
+                mask.get_partial_shape().rank().is_dynamic() ||
+                mask.get_partial_shape().rank().get_length() > scores_rank.get_length() ||
+                mask.get_element_type() != ngraph::element::f32) {
+                return false;
+            }
+            with_mask = true;
+            fused_ops.push_back(node);
+            node = node->get_input_node_shared_ptr(scores_port);
+        }
+
+        float scale = 1.f;
+        float value = 0.f;
+        if ((ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Divide>(node)) && hasSingleConsumer(node)) {
+            const bool is_divide = ngraph::is_type<ngraph::opset1::Divide>(node);
+            size_t scores_port = 0;
+            if (getScalar(node->get_input_node_shared_ptr(1), value)) {
+                scores_port = 0;
+            } else if (!is_divide && getScalar(node->get_input_node_shared_ptr(0), value)) {
+                scores_port = 1;
+            } else {
+                return false;
+            }
+            if (is_divide && value == 0.f)
+                return false;
+            scale = is_divide ? 1.f / value : value;
+            fused_ops.push_back(node);
+            node = node->get_input_node_shared_ptr(scores_port);
+        }
+
+        auto qk = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node);
+        if (!qk || qk->get_transpose_a() || !hasSingleConsumer(qk)) {
+            return false;
+        }
+        fused_ops.push_back(qk);
+
+        const auto& query = qk->input_value(0);
+        const auto& key = qk->input_value(1);
+        const auto& value_input = qkv->input_value(1);
+        for (const auto& input : {query, key, value_input}) {
+            if (input.get_element_type() != ngraph::element::f32 || input.get_partial_shape().rank().is_dynamic() ||
+                input.get_partial_shape().rank().get_length() != scores_rank.get_length() || scores_rank.get_length() < 2) {
+                return false;
+            }
+        }
+
+        std::shared_ptr<ngraph::Node> attention;
+        if (with_mask) {
+            attention = std::make_shared<MKLDNNPlugin::AttentionNode>(query, key, value_input, mask, qk->get_transpose_b(), scale);
+        } else {
+            attention = std::make_shared<MKLDNNPlugin::AttentionNode>(query, key, value_input, qk->get_transpose_b(), scale);
+        }
+        if (attention->get_output_partial_shape(0) != qkv->get_output_partial_shape(0))
+            return false;
+
+        attention->set_friendly_name(qkv->get_friendly_name());
+        ngraph::copy_runtime_info(fused_ops, attention);
+        ngraph::replace_node(qkv, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_matmul, "AttentionFusion");
+    this->register_matcher(m, callback);
+}
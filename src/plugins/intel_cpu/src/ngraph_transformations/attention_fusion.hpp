@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fuses the attention core MatMul(Softmax(MatMul(Q, K) [* scale] [+ mask]), V) into AttentionNode,
+ * so the scores matrix is not materialized in memory.
+ */
+class AttentionFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    AttentionFusion();
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,16 +4,18 @@
 
 #include "convert_matmul_to_fc.hpp"
 #include "op/fully_connected.hpp"
+#include "weights_decompression.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
 MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -28,6 +30,10 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
         // So in case of adding new operations that takes matmul inputs we need keep update fc_input_a and fc_input_b.
         auto fc_input_a = pattern_map.at(activations_m);
         auto fc_input_b = pattern_map.at(weights_m);
+        // the compressed weights are decompressed by the FullyConnected node itself
+        WeightsDecompression decompression;
+        const bool with_decompression = !ngraph::is_type<ngraph::opset1::Constant>(fc_input_b.get_node()) &&
+                                        getWeightsDecompression(fc_input_b, decompression);
 
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
@@ -44,10 +50,14 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        if ((!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) && !with_decompression) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
+        // the decompression subgraph is transposed by its constants, which is possible for 2D weights only
+        if (with_decompression && (rank_b != 2 || (decompression.reshape && !matmul->get_transpose_b()))) {
+            return false;
+        }
         /*
          *  get_aligned_shapes function align two input shapes to have the same size and
          *  the same batch dimensions (last two dimensions are not comparable).
@@ -117,6 +127,44 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
             return transpose;
         };
 
+        /*
+         *  transpose_decompression function transposes the 2D weights decompression subgraph: the Transpose is applied
+         *  to the compressed weights, the zero points and the scales, which are folded, so the weights are kept compressed.
+         *  The 1D zero points and scales are broadcasted along the last dimension, so they are unsqueezed before.
+         */
+
+        auto transpose_decompression = [](const WeightsDecompression& decompression, ngraph::NodeVector& new_ops) {
+            auto transpose_constant = [](const ngraph::Output<ngraph::Node>& node) {
+                if (ngraph::shape_size(node.get_shape()) == 1) {
+                    return node;
+                }
+                ngraph::Output<ngraph::Node> input = node;
+                if (node.get_shape().size() == 1) {
+                    auto unsqueezed_shape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 1, -1 });
+                    input = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(node, unsqueezed_shape, false);
+                }
+                auto transpose_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 1, 0 });
+                return ngraph::Output<ngraph::Node>(ngraph::op::util::make_try_fold<ngraph::opset1::Transpose>(input, transpose_const));
+            };
+
+            auto weights = transpose_constant(decompression.weights->output(0));
+            auto convert = std::make_shared<ngraph::opset1::Convert>(weights, decompression.convert->get_destination_type());
+            convert->set_friendly_name(decompression.convert->get_friendly_name());
+            ov::disable_constant_folding(convert);
+            new_ops.push_back(convert);
+
+            ngraph::Output<ngraph::Node> decompressed = convert;
+            if (decompression.subtract) {
+                decompressed = std::make_shared<ngraph::opset1::Subtract>(decompressed, transpose_constant(decompression.zeroPoints));
+                decompressed.get_node_shared_ptr()->set_friendly_name(decompression.subtract->get_friendly_name());
+                new_ops.push_back(decompressed.get_node_shared_ptr());
+            }
+            decompressed = std::make_shared<ngraph::opset1::Multiply>(decompressed, transpose_constant(decompression.scales));
+            decompressed.get_node_shared_ptr()->set_friendly_name(decompression.multiply->get_friendly_name());
+            new_ops.push_back(decompressed.get_node_shared_ptr());
+            return decompressed;
+        };
+
         ngraph::NodeVector new_ops;
         bool success = true;
         ngraph::PartialShape shape_a_aligned, shape_b_aligned;
@@ -134,7 +182,9 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
         // to FullyConnected representation: [I, K] * [K, O] = [I, O]
 
         // Weights normalization
-        if (!matmul->get_transpose_b()) {
+        if (!matmul->get_transpose_b() && with_decompression) {
+            fc_input_b = transpose_decompression(decompression, new_ops);
+        } else if (!matmul->get_transpose_b()) {
             fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
             new_ops.push_back(fc_input_b.get_node_shared_ptr());
         }
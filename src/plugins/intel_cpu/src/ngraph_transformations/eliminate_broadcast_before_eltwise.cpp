@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "eliminate_broadcast_before_eltwise.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/op/util/binary_elementwise_arithmetic.hpp>
+#include <ngraph/op/util/binary_elementwise_comparison.hpp>
+#include <ngraph/op/util/binary_elementwise_logical.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include "transformations/utils/utils.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::EliminateBroadcastBeforeEltwise, "EliminateBroadcastBeforeEltwise", 0);
+
+MKLDNNPlugin::EliminateBroadcastBeforeEltwise::EliminateBroadcastBeforeEltwise() {
+    auto eltwise_m = ngraph::pattern::wrap_type<ngraph::op::util::BinaryElementwiseArithmetic,
+                                                ngraph::op::util::BinaryElementwiseComparison,
+                                                ngraph::op::util::BinaryElementwiseLogical>(ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        const auto eltwise = m.get_match_root();
+        if (eltwise->get_autob().m_type != ngraph::op::AutoBroadcastType::NUMPY)
+            return false;
+
+        const auto& output_shape = eltwise->get_output_shape(0);
+        bool rewritten = false;
+        for (size_t i = 0; i < eltwise->get_input_size(); i++) {
+            const auto broadcast = eltwise->get_input_node_shared_ptr(i);
+            // the explicit and pdpd modes align the data dims differently than the numpy broadcast of the eltwise
+            if (const auto broadcast_v1 = std::dynamic_pointer_cast<ngraph::opset1::Broadcast>(broadcast)) {
+                if (broadcast_v1->get_broadcast_spec().m_type != ngraph::op::AutoBroadcastType::NUMPY)
+                    continue;
+            } else if (const auto broadcast_v3 = std::dynamic_pointer_cast<ngraph::opset3::Broadcast>(broadcast)) {
+                const auto mode = broadcast_v3->get_broadcast_spec().m_type;
+                if (mode != ngraph::op::BroadcastType::NUMPY && mode != ngraph::op::BroadcastType::BIDIRECTIONAL)
+                    continue;
+            } else {
+                continue;
+            }
+
+            auto data = broadcast->input_value(0);
+            if (data.get_partial_shape().is_dynamic() || data.get_shape().size() > output_shape.size())
+                continue;
+
+            auto merged_shape = ngraph::PartialShape(data.get_shape());
+            const auto& other_shape = eltwise->get_input_partial_shape(1 - i);
+            if (!ngraph::PartialShape::broadcast_merge_into(merged_shape, other_shape, ngraph::op::AutoBroadcastType::NUMPY) ||
+                    merged_shape != output_shape)
+                continue;
+
+            // the ranks are aligned, so the node keeps the blocked and channels last layouts, the reshape is inplace
+            if (data.get_shape().size() < output_shape.size()) {
+                std::vector<int64_t> shape(output_shape.size() - data.get_shape().size(), 1);
+                shape.insert(shape.end(), data.get_shape().begin(), data.get_shape().end());
+                const auto shape_const = ngraph::opset1::Constant::create(ngraph::element::i64, { shape.size() }, shape);
+                const auto reshape = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(data, shape_const, false);
+                reshape->set_friendly_name(broadcast->get_friendly_name() + "/reshape");
+                ngraph::copy_runtime_info(broadcast, reshape);
+                data = reshape->output(0);
+            }
+
+            eltwise->input(i).replace_source_output(data);
+            rewritten = true;
+        }
+
+        return rewritten;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(eltwise_m, "EliminateBroadcastBeforeEltwise");
+    this->register_matcher(m, callback);
+}
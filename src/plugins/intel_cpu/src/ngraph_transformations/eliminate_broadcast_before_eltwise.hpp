@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+// Feeds the Eltwise with the data of its Broadcast inputs directly when the eltwise output shape doesn't change,
+// e.g. [B,1,S,1] * Broadcast([B,H,1,D] -> [B,H,S,D]), since the Eltwise node broadcasts any axes itself.
+// Unlike the common BroadcastElementwiseFusion, the other input doesn't need to have the broadcast output shape,
+// so both inputs may be broadcast, which isn't supported by the eltwise implementations of the other plugins.
+class EliminateBroadcastBeforeEltwise: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    EliminateBroadcastBeforeEltwise();
+};
+
+}  // namespace MKLDNNPlugin
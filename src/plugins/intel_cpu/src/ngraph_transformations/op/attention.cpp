@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "attention.hpp"
+
+MKLDNNPlugin::AttentionNode::AttentionNode(const ngraph::Output<Node>& Q,
+                                           const ngraph::Output<Node>& K,
+                                           const ngraph::Output<Node>& V,
+                                           bool transpose_k,
+                                           float scale)
+    : Op({Q, K, V}), m_transpose_k(transpose_k), m_scale(scale) {
+    validate_and_infer_types();
+}
+
+MKLDNNPlugin::AttentionNode::AttentionNode(const ngraph::Output<Node>& Q,
+                                           const ngraph::Output<Node>& K,
+                                           const ngraph::Output<Node>& V,
+                                           const ngraph::Output<Node>& mask,
+                                           bool transpose_k,
+                                           float scale)
+    : Op({Q, K, V, mask}), m_transpose_k(transpose_k), m_scale(scale) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::AttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 3) {
+        return std::make_shared<MKLDNNPlugin::AttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2), m_transpose_k, m_scale);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<MKLDNNPlugin::AttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                             m_transpose_k, m_scale);
+    }
+
+    throw ngraph::ngraph_error("Unsupported number of arguments for Attention operation");
+}
+
+void MKLDNNPlugin::AttentionNode::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 3 or 4.");
+
+    const auto& q_pshape = get_input_partial_shape(0);
+    const auto& k_pshape = get_input_partial_shape(1);
+    const auto& v_pshape = get_input_partial_shape(2);
+    const auto q_rank = q_pshape.rank();
+    if (q_rank.is_dynamic() || k_pshape.rank().is_dynamic() || v_pshape.rank().is_dynamic()) {
+        set_output_type(0, get_input_element_type(0), ngraph::PartialShape::dynamic());
+        return;
+    }
+
+    const auto rank = q_rank.get_length();
+    NODE_VALIDATION_CHECK(this,
+        rank >= 2 && k_pshape.rank().get_length() == rank && v_pshape.rank().get_length() == rank,
+        "Q, K and V must have the same rank not less than 2");
+
+    // the embedding dimension of Q and K, the sequence dimension of K and V
+    const auto& k_embedding = m_transpose_k ? k_pshape[rank - 1] : k_pshape[rank - 2];
+    const auto& k_sequence = m_transpose_k ? k_pshape[rank - 2] : k_pshape[rank - 1];
+    NODE_VALIDATION_CHECK(this,
+        q_pshape[rank - 1].compatible(k_embedding),
+        "Q and K embedding dimensions are incompatible");
+    NODE_VALIDATION_CHECK(this,
+        k_sequence.compatible(v_pshape[rank - 2]),
+        "K and V sequence dimensions are incompatible");
+
+    // batch dimensions are broadcasted as the MatMul ones
+    ngraph::PartialShape output_pshape(q_pshape);
+    for (int64_t i = 0; i < rank - 2; i++) {
+        for (const auto& pshape : {k_pshape, v_pshape}) {
+            if (output_pshape[i].is_static() && output_pshape[i].get_length() == 1) {
+                output_pshape[i] = pshape[i];
+            } else if (!(pshape[i].is_static() && pshape[i].get_length() == 1)) {
+                NODE_VALIDATION_CHECK(this,
+                    ngraph::Dimension::merge(output_pshape[i], output_pshape[i], pshape[i]),
+                    "Q, K and V batch dimensions are incompatible");
+            }
+        }
+    }
+    output_pshape[rank - 1] = v_pshape[rank - 1];
+
+    set_output_type(0, get_input_element_type(0), output_pshape);
+}
+
+bool MKLDNNPlugin::AttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    visitor.on_attribute("scale", m_scale);
+    return true;
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fused attention core: Softmax(scale * Q x K' + Mask) x V, where K' is K or transposed K.
+ * Inputs: Q [..., L, E], K [..., S, E] (transposed) or [..., E, S], V [..., S, Ev] and optional Mask
+ * broadcastable to the scores shape [..., L, S]. Output: [..., L, Ev].
+ */
+class AttentionNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Attention", "cpu_plugin_opset");
+
+    AttentionNode() = default;
+
+    AttentionNode(const ngraph::Output<Node> &Q,
+                  const ngraph::Output<Node> &K,
+                  const ngraph::Output<Node> &V,
+                  bool transpose_k,
+                  float scale);
+
+    AttentionNode(const ngraph::Output<Node> &Q,
+                  const ngraph::Output<Node> &K,
+                  const ngraph::Output<Node> &V,
+                  const ngraph::Output<Node> &mask,
+                  bool transpose_k,
+                  float scale);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    bool get_transpose_k() const { return m_transpose_k; }
+    float get_scale() const { return m_scale; }
+
+private:
+    bool m_transpose_k = false;
+    float m_scale = 1.f;
+};
+
+}  // namespace MKLDNNPlugin
@@ -133,8 +133,10 @@ bool isSuitableBinaryConvolutionParent(const std::shared_ptr<const Node> &node)
     return is_suitable_node && has_only_child;
 }
 bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
+    // MVN over the innermost dimension is tokenized by snippets together with the surrounding eltwise operations
+    const bool is_tokenizable_mvn = ov::is_type<ngraph::op::v6::MVN>(node) && snippets::pass::AppropriateForSubgraph(node);
     const bool is_suitable_node = ov::is_type<ngraph::op::v0::MVN>(node) ||
-                                  ov::is_type<ngraph::op::v6::MVN>(node) ||
+                                  (ov::is_type<ngraph::op::v6::MVN>(node) && !is_tokenizable_mvn) ||
                                   ov::is_type<ngraph::op::v0::NormalizeL2>(node) ||
                                   ov::is_type<ngraph::op::v0::Interpolate>(node) ||
                                   ov::is_type<ngraph::op::v4::Interpolate>(node) ||
@@ -157,6 +159,15 @@ bool isSuitableMatMulParent(const std::shared_ptr<const Node> &node) {
     const bool has_only_child = (out.size() == 1) && (out[0].get_target_inputs().size() == 1);
     return is_suitable_node && has_only_child;
 }
+// Softmax between two MatMuls is left for the AttentionFusion, see attention_fusion.cpp
+bool isSuitableAttentionSoftmax(const std::shared_ptr<const Node> &node) {
+    const bool is_suitable_node = ov::is_type<ngraph::op::v1::Softmax>(node) ||
+                                  ov::is_type<ngraph::op::v8::Softmax>(node);
+    const auto out = node->outputs();
+    const bool has_only_child = (out.size() == 1) && (out[0].get_target_inputs().size() == 1);
+    return is_suitable_node && has_only_child &&
+           ov::is_type<ngraph::op::MatMul>(out[0].get_target_inputs().begin()->get_node());
+}
 bool isSuitablePoolChild(const std::shared_ptr<const Node> &node) {
     const bool is_suitable_node = ov::is_type<ngraph::op::v1::MaxPool>(node);
     // has a single output, connected to a single child
@@ -315,6 +326,10 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
         } else if (isSuitableMatMulParent(node)) {
             SetNodeFusingType(node, NodeFusingType::FusedWithMatMul);
             continue;
+        } else if (isSuitableAttentionSoftmax(node)) {
+            SetNodeFusingType(node, NodeFusingType::FusedTerminator);
+            SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            continue;
         }
         for (const auto fusingChainType : getContinuableChains(node)) {
             if (isSuitableChildForFusingSimple(node)) {
@@ -0,0 +1,99 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include "utils/general_utils.h"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkWeightsDecompression, "MarkWeightsDecompression", 0);
+
+namespace {
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+bool isConstantOrConverted(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    if (ngraph::is_type<ngraph::opset1::Convert>(node))
+        node = node->get_input_node_shared_ptr(0);
+    return ngraph::is_type<ngraph::opset1::Constant>(node);
+}
+
+bool isCompressedData(const ngraph::Output<ngraph::Node>& output) {
+    const auto node = output.get_node_shared_ptr();
+    return ngraph::is_type<ngraph::opset1::Subtract>(node) ||
+           (ngraph::is_type<ngraph::opset1::Convert>(node) && node->get_input_element_type(0).is_integral());
+}
+} // namespace
+
+bool MKLDNNPlugin::getWeightsDecompression(const ngraph::Output<ngraph::Node>& output, WeightsDecompression& decompression) {
+    WeightsDecompression result;
+    auto node = output.get_node_shared_ptr();
+    if (auto reshape = ngraph::as_type_ptr<ngraph::opset1::Reshape>(node)) {
+        if (!ngraph::is_type<ngraph::opset1::Constant>(reshape->get_input_node_shared_ptr(1)) || !hasSingleConsumer(reshape))
+            return false;
+        result.reshape = reshape;
+        node = reshape->get_input_node_shared_ptr(0);
+    }
+
+    result.multiply = ngraph::as_type_ptr<ngraph::opset1::Multiply>(node);
+    if (!result.multiply || !hasSingleConsumer(result.multiply))
+        return false;
+    auto data = result.multiply->input_value(0);
+    result.scales = result.multiply->input_value(1);
+    if (!isCompressedData(data))
+        std::swap(data, result.scales);
+    if (!isCompressedData(data) || !isConstantOrConverted(result.scales))
+        return false;
+
+    node = data.get_node_shared_ptr();
+    if (auto subtract = ngraph::as_type_ptr<ngraph::opset1::Subtract>(node)) {
+        if (!hasSingleConsumer(subtract) || !isConstantOrConverted(subtract->input_value(1)))
+            return false;
+        result.subtract = subtract;
+        result.zeroPoints = subtract->input_value(1);
+        node = subtract->get_input_node_shared_ptr(0);
+    }
+
+    result.convert = ngraph::as_type_ptr<ngraph::opset1::Convert>(node);
+    if (!result.convert || !hasSingleConsumer(result.convert))
+        return false;
+    result.weights = ngraph::as_type_ptr<ngraph::opset1::Constant>(result.convert->get_input_node_shared_ptr(0));
+    if (!result.weights || !one_of(result.weights->get_element_type(),
+                                   ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4))
+        return false;
+
+    // the zero points and the scales must be broadcasted to the weights, not vice versa
+    const auto& weightsShape = result.convert->get_output_partial_shape(0);
+    if (result.multiply->get_output_partial_shape(0) != weightsShape ||
+        (result.subtract && result.subtract->get_output_partial_shape(0) != weightsShape))
+        return false;
+
+    decompression = result;
+    return true;
+}
+
+MKLDNNPlugin::MarkWeightsDecompression::MarkWeightsDecompression() {
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ ngraph::pattern::any_input(), ngraph::pattern::any_input() });
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        const auto matmul = m.get_match_root();
+        WeightsDecompression decompression;
+        if (!getWeightsDecompression(matmul->input_value(1), decompression))
+            return false;
+
+        ov::disable_constant_folding(decompression.convert);
+        for (const auto& node : { decompression.subtract, decompression.multiply, decompression.reshape }) {
+            if (node)
+                ngraph::snippets::pass::SetSnippetsNodeType(node, ngraph::snippets::pass::SnippetsNodeType::SkippedByPlugin);
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "MarkWeightsDecompression");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Nodes of the weights decompression subgraph:
+ *
+ *   Constant (i8/u8/i4/u4)
+ *      |
+ *   Convert   Constant (zero points)
+ *       \      /
+ *       Subtract (optional)   Constant (scales)
+ *            \                 /
+ *                 Multiply
+ *                    |
+ *                 Reshape (optional, e.g. [O, G, K / G] -> [O, K] for the group-wise scales)
+ *
+ * The zero points and the scales may be converted Constants as well, until the constant folding was applied.
+ */
+struct WeightsDecompression {
+    std::shared_ptr<ngraph::Node> weights;
+    std::shared_ptr<ngraph::Node> convert;
+    std::shared_ptr<ngraph::Node> subtract;
+    ngraph::Output<ngraph::Node> zeroPoints;
+    std::shared_ptr<ngraph::Node> multiply;
+    ngraph::Output<ngraph::Node> scales;
+    std::shared_ptr<ngraph::Node> reshape;
+};
+
+/**
+ * @brief Matches the weights decompression subgraph ending by the 'output'
+ */
+bool getWeightsDecompression(const ngraph::Output<ngraph::Node>& output, WeightsDecompression& decompression);
+
+/**
+ * @interface MarkWeightsDecompression
+ * @brief Disables the constant folding of the weights decompression subgraphs of MatMul operations, so the weights are kept
+ * compressed and then decompressed by the CPU FullyConnected node itself. The subgraphs are skipped by the snippets tokenization.
+ */
+class MarkWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkWeightsDecompression();
+};
+
+}  // namespace MKLDNNPlugin
@@ -23,33 +23,124 @@ using namespace Xbyak;
 
 namespace {
 
-template <typename src_t, typename dst_t>
-void convert_vec(jit_generator & gen,
-                 const RegExp & src,
-                 const RegExp & dst);
+// loads 8 elements of the type to the f32 lanes of ymm4
+template <typename T>
+void load_vec(jit_generator & gen, const RegExp & src);
 
 template <>
-void convert_vec<ov::float16, float>(jit_generator & gen,
-                                     const RegExp & src,
-                                     const RegExp & dst) {
-    auto const & f16vec = gen.xmm3;
-    auto const & f32vec = gen.ymm4;
-
-    gen.movdqu(f16vec, gen.xword[src]);
-    gen.vcvtph2ps(f32vec, f16vec);
-    gen.vmovups(gen.yword[dst], f32vec);
+void load_vec<uint8_t>(jit_generator & gen, const RegExp & src) {
+    gen.vpmovzxbd(gen.ymm4, gen.qword[src]);
+    gen.vcvtdq2ps(gen.ymm4, gen.ymm4);
 }
 
 template <>
-void convert_vec<float, ov::float16>(jit_generator & gen,
-                                     const RegExp & src,
-                                     const RegExp & dst) {
-    auto const & f16vec = gen.xmm3;
-    auto const & f32vec = gen.ymm4;
-
-    gen.vmovups(f32vec, gen.yword[src]);
-    gen.vcvtps2ph(f16vec, f32vec, 0);
-    gen.movdqu(gen.xword[dst], f16vec);
+void load_vec<int8_t>(jit_generator & gen, const RegExp & src) {
+    gen.vpmovsxbd(gen.ymm4, gen.qword[src]);
+    gen.vcvtdq2ps(gen.ymm4, gen.ymm4);
+}
+
+template <>
+void load_vec<uint16_t>(jit_generator & gen, const RegExp & src) {
+    gen.vpmovzxwd(gen.ymm4, gen.xword[src]);
+    gen.vcvtdq2ps(gen.ymm4, gen.ymm4);
+}
+
+template <>
+void load_vec<int16_t>(jit_generator & gen, const RegExp & src) {
+    gen.vpmovsxwd(gen.ymm4, gen.xword[src]);
+    gen.vcvtdq2ps(gen.ymm4, gen.ymm4);
+}
+
+template <>
+void load_vec<int32_t>(jit_generator & gen, const RegExp & src) {
+    gen.vmovdqu(gen.ymm4, gen.yword[src]);
+    gen.vcvtdq2ps(gen.ymm4, gen.ymm4);
+}
+
+template <>
+void load_vec<float>(jit_generator & gen, const RegExp & src) {
+    gen.vmovups(gen.ymm4, gen.yword[src]);
+}
+
+template <>
+void load_vec<ov::float16>(jit_generator & gen, const RegExp & src) {
+    gen.vcvtph2ps(gen.ymm4, gen.xword[src]);
+}
+
+template <>
+void load_vec<bfloat16_t>(jit_generator & gen, const RegExp & src) {
+    gen.vpmovzxwd(gen.ymm4, gen.xword[src]);
+    gen.vpslld(gen.ymm4, gen.ymm4, 16);
+}
+
+// stores the f32 lanes of ymm4 as 8 elements of the type, the values are already clamped to the range of the type,
+// the conversion to the integral types truncates as static_cast does
+template <typename T>
+void store_vec(jit_generator & gen, const RegExp & dst);
+
+template <>
+void store_vec<uint8_t>(jit_generator & gen, const RegExp & dst) {
+    gen.vcvttps2dq(gen.ymm4, gen.ymm4);
+    gen.vextracti128(gen.xmm5, gen.ymm4, 1);
+    gen.vpackusdw(gen.xmm4, gen.xmm4, gen.xmm5);
+    gen.vpackuswb(gen.xmm4, gen.xmm4, gen.xmm4);
+    gen.vmovq(gen.qword[dst], gen.xmm4);
+}
+
+template <>
+void store_vec<int8_t>(jit_generator & gen, const RegExp & dst) {
+    gen.vcvttps2dq(gen.ymm4, gen.ymm4);
+    gen.vextracti128(gen.xmm5, gen.ymm4, 1);
+    gen.vpackssdw(gen.xmm4, gen.xmm4, gen.xmm5);
+    gen.vpacksswb(gen.xmm4, gen.xmm4, gen.xmm4);
+    gen.vmovq(gen.qword[dst], gen.xmm4);
+}
+
+template <>
+void store_vec<uint16_t>(jit_generator & gen, const RegExp & dst) {
+    gen.vcvttps2dq(gen.ymm4, gen.ymm4);
+    gen.vextracti128(gen.xmm5, gen.ymm4, 1);
+    gen.vpackusdw(gen.xmm4, gen.xmm4, gen.xmm5);
+    gen.vmovdqu(gen.xword[dst], gen.xmm4);
+}
+
+template <>
+void store_vec<int16_t>(jit_generator & gen, const RegExp & dst) {
+    gen.vcvttps2dq(gen.ymm4, gen.ymm4);
+    gen.vextracti128(gen.xmm5, gen.ymm4, 1);
+    gen.vpackssdw(gen.xmm4, gen.xmm4, gen.xmm5);
+    gen.vmovdqu(gen.xword[dst], gen.xmm4);
+}
+
+template <>
+void store_vec<int32_t>(jit_generator & gen, const RegExp & dst) {
+    gen.vcvttps2dq(gen.ymm4, gen.ymm4);
+    gen.vmovdqu(gen.yword[dst], gen.ymm4);
+}
+
+template <>
+void store_vec<float>(jit_generator & gen, const RegExp & dst) {
+    gen.vmovups(gen.yword[dst], gen.ymm4);
+}
+
+template <>
+void store_vec<ov::float16>(jit_generator & gen, const RegExp & dst) {
+    gen.vcvtps2ph(gen.xword[dst], gen.ymm4, 0);
+}
+
+template <>
+void store_vec<bfloat16_t>(jit_generator & gen, const RegExp & dst) {
+    // the same rounding as bfloat16_t::round_to_nearest_even: bits + ((bits & 0x10000) >> 1)
+    gen.vpcmpeqd(gen.ymm5, gen.ymm5, gen.ymm5);
+    gen.vpsrld(gen.ymm5, gen.ymm5, 31);
+    gen.vpslld(gen.ymm5, gen.ymm5, 15);
+    gen.vpsrld(gen.ymm8, gen.ymm4, 1);
+    gen.vpand(gen.ymm8, gen.ymm8, gen.ymm5);
+    gen.vpaddd(gen.ymm4, gen.ymm4, gen.ymm8);
+    gen.vpsrld(gen.ymm4, gen.ymm4, 16);
+    gen.vextracti128(gen.xmm5, gen.ymm4, 1);
+    gen.vpackusdw(gen.xmm4, gen.xmm4, gen.xmm5);
+    gen.vmovdqu(gen.xword[dst], gen.xmm4);
 }
 
 class jit_convert_array : public jit_generator {
@@ -70,13 +161,15 @@ class jit_convert_array : public jit_generator {
         mov(reg_src, ptr[param1 + offsetof(args_t, src)]);
         mov(reg_dst, ptr[param1 + offsetof(args_t, out)]);
         mov(reg_sz, ptr[param1 + offsetof(args_t, count)]);
+        vbroadcastss(ymm6, ptr[param1 + offsetof(args_t, lbound)]);
+        vbroadcastss(ymm7, ptr[param1 + offsetof(args_t, ubound)]);
 
         xor_(rsi, rsi);
         mov(r8, reg_sz);
         shr(r8, vlen_log2);
 
         foreach(rsi, 1, r8, [&, this](const Xbyak::Reg64& idx) {
-            _convert_vec(*this, reg_src, reg_dst);
+            convert_vec(reg_src, reg_dst);
             add(reg_src, _src_size * vlen);
             add(reg_dst, _dst_size * vlen);
         });
@@ -97,7 +190,7 @@ class jit_convert_array : public jit_generator {
 
         // Tail conversion
         copy(r8, reg_src, reg_sz, _src_size);
-        _convert_vec(*this, r8, r8);
+        convert_vec(r8, r8);
         copy(reg_dst, r8, reg_sz, _dst_size);
 
         // Free the array on stack
@@ -108,6 +201,16 @@ class jit_convert_array : public jit_generator {
         postamble();
     }
 
+    // the values are clamped in f32 the same way as the reference conversion does: NaN stays NaN
+    void convert_vec(const RegExp & src, const RegExp & dst) {
+        _load_vec(*this, src);
+        vminps(ymm4, ymm7, ymm4);
+        vmaxps(ymm4, ymm6, ymm4);
+        if (_truncate)
+            vroundps(ymm4, ymm4, 3);
+        _store_vec(*this, dst);
+    }
+
     void foreach(const Xbyak::Reg64& idx,
                  size_t step,
                  const Xbyak::Reg64& end,
@@ -146,11 +249,23 @@ class jit_convert_array : public jit_generator {
             return ptr;
         };
 
+        auto item_reg = [this](size_t size) -> Xbyak::Reg {
+            switch (size) {
+                case 1: return r15.cvt8();
+                case 2: return r15.cvt16();
+                case 4: return r15.cvt32();
+                default:
+                    break;
+            }
+            return r15;
+        };
+
         const auto & addr_frame = address_frame(item_size);
+        const auto reg = item_reg(item_size);
 
         foreach(rsi, 1, size, [&, this](const Xbyak::Reg64& idx) {
-            mov(r15, addr_frame[src + idx * item_size]);
-            mov(addr_frame[dst + idx * item_size], r15);
+            mov(reg, addr_frame[src + idx * item_size]);
+            mov(addr_frame[dst + idx * item_size], reg);
         });
 
         pop(r15);
@@ -162,36 +277,51 @@ public:
         const void* src;
         void* out;
         const size_t count;
+        // the range the values are clamped to before the conversion
+        float lbound;
+        float ubound;
     } args_t;
 
     typedef void (*fn_t)(const args_t*);
 
-    typedef void (*convert_vec_t)(jit_generator &,
-                                  const RegExp &,
-                                  const RegExp &);
+    typedef void (*load_vec_t)(jit_generator &,
+                               const RegExp &);
+
+    typedef void (*store_vec_t)(jit_generator &,
+                                const RegExp &);
 
-    jit_convert_array(convert_vec_t convert_vec,
+    jit_convert_array(load_vec_t load_vec,
+                      store_vec_t store_vec,
                       size_t src_size,
-                      size_t dst_size)
-        : _convert_vec(convert_vec)
+                      size_t dst_size,
+                      bool truncate)
+        : _load_vec(load_vec)
+        , _store_vec(store_vec)
         , _src_size(src_size)
-        , _dst_size(dst_size) {}
+        , _dst_size(dst_size)
+        , _truncate(truncate) {}
 
-    template<typename src_t, typename dst_t>
+    // the kernel is generated once per the pair of the types, truncate rounds the values toward zero before the store
+    template<typename src_t, typename dst_t, bool truncate = false>
     static fn_t get() {
         if (mayiuse(avx2) && cpu().has(util::Cpu::tF16C)) {
-            static jit_convert_array converter(convert_vec<src_t, dst_t>, sizeof(src_t), sizeof(dst_t));
-            auto & generator = static_cast<jit_generator&>(converter);
-            generator.create_kernel();
-            return (fn_t)generator.jit_ker();
+            static jit_convert_array converter(load_vec<src_t>, store_vec<dst_t>, sizeof(src_t), sizeof(dst_t), truncate);
+            static const fn_t fn = [] {
+                auto & generator = static_cast<jit_generator&>(converter);
+                generator.create_kernel();
+                return (fn_t)generator.jit_ker();
+            }();
+            return fn;
         }
         return nullptr;
     }
 
 private:
-    convert_vec_t _convert_vec;
+    load_vec_t _load_vec;
+    store_vec_t _store_vec;
     size_t _src_size;
     size_t _dst_size;
+    bool _truncate;
 };
 
 template <typename TI, typename TO>
@@ -200,7 +330,9 @@ void jit_convert(const TI* arg, TO* out, size_t count) {
     static auto converter = jit_impl::get<TI, TO>();
 
     if (converter) {
-        typename jit_impl::args_t args = { arg, out, count };
+        typename jit_impl::args_t args = { arg, out, count,
+                                           -std::numeric_limits<float>::infinity(),
+                                           std::numeric_limits<float>::infinity() };
         converter(&args);
     } else {
         for (size_t i = 0; i < count; ++i) {
@@ -516,6 +648,47 @@ struct ConvertPrecision<std::tuple<ov::float16, ov::float16>> {
     }
 };
 
+// the conversions between the types which fit the f32 lanes, by one pass of the vectors through f32
+template<typename T>
+struct JitConvertPrecision;
+
+template<typename src_t, typename dst_t>
+struct JitConvertPrecision<std::tuple<src_t, dst_t>> {
+    void operator()(ConvertContext & ctx) {
+        const bool truncate = !std::is_integral<src_t>::value
+                              && !ctx.interimPrc.is_float()
+                              && !std::is_integral<dst_t>::value;
+        const auto converter = truncate ? jit_convert_array::get<src_t, dst_t, true>()
+                                        : jit_convert_array::get<src_t, dst_t, false>();
+        if (!converter)
+            return;
+
+        auto src = static_cast<const src_t *>(ctx.srcPtr);
+        auto dst = static_cast<dst_t *>(ctx.dstPtr);
+        const auto range = ctx.range<src_t>();
+        float lbound = static_cast<float>(std::get<0>(range));
+        float ubound = static_cast<float>(std::get<1>(range));
+        // as the reference ones, the f32 <-> bf16 conversions through a float interim precision aren't clamped
+        if (ctx.interimPrc.is_float()
+            && ((std::is_same<src_t, float>::value && std::is_same<dst_t, bfloat16_t>::value)
+                || (std::is_same<src_t, bfloat16_t>::value && std::is_same<dst_t, float>::value))) {
+            lbound = -std::numeric_limits<float>::infinity();
+            ubound = std::numeric_limits<float>::infinity();
+        }
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(ctx.size, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+            jit_convert_array::args_t args = { src + start, dst + start, end - start, lbound, ubound };
+            converter(&args);
+        });
+
+        ctx.converted = true;
+    }
+};
+
 bool isConversionTruncatesRange(const Precision & from, const Precision & to) {
     return to.bitsSize() < from.bitsSize()
             || (from.is_float() && !to.is_float())      // float -> integral
@@ -572,6 +745,25 @@ bool isConversionTruncatesRange(const Precision & from, const Precision & to) {
     MKLDNN_CVT(FP32, FP32), MKLDNN_CVT(FP16, FP16), MKLDNN_CVT(BF16, BF16), MKLDNN_CVT(FP64, FP64), \
     MKLDNN_CVT(BOOL, BOOL)
 
+// the i32 -> i32 conversion with an interim precision isn't exact in f32, so the same types aren't listed
+#define MKLDNN_JIT_CVT_LIST                                                                         \
+    MKLDNN_CVT(U8, I8),     MKLDNN_CVT(U8, U16),    MKLDNN_CVT(U8, I16),    MKLDNN_CVT(U8, I32),    \
+    MKLDNN_CVT(U8, FP32),   MKLDNN_CVT(U8, FP16),   MKLDNN_CVT(U8, BF16),                           \
+    MKLDNN_CVT(I8, U8),     MKLDNN_CVT(I8, U16),    MKLDNN_CVT(I8, I16),    MKLDNN_CVT(I8, I32),    \
+    MKLDNN_CVT(I8, FP32),   MKLDNN_CVT(I8, FP16),   MKLDNN_CVT(I8, BF16),                           \
+    MKLDNN_CVT(U16, U8),    MKLDNN_CVT(U16, I8),    MKLDNN_CVT(U16, I16),   MKLDNN_CVT(U16, I32),   \
+    MKLDNN_CVT(U16, FP32),  MKLDNN_CVT(U16, FP16),  MKLDNN_CVT(U16, BF16),                          \
+    MKLDNN_CVT(I16, U8),    MKLDNN_CVT(I16, I8),    MKLDNN_CVT(I16, U16),   MKLDNN_CVT(I16, I32),   \
+    MKLDNN_CVT(I16, FP32),  MKLDNN_CVT(I16, FP16),  MKLDNN_CVT(I16, BF16),                          \
+    MKLDNN_CVT(I32, U8),    MKLDNN_CVT(I32, I8),    MKLDNN_CVT(I32, U16),   MKLDNN_CVT(I32, I16),   \
+    MKLDNN_CVT(I32, FP32),  MKLDNN_CVT(I32, FP16),  MKLDNN_CVT(I32, BF16),                          \
+    MKLDNN_CVT(FP32, U8),   MKLDNN_CVT(FP32, I8),   MKLDNN_CVT(FP32, U16),  MKLDNN_CVT(FP32, I16),  \
+    MKLDNN_CVT(FP32, I32),  MKLDNN_CVT(FP32, FP16), MKLDNN_CVT(FP32, BF16),                         \
+    MKLDNN_CVT(FP16, U8),   MKLDNN_CVT(FP16, I8),   MKLDNN_CVT(FP16, U16),  MKLDNN_CVT(FP16, I16),  \
+    MKLDNN_CVT(FP16, I32),  MKLDNN_CVT(FP16, FP32), MKLDNN_CVT(FP16, BF16),                         \
+    MKLDNN_CVT(BF16, U8),   MKLDNN_CVT(BF16, I8),   MKLDNN_CVT(BF16, U16),  MKLDNN_CVT(BF16, I16),  \
+    MKLDNN_CVT(BF16, I32),  MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, FP16)
+
 void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
     cpu_convert(srcPtr, dstPtr, srcPrc, dstPrc, dstPrc, size);
 }
@@ -596,7 +788,9 @@ void cpu_convert(const void *srcPtr,
             dstPrc,
             false
         };
-        OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc), MKLDNN_CVT_LIST);
+        OV_SWITCH(MKLDNNPlugin, JitConvertPrecision, ctx, std::tie(srcPrc, dstPrc), MKLDNN_JIT_CVT_LIST);
+        if (!ctx.converted)
+            OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc), MKLDNN_CVT_LIST);
         if (!ctx.converted)
             IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
     }
@@ -604,3 +798,4 @@ void cpu_convert(const void *srcPtr,
 
 #undef MKLDNN_CVT
 #undef MKLDNN_CVT_LIST
+#undef MKLDNN_JIT_CVT_LIST
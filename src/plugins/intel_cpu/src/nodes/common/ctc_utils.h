@@ -0,0 +1,105 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace MKLDNNPlugin {
+namespace ctc {
+
+// The scans below keep the independent accumulators in the lanes, so the compiler vectorizes them
+// without the reordering of the floating point reductions
+constexpr int simdLanes = 16;
+
+/**
+ * @brief Returns the index of the first maximum of `size` values, like the plain sequential scan does
+ */
+inline int argMax(const float* data, int size) {
+    if (size < 2 * simdLanes) {
+        int maxIdx = 0;
+        for (int c = 1; c < size; c++) {
+            if (data[c] > data[maxIdx])
+                maxIdx = c;
+        }
+        return maxIdx;
+    }
+
+    float laneMax[simdLanes];
+    int laneIdx[simdLanes];
+    for (int l = 0; l < simdLanes; l++) {
+        laneMax[l] = data[l];
+        laneIdx[l] = l;
+    }
+    int c = simdLanes;
+    for (; c + simdLanes <= size; c += simdLanes) {
+        for (int l = 0; l < simdLanes; l++) {
+            const float value = data[c + l];
+            const bool greater = value > laneMax[l];
+            laneMax[l] = greater ? value : laneMax[l];
+            laneIdx[l] = greater ? c + l : laneIdx[l];
+        }
+    }
+
+    // the lanes hold the first maximums of the interleaved subsets, the equal ones are resolved by the index
+    float maxValue = laneMax[0];
+    int maxIdx = laneIdx[0];
+    for (int l = 1; l < simdLanes; l++) {
+        if (laneMax[l] > maxValue || (laneMax[l] == maxValue && laneIdx[l] < maxIdx)) {
+            maxValue = laneMax[l];
+            maxIdx = laneIdx[l];
+        }
+    }
+    for (; c < size; c++) {
+        if (data[c] > maxValue) {
+            maxValue = data[c];
+            maxIdx = c;
+        }
+    }
+    return maxIdx;
+}
+
+/**
+ * @brief Returns log(sum(exp(data))) of `size` values, the exponents are calculated relative to the maximum
+ */
+inline float logSumExp(const float* data, size_t size) {
+    float laneMax[simdLanes];
+    std::fill(laneMax, laneMax + simdLanes, data[0]);
+    size_t c = 0;
+    for (; c + simdLanes <= size; c += simdLanes) {
+        for (int l = 0; l < simdLanes; l++)
+            laneMax[l] = std::max(laneMax[l], data[c + l]);
+    }
+    float maxValue = *std::max_element(laneMax, laneMax + simdLanes);
+    for (size_t tail = c; tail < size; tail++)
+        maxValue = std::max(maxValue, data[tail]);
+
+    float laneSum[simdLanes] = {};
+    c = 0;
+    for (; c + simdLanes <= size; c += simdLanes) {
+        for (int l = 0; l < simdLanes; l++)
+            laneSum[l] += std::exp(data[c + l] - maxValue);
+    }
+    float expSum = 0.f;
+    for (int l = 0; l < simdLanes; l++)
+        expSum += laneSum[l];
+    for (; c < size; c++)
+        expSum += std::exp(data[c] - maxValue);
+    return maxValue + std::log(expSum);
+}
+
+/**
+ * @brief Returns log(exp(log1) + exp(log2) + exp(log3)), the -infinity arguments are the absent terms
+ */
+inline float sumLogs(float log1, float log2, float log3) {
+    const float maxLog = std::max(log1, std::max(log2, log3));
+    if (maxLog == -std::numeric_limits<float>::infinity())
+        return maxLog;
+    return maxLog + std::log(std::exp(log1 - maxLog) + std::exp(log2 - maxLog) + std::exp(log3 - maxLog));
+}
+
+}  // namespace ctc
+}  // namespace MKLDNNPlugin
@@ -3,6 +3,9 @@
 //
 
 #include "dnnl_executor.h"
+#include "mkldnn_extension_utils.h"
+
+#include <algorithm>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -43,3 +46,69 @@ void DnnlExecutor::exec(std::unordered_map<int, mkldnn::memory> primArgs, mkldnn
         outReorder.second.exec(primArgs[outReorder.first], outputMem[outReorder.first], strm);
     }
 }
+
+DnnlBatchBucketsExecutor::DnnlBatchBucketsExecutor(std::vector<size_t> buckets, const Builder& builder, std::vector<int> batchedArgs)
+    : buckets(std::move(buckets)), batchedArgs(std::move(batchedArgs)) {
+    this->buckets.push_back(1);
+    std::sort(this->buckets.begin(), this->buckets.end(), std::greater<size_t>());
+    this->buckets.erase(std::unique(this->buckets.begin(), this->buckets.end()), this->buckets.end());
+    for (auto bucket : this->buckets) {
+        auto executor = builder(bucket);
+        if (!executor)
+            IE_THROW() << "DnnlBatchBucketsExecutor can't create executor for batch " << bucket;
+        executors.push_back(executor);
+    }
+}
+
+void DnnlBatchBucketsExecutor::exec(const std::unordered_map<int, mkldnn::memory>& primArgs, size_t batch, mkldnn::stream strm) {
+    auto chunkArgs = primArgs;
+    size_t offset = 0;
+    for (size_t i = 0; i < buckets.size() && offset < batch; ) {
+        const size_t bucket = buckets[i];
+        if (batch - offset < bucket) {
+            i++;
+            continue;
+        }
+        for (auto arg : batchedArgs) {
+            auto argMem = primArgs.find(arg);
+            if (argMem == primArgs.end())
+                IE_THROW() << "DnnlBatchBucketsExecutor doesn't have memory for argument " << arg;
+            const auto& desc = argMem->second.get_desc();
+            const size_t batchBytes = desc.data.format_desc.blocking.strides[0] * MKLDNNExtensionUtils::sizeOfDataType(desc.data_type());
+            auto data = static_cast<uint8_t*>(argMem->second.get_data_handle()) + offset * batchBytes;
+            chunkArgs[arg] = mkldnn::memory(changeBatch(desc, bucket), strm.get_engine(), data);
+        }
+        executors[i]->exec(chunkArgs, strm);
+        offset += bucket;
+    }
+}
+
+bool DnnlBatchBucketsExecutor::isBatchOutermost(const mkldnn::memory::desc& desc) {
+    const auto& data = desc.data;
+    if (data.format_kind != dnnl_blocked || data.ndims < 1)
+        return false;
+    const auto& blocking = data.format_desc.blocking;
+    for (int i = 0; i < blocking.inner_nblks; i++) {
+        if (blocking.inner_idxs[i] == 0)
+            return false;
+    }
+    // the batch stride must cover all the other dimensions, so the batch slices don't overlap
+    std::vector<dnnl_dim_t> blocks(data.ndims, 1);
+    dnnl_dim_t innerBlock = 1;
+    for (int i = 0; i < blocking.inner_nblks; i++) {
+        blocks[blocking.inner_idxs[i]] *= blocking.inner_blks[i];
+        innerBlock *= blocking.inner_blks[i];
+    }
+    for (int i = 1; i < data.ndims; i++) {
+        if (blocking.strides[0] < blocking.strides[i] * (data.padded_dims[i] / blocks[i]))
+            return false;
+    }
+    return blocking.strides[0] >= innerBlock;
+}
+
+mkldnn::memory::desc DnnlBatchBucketsExecutor::changeBatch(const mkldnn::memory::desc& desc, size_t batch) {
+    mkldnn::memory::desc result = desc;
+    result.data.dims[0] = static_cast<dnnl_dim_t>(batch);
+    result.data.padded_dims[0] = static_cast<dnnl_dim_t>(batch);
+    return result;
+}
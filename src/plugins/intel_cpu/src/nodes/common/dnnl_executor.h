@@ -7,6 +7,8 @@
 #include "mkldnn_memory.h"
 #include "mkldnn_primitive.h"
 
+#include <functional>
+
 namespace MKLDNNPlugin {
 
 class DnnlExecutor {
@@ -36,4 +38,36 @@ class DnnlExecutor {
         std::unordered_map<int, IntermReorder> outputReorders;
 };
 
+/**
+ * @brief Executes the primitives of any batch size by the executors precompiled for the fixed set of batch sizes (buckets).
+ * The batch is split into the chunks of the buckets sizes (the biggest first), each chunk is executed on the views of the
+ * batched arguments memory, so neither padding copies nor new primitives are needed during the execution.
+ * Applicable only if the batch is the outermost not blocked dimension of the batched arguments memory.
+ */
+class DnnlBatchBucketsExecutor {
+    public:
+        using Ptr = std::shared_ptr<DnnlBatchBucketsExecutor>;
+        // creates the executor of the given batch size
+        using Builder = std::function<std::shared_ptr<DnnlExecutor>(size_t batch)>;
+
+        /**
+         * @param buckets the batch sizes to precompile the executors for, the batch of size 1 is always added
+         * @param builder creates the executor of the given batch size
+         * @param batchedArgs the primitive arguments the batch slices are passed by
+         */
+        DnnlBatchBucketsExecutor(std::vector<size_t> buckets, const Builder& builder, std::vector<int> batchedArgs);
+        void exec(const std::unordered_map<int, mkldnn::memory>& primArgs, size_t batch, mkldnn::stream strm);
+
+        // checks that the descriptor of batch size N is a prefix of the descriptor of the bigger batch
+        static bool isBatchOutermost(const mkldnn::memory::desc& desc);
+        // returns the descriptor of the same layout with the given batch size
+        static mkldnn::memory::desc changeBatch(const mkldnn::memory::desc& desc, size_t batch);
+
+    private:
+        // in descending order
+        std::vector<size_t> buckets;
+        std::vector<std::shared_ptr<DnnlExecutor>> executors;
+        std::vector<int> batchedArgs;
+};
+
 }  // namespace MKLDNNPlugin
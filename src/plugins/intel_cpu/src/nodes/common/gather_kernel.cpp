@@ -0,0 +1,147 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gather_kernel.h"
+
+#include <mkldnn_types.h>
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_gather_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_f32 : public jit_uni_gather_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_f32)
+
+    explicit jit_uni_gather_kernel_f32(jit_gather_config_params jcp_)
+        : jit_uni_gather_kernel(jcp_, cpu_isa_traits<isa>::vlen / sizeof(int)), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_shifts, ptr[reg_params + GET_OFF(shifts)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_table, l_table);
+
+        if (jcp.advance_src)
+            uni_vmovdqu(vmm_lanes, ptr[reg_table]);
+        if (jcp.slice_rank > 1)
+            uni_vmovdqu(vmm_slice_lanes, ptr[reg_table + vlen]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            je(main_loop_end_label, T_NEAR);
+
+            // offset = lane (if the source moves) + sum(index[i] * shift[i])
+            if (jcp.advance_src)
+                uni_vmovdqu(vmm_offset, vmm_lanes);
+            else
+                uni_vpxor(vmm_offset, vmm_offset, vmm_offset);
+            for (int i = 0; i < jcp.slice_rank; i++) {
+                if (jcp.slice_rank == 1)
+                    uni_vmovdqu(vmm_index, ptr[reg_indices]);
+                else
+                    gather(vmm_index, ptr[reg_indices + vmm_slice_lanes * data_size + i * data_size]);
+                uni_vpbroadcastd(vmm_shift, ptr[reg_shifts + i * data_size]);
+                uni_vpmulld(vmm_index, vmm_index, vmm_shift);
+                uni_vpaddd(vmm_offset, vmm_offset, vmm_index);
+            }
+
+            gather(vmm_val, ptr[reg_src + vmm_offset * data_size]);
+            uni_vmovdqu(ptr[reg_dst], vmm_val);
+
+            add(reg_indices, step * jcp.slice_rank * data_size);
+            add(reg_dst, step * data_size);
+            if (jcp.advance_src)
+                add(reg_src, step * data_size);
+            sub(reg_work_amount, 1);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        this->postamble();
+
+        prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int data_size = sizeof(int);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_shifts = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_table = r13;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_lanes = Vmm(0);
+    Vmm vmm_slice_lanes = Vmm(1);
+    Vmm vmm_offset = Vmm(2);
+    Vmm vmm_index = Vmm(3);
+    Vmm vmm_shift = Vmm(4);
+    Vmm vmm_val = Vmm(5);
+    Vmm vmm_mask = Vmm(6);
+
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    Xbyak::Label l_table;
+
+    // the gather consumes the mask, so it's set for every one
+    inline void gather(const Vmm& vmm_dst, const Xbyak::Address& addr) {
+        if (isa == cpu::x64::avx512_common) {
+            kxnorw(k_mask, k_mask, k_mask);
+            vpgatherdd(vmm_dst | k_mask, addr);
+        } else {
+            uni_vpcmpeqd(vmm_mask, vmm_mask, vmm_mask);
+            vpgatherdd(vmm_dst, addr, vmm_mask);
+        }
+    }
+
+    void prepare_table() {
+        align(64);
+        L(l_table);
+        // the lanes of the source and the lanes of the indices with slice_rank per element
+        for (size_t i = 0; i < step; i++)
+            dd(i);
+        for (size_t i = 0; i < step; i++)
+            dd(i * jcp.slice_rank);
+    }
+};
+
+std::shared_ptr<jit_uni_gather_kernel> MKLDNNPlugin::createGatherJitKernel(const jit_gather_config_params& jcp) {
+    std::shared_ptr<jit_uni_gather_kernel> kernel;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        kernel.reset(new jit_uni_gather_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jit_uni_gather_kernel_f32<cpu::x64::avx2>(jcp));
+    }
+
+    if (kernel)
+        kernel->create_ker();
+    return kernel;
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+struct jit_gather_config_params {
+    // the number of the indices per output element, the offset of the element is the sum of the indices by the shifts
+    int slice_rank;
+    // the source moves together with the output, e.g. a row along the inner dims, otherwise stays at the row start
+    bool advance_src;
+};
+
+struct jit_gather_args {
+    const void* src;
+    const int* indices;
+    void* dst;
+    // the shifts of the indices in the elements of the source, slice_rank values
+    const int* shifts;
+    // the number of the vectors of step elements
+    size_t work_amount;
+};
+
+struct jit_uni_gather_kernel {
+    void (*ker_)(const jit_gather_args *);
+
+    void operator()(const jit_gather_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_gather_kernel(jit_gather_config_params jcp_, size_t step_) : ker_(nullptr), jcp(jcp_), step(step_) {}
+    virtual ~jit_uni_gather_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_gather_config_params jcp;
+    // the number of the elements gathered at once
+    size_t step;
+};
+
+// creates the kernel gathering the 4 bytes elements with the best ISA of the machine, nullptr without the gather ISA (avx2)
+std::shared_ptr<jit_uni_gather_kernel> createGatherJitKernel(const jit_gather_config_params& jcp);
+
+}  // namespace MKLDNNPlugin
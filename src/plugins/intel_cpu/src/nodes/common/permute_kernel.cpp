@@ -4,6 +4,8 @@
 
 #include "permute_kernel.h"
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 #include <mkldnn_types.h>
 #include <ie_parallel.hpp>
@@ -138,6 +140,95 @@ private:
     Xbyak::Xmm xmm = Xbyak::Xmm(1);
 };
 
+#undef GET_OFF
+#define GET_OFF(field) offsetof(jit_args_transpose, field)
+
+struct jit_transpose_kernel_f32 : public jit_uni_transpose_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_transpose_kernel_f32)
+
+    jit_transpose_kernel_f32() : jit_uni_transpose_kernel(), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            mov(reg_aux, reg_src);
+            for (int i = 0; i < tile; i++) {
+                vmovups(Ymm(i), ptr[reg_aux]);
+                add(reg_aux, reg_src_stride);
+            }
+
+            transpose();
+
+            mov(reg_aux, reg_dst);
+            for (int i = 0; i < tile; i++) {
+                vmovups(ptr[reg_aux], Ymm(tile + i));
+                add(reg_aux, reg_dst_stride);
+            }
+
+            // the next tile is the next 8 elements of the source rows and the next 8 rows of the destination
+            add(reg_src, tile * sizeof(float));
+            mov(reg_dst, reg_aux);
+            sub(reg_work_amount, 1);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    static constexpr int tile = jit_uni_transpose_kernel::tile;
+
+    // the rows in ymm0-7 are transposed to ymm8-15
+    void transpose() {
+        for (int i = 0; i < tile / 2; i++) {
+            vunpcklps(Ymm(tile + 2 * i), Ymm(2 * i), Ymm(2 * i + 1));
+            vunpckhps(Ymm(tile + 2 * i + 1), Ymm(2 * i), Ymm(2 * i + 1));
+        }
+        for (int i = 0; i < tile / 4; i++) {
+            const int t = tile + 4 * i;
+            vshufps(Ymm(4 * i), Ymm(t), Ymm(t + 2), 0x44);
+            vshufps(Ymm(4 * i + 1), Ymm(t), Ymm(t + 2), 0xEE);
+            vshufps(Ymm(4 * i + 2), Ymm(t + 1), Ymm(t + 3), 0x44);
+            vshufps(Ymm(4 * i + 3), Ymm(t + 1), Ymm(t + 3), 0xEE);
+        }
+        for (int i = 0; i < tile / 2; i++) {
+            vperm2f128(Ymm(tile + i), Ymm(i), Ymm(i + 4), 0x20);
+            vperm2f128(Ymm(tile + i + 4), Ymm(i), Ymm(i + 4), 0x31);
+        }
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_src_stride = r10;
+    Xbyak::Reg64 reg_dst_stride = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_aux = r13;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+};
+
 PermuteKernel::PermuteKernel(const PermuteParams& params) : params(params) {
     prepareParams();
 }
@@ -264,9 +355,32 @@ void PermuteKernel::prepareParams() {
 
     if (permute_kernel)
         permute_kernel->create_ker();
+
+    // the loop over the innermost dim of the destination reads the source with a stride, if another dim is
+    // contiguous in the source, the pairs of these dims are transposed by the tiles in the registers instead
+    const size_t tile = jit_uni_transpose_kernel::tile;
+    const size_t last = jcp.ndims - 1;
+    if (jcp.data_size == sizeof(float) && mayiuse(cpu::x64::avx2) && jcp.ndims > 1 &&
+        jcp.dst_strides[last] == 1 && jcp.src_strides[last] != 1 && jcp.dst_block_dims[last] >= tile) {
+        for (size_t i = 0; i < last; i++) {
+            if (jcp.src_strides[i] == 1 && jcp.dst_block_dims[i] >= tile) {
+                tile_src_dim = i;
+                break;
+            }
+        }
+    }
+    if (tile_src_dim >= 0) {
+        transpose_kernel.reset(new jit_transpose_kernel_f32());
+        transpose_kernel->create_ker();
+    }
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    if (transpose_kernel) {
+        tiledExecute(src_data, dst_data, mb);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, mb);
         return;
@@ -277,6 +391,11 @@ void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const in
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data) {
     SizeVector dst_dims = jcp.dst_block_dims;
+    if (transpose_kernel) {
+        tiledExecute(src_data, dst_data, dst_dims[0]);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, dst_dims[0]);
         return;
@@ -334,6 +453,69 @@ void PermuteKernel::optimizedExecute(const uint8_t* src_data, uint8_t* dst_data,
     return;
 }
 
+void PermuteKernel::tiledExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    SizeVector dst_dims = jcp.dst_block_dims;
+    const SizeVector& dst_strides = jcp.dst_strides;
+    const SizeVector& src_strides = jcp.src_strides;
+
+    if (dst_dims[0] != mb)
+        dst_dims[0] = mb;
+
+    // the rows of the source tiles are along the innermost dim of the destination, the columns along tile_src_dim
+    const size_t tile = jit_uni_transpose_kernel::tile;
+    const size_t last = dst_dims.size() - 1;
+    const size_t col_dim = tile_src_dim;
+    const size_t rows = dst_dims[last];
+    const size_t cols = dst_dims[col_dim];
+    const size_t full_cols = cols / tile * tile;
+
+    SizeVector outer_dims;
+    SizeVector outer_src_strides;
+    SizeVector outer_dst_strides;
+    for (size_t i = 0; i < last; i++) {
+        if (i == col_dim)
+            continue;
+        outer_dims.push_back(dst_dims[i]);
+        outer_src_strides.push_back(src_strides[i]);
+        outer_dst_strides.push_back(dst_strides[i]);
+    }
+    const size_t outer_count = std::accumulate(outer_dims.begin(), outer_dims.end(), size_t(1), std::multiplies<size_t>());
+
+    const uint32_t* src = reinterpret_cast<const uint32_t*>(src_data);
+    uint32_t* dst = reinterpret_cast<uint32_t*>(dst_data);
+
+    parallel_for2d(outer_count, div_up(rows, tile), [&](size_t outer, size_t row_tile) {
+        size_t src_off = 0;
+        size_t dst_off = 0;
+        for (int i = outer_dims.size() - 1; i >= 0; i--) {
+            const size_t idx = outer % outer_dims[i];
+            outer /= outer_dims[i];
+            src_off += idx * outer_src_strides[i];
+            dst_off += idx * outer_dst_strides[i];
+        }
+
+        const size_t row_start = row_tile * tile;
+        const size_t row_end = std::min(row_start + tile, rows);
+        size_t col_start = 0;
+        if (row_end - row_start == tile) {
+            auto arg = jit_args_transpose();
+            arg.src = &src[src_off + row_start * src_strides[last]];
+            arg.dst = &dst[dst_off + row_start];
+            arg.src_stride = src_strides[last] * jcp.data_size;
+            arg.dst_stride = dst_strides[col_dim] * jcp.data_size;
+            arg.work_amount = full_cols / tile;
+            (*transpose_kernel)(&arg);
+            col_start = full_cols;
+        }
+
+        for (size_t r = row_start; r < row_end; r++) {
+            for (size_t c = col_start; c < cols; c++) {
+                dst[dst_off + c * dst_strides[col_dim] + r] = src[src_off + r * src_strides[last] + c];
+            }
+        }
+    });
+}
+
 static inline size_t parallel_init(size_t start, size_t nDims, const SizeVector& dims, SizeVector& indexes) {
     for (int j = nDims - 1; j >= 0; j--) {
         indexes[j] = start % dims[j];
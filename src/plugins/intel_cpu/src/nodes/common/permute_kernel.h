@@ -51,6 +51,33 @@ struct jit_uni_permute_kernel {
     jit_permute_config_params jcp;
 };
 
+struct jit_args_transpose {
+    const void* src;
+    void* dst;
+    // the bytes between the rows of the tile in the source and the rows of the transposed tile in the destination
+    size_t src_stride;
+    size_t dst_stride;
+    // the number of the tiles along the rows of the source
+    size_t work_amount;
+};
+
+// transposes the 8x8 tiles of the 4 bytes elements in the registers
+struct jit_uni_transpose_kernel {
+    void (*ker_)(const jit_args_transpose *);
+
+    void operator()(const jit_args_transpose *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_transpose_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_transpose_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    static constexpr size_t tile = 8;
+};
+
 class PermuteKernel {
 public:
     PermuteKernel(const PermuteParams& params);
@@ -65,10 +92,15 @@ private:
     void prepareParams();
 
     void optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
+    void tiledExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
     void referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
     jit_permute_config_params jcp = {};
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
+    // the permutations which move the contiguous dim of the source inward of the destination are transposed by
+    // the tiles of the dim contiguous in the source (tile_src_dim) and the innermost dim of the destination
+    std::shared_ptr<jit_uni_transpose_kernel> transpose_kernel;
+    int tile_src_dim = -1;
     PermuteParams params;
 };
 
@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "roi_align_utils.h"
+
+#include <algorithm>
+
+namespace MKLDNNPlugin {
+
+void calcROIAlignSamples(float roiStartX, float roiStartY, float binWidth, float binHeight, int samplingX, int samplingY,
+                         int pooledH, int pooledW, int H, int W, size_t hStride, size_t wStride,
+                         std::vector<ROIAlignSample>& samples) {
+    samples.resize(static_cast<size_t>(pooledH) * pooledW * samplingY * samplingX);
+    const float sampleDistanceX = binWidth / samplingX;
+    const float sampleDistanceY = binHeight / samplingY;
+    size_t sampleIndex = 0;
+    for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
+        for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
+            for (int ySampleInd = 0; ySampleInd < samplingY; ySampleInd++) {
+                float sampleY = roiStartY + yBinInd * binHeight + sampleDistanceY * (0.5f + ySampleInd);
+                for (int xSampleInd = 0; xSampleInd < samplingX; xSampleInd++) {
+                    float sampleX = roiStartX + xBinInd * binWidth + sampleDistanceX * (0.5f + xSampleInd);
+                    auto& sample = samples[sampleIndex++];
+                    if (sampleX < -1.0f || sampleX > W || sampleY < -1.0f || sampleY > H) {
+                        std::fill_n(sample.offsets, 4, 0);
+                        std::fill_n(sample.weights, 4, 0.f);
+                        continue;
+                    }
+                    sampleX = std::max(sampleX, 0.f);
+                    sampleY = std::max(sampleY, 0.f);
+
+                    int yLow = static_cast<int>(sampleY);
+                    int xLow = static_cast<int>(sampleX);
+                    int yHigh, xHigh;
+                    if (yLow >= H - 1) {
+                        yHigh = yLow = H - 1;
+                        sampleY = static_cast<float>(yLow);
+                    } else {
+                        yHigh = yLow + 1;
+                    }
+                    if (xLow >= W - 1) {
+                        xHigh = xLow = W - 1;
+                        sampleX = static_cast<float>(xLow);
+                    } else {
+                        xHigh = xLow + 1;
+                    }
+
+                    sample.offsets[0] = yLow * hStride + xLow * wStride;
+                    sample.offsets[1] = yLow * hStride + xHigh * wStride;
+                    sample.offsets[2] = yHigh * hStride + xLow * wStride;
+                    sample.offsets[3] = yHigh * hStride + xHigh * wStride;
+
+                    const float ly = sampleY - yLow;
+                    const float lx = sampleX - xLow;
+                    const float hy = 1.0f - ly;
+                    const float hx = 1.0f - lx;
+                    sample.weights[0] = hy * hx;
+                    sample.weights[1] = hy * lx;
+                    sample.weights[2] = ly * hx;
+                    sample.weights[3] = ly * lx;
+                }
+            }
+        }
+    }
+}
+
+void roiAlignAvgBin(const float* src, const ROIAlignSample* samples, size_t samplesNum, float* dst, size_t channels) {
+    // the accumulators are kept local, so the compiler vectorizes the channels loop
+    constexpr size_t chunkSize = 16;
+    const float scale = 1.f / static_cast<float>(samplesNum);
+    for (size_t chunkStart = 0; chunkStart < channels; chunkStart += chunkSize) {
+        const size_t chunk = std::min(chunkSize, channels - chunkStart);
+        const float* srcChunk = src + chunkStart;
+        float acc[chunkSize] = {};
+        for (size_t s = 0; s < samplesNum; ++s) {
+            const auto& sample = samples[s];
+            const float* src1 = srcChunk + sample.offsets[0];
+            const float* src2 = srcChunk + sample.offsets[1];
+            const float* src3 = srcChunk + sample.offsets[2];
+            const float* src4 = srcChunk + sample.offsets[3];
+            const float w1 = sample.weights[0], w2 = sample.weights[1], w3 = sample.weights[2], w4 = sample.weights[3];
+            for (size_t c = 0; c < chunk; ++c) {
+                acc[c] += w1 * src1[c] + w2 * src2[c] + w3 * src3[c] + w4 * src4[c];
+            }
+        }
+        for (size_t c = 0; c < chunk; ++c) {
+            dst[chunkStart + c] = acc[c] * scale;
+        }
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,35 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Bilinear interpolation sample of a ROI bin: the offsets of the 4 neighbour pixels and their weights
+ */
+struct ROIAlignSample {
+    size_t offsets[4];
+    float weights[4];
+};
+
+/**
+ * @brief Calculates the bilinear interpolation samples of all the bins of a ROI, `samplingX * samplingY` samples
+ * per bin in the row-major order of the bins. The samples out of the feature map have zero weights.
+ * The pixel offsets are calculated with the given strides of the feature map.
+ */
+void calcROIAlignSamples(float roiStartX, float roiStartY, float binWidth, float binHeight, int samplingX, int samplingY,
+                         int pooledH, int pooledW, int H, int W, size_t hStride, size_t wStride,
+                         std::vector<ROIAlignSample>& samples);
+
+/**
+ * @brief Averages the samples of a bin for `channels` channels which are contiguous in `src` and `dst`,
+ * so the channels loop is vectorized. Shared by the ROI feature extracting nodes for the nspc and blocked layouts.
+ */
+void roiAlignAvgBin(const float* src, const ROIAlignSample* samples, size_t samplesNum, float* dst, size_t channels);
+
+}  // namespace MKLDNNPlugin
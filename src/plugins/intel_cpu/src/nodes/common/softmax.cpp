@@ -277,22 +277,36 @@ void SoftmaxGeneric::calculate(const in_data_t *src_data, out_data_t *dst_data,
             tail_start = (H*W / block_size) * block_size;
         }
 
-        parallel_for(H * W - tail_start, [&](int i) {
-            int offset = i + tail_start;
-            float max = src_data[b * C * H * W + offset];
-            for (int c = 0; c < C; c++) {
-                float val = src_data[b * C * H * W + c * H * W + offset];
-                if (val > max) max = val;
+        // the reference path processes the blocks of the contiguous points, so the compiler vectorizes it
+        // for the ISAs without the JIT kernel, e.g. NEON on ARM
+        constexpr int ref_block = 16;
+        const int spatial = H * W;
+        parallel_for(div_up(spatial - tail_start, ref_block), [&](int ib) {
+            const int offset = tail_start + ib * ref_block;
+            const int len = std::min(ref_block, spatial - offset);
+            const in_data_t* src = src_data + b * C * spatial + offset;
+            out_data_t* dst = dst_data + b * C * spatial + offset;
+
+            float max[ref_block];
+            float expSum[ref_block] = {};
+            for (int j = 0; j < len; j++)
+                max[j] = src[j];
+            for (int c = 1; c < C; c++) {
+                for (int j = 0; j < len; j++)
+                    max[j] = std::max(max[j], static_cast<float>(src[c * spatial + j]));
             }
 
-            float expSum = 0;
             for (int c = 0; c < C; c++) {
-                dst_data[b * C * H * W + c * H * W + offset] = exp(src_data[b * C * H * W + c * H * W + offset] - max);
-                expSum += dst_data[b * C * H * W + c * H * W + offset];
+                for (int j = 0; j < len; j++) {
+                    const float val = exp(src[c * spatial + j] - max[j]);
+                    dst[c * spatial + j] = val;
+                    expSum[j] += val;
+                }
             }
 
             for (int c = 0; c < C; c++) {
-                dst_data[b * C * H * W + c * H * W + offset] = dst_data[b * C * H * W + c * H * W + offset] / expSum;
+                for (int j = 0; j < len; j++)
+                    dst[c * spatial + j] = dst[c * spatial + j] / expSum[j];
             }
         });
     }
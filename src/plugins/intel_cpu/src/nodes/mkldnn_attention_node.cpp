@@ -0,0 +1,226 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "ie_parallel.hpp"
+#include "mkldnn_attention_node.h"
+#include "ngraph_transformations/op/attention.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto attention = std::dynamic_pointer_cast<const AttentionNode>(op);
+        if (!attention) {
+            errorMessage = "Only Attention operation from cpu_plugin_opset is supported";
+            return false;
+        }
+        for (size_t i = 0; i < op->get_input_size(); i++) {
+            if (op->get_input_element_type(i) != ngraph::element::f32) {
+                errorMessage = "Only f32 inputs are supported";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNAttentionNode::MKLDNNAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "Attention node with name '" + op->get_friendly_name() + "'";
+    if ((getOriginalInputsNumber() != 3 && getOriginalInputsNumber() != 4) || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    const auto attention = std::dynamic_pointer_cast<const AttentionNode>(op);
+    transposeK = attention->get_transpose_k();
+    scale = attention->get_scale();
+    withMask = getOriginalInputsNumber() == 4;
+}
+
+void MKLDNNAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+namespace {
+// computes the per batch element offsets of the input right aligned with the output batch dimensions
+std::vector<size_t> batchOffsets(const VectorDims& inDims, const VectorDims& outBatchDims, size_t matrixSize) {
+    const size_t rank = outBatchDims.size();
+    const size_t inBatchRank = inDims.size() >= 2 ? inDims.size() - 2 : 0;
+    std::vector<size_t> strides(rank, 0);
+    size_t stride = matrixSize;
+    for (size_t i = 0; i < inBatchRank && i < rank; i++) {
+        const size_t inDim = inDims[inBatchRank - 1 - i];
+        if (inDim != 1)
+            strides[rank - 1 - i] = stride;
+        stride *= inDim;
+    }
+
+    size_t total = 1;
+    for (auto dim : outBatchDims)
+        total *= dim;
+    std::vector<size_t> offsets(total, 0);
+    for (size_t b = 0; b < total; b++) {
+        size_t idx = b;
+        size_t offset = 0;
+        for (size_t i = rank; i-- > 0;) {
+            offset += (idx % outBatchDims[i]) * strides[i];
+            idx /= outBatchDims[i];
+        }
+        offsets[b] = offset;
+    }
+    return offsets;
+}
+}   // namespace
+
+void MKLDNNAttentionNode::prepareParams() {
+    const auto& qDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto& kDims = getParentEdgeAt(1)->getMemory().getStaticDims();
+    const auto& vDims = getParentEdgeAt(2)->getMemory().getStaticDims();
+    const auto& dstDims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+
+    const size_t rank = dstDims.size();
+    L = qDims[rank - 2];
+    E = qDims[rank - 1];
+    S = transposeK ? kDims[rank - 2] : kDims[rank - 1];
+    Ev = vDims[rank - 1];
+
+    const VectorDims batchDims(dstDims.begin(), dstDims.end() - 2);
+    qOffsets = batchOffsets(qDims, batchDims, L * E);
+    kOffsets = batchOffsets(kDims, batchDims, S * E);
+    vOffsets = batchOffsets(vDims, batchDims, S * Ev);
+    batch = qOffsets.size();
+
+    if (withMask) {
+        auto maskDims = getParentEdgeAt(3)->getMemory().getStaticDims();
+        // the mask may have a lower rank than the scores
+        maskDims.insert(maskDims.begin(), rank - maskDims.size(), 1);
+        const size_t maskL = maskDims[rank - 2];
+        const size_t maskS = maskDims[rank - 1];
+        maskStrideS = maskS == 1 ? 0 : 1;
+        maskStrideL = maskL == 1 ? 0 : maskS;
+        maskOffsets = batchOffsets(maskDims, batchDims, maskL * maskS);
+    }
+
+    threadsNum = static_cast<size_t>(parallel_get_max_threads());
+    scratch.resize(threadsNum * (queryBlock * keyBlock + queryBlock * Ev + 2 * queryBlock));
+}
+
+void MKLDNNAttentionNode::execute(mkldnn::stream strm) {
+    const float* q = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const float* k = reinterpret_cast<const float *>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+    const float* v = reinterpret_cast<const float *>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
+    const float* mask = withMask ? reinterpret_cast<const float *>(getParentEdgeAt(3)->getMemoryPtr()->GetPtr()) : nullptr;
+    float* dst = reinterpret_cast<float *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+
+    const size_t qBlocks = (L + queryBlock - 1) / queryBlock;
+    const size_t workAmount = batch * qBlocks;
+    const size_t threadScratchSize = scratch.size() / threadsNum;
+    const float minusInf = -std::numeric_limits<float>::infinity();
+
+    parallel_nt(static_cast<int>(threadsNum), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+
+        float* scores = scratch.data() + ithr * threadScratchSize;
+        float* acc = scores + queryBlock * keyBlock;
+        float* rowMax = acc + queryBlock * Ev;
+        float* rowSum = rowMax + queryBlock;
+
+        for (size_t work = start; work < end; work++) {
+            const size_t b = work / qBlocks;
+            const size_t l0 = (work % qBlocks) * queryBlock;
+            const size_t lc = std::min(queryBlock, L - l0);
+
+            const float* qb = q + qOffsets[b] + l0 * E;
+            const float* kb = k + kOffsets[b];
+            const float* vb = v + vOffsets[b];
+
+            std::fill(acc, acc + lc * Ev, 0.f);
+            std::fill(rowMax, rowMax + lc, minusInf);
+            std::fill(rowSum, rowSum + lc, 0.f);
+
+            for (size_t s0 = 0; s0 < S; s0 += keyBlock) {
+                const size_t sc = std::min(keyBlock, S - s0);
+
+                for (size_t i = 0; i < lc; i++) {
+                    const float* qRow = qb + i * E;
+                    float* sRow = scores + i * keyBlock;
+                    for (size_t j = 0; j < sc; j++) {
+                        float dot = 0.f;
+                        if (transposeK) {
+                            const float* kRow = kb + (s0 + j) * E;
+                            for (size_t e = 0; e < E; e++)
+                                dot += qRow[e] * kRow[e];
+                        } else {
+                            const float* kCol = kb + s0 + j;
+                            for (size_t e = 0; e < E; e++)
+                                dot += qRow[e] * kCol[e * S];
+                        }
+                        sRow[j] = dot * scale;
+                    }
+                    if (mask) {
+                        const float* mRow = mask + maskOffsets[b] + (l0 + i) * maskStrideL + s0 * maskStrideS;
+                        for (size_t j = 0; j < sc; j++)
+                            sRow[j] += mRow[j * maskStrideS];
+                    }
+                }
+
+                for (size_t i = 0; i < lc; i++) {
+                    float* sRow = scores + i * keyBlock;
+                    float* accRow = acc + i * Ev;
+                    float newMax = rowMax[i];
+                    for (size_t j = 0; j < sc; j++)
+                        newMax = std::max(newMax, sRow[j]);
+                    // all the scores seen so far are masked out
+                    if (newMax == minusInf)
+                        continue;
+
+                    const float correction = std::exp(rowMax[i] - newMax);
+                    rowSum[i] *= correction;
+                    for (size_t e = 0; e < Ev; e++)
+                        accRow[e] *= correction;
+
+                    for (size_t j = 0; j < sc; j++) {
+                        const float p = std::exp(sRow[j] - newMax);
+                        rowSum[i] += p;
+                        const float* vRow = vb + (s0 + j) * Ev;
+                        for (size_t e = 0; e < Ev; e++)
+                            accRow[e] += p * vRow[e];
+                    }
+                    rowMax[i] = newMax;
+                }
+            }
+
+            float* dstBlock = dst + (b * L + l0) * Ev;
+            for (size_t i = 0; i < lc; i++) {
+                const float norm = 1.f / rowSum[i];
+                for (size_t e = 0; e < Ev; e++)
+                    dstBlock[i * Ev + e] = acc[i * Ev + e] * norm;
+            }
+        }
+    });
+}
+
+bool MKLDNNAttentionNode::created() const {
+    return getType() == Attention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNAttentionNode, Attention)
@@ -0,0 +1,52 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Computes Softmax(scale * Q x K' + Mask) x V block by block with the online softmax normalization,
+ * so the [L, S] scores matrix is never materialized: each thread keeps only a block of queries
+ * and the corresponding block of scores in its scratch buffer.
+ */
+class MKLDNNAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    static constexpr size_t queryBlock = 32;
+    static constexpr size_t keyBlock = 64;
+
+    bool transposeK = false;
+    bool withMask = false;
+    float scale = 1.f;
+
+    size_t L = 0, S = 0, E = 0, Ev = 0;
+    size_t batch = 0;
+    // per batch element offsets of the inputs, the broadcasted dimensions have zero stride
+    std::vector<size_t> qOffsets, kOffsets, vOffsets, maskOffsets;
+    // mask strides along L and S
+    size_t maskStrideL = 0, maskStrideS = 0;
+
+    size_t threadsNum = 0;
+    std::vector<float> scratch;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -3,12 +3,15 @@
 //
 
 #include "mkldnn_color_convert_node.h"
+#include "mkldnn_eltwise_node.h"
 #include <memory_desc/dnnl_blocked_memory_desc.h>
 #include <openvino/op/nv12_to_bgr.hpp>
 #include <openvino/op/nv12_to_rgb.hpp>
 #include <openvino/core/type.hpp>
 #include <ie/ie_parallel.hpp>
 #include <utils/jit_kernel.hpp>
+#include <utils/bfloat16.hpp>
+#include <utils/general_utils.h>
 
 using namespace InferenceEngine;
 using namespace mkldnn::impl::utils;
@@ -36,10 +39,19 @@ MKLDNNColorConvertNode::Converter::PrimitiveDescs supportedPrimitiveDescs(MKLDNN
                                     ? Precision::U8
                                     : Precision::FP32;
 
+    // the fused Convert and scale-shift operations write fp32 or bf16 directly, they are fused to the jit converter only
+    const auto & fusedWith = node->getFusedWith();
+    const Precision fusedPrecision = fusedWith.empty()
+                                        ? node->getOriginalOutputPrecisionAtPort(0)
+                                        : fusedWith.back()->getOriginalOutputPrecisionAtPort(0);
+    const Precision outPrecision = MKLDNNColorConvertNode::isFusedPrecisionSupported(fusedPrecision)
+                                    ? fusedPrecision
+                                    : precision;
+
     MKLDNNColorConvertNode::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
                         mayiuse(cpu_isa_t::sse41)
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
@@ -57,6 +69,7 @@ public:
 protected:
     Shapes shapeInfer() const override;
     bool singlePlane() const;
+    bool withScaleShift() const;
 
     template<typename T>
     void convert(const T* y,
@@ -67,6 +80,10 @@ protected:
                  size_t width,
                  size_t stride_y,
                  size_t stride_uv);
+
+    // the per channel scales and shifts of the fused operations, repeated in the order of the interleaved channels
+    std::vector<float> _scales;
+    std::vector<float> _shifts;
 };
 
 Converter::Converter(MKLDNNNode *node)
@@ -77,6 +94,36 @@ Converter::Converter(MKLDNNNode *node)
         IE_THROW() <<"NV12Converter node has incorrect number of inputs";
     if (!node->getOriginalOutputsNumber())
         IE_THROW() <<"NV12Converter node has incorrect number of outputs";
+
+    const auto & fusedWith = node->getFusedWith();
+    if (fusedWith.empty())
+        return;
+
+    // the chain of the fused operations is folded to a single scale-shift: s2 * (s1 * x + b1) + b2
+    std::array<float, 3> scales { { 1.f, 1.f, 1.f } };
+    std::array<float, 3> shifts { { 0.f, 0.f, 0.f } };
+    for (const auto & fusedNode : fusedWith) {
+        const auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(fusedNode);
+        if (!eltwise)
+            IE_THROW() << "NV12Converter node has unsupported fused node " << fusedNode->getName();
+        const auto & fusedScales = eltwise->getScales();
+        const auto & fusedShifts = eltwise->getShifts();
+        for (size_t c = 0; c < 3; ++c) {
+            const float scale = fusedScales.size() == 1 ? fusedScales[0] : fusedScales[c];
+            const float shift = fusedShifts.size() == 1 ? fusedShifts[0] : fusedShifts[c];
+            scales[c] *= scale;
+            shifts[c] = shifts[c] * scale + shift;
+        }
+    }
+
+    // the output registers of the kernel hold the whole pixels: 3 registers of the 16 floats at most
+    constexpr size_t scaleShiftSize = 3 * 16;
+    _scales.resize(scaleShiftSize);
+    _shifts.resize(scaleShiftSize);
+    for (size_t i = 0; i < scaleShiftSize; ++i) {
+        _scales[i] = scales[i % 3];
+        _shifts[i] = shifts[i % 3];
+    }
 }
 
 MKLDNNColorConvertNode::Converter::Shapes
@@ -93,6 +140,10 @@ bool Converter::singlePlane() const {
     return _node->getOriginalInputsNumber() == 1;
 }
 
+bool Converter::withScaleShift() const {
+    return !_scales.empty();
+}
+
 template<typename T>
 void Converter::convert(const T* y,
                         const T* uv,
@@ -199,6 +250,8 @@ struct jit_uni_converter : public jit_kernel {
         void * dst;
         size_t width;
         uint8_t colorFormat;    // RGB: 0, BGR: !=0
+        const float * scales;   // the scales and shifts of the 3 output registers, are used by the kernel with scale-shift
+        const float * shifts;
     };
 
     typedef void (*function_t)(const Params *);
@@ -207,22 +260,29 @@ struct jit_uni_converter : public jit_kernel {
         _fn(&args);
     }
 
-    template<typename T>
-    static const jit_uni_converter & get();
+    template<typename T, typename DstT>
+    static const jit_uni_converter & get(bool withScaleShift);
 
 protected:
     jit_uni_converter() = default;
 
     function_t _fn;
+    bool _withScaleShift = false;
 };
 
-template<typename T, cpu_isa_t isa>
+template<typename T, typename DstT, cpu_isa_t isa>
 class jit_uni_converter_impl : public jit_uni_converter {
+public:
+    explicit jit_uni_converter_impl(bool withScaleShift) {
+        _withScaleShift = withScaleShift;
+    }
+
+private:
     void generate() override;
 };
 
-template<typename T, cpu_isa_t isa>
-void jit_uni_converter_impl<T, isa>::generate() {
+template<typename T, typename DstT, cpu_isa_t isa>
+void jit_uni_converter_impl<T, DstT, isa>::generate() {
     using reg_type = typename isa_traits<isa>::reg::type;
     using var_type = variable<float[isa_traits<isa>::reg::length]>;
     constexpr auto reg_capacity = isa_traits<isa>::reg::length;
@@ -232,9 +292,11 @@ void jit_uni_converter_impl<T, isa>::generate() {
     // Get arguments addresses
     auto y = arg<const T *>(&Params::y);
     auto uv = arg<const T *>(&Params::uv);
-    auto dst = arg<T *>(&Params::dst);
+    auto dst = arg<DstT *>(&Params::dst);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
+    auto scales = arg<const float *>(&Params::scales);
+    auto shifts = arg<const float *>(&Params::shifts);
 
     // Reserve registars
     auto consts = reserve<Reg64>();
@@ -334,6 +396,14 @@ void jit_uni_converter_impl<T, isa>::generate() {
         blendWithMask(2, e);
     };  // blend
 
+    auto scaleShift = [&](const var_type & val, size_t regIdx) {
+        const size_t offset = regIdx * reg_capacity * sizeof(float);
+        uni_vmovups(tmp, ptr[scales + offset]);
+        uni_vmulps(val, val, tmp);
+        uni_vmovups(tmp, ptr[shifts + offset]);
+        uni_vaddps(val, val, tmp);
+    };
+
     auto colorConvert = [&](const reg_type & y_val, const reg_type & uv_val) {
         uni_vshufps(u_val, uv_val, uv_val, even_mask);              // u_val = tmp[0,0,2,2,4,4,6,6]
         uni_vshufps(v_val, uv_val, uv_val, odd_mask);               // v_val = tmp[1,1,3,3,5,5,7,7]
@@ -373,10 +443,18 @@ void jit_uni_converter_impl<T, isa>::generate() {
         _if(colorFormat == 0)
         ._then([&]{ blend(r, g, b); })
         ._else([&]{ blend(b, g, r); });
+
+        // the fused operations are applied to the rounded and clipped values, as the following nodes would do
+        if (_withScaleShift) {
+            scaleShift(c, 0);
+            scaleShift(d, 1);
+            scaleShift(e, 2);
+        }
     };
 
     const size_t reg_capacity_log = static_cast<size_t>(std::logb(reg_capacity));
     const size_t step = reg_capacity * sizeof(T);
+    const size_t dst_step = reg_capacity * sizeof(DstT);
 
     width >>= reg_capacity_log;
 
@@ -386,9 +464,9 @@ void jit_uni_converter_impl<T, isa>::generate() {
 
         colorConvert(y_val, uv_val);
 
-        store(dst, c);  dst += step;
-        store(dst, d);  dst += step;
-        store(dst, e);  dst += step;
+        store(dst, c);  dst += dst_step;
+        store(dst, d);  dst += dst_step;
+        store(dst, e);  dst += dst_step;
 
         y += step;
         uv += step;
@@ -399,7 +477,7 @@ void jit_uni_converter_impl<T, isa>::generate() {
 
     _if(width != 0)
     ._then([&] {
-        auto s = stack(3 * step);
+        auto s = stack(3 * reg_capacity * sizeof(float));   // is enough for both the input and the output of any type
         s.clear();
 
         copy<T>(s.pointer(), y, width);
@@ -413,28 +491,31 @@ void jit_uni_converter_impl<T, isa>::generate() {
 
         colorConvert(y_val, uv_val);
 
-        store(y, c);    y += step;
-        store(y, d);    y += step;
-        store(y, e);
+        auto out = var<DstT *>();
+        out = s.pointer();
+
+        store(out, c);  out += dst_step;
+        store(out, d);  out += dst_step;
+        store(out, e);
 
         lea(width, ptr[width + width * 2]);
-        copy<T>(ptr[dst], s.pointer(), width);
+        copy<DstT>(ptr[dst], s.pointer(), width);
     });
 
     postamble();
 }
 
-template<typename T>
-const jit_uni_converter & jit_uni_converter::get() {
-    auto createKernel = []() {
+template<typename T, typename DstT>
+const jit_uni_converter & jit_uni_converter::get(bool withScaleShift) {
+    auto createKernel = [](bool withScaleShift) {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_common)) {
-            kernel.reset(new jit_uni_converter_impl<T, cpu_isa_t::avx512_common>);
+            kernel.reset(new jit_uni_converter_impl<T, DstT, cpu_isa_t::avx512_common>(withScaleShift));
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            kernel.reset(new jit_uni_converter_impl<T, cpu_isa_t::avx2>);
+            kernel.reset(new jit_uni_converter_impl<T, DstT, cpu_isa_t::avx2>(withScaleShift));
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            kernel.reset(new jit_uni_converter_impl<T, cpu_isa_t::sse41>);
+            kernel.reset(new jit_uni_converter_impl<T, DstT, cpu_isa_t::sse41>(withScaleShift));
         } else {
             IE_THROW() << "Can't create jit color converter kernel";
         }
@@ -446,18 +527,34 @@ const jit_uni_converter & jit_uni_converter::get() {
         return std::move(kernel);
     };
 
-    static auto kernel = createKernel();
-
+    if (withScaleShift) {
+        static auto kernel = createKernel(true);
+        return *kernel;
+    }
+    static auto kernel = createKernel(false);
     return *kernel;
 }
 
+// the kernel writes the output of the fused Convert node
+template<typename T>
+const jit_uni_converter & getKernel(Precision dstPrecision, bool withScaleShift) {
+    switch (dstPrecision) {
+        case Precision::FP32:
+            return jit_uni_converter::get<T, float>(withScaleShift);
+        case Precision::BF16:
+            return jit_uni_converter::get<T, bfloat16_t>(withScaleShift);
+        default:
+            return jit_uni_converter::get<T, T>(withScaleShift);
+    }
+}
+
 template<typename T>
 class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
 public:
     using Converter::Converter;
 
     void execute(mkldnn::stream strm) override {
-        const auto & kernel = jit_uni_converter::get<T>();
+        const auto & kernel = getKernel<T>(outputPrecision(0), withScaleShift());
         const auto & dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -466,7 +563,8 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
+        uint8_t* dst = static_cast<uint8_t*>(output(0));
+        const size_t dst_size = outputPrecision(0).size();
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
@@ -475,9 +573,11 @@ public:
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.uv = uv + batch * stride_uv + (h / 2) * width;
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            args.dst = dst + (batch * width * height + h * width) * 3 * dst_size;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
+            args.scales = _scales.data();
+            args.shifts = _shifts.data();
             kernel(args);
         });
     }
@@ -489,7 +589,7 @@ public:
     using Converter::Converter;
 
     void execute(mkldnn::stream strm) override {
-        const auto & kernel = jit_uni_converter::get<T>();
+        const auto & kernel = getKernel<T>(outputPrecision(0), withScaleShift());
         const auto & dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -498,7 +598,8 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
+        uint8_t* dst = static_cast<uint8_t*>(output(0));
+        const size_t dst_size = outputPrecision(0).size();
 
         const size_t stride_y = height * width;
         const size_t stride_uv = height * width / 2;
@@ -507,9 +608,11 @@ public:
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.uv = uv + batch * stride_uv + (h / 2) * width;
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            args.dst = dst + (batch * width * height + h * width) * 3 * dst_size;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
+            args.scales = _scales.data();
+            args.shifts = _shifts.data();
             kernel(args);
         });
     }
@@ -561,6 +664,35 @@ MKLDNNColorConvertNode::MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Nod
 
 void MKLDNNColorConvertNode::getSupportedDescriptors() {}
 
+size_t MKLDNNColorConvertNode::getFusingAxis() const {
+    return Converter::C_DIM;
+}
+
+bool MKLDNNColorConvertNode::isFusedPrecisionSupported(Precision precision) {
+    if (!mayiuse(cpu_isa_t::sse41))
+        return false;
+    // the bf16 values are stored by the avx512 kernel only
+    return precision == Precision::FP32 || (precision == Precision::BF16 && mayiuse(cpu_isa_t::avx512_core));
+}
+
+bool MKLDNNColorConvertNode::canFuse(const MKLDNNNodePtr& node) const {
+    if (node->getType() == Convert) {
+        // the converter writes the output precision of the Convert instead of its own one
+        return fusedWith.empty() && node->getParentEdges().size() == 1 &&
+               getOriginalOutputPrecisionAtPort(0) == getOriginalInputPrecisionAtPort(0) &&
+               one_of(getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::FP32) &&
+               isFusedPrecisionSupported(node->getOriginalOutputPrecisionAtPort(0));
+    }
+
+    // the mean and scale normalization of the pre-processing
+    const auto outPrecision = fusedWith.empty() ? getOriginalOutputPrecisionAtPort(0)
+                                                : fusedWith.back()->getOriginalOutputPrecisionAtPort(0);
+    return node->getType() == Eltwise && node->getAlgorithm() != EltwisePrelu &&
+           node->canBePerformedAsScaleShift(this) &&
+           isFusedPrecisionSupported(outPrecision) &&
+           isFusedPrecisionSupported(node->getOriginalOutputPrecisionAtPort(0));
+}
+
 void MKLDNNColorConvertNode::initSupportedPrimitiveDescriptors() {
     if (supportedPrimitiveDescriptors.empty()) {
         switch (algorithm) {
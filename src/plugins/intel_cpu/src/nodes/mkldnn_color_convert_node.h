@@ -28,8 +28,11 @@ public:
     std::vector<VectorDims> shapeInfer() const override;
     bool needPrepareParams() const override;
     void executeDynamicImpl(mkldnn::stream strm) override;
+    bool canFuse(const MKLDNNNodePtr& node) const override;
+    size_t getFusingAxis() const override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+    static bool isFusedPrecisionSupported(InferenceEngine::Precision precision);
 
 private:
     void initSupportedNV12Impls();
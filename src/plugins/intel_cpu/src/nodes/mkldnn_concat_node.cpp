@@ -19,6 +19,7 @@
 #include "mkldnn_pooling_node.h"
 #include "mkldnn_eltwise_node.h"
 #include <limits>
+#include <numeric>
 #include "common/cpu_memcpy.h"
 #include "common/blocked_desc_creator.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
@@ -340,14 +341,14 @@ bool MKLDNNConcatNode::isOptimized() const {
 }
 
 bool MKLDNNConcatNode::needPrepareParams() const {
-    if (canOptimizeNspc) {
+    if (canOptimizeNspc || canOptimizeNcsp) {
         return false;
     }
     return inputShapesModified();
 }
 
 void MKLDNNConcatNode::prepareParams() {
-    if (canOptimizeNspc || isOptimized())
+    if (canOptimizeNspc || canOptimizeNcsp || isOptimized())
         return;
 
     const auto& dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
@@ -481,6 +482,9 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
 
     // check if selected Tensor descriptor has nspc layout and concat axis is C
     canOptimizeNspc = axis == channelAxis && getSelectedPrimitiveDescriptor()->getConfig().outConfs.front().desc->hasLayoutType(LayoutType::nspc);
+    // the planar inputs are the contiguous blocks along any axis, e.g. the outer axis of the growing caches
+    canOptimizeNcsp = isDynamicNode() && !isOptimized() &&
+                      getSelectedPrimitiveDescriptor()->getConfig().outConfs.front().desc->hasLayoutType(LayoutType::ncsp);
 }
 
 void MKLDNNConcatNode::execute(mkldnn::stream strm) {
@@ -489,8 +493,8 @@ void MKLDNNConcatNode::execute(mkldnn::stream strm) {
     }
 
     const MKLDNNMemory& dst_memory = getChildEdgeAt(0)->getMemory();
-    if (canOptimizeNspc) {
-        execNspcSpecCase();
+    if (canOptimizeNspc || canOptimizeNcsp) {
+        execBlocksSpecCase();
         return;
     }
 
@@ -513,7 +517,7 @@ InferenceEngine::Precision MKLDNNConcatNode::getRuntimePrecision() const {
     return getMaxPrecision(getInputPrecisions());
 }
 
-void MKLDNNConcatNode::execNspcSpecCase() {
+void MKLDNNConcatNode::execBlocksSpecCase() {
     const MKLDNNMemory& dst_memory = getChildEdgeAt(0)->getMemory();
     const size_t num_src = getParentEdges().size();
     uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(dst_memory.GetData());
@@ -531,7 +535,10 @@ void MKLDNNConcatNode::execNspcSpecCase() {
         if (src_mem.GetShape().hasZeroDims()) {
             continue;
         }
-        const size_t num_channels = src_mem.getStaticDims()[channelAxis];
+        // the block of the input per outer index: the channels of nspc or all the dims from the axis of ncsp
+        const auto& srcDims = src_mem.getStaticDims();
+        const size_t num_channels = canOptimizeNspc ? srcDims[channelAxis] :
+                                    std::accumulate(srcDims.begin() + axis, srcDims.end(), 1lu, std::multiplies<size_t>());
 
         channelsDataSize.push_back(num_channels * dataSize);
         src_ptrs.push_back(reinterpret_cast<const uint8_t*>(src_mem.GetData()));
@@ -547,12 +554,27 @@ void MKLDNNConcatNode::execNspcSpecCase() {
 
     const size_t iter_count = getParentEdgeAt(firstNonZeroEdge)->getMemory().GetSize() / channelsDataSize[0];
 
-    parallel_for(iter_count, [&](int i) {
-        const size_t dst_off = i * channels_size;
-        for (int j = 0; j < nonZeroInShapes; j++) {
-            cpu_memcpy(dst_ptrs[j] + dst_off, src_ptrs[j] + i * channelsDataSize[j], channelsDataSize[j]);
-        }
-    });
+    if (iter_count >= static_cast<size_t>(parallel_get_max_threads())) {
+        parallel_for(iter_count, [&](int i) {
+            const size_t dst_off = i * channels_size;
+            for (int j = 0; j < nonZeroInShapes; j++) {
+                cpu_memcpy(dst_ptrs[j] + dst_off, src_ptrs[j] + i * channelsDataSize[j], channelsDataSize[j]);
+            }
+        });
+    } else {
+        // a few big blocks, e.g. of the outer axis, are split between the threads
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            for (size_t i = 0; i < iter_count; i++) {
+                const size_t dst_off = i * channels_size;
+                for (int j = 0; j < nonZeroInShapes; j++) {
+                    size_t start = 0, end = 0;
+                    splitter(channelsDataSize[j], nthr, ithr, start, end);
+                    if (start < end)
+                        cpu_memcpy(dst_ptrs[j] + dst_off + start, src_ptrs[j] + i * channelsDataSize[j] + start, end - start);
+                }
+            }
+        });
+    }
 }
 
 REG_MKLDNN_PRIM_FOR(MKLDNNConcatNode, Concatenation);
\ No newline at end of file
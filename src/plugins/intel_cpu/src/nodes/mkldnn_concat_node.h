@@ -25,6 +25,9 @@ public:
     void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
 
     bool isOptimized() const;
+    size_t getAxis() const {
+        return axis;
+    }
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
@@ -36,9 +39,11 @@ private:
     size_t axis = 0;
     bool canBeInPlace = false;
     bool canOptimizeNspc = false;
+    // the dynamic planar concat copies the inputs directly instead of the primitive rebuilt for every shape
+    bool canOptimizeNcsp = false;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
-    void execNspcSpecCase();
+    void execBlocksSpecCase();
 
     InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
     InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
@@ -943,10 +943,6 @@ void MKLDNNConvolutionNode::prepareParams() {
             IE_THROW() << "Input memory didn't allocate.";
     }
 
-    const NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
-    if (selected_pd == nullptr)
-        IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
-
     auto inMemoryDesc = srcMemPtr->GetDescWithType<DnnlMemoryDesc>();
     auto weightMemoryDesc = wghMemPtr->GetDescWithType<DnnlMemoryDesc>();
     auto outMemoryDesc = dstMemPtr->GetDescWithType<DnnlMemoryDesc>();
@@ -955,84 +951,135 @@ void MKLDNNConvolutionNode::prepareParams() {
         biasDesc = biasMemPtr->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
     }
 
-    auto initPrimitiveAttr = [&]() {
-        mkldnn::primitive_attr attr;
-        addZeroPoints(attr);
-        setPostOps(attr, outMemoryDesc->getShape().getStaticDims(), true);
-
-        return std::make_shared<mkldnn::primitive_attr>(std::move(attr));
-    };
-
     AttrPtr pAttrLocal;
 
     if (isDynamicNode()) {
         if (!pAttr) {
-            pAttr = initPrimitiveAttr();
+            pAttr = createPrimitiveAttr(outMemoryDesc->getShape().getStaticDims());
         }
         pAttrLocal = pAttr;
     } else {
-        pAttrLocal = initPrimitiveAttr();
+        pAttrLocal = createPrimitiveAttr(outMemoryDesc->getShape().getStaticDims());
+    }
+
+    // the precompiled batch buckets cover any batch, so only the arguments are updated
+    if (!batchBucketsExecPtr) {
+        execPtr = createExecutor(inMemoryDesc->getDnnlDesc(),
+                                 weightMemoryDesc->getDnnlDesc(),
+                                 outMemoryDesc->getDnnlDesc(),
+                                 biasDesc,
+                                 *pAttrLocal);
+        if (!execPtr) {
+            IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+        }
+    }
+
+    primArgs[DNNL_ARG_SRC] = srcMemPtr->GetPrimitive();
+    primArgs[DNNL_ARG_WEIGHTS] = wghMemPtr->GetPrimitive();
+    primArgs[DNNL_ARG_DST] = dstMemPtr->GetPrimitive();
+
+    if (withBiases) {
+        primArgs[DNNL_ARG_BIAS] = biasMemPtr->GetPrimitive();
     }
 
-    std::shared_ptr<MKLDNNDescriptor> desc = createMkldnnConvDesc(inMemoryDesc->getDnnlDesc(),
-                                                                  weightMemoryDesc->getDnnlDesc(),
-                                                                  outMemoryDesc->getDnnlDesc(),
-                                                                  biasDesc);
+    MKLDNNNode::appendPostOpArgs(*pAttrLocal, primArgs, binaryPostOpsArgs);
+}
+
+MKLDNNNode::AttrPtr MKLDNNConvolutionNode::createPrimitiveAttr(const VectorDims& dims) {
+    mkldnn::primitive_attr attr;
+    addZeroPoints(attr);
+    setPostOps(attr, dims, true);
+
+    return std::make_shared<mkldnn::primitive_attr>(std::move(attr));
+}
+
+MKLDNNConvolutionNode::executorPtr MKLDNNConvolutionNode::createExecutor(const mkldnn::memory::desc& srcDesc,
+                                                                         const mkldnn::memory::desc& wghDesc,
+                                                                         const mkldnn::memory::desc& dstDesc,
+                                                                         const mkldnn::memory::desc& biasDesc,
+                                                                         const mkldnn::primitive_attr& attr) {
+    const NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
-    auto itpd = desc->createPrimitiveDescriptorIterator(getEngine(), *pAttrLocal);
+    std::shared_ptr<MKLDNNDescriptor> desc = createMkldnnConvDesc(srcDesc, wghDesc, dstDesc, biasDesc);
 
-    convolution_forward::primitive_desc prim_desc;
+    auto itpd = desc->createPrimitiveDescriptorIterator(getEngine(), attr);
 
-    execPtr = nullptr;
     while (static_cast<bool>(itpd)) {
         impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
         if (impl_type == selected_pd->getImplementationType()) {
-            prim_desc = convolution_forward::primitive_desc(itpd.get());
-            execPtr = std::make_shared<ConvolutionExecutor>(prim_desc,
-                                                            srcMemPtr->GetPrimitive().get_desc(),
-                                                            wghMemPtr->GetPrimitive().get_desc(),
-                                                            dstMemPtr->GetPrimitive().get_desc(),
-                                                            getEngine());
-            break;
+            auto prim_desc = convolution_forward::primitive_desc(itpd.get());
+            return std::make_shared<ConvolutionExecutor>(prim_desc, srcDesc, wghDesc, dstDesc, getEngine());
         }
 
         if (!itpd.next_impl()) {
-            auto inDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(srcMemPtr->getStaticDims()),
-                                                                                       srcMemPtr->GetDataType(),
-                                                                                       memory::format_tag::any);
-            auto wghDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(wghMemPtr->getStaticDims()),
-                                                                                        wghMemPtr->GetDataType(),
-                                                                                        memory::format_tag::any);
-            auto outDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(dstMemPtr->getStaticDims()),
-                                                                                        dstMemPtr->GetDataType(),
-                                                                                        memory::format_tag::any);
-
-            std::shared_ptr<MKLDNNDescriptor> reorderConvDesc = createMkldnnConvDesc(inDesc, wghDesc, outDesc, biasDesc);
-            auto reordItpd = reorderConvDesc->createPrimitiveDescriptorIterator(getEngine(), *pAttrLocal);
+            auto inDesc = mkldnn::memory::desc(srcDesc.dims(), srcDesc.data_type(), memory::format_tag::any);
+            auto wghAnyDesc = mkldnn::memory::desc(wghDesc.dims(), wghDesc.data_type(), memory::format_tag::any);
+            auto outDesc = mkldnn::memory::desc(dstDesc.dims(), dstDesc.data_type(), memory::format_tag::any);
+
+            std::shared_ptr<MKLDNNDescriptor> reorderConvDesc = createMkldnnConvDesc(inDesc, wghAnyDesc, outDesc, biasDesc);
+            auto reordItpd = reorderConvDesc->createPrimitiveDescriptorIterator(getEngine(), attr);
             if (static_cast<bool>(reordItpd)) {
                 auto prim_desc = convolution_forward::primitive_desc(reordItpd.get());
-                execPtr = std::make_shared<ConvolutionExecutor>(prim_desc, srcMemPtr->GetPrimitive().get_desc(),
-                                                                wghMemPtr->GetPrimitive().get_desc(),
-                                                                dstMemPtr->GetPrimitive().get_desc(),
-                                                                getEngine());
-                break;
+                return std::make_shared<ConvolutionExecutor>(prim_desc, srcDesc, wghDesc, dstDesc, getEngine());
             }
         }
     }
-    if (execPtr) {
-        primArgs[DNNL_ARG_SRC] = srcMemPtr->GetPrimitive();
-        primArgs[DNNL_ARG_WEIGHTS] = wghMemPtr->GetPrimitive();
-        primArgs[DNNL_ARG_DST] = dstMemPtr->GetPrimitive();
+    return nullptr;
+}
 
-        if (withBiases) {
-            primArgs[DNNL_ARG_BIAS] = biasMemPtr->GetPrimitive();
-        }
+void MKLDNNConvolutionNode::initBatchBucketsExecutor() {
+    batchBucketsExecPtr = nullptr;
+    const auto& buckets = getBatchBuckets();
+    if (buckets.empty() || !isDynamicNode() || withDWConv)
+        return;
 
-        MKLDNNNode::appendPostOpArgs(*pAttrLocal, primArgs, binaryPostOpsArgs);
-    } else {
-        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+    auto isOnlyBatchDynamic = [](const VectorDims& dims) {
+        return !dims.empty() && std::none_of(dims.begin() + 1, dims.end(), [](Dim dim) { return dim == Shape::UNDEFINED_DIM; });
+    };
+    const auto& srcEdgeDesc = getParentEdgeAt(0)->getDesc();
+    const auto& dstEdgeDesc = getChildEdgeAt(0)->getDesc();
+    if (!isOnlyBatchDynamic(srcEdgeDesc.getShape().getDims()) || !isOnlyBatchDynamic(dstEdgeDesc.getShape().getDims()))
+        return;
+
+    auto wghMemPtr = getParentEdgesAtPort(1)[0]->getMemoryPtr();
+    if (!wghMemPtr || !wghMemPtr->GetPrimitivePtr() || !getParentEdgeAt(1)->getParent()->isConstant())
+        return;
+    mkldnn::memory::desc biasDesc;
+    if (withBiases) {
+        auto biasMemPtr = getParentEdgesAtPort(2)[0]->getMemoryPtr();
+        if (!biasMemPtr || !biasMemPtr->GetPrimitivePtr())
+            return;
+        biasDesc = biasMemPtr->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+    }
+    const auto wghDesc = wghMemPtr->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+
+    auto makeDesc = [](const MemoryDesc& desc, size_t batch) {
+        auto dims = desc.getShape().getDims();
+        dims[0] = batch;
+        return MemoryDescUtils::convertToDnnlMemoryDesc(desc.cloneWithNewDims(dims))->getDnnlDesc();
+    };
+    const auto maxBatch = buckets.back();
+    if (!DnnlBatchBucketsExecutor::isBatchOutermost(makeDesc(srcEdgeDesc, maxBatch)) ||
+        !DnnlBatchBucketsExecutor::isBatchOutermost(makeDesc(dstEdgeDesc, maxBatch)))
+        return;
+
+    auto dstDims = dstEdgeDesc.getShape().getDims();
+    dstDims[0] = maxBatch;
+    if (!pAttr) {
+        pAttr = createPrimitiveAttr(dstDims);
     }
+    auto builder = [&](size_t batch) {
+        return createExecutor(makeDesc(srcEdgeDesc, batch), wghDesc, makeDesc(dstEdgeDesc, batch), biasDesc, *pAttr);
+    };
+    batchBucketsExecPtr = std::make_shared<DnnlBatchBucketsExecutor>(buckets, builder, std::vector<int>{DNNL_ARG_SRC, DNNL_ARG_DST});
+}
+
+void MKLDNNConvolutionNode::createPrimitive() {
+    initBatchBucketsExecutor();
+    MKLDNNNode::createPrimitive();
 }
 
 MKLDNNConvolutionNode::ConvolutionExecutor::ConvolutionExecutor(const mkldnn::convolution_forward::primitive_desc& pd,
@@ -1056,6 +1103,10 @@ MKLDNNConvolutionNode::ConvolutionExecutor::ConvolutionExecutor(const mkldnn::co
 }
 
 void MKLDNNConvolutionNode::execute(mkldnn::stream strm) {
+    if (batchBucketsExecPtr) {
+        batchBucketsExecPtr->exec(primArgs, getParentEdgeAt(0)->getMemory().getStaticDims()[0], strm);
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't execute Convolution node with name: " << getName() << ", because executor is not compiled";
     }
@@ -27,6 +27,7 @@ public:
     void selectOptimalPrimitiveDescriptor() override;
     void initSupportedPrimitiveDescriptors() override;
     void filterSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -67,6 +68,8 @@ protected:
 private:
     using executorPtr = std::shared_ptr<DnnlExecutor>;
     executorPtr execPtr = nullptr;
+    // the executors precompiled for the batch buckets, used instead of execPtr when only the batch is dynamic
+    DnnlBatchBucketsExecutor::Ptr batchBucketsExecPtr = nullptr;
 
     class ConvolutionExecutor : public DnnlExecutor {
         public:
@@ -82,6 +85,13 @@ private:
                                                            const mkldnn::memory::desc& dstDesc,
                                                            const mkldnn::memory::desc& biasDesc);
 
+    AttrPtr createPrimitiveAttr(const VectorDims& dims);
+    executorPtr createExecutor(const mkldnn::memory::desc& srcDesc,
+                               const mkldnn::memory::desc& wghDesc,
+                               const mkldnn::memory::desc& dstDesc,
+                               const mkldnn::memory::desc& biasDesc,
+                               const mkldnn::primitive_attr& attr);
+    void initBatchBucketsExecutor();
     void prepareParams() override;
     void execute(mkldnn::stream strm) override;
     void executeDynamicImpl(mkldnn::stream strm) override;
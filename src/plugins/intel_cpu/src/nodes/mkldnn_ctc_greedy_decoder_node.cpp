@@ -8,6 +8,7 @@
 #include <ngraph/op/ctc_greedy_decoder.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_ctc_greedy_decoder_node.h"
+#include "common/ctc_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -75,7 +76,6 @@ void MKLDNNCTCGreedyDecoderNode::execute(mkldnn::stream strm) {
     const size_t B = getParentEdgeAt(DATA_INDEX)->getMemory().getStaticDims()[1];
     const int C = getParentEdgeAt(DATA_INDEX)->getMemory().getStaticDims()[2];
     const size_t BC = B * C;
-    const size_t CB1 = C * (B - 1);
 
     const int blankIndex = C - 1;
 
@@ -120,19 +120,8 @@ void MKLDNNCTCGreedyDecoderNode::execute(mkldnn::stream strm) {
             size_t sequenceLength = sequenceLengths[b];
 
             for (size_t t = tStart; t < sequenceLength; ++t) {
-                int maxClassIdx = 0;
-
-                float maxProb = probs[0];
-                ++probs;
-
-                for (int c = 1; c < C; ++c, ++probs) {
-                    if (*probs > maxProb) {
-                        maxClassIdx = c;
-                        maxProb = *probs;
-                    }
-                }
-                probs += CB1;
-                outputSequences[outputIndex++] = static_cast<float>(maxClassIdx);
+                outputSequences[outputIndex++] = static_cast<float>(ctc::argMax(probs, C));
+                probs += BC;
 
                 if (++workCounter >= end) {
                     return;
@@ -8,6 +8,7 @@
 #include <ngraph/op/ctc_greedy_decoder_seq_len.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_ctc_greedy_decoder_seq_len_node.h"
+#include "common/ctc_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -123,17 +124,8 @@ void MKLDNNCTCGreedyDecoderSeqLenNode::execute(mkldnn::stream strm) {
             const size_t actualSeqLen = sequenceLengths[b];
 
             for (size_t t = tStart; t < actualSeqLen; ++t) {
-                int maxClassIdx = 0;
-                float maxProb = probs[0];
-                probs++;
-
-                for (int c = 1; c < C; c++, probs++) {
-                    if (*probs > maxProb) {
-                        maxClassIdx = c;
-                        maxProb = *probs;
-                    }
-                }
-                decodedClasses[outputIndex++] = maxClassIdx;
+                decodedClasses[outputIndex++] = ctc::argMax(probs, C);
+                probs += C;
 
                 if (++workCounter >= end) {
                     return;
@@ -7,6 +7,7 @@
 #include <ngraph/op/ctc_loss.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_ctc_loss_node.h"
+#include "common/ctc_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -82,7 +83,9 @@ void MKLDNNCTCLossNode::execute(mkldnn::stream strm) {
 
     std::vector<int> decodedTargetLenB(batchNum, 0);
     std::vector<std::vector<int>> targetDB(batchNum);
-    std::vector<std::vector<std::vector<float>>> logProbabilitiesB(batchNum);
+    // the log probabilities of the decoded target of every time step: [t][s], the rows are padded by 2 elements,
+    // so the backward recursion reads s + 1 and s + 2 without the checks
+    std::vector<std::vector<float>> logProbabilitiesB(batchNum);
     std::vector<std::string> errorMsgB(parallel_get_max_threads());
 
     auto threadBody_1 = [&](const int ithr, const int nthr) {
@@ -143,11 +146,7 @@ void MKLDNNCTCLossNode::execute(mkldnn::stream strm) {
             }
             decodedTargetLenB[b] = decodedTargetLen;
 
-            auto& logProbabilities = logProbabilitiesB[b];
-            logProbabilities.resize(actualLogitLen);
-            for (size_t ll = 0; ll < actualLogitLen; ll++) {
-                logProbabilities[ll].resize(decodedTargetLen);
-            }
+            logProbabilitiesB[b].assign(actualLogitLen * (decodedTargetLen + 2), 0.f);
         } // for batch
     }; // threadBody_1
 
@@ -187,21 +186,19 @@ void MKLDNNCTCLossNode::execute(mkldnn::stream strm) {
         for (size_t b = sB; b < batchNum; b++) {
             const size_t actualLogitLen = logitsLength[b];
             const size_t decodedTargetLen = decodedTargetLenB[b];
-            auto& logProbabilities = logProbabilitiesB[b];
-            auto& targetD = targetDB[b];
+            const size_t rowSize = decodedTargetLen + 2;
+            float* logProbabilities = logProbabilitiesB[b].data() + sT * rowSize;
+            const int* targetD = targetDB[b].data();
 
-            double expSum = 0.0;
-            size_t btcT = b * TC + sT * classesNum;
+            const float* logitsT = logits + b * TC + sT * classesNum;
             // logProbabilities = logSoftmax = logits[b][t][c] - ln(sum_c(exp(logits[b][t])))
             for (size_t t = sT; t < actualLogitLen; t++) {
-                expSum = 0.0;
-                for (size_t c = 0lu; c < classesNum; c++) {
-                    expSum += std::exp(logits[btcT + c]);
-                }
+                const float logExpSum = ctc::logSumExp(logitsT, classesNum);
                 for (size_t s = 0lu; s < decodedTargetLen; s++) {
-                    logProbabilities[t][s] = logits[btcT + targetD[s]] - std::log(expSum);
+                    logProbabilities[s] = logitsT[targetD[s]] - logExpSum;
                 }
-                btcT += classesNum;
+                logitsT += classesNum;
+                logProbabilities += rowSize;
                 if (++workCounter >= end) {
                     return;
                 }
@@ -214,67 +211,49 @@ void MKLDNNCTCLossNode::execute(mkldnn::stream strm) {
 
     const auto float_inf = std::numeric_limits<float>::infinity();
 
-    auto sumLogs = [&float_inf](float log1, float log2) {
-        if (log1 == -float_inf) {
-            return log2;
-        } else if (log2 == -float_inf) {
-            return log1;
-        } else {
-            if (log1 > log2)
-                return log1 + std::log1pf(std::exp(log2 - log1));
-            else
-                return log2 + std::log1pf(std::exp(log1 - log2));
-        }
-    };
-
-    auto threadBody_3 = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(batchNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-
+    // The recursion is sequential in time, so the batches are computed in parallel. Only the rows of the current and
+    // the next time steps of the backward variables are kept, the terms of a row are independent and are calculated
+    // with the precomputed transitions, so the loop over the decoded target is vectorized
+    parallel_for(batchNum, [&](size_t b) {
         // As per Connectionist Temporal Classification - Labeling Unsegmented Sequence Data with Recurrent Neural Networks:
         // Graves et al., 2016, paragraph 4.1 (10)
-        for (size_t b = start; b < end; b++) {
-            auto& targetD = targetDB[b];
-            auto& logProbabilities = logProbabilitiesB[b];
-            const int actualLogitLen = logitsLength[b];
-            const int decodedTargetLen = decodedTargetLenB[b];
-            std::vector<std::vector<float>> logBwd(decodedTargetLen, std::vector<float>(actualLogitLen, -float_inf));
-            for (int s = decodedTargetLen - 2; s < decodedTargetLen; s++)
-                logBwd[s][actualLogitLen - 1] = 0.f;
-
-            for (int t = actualLogitLen - 2; t >= 0; t--) {
-                const int t_1 = t + 1;
-                for (int s = std::max(0, decodedTargetLen - (2 * (actualLogitLen - t)));
-                     s < std::min(decodedTargetLen, 2 * (t_1)); s++) {
-                    if (ctcMergeRepeated || targetD[s] == blankIndex) {
-                        logBwd[s][t] = sumLogs(logBwd[s][t],
-                                               logBwd[s][t_1] + logProbabilities[t_1][s]);
-                    }
-
-                    if (s + 1 < decodedTargetLen) {
-                        logBwd[s][t] = sumLogs(logBwd[s][t],
-                                               logBwd[s + 1][t_1] + logProbabilities[t_1][s + 1]);
-                    }
+        const auto& targetD = targetDB[b];
+        const int actualLogitLen = logitsLength[b];
+        const int decodedTargetLen = decodedTargetLenB[b];
+        const size_t rowSize = decodedTargetLen + 2;
+        const float* logProbabilities = logProbabilitiesB[b].data();
+
+        // the transitions to the same and to the next but one symbols, the transition to the next symbol is always allowed
+        std::vector<uint8_t> canStay(decodedTargetLen), canSkip(decodedTargetLen);
+        for (int s = 0; s < decodedTargetLen; s++) {
+            canStay[s] = ctcMergeRepeated || targetD[s] == blankIndex;
+            canSkip[s] = s + 2 < decodedTargetLen && targetD[s] != blankIndex &&
+                         (!ctcMergeRepeated || targetD[s] != targetD[s + 2]);
+        }
 
-                    if (s + 2 < decodedTargetLen) {
-                        if (targetD[s] != blankIndex && (!ctcMergeRepeated || (targetD[s] != targetD[s + 2]))) {
-                            logBwd[s][t] = sumLogs(logBwd[s][t],
-                                                   logBwd[s + 2][t_1] + logProbabilities[t_1][s + 2]);
-                        }
-                    }
-                }
+        // the padding elements of the rows are never written and stay -infinity
+        std::vector<float> logBwdCur(rowSize, -float_inf), logBwdNext(rowSize, -float_inf);
+        for (int s = std::max(0, decodedTargetLen - 2); s < decodedTargetLen; s++)
+            logBwdNext[s] = 0.f;
+
+        for (int t = actualLogitLen - 2; t >= 0; t--) {
+            const float* logProbNext = logProbabilities + (t + 1) * rowSize;
+            const int sStart = std::max(0, decodedTargetLen - (2 * (actualLogitLen - t)));
+            const int sEnd = std::min(decodedTargetLen, 2 * (t + 1));
+            std::fill(logBwdCur.begin(), logBwdCur.begin() + decodedTargetLen, -float_inf);
+            for (int s = sStart; s < sEnd; s++) {
+                const float stay = canStay[s] ? logBwdNext[s] + logProbNext[s] : -float_inf;
+                const float next = logBwdNext[s + 1] + logProbNext[s + 1];
+                const float skip = canSkip[s] ? logBwdNext[s + 2] + logProbNext[s + 2] : -float_inf;
+                logBwdCur[s] = ctc::sumLogs(stay, next, skip);
             }
+            std::swap(logBwdCur, logBwdNext);
+        }
 
-            logBwd[0][0] += logProbabilities[0][0];
-            logBwd[1][0] += logProbabilities[0][(decodedTargetLen > 1) ? 1 : 0];
-
-            dstData[b] = -sumLogs(logBwd[0][0], logBwd[1][0]);
-        } // for batch
-    }; // threadBody_3
-
-    parallel_nt(0, threadBody_3);
+        const float logBwd0 = logBwdNext[0] + logProbabilities[0];
+        const float logBwd1 = decodedTargetLen > 1 ? logBwdNext[1] + logProbabilities[1] : -float_inf;
+        dstData[b] = -ctc::sumLogs(logBwd0, logBwd1, -float_inf);
+    });
 }
 
 bool MKLDNNCTCLossNode::created() const {
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -214,6 +215,10 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
         }
     }
 
+    // only the boxes of the candidates left after the confidence filter and top-k are decoded
+    if (isShareLoc)
+        markCandidatePriors(indicesBufData, detectionsData);
+
     int *confInfoV = confInfoForPrior.data();
 
     for (int n = 0; n < imgNum; ++n) {
@@ -303,9 +308,13 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
 
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            // the detections of each class are gathered at its offset, so the classes don't contend for a lock
+            std::vector<int> classOffsets(classesNum + 1, 0);
+            for (int c = 0; c < classesNum; ++c) {
+                classOffsets[c + 1] = classOffsets[c] + detectionsData[n * classesNum + c];
+            }
+            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap(detectionsTotal);
 
-            std::mutex mtx;
             parallel_for(classesNum, [&](int c) {
                 int detections = detectionsData[n * classesNum + c];
                 int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
@@ -314,14 +323,13 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
 
                 for (int i = 0; i < detections; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
-                    confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
+                    confIndicesClassMap[classOffsets[c] + i] = std::make_pair(pconf[pr], std::make_pair(c, pr));
                 }
             });
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            // only the kept detections are ordered
+            std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK, confIndicesClassMap.end(),
+                              SortScorePairDescend<std::pair<int, int>>);
             confIndicesClassMap.resize(keepTopK);
 
             // Store the new indices. Assign to class back
@@ -614,6 +622,29 @@ inline void MKLDNNDetectionOutputNode::confReorderAndFilterSparsityMX(const floa
     }
 }
 
+// flags the priors which are the candidates of any class, the indices of the candidates are in the top-k buffers:
+// per class for caffe style, per image with the class id for MXNet style
+inline void MKLDNNDetectionOutputNode::markCandidatePriors(const int* indicesBufData, const int* detectionsData) {
+    parallel_for(imgNum, [&](int n) {
+        int *confInfoV = confInfoForPrior.data() + n * priorsNum;
+        std::fill_n(confInfoV, priorsNum, -1);
+        const int *pbuffer = indicesBufData + n * classesNum * priorsNum;
+        if (decreaseClassId) {
+            for (int i = 0; i < detectionsData[n * classesNum]; ++i) {
+                confInfoV[pbuffer[i] % priorsNum] = 1;
+            }
+        } else {
+            for (int c = 0; c < classesNum; ++c) {
+                if (c == backgroundClassId)
+                    continue;
+                for (int i = 0; i < detectionsData[n * classesNum + c]; ++i) {
+                    confInfoV[pbuffer[c * priorsNum + i]] = 1;
+                }
+            }
+        }
+    });
+}
+
 inline void MKLDNNDetectionOutputNode::decodeBBoxes(const float *priorData,
                                        const float *locData,
                                        const float *varianceData,
@@ -634,7 +665,7 @@ inline void MKLDNNDetectionOutputNode::decodeBBoxes(const float *priorData,
         return;
     }
     parallel_for(prNum, [&](int p) {
-        if (isSparsityWorthwhile && isShareLoc && confInfoV[p] == -1) {
+        if (isShareLoc && confInfoV[p] == -1) {
             return;
         }
         float newXMin = 0.0f;
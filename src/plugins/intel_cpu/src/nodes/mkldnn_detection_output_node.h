@@ -82,6 +82,8 @@ private:
     inline void confReorderAndFilterSparsityMX(const float* confData, const float* ARMConfData, float* reorderedConfData,
         int* indicesData, int* indicesBufData, int* detectionsData);
 
+    inline void markCandidatePriors(const int* indicesBufData, const int* detectionsData);
+
     inline void decodeBBoxes(const float* prior_data, const float* loc_data, const float* variance_data,
                       float* decoded_bboxes, float* decoded_bbox_sizes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
                       bool decodeType = true, const int* conf_info_h = nullptr, const int* conf_info_v = nullptr); // decodeType is false after ARM
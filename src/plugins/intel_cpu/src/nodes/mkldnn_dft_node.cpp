@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <complex>
+#include <memory>
 #include <mkldnn_extension_utils.h>
 
 #include "mkldnn_dft_node.h"
@@ -19,6 +21,8 @@ using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+using complex = std::complex<float>;
+
 bool MKLDNNDFTNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (isDynamicNgraphNode(op)) {
@@ -105,6 +109,24 @@ void MKLDNNDFTNode::initSupportedPrimitiveDescriptors() {
     addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::ref_any);
 }
 
+namespace MKLDNNPlugin {
+
+/*
+    The FFT plan of the length which is not a power of two: the mixed radix (4, 2, 3, 5) Stockham FFT with the
+    precomputed twiddles, or Bluestein's algorithm with the chirp convolution by the power of two FFT for the lengths
+    with the other prime factors
+*/
+struct DFTPlan {
+    size_t length = 0;
+    std::vector<size_t> radices;
+    std::vector<complex> twiddles;
+    std::vector<complex> chirp;
+    std::vector<complex> kernel;
+    std::unique_ptr<DFTPlan> padded;
+};
+
+}  // namespace MKLDNNPlugin
+
 namespace {
 inline float getRealFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
     return lhsReal * rhsReal - lhsImag * rhsImag;
@@ -224,6 +246,175 @@ void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t
     } while (copyStep(iterationCounter, iterationRange));
 }
 
+/*
+    Radices of the mixed radix FFT, empty if the length has the other prime factors
+*/
+std::vector<size_t> factorize(size_t n) {
+    std::vector<size_t> radices;
+    for (size_t radix : {4, 2, 3, 5}) {
+        while (n % radix == 0) {
+            radices.push_back(radix);
+            n /= radix;
+        }
+    }
+    return n == 1 ? radices : std::vector<size_t>{};
+}
+
+/*
+    Stockham autosort FFT: every stage splits the sequences of the length `len` into `radix` interleaved subsequences,
+    so the data is never permuted. The result is written to `x` or `y`, the pointer to it is returned
+*/
+complex* stockhamFFT(const DFTPlan& plan, complex* x, complex* y) {
+    const size_t n = plan.length;
+    const complex* w = plan.twiddles.data();
+    size_t stride = 1;
+    size_t len = n;
+    for (const auto radix : plan.radices) {
+        const size_t m = len / radix;
+        for (size_t p = 0; p < m; ++p) {
+            const size_t twiddleStep = p * stride;
+            const complex w1 = w[twiddleStep % n];
+            const complex w2 = w[(2 * twiddleStep) % n];
+            const complex w3 = w[(3 * twiddleStep) % n];
+            const complex w4 = w[(4 * twiddleStep) % n];
+            const complex* in = x + stride * p;
+            complex* out = y + stride * radix * p;
+            const size_t inStep = stride * m;
+            switch (radix) {
+            case 2:
+                for (size_t q = 0; q < stride; ++q) {
+                    const complex a0 = in[q], a1 = in[q + inStep];
+                    out[q] = a0 + a1;
+                    out[q + stride] = (a0 - a1) * w1;
+                }
+                break;
+            case 3: {
+                const float sin60 = 0.866025403784438646763723f;
+                for (size_t q = 0; q < stride; ++q) {
+                    const complex a0 = in[q], a1 = in[q + inStep], a2 = in[q + 2 * inStep];
+                    const complex t1 = a1 + a2;
+                    const complex d = a1 - a2;
+                    const complex t2{d.imag() * sin60, -d.real() * sin60};  // -i * sin60 * (a1 - a2)
+                    const complex b = a0 - 0.5f * t1;
+                    out[q] = a0 + t1;
+                    out[q + stride] = (b + t2) * w1;
+                    out[q + 2 * stride] = (b - t2) * w2;
+                }
+                break;
+            }
+            case 4:
+                for (size_t q = 0; q < stride; ++q) {
+                    const complex a0 = in[q], a1 = in[q + inStep], a2 = in[q + 2 * inStep], a3 = in[q + 3 * inStep];
+                    const complex s02 = a0 + a2, d02 = a0 - a2;
+                    const complex s13 = a1 + a3, d13 = a1 - a3;
+                    const complex md13{d13.imag(), -d13.real()};  // -i * (a1 - a3)
+                    out[q] = s02 + s13;
+                    out[q + stride] = (d02 + md13) * w1;
+                    out[q + 2 * stride] = (s02 - s13) * w2;
+                    out[q + 3 * stride] = (d02 - md13) * w3;
+                }
+                break;
+            case 5: {
+                const float c1 = 0.309016994374947424102293f, c2 = -0.809016994374947424102293f;
+                const float s1 = 0.951056516295153572116439f, s2 = 0.587785252292473129168706f;
+                for (size_t q = 0; q < stride; ++q) {
+                    const complex a0 = in[q], a1 = in[q + inStep], a2 = in[q + 2 * inStep], a3 = in[q + 3 * inStep],
+                                  a4 = in[q + 4 * inStep];
+                    const complex t1 = a1 + a4, t2 = a2 + a3;
+                    const complex d1 = a1 - a4, d2 = a2 - a3;
+                    const complex b1 = a0 + c1 * t1 + c2 * t2;
+                    const complex b2 = a0 + c2 * t1 + c1 * t2;
+                    // -i * (s1 * d1 + s2 * d2) and -i * (s2 * d1 - s1 * d2)
+                    const complex e1 = s1 * d1 + s2 * d2;
+                    const complex e2 = s2 * d1 - s1 * d2;
+                    const complex me1{e1.imag(), -e1.real()};
+                    const complex me2{e2.imag(), -e2.real()};
+                    out[q] = a0 + t1 + t2;
+                    out[q + stride] = (b1 + me1) * w1;
+                    out[q + 2 * stride] = (b2 + me2) * w2;
+                    out[q + 3 * stride] = (b2 - me2) * w3;
+                    out[q + 4 * stride] = (b1 - me1) * w4;
+                }
+                break;
+            }
+            }
+        }
+        std::swap(x, y);
+        stride *= radix;
+        len = m;
+    }
+    return x;
+}
+
+std::unique_ptr<DFTPlan> createDFTPlan(size_t n) {
+    std::unique_ptr<DFTPlan> plan(new DFTPlan);
+    plan->length = n;
+    plan->radices = factorize(n);
+    const double pi = 3.141592653589793238462643;
+    if (!plan->radices.empty() || n == 1) {
+        plan->twiddles.resize(n);
+        for (size_t k = 0; k < n; ++k) {
+            const double angle = -2.0 * pi * static_cast<double>(k) / static_cast<double>(n);
+            plan->twiddles[k] = complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+        }
+        return plan;
+    }
+
+    // Bluestein's algorithm: the DFT is computed as the convolution with the chirp by the FFT of the power of two length
+    size_t paddedLength = 1;
+    while (paddedLength < 2 * n - 1)
+        paddedLength *= 2;
+    plan->padded = createDFTPlan(paddedLength);
+    plan->chirp.resize(n);
+    for (size_t k = 0; k < n; ++k) {
+        // k^2 mod 2n keeps the angle precise for the big lengths
+        const double angle = -pi * static_cast<double>((k * k) % (2 * n)) / static_cast<double>(n);
+        plan->chirp[k] = complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+    }
+    std::vector<complex> kernel(paddedLength), scratch(paddedLength);
+    kernel[0] = std::conj(plan->chirp[0]);
+    for (size_t k = 1; k < n; ++k) {
+        kernel[k] = kernel[paddedLength - k] = std::conj(plan->chirp[k]);
+    }
+    auto result = stockhamFFT(*plan->padded, kernel.data(), scratch.data());
+    plan->kernel.assign(result, result + paddedLength);
+    return plan;
+}
+
+/*
+    Forward DFT of `plan.length` complex values in place, `scratch` is resized as needed
+*/
+void forwardDFT(const DFTPlan& plan, complex* data, std::vector<complex>& scratch) {
+    const size_t n = plan.length;
+    if (!plan.padded) {
+        if (n <= 1)
+            return;
+        scratch.resize(n);
+        auto result = stockhamFFT(plan, data, scratch.data());
+        if (result != data)
+            std::copy(result, result + n, data);
+        return;
+    }
+
+    const auto& padded = *plan.padded;
+    const size_t m = padded.length;
+    scratch.resize(2 * m);
+    complex* a = scratch.data();
+    complex* b = a + m;
+    for (size_t k = 0; k < n; ++k)
+        a[k] = data[k] * plan.chirp[k];
+    std::fill(a + n, a + m, complex(0.f, 0.f));
+    auto result = stockhamFFT(padded, a, b);
+    // the inverse FFT as the forward one of the conjugated values
+    for (size_t k = 0; k < m; ++k)
+        result[k] = std::conj(result[k] * plan.kernel[k]);
+    complex* other = result == a ? b : a;
+    result = stockhamFFT(padded, result, other);
+    const float scale = 1.f / static_cast<float>(m);
+    for (size_t k = 0; k < n; ++k)
+        data[k] = std::conj(result[k]) * scale * plan.chirp[k];
+}
+
 } // namespace
 
 void MKLDNNDFTNode::execute(mkldnn::stream strm) {
@@ -240,9 +431,9 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
+        // the plans are created once per length
+        if (!IsPowerOfTwo(nComplex) && dftPlans.find(nComplex) == dftPlans.end()) {
+            dftPlans[nComplex] = createDFTPlan(nComplex);
         }
     }
 
@@ -266,7 +457,8 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
         if (IsPowerOfTwo(nComplex)) {
             fft(output, nComplex * 2, true);
         } else {
-            naiveDFT(output, nComplex * 2);
+            std::vector<complex> scratch;
+            dft(output, nComplex, scratch);
         }
     } else {
         dftNd(output, outputStrides);
@@ -296,12 +488,27 @@ void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStride
                 iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
             } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
         } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
+            // all the lines along the axis are transformed in parallel
+            std::vector<size_t> linesRange(iterationRange);
+            linesRange[currentAxis] = 1;
+            const size_t linesNum = std::accumulate(linesRange.begin(), linesRange.end(), size_t(1), std::multiplies<size_t>());
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(linesNum, nthr, ithr, start, end);
+                std::vector<float> gatheredData(outputLen);
+                std::vector<complex> scratch;
+                std::vector<size_t> lineCounter(linesRange.size(), 0);
+                for (size_t line = start; line < end; ++line) {
+                    size_t rest = line;
+                    for (size_t i = linesRange.size(); i-- > 0;) {
+                        lineCounter[i] = rest % linesRange[i];
+                        rest /= linesRange[i];
+                    }
+                    gatherToBufferND(gatheredData.data(), output, currentAxis, lineCounter, outputShape, outputStrides);
+                    dft(gatheredData.data(), outputComplexLen, scratch);
+                    applyBufferND(gatheredData.data(), output, currentAxis, lineCounter, outputShape, outputStrides);
+                }
+            });
         }
     }
 }
@@ -368,50 +575,19 @@ void MKLDNNDFTNode::fft(float* data, int64_t dataLength, bool parallelize) const
     }
 }
 
-void MKLDNNDFTNode::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
-        }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
-}
-
-std::vector<std::pair<float, float>> MKLDNNDFTNode::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
-        }
-    });
-    return twiddles;
+void MKLDNNDFTNode::dft(float* data, size_t nComplex, std::vector<complex>& scratch) const {
+    auto* values = reinterpret_cast<complex*>(data);
+    // the inverse DFT is the forward one of the conjugated values
+    if (inverse) {
+        for (size_t k = 0; k < nComplex; ++k)
+            values[k] = std::conj(values[k]);
+    }
+    forwardDFT(*dftPlans.at(nComplex), values, scratch);
+    if (inverse) {
+        const float scale = 1.f / static_cast<float>(nComplex);
+        for (size_t k = 0; k < nComplex; ++k)
+            values[k] = std::conj(values[k]) * scale;
+    }
 }
 
 bool MKLDNNDFTNode::created() const {
@@ -6,10 +6,16 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <complex>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+struct DFTPlan;
+
 class MKLDNNDFTNode : public MKLDNNNode {
 public:
     MKLDNNDFTNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -26,11 +32,10 @@ public:
 private:
     void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
     void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
-
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
+    void dft(float* data, size_t nComplex, std::vector<std::complex<float>>& scratch) const;
 
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    // the mixed radix or Bluestein's FFT plans of the lengths which are not a power of two
+    std::unordered_map<size_t, std::shared_ptr<DFTPlan>> dftPlans;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -106,6 +106,9 @@ public:
     float getAlpha() const { return alpha; }
     float getBeta() const { return beta; }
     float getGamma() const { return gamma; }
+    // are filled when the node is fused as a scale shift
+    const std::vector<float>& getScales() const { return scales; }
+    const std::vector<float>& getShifts() const { return shifts; }
     MKLDNNMemoryPtr scalesMemory;
     MKLDNNMemoryPtr shiftsMemory;
     mkldnn::algorithm getMKLDNNAlgorithm() const { return mkldnnAlgorithm; }
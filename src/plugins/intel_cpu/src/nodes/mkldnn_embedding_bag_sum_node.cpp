@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <limits>
 #include <vector>
 #include <string>
 #include <mkldnn_types.h>
@@ -10,9 +13,329 @@
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "emitters/jit_bf16_emitters.hpp"
+#include "utils/jit_kernel.hpp"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+namespace {
+
+// Accumulates the table rows of a single bag. The embedding depth is split into the blocks of several vector registers,
+// for each block the kernel walks over the bag indices, while the rows of the upcoming indices are prefetched, as the rows
+// of the big tables are usually not in the cache. The tails of the depth are processed by the smaller blocks and then
+// element by element. The accumulation is done in fp32 for the float tables and in int32 for the integer ones.
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_kernel_impl : public jit_uni_emb_bag_kernel, public jit_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_kernel_impl)
+
+    explicit jit_uni_emb_bag_kernel_impl(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_kernel(jcp), jit_kernel() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        for (size_t i = 0; i < unroll; i++)
+            vmm_acc.push_back(reserve<Vmm>());
+
+        const bool is_bf16 = jcp_.prc == Precision::BF16;
+        const bool is_int8 = one_of(jcp_.prc, Precision::I8, Precision::U8);
+        if (is_bf16 && !mayiuse(avx512_core_bf16))
+            emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa));
+
+        preamble();
+
+        mov(reg_src, ptr[param1 + GET_OFF(src)]);
+        mov(reg_indices, ptr[param1 + GET_OFF(indices)]);
+        mov(reg_indices_num, ptr[param1 + GET_OFF(indicesNum)]);
+        mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+        mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+        // the prefetch position is clamped by the last index, so the loop needs no additional branch at the end of the bag
+        lea(reg_last_index, ptr[reg_indices_num - 1]);
+
+        if (is_int8 && isa == avx2) {
+            mov(reg_tmp, reinterpret_cast<size_t>(int8_shuffle_mask));
+            uni_vmovdqu(vmm_shuffle_mask, ptr[reg_tmp]);
+            mov(reg_tmp, reinterpret_cast<size_t>(int8_permute_mask));
+            uni_vmovdqu(vmm_permute_mask, ptr[reg_tmp]);
+        }
+
+        Label no_weights, exit;
+        cmp(reg_weights, 0);
+        je(no_weights, T_NEAR);
+        accumulate_bag(true);
+        jmp(exit, T_NEAR);
+        L(no_weights);
+        accumulate_bag(false);
+        L(exit);
+
+        postamble();
+
+        if (emu_vcvtneps2bf16)
+            emu_vcvtneps2bf16->emit_data();
+    }
+
+private:
+    using Vmm = typename isa_traits<isa>::reg::type;
+    static constexpr size_t vlen = isa_traits<isa>::reg::length;
+    static constexpr size_t unroll = 8;
+    static constexpr size_t prefetch_distance = 8;
+    static constexpr size_t cache_line_size = 64;
+
+    static const int int8_shuffle_mask[8];
+    static const int int8_permute_mask[8];
+
+    void accumulate_bag(bool with_weights) {
+        const size_t type_size = jcp_.prc.size();
+        const size_t block_len = unroll * vlen;
+        const size_t blocks_num = jcp_.embDepth / block_len;
+
+        if (blocks_num > 0) {
+            Label block_loop;
+            mov(reg_blocks, blocks_num);
+            L(block_loop);
+            {
+                accumulate_block(unroll, vlen, 0, with_weights);
+                add(reg_src, block_len * type_size);
+                add(reg_dst, block_len * type_size);
+                dec(reg_blocks);
+                jnz(block_loop, T_NEAR);
+            }
+        }
+
+        const size_t tail = jcp_.embDepth % block_len;
+        const size_t tail_vecs = tail / vlen;
+        if (tail_vecs > 0)
+            accumulate_block(tail_vecs, vlen, 0, with_weights);
+        for (size_t offset = tail_vecs * vlen; offset < tail; offset += unroll) {
+            const size_t scalars = tail - offset < unroll ? tail - offset : unroll;
+            accumulate_block(scalars, 1, offset * type_size, with_weights);
+        }
+    }
+
+    // accumulates 'vecs' registers of 'lanes' elements of the rows starting from the 'offset' in bytes
+    void accumulate_block(size_t vecs, size_t lanes, size_t offset, bool with_weights) {
+        const size_t type_size = jcp_.prc.size();
+        const size_t row_stride = jcp_.embDepth * type_size;
+        const size_t vec_size = lanes * type_size;
+
+        for (size_t i = 0; i < vecs; i++)
+            uni_vpxor(vmm_acc[i], vmm_acc[i], vmm_acc[i]);
+
+        Label index_loop;
+        xor_(reg_i, reg_i);
+        L(index_loop);
+        {
+            lea(reg_prefetch, ptr[reg_i + prefetch_distance]);
+            cmp(reg_prefetch, reg_last_index);
+            cmovg(reg_prefetch, reg_last_index);
+            movsxd(reg_prefetch, dword[reg_indices + reg_prefetch * sizeof(int)]);
+            imul(reg_prefetch, reg_prefetch, static_cast<int>(row_stride));
+            add(reg_prefetch, reg_src);
+            for (size_t line = 0; line < vecs * vec_size; line += cache_line_size)
+                prefetcht0(ptr[reg_prefetch + offset + line]);
+
+            movsxd(reg_row, dword[reg_indices + reg_i * sizeof(int)]);
+            imul(reg_row, reg_row, static_cast<int>(row_stride));
+            add(reg_row, reg_src);
+
+            if (with_weights)
+                load_weight(vmm_weight, ptr[reg_weights + reg_i * static_cast<int>(type_size)]);
+            for (size_t i = 0; i < vecs; i++) {
+                load(vmm_val, ptr[reg_row + offset + i * vec_size], lanes);
+                accumulate(vmm_acc[i], vmm_val, with_weights);
+            }
+
+            inc(reg_i);
+            cmp(reg_i, reg_indices_num);
+            jl(index_loop, T_NEAR);
+        }
+
+        for (size_t i = 0; i < vecs; i++)
+            store(ptr[reg_dst + offset + i * vec_size], vmm_acc[i], lanes);
+    }
+
+    void load(const Vmm& vmm, const Address& addr, size_t lanes) {
+        const Xmm xmm(vmm.getIdx());
+        const bool scalar = lanes == 1;
+        switch (jcp_.prc) {
+            case Precision::FP32:
+                if (scalar)
+                    uni_vmovss(xmm, addr);
+                else
+                    uni_vmovups(vmm, addr);
+                break;
+            case Precision::BF16:
+                if (scalar) {
+                    movzx(reg_tmp.cvt32(), word[addr.getRegExp()]);
+                    vmovd(xmm, reg_tmp.cvt32());
+                    vpslld(vmm, vmm, 16);
+                } else {
+                    vpmovzxwd(vmm, addr);
+                    vpslld(vmm, vmm, 16);
+                }
+                break;
+            case Precision::I8:
+                if (scalar) {
+                    movsx(reg_tmp.cvt32(), byte[addr.getRegExp()]);
+                    vmovd(xmm, reg_tmp.cvt32());
+                } else {
+                    vpmovsxbd(vmm, addr);
+                }
+                break;
+            case Precision::U8:
+                if (scalar) {
+                    movzx(reg_tmp.cvt32(), byte[addr.getRegExp()]);
+                    vmovd(xmm, reg_tmp.cvt32());
+                } else {
+                    vpmovzxbd(vmm, addr);
+                }
+                break;
+            case Precision::I32:
+                if (scalar)
+                    vmovd(xmm, addr);
+                else
+                    uni_vmovdqu(vmm, addr);
+                break;
+            default:
+                assert(!"unsupported precision");
+        }
+    }
+
+    void load_weight(const Vmm& vmm, const Address& addr) {
+        const Xmm xmm(vmm.getIdx());
+        switch (jcp_.prc) {
+            case Precision::FP32:
+                uni_vbroadcastss(vmm, addr);
+                break;
+            case Precision::BF16:
+                movzx(reg_tmp.cvt32(), word[addr.getRegExp()]);
+                shl(reg_tmp.cvt32(), 16);
+                vmovd(xmm, reg_tmp.cvt32());
+                vpbroadcastd(vmm, xmm);
+                break;
+            case Precision::I8:
+                movsx(reg_tmp.cvt32(), byte[addr.getRegExp()]);
+                vmovd(xmm, reg_tmp.cvt32());
+                vpbroadcastd(vmm, xmm);
+                break;
+            case Precision::U8:
+                movzx(reg_tmp.cvt32(), byte[addr.getRegExp()]);
+                vmovd(xmm, reg_tmp.cvt32());
+                vpbroadcastd(vmm, xmm);
+                break;
+            case Precision::I32:
+                vpbroadcastd(vmm, dword[addr.getRegExp()]);
+                break;
+            default:
+                assert(!"unsupported precision");
+        }
+    }
+
+    void accumulate(const Vmm& acc, const Vmm& val, bool with_weights) {
+        if (one_of(jcp_.prc, Precision::FP32, Precision::BF16)) {
+            if (with_weights)
+                uni_vfmadd231ps(acc, val, vmm_weight);
+            else
+                uni_vaddps(acc, acc, val);
+        } else {
+            if (with_weights)
+                uni_vpmulld(val, val, vmm_weight);
+            uni_vpaddd(acc, acc, val);
+        }
+    }
+
+    void store(const Address& addr, const Vmm& vmm, size_t lanes) {
+        const Xmm xmm(vmm.getIdx());
+        const bool scalar = lanes == 1;
+        switch (jcp_.prc) {
+            case Precision::FP32:
+                if (scalar)
+                    uni_vmovss(addr, xmm);
+                else
+                    uni_vmovups(addr, vmm);
+                break;
+            case Precision::BF16: {
+                const Ymm ymm(vmm.getIdx());
+                if (emu_vcvtneps2bf16) {
+                    emu_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm.getIdx())}, {static_cast<size_t>(ymm.getIdx())},
+                        {static_cast<size_t>(vmm_aux0.getIdx()), static_cast<size_t>(vmm_aux1.getIdx())},
+                        {static_cast<size_t>(reg_aux.getIdx())});
+                } else {
+                    vcvtneps2bf16(ymm, Zmm(vmm.getIdx()));
+                }
+                if (scalar)
+                    vpextrw(addr, xmm, 0);
+                else
+                    vmovdqu(addr, ymm);
+                break;
+            }
+            case Precision::I8:
+            case Precision::U8:
+                // the sums are truncated to match the integer overflow behavior of the reference implementation
+                if (scalar) {
+                    vmovd(reg_tmp.cvt32(), xmm);
+                    mov(addr, reg_tmp.cvt8());
+                } else if (isa == avx512_common) {
+                    vpmovdb(addr, Zmm(vmm.getIdx()));
+                } else {
+                    vpshufb(vmm, vmm, vmm_shuffle_mask);
+                    vpermd(vmm, vmm_permute_mask, vmm);
+                    vmovq(addr, xmm);
+                }
+                break;
+            case Precision::I32:
+                if (scalar)
+                    vmovd(addr, xmm);
+                else
+                    uni_vmovdqu(addr, vmm);
+                break;
+            default:
+                assert(!"unsupported precision");
+        }
+    }
+
+    const Reg64& reg_src = reserve<Reg64>();
+    const Reg64& reg_indices = reserve<Reg64>();
+    const Reg64& reg_indices_num = reserve<Reg64>();
+    const Reg64& reg_weights = reserve<Reg64>();
+    const Reg64& reg_dst = reserve<Reg64>();
+    const Reg64& reg_last_index = reserve<Reg64>();
+    const Reg64& reg_blocks = reserve<Reg64>();
+    const Reg64& reg_i = reserve<Reg64>();
+    const Reg64& reg_row = reserve<Reg64>();
+    const Reg64& reg_prefetch = reserve<Reg64>();
+    const Reg64& reg_tmp = reserve<Reg64>();
+    const Reg64& reg_aux = reserve<Reg64>();
+
+    const Vmm& vmm_val = reserve<Vmm>();
+    const Vmm& vmm_weight = reserve<Vmm>();
+    // the bf16 emulation and the avx2 int8 store never occur in the same kernel
+    const Vmm& vmm_aux0 = reserve<Vmm>();
+    const Vmm& vmm_aux1 = reserve<Vmm>();
+    const Vmm& vmm_shuffle_mask = vmm_aux0;
+    const Vmm& vmm_permute_mask = vmm_aux1;
+    std::vector<Vmm> vmm_acc;
+
+    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
+};
+
+// the low bytes of the dwords are gathered in the low dword of each lane and then the two lanes are joined
+template <cpu_isa_t isa>
+const int jit_uni_emb_bag_kernel_impl<isa>::int8_shuffle_mask[8] = {
+    static_cast<int>(0x0C080400), -1, -1, -1, static_cast<int>(0x0C080400), -1, -1, -1
+};
+
+template <cpu_isa_t isa>
+const int jit_uni_emb_bag_kernel_impl<isa>::int8_permute_mask[8] = {0, 4, 0, 0, 0, 0, 0, 0};
+
+}   // namespace
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -36,11 +359,44 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
-void MKLDNNEmbeddingBagSumNode::prepareParams(const VectorDims& indexStaticShape) {
+void MKLDNNEmbeddingBagSumNode::prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& srcPrc) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    // the row stride is encoded as an immediate, extremely long rows are processed by the reference implementation
+    if (getImplType() == impl_desc_type::ref_any || _embDepth * srcPrc.size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        _kernel.reset();
+        return;
+    }
+    if (_kernel && _kernel->jcp_.embDepth == _embDepth && _kernel->jcp_.prc == srcPrc)
+        return;
+
+    jit_emb_bag_config_params jcp;
+    jcp.prc = srcPrc;
+    jcp.embDepth = _embDepth;
+    if (mayiuse(avx512_common)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_impl<avx512_common>(jcp));
+    } else {
+        _kernel.reset(new jit_uni_emb_bag_kernel_impl<avx2>(jcp));
+    }
+    _kernel->create_ker();
+}
+
+impl_desc_type MKLDNNEmbeddingBagSumNode::getImplType() {
+    if (mayiuse(avx512_common))
+        return impl_desc_type::jit_avx512;
+    if (mayiuse(avx2))
+        return impl_desc_type::jit_avx2;
+    return impl_desc_type::ref_any;
+}
+
+InferenceEngine::Precision MKLDNNEmbeddingBagSumNode::getTablePrecision(InferenceEngine::Precision prc) {
+    // bf16 tables are accumulated by the jit kernel only, as the bf16 rounding is implemented for avx512 only
+    if (prc == Precision::BF16 && !mayiuse(avx512_core))
+        return Precision::FP32;
+    return prc;
 }
 
 template<typename T>
@@ -115,8 +471,73 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
     parallel_nt(0, threadBody);
 }
 
+void MKLDNNEmbeddingBagSumNode::processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                               const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outDataDims[0];
+    const size_t typeSize = _kernel->jcp_.prc.size();
+    const size_t rowSize = _embDepth * typeSize;
+
+    // The bags may have very different sizes, so the bags are split between the threads by the number of the rows
+    // to be accumulated rather than by the number of the bags. An empty bag is counted as a single row to be filled.
+    _bagsWork.resize(outputBagsNum + 1);
+    _bagsWork[0] = 0lu;
+    for (size_t obi = 0; obi < outputBagsNum; obi++) {
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        _bagsWork[obi + 1] = _bagsWork[obi] + std::max(indicesSize, size_t(1));
+    }
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        const size_t totalWork = _bagsWork.back();
+        const auto bagsBegin = _bagsWork.begin();
+        const auto bagsEnd = _bagsWork.end() - 1;
+        const size_t start = std::lower_bound(bagsBegin, bagsEnd, totalWork * ithr / nthr) - bagsBegin;
+        const size_t end = std::lower_bound(bagsBegin, bagsEnd, totalWork * (ithr + 1) / nthr) - bagsBegin;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            uint8_t* dst = dstData + obi * rowSize;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices == nullptr || indicesSize == 0) {
+                memset(dst, 0, rowSize);
+                continue;
+            }
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+
+            jit_emb_bag_call_args args;
+            args.src = srcData;
+            args.indices = indices;
+            args.indicesNum = indicesSize;
+            args.weights = withWeights && _withWeights ? weightsData + weightsIdx * typeSize : nullptr;
+            args.dst = dst;
+            (*_kernel)(&args);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                                         const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    if (_kernel)
+        return processDataJit(srcData, weightsData, dstData, inDims, outDims);
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
@@ -12,6 +12,35 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_emb_bag_config_params {
+    InferenceEngine::Precision prc;
+    size_t embDepth;
+};
+
+struct jit_emb_bag_call_args {
+    const void* src;
+    const int* indices;
+    size_t indicesNum;
+    const void* weights;    // nullptr if the bag is accumulated without the per sample weights
+    void* dst;
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) const {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_config_params jcp_;
+};
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -35,11 +64,16 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& srcPrc);
+
+    static impl_desc_type getImplType();
+    static InferenceEngine::Precision getTablePrecision(InferenceEngine::Precision prc);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    void processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                        const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -49,6 +83,10 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::shared_ptr<jit_uni_emb_bag_kernel> _kernel;
+    // prefix sums of the number of the indices accumulated into the bags, used to balance the work between the threads
+    std::vector<size_t> _bagsWork;
 };
 
 }  // namespace MKLDNNPlugin
@@ -43,6 +43,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    std::vector<size_t> segmentsBegin_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }  // namespace MKLDNNPlugin
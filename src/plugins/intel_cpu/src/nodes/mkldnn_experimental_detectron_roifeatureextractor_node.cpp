@@ -5,229 +5,19 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cmath>
 
 #include <ngraph/opsets/opset6.hpp>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
 #include "mkldnn_experimental_detectron_roifeatureextractor_node.h"
+#include "common/roi_align_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
 namespace {
 
-// implementation taken from Caffe2
-template <typename T>
-struct PreCalc {
-    int pos1;
-    int pos2;
-    int pos3;
-    int pos4;
-    T w1;
-    T w2;
-    T w3;
-    T w4;
-};
-
-template <typename T>
-void pre_calc_for_bilinear_interpolate(
-        const int height,
-        const int width,
-        const int pooled_height,
-        const int pooled_width,
-        const int iy_upper,
-        const int ix_upper,
-        T roi_start_h,
-        T roi_start_w,
-        T bin_size_h,
-        T bin_size_w,
-        int roi_bin_grid_h,
-        int roi_bin_grid_w,
-        std::vector<PreCalc<T>>& pre_calc) {
-    int pre_calc_index = 0;
-    for (int ph = 0; ph < pooled_height; ph++) {
-        for (int pw = 0; pw < pooled_width; pw++) {
-            for (int iy = 0; iy < iy_upper; iy++) {
-                const T yy = roi_start_h + ph * bin_size_h +
-                             static_cast<T>(iy + .5f) * bin_size_h /
-                             static_cast<T>(roi_bin_grid_h);  // e.g., 0.5, 1.5
-                for (int ix = 0; ix < ix_upper; ix++) {
-                    const T xx = roi_start_w + pw * bin_size_w +
-                                 static_cast<T>(ix + .5f) * bin_size_w /
-                                 static_cast<T>(roi_bin_grid_w);
-
-                    T x = xx;
-                    T y = yy;
-                    // deal with: inverse elements are out of feature map boundary
-                    if (y < -1.0 || y > height || x < -1.0 || x > width) {
-                        // empty
-                        PreCalc<T> pc;
-                        pc.pos1 = 0;
-                        pc.pos2 = 0;
-                        pc.pos3 = 0;
-                        pc.pos4 = 0;
-                        pc.w1 = 0;
-                        pc.w2 = 0;
-                        pc.w3 = 0;
-                        pc.w4 = 0;
-                        pre_calc.at(pre_calc_index) = pc;
-                        pre_calc_index += 1;
-                        continue;
-                    }
-
-                    if (y <= 0) {
-                        y = 0;
-                    }
-                    if (x <= 0) {
-                        x = 0;
-                    }
-
-                    int y_low = static_cast<int>(y);
-                    int x_low = static_cast<int>(x);
-                    int y_high = 0;
-                    int x_high = 0;
-
-                    if (y_low >= height - 1) {
-                        y_high = y_low = height - 1;
-                        y = (T)y_low;
-                    } else {
-                        y_high = y_low + 1;
-                    }
-
-                    if (x_low >= width - 1) {
-                        x_high = x_low = width - 1;
-                        x = (T)x_low;
-                    } else {
-                        x_high = x_low + 1;
-                    }
-
-                    T ly = y - y_low;
-                    T lx = x - x_low;
-                    T hy = static_cast<T>(1) - ly, hx = static_cast<T>(1) - lx;
-                    T w1 = hy * hx, w2 = hy * lx, w3 = ly * hx, w4 = ly * lx;
-
-                    // save weights and indices
-                    PreCalc<T> pc;
-                    pc.pos1 = y_low * width + x_low;
-                    pc.pos2 = y_low * width + x_high;
-                    pc.pos3 = y_high * width + x_low;
-                    pc.pos4 = y_high * width + x_high;
-                    pc.w1 = w1;
-                    pc.w2 = w2;
-                    pc.w3 = w3;
-                    pc.w4 = w4;
-                    pre_calc[pre_calc_index] = pc;
-
-                    pre_calc_index += 1;
-                }
-            }
-        }
-    }
-}
-
-template <typename T>
-void ROIAlignForward_cpu_kernel(
-        const int nthreads,
-        const T* bottom_data,
-        const T& spatial_scale,
-        const int channels,
-        const int height,
-        const int width,
-        const int pooled_height,
-        const int pooled_width,
-        const int sampling_ratio,
-        const T* bottom_rois,
-        const bool aligned,
-        T* top_data) {
-    int roi_cols = 4;
-
-    int n_rois = nthreads / channels / pooled_width / pooled_height;
-    // (n, c, ph, pw) is an element in the pooled output
-    parallel_for(n_rois, [&](size_t n) {
-        int index_n = n * channels * pooled_width * pooled_height;
-
-        // roi could have 4 or 5 columns
-        const T* offset_bottom_rois = bottom_rois + n * roi_cols;
-        int roi_batch_ind = 0;
-        if (roi_cols == 5) {
-            roi_batch_ind = static_cast<int>(offset_bottom_rois[0]);
-            offset_bottom_rois++;
-        }
-
-        T offset = aligned ? (T)0.5 : (T)0.0;
-        // Do not using rounding; this implementation detail is critical
-        T roi_start_w = offset_bottom_rois[0] * spatial_scale - offset;
-        T roi_start_h = offset_bottom_rois[1] * spatial_scale - offset;
-        T roi_end_w = offset_bottom_rois[2] * spatial_scale - offset;
-        T roi_end_h = offset_bottom_rois[3] * spatial_scale - offset;
-
-        // Force malformed ROIs to be 1x1
-        T roi_width = (std::max)(roi_end_w - roi_start_w, (T)1.);
-        T roi_height = (std::max)(roi_end_h - roi_start_h, (T)1.);
-        T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
-        T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
-
-        // We use roi_bin_grid to sample the grid and mimic integral
-        int roi_bin_grid_h = (sampling_ratio > 0)
-                             ? sampling_ratio
-                             : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
-        int roi_bin_grid_w =
-                (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
-
-        // We do average (integral) pooling inside a bin
-        const T count = static_cast<T>(roi_bin_grid_h * roi_bin_grid_w);  // e.g. = 4
-
-        // we want to precalculate indices and weights shared by all chanels,
-        // this is the key point of optimiation
-        std::vector<PreCalc<T>> pre_calc(
-                roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
-        pre_calc_for_bilinear_interpolate(
-                height,
-                width,
-                pooled_height,
-                pooled_width,
-                roi_bin_grid_h,
-                roi_bin_grid_w,
-                roi_start_h,
-                roi_start_w,
-                bin_size_h,
-                bin_size_w,
-                roi_bin_grid_h,
-                roi_bin_grid_w,
-                pre_calc);
-
-        for (int c = 0; c < channels; c++) {
-            int index_n_c = index_n + c * pooled_width * pooled_height;
-            const T* offset_bottom_data =
-                    bottom_data + (roi_batch_ind * channels + c) * height * width;
-            int pre_calc_index = 0;
-
-            for (int ph = 0; ph < pooled_height; ph++) {
-                for (int pw = 0; pw < pooled_width; pw++) {
-                    int index = index_n_c + ph * pooled_width + pw;
-
-                    T output_val = 0.;
-                    for (int iy = 0; iy < roi_bin_grid_h; iy++) {
-                        for (int ix = 0; ix < roi_bin_grid_w; ix++) {
-                            PreCalc<T> pc = pre_calc[pre_calc_index];
-                            output_val += pc.w1 * offset_bottom_data[pc.pos1] +
-                                          pc.w2 * offset_bottom_data[pc.pos2] +
-                                          pc.w3 * offset_bottom_data[pc.pos3] +
-                                          pc.w4 * offset_bottom_data[pc.pos4];
-
-                            pre_calc_index += 1;
-                        }
-                    }
-                    output_val /= count;
-
-                    top_data[index] = output_val;
-                }  // for pw
-            }  // for ph
-        }  // for c
-    });
-}
-
-
 void redistribute_rois(const float* rois, int* level_ids,
                        const int num_rois, const int levels_num) {
     const float canonical_scale = 224.0f;
@@ -253,31 +43,6 @@ void redistribute_rois(const float* rois, int* level_ids,
 }
 
 
-void reord(const float* src_data, const int* ranks, const int n, const int step, float* dst_data,
-             int* dst_mapping) {
-    std::iota(dst_mapping, dst_mapping + n, 0);
-    std::sort(dst_mapping, dst_mapping + n, [&ranks](size_t i1, size_t i2) {return ranks[i1] < ranks[i2];});
-    for (int i = 0; i < n; ++i) {
-        const int j = dst_mapping[i];
-        assert(0 <= j && j < n);
-        cpu_memcpy(dst_data + i * step, src_data + j * step, sizeof(float) * step);
-    }
-}
-
-void split_points(const std::vector<int>& ids, std::vector<int>& rois_per_level, const int levels_num) {
-    rois_per_level.clear();
-    rois_per_level.resize(levels_num, 0);
-    for (size_t i = 0; i < ids.size(); ++i) {
-        assert(0 <= ids[i] && ids[i] < levels_num);
-        rois_per_level[ids[i]]++;
-    }
-    for (int i = 1; i < levels_num; ++i) {
-        rois_per_level[i] += rois_per_level[i - 1];
-    }
-    rois_per_level.insert(rois_per_level.begin(), 0);
-}
-
-
 void reorder_rois(const float *rois, const int* ids, int* mapping, const int rois_num,
                   float * reordered_rois, std::vector<int>& rois_per_level, const int levels_num) {
     rois_per_level.clear();
@@ -344,25 +109,30 @@ void MKLDNNExperimentalDetectronROIFeatureExtractorNode::initSupportedPrimitiveD
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    std::vector<PortConfigurator> inDataConf;
-    inDataConf.reserve(inputShapes.size());
-    for (int i = 0; i < inputShapes.size(); ++i)
+    // the blocked and the channels last layouts keep the channels contiguous, so the bilinear sampling is vectorized
+    // over the channels
+    for (auto layout : {LayoutType::ncsp, LayoutType::nspc, LayoutType::nCsp16c, LayoutType::nCsp8c}) {
+        std::vector<PortConfigurator> inDataConf;
+        inDataConf.reserve(inputShapes.size());
         inDataConf.emplace_back(LayoutType::ncsp, Precision::FP32);
+        for (int i = INPUT_FEATURES_START; i < inputShapes.size(); ++i)
+            inDataConf.emplace_back(layout, Precision::FP32);
 
-    addSupportedPrimDesc(inDataConf,
-                         {{LayoutType::ncsp, Precision::FP32},
-                          {LayoutType::ncsp, Precision::FP32}},
-                         impl_desc_type::ref_any);
+        addSupportedPrimDesc(inDataConf,
+                             {{layout, Precision::FP32},
+                              {LayoutType::ncsp, Precision::FP32}},
+                             impl_desc_type::ref_any);
+    }
 }
 
 void MKLDNNExperimentalDetectronROIFeatureExtractorNode::execute(mkldnn::stream strm) {
     const int levels_num = inputShapes.size() - INPUT_FEATURES_START;
     const int num_rois = getParentEdgeAt(INPUT_ROIS)->getMemory().getStaticDims()[0];
     const int channels_num = getParentEdgeAt(INPUT_FEATURES_START)->getMemory().getStaticDims()[1];
-    const int feaxels_per_roi = pooled_height_ * pooled_width_ * channels_num;
 
     auto *input_rois = reinterpret_cast<const float *>(getParentEdgeAt(INPUT_ROIS)->getMemoryPtr()->GetPtr());
-    auto *output_rois_features = reinterpret_cast<float *>(getChildEdgesAtPort(OUTPUT_ROI_FEATURES)[0]->getMemoryPtr()->GetPtr());
+    auto &output_features_memory = getChildEdgesAtPort(OUTPUT_ROI_FEATURES)[0]->getMemory();
+    auto *output_rois_features = reinterpret_cast<float *>(output_features_memory.GetPtr());
     float *output_rois = nullptr;
     if (OUTPUT_ROIS < outputShapes.size()) {
         output_rois = reinterpret_cast<float *>(getChildEdgesAtPort(OUTPUT_ROIS)[0]->getMemoryPtr()->GetPtr());
@@ -371,39 +141,86 @@ void MKLDNNExperimentalDetectronROIFeatureExtractorNode::execute(mkldnn::stream
     std::vector<int> level_ids(num_rois, 0);
     redistribute_rois(input_rois, reinterpret_cast<int *>(&level_ids[0]), num_rois, levels_num);
 
-    std::vector<float> reordered_rois(4 * num_rois, 0);
-    std::vector<int> original_rois_mapping(num_rois, 0);
-    reord(input_rois, &level_ids[0], num_rois, 4, &reordered_rois[0], &original_rois_mapping[0]);
+    // The channels are processed by blocks: a channel in ncsp, all the channels in nspc or a channel block
+    // in nCsp16c/nCsp8c, the strides are taken from the blocked descriptors [N, C, H, W], [N, H, W, C] or
+    // [N, C/b, H, W, b]
+    const auto dst_desc = output_features_memory.GetDescWithType<BlockedMemoryDesc>();
+    const bool is_nspc = dst_desc->hasLayoutType(LayoutType::nspc);
+    const bool is_blocked = dst_desc->hasLayoutType(LayoutType::nCsp16c) || dst_desc->hasLayoutType(LayoutType::nCsp8c);
+    const size_t spatial_offset = is_nspc ? 1 : 2;
+    const size_t block_size = is_blocked ? dst_desc->getBlockDims().back() : (is_nspc ? channels_num : 1);
+    const size_t blocks_num = is_blocked ? dst_desc->getBlockDims()[1] : (is_nspc ? 1 : channels_num);
+    const auto &dst_strides = dst_desc->getStrides();
+    const size_t dst_block_stride = is_nspc ? 0 : dst_strides[1];
+
+    std::vector<const float *> featuremaps(levels_num);
+    std::vector<VectorDims> featuremap_strides(levels_num);
+    for (int i = 0; i < levels_num; ++i) {
+        const auto &featuremap_memory = getParentEdgeAt(INPUT_FEATURES_START + i)->getMemory();
+        featuremaps[i] = reinterpret_cast<const float *>(featuremap_memory.GetPtr());
+        featuremap_strides[i] = featuremap_memory.GetDescWithType<BlockedMemoryDesc>()->getStrides();
+    }
 
-    std::vector<int> rois_per_level;
-    split_points(level_ids, rois_per_level, levels_num + 1);
+    // the interpolation samples are shared by all the channels of a ROI
+    std::vector<std::vector<ROIAlignSample>> samples(num_rois);
+    std::vector<int> samples_per_bin(num_rois, 0);
+    parallel_for(num_rois, [&](size_t n) {
+        const int level = level_ids[n];
+        // the ROIs of zero area don't belong to any level and have zero features
+        if (level >= levels_num)
+            return;
+        const auto &featuremap_dims = getParentEdgeAt(INPUT_FEATURES_START + level)->getMemory().getStaticDims();
+        const auto &strides = featuremap_strides[level];
+        const float spatial_scale = 1.0f / pyramid_scales_[level];
+        const float offset = aligned_ ? 0.5f : 0.0f;
+        // Do not using rounding; this implementation detail is critical
+        const float *roi = input_rois + 4 * n;
+        const float roi_start_w = roi[0] * spatial_scale - offset;
+        const float roi_start_h = roi[1] * spatial_scale - offset;
+        const float roi_end_w = roi[2] * spatial_scale - offset;
+        const float roi_end_h = roi[3] * spatial_scale - offset;
 
-    std::vector<float> output_rois_features_temp(feaxels_per_roi * num_rois, 0);
-    for (int i = 0; i < levels_num; ++i) {
-        const int level_rois_offset = rois_per_level[i];
-        const int level_rois_num = rois_per_level[i + 1] - level_rois_offset;
-        if (level_rois_num > 0) {
-            auto *featuremap = reinterpret_cast<const float *>(getParentEdgeAt(INPUT_FEATURES_START + i)->getMemoryPtr()->GetPtr());
-            const int featuremap_height = getParentEdgeAt(INPUT_FEATURES_START + i)->getMemory().getStaticDims()[2];
-            const int featuremap_width = getParentEdgeAt(INPUT_FEATURES_START + i)->getMemory().getStaticDims()[3];
-            ROIAlignForward_cpu_kernel<float>(feaxels_per_roi * level_rois_num,
-                                              featuremap,
-                                              1.0f / pyramid_scales_[i],
-                                              channels_num,
-                                              featuremap_height,
-                                              featuremap_width,
-                                              pooled_height_,
-                                              pooled_width_,
-                                              sampling_ratio_,
-                                              &reordered_rois[4 * level_rois_offset],
-                                              aligned_,
-                                              &output_rois_features_temp[feaxels_per_roi * level_rois_offset]);
+        // Force malformed ROIs to be 1x1
+        const float roi_width = (std::max)(roi_end_w - roi_start_w, 1.0f);
+        const float roi_height = (std::max)(roi_end_h - roi_start_h, 1.0f);
+        const float bin_size_h = roi_height / static_cast<float>(pooled_height_);
+        const float bin_size_w = roi_width / static_cast<float>(pooled_width_);
+
+        // We use roi_bin_grid to sample the grid and mimic integral
+        const int roi_bin_grid_h = (sampling_ratio_ > 0) ? sampling_ratio_ : static_cast<int>(ceil(roi_height / pooled_height_));
+        const int roi_bin_grid_w = (sampling_ratio_ > 0) ? sampling_ratio_ : static_cast<int>(ceil(roi_width / pooled_width_));
+        samples_per_bin[n] = roi_bin_grid_h * roi_bin_grid_w;
+
+        calcROIAlignSamples(roi_start_w, roi_start_h, bin_size_w, bin_size_h, roi_bin_grid_w, roi_bin_grid_h,
+                            pooled_height_, pooled_width_, featuremap_dims[2], featuremap_dims[3],
+                            strides[spatial_offset], strides[spatial_offset + 1], samples[n]);
+    });
+
+    // (n, c, ph, pw) is an element in the pooled output, parallel over the ROIs and the channel blocks
+    parallel_for2d(num_rois, blocks_num, [&](size_t n, size_t block) {
+        float *dst = output_rois_features + n * dst_strides[0] + block * dst_block_stride;
+        if (samples[n].empty()) {
+            for (int ph = 0; ph < pooled_height_; ph++) {
+                for (int pw = 0; pw < pooled_width_; pw++) {
+                    std::fill_n(dst + ph * dst_strides[spatial_offset] + pw * dst_strides[spatial_offset + 1], block_size, 0.f);
+                }
+            }
+            return;
         }
-    }
+        const int level = level_ids[n];
+        const auto &strides = featuremap_strides[level];
+        const float *src = featuremaps[level] + block * (is_nspc ? 0 : strides[1]);
+        const size_t samples_num = samples_per_bin[n];
+        const ROIAlignSample *bin_samples = samples[n].data();
+        for (int ph = 0; ph < pooled_height_; ph++) {
+            for (int pw = 0; pw < pooled_width_; pw++) {
+                roiAlignAvgBin(src, bin_samples, samples_num,
+                               dst + ph * dst_strides[spatial_offset] + pw * dst_strides[spatial_offset + 1], block_size);
+                bin_samples += samples_num;
+            }
+        }
+    });
 
-    std::vector<int> dummy_mapping(num_rois, 0);
-    reord(&output_rois_features_temp[0], &original_rois_mapping[0], num_rois, feaxels_per_roi,
-            output_rois_features, &dummy_mapping[0]);
     if (output_rois != nullptr) {
         cpu_memcpy(output_rois, input_rois, 4 * num_rois * sizeof(float));
     }
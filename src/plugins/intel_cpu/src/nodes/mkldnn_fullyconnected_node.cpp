@@ -7,18 +7,192 @@
 #include "mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <string>
+#include <tuple>
 #include <vector>
+#include "ie_parallel.hpp"
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/jit_kernel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_call_args, field)
+
+namespace {
+
+// the block of the outputs computed by one kernel call, which fits the accumulators, the decompressed weights and
+// the auxiliary registers into 16 vector registers
+constexpr size_t decompressionRowsBlock = 2;
+constexpr size_t decompressionColsBlock = 4;
+// the output channels dequantized by one task, so the single row is dequantized in parallel too
+constexpr size_t dequantizationColsBlock = 64;
+
+// Computes the block of mRows x nCols outputs with the compressed weights. The weights of an output channel are contiguous
+// along the input channels, so the products are accumulated by the vectors of the input channels and the accumulators are
+// reduced horizontally at the end. The weights are decompressed in the registers only: converted to fp32 and then scaled
+// (and shifted) by the values of their group, which are broadcasted for the whole vector, so a vector never crosses a group.
+// The sparse weights (avx512 only) are expanded from the non-zero weights by the mask of the vector instead.
+template <cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel_impl : public jit_uni_fc_decompression_kernel, public jit_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel_impl)
+
+    explicit jit_uni_fc_decompression_kernel_impl(jit_fc_decompression_config_params jcp) : jit_uni_fc_decompression_kernel(jcp), jit_kernel() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        for (size_t i = 0; i < jcp_.mRows * jcp_.nCols; i++)
+            vmm_acc.push_back(reserve<Vmm>());
+        for (size_t i = 0; i < jcp_.nCols; i++)
+            vmm_weights.push_back(reserve<Vmm>());
+
+        preamble();
+
+        mov(reg_src, ptr[param1 + GET_OFF(src)]);
+        mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+        if (jcp_.sparse)
+            mov(reg_masks, ptr[param1 + GET_OFF(masks)]);
+        mov(reg_scales, ptr[param1 + GET_OFF(scales)]);
+        if (jcp_.withShifts)
+            mov(reg_shifts, ptr[param1 + GET_OFF(shifts)]);
+        if (jcp_.withBiases)
+            mov(reg_biases, ptr[param1 + GET_OFF(biases)]);
+        mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+
+        for (const auto& acc : vmm_acc)
+            uni_vpxor(acc, acc, acc);
+
+        Label group_loop, channel_loop;
+        mov(reg_groups, jcp_.K / jcp_.groupSize);
+        L(group_loop);
+        {
+            mov(reg_channels, jcp_.groupSize / simd_w);
+            L(channel_loop);
+            {
+                for (size_t j = 0; j < jcp_.nCols; j++)
+                    decompress(vmm_weights[j], j);
+                for (size_t i = 0; i < jcp_.mRows; i++) {
+                    uni_vmovups(vmm_src, ptr[reg_src + i * jcp_.K * sizeof(float)]);
+                    for (size_t j = 0; j < jcp_.nCols; j++)
+                        uni_vfmadd231ps(vmm_acc[i * jcp_.nCols + j], vmm_weights[j], vmm_src);
+                }
+                add(reg_src, simd_w * sizeof(float));
+                // the sparse weights pointer is moved by the expansion
+                if (jcp_.sparse)
+                    add(reg_masks, jcp_.nCols * sizeof(uint16_t));
+                else
+                    add(reg_weights, simd_w);
+                dec(reg_channels);
+                jnz(channel_loop, T_NEAR);
+            }
+            add(reg_scales, sizeof(float));
+            if (jcp_.withShifts)
+                add(reg_shifts, sizeof(float));
+            dec(reg_groups);
+            jnz(group_loop, T_NEAR);
+        }
+
+        for (size_t i = 0; i < jcp_.mRows; i++) {
+            for (size_t j = 0; j < jcp_.nCols; j++) {
+                const auto& acc = vmm_acc[i * jcp_.nCols + j];
+                const Xmm xmm_acc(acc.getIdx());
+                reduce(acc);
+                if (jcp_.withBiases)
+                    vaddss(xmm_acc, xmm_acc, ptr[reg_biases + j * sizeof(float)]);
+                vmovss(ptr[reg_dst + (i * jcp_.dstStride + j) * sizeof(float)], xmm_acc);
+            }
+        }
+
+        postamble();
+    }
+
+private:
+    using Vmm = typename isa_traits<isa>::reg::type;
+    static constexpr size_t simd_w = isa_traits<isa>::reg::length / sizeof(float);
+
+    // the weights of the output channel 'col' at the current input channels: weights * scale + shift
+    void decompress(const Vmm& vmm, size_t col) {
+        if (jcp_.sparse) {
+            movzx(reg_nnz.cvt32(), word[reg_masks + col * sizeof(uint16_t)]);
+            kmovw(k_mask, reg_nnz.cvt32());
+            vexpandps(vmm | k_mask | T_z, ptr[reg_weights]);
+            popcnt(reg_nnz.cvt32(), reg_nnz.cvt32());
+            lea(reg_weights, ptr[reg_weights + reg_nnz * sizeof(float)]);
+            return;
+        }
+        const size_t groupsOffset = col * (jcp_.K / jcp_.groupSize) * sizeof(float);
+        if (jcp_.weightsPrc == Precision::I8)
+            vpmovsxbd(vmm, ptr[reg_weights + col * jcp_.K]);
+        else
+            vpmovzxbd(vmm, ptr[reg_weights + col * jcp_.K]);
+        uni_vcvtdq2ps(vmm, vmm);
+        uni_vbroadcastss(vmm_scale, ptr[reg_scales + groupsOffset]);
+        if (jcp_.withShifts) {
+            uni_vbroadcastss(vmm_shift, ptr[reg_shifts + groupsOffset]);
+            uni_vfmadd213ps(vmm, vmm_scale, vmm_shift);
+        } else {
+            uni_vmulps(vmm, vmm, vmm_scale);
+        }
+    }
+
+    // the sum of the elements is stored to the lowest element, all the registers are below 16, so VEX encoding is used
+    void reduce(const Vmm& vmm) {
+        const Xmm xmm(vmm.getIdx());
+        const Ymm ymm(vmm.getIdx());
+        const Xmm xmm_aux(vmm_src.getIdx());
+        const Ymm ymm_aux(vmm_src.getIdx());
+        if (isa == avx512_common) {
+            vextractf64x4(ymm_aux, Zmm(vmm.getIdx()), 1);
+            vaddps(ymm, ymm, ymm_aux);
+        }
+        vextractf128(xmm_aux, ymm, 1);
+        vaddps(xmm, xmm, xmm_aux);
+        vhaddps(xmm, xmm, xmm);
+        vhaddps(xmm, xmm, xmm);
+    }
+
+    const Reg64& reg_src = reserve<Reg64>();
+    const Reg64& reg_weights = reserve<Reg64>();
+    const Reg64& reg_scales = reserve<Reg64>();
+    const Reg64& reg_shifts = reserve<Reg64>();
+    const Reg64& reg_biases = reserve<Reg64>();
+    const Reg64& reg_dst = reserve<Reg64>();
+    const Reg64& reg_groups = reserve<Reg64>();
+    const Reg64& reg_channels = reserve<Reg64>();
+    const Reg64& reg_masks = reserve<Reg64>();
+    const Reg64& reg_nnz = reserve<Reg64>();
+    const Opmask k_mask = Opmask(1);
+
+    const Vmm& vmm_src = reserve<Vmm>();
+    const Vmm& vmm_scale = reserve<Vmm>();
+    const Vmm& vmm_shift = reserve<Vmm>();
+    std::vector<Vmm> vmm_acc;
+    std::vector<Vmm> vmm_weights;
+};
+
+// the dimensions of the 'data' input as [rows, input channels]
+std::pair<size_t, size_t> getDecompressionSrcDims(const VectorDims& dims) {
+    if (dims.size() == 3)
+        return {dims[0] * dims[1], dims[2]};
+    return {dims[0], std::accumulate(dims.begin() + 1, dims.end(), size_t{1}, std::multiplies<size_t>())};
+}
+
+}   // namespace
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -80,6 +254,9 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    if (withCustomKernel())
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -128,7 +305,258 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withCustomKernel()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto weightsPrecision = withSparseWeights() || withDynamicQuantization() ? Precision::FP32
+                                                                                   : getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+    std::vector<PortConfigurator> inConfigurators = {{LayoutType::ncsp, Precision::FP32},
+                                                     {LayoutType::ncsp, weightsPrecision}};
+    if (withBiases)
+        inConfigurators.push_back({LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inConfigurators, {{LayoutType::ncsp, Precision::FP32}},
+                         mayiuse(avx512_common) || withSparseWeights() ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2);
+}
+
+void MKLDNNFullyConnectedNode::fuseDecompression(const Shape& weightsShape, InferenceEngine::Precision weightsPrecision,
+                                                 std::vector<float> scales, std::vector<float> shifts, size_t groups) {
+    inputShapes[WEIGHTS_ID] = weightsShape;
+    setOriginalInputPrecisionAtPort(WEIGHTS_ID, weightsPrecision);
+    decompressionScales = std::move(scales);
+    decompressionShifts = std::move(shifts);
+    decompressionGroups = groups;
+}
+
+bool MKLDNNFullyConnectedNode::isDecompressionSupported(InferenceEngine::Precision weightsPrecision, size_t groupSize) {
+    return mayiuse(avx2) && one_of(weightsPrecision, Precision::I8, Precision::U8) &&
+           groupSize % (isa_traits<avx2>::reg::length / sizeof(float)) == 0;
+}
+
+bool MKLDNNFullyConnectedNode::isSparseWeightsSupported(size_t K) {
+    // the expansion of the non-zero weights exists in avx512 only
+    return mayiuse(avx512_common) && K % (isa_traits<avx512_common>::reg::length / sizeof(float)) == 0;
+}
+
+bool MKLDNNFullyConnectedNode::isDynamicQuantizationSupported() {
+    // VNNI accumulates the u8s8 products without the intermediate int16 saturation, so the full s8 range of the weights is used
+    return mayiuse(avx512_core_vnni);
+}
+
+void MKLDNNFullyConnectedNode::compressSparseWeights() {
+    if (!sparseValuesOffsets.empty())
+        return;
+    const size_t K = getDecompressionSrcDims(getInputShapeAtPort(DATA_ID).getStaticDims()).second;
+    const size_t N = getOutputShapeAtPort(0).getStaticDims().back();
+    constexpr size_t simd_w = isa_traits<avx512_common>::reg::length / sizeof(float);
+    const auto* weights = reinterpret_cast<const float*>(getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->GetPtr());
+
+    sparseMasks.reserve(N * K / simd_w);
+    for (size_t n = 0; n < N; n += decompressionColsBlock) {
+        sparseValuesOffsets.push_back(sparseValues.size());
+        const size_t nCols = std::min(decompressionColsBlock, N - n);
+        for (size_t k = 0; k < K; k += simd_w) {
+            for (size_t j = 0; j < nCols; j++) {
+                const float* vector = weights + (n + j) * K + k;
+                uint16_t mask = 0;
+                for (size_t i = 0; i < simd_w; i++) {
+                    if (vector[i] != 0.0f) {
+                        mask |= static_cast<uint16_t>(1u << i);
+                        sparseValues.push_back(vector[i]);
+                    }
+                }
+                sparseMasks.push_back(mask);
+            }
+        }
+    }
+    sparseValues.shrink_to_fit();
+}
+
+void MKLDNNFullyConnectedNode::createDecompressionKernels() {
+    size_t M, K;
+    std::tie(M, K) = getDecompressionSrcDims(getInputShapeAtPort(DATA_ID).getStaticDims());
+
+    jit_fc_decompression_config_params jcp;
+    jcp.weightsPrc = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+    jcp.K = K;
+    jcp.groupSize = withSparseWeights() ? K : K / decompressionGroups;
+    jcp.dstStride = getOutputShapeAtPort(0).getStaticDims().back();
+    jcp.withShifts = !decompressionShifts.empty();
+    jcp.withBiases = withBiases;
+    jcp.sparse = withSparseWeights();
+    // the avx512 kernel processes 16 input channels at once, so the groups must be aligned accordingly
+    const bool useAvx512 = jcp.sparse ||
+                           (mayiuse(avx512_common) && jcp.groupSize % (isa_traits<avx512_common>::reg::length / sizeof(float)) == 0);
+
+    for (size_t rowsTail = 0; rowsTail < 2; rowsTail++) {
+        for (size_t colsTail = 0; colsTail < 2; colsTail++) {
+            jcp.mRows = rowsTail ? M % decompressionRowsBlock : decompressionRowsBlock;
+            jcp.nCols = colsTail ? jcp.dstStride % decompressionColsBlock : decompressionColsBlock;
+            if ((rowsTail == 0 && M < decompressionRowsBlock) || (colsTail == 0 && jcp.dstStride < decompressionColsBlock) ||
+                jcp.mRows == 0 || jcp.nCols == 0)
+                continue;
+
+            auto& kernel = decompressionKernels[rowsTail][colsTail];
+            if (kernel)
+                continue;
+            if (useAvx512) {
+                kernel.reset(new jit_uni_fc_decompression_kernel_impl<avx512_common>(jcp));
+            } else {
+                kernel.reset(new jit_uni_fc_decompression_kernel_impl<avx2>(jcp));
+            }
+            kernel->create_ker();
+        }
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeDecompression() {
+    size_t M, K;
+    std::tie(M, K) = getDecompressionSrcDims(getParentEdgeAt(DATA_ID)->getMemory().getStaticDims());
+    const size_t N = getChildEdgeAt(0)->getMemory().getStaticDims().back();
+    const size_t groups = decompressionGroups;
+
+    constexpr size_t sparseSimdW = isa_traits<avx512_common>::reg::length / sizeof(float);
+
+    const auto* src = reinterpret_cast<const float*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto* weights = reinterpret_cast<const uint8_t*>(getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->GetPtr());
+    const auto* biases = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    parallel_for2d(div_up(M, decompressionRowsBlock), div_up(N, decompressionColsBlock), [&](size_t rowsBlock, size_t colsBlock) {
+        const size_t m = rowsBlock * decompressionRowsBlock;
+        const size_t n = colsBlock * decompressionColsBlock;
+        const auto& kernel = decompressionKernels[M - m < decompressionRowsBlock][N - n < decompressionColsBlock];
+
+        jit_fc_decompression_call_args args;
+        args.src = src + m * K;
+        if (sparseWeights) {
+            args.weights = sparseValues.data() + sparseValuesOffsets[colsBlock];
+            args.masks = sparseMasks.data() + n * (K / sparseSimdW);
+            args.scales = nullptr;
+            args.shifts = nullptr;
+        } else {
+            args.weights = weights + n * K;
+            args.masks = nullptr;
+            args.scales = decompressionScales.data() + n * groups;
+            args.shifts = decompressionShifts.empty() ? nullptr : decompressionShifts.data() + n * groups;
+        }
+        args.biases = biases ? biases + n : nullptr;
+        args.dst = dst + m * N + n;
+        (*kernel)(&args);
+    });
+}
+
+void MKLDNNFullyConnectedNode::createDynamicQuantizationPrimitive() {
+    if (prim)
+        return;
+    size_t M, K;
+    std::tie(M, K) = getDecompressionSrcDims(getInputShapeAtPort(DATA_ID).getStaticDims());
+    const size_t N = getOutputShapeAtPort(0).getStaticDims().back();
+    const auto* weights = reinterpret_cast<const float*>(getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->GetPtr());
+
+    // the weights are quantized symmetrically, so only the zero points of the activations are compensated
+    quantizedWeights.resize(N * K);
+    weightsScales.resize(N);
+    weightsSums.resize(N);
+    parallel_for(N, [&](size_t n) {
+        const float* w = weights + n * K;
+        float absMax = 0.0f;
+        for (size_t k = 0; k < K; k++)
+            absMax = std::max(absMax, std::abs(w[k]));
+        const float scale = absMax > 0.0f ? absMax / 127.0f : 1.0f;
+        int32_t sum = 0;
+        for (size_t k = 0; k < K; k++) {
+            const auto q = static_cast<int8_t>(std::nearbyint(w[k] / scale));
+            quantizedWeights[n * K + k] = q;
+            sum += q;
+        }
+        weightsScales[n] = scale;
+        weightsSums[n] = sum;
+    });
+
+    quantizedSrc.resize(M * K);
+    srcScales.resize(M);
+    srcZeroPoints.resize(M);
+    accumulators.resize(M * N);
+
+    auto dims = [](size_t rows, size_t cols) {
+        return memory::dims{static_cast<memory::dim>(rows), static_cast<memory::dim>(cols)};
+    };
+    // the weights [N, K] are the transposed matrix B [K, N]
+    const memory::desc srcDesc(dims(M, K), memory::data_type::u8, memory::format_tag::ab);
+    const memory::desc weightsDesc(dims(K, N), memory::data_type::s8, memory::format_tag::ba);
+    const memory::desc dstDesc(dims(M, N), memory::data_type::s32, memory::format_tag::ab);
+    const auto engine = getEngine();
+    matmul::primitive_desc primDesc(matmul::desc(srcDesc, weightsDesc, dstDesc), engine);
+    prim.reset(new matmul(primDesc));
+    primArgs = {{DNNL_ARG_SRC, memory(srcDesc, engine, quantizedSrc.data())},
+                {DNNL_ARG_WEIGHTS, memory(weightsDesc, engine, quantizedWeights.data())},
+                {DNNL_ARG_DST, memory(dstDesc, engine, accumulators.data())}};
+}
+
+void MKLDNNFullyConnectedNode::executeDynamicQuantization(mkldnn::stream strm) {
+    size_t M, K;
+    std::tie(M, K) = getDecompressionSrcDims(getParentEdgeAt(DATA_ID)->getMemory().getStaticDims());
+    const size_t N = getChildEdgeAt(0)->getMemory().getStaticDims().back();
+
+    const auto* src = reinterpret_cast<const float*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto* biases = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    // every row is quantized by its own range, which always includes the zero, so the zero activations stay exact
+    parallel_for(M, [&](size_t m) {
+        const float* row = src + m * K;
+        float minValue = 0.0f;
+        float maxValue = 0.0f;
+        for (size_t k = 0; k < K; k++) {
+            minValue = std::min(minValue, row[k]);
+            maxValue = std::max(maxValue, row[k]);
+        }
+        const float scale = maxValue > minValue ? (maxValue - minValue) / 255.0f : 1.0f;
+        const float invScale = 1.0f / scale;
+        const auto zeroPoint = static_cast<int32_t>(std::nearbyint(-minValue * invScale));
+        uint8_t* q = quantizedSrc.data() + m * K;
+        for (size_t k = 0; k < K; k++) {
+            const auto value = static_cast<int32_t>(std::nearbyint(row[k] * invScale)) + zeroPoint;
+            q[k] = static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+        }
+        srcScales[m] = scale;
+        srcZeroPoints[m] = zeroPoint;
+    });
+
+    (*prim).execute(strm, primArgs);
+
+    // (src - zp) * weights = src * weights - zp * sum(weights), then the scales of the row and of the output channel
+    parallel_for2d(M, div_up(N, dequantizationColsBlock), [&](size_t m, size_t colsBlock) {
+        const size_t nStart = colsBlock * dequantizationColsBlock;
+        const size_t nEnd = std::min(N, nStart + dequantizationColsBlock);
+        const int32_t* acc = accumulators.data() + m * N;
+        float* out = dst + m * N;
+        const float srcScale = srcScales[m];
+        const int32_t zeroPoint = srcZeroPoints[m];
+        for (size_t n = nStart; n < nEnd; n++) {
+            out[n] = srcScale * weightsScales[n] * static_cast<float>(acc[n] - zeroPoint * weightsSums[n]);
+            if (biases)
+                out[n] += biases[n];
+        }
+    });
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (withDynamicQuantization()) {
+        createDynamicQuantizationPrimitive();
+        return;
+    }
+    if (withCustomKernel()) {
+        if (withSparseWeights())
+            compressSparseWeights();
+        createDecompressionKernels();
+        return;
+    }
     if (prim)
         return;
 
@@ -151,7 +579,11 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
-    if (prim) {
+    if (withDynamicQuantization()) {
+        executeDynamicQuantization(strm);
+    } else if (withCustomKernel()) {
+        executeDecompression();
+    } else if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
@@ -174,6 +606,9 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // the own kernels have no post operations
+    if (withCustomKernel())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -319,6 +754,8 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (withCustomKernel())
+        return;
     createDescriptorInternal(MemoryDescUtils::convertToDnnlMemoryDesc(inputDesc[0])->getDnnlDesc(),
                              MemoryDescUtils::convertToDnnlMemoryDesc(outputDesc[0])->getDnnlDesc());
 }
@@ -344,6 +781,9 @@ std::shared_ptr<MemoryDesc> MKLDNNFullyConnectedNode::getDstMemDesc(mkldnn::prim
 }
 
 InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const {
+    if (withDynamicQuantization())
+        return Precision::U8;
+
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
     size_t inputsNumLimit = 2;
@@ -12,12 +12,51 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_fc_decompression_config_params {
+    InferenceEngine::Precision weightsPrc;
+    size_t K;
+    size_t groupSize;   // the number of the input channels sharing the decompression scale and shift
+    size_t mRows;       // the number of the source rows processed by the kernel
+    size_t nCols;       // the number of the output channels processed by the kernel
+    size_t dstStride;
+    bool withShifts;
+    bool withBiases;
+    bool sparse;        // the fp32 weights are stored as the masks of the non-zero weights per vector and the non-zero weights only
+};
+
+struct jit_fc_decompression_call_args {
+    const float* src;
+    const void* weights;
+    const uint16_t* masks;
+    const float* scales;
+    const float* shifts;
+    const float* biases;
+    float* dst;
+};
+
+struct jit_uni_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_call_args *);
+
+    void operator()(const jit_fc_decompression_call_args *args) const {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_decompression_kernel(jit_fc_decompression_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_decompression_config_params jcp_;
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -49,6 +88,43 @@ public:
 
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr() override;
 
+    /**
+     * @brief Makes the node consume the compressed weights, which are decompressed in the kernel as weights * scale + shift.
+     * The scales and the shifts are stored as [OC, groups], the groups split the input channels into equal parts.
+     * The shifts may be empty.
+     */
+    void fuseDecompression(const Shape& weightsShape, InferenceEngine::Precision weightsPrecision,
+                           std::vector<float> scales, std::vector<float> shifts, size_t groups);
+    bool withDecompression() const {
+        return decompressionGroups != 0;
+    }
+    static bool isDecompressionSupported(InferenceEngine::Precision weightsPrecision, size_t groupSize);
+
+    /**
+     * @brief Makes the node consume the fp32 constant weights compressed to the masks of the non-zero weights and the non-zero
+     * weights only, which are expanded in the kernel, so the memory traffic of the sparse weights is reduced by their density.
+     */
+    void useSparseWeights() {
+        sparseWeights = true;
+    }
+    bool withSparseWeights() const {
+        return sparseWeights;
+    }
+    static bool isSparseWeightsSupported(size_t K);
+
+    /**
+     * @brief Makes the node quantize the fp32 activations at the runtime: every row (token) of the 'data' input is quantized to u8
+     * with its own scale and zero point, the constant weights are quantized to s8 per output channel once, so the product is computed
+     * by the int8 matmul and the int32 result is dequantized with the scales of the rows and of the output channels.
+     */
+    void useDynamicQuantization() {
+        dynamicQuantization = true;
+    }
+    bool withDynamicQuantization() const {
+        return dynamicQuantization;
+    }
+    static bool isDynamicQuantizationSupported();
+
 private:
     void createDescriptorInternal(const mkldnn::memory::desc &inputDesc,
                                   const mkldnn::memory::desc &outputDesc);
@@ -61,6 +137,42 @@ private:
 
     bool withBiases = false;
 
+    // the compressed and the sparse weights and the dynamically quantized activations are consumed by the own kernels,
+    // not by oneDNN inner product
+    bool withCustomKernel() const {
+        return withDecompression() || withSparseWeights() || withDynamicQuantization();
+    }
+    void createDecompressionKernels();
+    void compressSparseWeights();
+    void executeDecompression();
+    void createDynamicQuantizationPrimitive();
+    void executeDynamicQuantization(mkldnn::stream strm);
+
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionShifts;
+    size_t decompressionGroups = 0;
+    bool sparseWeights = false;
+    // the masks and the non-zero weights in the order of the kernel: the blocks of the output channels, the vectors of
+    // the input channels, the output channels of the block
+    std::vector<uint16_t> sparseMasks;
+    std::vector<float> sparseValues;
+    // the offsets of the non-zero weights of the blocks of the output channels
+    std::vector<size_t> sparseValuesOffsets;
+    // the kernels for the full blocks and the tails of the rows and the output channels, indexed by [rowsTail][colsTail]
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionKernels[2][2];
+
+    bool dynamicQuantization = false;
+    // the weights quantized per output channel [OC, IC], their scales and the sums of the quantized weights of the output
+    // channels, which compensate the zero points of the activations
+    std::vector<int8_t> quantizedWeights;
+    std::vector<float> weightsScales;
+    std::vector<int32_t> weightsSums;
+    // the activations quantized per row, the scales and the zero points of the rows and the int32 result of the matmul
+    std::vector<uint8_t> quantizedSrc;
+    std::vector<float> srcScales;
+    std::vector<int32_t> srcZeroPoints;
+    std::vector<int32_t> accumulators;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
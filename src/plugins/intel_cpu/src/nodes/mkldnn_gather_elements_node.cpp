@@ -3,6 +3,8 @@
 //
 
 #include <cmath>
+#include <limits>
+#include <numeric>
 #include <vector>
 #include <string>
 #include "ie_parallel.hpp"
@@ -67,6 +69,19 @@ void MKLDNNGatherElementsNode::prepareParams() {
             strideAx1Diff_ *= dataDims[i];
         strideAx1Diff_ -= strideAxDst_ * dstDims[axis_];
     }
+    dataAxDim_ = dataDims[axis_];
+
+    useKernel_ = false;
+    const auto dataSize = std::accumulate(dataDims.begin(), dataDims.end(), 1lu, std::multiplies<size_t>());
+    if (dataTypeSize_ == sizeof(int32_t) && dataSize <= static_cast<size_t>(std::numeric_limits<int>::max())) {
+        // the rows are along the inner dims, or along the axis if it's the last one
+        jit_gather_config_params jcp;
+        jcp.slice_rank = 1;
+        jcp.advance_src = strideAxDst_ != 1;
+        if (!gatherKernel_ || gatherKernel_->jcp.advance_src != jcp.advance_src)
+            gatherKernel_ = createGatherJitKernel(jcp);
+        useKernel_ = gatherKernel_ && (!jcp.advance_src || strideAxDst_ >= static_cast<int>(gatherKernel_->step));
+    }
 }
 
 void MKLDNNGatherElementsNode::initSupportedPrimitiveDescriptors() {
@@ -131,7 +146,48 @@ void MKLDNNGatherElementsNode::directExecution() {
     parallel_nt(0, threadBody);
 }
 
+void MKLDNNGatherElementsNode::jitExecution() {
+    const auto *srcData = reinterpret_cast<const int32_t *>(getParentEdgeAt(dataIndex_)->getMemoryPtr()->GetPtr());
+    const auto *indices = reinterpret_cast<const int *>(getParentEdgeAt(indicesIndex_)->getMemoryPtr()->GetPtr());
+    auto *dstData = reinterpret_cast<int32_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    // the outputs of a row read the row of the data: dst[o] = row[lane + indices[o] * strideAxDst_], where the lane
+    // is the position along the inner dims, or the row is along the axis without the inner dims and the lane is zero
+    const bool alongAxis = !gatherKernel_->jcp.advance_src;
+    const int rowLength = alongAxis ? dstAxDim_ : strideAxDst_;
+    const int srcOuterStride = dataAxDim_ * strideAxDst_;
+    const int step = gatherKernel_->step;
+
+    const int outSize = getChildEdgesAtPort(0)[0]->getMemory().GetShape().getElementsCount();
+    auto threadBody = [&](const int ithr, const int nthr) {
+        int start(0lu), end(0lu);
+        splitter(outSize, nthr, ithr, start, end);
+
+        for (int o = start; o < end;) {
+            const int rowEnd = std::min(end, (o / rowLength + 1) * rowLength);
+            const int32_t *row = srcData + (o / strideAxDst_ / dstAxDim_) * srcOuterStride + o % strideAxDst_;
+
+            jit_gather_args args;
+            args.src = row;
+            args.indices = indices + o;
+            args.dst = dstData + o;
+            args.shifts = &strideAxDst_;
+            args.work_amount = (rowEnd - o) / step;
+            (*gatherKernel_)(&args);
+
+            for (int i = o + static_cast<int>(args.work_amount) * step; i < rowEnd; i++)
+                dstData[i] = row[(alongAxis ? 0 : i - o) + indices[i] * strideAxDst_];
+            o = rowEnd;
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void MKLDNNGatherElementsNode::execute(mkldnn::stream strm) {
+    if (useKernel_)
+        return jitExecution();
+
     switch (dataTypeSize_) {
         case sizeof(PrecisionTrait<Precision::I32>::value_type):
             return directExecution<PrecisionTrait<Precision::I32>::value_type>();
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/gather_kernel.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -36,10 +37,16 @@ private:
     int strideAxDst_ = 0;
     int dstAxDim_ = 0;
     int strideAx1Diff_ = 0;
+    int dataAxDim_ = 0;
     std::string errorPrefix_;
 
+    // gathers the 4 bytes elements along the rows of the data, see jitExecution
+    std::shared_ptr<jit_uni_gather_kernel> gatherKernel_ = nullptr;
+    bool useKernel_ = false;
+
     template <typename dataType>
     void directExecution();
+    void jitExecution();
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include <cmath>
+#include <limits>
 #include <vector>
 #include <string>
 #include <mkldnn_types.h>
@@ -97,10 +98,17 @@ void MKLDNNGatherNDNode::prepareParams() {
     attrs.srcStrides = srcMemPtr->GetDescWithType<BlockedMemoryDesc>()->getStrides();
     attrs.dstElementCount = dstMemPtr->GetShape().getElementsCount();
     attrs.sliceRank =  idxMemPtr->getStaticDims().back();
-    execPtr = std::make_shared<GatherNDExecutor>(attrs);
+    if (attrs.dataSize == sizeof(int32_t) && (!gatherKernel || gatherKernel->jcp.slice_rank != static_cast<int>(attrs.sliceRank))) {
+        jit_gather_config_params jcp;
+        jcp.slice_rank = attrs.sliceRank;
+        jcp.advance_src = false;
+        gatherKernel = createGatherJitKernel(jcp);
+    }
+    execPtr = std::make_shared<GatherNDExecutor>(attrs, gatherKernel);
 }
 
-MKLDNNGatherNDNode::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs) : dataSize(attrs.dataSize), sliceRank(attrs.sliceRank) {
+MKLDNNGatherNDNode::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs, const std::shared_ptr<jit_uni_gather_kernel>& kernel)
+        : dataSize(attrs.dataSize), sliceRank(attrs.sliceRank) {
     batchSize = std::accumulate(attrs.srcDims.begin(), attrs.srcDims.begin() + attrs.batchDims, 1lu, std::multiplies<size_t>());
     dataLength = std::accumulate(attrs.srcDims.begin() + sliceRank + attrs.batchDims, attrs.srcDims.end(), 1lu,
                                  std::multiplies<size_t>());
@@ -121,6 +129,10 @@ MKLDNNGatherNDNode::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes&
         dataLength *= dataSize;
         srcBatchStride *= dataSize;
         dstBatchStride *= dataSize;
+    } else if (kernel && dataSize == sizeof(int32_t) && srcBatchStride <= static_cast<size_t>(std::numeric_limits<int>::max())) {
+        // the kernel gathers by the 32 bits offsets within a batch
+        gatherKernel = kernel;
+        kernelShifts.assign(srcShifts.begin(), srcShifts.end());
     }
 }
 
@@ -201,18 +213,31 @@ void MKLDNNGatherNDNode::GatherNDExecutor::gatherElementwise(const MKLDNNMemoryP
         const int32_t* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
         dataType* shiftedDstData = dstData + bStart * dstBatchStride + cStart * dataLength;
 
-        for (size_t b = bStart; b < batchSize; b++) {
-            for (size_t j = cStart; j < cycles; j++) {
+        for (size_t b = bStart; b < batchSize && workCounter < end; b++) {
+            const size_t batchWork = std::min(cycles - cStart, end - workCounter);
+            size_t j = 0lu;
+            if (gatherKernel) {
+                jit_gather_args args;
+                args.src = shiftedSrcData;
+                args.indices = shiftedIndices;
+                args.dst = shiftedDstData;
+                args.shifts = kernelShifts.data();
+                args.work_amount = batchWork / gatherKernel->step;
+                (*gatherKernel)(&args);
+
+                j = args.work_amount * gatherKernel->step;
+                shiftedDstData += j;
+                shiftedIndices += j * sliceRank;
+            }
+            for (; j < batchWork; j++) {
                 size_t dataIdx = 0lu;
                 for (size_t i = 0lu; i < sliceRank; i++)
                     dataIdx += srcShifts[i] * shiftedIndices[i];
                 shiftedDstData[0] = shiftedSrcData[dataIdx];
                 shiftedDstData++;
                 shiftedIndices += sliceRank;
-                if (++workCounter == end) {
-                    return;
-                }
             }
+            workCounter += batchWork;
             cStart = 0lu;
             shiftedSrcData += srcBatchStride;
         }
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/gather_kernel.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -39,7 +40,7 @@ private:
     } attrs;
 
     struct GatherNDExecutor {
-        GatherNDExecutor(const GatherNDAttributes& attrs);
+        GatherNDExecutor(const GatherNDAttributes& attrs, const std::shared_ptr<jit_uni_gather_kernel>& kernel);
         ~GatherNDExecutor() = default;
         void exec(const MKLDNNMemoryPtr& srcMemPtr, const MKLDNNMemoryPtr& idxMemPtr, MKLDNNMemoryPtr& dstMemPtr);
 
@@ -60,6 +61,10 @@ private:
         size_t dstBatchStride = 1lu;
         VectorDims srcShifts;
 
+        // gathers the 4 bytes elements with the index tuples of a batch, the shifts are the ones of the kernel
+        std::shared_ptr<jit_uni_gather_kernel> gatherKernel;
+        std::vector<int> kernelShifts;
+
         struct GatherNDContext {
             GatherNDExecutor* executor;
             const MKLDNNMemoryPtr srcMemPtr;
@@ -80,6 +85,8 @@ private:
 
     using executorPtr = std::shared_ptr<GatherNDExecutor>;
     executorPtr execPtr = nullptr;
+    // kept for the shapes with the same slice rank
+    std::shared_ptr<jit_uni_gather_kernel> gatherKernel = nullptr;
 };
 
 }  // namespace MKLDNNPlugin
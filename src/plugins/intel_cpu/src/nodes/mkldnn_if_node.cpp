@@ -8,19 +8,56 @@
 #include "ie_ngraph_utils.hpp"
 #include "transformations/utils/utils.hpp"
 #include "common/cpu_memcpy.h"
+#include "mkldnn_concat_node.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 using namespace MKLDNNPlugin;
 
+namespace {
+
+// The consumers of the body input read the memory of the If input in place, unless they may write to it or refer to
+// it by their own pointers. These are the conditions of the zero-copy inputs of MKLDNNInferRequest.
+bool canBindInPlace(const MKLDNNNodePtr& inputNode) {
+    for (size_t i = 0; i < inputNode->getChildEdges().size(); i++) {
+        const auto edge = inputNode->getChildEdgeAt(i);
+        const auto& child = edge->getChild();
+        if (child->isConstant() || child->isInPlace() || child->getType() == Split)
+            return false;
+        if (child->getType() == Concatenation) {
+            const auto concat = dynamic_cast<MKLDNNConcatNode*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetData() == edge->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
 MKLDNNIfNode::PortMapHelper::PortMapHelper(const MKLDNNMemoryPtr &from, const std::deque<MKLDNNMemoryPtr>& to,
-                                           const mkldnn::engine& eng) : srcMemPtr(from), dstMemPtrs(to) {
+                                           const mkldnn::engine& eng, bool inPlace)
+        : srcMemPtr(from), dstMemPtrs(to), inPlace(inPlace) {
     if (srcMemPtr->getDesc().isDefined())
         size = srcMemPtr->GetSize();
 }
 
 void MKLDNNIfNode::PortMapHelper::execute(mkldnn::stream& strm) {
+    if (inPlace) {
+        // the input memory of the node may be changed between the inferences (e.g. by the zero-copy graph inputs)
+        for (auto& dstMemPtr : dstMemPtrs) {
+            if (dstMemPtr->GetData() != srcMemPtr->GetData())
+                dstMemPtr->GetPrimitivePtr()->set_data_handle(srcMemPtr->GetData());
+        }
+        return;
+    }
+
     // if output shapes are changed,
     // after subgraph inference we should redefine out memory of 'If'
     redefineTo();
@@ -90,6 +127,7 @@ void MKLDNNIfNode::getSupportedDescriptors() {
         auto inNode = inMapThen.find(param->get_friendly_name());
         if (inNode != inMapThen.end()) {
             inputMemThen.push_back(getToMemories(inNode->second.get(), 0));
+            inputInPlaceThen.push_back(canBindInPlace(inNode->second));
         } else {
             IE_THROW() << "Then body of node If with name " << getName() << " does not have input with name: "
                     << param->get_friendly_name();
@@ -101,6 +139,7 @@ void MKLDNNIfNode::getSupportedDescriptors() {
         auto inNode = inMapElse.find(param->get_friendly_name());
         if (inNode != inMapElse.end()) {
             inputMemElse.push_back(getToMemories(inNode->second.get(), 0));
+            inputInPlaceElse.push_back(canBindInPlace(inNode->second));
         } else {
             IE_THROW() << "Else body of node If with name " << getName() << " does not have input with name: "
                     << param->get_friendly_name();
@@ -201,12 +240,19 @@ void MKLDNNIfNode::createPrimitive() {
 void MKLDNNIfNode::prepareBeforeMappers(const bool isThen, const dnnl::engine& eng) {
     auto &inputPortMap = isThen ? thenInputPortMap : elseInputPortMap;
     auto &inputMems = isThen ? inputMemThen : inputMemElse;
+    auto &inputInPlace = isThen ? inputInPlaceThen : inputInPlaceElse;
     auto &beforeMappers = isThen ? beforeThenMappers : beforeElseMappers;
     for (auto& map_rule : inputPortMap) {
         auto &fromMem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &toMems = inputMems[map_rule.to];
 
-        beforeMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
+        // the dynamic inputs are copied, as the body memory is redefined by the shapes of each inference
+        const auto& fromDesc = fromMem->getDesc();
+        const bool inPlace = inputInPlace[map_rule.to] && fromDesc.isDefined() &&
+                             std::all_of(toMems.begin(), toMems.end(), [&fromDesc](const MKLDNNMemoryPtr& toMem) {
+                                 return toMem->getDesc().isDefined() && toMem->getDesc().isCompatible(fromDesc);
+                             });
+        beforeMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng, inPlace));
     }
 }
 
@@ -229,9 +275,31 @@ std::deque<MKLDNNMemoryPtr> MKLDNNIfNode::getToMemories(const MKLDNNNode* node,
     return memories;
 }
 
+bool MKLDNNIfNode::isBranchOnlyInput(size_t port, bool isThen) const {
+    auto isMapped = [port](const std::vector<PortMap>& portMap) {
+        return std::any_of(portMap.begin(), portMap.end(), [port](const PortMap& rule) {
+            return rule.from == static_cast<int>(port);
+        });
+    };
+    return isMapped(isThen ? thenInputPortMap : elseInputPortMap) && !isMapped(isThen ? elseInputPortMap : thenInputPortMap);
+}
+
+void MKLDNNIfNode::setLazyNodes(std::vector<MKLDNNNodePtr> thenNodes, std::vector<MKLDNNNodePtr> elseNodes) {
+    lazyThenNodes = std::move(thenNodes);
+    lazyElseNodes = std::move(elseNodes);
+}
+
 void MKLDNNIfNode::execute(mkldnn::stream strm) {
     const bool condition = static_cast<const bool>((reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr()))[0]);
 
+    for (const auto& node : condition ? lazyThenNodes : lazyElseNodes) {
+        if (node->isDynamicNode()) {
+            node->executeDynamic(strm);
+        } else {
+            node->execute(strm);
+        }
+    }
+
     auto& beforeMappers = condition ? beforeThenMappers : beforeElseMappers;
     auto& afterMappers = condition ? afterThenMappers : afterElseMappers;
     auto& subGraph = condition ? subGraphThen : subGraphElse;
@@ -27,6 +27,17 @@ public:
 
     void inline setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 
+    /**
+     * @brief Whether the input port is passed only to the body of the given branch
+     */
+    bool isBranchOnlyInput(size_t port, bool isThen) const;
+
+    /**
+     * @brief Sets the nodes of the outer graph only the inputs of one branch depend on. The node executes them before
+     * the selected branch, so the inputs of the other branch are not computed (see MKLDNNGraph::InitLazyBranches).
+     */
+    void setLazyNodes(std::vector<MKLDNNNodePtr> thenNodes, std::vector<MKLDNNNodePtr> elseNodes);
+
 protected:
     void executeDynamicImpl(mkldnn::stream strm) override;
     bool needPrepareParams() const override { return false; };
@@ -45,7 +56,8 @@ private:
 
     class PortMapHelper {
     public:
-        PortMapHelper(const MKLDNNMemoryPtr& from, const std::deque<MKLDNNMemoryPtr>& to, const mkldnn::engine& eng);
+        PortMapHelper(const MKLDNNMemoryPtr& from, const std::deque<MKLDNNMemoryPtr>& to, const mkldnn::engine& eng,
+                      bool inPlace = false);
         ~PortMapHelper() = default;
         void execute(mkldnn::stream& strm);
 
@@ -56,12 +68,17 @@ private:
         std::deque<MKLDNNMemoryPtr> dstMemPtrs;
 
         ptrdiff_t size;
+        // the destination refers to the source data instead of the copy
+        bool inPlace;
     };
 
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph subGraphThen;
     MKLDNNGraph subGraphElse;
     std::vector<std::deque<MKLDNNMemoryPtr>> inputMemThen, inputMemElse;
+    // whether the body inputs may be bound to the input memory of the node without the copy
+    std::vector<bool> inputInPlaceThen, inputInPlaceElse;
+    std::vector<MKLDNNNodePtr> lazyThenNodes, lazyElseNodes;
     std::deque<MKLDNNMemoryPtr> outputMemThen, outputMemElse;
 
     std::vector<std::shared_ptr<PortMapHelper>>
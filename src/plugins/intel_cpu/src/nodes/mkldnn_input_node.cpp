@@ -5,6 +5,7 @@
 #include "mkldnn_input_node.h"
 #include "common/cpu_memcpy.h"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_serialize.h"
 
 #include <string>
 #include <tuple>
@@ -331,14 +332,50 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
     };
 
     auto blobKey = [&, this] () {
-        char ptr[32];
-        snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
+        // the data address identifies the blob only inside the network, the weights shared
+        // between the networks are identified by the data hash
+        std::string dataId;
+        if (weightCache->hasContentKeys()) {
+            dataId = std::to_string(weightCache->GetHashFunc().hash(
+                    static_cast<const unsigned char*>(constOp->get_data_ptr()), size * prec.size()));
+        } else {
+            char ptr[32];
+            snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
+            dataId = ptr;
+        }
         return getName()
                 + "_" + std::to_string(size * prec.size())
-                + "_" + ptr;
+                + "_" + dataId;
+    };
+
+    // The embedding tables are only gathered row by row, so they are consumed right from the constant data,
+    // which is usually mapped from the weights file: a copy would make the whole table resident in the process memory.
+    auto isEmbeddingTable = [&, this] () {
+        bool hasConsumers = false;
+        for (const auto& output : constOp->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                const auto type = TypeFromName(input.get_node()->get_type_name());
+                if (input.get_index() != 0 || !one_of(type, EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum))
+                    return false;
+                hasConsumers = true;
+            }
+        }
+        return hasConsumers;
     };
 
-    if (weightCache) {
+    // The constants of the network imported from the mapped blob are consumed in place, so the processes importing the
+    // same blob (e.g. from a shared memory file) share their pages instead of a copy per process and NUMA node
+    auto isMapped = [&, this] () {
+        const auto& rtInfo = constOp->get_rt_info();
+        const auto found = rtInfo.find(MKLDNNMappedConstantKey);
+        return found != rtInfo.end() && found->second.as<bool>();
+    };
+
+    if ((isEmbeddingTable() || (isMapped() && !hasSubnormals() && !isWA())) && isBlobAligned()) {
+        auto ptr = new MKLDNNMemory(getEngine());
+        ptr->Create(memDesc, constOp->get_data_ptr());
+        memoryPtr = MKLDNNMemoryCPtr(ptr);
+    } else if (weightCache) {
         MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
         memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
     } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
@@ -29,6 +29,7 @@
 #include <utils/shape_inference/shape_inference.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "utils/cpu_utils.hpp"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -2005,6 +2006,82 @@ bool MKLDNNInterpolateNode::needPrepareParams() const {
     return (inputShapesModified() || lastOutputDims != getChildEdgesAtPort(0)[0]->getMemory().getStaticDims());
 }
 
+namespace {
+struct InterpolateKey {
+    MKLDNNInterpolateNode::InterpolateAttrs nodeAttrs;
+    VectorDims srcDims;
+    VectorDims dstDims;
+    std::vector<float> dataScales;
+    mkldnn::primitive_attr attr;
+
+    size_t hash() const;
+    bool operator==(const InterpolateKey& rhs) const;
+};
+
+size_t InterpolateKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, nodeAttrs.mode);
+    seed = hash_combine(seed, nodeAttrs.coordTransMode);
+    seed = hash_combine(seed, nodeAttrs.nearestMode);
+    seed = hash_combine(seed, nodeAttrs.layout);
+
+    seed = hash_combine(seed, nodeAttrs.antialias);
+    seed = hash_combine(seed, nodeAttrs.cubeCoeff);
+
+    seed = get_vector_hash(seed, nodeAttrs.padBegin);
+    seed = get_vector_hash(seed, nodeAttrs.padEnd);
+
+    seed = hash_combine(seed, nodeAttrs.inPrc.getPrecVal());
+    seed = hash_combine(seed, nodeAttrs.outPrc.getPrecVal());
+
+    seed = get_vector_hash(seed, srcDims);
+    seed = get_vector_hash(seed, dstDims);
+    seed = get_vector_hash(seed, dataScales);
+
+    seed = hash_combine(seed, get_attr_hash(*attr.get()));
+    return seed;
+}
+
+bool InterpolateKey::operator==(const InterpolateKey &rhs) const {
+    if (nodeAttrs.mode != rhs.nodeAttrs.mode)
+        return false;
+    if (nodeAttrs.coordTransMode != rhs.nodeAttrs.coordTransMode)
+        return false;
+    if (nodeAttrs.nearestMode != rhs.nodeAttrs.nearestMode)
+        return false;
+    if (nodeAttrs.layout != rhs.nodeAttrs.layout)
+        return false;
+    if (nodeAttrs.antialias != rhs.nodeAttrs.antialias)
+        return false;
+    if (nodeAttrs.cubeCoeff != rhs.nodeAttrs.cubeCoeff)
+        return false;
+    if (nodeAttrs.padBegin != rhs.nodeAttrs.padBegin)
+        return false;
+    if (nodeAttrs.padEnd != rhs.nodeAttrs.padEnd)
+        return false;
+    if (nodeAttrs.inPrc != rhs.nodeAttrs.inPrc)
+        return false;
+    if (nodeAttrs.outPrc != rhs.nodeAttrs.outPrc)
+        return false;
+
+    if (srcDims != rhs.srcDims)
+        return false;
+    if (dstDims != rhs.dstDims)
+        return false;
+    if (dataScales != rhs.dataScales)
+        return false;
+    // the post ops keep the pointers to the data of the fused nodes, which the JIT kernel is generated with
+    if (!(*attr.get() == *rhs.attr.get()))
+        return false;
+
+    return true;
+}
+
+} // namespace
+
 void MKLDNNInterpolateNode::prepareParams() {
     if (!shapesDefined()) {
         IE_THROW() << "Can't prepare params for Interpolate node with name: " << getName() << ", because input/output dims aren't defined";
@@ -2038,20 +2115,34 @@ void MKLDNNInterpolateNode::prepareParams() {
     if (getOutputShapeAtPort(0).getRank() > 2 && (dataScales[0] != 1.f || dataScales[1] != 1.f)) {
         IE_THROW() << "Interpolate layer only supports resize on spatial dimensions(depth, height and width)";
     }
-    if ((interpAttrs.mode == InterpolateMode::nearest || interpAttrs.mode == InterpolateMode::linear_onnx || interpAttrs.mode == InterpolateMode::cubic) &&
-        ((interpAttrs.layout != InterpolateLayoutType::planar && mayiuse(cpu::x64::sse41)) ||
-            (mayiuse(cpu::x64::avx2) && interpAttrs.inPrc == Precision::FP32))) {
-        execPtr = std::make_shared<InterpolateJitExecutor>(interpAttrs,
-                                                           srcDims,
-                                                           dstDims,
-                                                           dataScales,
-                                                           attr);
-    } else {
-        execPtr = std::make_shared<InterpolateRefExecutor>(interpAttrs,
-                                                           srcDims,
-                                                           dstDims,
-                                                           dataScales);
-    }
+
+    // the index tables and the kernel depend on the shapes only, so they are built once per shape and reused by
+    // the infers with the shapes seen before
+    InterpolateKey key = {interpAttrs, srcDims, dstDims, dataScales, attr};
+    auto builder = [](const InterpolateKey& key) -> std::shared_ptr<InterpolateExecutor> {
+        std::shared_ptr<InterpolateExecutor> executor;
+        if ((key.nodeAttrs.mode == InterpolateMode::nearest || key.nodeAttrs.mode == InterpolateMode::linear_onnx ||
+            key.nodeAttrs.mode == InterpolateMode::cubic) &&
+            ((key.nodeAttrs.layout != InterpolateLayoutType::planar && mayiuse(cpu::x64::sse41)) ||
+                (mayiuse(cpu::x64::avx2) && key.nodeAttrs.inPrc == Precision::FP32))) {
+            executor = std::make_shared<InterpolateJitExecutor>(key.nodeAttrs,
+                                                               key.srcDims,
+                                                               key.dstDims,
+                                                               key.dataScales,
+                                                               key.attr);
+        } else {
+            executor = std::make_shared<InterpolateRefExecutor>(key.nodeAttrs,
+                                                               key.srcDims,
+                                                               key.dstDims,
+                                                               key.dataScales);
+        }
+        return executor;
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    execPtr = result.first;
+
     lastOutputDims = dstDims;
 }
 
@@ -110,7 +110,6 @@ public:
     bool needPrepareParams() const override;
     void prepareParams() override;
 
-private:
     struct InterpolateAttrs {
         InterpolateMode mode;
         InterpolateCoordTransMode coordTransMode;
@@ -122,7 +121,10 @@ private:
         InferenceEngine::Precision inPrc;
         InferenceEngine::Precision outPrc;
         InterpolateLayoutType layout;
-    } interpAttrs;
+    };
+
+private:
+    InterpolateAttrs interpAttrs;
 
     class InterpolateExecutor {
         public:
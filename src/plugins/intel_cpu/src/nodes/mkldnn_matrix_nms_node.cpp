@@ -83,15 +83,6 @@ MKLDNNMatrixNmsNode::MKLDNNMatrixNmsNode(const std::shared_ptr<ngraph::Node>& op
     m_gaussianSigma = attrs.gaussian_sigma;
     m_postThreshold = attrs.post_threshold;
     m_normalized = attrs.normalized;
-    if (m_decayFunction == MatrixNmsDecayFunction::LINEAR) {
-        m_decay_fn = [](float iou, float max_iou, float sigma) -> float {
-            return (1. - iou) / (1. - max_iou + 1e-10f);
-        };
-    } else {
-        m_decay_fn = [](float iou, float max_iou, float sigma) -> float {
-            return std::exp((max_iou * max_iou - iou * iou) * sigma);
-        };
-    }
 
     const auto& boxes_dims = getInputShapeAtPort(NMS_BOXES).getDims();
     if (boxes_dims.size() != 3)
@@ -215,12 +206,22 @@ size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* score
     }
 
     for (int64_t i = 1; i < originalSize; i++) {
+        // the decay functions are inlined into the loops over the row, so they are vectorized
+        const float* iouRow = iouMatrix.data() + i * (i - 1) / 2;
         float minDecay = 1.;
-        for (int64_t j = 0; j < i; j++) {
-            auto maxIou = iouMax[j];
-            auto iou = iouMatrix[i * (i - 1) / 2 + j];
-            auto decay = m_decay_fn(iou, maxIou, m_gaussianSigma);
-            minDecay = std::min(minDecay, decay);
+        if (m_decayFunction == MatrixNmsDecayFunction::LINEAR) {
+            for (int64_t j = 0; j < i; j++) {
+                float decay = (1. - iouRow[j]) / (1. - iouMax[j] + 1e-10f);
+                minDecay = std::min(minDecay, decay);
+            }
+        } else {
+            // exp is monotonic, so it's computed once for the min exponent, which starts from 0 for the decay 1
+            float minExponent = 0.;
+            for (int64_t j = 0; j < i; j++) {
+                float exponent = (iouMax[j] * iouMax[j] - iouRow[j] * iouRow[j]) * m_gaussianSigma;
+                minExponent = std::min(minExponent, exponent);
+            }
+            minDecay = std::min(minDecay, std::exp(minExponent));
         }
         auto ds = minDecay * scoresData[candidateIndex[i]];
         if (ds <= m_postThreshold)
@@ -95,7 +95,6 @@ private:
     std::vector<int> m_classOffset;
     size_t m_realNumClasses = 0;
     size_t m_realNumBoxes = 0;
-    float (*m_decay_fn)(float, float, float) = nullptr;
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
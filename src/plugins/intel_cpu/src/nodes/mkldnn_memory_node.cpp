@@ -27,8 +27,8 @@ MKLDNNMemoryNode::MKLDNNMemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MKLDNNMemoryOutputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_input_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -85,8 +85,8 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
 bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_output_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -116,6 +116,15 @@ MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>
 void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
+    if (isDynamicNode()) {
+        // the default state is empty along the undefined dims, it grows by the inferences or is set by the user
+        ownStorage = std::make_shared<MKLDNNStateStorage>(getEngine(), getBaseMemDescAtOutputPort(0));
+        ownStorage->resize(getOutputShapeAtPort(0).getMinDims());
+        ownStorage->getMemory()->FillZero();
+        storage = ownStorage;
+        return;
+    }
+
     dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
 
     // default memory state is zero filled
@@ -146,23 +155,83 @@ MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
 }
 
 MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
-    return dataStore;
+    return storage ? storage->getMemory() : dataStore;
+}
+
+void MKLDNNMemoryInputNode::bindStorage(const MKLDNNStateStorage::Ptr& boundStorage) {
+    storage = boundStorage ? boundStorage : ownStorage;
 }
 
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
+    if (isStateInPlace())
+        return;
+    if (storage) {
+        const auto& state = storage->getMemory();
+        if (!stateAppended) {
+            storage->resize(new_state.getStaticDims());
+            simple_copy(*state, new_state);
+            return;
+        }
+        // the new state starts with the current one, so only the appended data is written
+        const auto stateSize = state->GetSize();
+        const auto newStateSize = new_state.GetSize();
+        IE_ASSERT(newStateSize >= stateSize) << "The appended state " << getName() << " is shrunk";
+        storage->resize(new_state.getStaticDims(), stateSize);
+        cpu_memcpy(static_cast<uint8_t*>(state->GetPtr()) + stateSize,
+                   static_cast<const uint8_t*>(new_state.GetPtr()) + stateSize,
+                   newStateSize - stateSize);
+        return;
+    }
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
     simple_copy(*dataStore, new_state);
 }
 
+void MKLDNNMemoryInputNode::setStateMemories(const std::vector<MKLDNNMemoryPtr>& state, const std::vector<MKLDNNMemoryPtr>& newState) {
+    stateMemories = state;
+    newStateMemories = newState;
+}
+
+void MKLDNNMemoryInputNode::bindState(void* state, void* newState) {
+    for (auto& mem : stateMemories)
+        mem->GetPrimitivePtr()->set_data_handle(state);
+    for (auto& mem : newStateMemories)
+        mem->GetPrimitivePtr()->set_data_handle(newState);
+}
+
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
+    if (isStateInPlace())
+        return;
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
     simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
 }
 
+bool MKLDNNMemoryInputNode::needShapeInfer() const {
+    // the consumers of the appended state view the storage, the child memories are redefined by the execution
+    return !stateAppended;
+}
+
+std::vector<VectorDims> MKLDNNMemoryInputNode::shapeInfer() const {
+    return {storage->getMemory()->getStaticDims()};
+}
+
+void MKLDNNMemoryInputNode::executeDynamicImpl(mkldnn::stream strm) {
+    // the buffers replaced by the previous inference aren't viewed by the graph anymore
+    storage->releaseRetired();
+
+    const auto& state = storage->getMemory();
+    if (!stateAppended) {
+        simple_copy(getChildEdgeAt(0)->getMemory(), *state);
+        return;
+    }
+    const auto desc = getBaseMemDescAtOutputPort(0)->cloneWithNewDims(state->getStaticDims());
+    for (const auto& edge : getChildEdgesAtPort(0))
+        edge->getMemoryPtr()->redefineDesc(*desc, state->GetData());
+}
+
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
     std::lock_guard<std::mutex> lock{MKLDNNMemoryNodeVirtualEdge::holderMutex};
     // in case of output already registered
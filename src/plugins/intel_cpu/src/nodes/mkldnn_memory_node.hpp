@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include "ie_algorithm.hpp"
 #include "mkldnn_input_node.h"
+#include "mkldnn_state_storage.h"
 #include <mkldnn_node.h>
 #include <string>
 #include <memory>
@@ -64,14 +65,24 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override {
+        execute(strm);
+    }
     bool created() const override {
         return getType() == MemoryOutput;
     }
 
+    bool needShapeInfer() const override { return false; }
+    bool needPrepareParams() const override { return false; }
+
     void setInputNode(MKLDNNNode* node) override {
         inputNode = node;
     }
 
+    MKLDNNNode* getInputNode() const {
+        return inputNode;
+    }
+
  private:
     /**
      * @brief keeps reference to input sibling node
@@ -93,14 +104,61 @@ public:
         return true;
     }
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
+    bool needShapeInfer() const override;
+    std::vector<VectorDims> shapeInfer() const override;
+    bool needPrepareParams() const override { return false; }
 
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief The growable storage of the state with the dynamic shape, nullptr for the static state
+     */
+    const MKLDNNStateStorage::Ptr& getStorage() const {
+        return storage;
+    }
+
+    /**
+     * @brief Sets the storage the graph reads and writes the dynamic state in, so the state isn't copied in and out
+     * of the graph. nullptr restores the own storage of the node.
+     */
+    void bindStorage(const MKLDNNStateStorage::Ptr& boundStorage);
+
+    /**
+     * @brief Marks the new state as the current one with the data appended along the outer axis
+     * (Assign(Concat(ReadValue, x))). Then the new state writes only the appended data into the storage, and the
+     * consumers of the state read it from the storage directly: the prefix they view isn't changed by the new state.
+     */
+    void setStateAppended() {
+        stateAppended = true;
+    }
+    bool isStateAppended() const {
+        return stateAppended;
+    }
+
+    /**
+     * @brief Sets the graph memories holding the state and the new state. Then the graph reads and writes the state
+     * in the buffers bound by bindState() instead of copying it through the store.
+     * The memories must not be shared with anything else but each other within their groups.
+     */
+    void setStateMemories(const std::vector<MKLDNNMemoryPtr>& state, const std::vector<MKLDNNMemoryPtr>& newState);
+    bool isStateInPlace() const {
+        return !stateMemories.empty();
+    }
+    void bindState(void* state, void* newState);
+
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNStateStorage::Ptr ownStorage;
+    MKLDNNStateStorage::Ptr storage;
+    bool stateAppended = false;
+    std::vector<MKLDNNMemoryPtr> stateMemories;
+    std::vector<MKLDNNMemoryPtr> newStateMemories;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "mkldnn_non_max_suppression_node.h"
 #include "utils/general_utils.h"
 
 using namespace MKLDNNPlugin;
@@ -72,6 +73,13 @@ MKLDNNMultiClassNmsNode::MKLDNNMultiClassNmsNode(const std::shared_ptr<ngraph::N
         m_sortResultType = MulticlassNmsSortResultType::NONE;
     m_nmsEta = atrri.nms_eta;
     m_normalized = atrri.normalized;
+    // the kernel doesn't add 1 to the sides of the boxes, which the not normalized ones need
+    if (m_normalized) {
+        auto jcp = jit_nms_config_params();
+        jcp.box_encode_type = NMSBoxEncodeType::CORNER;
+        jcp.is_soft_suppressed_by_iou = false;
+        m_nmsKernel = createNmsJitKernel(jcp);
+    }
 
     const auto& boxes_dims = getInputShapeAtPort(NMS_BOXES).getDims();
     if (boxes_dims.size() != 3)
@@ -401,6 +409,20 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
 }
 
 void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
+    // the kernel orders the corners of the boxes, unlike the reference, so it's used for the batches without the flipped boxes
+    std::vector<uint8_t> useKernel(m_numBatches, 0);
+    if (m_nmsKernel) {
+        parallel_for(m_numBatches, [&](size_t batch_idx) {
+            const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
+            bool ordered = true;
+            for (size_t box_idx = 0; box_idx < m_numBoxes && ordered; box_idx++) {
+                const float* box = boxesPtr + box_idx * 4;
+                ordered = box[0] <= box[2] && box[1] <= box[3];
+            }
+            useKernel[batch_idx] = ordered;
+        });
+    }
+
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         if (class_idx != m_backgroundClass) {
             const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
@@ -414,28 +436,69 @@ void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* sco
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                // only the first max_out_box candidates are checked, and the batches and classes run in parallel already
+                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+                std::partial_sort(sorted_boxes.begin(), sorted_boxes.begin() + max_out_box, sorted_boxes.end(),
+                                  [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                 });
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
                 m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
                 io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
+                if (useKernel[batch_idx] && max_out_box > 1) {
+                    std::vector<float> boxCoord0(max_out_box, 0.0f);
+                    std::vector<float> boxCoord1(max_out_box, 0.0f);
+                    std::vector<float> boxCoord2(max_out_box, 0.0f);
+                    std::vector<float> boxCoord3(max_out_box, 0.0f);
+
+                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * 4];
+                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * 4 + 1];
+                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * 4 + 2];
+                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * 4 + 3];
+
+                    float scale = 0.0f;
+                    auto arg = jit_nms_args();
+                    arg.iou_threshold = static_cast<float*>(&m_iouThreshold);
+                    arg.score_threshold = static_cast<float*>(&m_scoreThreshold);
+                    arg.scale = static_cast<float*>(&scale);
+                    arg.selected_boxes_coord[0] = static_cast<float*>(&boxCoord0[0]);
+                    arg.selected_boxes_coord[1] = static_cast<float*>(&boxCoord1[0]);
+                    arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
+                    arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
+
+                    for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
+                        int candidateStatus = NMSCandidateStatus::SELECTED;
+                        arg.selected_boxes_num = io_selection_size;
+                        arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[box_idx].second * 4]);
+                        arg.candidate_status = static_cast<int*>(&candidateStatus);
+                        (*m_nmsKernel)(&arg);
+                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
+                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[box_idx].second * 4];
+                            boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[box_idx].second * 4 + 1];
+                            boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[box_idx].second * 4 + 2];
+                            boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[box_idx].second * 4 + 3];
+                            m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
+                                sorted_boxes[box_idx].second);
+                            io_selection_size++;
                         }
                     }
+                } else {
+                    for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
+                        bool box_is_selected = true;
+                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
+                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
+                                &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
+                            if (iou >= m_iouThreshold) {
+                                box_is_selected = false;
+                                break;
+                            }
+                        }
 
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
+                        if (box_is_selected) {
+                            m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
+                                sorted_boxes[box_idx].second);
+                            io_selection_size++;
+                        }
                     }
                 }
             }
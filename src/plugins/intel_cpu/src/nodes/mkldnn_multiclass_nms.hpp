@@ -7,10 +7,13 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 
+#include <memory>
 #include <string>
 
 namespace MKLDNNPlugin {
 
+struct jit_uni_nms_kernel;
+
 enum class MulticlassNmsSortResultType {
     CLASSID,  // sort selected boxes by class id (ascending) in each batch element
     SCORE,    // sort selected boxes by score (descending) in each batch element
@@ -86,6 +89,9 @@ private:
 
     std::vector<filteredBoxes> m_filtBoxes;
 
+    // the hard suppression kernel of NonMaxSuppression, it's used for the normalized boxes only
+    std::shared_ptr<jit_uni_nms_kernel> m_nmsKernel;
+
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
@@ -693,21 +693,27 @@ bool MKLDNNNonMaxSuppressionNode::isExecutable() const {
     return isDynamicNode() || MKLDNNNode::isExecutable();
 }
 
-void MKLDNNNonMaxSuppressionNode::createJitKernel() {
-    auto jcp = jit_nms_config_params();
-    jcp.box_encode_type = boxEncodingType;
-    jcp.is_soft_suppressed_by_iou = isSoftSuppressedByIOU;
-
+std::shared_ptr<jit_uni_nms_kernel> MKLDNNPlugin::createNmsJitKernel(const jit_nms_config_params& jcp) {
+    std::shared_ptr<jit_uni_nms_kernel> kernel;
     if (mayiuse(cpu::x64::avx512_common)) {
-        nms_kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx512_common>(jcp));
+        kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx512_common>(jcp));
     } else if (mayiuse(cpu::x64::avx2)) {
-        nms_kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx2>(jcp));
+        kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx2>(jcp));
     } else if (mayiuse(cpu::x64::sse41)) {
-        nms_kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::sse41>(jcp));
+        kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::sse41>(jcp));
     }
 
-    if (nms_kernel)
-        nms_kernel->create_ker();
+    if (kernel)
+        kernel->create_ker();
+    return kernel;
+}
+
+void MKLDNNNonMaxSuppressionNode::createJitKernel() {
+    auto jcp = jit_nms_config_params();
+    jcp.box_encode_type = boxEncodingType;
+    jcp.is_soft_suppressed_by_iou = isSoftSuppressedByIOU;
+
+    nms_kernel = createNmsJitKernel(jcp);
 }
 
 void MKLDNNNonMaxSuppressionNode::executeDynamicImpl(mkldnn::stream strm) {
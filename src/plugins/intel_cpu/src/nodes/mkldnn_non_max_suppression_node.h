@@ -60,6 +60,9 @@ struct jit_uni_nms_kernel {
     jit_nms_config_params jcp;
 };
 
+// creates the kernel for the best ISA of the machine, nullptr if the JIT isn't supported on it
+std::shared_ptr<jit_uni_nms_kernel> createNmsJitKernel(const jit_nms_config_params& jcp);
+
 class MKLDNNNonMaxSuppressionNode : public MKLDNNNode {
 public:
     MKLDNNNonMaxSuppressionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -245,6 +245,8 @@ void MKLDNNPoolingNode::prepareParams() {
 
     if (isDynamicNode()) {
         if (auto_pad) {
+            // the shape inference may return the cached output dims, so the pads of the operation are inferred here
+            shapeInferGeneric({inDesc->getShape()});
             std::tie(data_pad_begin, data_pad_end) = getPaddingFromNode(opToShapeInfer);
         }
         initEffectiveAttributes(inDesc->getShape(), outDesc->getShape());
@@ -1924,6 +1924,26 @@ void MKLDNNReduceNode::createPrimitive() {
     if (reduce_kernel)
         reduce_kernel->create_ker();
     jit_mode = jit_mode && reduce_kernel;
+
+    // the partial results are combined by the sum for the modes accumulating the sums, the combination in a lower
+    // output precision is exact only for the modes picking the values
+    const bool pick_mode = one_of(algorithm, ReduceAnd, ReduceOr, ReduceMax, ReduceMin);
+    if (jit_mode && layout == ReduceLayoutType::reduce_blocked &&
+        (output_prec == Precision::FP32 || input_prec == output_prec || pick_mode)) {
+        auto combine_jcp = jcp;
+        combine_jcp.src_dt = jcp.dst_dt;
+        combine_jcp.src_data_size = jcp.dst_data_size;
+        combine_jcp.reduce_mode = (pick_mode || algorithm == ReduceProd) ? algorithm : ReduceSum;
+        if (mayiuse(cpu::x64::avx512_common)) {
+            reduce_combine_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx512_common>(combine_jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            reduce_combine_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx2>(combine_jcp));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            reduce_combine_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::sse41>(combine_jcp));
+        }
+        if (reduce_combine_kernel)
+            reduce_combine_kernel->create_ker();
+    }
 }
 
 void MKLDNNReduceNode::executeDynamicImpl(mkldnn::stream strm) {
@@ -2140,28 +2160,51 @@ void MKLDNNReduceNode::reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr) {
     for (size_t ib = 0; ib < IB; ib++) {
         size_t ob = ReduceN ? 0 : ib; GET_PTR_N_BLK;
         if (!ReduceC && !ReduceD && ReduceH && ReduceW) {
-            parallel_for2d(ICB, ID, [&](size_t icb, size_t id) {
-                size_t ocb = icb, od = id; GET_PTR_NCD_BASE_PTR_N_BLK;
-                reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW * blk_size);
-            });
+            const size_t chunks = split_chunks(ICB * ID, IH * IW);
+            if (chunks > 1) {
+                // the planes are fewer than the threads, so the chunks of every plane are reduced in parallel
+                // step1: the partial results of the chunks
+                const size_t prc_stride = chunks * blk_size * dst_data_size;
+                std::vector<uint8_t> vec_prc(ICB * ID * prc_stride);
+                init_dst_data(vec_prc.data(), vec_prc.size());
+                parallel_for3d(ICB, ID, chunks, [&](size_t icb, size_t id, size_t c) {
+                    size_t start = 0, end = 0;
+                    splitter(IH * IW, chunks, c, start, end);
+                    const uint8_t *in_ptr_ncd = in_ptr_n + src_data_size * ((icb * ID + id) * IH * IW + start) * blk_size;
+                    reduce_kernel_process(in_ptr_ncd, vec_prc.data() + (icb * ID + id) * prc_stride + c * blk_size * dst_data_size,
+                                          (end - start) * blk_size);
+                });
+                // step2: the combination of the partial results
+                parallel_for2d(ICB, ID, [&](size_t icb, size_t id) {
+                    size_t ocb = icb, od = id; GET_PTR_NCD_BASE_PTR_N_BLK;
+                    reduce_combine_process(vec_prc.data() + (icb * ID + id) * prc_stride, out_ptr_ncd, chunks * blk_size);
+                });
+            } else {
+                parallel_for2d(ICB, ID, [&](size_t icb, size_t id) {
+                    size_t ocb = icb, od = id; GET_PTR_NCD_BASE_PTR_N_BLK;
+                    reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW * blk_size);
+                });
+            }
         } else if (ReduceC && ReduceD && ReduceH && ReduceW) {
-            if (input_prec != output_prec || getAlgorithm() == ReduceL2 ||
-                 algorithm == ReduceLogSumExp || algorithm == ReduceSumSquare) {
+            if (!reduce_combine_kernel) {
                 reduce_kernel_process(in_ptr_n, out_ptr_n, ICB * ID * IH * IW * blk_size);
             } else {
                 // reduce parallelly
-                // step1: !ReduceC && ReduceD && ReduceH && ReduceW
-                size_t prc_size = ICB * blk_size * dst_data_size;
+                // step1: the partial results of the chunks of ID * IH * IW per channel block, more than one chunk
+                // only if the channel blocks are fewer than the threads
+                const size_t chunks = split_chunks(ICB, ID * IH * IW);
+                size_t prc_size = ICB * chunks * blk_size * dst_data_size;
                 std::vector<uint8_t> vec_prc(prc_size);
                 init_dst_data(vec_prc.data(), prc_size);
-                uint8_t *out_ptr_n_cp = out_ptr_n;
-                out_ptr_n = vec_prc.data();
-                parallel_for(ICB, [&](size_t icb) {
-                    size_t ocb = icb; GET_PTR_NC_BLK;
-                    reduce_kernel_process(in_ptr_nc, out_ptr_nc, ID * IH * IW * blk_size);
+                parallel_for2d(ICB, chunks, [&](size_t icb, size_t c) {
+                    size_t start = 0, end = 0;
+                    splitter(ID * IH * IW, chunks, c, start, end);
+                    const uint8_t *in_ptr_nc = in_ptr_n + src_data_size * (icb * ID * IH * IW + start) * blk_size;
+                    reduce_kernel_process(in_ptr_nc, vec_prc.data() + (icb * chunks + c) * blk_size * dst_data_size,
+                                          (end - start) * blk_size);
                 });
                 // step2: ReduceC
-                reduce_kernel_process(out_ptr_n, out_ptr_n_cp, ICB * blk_size);
+                reduce_combine_process(vec_prc.data(), out_ptr_n, ICB * chunks * blk_size);
             }
         } else if (ReduceW) {
             for (size_t icb = 0; icb < ICB; icb++) {
@@ -2221,9 +2264,28 @@ void MKLDNNReduceNode::reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t
     for (size_t ib = 0; ib < IB; ib++) {
         size_t ob = ReduceN ? 0 : ib; GET_PTR_N_BLK;
         if (!ReduceD && ReduceH && ReduceW) {
+            const size_t chunks = split_chunks(ID, IH * IW);
+            std::vector<uint8_t> vec_prc(chunks > 1 ? ID * chunks * blk_size * dst_data_size : 0);
             for (size_t icb = 0; icb < ICB; icb++) {
                 size_t ocb = 0;;
                 size_t ic = icb * blk_size;
+                if (chunks > 1 && ic + blk_size <= IC) {
+                    // the chunks of the planes of the full channel blocks are reduced in parallel
+                    init_dst_data(vec_prc.data(), vec_prc.size());
+                    parallel_for2d(ID, chunks, [&](size_t id, size_t c) {
+                        size_t start = 0, end = 0;
+                        splitter(IH * IW, chunks, c, start, end);
+                        const uint8_t *in_ptr_ncd = in_ptr_n + src_data_size * ((icb * ID + id) * IH * IW + start) * blk_size;
+                        reduce_kernel_process(in_ptr_ncd, vec_prc.data() + (id * chunks + c) * blk_size * dst_data_size,
+                                              (end - start) * blk_size);
+                    });
+                    parallel_for(ID, [&](size_t id) {
+                        size_t od = id; GET_PTR_NCD_BASE_PTR_N_BLK;
+                        reduce_combine_process(vec_prc.data() + id * chunks * blk_size * dst_data_size, out_ptr_ncd,
+                                               chunks * blk_size);
+                    });
+                    continue;
+                }
                 parallel_for(ID, [&](size_t id) {
                     size_t od = id; GET_PTR_NCD_BASE_PTR_N_BLK;
                     if (ic + blk_size <= IC) {
@@ -2301,6 +2363,27 @@ inline void MKLDNNReduceNode::reduce_kernel_process(const uint8_t *in_p, uint8_t
     (*reduce_kernel)(&arg);
 }
 
+inline void MKLDNNReduceNode::reduce_combine_process(const uint8_t *in_p, uint8_t *out_p, size_t work_amount) {
+    auto arg = jit_reduce_call_args();
+    arg.src = static_cast<const void *>(in_p);
+    arg.dst = static_cast<void *>(out_p);
+    arg.work_amount = work_amount;
+    arg.work_batch = 1;
+    arg.reduce_stride = reduce_stride;
+
+    (*reduce_combine_kernel)(&arg);
+}
+
+// the number of the chunks every one of the jobs is split to, so that the threads are busy, but the chunks aren't too
+// small to pay for the combination of the partial results
+inline size_t MKLDNNReduceNode::split_chunks(size_t jobs, size_t work_amount) const {
+    const size_t min_chunk_work = 64;
+    const size_t threads = parallel_get_max_threads();
+    if (!reduce_combine_kernel || jobs >= threads)
+        return 1;
+    return std::max<size_t>(std::min(div_up(threads, jobs), work_amount / min_chunk_work), 1);
+}
+
 inline void MKLDNNReduceNode::reduce_kernel_post_process(uint8_t *out_ptr) {
     const size_t integerDivisor = IB * IC * ID * IH * IW / (OB * OC * OD * OH * OW);
     const float divisor = static_cast<float>(integerDivisor);
@@ -106,6 +106,8 @@ private:
     void reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t *out_ptr);
     inline void reduce_kernel_process(const uint8_t *in_p, uint8_t *out_p, size_t work_amount,
                                       size_t reduce_w = 2, size_t work_batch = 1, const int *tab_idx = NULL);
+    inline void reduce_combine_process(const uint8_t *in_p, uint8_t *out_p, size_t work_amount);
+    inline size_t split_chunks(size_t jobs, size_t work_amount) const;
     inline void reduce_kernel_post_process(uint8_t *out_ptr);
     inline void init_dst_data(uint8_t *out_ptr, size_t dst_size);
     inline void create_working_memory();
@@ -149,6 +151,8 @@ private:
     std::shared_ptr<mkldnn::memory> prc_mem;
 
     std::shared_ptr<jit_uni_reduce_kernel> reduce_kernel;
+    // combines the partial results of the split reductions in the output precision, only for the blocked layout
+    std::shared_ptr<jit_uni_reduce_kernel> reduce_combine_kernel;
     std::shared_ptr<jit_uni_reduce_post_kernel> reduce_post_kernel;
 
     static const std::map<const ngraph::DiscreteTypeInfo, std::function<void(const std::shared_ptr<ngraph::Node>& op, MKLDNNReduceNode& node)>> initializers;
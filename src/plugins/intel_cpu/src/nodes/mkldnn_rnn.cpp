@@ -13,6 +13,7 @@
 
 #include <ngraph/node.hpp>
 
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -244,6 +245,60 @@ bool MKLDNNRNN::created() const {
     return getType() == (is_cell ? RNNCell : RNNSeq);
 }
 
+bool MKLDNNRNN::canFuseNextLayer(const MKLDNNRNN& next) const {
+    // the layers of a primitive have the same weights shapes, so the input of the first one is of the state size too
+    if (is_cell || next.is_cell || cell_type != next.cell_type || cell_act != next.cell_act || direction != next.direction ||
+        nativeOrder != next.nativeOrder || N != next.N || T != next.T || SC != next.SC || DC != SC || next.DC != SC ||
+        D != 1 || next.D != 1)
+        return false;
+
+    for (size_t port = 0; port < next.inputShapes.size(); port++) {
+        const int layerPort = getLayerInputPort(0, port);
+        if (port == 0 || layerPort >= 0) {
+            const size_t thisPort = layerPort >= 0 ? layerPort : port;
+            if (getOriginalInputPrecisionAtPort(thisPort) != next.getOriginalInputPrecisionAtPort(port))
+                return false;
+        }
+    }
+    return true;
+}
+
+void MKLDNNRNN::fuseNextLayer(const MKLDNNRNN& next) {
+    L++;
+    // the ports are appended in the order of the ports of the layer, as getLayerInputPort maps them
+    for (size_t port = 0; port < next.inputShapes.size(); port++) {
+        if (getLayerInputPort(L - 1, port) < 0)
+            continue;
+        inputShapes.push_back(next.inputShapes[port]);
+        addOriginalInputPrecision(next.getOriginalInputPrecisionAtPort(port));
+    }
+    for (size_t port = 1; port < next.outputShapes.size(); port++) {
+        outputShapes.push_back(next.outputShapes[port]);
+        addOriginalOutputPrecision(next.getOriginalOutputPrecisionAtPort(port));
+    }
+    addOriginalLayer(next.getOriginalLayers());
+}
+
+int MKLDNNRNN::getLayerInputPort(size_t layer, size_t port) const {
+    const bool isState = port >= 1 && port <= S;
+    const bool isWeights = port >= wIdx && port <= bIdx;
+    if (!isState && !isWeights)
+        return -1;
+    if (layer == 0)
+        return static_cast<int>(port);
+    // the states and the W, R, B of each next layer follow the ports of the first one
+    const size_t layerPortsBegin = bIdx + 1 + (layer - 1) * (S + 3);
+    return static_cast<int>(isState ? layerPortsBegin + port - 1 : layerPortsBegin + S + port - wIdx);
+}
+
+int MKLDNNRNN::getLayerOutputPort(size_t layer, size_t port) const {
+    if (port < 1 || port > S)
+        return -1;
+    if (layer == 0)
+        return static_cast<int>(port);
+    return static_cast<int>(1 + S + (layer - 1) * S + port - 1);
+}
+
 void MKLDNNRNN::getSupportedDescriptors() {
     if (is_cell)
         fillCellDesc();
@@ -438,6 +493,16 @@ void MKLDNNRNN::fillSeqDesc() {
     in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{D, G * SC, SC}), memory::data_type::f32, memory::format_tag::ntc)); // R
     in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{D, Gb * SC}), memory::data_type::f32, memory::format_tag::nc)); // B
 
+    // the next layers have the same states and weights as the first one
+    for (size_t layer = 1; layer < L; layer++) {
+        for (size_t port = 1; port < bIdx + 1; port++) {
+            if (getLayerInputPort(layer, port) >= 0) {
+                const auto layerDesc = in_candidate[port];
+                in_candidate.push_back(layerDesc);
+            }
+        }
+    }
+
     std::vector<MemoryDescPtr> out_candidate;
     out_candidate.reserve(3);
 
@@ -463,6 +528,13 @@ void MKLDNNRNN::fillSeqDesc() {
             out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::ntc));
     }
 
+    for (size_t layer = 1; layer < L; layer++) {
+        for (size_t port = 1; port < S + 1; port++) {
+            const auto layerDesc = out_candidate[port];
+            out_candidate.push_back(layerDesc);
+        }
+    }
+
     createDescriptor(in_candidate, out_candidate);
 }
 
@@ -474,10 +546,6 @@ bool MKLDNNRNN::verifyWeightsPrecision(const Precision &layerPrec, const Precisi
 
 template <typename Prec>
 void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t rIdx) {
-    const auto weightPrec = getOriginalInputPrecisionAtPort(wIdx);
-    if (!verifyWeightsPrecision(runtimePrecision, weightPrec) && runtimePrecision != Precision::BF16 && weightPrec != Precision::FP32) {
-        IE_THROW() << "Doesn't support combination of weights precision: " << weightPrec << " and runtime precision: " << runtimePrecision;
-    }
     // create weight blobs (data and state part)
     InferenceEngine::SizeVector dims_w = { L, D, DC, G, SC };
     InferenceEngine::TensorDesc w_data_desc(runtimePrecision, dims_w, getWeightsLayoutByDims(dims_w, false));
@@ -495,38 +563,50 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
     if (r_ptr == nullptr)
         IE_THROW(NotAllocated) << "Internal blob was not allocated for node " << getName() << ".";
 
-    const size_t ie_w_vec_size = getInputShapeAtPort(wIdx).getElementsCount();
-    const size_t ie_r_vec_size = getInputShapeAtPort(rIdx).getElementsCount();
-
-    auto *wInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(wIdx)[0]->getParent().get());
-    auto wConstBlob = wInputNode->getMemoryPtr();
-
-    auto *rInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(rIdx)[0]->getParent().get());
-    auto rConstBlob = rInputNode->getMemoryPtr();
-
-    std::vector<Prec> ie_w_vec(ie_w_vec_size), ie_r_vec(ie_r_vec_size);
-
-    auto ie_w_ptr = ie_w_vec.data();
-    auto ie_r_ptr = ie_r_vec.data();
-    cpu_convert(wConstBlob->GetPtr(), ie_w_ptr, weightPrec, runtimePrecision, ie_w_vec_size);
-    cpu_convert(rConstBlob->GetPtr(), ie_r_ptr, weightPrec, runtimePrecision, ie_r_vec_size);
-
     const int step = SC * G;
 
-    for (int g = 0; g < G; g++) {
-        for (int out_i = 0; out_i < SC; out_i++) {
-            Prec *l_w_ptr = w_ptr + gate_map[g] * SC + out_i;
-            for (int in_i = 0; in_i < DC; in_i++) {
-                *l_w_ptr = *ie_w_ptr;
-                ie_w_ptr++;
-                l_w_ptr += step;
-            }
+    for (size_t layer = 0; layer < L; layer++) {
+        const size_t layerWIdx = getLayerInputPort(layer, wIdx);
+        const size_t layerRIdx = getLayerInputPort(layer, rIdx);
 
-            Prec *l_r_ptr = r_ptr + gate_map[g] * SC + out_i;
-            for (int in_i = 0; in_i < SC; in_i++) {
-                *l_r_ptr = *ie_r_ptr;
-                ie_r_ptr++;
-                l_r_ptr += step;
+        const auto weightPrec = getOriginalInputPrecisionAtPort(layerWIdx);
+        if (!verifyWeightsPrecision(runtimePrecision, weightPrec) && runtimePrecision != Precision::BF16 && weightPrec != Precision::FP32) {
+            IE_THROW() << "Doesn't support combination of weights precision: " << weightPrec << " and runtime precision: " << runtimePrecision;
+        }
+
+        const size_t ie_w_vec_size = getInputShapeAtPort(layerWIdx).getElementsCount();
+        const size_t ie_r_vec_size = getInputShapeAtPort(layerRIdx).getElementsCount();
+
+        auto *wInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(layerWIdx)[0]->getParent().get());
+        auto wConstBlob = wInputNode->getMemoryPtr();
+
+        auto *rInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(layerRIdx)[0]->getParent().get());
+        auto rConstBlob = rInputNode->getMemoryPtr();
+
+        std::vector<Prec> ie_w_vec(ie_w_vec_size), ie_r_vec(ie_r_vec_size);
+
+        auto ie_w_ptr = ie_w_vec.data();
+        auto ie_r_ptr = ie_r_vec.data();
+        cpu_convert(wConstBlob->GetPtr(), ie_w_ptr, weightPrec, runtimePrecision, ie_w_vec_size);
+        cpu_convert(rConstBlob->GetPtr(), ie_r_ptr, weightPrec, runtimePrecision, ie_r_vec_size);
+
+        Prec *layer_w_ptr = w_ptr + layer * D * DC * G * SC;
+        Prec *layer_r_ptr = r_ptr + layer * D * SC * G * SC;
+        for (int g = 0; g < G; g++) {
+            for (int out_i = 0; out_i < SC; out_i++) {
+                Prec *l_w_ptr = layer_w_ptr + gate_map[g] * SC + out_i;
+                for (int in_i = 0; in_i < DC; in_i++) {
+                    *l_w_ptr = *ie_w_ptr;
+                    ie_w_ptr++;
+                    l_w_ptr += step;
+                }
+
+                Prec *l_r_ptr = layer_r_ptr + gate_map[g] * SC + out_i;
+                for (int in_i = 0; in_i < SC; in_i++) {
+                    *l_r_ptr = *ie_r_ptr;
+                    ie_r_ptr++;
+                    l_r_ptr += step;
+                }
             }
         }
     }
@@ -539,10 +619,6 @@ template <InferenceEngine::Precision::ePrecision Prec>
 void MKLDNNRNN::fillBiases(const int *gate_map) {
     using dataType = typename PrecisionTrait<Prec>::value_type;
 
-    if (getOriginalInputPrecisionAtPort(bIdx) != Precision::FP32) {
-        IE_THROW() << "Doesn't support bias precision: " << getOriginalInputPrecisionAtPort(bIdx);
-    }
-
     InferenceEngine::SizeVector dims_b = { L, D, Gb, SC };
     InferenceEngine::TensorDesc w_bias_data_desc(Prec, dims_b, getWeightsLayoutByDims(dims_b, false));
     Blob::Ptr w_bias_data_mem = InferenceEngine::make_shared_blob<dataType>(w_bias_data_desc);
@@ -551,21 +627,29 @@ void MKLDNNRNN::fillBiases(const int *gate_map) {
     if (b_ptr == nullptr)
         IE_THROW(NotAllocated) << "Internal blob was not allocated for node " << getName() << ".";
 
-    auto *constInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(bIdx)[0]->getParent().get());
-    auto constBlob = constInputNode->getMemoryPtr();
-    auto const elementsCount = constBlob->GetSize() / constBlob->getDesc().getPrecision().size();
-
-    std::vector<dataType> ie_b_vec(elementsCount);
-    cpu_convert(constBlob->GetPtr(),
-                &ie_b_vec[0],
-                MKLDNNExtensionUtils::DataTypeToIEPrecision(constBlob->GetDataType()),
-                Prec,
-                elementsCount);
+    for (size_t layer = 0; layer < L; layer++) {
+        const size_t layerBIdx = getLayerInputPort(layer, bIdx);
+        if (getOriginalInputPrecisionAtPort(layerBIdx) != Precision::FP32) {
+            IE_THROW() << "Doesn't support bias precision: " << getOriginalInputPrecisionAtPort(layerBIdx);
+        }
 
-    for (int g = 0; g < Gb; g++) {
-        dataType *l_b_ptr = b_ptr + gate_map[g] * SC;
-        const dataType *l_ie_b_ptr = &ie_b_vec[g * SC];
-        cpu_memcpy(l_b_ptr, l_ie_b_ptr, SC * sizeof(typename PrecisionTrait<Prec>::value_type));
+        auto *constInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(layerBIdx)[0]->getParent().get());
+        auto constBlob = constInputNode->getMemoryPtr();
+        auto const elementsCount = constBlob->GetSize() / constBlob->getDesc().getPrecision().size();
+
+        std::vector<dataType> ie_b_vec(elementsCount);
+        cpu_convert(constBlob->GetPtr(),
+                    &ie_b_vec[0],
+                    MKLDNNExtensionUtils::DataTypeToIEPrecision(constBlob->GetDataType()),
+                    Prec,
+                    elementsCount);
+
+        dataType *layer_b_ptr = b_ptr + layer * D * Gb * SC;
+        for (int g = 0; g < Gb; g++) {
+            dataType *l_b_ptr = layer_b_ptr + gate_map[g] * SC;
+            const dataType *l_ie_b_ptr = &ie_b_vec[g * SC];
+            cpu_memcpy(l_b_ptr, l_ie_b_ptr, SC * sizeof(typename PrecisionTrait<Prec>::value_type));
+        }
     }
     internalBlobs.push_back(w_bias_data_mem);
 }
@@ -741,6 +825,21 @@ void MKLDNNRNN::createPrimitive() {
     } else {
         IE_THROW() << "Unknown cell type";
     }
+
+    // the primitive takes the states of all the layers in one memory
+    src_iter_mem.clear();
+    dst_iter_mem.clear();
+    if (L > 1) {
+        for (size_t s = 0; s < S; s++) {
+            MKLDNNMemoryPtr srcIter = std::make_shared<MKLDNNMemory>(getEngine());
+            srcIter->Create(in_data_d[RNNInOutKind::HiddenState + s]);
+            src_iter_mem.push_back(srcIter);
+
+            MKLDNNMemoryPtr dstIter = std::make_shared<MKLDNNMemory>(getEngine());
+            dstIter->Create(out_data_d[RNNInOutKind::HiddenState + s]);
+            dst_iter_mem.push_back(dstIter);
+        }
+    }
 }
 
 std::shared_ptr<MemoryDesc> MKLDNNRNN::getSrcMemDesc(mkldnn::primitive_desc_iterator& primitive_desc_it, size_t idx) {
@@ -774,6 +873,32 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
 
     int state_i_tags[] {DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C};
     int state_o_tags[] {DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C};
+    if (L > 1) {
+        // the state of each layer is a contiguous part of the states of all the layers, as the direction is one
+        for (size_t s = 0; s < S; s++) {
+            auto srcIter = static_cast<uint8_t*>(src_iter_mem[s]->GetPtr());
+            for (size_t layer = 0; layer < L; layer++) {
+                const auto& layerState = getParentEdgesAtPort(getLayerInputPort(layer, s + 1))[0]->getMemoryPtr();
+                cpu_memcpy(srcIter + layer * layerState->GetSize(), layerState->GetPtr(), layerState->GetSize());
+            }
+            args[state_i_tags[s]] = src_iter_mem[s]->GetPrimitive();
+            args[state_o_tags[s]] = dst_iter_mem[s]->GetPrimitive();
+        }
+
+        (*prim).execute(strm, args);
+
+        for (size_t s = 0; s < S; s++) {
+            auto dstIter = static_cast<const uint8_t*>(dst_iter_mem[s]->GetPtr());
+            for (size_t layer = 0; layer < L; layer++) {
+                for (const auto& edge : getChildEdgesAtPort(getLayerOutputPort(layer, s + 1))) {
+                    const auto& layerState = edge->getMemoryPtr();
+                    cpu_memcpy(layerState->GetPtr(), dstIter + layer * layerState->GetSize(), layerState->GetSize());
+                }
+            }
+        }
+        return;
+    }
+
     for (size_t s = 0; s < S; s++) {
         args[state_i_tags[s]] = getParentEdgeAt(s+1)->getMemoryPtr()->GetPrimitive();
     }
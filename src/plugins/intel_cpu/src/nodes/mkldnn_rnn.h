@@ -31,6 +31,18 @@ public:
         return nativeOrder;
     }
 
+    /** Checks that the sequence can be computed as the next layer of this one in the same primitive */
+    bool canFuseNextLayer(const MKLDNNRNN& next) const;
+    /** Appends the ports of the states, W, R, B and the output states of the next layer, its edges are moved by the graph optimizer */
+    void fuseNextLayer(const MKLDNNRNN& next);
+    /** The port of this node by the port of a layer, -1 for the data and the sequence lengths, which aren't per layer */
+    int getLayerInputPort(size_t layer, size_t port) const;
+    int getLayerOutputPort(size_t layer, size_t port) const;
+
+    inline size_t getLayersCount() const {
+        return L;
+    }
+
 private:
     void initCell(const std::shared_ptr<ngraph::Node>& op);
     void initSeq(const std::shared_ptr<ngraph::Node>& op);
@@ -74,12 +86,16 @@ private:
     size_t G = 0;   /**< Gate size. LSTM - 4, GRU - 3, RNN - 1 */
     size_t Gb = 0;  /**< Gate size for biases. Gb = GRU_lbr ? G+1 : G */
     size_t S = 2;   /**< Num of state. LSTM - 2, GRU & RNN - 1 */
-    const size_t L = 1;   /**< What is it??. Constant for mkldnn impl */
+    size_t L = 1;   /**< Num of layers, more than 1 if the next sequences are fused */
     const size_t D = 1;   /**< Num of direction. 1 or 2 */
 
     std::vector<DnnlBlockedMemoryDesc> in_data_d;
     std::vector<DnnlBlockedMemoryDesc> out_data_d;
 
+    /** The states of all the layers, which are copied from and to the ports of the layers if there are several */
+    std::vector<MKLDNNMemoryPtr> src_iter_mem;
+    std::vector<MKLDNNMemoryPtr> dst_iter_mem;
+
     enum RNNInOutKind {
         Layer       = 0,
         HiddenState = 1,
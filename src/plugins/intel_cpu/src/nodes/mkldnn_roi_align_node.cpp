@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include <math.h>
+#include <type_traits>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn_types.h>
 #include <utils/bfloat16.hpp>
@@ -14,6 +15,7 @@
 #include "ie_parallel.hpp"
 #include <mkldnn_selective_build.h>
 #include <ngraph/opsets/opset3.hpp>
+#include "common/roi_align_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -214,6 +216,14 @@ void MKLDNNROIAlignNode::executeSpecified() {
         }
     }
 
+    // the average pooling of fp32 data in the layouts with contiguous channels uses the vectorized sampling over
+    // the channels and runs in parallel over the ROIs and the channel blocks
+    if (getAlgorithm() == Algorithm::ROIAlignAvg && !isPlainFmt &&
+        std::is_same<inputType, float>::value && std::is_same<outputType, float>::value) {
+        executeAvgVectorized(reinterpret_cast<const float *>(srcData), srcRoi, srcRoiIdx, reinterpret_cast<float *>(dst), realRois);
+        return;
+    }
+
     for (int n = 0; n < realRois; ++n) {
         int roiOff = n * 4;
         const float* srcRoiPtr = &srcRoi[roiOff];
@@ -363,6 +373,72 @@ void MKLDNNROIAlignNode::executeSpecified() {
     }
 }
 
+void MKLDNNROIAlignNode::executeAvgVectorized(const float *srcData, const float *srcRoi, const int *srcRoiIdx, float *dst, int realRois) {
+    auto &srcMemory0 = getParentEdgeAt(0)->getMemory();
+    auto srcBlockDesc = srcMemory0.GetDescWithType<BlockedMemoryDesc>();
+    auto dstBlockDesc = getChildEdgeAt(0)->getMemory().GetDescWithType<BlockedMemoryDesc>();
+    const auto &inputDimVector = srcMemory0.getStaticDims();
+    const int C = static_cast<int>(inputDimVector[1]);
+    const int H = static_cast<int>(inputDimVector[2]);
+    const int W = static_cast<int>(inputDimVector[3]);
+
+    // a block is all the channels in nhwc or a channel block in nChw16c/nChw8c, strides are of the blocked dims
+    // [N, H, W, C] or [N, C/b, H, W, b]
+    const bool isNhwcFmt = srcBlockDesc->hasLayoutType(LayoutType::nspc);
+    const size_t spatialOffset = isNhwcFmt ? 1 : 2;
+    const size_t blockSize = isNhwcFmt ? C : srcBlockDesc->getBlockDims().back();
+    const size_t blockCount = isNhwcFmt ? 1 : srcBlockDesc->getBlockDims()[1];
+    const auto &srcStrides = srcBlockDesc->getStrides();
+    const auto &dstStrides = dstBlockDesc->getStrides();
+    const size_t srcBlockStride = isNhwcFmt ? 0 : srcStrides[1];
+    const size_t dstBlockStride = isNhwcFmt ? 0 : dstStrides[1];
+
+    for (int n = 0; n < realRois; ++n) {
+        int roiBatchInd = srcRoiIdx[n];
+        if (roiBatchInd < -1) {  // -1 means switched off region
+            IE_THROW() << "Batch index cannot be less, than -1";
+        } else if (roiBatchInd >= inputDimVector[0]) {
+            IE_THROW() << "Demanded batch (id = " << roiBatchInd << ") doesn't exist";
+        }
+    }
+
+    std::vector<std::vector<ROIAlignSample>> samples(realRois);
+    std::vector<size_t> numSamplesInBin(realRois);
+    parallel_for(realRois, [&](int n) {
+        const float* srcRoiPtr = &srcRoi[n * 4];
+        float x1 = srcRoiPtr[0] * spatialScale;
+        float y1 = srcRoiPtr[1] * spatialScale;
+        float x2 = srcRoiPtr[2] * spatialScale;
+        float y2 = srcRoiPtr[3] * spatialScale;
+
+        float roiHeight = std::max(y2 - y1, 1.0f);
+        float roiWidth = std::max(x2 - x1, 1.0f);
+        float binHeight = roiHeight / pooledH;
+        float binWidth = roiWidth / pooledW;
+
+        auto samplingRatioX = samplingRatio == 0 ? static_cast<int>(ceil(binWidth)) : samplingRatio;
+        auto samplingRatioY = samplingRatio == 0 ? static_cast<int>(ceil(binHeight)) : samplingRatio;
+        numSamplesInBin[n] = static_cast<size_t>(samplingRatioX) * samplingRatioY;
+
+        calcROIAlignSamples(x1, y1, binWidth, binHeight, samplingRatioX, samplingRatioY, pooledH, pooledW, H, W,
+                            srcStrides[spatialOffset], srcStrides[spatialOffset + 1], samples[n]);
+    });
+
+    parallel_for2d(realRois, blockCount, [&](int n, size_t blkIdx) {
+        const float *src = srcData + srcRoiIdx[n] * srcStrides[0] + blkIdx * srcBlockStride;
+        float *dstRoi = dst + n * dstStrides[0] + blkIdx * dstBlockStride;
+        const ROIAlignSample *binSamples = samples[n].data();
+        for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
+            for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
+                roiAlignAvgBin(src, binSamples, numSamplesInBin[n],
+                               dstRoi + yBinInd * dstStrides[spatialOffset] + xBinInd * dstStrides[spatialOffset + 1],
+                               blockSize);
+                binSamples += numSamplesInBin[n];
+            }
+        }
+    });
+}
+
 bool MKLDNNROIAlignNode::created() const {
     return getType() == ROIAlign;
 }
@@ -34,6 +34,7 @@ private:
     float spatialScale = 1.0f;
     template <typename inputType, typename outputType>
     void executeSpecified();
+    void executeAvgVectorized(const float *srcData, const float *srcRoi, const int *srcRoiIdx, float *dst, int realRois);
     template<typename T>
     struct ROIAlignExecute;
 
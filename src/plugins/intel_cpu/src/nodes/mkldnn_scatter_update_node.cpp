@@ -10,6 +10,7 @@
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
 #include <algorithm>
+#include <numeric>
 #include "common/cpu_memcpy.h"
 
 #include <ngraph/opsets/opset3.hpp>
@@ -19,6 +20,27 @@ using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+// When several updates target the same destination only the last one is written, so the parallel writes never
+// overlap and the result doesn't depend on the threads order. Returns the indices of the updates to write
+std::vector<size_t> lastUpdatesOfDestinations(const std::vector<size_t>& destinations) {
+    std::vector<size_t> updates(destinations.size());
+    std::iota(updates.begin(), updates.end(), 0);
+    // the indices of the sparse updates are usually unique and sorted
+    if (std::adjacent_find(destinations.begin(), destinations.end(), std::greater_equal<size_t>()) == destinations.end())
+        return updates;
+
+    std::stable_sort(updates.begin(), updates.end(), [&](size_t lhs, size_t rhs) {
+        return destinations[lhs] < destinations[rhs];
+    });
+    auto last = std::unique(updates.rbegin(), updates.rend(), [&](size_t lhs, size_t rhs) {
+        return destinations[lhs] == destinations[rhs];
+    });
+    updates.erase(updates.begin(), last.base());
+    return updates;
+}
+} // namespace
+
 bool MKLDNNScatterUpdateNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         auto scatterElemUpd = ngraph::as_type_ptr<const ngraph::opset3::ScatterElementsUpdate>(op);
@@ -385,9 +407,15 @@ void MKLDNNScatterUpdateNode::scatterUpdate(uint8_t *indices, uint8_t *update, i
     size_t blockToUpdate = srcBlockND[axis + 1];
     size_t blockToUpdateSize = blockToUpdate * dataSize;
 
-    parallel_for2d(batchToUpdate, idxLength, [&](size_t b, size_t idx) {
-        int64_t idxValue = getIndicesValue(indices, idx);
-        uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
+    std::vector<size_t> idxValues(idxLength);
+    for (size_t idx = 0; idx < idxLength; idx++) {
+        idxValues[idx] = getIndicesValue(indices, idx);
+    }
+    const auto updates = lastUpdatesOfDestinations(idxValues);
+
+    parallel_for2d(batchToUpdate, updates.size(), [&](size_t b, size_t u) {
+        size_t idx = updates[u];
+        uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValues[idx] * blockToUpdate) * dataSize;
         uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
         cpu_memcpy(dstEntry, updateEntry, blockToUpdateSize);
     });
@@ -410,6 +438,8 @@ void MKLDNNScatterUpdateNode::scatterNDUpdate(uint8_t *indices, uint8_t *update,
     }
 
     size_t sizeToUpdate = srcBlockND[k] * dataSize;
+    // the slices of the different tuples never overlap, the equal tuples update the same slice
+    std::vector<size_t> dstOffsets(idxTupleNum);
     parallel_for(idxTupleNum, [&](size_t tupleIdx) {
         size_t indicesOffset = tupleIdx * k;
         size_t dstOffset = 0;
@@ -417,9 +447,14 @@ void MKLDNNScatterUpdateNode::scatterNDUpdate(uint8_t *indices, uint8_t *update,
             size_t idxValue = getIndicesValue(indices, indicesOffset + i);
             dstOffset += idxValue * srcBlockND[i + 1];
         }
-        dstOffset *= dataSize;
+        dstOffsets[tupleIdx] = dstOffset * dataSize;
+    });
+    const auto updates = lastUpdatesOfDestinations(dstOffsets);
+
+    parallel_for(updates.size(), [&](size_t u) {
+        size_t tupleIdx = updates[u];
         size_t updateOffset = tupleIdx * sizeToUpdate;
-        cpu_memcpy(dstData + dstOffset, update + updateOffset, sizeToUpdate);
+        cpu_memcpy(dstData + dstOffsets[tupleIdx], update + updateOffset, sizeToUpdate);
     });
 }
 
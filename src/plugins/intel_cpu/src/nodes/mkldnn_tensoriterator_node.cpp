@@ -4,6 +4,7 @@
 
 #include "mkldnn_tensoriterator_node.h"
 
+#include <set>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -144,6 +145,80 @@ private:
     int iter_count;
 };
 
+/**
+ * Slices the full tensor in place: the body memories are pointed to the chunk of the current iteration, so the body
+ * reads the chunk from (or writes it to) the full tensor directly. The chunks must be contiguous.
+ */
+class PortIteratorInPlaceHelper : public PortMapHelper {
+public:
+    PortIteratorInPlaceHelper(const MKLDNNMemoryPtr &full, const std::vector<MKLDNNMemoryPtr> &parts, const PortMap &slice_rule)
+                              : parts(parts) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        iter_count = full->getStaticDims()[slice_rule.axis] / abs_stride;
+
+        full_mem = full->GetPrimitive();
+        chunk_stride_in_byte = parts.front()->GetSize();
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+    }
+
+    static bool isApplicable(const MKLDNNMemoryPtr &full, const MKLDNNMemoryPtr &part, const PortMap &slice_rule) {
+        const auto &full_desc = full->getDesc();
+        const auto &part_desc = part->getDesc();
+        if (!full_desc.hasLayoutType(LayoutType::ncsp) || !part_desc.hasLayoutType(LayoutType::ncsp) ||
+            full_desc.getPrecision() != part_desc.getPrecision())
+            return false;
+
+        // the chunk is contiguous only if all the outer dimensions are 1
+        const auto &full_dims = full->getStaticDims();
+        const size_t abs_stride = std::abs(slice_rule.stride);
+        return full_dims[slice_rule.axis] % abs_stride == 0 &&
+               full->GetSize() == part->GetSize() * (full_dims[slice_rule.axis] / abs_stride) &&
+               std::all_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) { return dim == 1; });
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &part : parts)
+            part->GetPrimitivePtr()->set_data_handle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    mkldnn::memory full_mem;
+    std::vector<MKLDNNMemoryPtr> parts;
+
+    int iter_count;
+};
+
+/**
+ * Double buffers the back edge: the body output and the body input exchange their memories before each iteration
+ * instead of copying the data, so the previous body output becomes the current body input.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<MKLDNNMemoryPtr> &from, const std::vector<MKLDNNMemoryPtr> &to) : from(from), to(to) {}
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter != 0) {
+            auto from_ptr = from.front()->GetPrimitive().get_data_handle();
+            auto to_ptr = to.front()->GetPrimitive().get_data_handle();
+            for (auto &mem : from)
+                mem->GetPrimitivePtr()->set_data_handle(to_ptr);
+            for (auto &mem : to)
+                mem->GetPrimitivePtr()->set_data_handle(from_ptr);
+        }
+    }
+
+private:
+    std::vector<MKLDNNMemoryPtr> from;
+    std::vector<MKLDNNMemoryPtr> to;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -568,11 +643,21 @@ void MKLDNNTensorIteratorNode::prepareInputPorts() {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to get common memory ptr
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
-        else
-            before_mappers.emplace_back(
-                    std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
+            continue;
+        }
+
+        // the body may read the input slices in place if nothing but the body input edges refers to their memory
+        if (!isDynamicNode() && PortIteratorInPlaceHelper::isApplicable(from_mem, to_mem, map_rule)) {
+            const auto aliases = getBodyAliases(to_mem);
+            if (aliases.size() == input_mems[map_rule.to].size()) {
+                before_mappers.emplace_back(std::make_shared<PortIteratorInPlaceHelper>(from_mem, aliases, map_rule));
+                continue;
+            }
+        }
+        before_mappers.emplace_back(
+                std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
     }
 }
 
@@ -582,19 +667,50 @@ void MKLDNNTensorIteratorNode::prepareOutputPorts() {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
-        else
-            after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
+            continue;
+        }
+
+        // the body may write the output slices in place if the body output is used by this port only
+        const auto isBodyOutputUsed = [&](const PortMap& rule) {
+            return rule.to == map_rule.to && rule.from != map_rule.from;
+        };
+        const bool isShared = std::any_of(outputPortMap.begin(), outputPortMap.end(), isBodyOutputUsed) ||
+                              std::any_of(backEdges.begin(), backEdges.end(), [&](const PortMap& rule) { return rule.from == map_rule.to; });
+        if (!isShared && PortIteratorInPlaceHelper::isApplicable(to_mem, from_mem, map_rule)) {
+            const auto aliases = getBodyAliases(from_mem);
+            if (!aliases.empty()) {
+                before_mappers.emplace_back(std::make_shared<PortIteratorInPlaceHelper>(to_mem, aliases, map_rule));
+                continue;
+            }
+        }
+        after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
     }
 }
 
 void MKLDNNTensorIteratorNode::prepareBackEdges() {
     const auto &eng = getEngine();
+    std::set<const void*> swapped;
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
+        // the body input and output of the back edge are double buffered if their memories are not shared with anything else
+        if (from_mem->getDesc().isCompatible(to_mem->getDesc())) {
+            const auto from_ptr = from_mem->GetPrimitive().get_data_handle();
+            const auto to_ptr = to_mem->GetPrimitive().get_data_handle();
+            if (from_ptr == to_ptr)
+                continue;  // the body passes the input through
+
+            const auto from_aliases = getBodyAliases(from_mem);
+            const auto to_aliases = getBodyAliases(to_mem);
+            if (!from_aliases.empty() && !to_aliases.empty() && !swapped.count(from_ptr) && !swapped.count(to_ptr)) {
+                swapped.insert({from_ptr, to_ptr});
+                before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_aliases, to_aliases));
+                continue;
+            }
+        }
         before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
     }
 }
@@ -777,6 +893,25 @@ int MKLDNNTensorIteratorNode::getNumIteration(const std::vector<PortMap>& inputP
     return numIterations;
 }
 
+std::vector<MKLDNNMemoryPtr> MKLDNNTensorIteratorNode::getBodyAliases(const MKLDNNMemoryPtr& mem) {
+    const auto base = static_cast<const uint8_t*>(mem->GetPrimitive().get_data_handle());
+    const auto size = mem->GetSize();
+
+    std::vector<MKLDNNMemoryPtr> aliases;
+    for (const auto& edge : sub_graph.GetEdges()) {
+        const auto& edgeMem = edge->getMemoryPtr();
+        if (!edgeMem || !edgeMem->GetPrimitivePtr())
+            continue;
+        const auto ptr = static_cast<const uint8_t*>(edgeMem->GetPrimitive().get_data_handle());
+        if (ptr == base) {
+            aliases.push_back(edgeMem);
+        } else if (ptr < base + size && base < ptr + edgeMem->GetSize()) {
+            return {};
+        }
+    }
+    return aliases;
+}
+
 std::vector<MKLDNNMemoryPtr> MKLDNNTensorIteratorNode::getToMemories(const MKLDNNNode* node, const size_t port) const {
     std::vector<MKLDNNMemoryPtr> memories;
     for (auto edge : node->getChildEdgesAtPort(port))
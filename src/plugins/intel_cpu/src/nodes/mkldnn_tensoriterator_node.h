@@ -131,6 +131,10 @@ private:
     void reshapeAndFillOutput(mkldnn::stream strm);
     int getNumIteration(const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) const;
 
+    // this method gets all the body memories sharing the data of the given one to redirect them together,
+    // the result is empty if the data is partially viewed by some body memory (e.g. in-place Split outputs)
+    std::vector<MKLDNNMemoryPtr> getBodyAliases(const MKLDNNMemoryPtr& mem);
+
     // this method get all memory ptrs of childs of one port to redefine descs for them
     std::vector<MKLDNNMemoryPtr> getToMemories(const MKLDNNNode* node, const size_t port) const;
 
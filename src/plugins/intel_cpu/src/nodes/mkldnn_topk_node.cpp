@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -135,7 +140,9 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
                 top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
         }
     } else {
-        if (is_last_dim) {
+        if (is_last_dim && src_k >= radix_min_k && dim >= radix_min_dim) {
+            topk_radix(src, dst_data, dst_idx);
+        } else if (is_last_dim) {
             if (mode_max)
                 topk<std::greater>(src, dst_data, dst_idx, in_dims);
             else
@@ -500,6 +507,126 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
     });
 }
 
+namespace {
+
+// the keys are ordered as the values, and reversed for the min mode, so the top k have the greatest keys.
+// -0 has the key of +0, since they are equal for the comparison of the values
+inline uint32_t radixKey(float value, bool mode_max) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (bits == 0x80000000u)
+        bits = 0;
+    const uint32_t key = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    return mode_max ? key : ~key;
+}
+
+}  // namespace
+
+void MKLDNNTopKNode::topk_radix(const float* src_data, float* dst_data, int* dst_idx) {
+    const int radix_bits = 8;
+    const int radix_size = 1 << radix_bits;
+
+    // the axis is split to the chunks of the threads if there are fewer rows than the threads, the chunks are fixed,
+    // so the passes over the row see the same elements in each chunk
+    auto select = [&](int i0, int chunks) {
+        const float* src = src_data + static_cast<size_t>(i0) * dim;
+        auto for_chunks = [&](const std::function<void(int, size_t, size_t)>& func) {
+            parallel_for(chunks, [&](int chunk) {
+                size_t start = 0, end = 0;
+                splitter(static_cast<size_t>(dim), chunks, chunk, start, end);
+                func(chunk, start, end);
+            });
+        };
+
+        // finds the key of the k-th by the histograms of the digits from the highest one, each pass counts only the
+        // keys with the digits found before, remaining is the number of the top k among them
+        std::vector<size_t> histograms(static_cast<size_t>(chunks) * radix_size);
+        uint32_t prefix = 0;
+        uint32_t prefix_mask = 0;
+        size_t remaining = src_k;
+        for (int shift = 32 - radix_bits; shift >= 0; shift -= radix_bits) {
+            std::fill(histograms.begin(), histograms.end(), 0);
+            for_chunks([&](int chunk, size_t start, size_t end) {
+                size_t* histogram = &histograms[chunk * radix_size];
+                for (size_t i = start; i < end; i++) {
+                    const uint32_t key = radixKey(src[i], mode_max);
+                    if ((key & prefix_mask) == prefix)
+                        histogram[(key >> shift) & (radix_size - 1)]++;
+                }
+            });
+            int digit = radix_size - 1;
+            for (; digit > 0; digit--) {
+                size_t digit_count = 0;
+                for (int chunk = 0; chunk < chunks; chunk++)
+                    digit_count += histograms[chunk * radix_size + digit];
+                if (digit_count >= remaining)
+                    break;
+                remaining -= digit_count;
+            }
+            prefix |= static_cast<uint32_t>(digit) << shift;
+            prefix_mask |= static_cast<uint32_t>(radix_size - 1) << shift;
+        }
+
+        // the greater keys are selected, and the first remaining keys equal to the k-th by the index, as the insertion
+        // keeps the first of the equal values
+        const uint32_t threshold = prefix;
+        std::vector<size_t> greater_offsets(chunks + 1, 0);
+        std::vector<size_t> equal_offsets(chunks + 1, 0);
+        for_chunks([&](int chunk, size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                const uint32_t key = radixKey(src[i], mode_max);
+                greater_offsets[chunk + 1] += key > threshold;
+                equal_offsets[chunk + 1] += key == threshold;
+            }
+        });
+        for (int chunk = 0; chunk < chunks; chunk++) {
+            greater_offsets[chunk + 1] += greater_offsets[chunk];
+            equal_offsets[chunk + 1] += equal_offsets[chunk];
+        }
+
+        const size_t greater_num = src_k - remaining;
+        std::vector<std::pair<uint32_t, int>> selected(src_k);
+        for_chunks([&](int chunk, size_t start, size_t end) {
+            size_t greater_pos = greater_offsets[chunk];
+            size_t equal_pos = equal_offsets[chunk];
+            for (size_t i = start; i < end; i++) {
+                const uint32_t key = radixKey(src[i], mode_max);
+                if (key > threshold) {
+                    selected[greater_pos++] = std::make_pair(key, static_cast<int>(i));
+                } else if (key == threshold && equal_pos < remaining) {
+                    selected[greater_num + equal_pos++] = std::make_pair(key, static_cast<int>(i));
+                }
+            }
+        });
+
+        if (sort_value) {
+            std::sort(selected.begin(), selected.end(), [](const std::pair<uint32_t, int>& l, const std::pair<uint32_t, int>& r) {
+                return l.first > r.first || (l.first == r.first && l.second < r.second);
+            });
+        } else {
+            std::sort(selected.begin(), selected.end(), [](const std::pair<uint32_t, int>& l, const std::pair<uint32_t, int>& r) {
+                return l.second < r.second;
+            });
+        }
+        for (int i2 = 0; i2 < src_k; i2++) {
+            if (dst_data)
+                dst_data[static_cast<size_t>(i0) * src_k + i2] = src[selected[i2].second];
+            if (dst_idx)
+                dst_idx[static_cast<size_t>(i0) * src_k + i2] = selected[i2].second;
+        }
+    };
+
+    const int nthr = parallel_get_max_threads();
+    if (before_num >= nthr) {
+        parallel_for(before_num, [&](int i0) {
+            select(i0, 1);
+        });
+    } else {
+        for (int i0 = 0; i0 < before_num; i0++)
+            select(i0, nthr);
+    }
+}
+
 inline int MKLDNNTopKNode::count(VectorDims dims, size_t start_ind, size_t end_ind) {
     size_t count = 1;
     for (size_t i = start_ind; i < end_ind; i++)
@@ -79,6 +79,9 @@ public:
     template<template<typename> class Compare>
     void topk(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
+    // selects the top k of the last axis by the radix of the values, which doesn't depend on k unlike the insertion of topk
+    void topk_radix(const float *src_data, float *dst_data, int *dst_idx);
+
 private:
     const size_t TOPK_DATA = 0;
     const size_t TOPK_K = 1;
@@ -94,6 +97,10 @@ private:
     int dim = 0;
     int before_num = 0;
 
+    // the radix select is used for the last axis if both k and the axis are large
+    static constexpr int radix_min_k = 64;
+    static constexpr int radix_min_dim = 4096;
+
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
 #elif defined(HAVE_SSE) || defined(HAVE_AVX2)
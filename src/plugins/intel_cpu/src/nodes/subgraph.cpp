@@ -15,6 +15,7 @@
 #include <mkldnn_debug.h>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <common/primitive_hashing_utils.hpp>
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/pass/visualize_tree.hpp>
@@ -36,24 +37,46 @@ MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, co
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_common) ?
         dnnl::impl::cpu::x64::avx512_common : dnnl::impl::cpu::x64::avx2;
 
-    // Create a deep local copy of the input snippet to perform canonicalization & code generation
-    // Todo: Probably better to implement a proper copy constructor
     if (const auto tmp_snippet =  ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
-        ngraph::OutputVector subgraph_node_inputs;
-        for (const auto &input : tmp_snippet->input_values()) {
-            auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
-            subgraph_node_inputs.push_back(new_input);
-        }
-        auto new_body = ov::clone_model(*tmp_snippet->get_body().get());
-        snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-        ngraph::copy_runtime_info(tmp_snippet, snippet);
-        snippet->set_friendly_name(tmp_snippet->get_friendly_name());
-        snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+        snippet = copySnippet(tmp_snippet);
     } else {
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
     }
 }
 
+std::shared_ptr<ngraph::snippets::op::Subgraph> MKLDNNSnippetNode::copySnippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original) const {
+    // Create a deep local copy of the input snippet to perform canonicalization & code generation
+    // Todo: Probably better to implement a proper copy constructor
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto &input : original->input_values()) {
+        auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+        subgraph_node_inputs.push_back(new_input);
+    }
+    auto new_body = ov::clone_model(*original->get_body().get());
+    auto copy = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original, copy);
+    copy->set_friendly_name(original->get_friendly_name());
+    // every copy gets its own generator, since the generated code is owned by it
+    copy->set_generator(std::make_shared<CPUGenerator>(host_isa));
+    return copy;
+}
+
+template <typename Args>
+void MKLDNNSnippetNode::fillSchedulingArgs(Args& args) const {
+    std::copy(sch_dims.begin(), sch_dims.end(), args.scheduler_dims);
+    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), args.scheduler_offsets);
+    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &args.scheduler_offsets[sch_offsets_in.size()]);
+    const size_t harness_num_dims = std::min<size_t>(dims_out[max_rank_out_desc_idx].size() - 1, SNIPPETS_MAX_HARNESS_DIMS);
+    for (size_t i = 0; i < inputShapes.size(); i++) {
+        auto b = offsets_in[i].begin();
+        std::copy(b, b + harness_num_dims, &args.data_offsets[i * harness_num_dims]);
+    }
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        auto b = offsets_out[i].begin();
+        std::copy(b, b + harness_num_dims, &args.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+    }
+}
+
 void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -87,12 +110,16 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
+    // Reductions are performed over the innermost dimension of the kernel, so it must be the last logical dimension
+    const bool hasReductions = snippet->has_reductions();
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !hasReductions;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases. So we need to pass an
     //  additional parameter to canonicalization, see snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasBroadcastByC();
+    //  The broadcasting by C can't be checked for dynamic shapes, so the dynamic node doesn't use Blocked descriptors either.
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasReductions &&
+                                     !isDynamicNode() && !hasBroadcastByC();
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -202,6 +229,12 @@ void MKLDNNSnippetNode::selectOptimalPrimitiveDescriptor() {
 }
 
 void MKLDNNSnippetNode::createPrimitive() {
+    // the dynamic node generates the kernels for the actual shapes in prepareParams()
+    if (isDynamicNode()) {
+        MKLDNNNode::createPrimitive();
+        return;
+    }
+
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
     define_schedule();
@@ -211,14 +244,48 @@ void MKLDNNSnippetNode::createPrimitive() {
     // but in future some interface should be defined in order to communicate schedule for a kernel
     // or generate schedule for a kernel.
     // Here kernel is generated for most warying dimension by default.
-    generate();
+    schedule = generate(snippet, false);
+}
+
+void MKLDNNSnippetNode::prepareParams() {
+    define_schedule();
+
+    // The dims other than 1 are not distinguished, since the shape-agnostic kernel gets the actual dims and offsets
+    // in the call args. So the kernel is generated once for every broadcasting pattern
+    KernelKey key;
+    auto addPattern = [&key](const MKLDNNEdgePtr& edge) {
+        auto dims = edge->getMemory().GetDescWithType<BlockedMemoryDesc>()->getBlockDims();
+        std::transform(dims.begin(), dims.end(), dims.begin(), [](size_t dim) { return dim == 1 ? 1 : 0; });
+        key.broadcastPattern.push_back(dims);
+    };
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        addPattern(getParentEdgesAtPort(i)[0]);
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        addPattern(getChildEdgesAtPort(i)[0]);
+    // the decomposed reductions may use the reduced dim (e.g. for the mean), and the rows are never collapsed
+    if (snippet->has_reductions())
+        key.rowLength = sch_dims.back();
+
+    currentKernel = kernelCache.get(key);
+    if (!currentKernel) {
+        currentKernel = std::make_shared<SnippetKernel>();
+        currentKernel->snippet = copySnippet(snippet);
+        currentKernel->schedule = generate(currentKernel->snippet, true);
+        kernelCache.put(key, currentKernel);
+    }
+    schedule = currentKernel->schedule;
+    fillSchedulingArgs(schedulingArgs);
+}
+
+void MKLDNNSnippetNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
 }
 
 void MKLDNNSnippetNode::execute(dnnl::stream strm) {
     if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
         IE_THROW() << "MKLDNNSnippetNode can't use Optimized implementation and can't fallback to reference";
     }
-    jit_snippets_call_args call_args;
+    jit_snippets_call_args call_args = schedulingArgs;
     for (size_t i = 0; i < srcMemPtrs.size(); i++)
         call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(srcMemPtrs[i]->GetData()) + start_offset_in[i];
 
@@ -236,6 +303,21 @@ bool MKLDNNSnippetNode::created() const {
     return getType() == Subgraph;
 }
 
+size_t MKLDNNSnippetNode::KernelKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+    size_t seed = 0;
+    for (const auto& dims : broadcastPattern) {
+        seed = get_vector_hash(seed, dims);
+    }
+    seed = hash_combine(seed, rowLength);
+    return seed;
+}
+
+bool MKLDNNSnippetNode::KernelKey::operator==(const KernelKey& rhs) const {
+    return broadcastPattern == rhs.broadcastPattern && rowLength == rhs.rowLength;
+}
+
 // internal interface for subgraph execution
 
 static size_t argmax_rank(const std::vector<MKLDNNEdgeWeakPtr> &childEdges) {
@@ -301,6 +383,8 @@ void MKLDNNSnippetNode::define_schedule() {
     const auto outBlockingDesc_maxRank = getChildEdgeAt(max_rank_out_desc_idx)->getMemory().GetDescWithType<BlockedMemoryDesc>();
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
     tensorRank = std::max(static_cast<size_t>(rank6D), outBlockingDesc_maxRank->getBlockDims().size());
+    // the schedule is redefined for every new shape of the dynamic node
+    tileRank = 1;
 
     auto initDims = [this, config, &outBlockingDesc_maxRank](size_t tensorRank) {
         // assume all input sizes are even
@@ -308,7 +392,7 @@ void MKLDNNSnippetNode::define_schedule() {
 
         dims_in.resize(inputNum);
         for (size_t i = 0; i < inputNum; i++) {
-            dims_in[i].resize(tensorRank, 1);
+            dims_in[i].assign(tensorRank, 1);
         }
 
         const auto outOrder = outBlockingDesc_maxRank->getOrder();
@@ -331,7 +415,7 @@ void MKLDNNSnippetNode::define_schedule() {
 
         dims_out.resize(outputNum);
         for (size_t i = 0; i < outputNum; i++) {
-            dims_out[i].resize(tensorRank, 1);
+            dims_out[i].assign(tensorRank, 1);
         }
 
         for (size_t i = 0; i < outputNum; i++) {
@@ -392,8 +476,9 @@ void MKLDNNSnippetNode::define_schedule() {
             if (dims_out[max_rank_out_desc_idx].size() - collapsedDims - 2 < 0)
                 break;
 
-            bool canCollapse = true;
-            for (size_t i = 0; i < dims_in.size(); i++) {
+            // the rows of reductions must not be merged
+            bool canCollapse = !snippet->has_reductions();
+            for (size_t i = 0; canCollapse && i < dims_in.size(); i++) {
                 if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
                     (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
                     canCollapse = false;
@@ -431,9 +516,9 @@ void MKLDNNSnippetNode::define_schedule() {
 
     auto initSchedulingInfo = [this, dataSize](const size_t tensorRank) -> void {
         // initialize scheduling information
-        sch_offsets_in.resize(offsets_in.size(), 0);
-        sch_offsets_out.resize(offsets_out.size(), 0);
-        sch_dims.resize(maxTileRank, 1);
+        sch_offsets_in.assign(offsets_in.size(), 0);
+        sch_offsets_out.assign(offsets_out.size(), 0);
+        sch_dims.assign(maxTileRank, 1);
         sch_dims[maxTileRank-1] = dims_out[max_rank_out_desc_idx].back();
         schedulerWorkAmount = fullWorkAmount / dims_out[max_rank_out_desc_idx].back();
         if (tileRank > 1) {
@@ -472,7 +557,7 @@ void MKLDNNSnippetNode::define_schedule() {
     initSchedulingInfo(tensorRank);
 }
 
-void MKLDNNSnippetNode::generate() {
+ngraph::snippets::Schedule MKLDNNSnippetNode::generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph, bool shapeAgnostic) {
     std::vector<MKLDNNEdgePtr> input_first_row;
     for (size_t i = 0; i < inputShapes.size(); i++)
         input_first_row.push_back(getParentEdgesAtPort(i)[0]);
@@ -496,23 +581,12 @@ void MKLDNNSnippetNode::generate() {
     std::transform(output_first_row.begin(), output_first_row.end(), std::back_inserter(output_blocked_shapes), edgeToBlockedShape);
     jit_snippets_compile_args jcp;
     jcp.output_dims = dims_out[max_rank_out_desc_idx];
-    std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
-    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), jcp.scheduler_offsets);
-    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
-    size_t harness_num_dims = jcp.output_dims.size() - 1;
-    if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
+    jcp.shape_agnostic = shapeAgnostic;
+    if (jcp.output_dims.size() - 1 > SNIPPETS_MAX_HARNESS_DIMS) {
         canUseOptimizedImpl = false;
-        harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
-    }
-    for (size_t i = 0; i < inputShapes.size(); i++) {
-        auto b = offsets_in[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
-    }
-    for (size_t i = 0; i < outputShapes.size(); i++) {
-        auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
     }
-    schedule = snippet->generate(output_blocked_shapes, input_blocked_shapes, reinterpret_cast<void*>(&jcp));
+    fillSchedulingArgs(jcp);
+    return subgraph->generate(output_blocked_shapes, input_blocked_shapes, reinterpret_cast<void*>(&jcp));
 }
 
 void MKLDNNSnippetNode::schedule_6d(const jit_snippets_call_args& call_args) const {
@@ -12,6 +12,7 @@
 
 #include "mkldnn_node.h"
 #include "snippets/op/subgraph.hpp"
+#include "cache/lru_cache.h"
 
 #include <array>
 
@@ -37,25 +38,57 @@ public:
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(mkldnn::stream strm) override;
 
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
 private:
     static const size_t rank6D {6};
+    static const size_t kernelCacheCapacity {16};
 
     typedef void (*kernel)(const void *, const void *);
 
+    // The code of a shape-agnostic kernel depends only on the broadcasting pattern of the blocked dims,
+    // and on the row length if the reductions are decomposed using it
+    struct KernelKey {
+        std::vector<VectorDims> broadcastPattern;
+        size_t rowLength = 0;
+
+        size_t hash() const;
+        bool operator==(const KernelKey& rhs) const;
+    };
+
+    // Generated code is owned by the generator of the subgraph it is generated from
+    struct SnippetKernel {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+    };
+
+    std::shared_ptr<ngraph::snippets::op::Subgraph> copySnippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original) const;
+
     void define_schedule();
 
-    void generate();
+    ngraph::snippets::Schedule generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph, bool shapeAgnostic);
+
+    template <typename Args>
+    void fillSchedulingArgs(Args& args) const;
 
     // Evaluates generated snippet using parallel backend
     void schedule_6d(const jit_snippets_call_args& const_args) const;
     void schedule_nt(const jit_snippets_call_args& const_args) const;
 
     // Local copy of subgraph node for canonization & code generation
+    // the dynamic node keeps it intact, since every shape-agnostic kernel is generated from its own copy
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
     // Holds generated snippet with information about how to schedule it
     ngraph::snippets::Schedule schedule;
 
+    // Shape-agnostic kernels of the dynamic node and the currently used one (it's kept alive even if evicted)
+    LruCache<KernelKey, std::shared_ptr<SnippetKernel>> kernelCache {kernelCacheCapacity};
+    std::shared_ptr<SnippetKernel> currentKernel;
+    // Runtime scheduling parameters for the shape-agnostic kernel
+    jit_snippets_call_args schedulingArgs;
+
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
 
@@ -3,6 +3,7 @@
 //
 
 #include "jit_kernel.hpp"
+#include "bfloat16.hpp"
 #include <stdexcept>
 
 using namespace dnnl::impl::cpu::x64;
@@ -124,6 +125,11 @@ InferenceEngine::Precision type2precision<uint8_t>() {
     return InferenceEngine::Precision::U8;
 }
 
+template<>
+InferenceEngine::Precision type2precision<bfloat16_t>() {
+    return InferenceEngine::Precision::BF16;
+}
+
 cpu_isa_t get_current_isa() {
     if (mayiuse(cpu_isa_t::avx512_common))
         return cpu_isa_t::avx512_common;
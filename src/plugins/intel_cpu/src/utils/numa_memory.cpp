@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.h"
+
+#include <cstdint>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+bool bindToNumaNode(void* data, size_t size, int numaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind)
+    // the constants of <numaif.h>, which is not a part of libc
+    constexpr int mpolPreferred = 1;
+    constexpr unsigned mpolMfMove = 1u << 1;
+    constexpr size_t bitsPerLong = sizeof(unsigned long) * 8;
+    if (data == nullptr || numaNodeId < 0)
+        return false;
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + pageSize - 1) & ~(pageSize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) & ~(pageSize - 1);
+    if (begin >= end)
+        return false;
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerLong + 1, 0);
+    nodeMask[numaNodeId / bitsPerLong] |= 1ul << (numaNodeId % bitsPerLong);
+    return syscall(SYS_mbind, begin, end - begin, mpolPreferred, nodeMask.data(), nodeMask.size() * bitsPerLong + 1,
+                   mpolMfMove) == 0;
+#else
+    (void)data;
+    (void)size;
+    (void)numaNodeId;
+    return false;
+#endif
+}
+
+bool lockMemory(void* data, size_t size) {
+#ifdef __linux__
+    return data != nullptr && size != 0 && mlock(data, size) == 0;
+#else
+    (void)data;
+    (void)size;
+    return false;
+#endif
+}
+
+void unlockMemory(void* data, size_t size) {
+#ifdef __linux__
+    munlock(data, size);
+#else
+    (void)data;
+    (void)size;
+#endif
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Sets the NUMA node the physical pages of the memory are preferably allocated on, and moves there the pages which are
+ * already allocated. So the memory of a stream stays local to it even if it is first touched by another thread.
+ * Only the pages which entirely belong to the memory are bound.
+ *
+ * @param data the memory
+ * @param size the size of the memory in bytes
+ * @param numaNodeId the NUMA node
+ * @return true if the memory is bound, false if it is not supported on the platform or failed
+ */
+bool bindToNumaNode(void* data, size_t size, int numaNodeId);
+
+/**
+ * Locks the pages of the memory in the RAM, so they are faulted in right away and never swapped out or faulted again.
+ *
+ * @param data the memory
+ * @param size the size of the memory in bytes
+ * @return true if the memory is locked, false if it is not supported on the platform or failed (e.g. by the limit of
+ * the locked memory of the process)
+ */
+bool lockMemory(void* data, size_t size);
+
+/**
+ * Unlocks the memory locked by lockMemory().
+ */
+void unlockMemory(void* data, size_t size);
+
+}  // namespace MKLDNNPlugin
@@ -7,7 +7,9 @@
 #include <limits>
 #include "backend/gna_types.h"
 #include "quantization.h"
+#include "runtime/gna_float_runtime_parallel.hpp"
 #include <algorithm>
+#include <atomic>
 
 #ifdef DEBUG
 #define QUANTWARNING(...) (fprintf(stderr, __VA_ARGS__))
@@ -107,18 +109,20 @@ void QuantizationCallback<int16_t, int32_t>::runFakeQuantize() const {
 
 template<>
 void QuantizationCallback<int16_t, int32_t>::runQuantize() const {
-    uint32_t num_saturate = 0;
-    for (uint32_t row = 0; row < num_rows; row++) {
+    std::atomic<uint32_t> num_saturate{0};
+    // the rows are independent, they are quantized in parallel for the big layers
+    GNAPluginNS::runtime::ParallelFor(num_rows, num_columns, [&](size_t row) {
+        uint32_t row_saturate = 0;
         for (uint32_t col = 0; col < num_columns; col++) {
             float rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
             float value = ptr_float_weights[row * num_columns + col] * *ptr_weight_scale_factor + rounding_value;
             int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
             if (value > 32767.0) {
                 *ptr_weight_16 = 32767;
-                num_saturate++;
+                row_saturate++;
             } else if (value < -32768.0) {
                 *ptr_weight_16 = -32768;
-                num_saturate++;
+                row_saturate++;
             } else {
                 *ptr_weight_16 = (int16_t) value;
             }
@@ -127,7 +131,8 @@ void QuantizationCallback<int16_t, int32_t>::runQuantize() const {
             int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
             *ptr_weight_16 = 0;
         }
-    }
+        num_saturate += row_saturate;
+    });
     for (uint32_t row = num_rows; row < num_rows_padded; row++) {
         for (uint32_t col = 0; col < num_columns_padded; col++) {
             int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
@@ -157,7 +162,7 @@ void QuantizationCallback<int16_t, int32_t>::runQuantize() const {
 
     if (num_saturate > 0) {
         QUANTWARNING("Warning:  %d / %d saturations in QuantizeAffine16()\n",
-                     num_saturate,
+                     num_saturate.load(),
                      num_rows * num_columns + num_rows);
     }
 }
@@ -340,15 +345,15 @@ void QuantizationCallback<int8_t, gna_compound_bias_t>::runQuantize() const {
     if (ptr_int_biases == nullptr) {
         IE_THROW() << "Int biases are empty";
     }
-    uint32_t num_saturate = 0;
+    std::atomic<uint32_t> num_saturate{0};
 
-    float valueAcc = 0.0;
-    for (uint32_t row = 0; row < num_rows; row++) {
+    // the rows are independent, they are quantized in parallel for the big layers
+    GNAPluginNS::runtime::ParallelFor(num_rows, num_columns, [&](size_t row) {
+        uint32_t row_saturate = 0;
         float scaled_row_max = 0;
         float rounding_value, value;
         for (uint32_t col = 0; col < num_columns; col++) {
             value = ptr_float_weights[row*num_columns + col] * *ptr_weight_scale_factor;
-            valueAcc += value;
             if (fabs(value) > scaled_row_max) {
                 scaled_row_max = fabs(value);
             }
@@ -363,10 +368,10 @@ void QuantizationCallback<int8_t, gna_compound_bias_t>::runQuantize() const {
             value = ptr_float_weights[row * num_columns + col] * (*ptr_weight_scale_factor / ptr_int_biases[row].multiplier) + rounding_value;
             if (value > 127.0) {
                 *ptr_weight_8 = 127;
-                num_saturate++;
+                row_saturate++;
             } else if (value < -128.0) {
                 *ptr_weight_8 = -128;
-                num_saturate++;
+                row_saturate++;
             } else {
                 *ptr_weight_8 = (int8_t) value;
             }
@@ -375,7 +380,8 @@ void QuantizationCallback<int8_t, gna_compound_bias_t>::runQuantize() const {
             int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
             *ptr_weight_8 = 0;
         }
-    }
+        num_saturate += row_saturate;
+    });
     for (uint32_t row = num_rows; row < num_rows_padded; row++) {
         for (uint32_t col = 0; col < num_columns_padded; col++) {
             int8_t *ptr_weight_8 = ptr_int_weights + (row*num_columns_padded + col);
@@ -402,24 +408,26 @@ void QuantizationCallback<int8_t, gna_compound_bias_t>::runQuantize() const {
     }
 
     if (num_saturate > 0) {
-        QUANTWARNING("Warning:  %d / %d saturations in QuantizeAffine8()\n", num_saturate, num_rows * num_columns + num_rows);
+        QUANTWARNING("Warning:  %d / %d saturations in QuantizeAffine8()\n", num_saturate.load(), num_rows * num_columns + num_rows);
     }
 }
 
 template<>
 void QuantizationCallback<int8_t, int8_t>::runQuantize() const {
-    uint32_t num_saturate = 0;
-    for (uint32_t row = 0; row < num_rows; row++) {
+    std::atomic<uint32_t> num_saturate{0};
+    // the rows are independent, they are quantized in parallel for the big layers
+    GNAPluginNS::runtime::ParallelFor(num_rows, num_columns, [&](size_t row) {
+        uint32_t row_saturate = 0;
         for (uint32_t col = 0; col < num_columns; col++) {
             float rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
             float value = ptr_float_weights[row * num_columns + col] * *ptr_weight_scale_factor + rounding_value;
             int8_t* ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
             if (value > 127.0) {
                 *ptr_weight_8 = 127;
-                num_saturate++;
+                row_saturate++;
             } else if (value < -128.0) {
                 *ptr_weight_8 = -128;
-                num_saturate++;
+                row_saturate++;
             } else {
                 *ptr_weight_8 = (int8_t)value;
             }
@@ -428,7 +436,8 @@ void QuantizationCallback<int8_t, int8_t>::runQuantize() const {
             int8_t* ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
             *ptr_weight_8 = 0;
         }
-    }
+        num_saturate += row_saturate;
+    });
     for (uint32_t row = num_rows; row < num_rows_padded; row++) {
         for (uint32_t col = 0; col < num_columns_padded; col++) {
             int8_t* ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
@@ -456,6 +465,6 @@ void QuantizationCallback<int8_t, int8_t>::runQuantize() const {
     }
 
     if (num_saturate > 0) {
-        QUANTWARNING("Warning:  %d / %d saturations in QuantizeAffine8_8()\n", num_saturate, num_rows * num_columns + num_rows);
+        QUANTWARNING("Warning:  %d / %d saturations in QuantizeAffine8_8()\n", num_saturate.load(), num_rows * num_columns + num_rows);
     }
 }
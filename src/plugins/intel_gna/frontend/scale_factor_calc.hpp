@@ -1381,7 +1381,7 @@ class ScaleFactorCalculator {
     template<class T>
     static int GetMandatoryWeightsBytesSize(T ptr) {
         auto info = LayerInfo(ptr);
-        if (info.isConvolution() || info.isScaleShift()) {
+        if (info.isConvolution() || info.isScaleShift() || info.isI16PrecisionForced()) {
             return GetOptionalWeightsBytesSize();
         }
 
@@ -381,8 +381,9 @@ const std::map <const std::pair<Gna2OperationType, int32_t>, const std::string>
 };
 
 GnaWaitStatus GNADeviceHelper::wait(uint32_t reqId, int64_t millisTimeout) {
-    std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
+    // the lock is not held while waiting, so the other requests can be enqueued meanwhile
     const auto status = Gna2RequestWait(reqId, millisTimeout);
+    std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
     if (status == Gna2StatusWarningDeviceBusy) {
         return GNA_REQUEST_PENDING;
     }
@@ -12,6 +12,7 @@
 #include "gna_plugin.hpp"
 #include <gna/gna_config.hpp>
 #include <threading/ie_executor_manager.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <ie_icore.hpp>
 
@@ -19,6 +20,9 @@ namespace GNAPluginNS {
 
 class GNAExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal {
     std::shared_ptr<GNAPlugin> plg;
+    // the thread of the callbacks, the requests started with them are pipelined over the request configs
+    InferenceEngine::ITaskExecutor::Ptr callbackExecutor =
+        std::make_shared<InferenceEngine::CPUStreamsExecutor>(InferenceEngine::IStreamsExecutor::Config{"GNACallbackExecutor"});
 
  public:
      GNAExecutableNetwork(const std::string& aotFileName, std::shared_ptr<GNAPlugin> plg)
@@ -63,7 +67,7 @@ class GNAExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal
     InferenceEngine::IInferRequestInternal::Ptr
         CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                InferenceEngine::OutputsDataMap networkOutputs) override {
-        return std::make_shared<GNAInferRequest>(plg, networkInputs, networkOutputs);
+        return std::make_shared<GNAInferRequest>(plg, networkInputs, networkOutputs, callbackExecutor);
     }
 
     InferenceEngine::IInferRequestInternal::Ptr
@@ -71,7 +75,7 @@ class GNAExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal
                                const std::vector<std::shared_ptr<const ov::Node>>& outputs) override {
         if (!this->_plugin || !this->_plugin->GetCore() || !this->_plugin->GetCore()->isNewAPI())
             return nullptr;
-        return std::make_shared<GNAInferRequest>(plg, inputs, outputs);
+        return std::make_shared<GNAInferRequest>(plg, inputs, outputs, callbackExecutor);
     }
 
     void Export(const std::string &modelFileName) override {
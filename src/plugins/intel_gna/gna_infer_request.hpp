@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <chrono>
+#include <future>
 #include <memory>
 #include <string>
 #include <map>
 
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp/ie_infer_request.hpp"
+#include "threading/ie_itask_executor.hpp"
 #include "gna_plugin.hpp"
 
 namespace GNAPluginNS {
@@ -37,25 +40,58 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
  protected:
     std::shared_ptr<GNAPlugin> plg;
     uint32_t inferRequestIdx = -1;
+    // waits for the queued request and calls the callback, so the caller can queue the next requests meanwhile
+    InferenceEngine::ITaskExecutor::Ptr callbackExecutor;
+    // completion of the request started with the callback and its status
+    std::shared_future<void> callbackCompletion;
+    InferenceEngine::StatusCode callbackStatus = InferenceEngine::OK;
+
+    InferenceEngine::StatusCode WaitForRequest(int64_t millis_timeout) {
+        if (millis_timeout == InferenceEngine::InferRequest::WaitMode::RESULT_READY) {
+            millis_timeout = MAX_TIMEOUT;
+        }
+        const auto waitStatus = plg->WaitFor(inferRequestIdx, millis_timeout);
+
+        if (waitStatus == GNA_REQUEST_PENDING) {
+            // request is still pending so Wait() is needed once again
+            return InferenceEngine::RESULT_NOT_READY;
+        }
+        if (waitStatus == GNA_REQUEST_ABORTED) {
+            // need to preserve invalid state here to avoid next Wait() from clearing it
+            inferRequestIdx = -1;
+            return InferenceEngine::INFER_NOT_STARTED;
+        }
+        return InferenceEngine::OK;
+    }
 
  public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
-                    const std::vector<std::shared_ptr<const ov::Node>>& outputs)
-        : InferenceEngine::IInferRequestInternal(inputs, outputs), plg(plg) {
+                    const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+                    const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor = nullptr)
+        : InferenceEngine::IInferRequestInternal(inputs, outputs), plg(plg), callbackExecutor(callbackExecutor) {
         CreateInferRequest();
     }
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     InferenceEngine::InputsDataMap networkInputs,
-                    InferenceEngine::OutputsDataMap networkOutputs)
-        : InferenceEngine::IInferRequestInternal(networkInputs, networkOutputs), plg(plg) {
+                    InferenceEngine::OutputsDataMap networkOutputs,
+                    const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor = nullptr)
+        : InferenceEngine::IInferRequestInternal(networkInputs, networkOutputs), plg(plg),
+          callbackExecutor(callbackExecutor) {
         CreateInferRequest();
     }
+    ~GNAInferRequest() {
+        // the callback executor refers to the request until the callback is called
+        if (callbackCompletion.valid()) {
+            callbackCompletion.wait();
+        }
+    }
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
      */
     void InferImpl() override {
+        callbackCompletion = {};
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
         // result returned from sync infer wait method
@@ -84,12 +120,18 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
      */
     void StartAsyncImpl() override {
+        callbackCompletion = {};
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
         inferRequestIdx = plg->QueueInference(_inputs, _outputs);
-        // workaround to unblock callback-based flows
-        if (_callback) {
-            auto res = Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        if (!_callback) {
+            return;
+        }
+        auto completion = std::make_shared<std::promise<void>>();
+        callbackCompletion = completion->get_future().share();
+        auto notify = [this, completion] {
+            const auto res = WaitForRequest(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+            callbackStatus = res;
             std::exception_ptr exceptionPtr;
             if (res != InferenceEngine::StatusCode::OK) {
                 try {
@@ -101,33 +143,37 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
                     exceptionPtr = std::current_exception();
                 }
             }
-            _callback(exceptionPtr);
+            // the callback may start the request again, it replaces the completion then
+            auto callback = _callback;
+            callback(exceptionPtr);
+            completion->set_value();
+        };
+        if (callbackExecutor) {
+            callbackExecutor->run(std::move(notify));
+        } else {
+            notify();
         }
     }
 
 
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override {
-        if (inferRequestIdx == -1) {
+        if (!callbackCompletion.valid() && inferRequestIdx == -1) {
             return InferenceEngine::INFER_NOT_STARTED;
         } else if (millis_timeout < -1) {
             IE_THROW(ParameterMismatch);
         }
 
-        if (millis_timeout == InferenceEngine::InferRequest::WaitMode::RESULT_READY) {
-            millis_timeout = MAX_TIMEOUT;
-        }
-        const auto waitStatus = plg->WaitFor(inferRequestIdx, millis_timeout);
-
-        if (waitStatus == GNA_REQUEST_PENDING) {
-            // request is still pending so Wait() is needed once again
-            return InferenceEngine::RESULT_NOT_READY;
-        }
-        if (waitStatus == GNA_REQUEST_ABORTED) {
-            // need to preserve invalid state here to avoid next Wait() from clearing it
-            inferRequestIdx = -1;
-            return InferenceEngine::INFER_NOT_STARTED;
+        if (callbackCompletion.valid()) {
+            // the request is waited by the callback executor
+            auto completion = callbackCompletion;
+            if (millis_timeout == InferenceEngine::InferRequest::WaitMode::RESULT_READY) {
+                completion.wait();
+            } else if (completion.wait_for(std::chrono::milliseconds{millis_timeout}) != std::future_status::ready) {
+                return InferenceEngine::RESULT_NOT_READY;
+            }
+            return callbackStatus;
         }
-        return InferenceEngine::OK;
+        return WaitForRequest(millis_timeout);
     }
 
     IE_SUPPRESS_DEPRECATED_START
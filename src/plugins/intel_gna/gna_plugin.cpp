@@ -10,16 +10,19 @@
 #include <list>
 #include <algorithm>
 #include <map>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <memory>
 #include <utility>
 #include <limits>
+#include <sstream>
 
 #include <ie_common.h>
 #include <legacy/graph_tools.hpp>
 #include <legacy/net_pass.h>
+#include <exec_graph_info.hpp>
 #include <debug.h>
 #include <gna/gna_config.hpp>
 #include "gna_plugin_config.hpp"
@@ -80,6 +83,7 @@
 #include "transformations/convert_precision.hpp"
 
 #include <ngraph/opsets/opset7.hpp>
+#include <ngraph/op/util/op_types.hpp>
 
 #include <gna2-model-api.h>
 
@@ -643,6 +647,82 @@ void GNAPlugin::AddDebugProperties(const InferenceEngine::CNNLayerPtr layer,
 }
 #endif
 
+std::shared_ptr<InferenceEngine::details::CNNNetworkImpl> GNAPlugin::ConvertToLegacyNetwork(const CNNNetwork& network,
+        const std::string& effectiveGnaCompileTarget) const {
+    CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
+    const auto& graph = clonedNetwork.getFunction();
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    // In OV API 2.0(IRv10) default convertion to fp32 (inputs, outputs and weights) is disabled
+    // and we need to run the ConvertPrecision transformation to support old networks.
+    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array{{ngraph::element::f16, ngraph::element::f32}});
+    manager.register_pass<ngraph::pass::ConvertMVN1ToMVN6>();
+    manager.register_pass<DecomposeMVN>();
+    manager.register_pass<ngraph::pass::CommonOptimizations>();
+    manager.register_pass<RemoveInputConvert>();
+    manager.register_pass<RemoveOutputConvert>();
+    manager.register_pass<ngraph::pass::LSTMCellDecomposition>();
+    manager.register_pass<ConvertDWSCToScaleShifts>();
+    manager.register_pass<ConvertPaddedToValidConv>();
+    manager.register_pass<Decompose2DConvTransposedWithBiasAF>(effectiveGnaCompileTarget, config.gnaPrecision);
+    manager.register_pass<Decompose2DConvTransposedWithBias>(effectiveGnaCompileTarget, config.gnaPrecision);
+    manager.register_pass<Decompose2DConv>(effectiveGnaCompileTarget, config.gnaPrecision);
+    // TODO enable this transformation for networks with convolutions
+    if (!ngraph::op::util::has_op_with_type<ngraph::opset7::Convolution>(graph)) {
+        manager.register_pass<ConvertMatmulWithFqToPointWiseConvolution>();
+        manager.register_pass<ConvertMatmulWithBiasToPointWiseConvolution>();
+        manager.register_pass<ConvertMatmulToPointWiseConvolution>();
+    }
+    manager.register_pass<SplitConvolutionWithFq>();
+    manager.register_pass<SplitConvolutionWithBias>();
+    manager.register_pass<SplitConvolution>();
+    manager.register_pass<InsertReshapeAroundMatmulWithTranspose>();
+    manager.register_pass<InsertReshapeAroundMatmulWithFq>();
+    manager.register_pass<InsertReshapeAroundMatmulWithAdd>();
+    manager.register_pass<InsertReshapeAroundMatmul>();
+    manager.register_pass<SwapInputMatMulWithTrailingTranspose>();
+    manager.register_pass<SwapInputMatMulWithAct>();
+    manager.register_pass<SwapInputMatMulWithFq>();
+    manager.register_pass<SwapInputMatMulWithBias>();
+    manager.register_pass<SwapInputMatMul>();
+    manager.register_pass<HandleTransposesAroundMatMul>();
+    manager.register_pass<InsertTransposeAfterConvOrPool>();
+    manager.register_pass<ReorderActivationAndPooling>();
+    manager.register_pass<RemoveSingleInputConcat>();
+    manager.register_pass<SubstituteSoftsign>();
+    manager.register_pass<ngraph::pass::ConvertOpSet3ToOpSet2>();
+    manager.register_pass<ngraph::pass::ConvertOpSet2ToOpSet1>();
+    manager.register_pass<ngraph::pass::ConvertOpSet1ToLegacy>();
+    manager.register_pass<RemoveExtraReshapes>();
+    /*
+      Put BroadcastAddMultiplyConst here after ConvertOpSet..() transformations since there are conficts with them.
+      ngraph::pass::ConvertOpSet1ToLegacy -> ngraph::pass::BiasFusions ->
+                                                ngraph::pass::ConvAddFusion, ngraph::pass::ConvMultiplyFusion
+      That transormations fuse bias into convolution and recognizes const node as [1, C, 1, 1].
+      TODO: move that transformation just beyond RemoveSingleInputConcat pass after removing ConvertOpSet1ToLegacy
+          transormations
+    */
+    manager.register_pass<BroadcastAddMultiplyConst>();
+    // UnrollTI should be the last transformation in the transformation pipeline
+    manager.register_pass<ngraph::pass::UnrollTensorIterator>();
+    const auto& pass_config = manager.get_pass_config();
+
+    // Allowing FP16 Converts to be folded and FP16 constants to upgrade to FP32 data type
+    pass_config->disable<ov::pass::ConvertCompressedOnlyToLegacy>();
+    pass_config->disable<ov::pass::DisableDecompressionConvertConstantFolding>();
+
+    pass_config->disable<ngraph::pass::FakeQuantizeMulFusion>();
+    pass_config->disable<ngraph::pass::FakeQuantizeReshapeFusion>();
+    pass_config->disable<ngraph::pass::PullTransposeThroughFQUp>();
+    pass_config->disable<ngraph::pass::ReluFakeQuantizeFusion>();
+    // Consider to enable after per-channel quantization on FakeQuantize layer is supported in GNAPlugin, see issue 52034
+    pass_config->disable<ngraph::pass::AddFakeQuantizeFusion>();
+    // TransposeReduction can be enabled when Transpose-Conv-Transpose patterns will be handled in ngraph transformations
+    pass_config->disable<ngraph::pass::TransposeReduction>();
+    manager.run_passes(graph);
+    return InferenceEngine::details::convertFunctionToICNNNetwork(graph, clonedNetwork);
+}
+
 void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
     OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "LoadNetwork");
     std::shared_ptr<InferenceEngine::details::CNNNetworkImpl> convertedNetwork;
@@ -660,79 +740,8 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
     bool fake_quantized = false;
 
     if (_network.getFunction()) {
-        CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(_network);
-        const auto& graph = clonedNetwork.getFunction();
-        ngraph::pass::Manager manager;
-        manager.register_pass<ngraph::pass::InitNodeInfo>();
-        fake_quantized = ngraph::op::util::has_op_with_type<ngraph::opset7::FakeQuantize>(graph);
-        // In OV API 2.0(IRv10) default convertion to fp32 (inputs, outputs and weights) is disabled
-        // and we need to run the ConvertPrecision transformation to support old networks.
-        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array{{ngraph::element::f16, ngraph::element::f32}});
-        manager.register_pass<ngraph::pass::ConvertMVN1ToMVN6>();
-        manager.register_pass<DecomposeMVN>();
-        manager.register_pass<ngraph::pass::CommonOptimizations>();
-        manager.register_pass<RemoveInputConvert>();
-        manager.register_pass<RemoveOutputConvert>();
-        manager.register_pass<ngraph::pass::LSTMCellDecomposition>();
-        manager.register_pass<ConvertDWSCToScaleShifts>();
-        manager.register_pass<ConvertPaddedToValidConv>();
-        manager.register_pass<Decompose2DConvTransposedWithBiasAF>(effectiveGnaCompileTarget, config.gnaPrecision);
-        manager.register_pass<Decompose2DConvTransposedWithBias>(effectiveGnaCompileTarget, config.gnaPrecision);
-        manager.register_pass<Decompose2DConv>(effectiveGnaCompileTarget, config.gnaPrecision);
-        // TODO enable this transformation for networks with convolutions
-        if (!ngraph::op::util::has_op_with_type<ngraph::opset7::Convolution>(graph)) {
-            manager.register_pass<ConvertMatmulWithFqToPointWiseConvolution>();
-            manager.register_pass<ConvertMatmulWithBiasToPointWiseConvolution>();
-            manager.register_pass<ConvertMatmulToPointWiseConvolution>();
-        }
-        manager.register_pass<SplitConvolutionWithFq>();
-        manager.register_pass<SplitConvolutionWithBias>();
-        manager.register_pass<SplitConvolution>();
-        manager.register_pass<InsertReshapeAroundMatmulWithTranspose>();
-        manager.register_pass<InsertReshapeAroundMatmulWithFq>();
-        manager.register_pass<InsertReshapeAroundMatmulWithAdd>();
-        manager.register_pass<InsertReshapeAroundMatmul>();
-        manager.register_pass<SwapInputMatMulWithTrailingTranspose>();
-        manager.register_pass<SwapInputMatMulWithAct>();
-        manager.register_pass<SwapInputMatMulWithFq>();
-        manager.register_pass<SwapInputMatMulWithBias>();
-        manager.register_pass<SwapInputMatMul>();
-        manager.register_pass<HandleTransposesAroundMatMul>();
-        manager.register_pass<InsertTransposeAfterConvOrPool>();
-        manager.register_pass<ReorderActivationAndPooling>();
-        manager.register_pass<RemoveSingleInputConcat>();
-        manager.register_pass<SubstituteSoftsign>();
-        manager.register_pass<ngraph::pass::ConvertOpSet3ToOpSet2>();
-        manager.register_pass<ngraph::pass::ConvertOpSet2ToOpSet1>();
-        manager.register_pass<ngraph::pass::ConvertOpSet1ToLegacy>();
-        manager.register_pass<RemoveExtraReshapes>();
-        /*
-          Put BroadcastAddMultiplyConst here after ConvertOpSet..() transformations since there are conficts with them.
-          ngraph::pass::ConvertOpSet1ToLegacy -> ngraph::pass::BiasFusions ->
-                                                    ngraph::pass::ConvAddFusion, ngraph::pass::ConvMultiplyFusion
-          That transormations fuse bias into convolution and recognizes const node as [1, C, 1, 1].
-          TODO: move that transformation just beyond RemoveSingleInputConcat pass after removing ConvertOpSet1ToLegacy
-              transormations
-        */
-        manager.register_pass<BroadcastAddMultiplyConst>();
-        // UnrollTI should be the last transformation in the transformation pipeline
-        manager.register_pass<ngraph::pass::UnrollTensorIterator>();
-        const auto& pass_config = manager.get_pass_config();
-
-        // Allowing FP16 Converts to be folded and FP16 constants to upgrade to FP32 data type
-        pass_config->disable<ov::pass::ConvertCompressedOnlyToLegacy>();
-        pass_config->disable<ov::pass::DisableDecompressionConvertConstantFolding>();
-
-        pass_config->disable<ngraph::pass::FakeQuantizeMulFusion>();
-        pass_config->disable<ngraph::pass::FakeQuantizeReshapeFusion>();
-        pass_config->disable<ngraph::pass::PullTransposeThroughFQUp>();
-        pass_config->disable<ngraph::pass::ReluFakeQuantizeFusion>();
-        // Consider to enable after per-channel quantization on FakeQuantize layer is supported in GNAPlugin, see issue 52034
-        pass_config->disable<ngraph::pass::AddFakeQuantizeFusion>();
-        // TransposeReduction can be enabled when Transpose-Conv-Transpose patterns will be handled in ngraph transformations
-        pass_config->disable<ngraph::pass::TransposeReduction>();
-        manager.run_passes(graph);
-        convertedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(graph, clonedNetwork);
+        fake_quantized = ngraph::op::util::has_op_with_type<ngraph::opset7::FakeQuantize>(_network.getFunction());
+        convertedNetwork = ConvertToLegacyNetwork(_network, effectiveGnaCompileTarget);
         isNgraphPassesUsed = true;
     }
     IE_SUPPRESS_DEPRECATED_START
@@ -810,6 +819,31 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         passIdx = passes->run(passIdx);
     };
 
+    // the layers are marked before the quantization, the quantized copy of the network keeps the mark
+    if (!config.i16PrecisionLayers.empty() && config.gnaPrecision == Precision::I8 && !fake_quantized &&
+        !gnaFlags->input_low_precision) {
+        std::set<std::string> notFound = config.i16PrecisionLayers;
+        for (auto&& layer : CNNNetSortTopologically(network)) {
+            std::vector<std::string> names = {layer->name};
+            auto originalNames = layer->params.find(ExecGraphInfoSerialization::ORIGINAL_NAMES);
+            if (originalNames != layer->params.end()) {
+                std::stringstream namesStream(originalNames->second);
+                for (std::string name; std::getline(namesStream, name, ',');) {
+                    names.push_back(name);
+                }
+            }
+            for (auto&& name : names) {
+                if (config.i16PrecisionLayers.count(name)) {
+                    layer->params[kI16PrecisionParam] = name;
+                    notFound.erase(name);
+                }
+            }
+        }
+        for (auto&& name : notFound) {
+            gnawarn() << "The layer " << name << " of GNA_PRECISION_I16_LAYERS is not found in the network\n";
+        }
+    }
+
     InferenceEngine::CNNNetwork newNet;
 
     if (gnaFlags->sw_fp32) {
@@ -844,6 +878,11 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         }
     }
 
+    // the graph is compiled from the quantized copy only, so the converted network and the nGraph
+    // function it keeps alive (with the FP32 constants of the precision conversion) are released here
+    network = InferenceEngine::CNNNetwork();
+    convertedNetwork.reset();
+
     auto inputLayers = CNNNetGetAllInputLayers(newNet);
 
 #ifdef PLOT
@@ -979,13 +1018,18 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 
     void *pParallelExecutionData  = nullptr;
 
-    // reserving more bytes for intermediate data in parallel case - TODO: this works incorrectly in compact mode at lest
+    // reserving more bytes for intermediate data in parallel case, the copies are placed after the (compacted)
+    // region of the first request, since the requests not bound to a layer are not overlapped
+    gnamem->setCompactMode(gnaFlags->compact_mode);
     rwSegmentSize = gnamem->getRWBytes();
+    const auto rwSegmentSizeNotCompact = gnamem->getRWBytesNotCompact();
     if (gnaFlags->gna_lib_async_threads_num > 1) {
-        gnamem->reserve_ptr(nullptr, &pParallelExecutionData, gnamem->getRWBytes() * (gnaFlags->gna_lib_async_threads_num - 1), 64);
+        gnamem->reserve_ptr(nullptr, &pParallelExecutionData, rwSegmentSize * (gnaFlags->gna_lib_async_threads_num - 1), 64);
     }
 
     gnamem->commit(gnaFlags->compact_mode);
+    gnalog() << "GNA memory footprint: " << gnamem->getTotalBytes() << " bytes, read/write region of a request: "
+             << rwSegmentSize << " bytes, without buffers reuse: " << rwSegmentSizeNotCompact << " bytes" << std::endl;
 
     dnn->Init(gnamem->getBasePtr(),
              gnamem->getTotalBytes(),
@@ -1157,13 +1201,16 @@ void GNAPlugin::DumpXNNToFile() const {
 
 uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result) {
     auto& nnets = gnaRequestConfigToRequestIdMap;
+    std::unique_lock<std::mutex> lockRequestConfigs{requestConfigsSync};
     auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
         return std::get<1>(item) == -1;
     });
 
     if (freeNnet == nnets.end()) {
         if (!graphCompiler.memory_connection.empty()) {
+            lockRequestConfigs.unlock();
             Wait(0);
+            lockRequestConfigs.lock();
             freeNnet = nnets.begin();
         } else {
             IE_THROW(RequestBusy)
@@ -1172,102 +1219,118 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
                                << " parallel infer requests, please sync one of already running";
         }
     }
+    // the request config is taken until it is waited, its input and output buffers are used by this request only
+    std::get<1>(*freeNnet) = RESERVED_REQUEST_ID;
+    lockRequestConfigs.unlock();
 
     auto idx = static_cast<uint32_t>(std::distance(std::begin(nnets), freeNnet));
-
-    int inputNum = 0;
-    for (auto &input : inputs) {
-        auto inputLayout = input.second->getTensorDesc().getLayout();
-        if (inputLayout != Layout::C && inputLayout != Layout::NC && inputLayout != Layout::CN &&
-            inputLayout != Layout::CHW && inputLayout != Layout::NCHW) {
-            THROW_GNA_EXCEPTION << "Expected input blob to have Layout::C, Layout::NC, Layout::CN, Layout::NCHW or Layout::CHW. But was: "
-                                << input.second->getTensorDesc().getLayout();
+    try {
+        for (auto& output : outputs_.Get()) {
+            if (output.orientation == kDnnUnknownOrientation) {
+                // should not happen in user code however might happen if there any non executable network based integration of GNAPlugin instance
+                THROW_GNA_EXCEPTION << "network not loaded : output orientation not set";
+            }
         }
 
-        if (inputLayout == Layout::NCHW || inputLayout == Layout::CHW) {
-            // specific case that can be squeezed to 2d
-            inputLayout = Layout::NC;
-        }
+        int inputNum = 0;
+        for (auto &input : inputs) {
+            // the description is looked up once, the method is called for every frame of the streaming models
+            auto& inputDesc = inputs_ptr_->at(input.first);
+            auto inputLayout = input.second->getTensorDesc().getLayout();
+            if (inputLayout != Layout::C && inputLayout != Layout::NC && inputLayout != Layout::CN &&
+                inputLayout != Layout::CHW && inputLayout != Layout::NCHW) {
+                THROW_GNA_EXCEPTION << "Expected input blob to have Layout::C, Layout::NC, Layout::CN, Layout::NCHW or Layout::CHW. But was: "
+                                    << input.second->getTensorDesc().getLayout();
+            }
 
-        auto is1D = input.second->getTensorDesc().getLayout() == Layout::C;
-        auto is3D = input.second->getTensorDesc().getLayout() == Layout::CHW;
+            if (inputLayout == Layout::NCHW || inputLayout == Layout::CHW) {
+                // specific case that can be squeezed to 2d
+                inputLayout = Layout::NC;
+            }
 
-        if (inputs_ptr_->at(input.first).ptrs.empty()) {
-            // should not happen in user code however might happen if there any non executable network based integration of GNAPlugin instance
-            THROW_GNA_EXCEPTION << "network not loaded : input pointer for " << input.first << " not set";
-        }
+            auto is1D = input.second->getTensorDesc().getLayout() == Layout::C;
+            auto is3D = input.second->getTensorDesc().getLayout() == Layout::CHW;
 
-        if (inputs_ptr_->at(input.first).ptrs[idx] == nullptr) {
-            // should not happen in user code however might happen if there any non executable network based integration of GNAPlugin instance
-            THROW_GNA_EXCEPTION << "network not loaded : input pointer for (" << input.first << " at inferRequest #"
-                                << idx << " not set";
-        }
-        const auto inputOrientation = inputs_ptr_->at(input.first).orientation;
-        if (inputOrientation == kDnnUnknownOrientation) {
-            // should not happen in user code however might happen if there any non executable network based integration of GNAPlugin instance
-            THROW_GNA_EXCEPTION << "network not loaded : input orientation for " << input.first << " not set";
-        }
+            if (inputDesc.ptrs.empty()) {
+                // should not happen in user code however might happen if there any non executable network based integration of GNAPlugin instance
+                THROW_GNA_EXCEPTION << "network not loaded : input pointer for " << input.first << " not set";
+            }
 
-        for (auto& output : outputs_.Get()) {
-            if (output.orientation == kDnnUnknownOrientation) {
+            if (inputDesc.ptrs[idx] == nullptr) {
                 // should not happen in user code however might happen if there any non executable network based integration of GNAPlugin instance
-                THROW_GNA_EXCEPTION << "network not loaded : output orientation not set";
+                THROW_GNA_EXCEPTION << "network not loaded : input pointer for (" << input.first << " at inferRequest #"
+                                    << idx << " not set";
+            }
+            const auto inputOrientation = inputDesc.orientation;
+            if (inputOrientation == kDnnUnknownOrientation) {
+                // should not happen in user code however might happen if there any non executable network based integration of GNAPlugin instance
+                THROW_GNA_EXCEPTION << "network not loaded : input orientation for " << input.first << " not set";
             }
-        }
 
-        auto dims = input.second->getTensorDesc().getDims();
-        auto  importedElements = is1D ? dims[0] : details::product(++std::begin(dims), std::end(dims));
-        auto  importedFrames = (is3D || is1D) ? 1 : dims[0];
-        auto  targetGroups = is1D ? 1 : dims[0]; // TODO: no proper support for groups yet
+            auto dims = input.second->getTensorDesc().getDims();
+            auto  importedElements = is1D ? dims[0] : details::product(++std::begin(dims), std::end(dims));
+            auto  importedFrames = (is3D || is1D) ? 1 : dims[0];
+            auto  targetGroups = is1D ? 1 : dims[0]; // TODO: no proper support for groups yet
 
-        auto  importedElementSizeBytes = gnaFlags->sw_fp32 ? 4 : (gnaFlags->input_low_precision ? 1 : 2);
-        auto  importedBytes = importedElements * importedFrames * importedElementSizeBytes;
+            auto  importedElementSizeBytes = gnaFlags->sw_fp32 ? 4 : (gnaFlags->input_low_precision ? 1 : 2);
+            auto  importedBytes = importedElements * importedFrames * importedElementSizeBytes;
 
-        if (inputs_ptr_->at(input.first).get_required_size() < importedBytes) {
-            THROW_GNA_EXCEPTION << "Cannot import input frames for :" << input.first
-                                  << ", allocated size: " << inputs_ptr_->at(input.first).get_required_size()
-                                  << ", but input blob size: " << importedBytes;
-        }
+            if (inputDesc.get_required_size() < importedBytes) {
+                THROW_GNA_EXCEPTION << "Cannot import input frames for :" << input.first
+                                      << ", allocated size: " << inputDesc.get_required_size()
+                                      << ", but input blob size: " << importedBytes;
+            }
 
-        ImportFrames(inputs_ptr_->at(input.first).ptrs[idx],
-                     input.second->cbuffer().as<float *>(),
-                     input.second->getTensorDesc().getPrecision(),
-                     gnaFlags->sw_fp32 ? GNAPluginNS::kScaleFactorDefault : inputs_ptr_->at(input.first).scale_factor,
-                     inputOrientation,
-                     importedFrames,
-                     targetGroups,
-                     importedElements,
-                     importedElements);
-
-        auto transpose_info = transpose_inputs_info.find(input.first);
-        if (transpose_info != std::end(transpose_inputs_info)) {
-            size_t batchSize = (dims.size() > 1) ? dims[0] : 1;
-            size_t elementsPerBatch = (dims.size() > 1) ? InferenceEngine::details::product(dims) / dims[0] : dims[0];
-            size_t transposed_data_size = 0;
-            for (const auto &part_transposition_info : transpose_info->second) {
-                transposed_data_size += part_transposition_info.num_transpose_rows * part_transposition_info.num_transpose_columns;
+            ImportFrames(inputDesc.ptrs[idx],
+                         input.second->cbuffer().as<float *>(),
+                         input.second->getTensorDesc().getPrecision(),
+                         gnaFlags->sw_fp32 ? GNAPluginNS::kScaleFactorDefault : inputDesc.scale_factor,
+                         inputOrientation,
+                         importedFrames,
+                         targetGroups,
+                         importedElements,
+                         importedElements);
+
+            auto transpose_info = transpose_inputs_info.find(input.first);
+            if (transpose_info != std::end(transpose_inputs_info)) {
+                size_t batchSize = (dims.size() > 1) ? dims[0] : 1;
+                size_t elementsPerBatch = (dims.size() > 1) ? InferenceEngine::details::product(dims) / dims[0] : dims[0];
+                size_t transposed_data_size = 0;
+                for (const auto &part_transposition_info : transpose_info->second) {
+                    transposed_data_size += part_transposition_info.num_transpose_rows * part_transposition_info.num_transpose_columns;
+                }
+                if (elementsPerBatch != transposed_data_size) {
+                    THROW_GNA_EXCEPTION << "Transposed data size (" << transposed_data_size
+                                        << ") do not match input buffer length of " << elementsPerBatch;
+                }
+                auto input_ptr = reinterpret_cast<uint8_t *>(inputDesc.ptrs[idx]);
+                ConvertTensorFromNCHWToNHWC(gnadevice ? 2 : 4, batchSize, elementsPerBatch, input_ptr, true, transpose_info->second);
             }
-            if (elementsPerBatch != transposed_data_size) {
-                THROW_GNA_EXCEPTION << "Transposed data size (" << transposed_data_size
-                                    << ") do not match input buffer length of " << elementsPerBatch;
+            ++inputNum;
+        }
+        // If there is no gnadevice infer using reference FP32 transforamtions
+        int64_t requestId = 1;
+        if (!gnadevice || trivialTopology) {
+            std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> layersPerfCounters;
+            auto runtime = runtime::FP(dnn, gnaFlags->performance_counting ? &layersPerfCounters : nullptr);
+            runtime.infer();
+            if (gnaFlags->performance_counting) {
+                std::lock_guard<std::mutex> lockRequestConfigs{requestConfigsSync};
+                fpPerfCounters = std::move(layersPerfCounters);
             }
-            auto input_ptr = reinterpret_cast<uint8_t *>(inputs_ptr_->at(input.first).ptrs[idx]);
-            ConvertTensorFromNCHWToNHWC(gnadevice ? 2 : 4, batchSize, elementsPerBatch, input_ptr, true, transpose_info->second);
+        } else {
+            const auto reqConfigId = std::get<0>(*freeNnet);
+            if (ptr_active_indices != nullptr && num_active_indices > 0 && activeLayerIndex != 0xffffffff)
+                gnadevice->setUpActiveList(reqConfigId, activeLayerIndex, ptr_active_indices, num_active_indices);
+            requestId = gnadevice->propagate(reqConfigId, config.pluginGna2AccMode);
         }
-        ++inputNum;
-    }
-    // If there is no gnadevice infer using reference FP32 transforamtions
-    if (!gnadevice || trivialTopology) {
-        auto runtime = runtime::FP(dnn);
-        runtime.infer();
-        if (freeNnet != nnets.end()) {
-            std::get<1>(*freeNnet) = 1;
+        {
+            std::lock_guard<std::mutex> lockRequestConfigs{requestConfigsSync};
+            std::get<1>(*freeNnet) = requestId;
         }
-    } else {
-        const auto reqConfigId = std::get<0>(*freeNnet);
-        if (ptr_active_indices != nullptr && num_active_indices > 0 && activeLayerIndex != 0xffffffff)
-            gnadevice->setUpActiveList(reqConfigId, activeLayerIndex, ptr_active_indices, num_active_indices);
-        std::get<1>(*freeNnet) = gnadevice->propagate(reqConfigId, config.pluginGna2AccMode);
+    } catch (...) {
+        releaseRequestConfig(idx);
+        throw;
     }
 
 #ifdef PLOT
@@ -1284,6 +1347,11 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     return idx;
 }
 
+void GNAPlugin::releaseRequestConfig(uint32_t idx) {
+    std::lock_guard<std::mutex> lockRequestConfigs{requestConfigsSync};
+    std::get<1>(gnaRequestConfigToRequestIdMap[idx]) = -1;
+}
+
 bool GNAPlugin::Wait(uint32_t request_idx) {
     return GNA_REQUEST_COMPLETED == WaitFor(request_idx, MAX_TIMEOUT);
 }
@@ -1298,7 +1366,7 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
     if (gnadevice && !trivialTopology) {
         const auto waitStatus = gnadevice->wait(std::get<1>(nnets[request_idx]), millisTimeout);
         if (waitStatus == GNA_REQUEST_ABORTED) {
-            std::get<1>(nnets[request_idx]) = -1;
+            releaseRequestConfig(request_idx);
             return GNA_REQUEST_ABORTED;
         }
         if (waitStatus == GNA_REQUEST_PENDING) {
@@ -1306,7 +1374,14 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
         }
     }
 
-    std::get<1>(nnets[request_idx]) = -1;
+    // the request config is released after the outputs are exported, so the next request doesn't overwrite them
+    struct RequestConfigRelease {
+        GNAPlugin* plugin;
+        uint32_t idx;
+        ~RequestConfigRelease() {
+            plugin->releaseRequestConfig(idx);
+        }
+    } requestConfigRelease{this, request_idx};
     auto &request = std::get<2>(nnets[request_idx]);
 #ifdef PLOT
     if (dnn->num_components() != 0) {
@@ -1512,7 +1587,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::i
     graphCompiler.setGNAMemoryPtr(gnamem);
     void *basePtr = nullptr;
     gnamem->reserve_ptr(nullptr, &basePtr, header.gnaMemSize);
-    gnamem->commit();
+    // the memory is read from the blob, so it is not set to 0 before, it is the most of the import time for big models
+    gnamem->commitUninitialized();
     gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>(header.layersCount)));
     GNAModelSerial::MemoryType  mt;
     auto serial = GNAModelSerial(&std::get<0>(gnaModels.back())->obj, mt);
@@ -1525,6 +1601,9 @@ InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::i
             outputs_,
             transpose_inputs_info,
             transpose_outputs_info);
+    // the alignment of the memory which is not in the blob
+    std::fill(static_cast<uint8_t*>(basePtr) + header.gnaMemSize,
+              static_cast<uint8_t*>(gnamem->getBasePtr()) + gnamem->getTotalBytes(), 0);
 
     SetNetworkInputs();
     SetNetworkOutputs();
@@ -1609,7 +1688,13 @@ void GNAPlugin::Export(std::ostream &outStream) {
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GNAPlugin::GetPerformanceCounts() {
     if (gnaFlags->performance_counting) {
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
-        gnadevice->getGnaPerfCounters(perfMap);
+        if (gnadevice) {
+            // the library reports the counters of the whole request, there are no counters of the layers on the device
+            gnadevice->getGnaPerfCounters(perfMap);
+        } else {
+            std::lock_guard<std::mutex> lockRequestConfigs{requestConfigsSync};
+            perfMap = fpPerfCounters;
+        }
         return perfMap;
     } else {
         return {};
@@ -1674,8 +1759,64 @@ InferenceEngine::QueryNetworkResult GNAPlugin::QueryNetwork(const InferenceEngin
                                                             const std::map<std::string, std::string>& config) const {
     InferenceEngine::QueryNetworkResult res;
 
-    if (network.getFunction()) {
-        IE_THROW(NotImplemented) << " ngraph::Function is not supported natively";
+    if (auto function = network.getFunction()) {
+        // the layers are checked after the transformations of LoadNetwork, so HETERO runs the rest on the other device
+        std::string effectiveGnaCompileTarget = config.gnaCompileTarget;
+        if (gnadevice) {
+            effectiveGnaCompileTarget = gnadevice->getEffectiveGnaCompileTarget();
+        }
+        IE_SUPPRESS_DEPRECATED_START
+        InferenceEngine::CNNNetwork convertedNetwork{ConvertToLegacyNetwork(network, effectiveGnaCompileTarget)};
+        IE_SUPPRESS_DEPRECATED_END
+
+        std::unordered_set<std::string> originalOps;
+        for (auto&& node : function->get_ops()) {
+            originalOps.emplace(node->get_friendly_name());
+        }
+        std::unordered_set<std::string> supported;
+        std::unordered_set<std::string> unsupported;
+        for (auto&& layer : CNNNetSortTopologically(convertedNetwork)) {
+            const bool isSupported = LayerTypeFromStr(layer->type) != LayerType::NO_TYPE;
+            std::vector<std::string> originalNames;
+            auto names = layer->params.find(ExecGraphInfoSerialization::ORIGINAL_NAMES);
+            if (names != layer->params.end()) {
+                std::stringstream namesStream(names->second);
+                for (std::string name; std::getline(namesStream, name, ',');) {
+                    originalNames.push_back(name);
+                }
+            } else {
+                originalNames.push_back(layer->name);
+            }
+            for (auto&& name : originalNames) {
+                if (originalOps.count(name)) {
+                    (isSupported ? supported : unsupported).insert(name);
+                }
+            }
+        }
+        // the operation which is decomposed to the unsupported layer is not supported as a whole
+        for (auto&& name : unsupported) {
+            supported.erase(name);
+        }
+        for (auto&& node : function->get_ops()) {
+            if (supported.count(node->get_friendly_name())) {
+                for (auto&& input : node->input_values()) {
+                    if (ngraph::op::is_constant(input.get_node()) || ngraph::op::is_parameter(input.get_node())) {
+                        supported.insert(input.get_node()->get_friendly_name());
+                    }
+                }
+                for (auto&& output : node->outputs()) {
+                    for (auto&& target : output.get_target_inputs()) {
+                        if (ngraph::op::is_output(target.get_node())) {
+                            supported.insert(target.get_node()->get_friendly_name());
+                        }
+                    }
+                }
+            }
+        }
+        for (auto&& name : supported) {
+            res.supportedLayersMap.insert({ name, GetName() });
+        }
+        return res;
     }
 
     std::unordered_set<CNNLayer *> allLayers;
@@ -10,6 +10,7 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <tuple>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
@@ -45,6 +46,18 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     static constexpr uint32_t FAKE_REQUEST_CONFIG_ID = 0xffffffff;
     std::vector<std::tuple<dnn_ptr>> gnaModels;
     std::vector<std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>> gnaRequestConfigToRequestIdMap;
+    /**
+     * @brief - request id of the request config which is taken by an infer request but not yet propagated
+     */
+    static constexpr int64_t RESERVED_REQUEST_ID = -2;
+    /**
+     * @brief - guards the taking and the releasing of the request configs by the infer requests running in parallel
+     */
+    std::mutex requestConfigsSync;
+    /**
+     * @brief - the time of the layers of the last inference on the floating runtime, guarded by requestConfigsSync
+     */
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> fpPerfCounters;
 
     uint32_t activeLayerIndex = 0xffffffff;
     TranspositionInfoMap transpose_inputs_info;
@@ -56,6 +69,7 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     intel_dnn_number_type_t output_type = kDnnInt;
 
     void createRequestConfigsForGnaModels();
+    void releaseRequestConfig(uint32_t idx);
 
     static int GetDeviceVersionFromString(const std::string deviceString);
 
@@ -205,6 +219,11 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     void UpdateInputScaleFromNetwork(InferenceEngine::CNNNetwork& network);
     void UpdateInputsAndOutputsInfoFromNetwork(InferenceEngine::CNNNetwork &);
     void UpdateInputsAndOutputsInfoFromModel(const std::shared_ptr<ov::Model> &model);
+    /**
+     * @brief runs the ngraph transformations of the plugin on the copy of the network and converts it to the legacy one
+     */
+    std::shared_ptr<InferenceEngine::details::CNNNetworkImpl> ConvertToLegacyNetwork(const InferenceEngine::CNNNetwork &network,
+            const std::string &effectiveGnaCompileTarget) const;
     /**
      * @brief Tries to init an output on the base of a layer data
      * @param portId output port identificator
@@ -8,6 +8,8 @@
 #include "gna_plugin_config.hpp"
 #include "ie_common.h"
 #include <caseless.hpp>
+#include <set>
+#include <sstream>
 #include <unordered_map>
 
 using namespace InferenceEngine;
@@ -121,6 +123,17 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                                     << value;
             }
             gnaPrecision = precision;
+        } else if (key == GNA_CONFIG_KEY(PRECISION_I16_LAYERS)) {
+            std::set<std::string> layers;
+            std::stringstream layersStream(value);
+            for (std::string layer; std::getline(layersStream, layer, ',');) {
+                if (layer.empty()) {
+                    log << "Empty layer name in GNA_PRECISION_I16_LAYERS: " << value;
+                    THROW_GNA_EXCEPTION << "Empty layer name in GNA_PRECISION_I16_LAYERS: " << value;
+                }
+                layers.insert(layer);
+            }
+            i16PrecisionLayers = std::move(layers);
         } else if (key == GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN)) {
             if (value == PluginConfigParams::YES) {
                 gnaFlags.uniformPwlDesign = true;
@@ -246,6 +259,11 @@ void Config::AdjustKeyMapValues() {
     keyConfigMap[CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)] =
             gnaFlags.exclusive_async_requests ? PluginConfigParams::YES: PluginConfigParams::NO;
     keyConfigMap[GNA_CONFIG_KEY(PRECISION)] = gnaPrecision.name();
+    std::string i16Layers;
+    for (auto&& layer : i16PrecisionLayers) {
+        i16Layers += (i16Layers.empty() ? "" : ",") + layer;
+    }
+    keyConfigMap[GNA_CONFIG_KEY(PRECISION_I16_LAYERS)] = i16Layers;
     keyConfigMap[GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN)] =
             gnaFlags.uniformPwlDesign ? PluginConfigParams::YES: PluginConfigParams::NO;
     keyConfigMap[GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT)] = std::to_string(gnaFlags.pwlMaxErrorPercent);
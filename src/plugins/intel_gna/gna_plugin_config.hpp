@@ -11,6 +11,8 @@
 #include <vector>
 #include <map>
 #include <mutex>
+#include <set>
+#include <string>
 
 namespace GNAPluginNS {
 
@@ -29,6 +31,7 @@ struct Config {
     }
     void Copy(const Config& r) {
         gnaPrecision = r.gnaPrecision;
+        i16PrecisionLayers = r.i16PrecisionLayers;
         dumpXNNPath = r.dumpXNNPath;
         dumpXNNGeneration = r.dumpXNNGeneration;
         pluginGna2AccMode = r.pluginGna2AccMode;
@@ -45,6 +48,8 @@ struct Config {
 
     // default precision of GNA hardware model (see QuantI16 quantizer struct)
     InferenceEngine::Precision gnaPrecision = InferenceEngine::Precision::I16;
+    // the layers which keep the I16 weights in the I8 precision
+    std::set<std::string> i16PrecisionLayers;
 
     std::string dumpXNNPath;
     std::string dumpXNNGeneration;
@@ -31,6 +31,11 @@ struct is_const_pointer<const T *> : public std::true_type{
 };
 
 
+/**
+ * @brief the parameter of the layer which keeps the I16 weights in the I8 precision
+ */
+constexpr char kI16PrecisionParam[] = "gna_i16_precision";
+
 /**
  * similar to type traits determined in standard library this trait provides details per layer type, with some attributes specific for GNA
  * we don't need to have compile time performance for this yet
@@ -355,6 +360,14 @@ class LayerInfo {
         return isConcatAlignFilter() || isSyntheticScaleShift() || isConvolutionFilter() || isAffineFilter();
     }
 
+    /**
+     * @brief the layer keeps the I16 weights in the I8 precision, see GNA_CONFIG_KEY(PRECISION_I16_LAYERS)
+     */
+    bool isI16PrecisionForced() const noexcept {
+        IS_VALID();
+        return layer->params.count(kI16PrecisionParam) != 0;
+    }
+
     size_t paddingSize() const {
         static InferenceEngine::details::caseless_set<std::string> layersWithPossiblePadding = {"FullyConnected",
                                                                         "InnerProduct",
@@ -36,6 +36,7 @@ class GNAMemory : public GNAMemRequestsQueue {
     std::list<std::vector<char>> _local_storage;
     size_t _total = 0;
     size_t _rw_section_size = 0;
+    size_t _rw_section_size_not_compact = 0;
     size_t _ro_section_size = 0;
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap = nullptr;
@@ -82,21 +83,15 @@ class GNAMemory : public GNAMemRequestsQueue {
      * @brief calculates size required for all requests, allocates memory and updates pointers
      */
     void commit(bool isCompact = false) {
-        setCompactMode(isCompact);
-
-        // 1st stage -- looking for expandable bind requests:
-        expandBindings();
-
-        // 2nd stage -- setup offsets:
-        setRegionOffsets(REGION_RO);
-        setRegionOffsets(REGION_RW);
-
-        // 3rd stage -- allocation total memory setting to 0 internally
-        heap = allocate(getTotalBytes());
+        commit(isCompact, true);
+    }
 
-        // 4th stage -- store data and updates pointers
-        allocateRegion(REGION_RW, 0);
-        allocateRegion(REGION_RO, _rw_section_size);
+    /**
+     * @brief the same as commit() but the memory is not set to 0, for the case the caller overwrites all of it,
+     * e.g. the import of the model which reads the whole memory from the blob
+     */
+    void commitUninitialized() {
+        commit(false, false);
     }
 
     void *getBasePtr() {
@@ -113,6 +108,14 @@ class GNAMemory : public GNAMemRequestsQueue {
         return _total;
     }
 
+    /**
+     * @brief size of read/write region if the buffers were not reused, it is the same as getRWBytes() in non compact mode
+     */
+    size_t getRWBytesNotCompact() {
+        updateSectionsSizes();
+        return ALIGN(_rw_section_size_not_compact, _page_alignment);
+    }
+
  protected:
     rRegion regionType() const override {
         return REGION_RW;
@@ -138,11 +141,31 @@ class GNAMemory : public GNAMemRequestsQueue {
         }
     }
 
-    std::shared_ptr<uint8_t> allocate(size_t bytes) {
+    void commit(bool isCompact, bool zeroFill) {
+        setCompactMode(isCompact);
+
+        // 1st stage -- looking for expandable bind requests:
+        expandBindings();
+
+        // 2nd stage -- setup offsets:
+        setRegionOffsets(REGION_RO);
+        setRegionOffsets(REGION_RW);
+
+        // 3rd stage -- allocation total memory setting to 0 internally if requested
+        heap = allocate(getTotalBytes(), zeroFill);
+
+        // 4th stage -- store data and updates pointers
+        allocateRegion(REGION_RW, 0);
+        allocateRegion(REGION_RO, _rw_section_size);
+    }
+
+    std::shared_ptr<uint8_t> allocate(size_t bytes, bool zeroFill = true) {
         std::shared_ptr<uint8_t> sp(_allocator.allocate(bytes), [=](uint8_t *p) {
             _allocator.deallocate(p, bytes);
         });
-        std::fill(sp.get(), sp.get() + bytes, 0);
+        if (zeroFill) {
+            std::fill(sp.get(), sp.get() + bytes, 0);
+        }
         return sp;
     }
 
@@ -236,6 +259,10 @@ class GNAMemory : public GNAMemRequestsQueue {
         }
     }
 
+    static bool isWholeLife(const MemRequest & re) {
+        return re._life_limits.first == 0 && re._life_limits.second == UINT16_MAX;
+    }
+
     /**
      * @brief optimize memory region by reusing buffers
      */
@@ -246,11 +273,18 @@ class GNAMemory : public GNAMemRequestsQueue {
             case REGION_RW:
             case REGION_RO: {
                     std::vector<MemorySolver::Box> boxes;
+                    std::vector<size_t> wholeLifeRequests;
                     for (size_t i = 0; i < _future_heap.size(); ++i) {
                         // skipping BIND, cross-region and empty requests
                         if (_future_heap[i]._type & REQUEST_BIND || _future_heap[i]._region != regType || _future_heap[i]._ptr_out == nullptr) {
                             continue;
                         }
+                        // such requests (not bound to a layer) overlap with none, so they are placed after the others
+                        // in the requests order, e.g. the copies of the region for the parallel infer requests
+                        if (isWholeLife(_future_heap[i])) {
+                            wholeLifeRequests.push_back(i);
+                            continue;
+                        }
 
                         auto original_with_pad = ALIGN(_future_heap[i]._num_elements * _future_heap[i]._element_size + _future_heap[i]._padding,
                                                        _future_heap[i]._alignment);
@@ -259,12 +293,20 @@ class GNAMemory : public GNAMemRequestsQueue {
 
                         boxes.push_back({start, stop, static_cast<int64_t>(original_with_pad), static_cast<int64_t>(i)});
                     }
-                    MemorySolver memSolver(boxes);
-                    memSize = memSolver.solve();
+                    if (!boxes.empty()) {
+                        MemorySolver memSolver(boxes);
+                        memSize = memSolver.solve();
 
-                    // setting offsets
-                    for (auto const & box : boxes) {
-                        _future_heap[box.id]._offset = memSolver.getOffset(box.id);
+                        // setting offsets
+                        for (auto const & box : boxes) {
+                            _future_heap[box.id]._offset = memSolver.getOffset(box.id);
+                        }
+                    }
+                    for (auto i : wholeLifeRequests) {
+                        auto & re = _future_heap[i];
+                        memSize = ALIGN(memSize, re._alignment);
+                        re._offset = memSize;
+                        memSize += ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
                     }
                 }
                 break;
@@ -317,9 +359,12 @@ class GNAMemory : public GNAMemRequestsQueue {
                 _ro_section_size += current;
             }
         }
+        _rw_section_size_not_compact = _rw_section_size;
 
         if (_is_compact_mode) {
             _rw_section_size = getSectionSizeOptimized(REGION_RW);
+            gnalog() << "rw_section_size without buffers reuse: " << _rw_section_size_not_compact
+                     << ", saved by buffers reuse: " << _rw_section_size_not_compact - _rw_section_size << std::endl;
         }
 
         gnalog() << "ro_section_size: " << _ro_section_size << std::endl;
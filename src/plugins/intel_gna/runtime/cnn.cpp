@@ -13,8 +13,11 @@
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
 #include "layers/gna_convolution_layer.hpp"
+#include "gna_float_runtime_parallel.hpp"
 
 using namespace GNAPluginNS::GNAConvolutionLayer;
+using GNAPluginNS::runtime::DotProduct;
+using GNAPluginNS::runtime::ParallelFor;
 
 void CNNFilter32(intel_dnn_component_t *component) {
     auto filters = reinterpret_cast<float *>(component->op.conv1D.ptr_filters);
@@ -37,15 +40,15 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
+    // the output positions are computed in parallel
+    ParallelFor(numberOfOutputsPerFilter, numberOfFilters * filterSize, [&](size_t j) {
+        const auto in = input + j * convolutionStride;
+        const auto out = output + j * numberOfFilters;
         auto filter = filters;
         for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
-            }
+            out[i] = biases[i] + DotProduct(in, filter, filterSize);
         }
-    }
+    });
 }
 
 namespace {
@@ -212,21 +215,19 @@ float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsign
     const auto zPW = zeroPadding[1];
     float output = 0;
     for (unsigned kh = 0; kh < KH; kh++) {
+        if (matchesPaddedArea(kh, oh, IH, zPH, cSH)) {
+            continue;
+        }
         for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
+            if (matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
+                continue;
             }
+            const auto ih = (cSH * oh + kh) - zPH;
+            const auto iw = (cSW * ow + kw) - zPW;
+            // the channels of the image and of the filter are contiguous in HWC
+            const auto imageIndex = getQubeIndex(ih, iw, 0u, IW, IC);
+            const auto filterIndex = getQubeIndex(kh, kw, 0u, KW, KC);
+            output += DotProduct(image + imageIndex, filter + filterIndex, KC);
         }
     }
     output += bias;
@@ -263,21 +264,22 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelSize = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    // the rows of the output are computed in parallel
+    ParallelFor(OH, OW * OC * kh * kw * kc, [&](size_t row) {
+        const auto oh = static_cast<unsigned>(row);
         for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
+            for (unsigned oc = 0; oc < OC; oc++) {
                 const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
+                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + oc * kernelSize, kh, kw, kc,
                     ptr_inputs, IH, IW, IC,
                     oh, ow, oc,
                     component->op.conv2D.convStride,
                     component->op.conv2D.zeroPadding);
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 namespace {
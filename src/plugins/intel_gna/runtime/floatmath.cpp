@@ -1,13 +1,59 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines, the ones used by the floating runtime are threaded by the rows of the
+// output and written to be vectorized by the compiler
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 
 #include "floatmath.h"
+#include "gna_float_runtime_parallel.hpp"
+
+namespace {
+
+// C[l] = (beta == 1 ? C[l] : 0) + A[rows[l]] * B for the rows l of C, the summation order of the reference is kept
+void sgemm_rows(const MKL_INT N, const MKL_INT K, const float *A, const MKL_INT lda, const float *B, const MKL_INT ldb,
+                const float beta, float *C, const MKL_INT ldc, const uint32_t *rows, const MKL_INT L) {
+    using GNAPluginNS::runtime::ParallelFor;
+    ParallelFor(L, static_cast<size_t>(N) * K, [&](size_t l) {
+        const float *a = A + (rows ? rows[l] : l) * lda;
+        float *c = C + l * ldc;
+        if (beta != 1.0) {
+            std::fill(c, c + N, 0.0f);
+        }
+        // the columns of B and C are contiguous, the inner loop is vectorized over them
+        for (MKL_INT k = 0; k < K; k++) {
+            const float a_k = a[k];
+            const float *b = B + k * ldb;
+            for (MKL_INT j = 0; j < N; j++) {
+                c[j] += a_k * b[j];
+            }
+        }
+    });
+}
+
+// the same for a few columns, e.g. a single frame, the inner loop is vectorized over the rows of B instead
+void sgemm_rows_few_columns(const MKL_INT N, const MKL_INT K, const float *A, const MKL_INT lda, const float *B,
+                            const MKL_INT ldb, const float beta, float *C, const MKL_INT ldc, const uint32_t *rows,
+                            const MKL_INT L) {
+    using GNAPluginNS::runtime::ParallelFor;
+    using GNAPluginNS::runtime::DotProduct;
+    ParallelFor(L, static_cast<size_t>(N) * K, [&](size_t l) {
+        const float *a = A + (rows ? rows[l] : l) * lda;
+        float *c = C + l * ldc;
+        for (MKL_INT j = 0; j < N; j++) {
+            c[j] = ((beta == 1.0) ? c[j] : 0) + DotProduct(a, B + j, K, ldb);
+        }
+    });
+}
+
+// below this number of columns of C there are too few of them to vectorize the loop over them
+constexpr MKL_INT kMinVectorizedColumns = 8;
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,14 +73,10 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
+        if (N < kMinVectorizedColumns) {
+            sgemm_rows_few_columns(N, K, A, lda, B, ldb, beta, C, ldc, nullptr, M);
+        } else {
+            sgemm_rows(N, K, A, lda, B, ldb, beta, C, ldc, nullptr, M);
         }
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
@@ -105,15 +147,10 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
+        if (N < kMinVectorizedColumns) {
+            sgemm_rows_few_columns(N, K, A, lda, B, ldb, beta, C, ldc, OutputList, L);
+        } else {
+            sgemm_rows(N, K, A, lda, B, ldb, beta, C, ldc, OutputList, L);
         }
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
@@ -153,20 +190,14 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    using GNAPluginNS::runtime::ParallelFor;
+    using GNAPluginNS::runtime::DotProduct;
+    const uint32_t num_columns = K1 + K2;
+
+    ParallelFor(N, num_columns, [&](size_t i) {
+        const float *x = X + i * num_columns;
+        C[i] = B[i] + DotProduct(A1, x, K1) + DotProduct(A2, x + K1, K2);
+    });
 }
 
 #ifdef __cplusplus
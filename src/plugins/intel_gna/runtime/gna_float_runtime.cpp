@@ -3,7 +3,9 @@
 //
 
 #include <gna_plugin_log.hpp>
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <backend/dnn_types.h>
 #include "gna_float_runtime.hpp"
 
@@ -31,6 +33,7 @@ void FP::infer() {
                 num_active_outputs = dnn->num_active_outputs();            }
         }
 
+        const auto start = std::chrono::steady_clock::now();
         switch (comp->operation) {
             case kDnnAffineOp : {
                 ApplyAffineTransform(comp, ptr_active_outputs, num_active_outputs);
@@ -87,5 +90,16 @@ void FP::infer() {
             default:
                 THROW_GNA_EXCEPTION << "[GNA FP32 RUNTIME] Bad operation " << comp->operation;
         }
+        if (perfCounters != nullptr && comp->original_layer_name != nullptr) {
+            const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            auto& info = (*perfCounters)[comp->original_layer_name];
+            info.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+            info.realTime_uSec += time;
+            info.cpu_uSec += time;
+            info.execution_index = i;
+            std::snprintf(info.exec_type, sizeof(info.exec_type), "%s", intel_dnn_operation_name[comp->operation]);
+            std::snprintf(info.layer_type, sizeof(info.layer_type), "%s", intel_dnn_operation_name[comp->operation]);
+        }
     }
 }
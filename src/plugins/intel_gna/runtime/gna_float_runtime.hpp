@@ -3,7 +3,10 @@
 //
 
 #pragma once
+#include <map>
+#include <string>
 #include <backend/am_intel_dnn.hpp>
+#include <ie_common.h>
 
 namespace GNAPluginNS {
 namespace runtime {
@@ -12,9 +15,15 @@ namespace runtime {
  */
 class FP {
     std::shared_ptr<backend::AMIntelDNN> dnn;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>* perfCounters;
 
  public:
-    FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn) {
+    /**
+     * @param perfCounters - if not nullptr, the time of the primitives is added there by the names of their layers
+     */
+    FP(std::shared_ptr<backend::AMIntelDNN> dnn,
+       std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>* perfCounters = nullptr)
+        : dnn(dnn), perfCounters(perfCounters) {
     }
     virtual void infer();
 
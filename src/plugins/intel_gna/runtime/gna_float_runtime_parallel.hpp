@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <ie_parallel.hpp>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief the work (multiply-adds or activations) below which a primitive of the floating runtime runs in the calling
+ * thread, since the threads wake up longer than they compute then
+ */
+constexpr size_t kMinParallelWork = 16384;
+
+/**
+ * @brief calls func(i) for i in [0, count), in parallel if the work is large enough
+ * @param workPerItem - the multiply-adds of the item
+ */
+template <typename F>
+void ParallelFor(size_t count, size_t workPerItem, const F& func) {
+    if (count > 1 && count * workPerItem >= kMinParallelWork) {
+        InferenceEngine::parallel_for(count, func);
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            func(i);
+        }
+    }
+}
+
+/**
+ * @brief calls func(row, first_col, last_col) for the parts of the rows of [row_start, row_end] x [col_start, col_end],
+ * the elements are split between the threads evenly, so the work is split if there are a few rows, e.g. a single frame
+ */
+template <typename F>
+void ParallelForElements(uint32_t row_start, uint32_t row_end, uint32_t col_start, uint32_t col_end,
+                         size_t workPerElement, const F& func) {
+    if (row_end < row_start || col_end < col_start) {
+        return;
+    }
+    const size_t cols = col_end - col_start + 1;
+    const size_t total = (row_end - row_start + 1) * cols;
+    auto body = [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(total, nthr, ithr, start, end);
+        while (start < end) {
+            const auto row = row_start + static_cast<uint32_t>(start / cols);
+            const auto first = col_start + static_cast<uint32_t>(start % cols);
+            const auto last = static_cast<uint32_t>(std::min<size_t>(col_end, first + (end - start) - 1));
+            func(row, first, last);
+            start += last - first + 1;
+        }
+    };
+    if (total * workPerElement >= kMinParallelWork) {
+        InferenceEngine::parallel_nt(0, body);
+    } else {
+        body(0, 1);
+    }
+}
+
+/**
+ * @brief sum of a[i] * b[i * b_stride], the independent partial sums let the compiler vectorize the contiguous case
+ */
+inline float DotProduct(const float* a, const float* b, size_t n, size_t b_stride = 1) {
+    constexpr size_t kLanes = 8;
+    float partial[kLanes] = {};
+    size_t i = 0;
+    if (b_stride == 1) {
+        for (; i + kLanes <= n; i += kLanes) {
+            for (size_t l = 0; l < kLanes; l++) {
+                partial[l] += a[i + l] * b[i + l];
+            }
+        }
+    } else {
+        for (; i + kLanes <= n; i += kLanes) {
+            for (size_t l = 0; l < kLanes; l++) {
+                partial[l] += a[i + l] * b[(i + l) * b_stride];
+            }
+        }
+    }
+    float sum = 0.0f;
+    for (; i < n; i++) {
+        sum += a[i] * b[i * b_stride];
+    }
+    for (size_t l = 0; l < kLanes; l++) {
+        sum += partial[l];
+    }
+    return sum;
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
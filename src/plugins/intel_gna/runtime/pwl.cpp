@@ -9,6 +9,9 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 #ifdef _NO_MKL_
 #include <cmath>
@@ -25,6 +28,7 @@
 #endif
 
 #include "pwl.h"
+#include "gna_float_runtime_parallel.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
@@ -468,6 +472,52 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
 }
 
 
+namespace {
+
+/**
+ * @brief pwl_search memoized for the process: the models use a few activations with the same domains, and the search
+ * takes most of the time of the loading, the result does not depend on the scale factors of the layer
+ */
+std::vector<pwl_t> pwl_search_cached(const DnnActivation& activation_type,
+                                     const double l_bound,
+                                     const double u_bound,
+                                     const double threshold,
+                                     const double allowed_err_pct,
+                                     const int samples,
+                                     double& err_pct) {
+    using Key = std::tuple<int, float, float, float, double, double, double, double, int>;
+    static std::mutex cacheSync;
+    static std::map<Key, std::pair<std::vector<pwl_t>, double>> cache;
+    constexpr size_t kMaxCacheSize = 1024;
+
+    const bool isPow = activation_type == kActPow;
+    const Key key{static_cast<int>(activation_type.type),
+                  isPow ? activation_type.args.pow.exponent : 0.0f,
+                  isPow ? activation_type.args.pow.scale : 0.0f,
+                  isPow ? activation_type.args.pow.offset : 0.0f,
+                  l_bound, u_bound, threshold, allowed_err_pct, samples};
+    {
+        std::lock_guard<std::mutex> lock(cacheSync);
+        auto found = cache.find(key);
+        if (found != cache.end()) {
+            err_pct = found->second.second;
+            return found->second.first;
+        }
+    }
+
+    // the searches run unlocked, the concurrent ones of the same key give the same result
+    auto pwl = pwl_search(activation_type, l_bound, u_bound, threshold, allowed_err_pct, samples, err_pct);
+
+    std::lock_guard<std::mutex> lock(cacheSync);
+    if (cache.size() >= kMaxCacheSize) {
+        cache.clear();
+    }
+    cache.emplace(key, std::make_pair(pwl, err_pct));
+    return pwl;
+}
+
+}  // namespace
+
 void PwlDesignOpt(const DnnActivation& activation_type,
                     std::vector<gna_pwl_segment_t> &ptr_segment,
                     const float scale_in,
@@ -487,7 +537,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < SIGMOID_DOMAIN) ? -absMax : -SIGMOID_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < SIGMOID_DOMAIN) ? absMax : SIGMOID_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -495,7 +545,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < TANH_DOMAIN) ? -absMax : -TANH_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < TANH_DOMAIN) ? absMax : TANH_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -503,7 +553,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < SOFTSIGN_DOMAIN) ? -absMax : -SOFTSIGN_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < SOFTSIGN_DOMAIN) ? absMax : SOFTSIGN_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -524,28 +574,28 @@ void PwlDesignOpt(const DnnActivation& activation_type,
         case kActLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActNegLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActNegHalfLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActExp: {
             double x_min = -log(scale_out);
             double x_max = x_min + log(INT16_MAX);
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -571,7 +621,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
 
             if (activation_type.args.pow.exponent != 0.0f) {
                 auto maxError = pwlMaxErrorPercent > 0.015f ? 0.015f: pwlMaxErrorPercent;
-                pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, maxError, PWL_DESIGN_SAMPLES, err_pct);
+                pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, maxError, PWL_DESIGN_SAMPLES, err_pct);
             }
 
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
@@ -862,54 +912,63 @@ void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_end,
                 uint32_t num_col_start,
                 uint32_t num_col_end) {
+    using GNAPluginNS::runtime::ParallelForElements;
+    // the elements are split between the threads, the activation is counted as a few multiply-adds
+    constexpr size_t kPwlWork = 16;
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
                 }
-            }
+            });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
                 }
-            }
+            });
             break;
         case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] =
                         (ptr_in[i * num_columns + j] < 0.0f) ?
                             ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
                             ptr_in[i * num_columns + j];
                 }
-            }
+            });
             break;
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
                 }
-            }
+            });
             break;
         case kActKaldiLstmClipping: {
             float upper_limit = component->op.pwl.func_id.args.clamp.high;
             float lower_limit = component->op.pwl.func_id.args.clamp.low;
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     float val = ptr_in[i * num_columns + j];
                     if (val > upper_limit) {
                         ptr_out[i * num_columns + j] = upper_limit;
@@ -919,66 +978,74 @@ void PwlApply32(intel_dnn_component_t *component,
                         ptr_out[i * num_columns + j] = val;
                     }
                 }
-            }
+            });
             break;
         }
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
                 }
-            }
+            });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
+                for (uint32_t j = first; j <= last; j++) {
                     ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActPow: {
                 float exponent = transform->func_id.args.pow.exponent;
                 float scale = transform->func_id.args.pow.scale;
                 float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+                ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                    [&](uint32_t i, uint32_t first, uint32_t last) {
+                    for (uint32_t j = first; j <= last; j++) {
                         ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
                     }
-                }
+                });
             }
             break;
         case kActFakeQuantize: {
             double levels  = transform->func_id.fqParams.levels;
 
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            ParallelForElements(num_row_start, num_row_end, num_col_start, num_col_end, kPwlWork,
+                                [&](uint32_t i, uint32_t first, uint32_t last) {
                 auto inputChannel  = transform->func_id.fqParams.inputPerChannel ? i : 0;
                 auto outputChannel = transform->func_id.fqParams.outputPerChannel ? i : 0;
 
@@ -987,7 +1054,7 @@ void PwlApply32(intel_dnn_component_t *component,
                 double output_low  = transform->func_id.fqParams.output_low[outputChannel];
                 double output_high = transform->func_id.fqParams.output_high[outputChannel];
 
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+                for (uint32_t j = first; j <= last; j++) {
                     auto offset = i * num_columns + j;
                     auto x = ptr_in[offset];
 
@@ -1000,7 +1067,7 @@ void PwlApply32(intel_dnn_component_t *component,
                             (levels - 1) * (output_high - output_low) + output_low;
                     }
                 }
-            }
+            });
             break;
         }
         case kActCustom:
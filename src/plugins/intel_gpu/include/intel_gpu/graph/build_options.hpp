@@ -60,7 +60,10 @@ enum class build_option_type {
     serialize_network,
     load_program,
     force_implementations,
-    partial_build_program
+    partial_build_program,
+
+    /// @brief Number of the in-order queues the independent branches of the network are scheduled to (default: 1).
+    queues_num
 };
 
 /// @brief Tuning mode.
@@ -87,8 +90,10 @@ enum class tuning_mode {
 struct tuning_config_options {
     tuning_mode mode;
     std::string cache_file_path;
+    /// @brief Time budget in milliseconds of the on-line tuning of a single primitive (0 means no limit).
+    uint32_t time_limit_ms;
 
-    tuning_config_options() : mode(tuning_mode::tuning_disabled), cache_file_path("") {}
+    tuning_config_options() : mode(tuning_mode::tuning_disabled), cache_file_path(""), time_limit_ms(0) {}
 };
 
 /// @brief Learning parameters.
@@ -143,6 +148,10 @@ struct build_option {
     static std::shared_ptr<const build_option> force_implementations(implementation_forcing_map forcing);
 
     static std::shared_ptr<const build_option> partial_build_program(bool set = false);
+
+    /// @brief Specifies the number of the in-order queues the independent branches of the network are scheduled to.
+    /// @details The queues are synchronized at the joins of the branches only. Ignored for the out-of-order queues.
+    static std::shared_ptr<const build_option> queues_num(uint16_t queues = 1);
     virtual ~build_option() = default;
 
 private:
@@ -292,6 +301,23 @@ private:
     build_option_force_implementations& operator=(const build_option_force_implementations& other) = delete;
 };
 
+/// @brief @ref build_option specialization for the number of the queues.
+struct build_option_queues_num : build_option {
+    /// @brief The number of the in-order queues.
+    const uint16_t queues;
+
+    /// @brief Constructs option.
+    /// @param queues The number of the in-order queues.
+    explicit build_option_queues_num(uint16_t queues) : queues(queues) {}
+
+private:
+    /// @brief Returns build_option_type::queues_num.
+    build_option_type get_type() const override { return build_option_type::queues_num; }
+
+    build_option_queues_num(const build_option_queues_num& other) = delete;
+    build_option_queues_num& operator=(const build_option_queues_num& other) = delete;
+};
+
 namespace detail {
 /// @brief Helper template to convert @ref build_option_type value to particular @ref build_option class.
 template <build_option_type OptType>
@@ -370,6 +396,12 @@ struct build_option_traits<build_option_type::partial_build_program> {
     static std::shared_ptr<const build_option> make_default() { return build_option::partial_build_program(); }
 };
 
+template <>
+struct build_option_traits<build_option_type::queues_num> {
+    typedef build_option_queues_num object_type;
+    static std::shared_ptr<const build_option> make_default() { return build_option::queues_num(); }
+};
+
 #endif
 }  // namespace detail
 
@@ -423,6 +455,10 @@ inline std::shared_ptr<const build_option> build_option::partial_build_program(b
     return std::make_shared<build_option_bool<build_option_type::partial_build_program>>(enable);
 }
 
+inline std::shared_ptr<const build_option> build_option::queues_num(uint16_t queues) {
+    return std::make_shared<build_option_queues_num>(queues);
+}
+
 #endif
 
 /// @brief Represents program build options list.
@@ -39,6 +39,10 @@ struct network_output {
         return _result;
     }
 
+    /// @brief Returns @ref memory object of the output without the wait, the memory must be accessed by the commands
+    /// enqueued after the associated @ref event only.
+    memory::ptr get_memory_no_wait() const { return _result; }
+
 private:
     event::ptr _event;
     memory::ptr _result;
@@ -173,6 +177,12 @@ public:
     uint32_t get_id() const { return net_id; }
     stream& get_stream() const { return *_stream; }
     stream::ptr get_stream_ptr() const { return _stream; }
+    /// Makes all the streams of the network return the events of the next executed kernels (see stream::set_profiling_events)
+    void set_profiling_events(bool enable) {
+        _stream->set_profiling_events(enable);
+        for (auto& s : _branch_streams)
+            s->set_profiling_events(enable);
+    }
     bool is_internal() const { return _internal; }
     bool is_primary_stream() { return _is_primary_stream; }
 
@@ -192,7 +202,7 @@ private:
     uint32_t net_id = 0;
     program::ptr _program;
     stream::ptr _stream;
-    std::unique_ptr<memory_pool> _memory_pool;
+    std::shared_ptr<memory_pool> _memory_pool;
     bool _internal;
     bool _is_primary_stream;
     bool _reset_arguments;
@@ -206,10 +216,17 @@ private:
     std::unordered_map<primitive_id, event::ptr> _events;
     output_chains_map _output_chains;
 
+    // The independent branches are executed by the different in-order queues (the first one is _stream),
+    // the queues are synchronized at the joins of the branches only
+    std::vector<stream::ptr> _branch_streams;
+    std::unordered_map<primitive_id, size_t> _exec_queues;
+
     void build_exec_order();
     void allocate_primitive_instance(program_node const& node);
     void transfer_memory_to_device(std::shared_ptr<primitive_inst> instance, program_node const& node);
     void add_to_exec_order(const primitive_id& id);
+    void build_queues_schedule();
+    void switch_to_queue(const primitive_inst& inst);
     std::shared_ptr<primitive_inst> find_in_internal_networks(const primitive_id& id);
     std::shared_ptr<primitive_inst> find_primitive(const primitive_id& id);
     void check_names();
@@ -15,6 +15,9 @@
 #include <map>
 #include <utility>
 #include <set>
+#include <mutex>
+#include <functional>
+#include <unordered_map>
 
 namespace kernel_selector {
 class TuningCache;
@@ -233,6 +236,11 @@ public:
     void init_kernels();
     kernel_id add_kernel(const std::shared_ptr<kernel_string>& kernel_sring);
     kernel::ptr get_kernel(kernel_id id);
+    std::map<std::string, uint64_t> get_kernels_build_statistics() const;
+    kernels_cache& get_kernels_cache() const;
+    /// Returns the device copy of the constant @p id shared by all the networks (streams) of this program.
+    /// The copy is made by @p create for the first network requesting it.
+    memory::ptr get_device_constant(const primitive_id& id, const std::function<memory::ptr()>& create);
 
     void load_tuning_cache();
     std::shared_ptr<kernel_selector::TuningCache> get_tuning_cache() const { return tuning_cache; }
@@ -260,6 +268,9 @@ private:
     primitives_info prim_info;
     graph_optimizer_info optimizer_passes_info;
 
+    std::mutex _device_constants_mutex;
+    std::unordered_map<primitive_id, memory::ptr> _device_constants;
+
     primitives_info get_current_stage_info() const;
     /*
     ** High-level functions, in order of usage
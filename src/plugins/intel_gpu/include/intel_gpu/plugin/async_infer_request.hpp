@@ -29,6 +29,7 @@ public:
 private:
     InferRequest::Ptr _inferRequest;
     InferenceEngine::ITaskExecutor::Ptr _waitExecutor;
+    InferenceEngine::ITaskExecutor::Ptr _completionExecutor;
 };
 
 }  // namespace intel_gpu
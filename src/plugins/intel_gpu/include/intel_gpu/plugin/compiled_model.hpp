@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <atomic>
 #include "ie_blob.h"
 #include "cpp/ie_cnn_network.h"
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
@@ -25,8 +26,14 @@ class CompiledModel : public InferenceEngine::ExecutableNetworkThreadSafeDefault
 public:
     typedef std::shared_ptr<CompiledModel> Ptr;
 
-    CompiledModel(InferenceEngine::CNNNetwork &network, std::shared_ptr<InferenceEngine::RemoteContext> context, Config config);
+    // The graphs are built for the already compiled @p program if it is set (the @p network is only used for the name then).
+    // The graphs for the @p extra_contexts of the other devices are built from the @p network, the infer requests
+    // are distributed over all devices round-robin
+    CompiledModel(InferenceEngine::CNNNetwork &network, std::shared_ptr<InferenceEngine::RemoteContext> context, Config config,
+                  std::shared_ptr<Program> program = nullptr,
+                  const std::vector<InferenceEngine::gpu::ClContext::Ptr>& extra_contexts = {});
 
+    void Export(std::ostream& networkModel) override;
     std::shared_ptr<ngraph::Function> GetExecGraphInfo() override;
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -39,10 +46,25 @@ public:
     std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
 
     std::vector<std::shared_ptr<Graph>> m_graphs;
+    // the network as it was loaded, the export writes it and the import compiles it again
+    InferenceEngine::CNNNetwork m_network;
     InferenceEngine::gpu::ClContext::Ptr m_context;
     Config m_config;
     InferenceEngine::ITaskExecutor::Ptr m_taskExecutor;
     InferenceEngine::ITaskExecutor::Ptr m_waitExecutor;
+
+    // the stream graphs and the executor of every additional device of the multi-device model
+    struct DeviceGraphs {
+        InferenceEngine::gpu::ClContext::Ptr context;
+        std::vector<std::shared_ptr<Graph>> graphs;
+        InferenceEngine::ITaskExecutor::Ptr taskExecutor;
+    };
+    std::vector<DeviceGraphs> m_extraDevices;
+
+private:
+    // returns the device of the next infer request, 0 is the device of m_graphs and i > 0 is m_extraDevices[i - 1]
+    size_t NextRequestDevice();
+    std::atomic<size_t> m_requestsCounter{0};
 };
 
 }  // namespace intel_gpu
@@ -24,6 +24,11 @@ struct Config {
                                           dumpCustomKernels(false),
                                           exclusiveAsyncRequests(false),
                                           memory_pool_on(true),
+                                          memory_cache_capacity(0),
+                                          shared_activations(false),
+                                          shapes_cache_size(0),
+                                          profiling_sampling_rate(0),
+                                          queues_num(1),
                                           enableDynamicBatch(false),
                                           enableInt8(true),
                                           nv12_two_inputs(false),
@@ -60,6 +65,11 @@ struct Config {
     bool dumpCustomKernels;
     bool exclusiveAsyncRequests;
     bool memory_pool_on;
+    uint64_t memory_cache_capacity;
+    bool shared_activations;
+    size_t shapes_cache_size;
+    uint32_t profiling_sampling_rate;
+    uint16_t queues_num;
     bool enableDynamicBatch;
     bool enableInt8;
     bool nv12_two_inputs;
@@ -14,6 +14,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <mutex>
 #include "ie_blob.h"
 #include "cpp/ie_cnn_network.h"
 
@@ -41,16 +42,22 @@ public:
 
     Graph(InferenceEngine::CNNNetwork& network, InferenceEngine::gpu::ClContext::Ptr context, Config config, uint16_t stream_id = 0);
     explicit Graph(std::shared_ptr<Graph> graph, uint16_t stream_id = 0);
+    Graph(std::shared_ptr<Program> program, const std::string& name, InferenceEngine::gpu::ClContext::Ptr context, Config config,
+          uint16_t stream_id = 0);
     std::shared_ptr<ngraph::Function> GetExecGraphInfo();
 
     bool IsLoaded() const;
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const;
     void UpdatePerfStatistics();
+    // accumulates the timings of the @p executedPrimitives events collected by a sampled inference
+    // (see GPU_PROFILING_SAMPLING_RATE), it may be called concurrently with the execution of the next inferences
+    void UpdatePerfStatistics(std::map<cldnn::primitive_id, cldnn::event::ptr> executedPrimitives);
 
     const Config& getConfig() const { return m_config; }
     InferenceEngine::gpu::ClContext::Ptr GetContext() { return m_context; }
     std::shared_ptr<cldnn::engine> GetEngine() const { return getContextImpl(m_context)->GetEngine(); }
+    std::shared_ptr<Program> GetProgram() const { return m_program; }
     int GetMaxDynamicBatchSize() const { return getConfig().max_dynamic_batch; }
     const std::map<std::string, cldnn::layout>& GetInputLayouts() const { return m_program->GetInputLayouts(); }
     size_t GetNetworksCount() const { return m_networks.size(); }
@@ -89,6 +96,8 @@ protected:
     std::map<std::string, cldnn::primitive_id> primitiveIDs;
     std::map<std::string, std::vector<cldnn::primitive_id>> prevPrimitiveIDs;
 
+    // guards the perfMap updated by the sampled inferences
+    mutable std::mutex m_perf_mutex;
     std::map<cldnn::primitive_id, std::pair<std::string, PerfCounter>> perfMap;
     std::vector<cldnn::primitive_id> profilingIDs;
 
@@ -9,6 +9,7 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <set>
 #include "intel_gpu/plugin/graph.hpp"
 #include <threading/ie_istreams_executor.hpp>
 
@@ -33,11 +34,12 @@ public:
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
+    // the request runs on the stream graphs of the @p device of the multi-device model only (see CompiledModel)
     InferRequest(InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs,
-                 const std::shared_ptr<CompiledModel>& execNetwork);
+                 const std::shared_ptr<CompiledModel>& execNetwork, size_t device = 0);
     InferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                  const std::vector<std::shared_ptr<const ov::Node>>& outputs,
-                 const std::shared_ptr<CompiledModel>& execNetwork);
+                 const std::shared_ptr<CompiledModel>& execNetwork, size_t device = 0);
 
     InferRequest(const InferRequest &) = delete;
 
@@ -50,9 +52,13 @@ public:
     void SetBatch(int batch = -1) override;
     void SetGraph(std::shared_ptr<Graph> graph);
     void EnableProfiling() { m_useProfiling = true; }
+    // profiles every @p rate-th inference only, see GPU_PROFILING_SAMPLING_RATE
+    void EnableProfilingSampling(uint32_t rate) { m_profilingSamplingRate = rate; }
     void EnableStreams() { m_useStreams = true; }
 
     void setup_stream_graph();
+    size_t GetDevice() const { return m_device; }
+    const std::vector<std::shared_ptr<Graph>>& GetStreamGraphs() const { return *m_streamGraphs; }
     void preprocess_notify();
     void enqueue_notify();
     void wait_notify();
@@ -67,6 +73,10 @@ public:
 
     bool use_external_queue() const { return m_useExternalQueue; }
     void enable_external_queue() { m_useExternalQueue = true; }
+    bool use_profiling() const { return m_useProfiling; }
+
+    // returns the event of the completion of the last enqueued inference and its output copies
+    cldnn::event::ptr get_completion_event();
 
 private:
     InferenceEngine::BlobMap _deviceOutputs;
@@ -76,6 +86,10 @@ private:
     std::map<std::string, std::vector<InferenceEngine::Blob::Ptr>> inputTensorsMap;
 
     bool m_useProfiling = false;
+    uint32_t m_profilingSamplingRate = 0;
+    uint64_t m_inferCount = 0;
+    // the events of the last sampled inference, they are accumulated by the graph once the inference is completed
+    std::map<cldnn::primitive_id, cldnn::event::ptr> m_sampledEvents;
     bool m_useStreams = false;
     bool m_useExternalQueue = false;
     std::shared_ptr<Graph> m_graph;
@@ -84,10 +98,17 @@ private:
     std::map<std::string, std::vector<buf_info>> batchInputs;
     std::map<std::string, std::vector<buf_info>> batchOutputs;
     InferenceEngine::IStreamsExecutor* streamExecutor = nullptr;
+    size_t m_device = 0;
+    const std::vector<std::shared_ptr<Graph>>* m_streamGraphs = nullptr;
+
+    void bind_to_device(const std::shared_ptr<CompiledModel>& execNetwork, size_t device);
 
     void prepare_input(const cldnn::primitive_id &inputName, InferenceEngine::Blob::Ptr &inputBlob,
                        std::vector<cldnn::event::ptr>& dependencies);
+    void gather_input(const cldnn::primitive_id& inputName, const std::vector<InferenceEngine::Blob::Ptr>& blobs,
+                      std::vector<cldnn::event::ptr>& dependencies);
     void prepare_output(const cldnn::primitive_id& outputName, InferenceEngine::Blob::Ptr& outputBlob);
+    void enqueue_output_copies();
 
     InferenceEngine::Blob::Ptr create_host_blob(const InferenceEngine::TensorDesc& desc, uint8_t* mem_ptr = nullptr);
     InferenceEngine::Blob::Ptr create_device_blob(const InferenceEngine::TensorDesc& desc, const cldnn::layout& layout);
@@ -104,6 +125,9 @@ private:
     void allocate_outputs_dynamic();
 
     std::map<cldnn::primitive_id, cldnn::network_output> internal_outputs;
+    // the outputs read back by the non-blocking copies enqueued after the network
+    std::set<std::string> copied_outputs;
+    std::vector<cldnn::event::ptr> output_copy_events;
     std::vector<std::map<cldnn::primitive_id, cldnn::network_output>> internal_outputs_dynamic;
 };
 
@@ -0,0 +1,41 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <iostream>
+#include <functional>
+#include <string>
+#include "cpp/ie_cnn_network.h"
+#include "ie_blob.h"
+
+namespace ov {
+namespace runtime {
+namespace intel_gpu {
+
+// Writes the network compiled by the plugin with the precisions and layouts of its inputs and outputs,
+// the stream is read back by NetworkDeserializer on the import
+class NetworkSerializer {
+public:
+    explicit NetworkSerializer(std::ostream& ostream);
+    void operator<<(const InferenceEngine::CNNNetwork& network);
+
+private:
+    std::ostream& m_ostream;
+};
+
+class NetworkDeserializer {
+public:
+    using network_builder = std::function<InferenceEngine::CNNNetwork(const std::string&, const InferenceEngine::Blob::CPtr&)>;
+    NetworkDeserializer(std::istream& istream, network_builder builder);
+    void operator>>(InferenceEngine::CNNNetwork& network);
+
+private:
+    std::istream& m_istream;
+    network_builder m_builder;
+};
+
+}  // namespace intel_gpu
+}  // namespace runtime
+}  // namespace ov
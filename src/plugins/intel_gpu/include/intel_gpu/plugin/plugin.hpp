@@ -7,6 +7,8 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <list>
+#include <vector>
 #include "intel_gpu/runtime/engine.hpp"
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
@@ -17,6 +19,8 @@ namespace runtime {
 namespace intel_gpu {
 
 using CustomLayerPtr = std::shared_ptr<class CustomLayer>;
+class CompiledModel;
+class Program;
 
 class Plugin : public InferenceEngine::IInferencePlugin,
                public InferenceEngine::gpu::details::param_map_obj_getter {
@@ -33,6 +37,15 @@ class Plugin : public InferenceEngine::IInferencePlugin,
 
     mutable RemoteCLContext::Ptr m_defaultContext;
 
+    struct CachedProgram {
+        uint64_t hash;
+        InferenceEngine::gpu::ClContext::Ptr context;
+        std::shared_ptr<Program> program;
+    };
+    // compiled programs of the models loaded with distinct shapes, the most recently used first (see GPU_SHAPES_CACHE_SIZE)
+    mutable std::list<CachedProgram> programs_cache;
+    mutable std::mutex programs_cache_mutex;
+
     cldnn::device_info GetDeviceInfo(const std::map<std::string, std::string> &config) const;
     InferenceEngine::CNNNetwork CloneAndTransformNetwork(const InferenceEngine::CNNNetwork& network,
                                                          const Config& config) const;
@@ -43,6 +56,14 @@ class Plugin : public InferenceEngine::IInferencePlugin,
     void RegisterPrimitives();
     void UpdateConfig(Config& conf, const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &params) const;
     void UpdateStatistics(const RemoteCLContext::Ptr& context) const;
+    uint64_t ComputeProgramHash(const InferenceEngine::CNNNetwork& network, const Config& config) const;
+    std::shared_ptr<CompiledModel> CreateCompiledModel(const InferenceEngine::CNNNetwork& network,
+                                                       const InferenceEngine::gpu::ClContext::Ptr& context,
+                                                       const Config& config) const;
+    // compiles the model once for all the listed devices, the infer requests are distributed over the devices
+    InferenceEngine::IExecutableNetworkInternal::Ptr LoadMultiDeviceExeNetwork(const InferenceEngine::CNNNetwork &network,
+                                                                               const std::map<std::string, std::string> &config,
+                                                                               const std::vector<std::string>& device_ids);
 public:
     Plugin();
 
@@ -53,6 +74,9 @@ public:
                                                                         const std::shared_ptr<InferenceEngine::RemoteContext> &context,
                                                                         const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
+                                                                   const std::map<std::string, std::string>& config) override;
+
     void SetConfig(const std::map<std::string, std::string> &config) override;
     std::string GetDeviceIDFromConfig(const std::map<std::string, std::string>& config) const;
     InferenceEngine::Parameter GetConfig(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const override;
@@ -78,7 +102,7 @@ public:
         params.runtime_type = cldnn::runtime_types::ocl;
         if (external_queue) {
             params.queue_type = cldnn::stream::detect_queue_type(params.engine_type, external_queue);
-        } else if (dev->get_info().supports_immad) {
+        } else if (dev->get_info().supports_immad || config.queues_num > 1) {
             params.queue_type = cldnn::queue_types::in_order;
         } else {
             params.queue_type = cldnn::queue_types::out_of_order;
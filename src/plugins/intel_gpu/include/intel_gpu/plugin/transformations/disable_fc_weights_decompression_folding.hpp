@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace runtime {
+namespace intel_gpu {
+
+/**
+ * @brief Keeps the decompression of the int8 weights of the MatMul operations from the constant folding:
+ *
+ *   Constant(i8/u8)
+ *         |
+ *      Convert   Constant (zero point)
+ *          \      /
+ *          Subtract (optional)   Constant (scale)
+ *              \                  /
+ *                    Multiply
+ *                       |
+ *                  Reshape (optional)
+ *                       |
+ *                     MatMul
+ *
+ * The compressed weights, the scales and the zero points are passed to the fully_connected primitive as is,
+ * so the weights are read from the memory in int8 and decompressed by the kernel.
+ */
+class DisableFCWeightsDecompressionFolding : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("DisableFCWeightsDecompressionFolding", "0");
+    DisableFCWeightsDecompressionFolding();
+};
+
+}  // namespace intel_gpu
+}  // namespace runtime
+}  // namespace ov
@@ -77,13 +77,46 @@ struct fully_connected : public primitive_base<fully_connected> {
           input_size(input_size)
     {}
 
+    /// @brief Constructs fully connected layer with compressed weights.
+    /// @details The weights are decompressed by the kernel as (weights - decompression_zero_point) * decompression_scale.
+    /// @param id This primitive id.
+    /// @param input Input primitive id.
+    /// @param weights Primitive id containing int8 weights data.
+    /// @param bias Primitive id containing bias data. Provide empty string if using Relu without bias.
+    /// @param decompression_scale Primitive id containing the scales [OFM, groups] of the weights.
+    /// @param decompression_zero_point Primitive id containing the zero points of the weights, a scalar or
+    /// the shape of the scales. Provide empty string if the weights are symmetric.
+    fully_connected(const primitive_id& id,
+                    const primitive_id& input,
+                    const primitive_id& weights,
+                    const primitive_id& bias,
+                    const primitive_id& decompression_scale,
+                    const primitive_id& decompression_zero_point,
+                    const data_types data_type,
+                    const primitive_id& ext_prim_id = "",
+                    const padding& output_padding = padding(),
+                    const size_t input_size = 2)
+        : primitive_base(id, { input }, ext_prim_id, output_padding, optional_data_type{data_type}),
+          weights(weights),
+          bias(bias),
+          decompression_scale(decompression_scale),
+          decompression_zero_point(decompression_zero_point),
+          input_size(input_size)
+    {}
+
     /// @brief Primitive id containing weights data.
     primitive_id weights;
     /// @brief Primitive id containing bias data.
     primitive_id bias;
+    /// @brief Primitive id containing the scales of the compressed weights.
+    primitive_id decompression_scale;
+    /// @brief Primitive id containing the zero points of the compressed weights.
+    primitive_id decompression_zero_point;
     /// @brief Primitive dimension size.
     size_t input_size;
 
+    bool compressed_weights() const { return !decompression_scale.empty(); }
+
 protected:
     std::vector<std::reference_wrapper<const primitive_id>> get_dependencies() const override {
         std::vector<std::reference_wrapper<const primitive_id>> ret;
@@ -92,6 +125,12 @@ protected:
         if (!bias.empty())
             ret.push_back(bias);
 
+        if (!decompression_scale.empty())
+            ret.push_back(decompression_scale);
+
+        if (!decompression_zero_point.empty())
+            ret.push_back(decompression_zero_point);
+
         return ret;
     }
 };
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "primitive.hpp"
+#include <vector>
+
+namespace cldnn {
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Scaled dot product attention: softmax(scale * Q x K^T + mask) x V.
+/// @details The attention scores are computed and normalized on the fly, so they are not stored in the memory.
+/// @n The batch and the feature dimensions of the inputs stand for the batch and the heads, the y and x dimensions
+/// are the sequence length and the head size:
+/// @n - query [B, H, L, D]
+/// @n - key [B, H, S, D] ([B, H, D, S] if the key is already transposed)
+/// @n - value [B, H, S, Dv]
+/// @n - optional attention mask broadcastable to [B, H, L, S], it's added to the scores
+/// @n - output [B, H, L, Dv]
+struct scaled_dot_product_attention : public primitive_base<scaled_dot_product_attention> {
+    CLDNN_DECLARE_PRIMITIVE(scaled_dot_product_attention)
+
+    /// @brief Constructs scaled_dot_product_attention primitive.
+    /// @param id This primitive id.
+    /// @param inputs Query, key, value and the optional attention mask primitive ids.
+    /// @param scale The factor the scores are multiplied by (usually 1 / sqrt(D)).
+    /// @param transpose_key False if the key is already transposed ([B, H, D, S]).
+    /// @param is_causal Masks the scores of the keys which follow the query (the last L keys are aligned with the queries).
+    /// @param f16_accumulation Accumulates the scores and the output in f16 for the f16 inputs instead of f32.
+    scaled_dot_product_attention(const primitive_id& id,
+                                 const std::vector<primitive_id>& inputs,
+                                 const float scale,
+                                 const bool transpose_key = true,
+                                 const bool is_causal = false,
+                                 const bool f16_accumulation = false,
+                                 const primitive_id& ext_prim_id = "",
+                                 const padding& output_padding = padding())
+        : primitive_base(id, inputs, ext_prim_id, output_padding),
+          scale(scale),
+          transpose_key(transpose_key),
+          is_causal(is_causal),
+          f16_accumulation(f16_accumulation) {
+        if (inputs.size() != 3 && inputs.size() != 4) {
+            throw std::invalid_argument("Invalid inputs count - scaled_dot_product_attention expects either three or four inputs");
+        }
+    }
+
+    /// @brief The factor the scores are multiplied by.
+    float scale;
+    /// @brief False if the key is already transposed.
+    bool transpose_key;
+    /// @brief Masks the scores of the keys which follow the query.
+    bool is_causal;
+    /// @brief Accumulates in f16 for the f16 inputs.
+    bool f16_accumulation;
+};
+/// @}
+/// @}
+/// @}
+}  // namespace cldnn
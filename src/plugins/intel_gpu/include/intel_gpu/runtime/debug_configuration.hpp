@@ -38,6 +38,7 @@ public:
     int dump_layers_dst_only;       // Dump only output of layers
     int dump_layers_limit_batch;    // Limit the size of batch to dump
     int base_batch_for_memory_estimation; // Base batch size to be used in memory estimation
+    int max_kernels_per_batch;      // Maximum number of kernels in a batch compiled as one program
     static const debug_configuration *get_instance();
     bool is_dumped_layer(const std::string& layerName) const;
 };
@@ -65,6 +65,11 @@ public:
     /// Create shared memory object using user-supplied USM pointer @p usm_ptr using specified @p layout
     memory_ptr share_usm(const layout& layout, shared_handle usm_ptr);
 
+    /// Create shared memory object over user-supplied host memory @p ptr using specified @p layout.
+    /// The memory is accessed by the device directly (without copy on the integrated devices),
+    /// so it must be kept alive while the memory object is used
+    memory_ptr share_host_ptr(const layout& layout, shared_handle ptr);
+
     /// Create shared memory object using user-supplied 2D image @p img using specified @p layout
     memory_ptr share_image(const layout& layout, shared_handle img);
 
@@ -113,6 +118,16 @@ public:
     /// @note It contains information about current memory usage
     std::map<std::string, uint64_t> get_memory_statistics() const;
 
+    /// Returns the cache of the memory buffers shared by the memory pools of all the networks of the engine
+    memory_cache& get_memory_cache() { return *_memory_cache; }
+
+    /// Enables the memory pool shared by the networks of the engine, so their intermediate buffers are reused across
+    /// the networks. It's valid only when the networks created after that are never executed concurrently
+    void set_shared_memory_pool(bool enabled);
+
+    /// Returns the memory pool shared by the networks of the engine or nullptr when it's disabled
+    std::shared_ptr<memory_pool> get_shared_memory_pool() const;
+
     /// Adds @p bytes count to currently used memory size of the specified allocation @p type
     void add_memory_used(uint64_t bytes, allocation_type type);
 
@@ -125,6 +140,10 @@ public:
     /// Create stream object for current engine
     virtual stream_ptr create_stream() const = 0;
 
+    /// Create stream object for current engine bound to the hardware queue @p queue_index of the device queue family,
+    /// so the streams with different indices are executed by different compute engines (when the device has several)
+    virtual stream_ptr create_stream_on_queue(uint16_t queue_index) const = 0;
+
     /// Creates stream object from user handle
     virtual stream_ptr create_stream(void *handle) const = 0;
 
@@ -175,6 +194,21 @@ protected:
 
     std::map<allocation_type, std::atomic<uint64_t>> _memory_usage_map;
     std::map<allocation_type, std::atomic<uint64_t>> _peak_memory_usage_map;
+    // the derived engines clear it on destruction, while the memory allocation helpers are alive
+    std::unique_ptr<memory_cache> _memory_cache;
+    std::shared_ptr<memory_pool> _shared_memory_pool;
+};
+
+/// @brief While any scope exists, the kernels caches of the engines share the compiled batch binaries in memory
+/// for the devices with the same name and driver, so the program built for several identical devices
+/// (e.g. the tiles of the multi-device model) is compiled once and only loaded on the others.
+/// The shared binaries are dropped with the last scope.
+class kernels_binaries_sharing_scope {
+public:
+    kernels_binaries_sharing_scope();
+    ~kernels_binaries_sharing_scope();
+    kernels_binaries_sharing_scope(const kernels_binaries_sharing_scope&) = delete;
+    kernels_binaries_sharing_scope& operator=(const kernels_binaries_sharing_scope&) = delete;
 };
 
 }  // namespace cldnn
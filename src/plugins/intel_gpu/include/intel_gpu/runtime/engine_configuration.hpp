@@ -70,6 +70,8 @@ struct engine_configuration {
     uint16_t throughput_streams;              ///< Number of queues/streams executed in parallel by GPU plugin
 
     const std::string tuning_cache_path;      ///< Path to tuning kernel cache
+    const bool enable_sampled_profiling;      ///< The queues record the timestamps, but the streams return the kernel events
+                                              ///< only while stream::set_profiling_events is on (the usual sync otherwise).
 
     /// @brief Constructs engine configuration with specified options.
     /// @param enable_profiling Enable per-primitive profiling.
@@ -83,6 +85,7 @@ struct engine_configuration {
     /// @param n_threads Max number of host threads used in gpu plugin
     /// @param throughput_streams Number of queues/streams executed in parallel by GPU plugin
     /// @param tuning_cache_path Path to tuning kernel cache
+    /// @param enable_sampled_profiling Enables the profiling of the queues for the sampled inferences only
     engine_configuration(
         bool enable_profiling = false,
         queue_types queue_type = queue_types::out_of_order,
@@ -93,7 +96,8 @@ struct engine_configuration {
         bool use_unified_shared_memory = true,
         const std::string& kernels_cache_path = "",
         uint16_t throughput_streams = 1,
-        const std::string& tuning_cache_path = "cache.json")
+        const std::string& tuning_cache_path = "cache.json",
+        bool enable_sampled_profiling = false)
         : enable_profiling(enable_profiling)
         , queue_type(queue_type)
         , sources_dumps_dir(sources_dumps_dir)
@@ -103,7 +107,8 @@ struct engine_configuration {
         , use_unified_shared_memory(use_unified_shared_memory)
         , kernels_cache_path(kernels_cache_path)
         , throughput_streams(throughput_streams)
-        , tuning_cache_path(tuning_cache_path) { }
+        , tuning_cache_path(tuning_cache_path)
+        , enable_sampled_profiling(enable_sampled_profiling) { }
 };
 
 /// @}
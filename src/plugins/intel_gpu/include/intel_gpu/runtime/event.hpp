@@ -6,6 +6,8 @@
 
 #include "profiling.hpp"
 
+#include <atomic>
+#include <exception>
 #include <list>
 #include <mutex>
 #include <utility>
@@ -25,9 +27,13 @@ public:
 
     void wait();
     void set();
+    // sets the event as failed by the exception of the work it tracks, e.g. by a host task of the cpu impls, so the
+    // dependent commands aren't executed and the wait of the event rethrows the exception
+    void set_exception(std::exception_ptr exception);
     bool is_set();
     virtual void reset() {
         _set = false;
+        _exception = nullptr;
         _profiling_captured = false;
         _profiling_info.clear();
     }
@@ -45,11 +51,14 @@ private:
     std::list<instrumentation::profiling_interval> _profiling_info;
 
 protected:
-    bool _set = false;
+    // set by the host tasks of the cpu impls from the task executor
+    std::atomic<bool> _set{false};
+    std::exception_ptr _exception;
     void call_handlers();
 
     virtual void wait_impl() = 0;
     virtual void set_impl() = 0;
+    virtual void set_exception_impl() { set_impl(); }
     virtual bool is_set_impl() = 0;
     virtual bool add_event_handler_impl(event_handler, void*) { return true; }
 
@@ -66,6 +66,13 @@ struct memory {
 
     virtual event::ptr copy_from(stream& /* stream */, const memory& /* other */) = 0;
     virtual event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */) = 0;
+    /// @brief Enqueues the copy of @p size bytes from the beginning of @p other (@p host_ptr) to @p dst_offset of this memory,
+    /// the source must stay valid until the returned event is completed
+    virtual event::ptr copy_from(stream& /* stream */, const memory& /* other */, size_t /* dst_offset */, size_t /* size */) = 0;
+    virtual event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */, size_t /* dst_offset */, size_t /* size */) = 0;
+    /// @brief Enqueues the copy of the whole memory to @p host_ptr, with @p blocking = false the destination must stay valid
+    /// and must not be read until the returned event is completed
+    virtual event::ptr copy_to(stream& /* stream */, void* /* host_ptr */, bool /* blocking */ = true) = 0;
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
     virtual dnnl::memory get_onednn_memory(dnnl::memory::desc /* desc */) {
@@ -103,6 +110,13 @@ struct simple_attached_memory : memory {
 
     event::ptr copy_from(stream& /* stream */, const memory& /* other */) override { return nullptr; };
     event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */) override { return nullptr; }
+    event::ptr copy_from(stream& /* stream */, const memory& /* other */, size_t /* dst_offset */, size_t /* size */) override {
+        return nullptr;
+    }
+    event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */, size_t /* dst_offset */, size_t /* size */) override {
+        return nullptr;
+    }
+    event::ptr copy_to(stream& /* stream */, void* /* host_ptr */, bool /* blocking */) override { return nullptr; }
 
 private:
     void* _pointer;
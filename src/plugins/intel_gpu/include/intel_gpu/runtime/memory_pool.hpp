@@ -13,6 +13,8 @@
 #include <list>
 #include <string>
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace cldnn {
 
@@ -52,7 +54,47 @@ struct memory_record {
     memory_ptr _memory;
     uint32_t _network_id;
     allocation_type _type;
-    memory_record(memory_set users, memory_ptr& memory, uint32_t net_id, allocation_type type);
+    bool _from_cache;   // the memory is a size class buffer of the engine memory_cache
+    uint64_t _requested_bytes = 0;  // the size requested by the first user of the memory_cache buffer
+    memory_record(memory_set users, memory_ptr& memory, uint32_t net_id, allocation_type type, bool from_cache = false);
+};
+
+// memory_cache class keeps the buffers released by the memory pools of all the networks of an engine, so the networks
+// created later (e.g. for the new input shapes) reuse them instead of the new driver allocations.
+// The buffers are allocated by size classes (4 classes per power of two), thus a buffer fits the requests with
+// slightly different sizes. The cache is disabled until its capacity (maximum bytes of the cached buffers) is set.
+class memory_cache {
+public:
+    explicit memory_cache(engine& engine);
+
+    void set_capacity(uint64_t capacity);
+    bool is_enabled() const;
+    static uint64_t get_size_class(uint64_t bytes);
+
+    // returns the cached buffer of the requested size class or allocates the new one
+    memory_ptr get_memory(uint64_t bytes, allocation_type type);
+    // keeps the buffer for the reuse while the capacity allows, or frees it
+    void release_memory(const memory_ptr& buffer, uint64_t requested_bytes);
+    void clear();
+
+    // "ALLOCATIONS", "REUSES", "EVICTIONS" counters, "USED_BYTES", "REQUESTED_BYTES", "PEAK_USED_BYTES", "CACHED_BYTES"
+    // and "PEAK_CACHED_BYTES" sizes, and "FRAGMENTATION_PERCENT" - the part of the used size classes bytes not requested
+    // by the users
+    std::map<std::string, uint64_t> get_statistics() const;
+
+private:
+    engine* _engine;
+    mutable std::mutex _mutex;
+    uint64_t _capacity = 0;
+    std::multimap<std::pair<allocation_type, uint64_t>, memory_ptr> _buffers;
+    uint64_t _allocations = 0;
+    uint64_t _reuses = 0;
+    uint64_t _evictions = 0;
+    uint64_t _used_bytes = 0;
+    uint64_t _requested_bytes = 0;
+    uint64_t _peak_used_bytes = 0;
+    uint64_t _cached_bytes = 0;
+    uint64_t _peak_cached_bytes = 0;
 };
 
 struct padded_pool_comparer {
@@ -82,6 +124,8 @@ struct padded_pool_comparer {
 // - images 2d - not implemented yet
 // - images 2d arrays - not implemented yet
 // - immutable - if user request for non reusable resource don't use pool, return
+// The pool shared across networks (see engine::set_shared_memory_pool) reuses the buffers of the other networks too,
+// the conflicts are checked for the users of the same network only, as the networks are executed sequentially.
 
 // TODO list:
 // - Move from runtime to graph part
@@ -91,15 +135,23 @@ class memory_pool {
     memory_pool();
 
     memory_ptr alloc_memory(const layout& layout, allocation_type type);
+    void free_record(memory_record& record);
     static bool has_conflict(const memory_set&, const std::set<primitive_id>&, uint32_t network_id);
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout, std::list<memory_record>, padded_pool_comparer> _padded_pool;
     std::multimap<uint64_t, memory_record> _no_reusable_pool;
     engine* _engine;
+    bool _shared_across_networks;
+    std::mutex _mutex;
+
+    bool is_available_for(const memory_record& record, uint32_t network_id) const {
+        return _shared_across_networks || record._network_id == network_id;
+    }
+    void release_network_users(memory_record& record, uint32_t network_id);
 
 public:
-    explicit memory_pool(engine& engine);
+    explicit memory_pool(engine& engine, bool shared_across_networks = false);
     ~memory_pool();
     memory_ptr get_memory(const layout& layout,
                           const primitive_id& id,
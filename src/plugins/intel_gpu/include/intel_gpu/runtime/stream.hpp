@@ -34,6 +34,8 @@ public:
                                       bool is_output_event = false) = 0;
     virtual event::ptr enqueue_marker(std::vector<event::ptr> const& deps, bool is_output_event = false) = 0;
     virtual void enqueue_barrier() = 0;
+    /// @brief The next commands of the stream wait for the @p deps (of the other streams) to be completed, the host isn't blocked
+    virtual void enqueue_barrier(std::vector<event::ptr> const& deps) = 0;
     virtual event::ptr group_events(std::vector<event::ptr> const& deps) = 0;
     virtual void wait_for_events(const std::vector<event::ptr>& events) = 0;
     virtual event::ptr create_user_event(bool set) = 0;
@@ -41,6 +43,11 @@ public:
 
     queue_types get_queue_type() const { return queue_type; }
 
+    /// @brief While it's on, every enqueued kernel returns its event, so the sampled inference can be profiled
+    /// (engine_configuration::enable_sampled_profiling), the other inferences skip the events they don't need
+    void set_profiling_events(bool enable) { profiling_events = enable; }
+    bool get_profiling_events() const { return profiling_events; }
+
     static queue_types detect_queue_type(engine_types engine_type, void* queue_handle);
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
@@ -49,6 +56,7 @@ public:
 
 protected:
     queue_types queue_type;
+    bool profiling_events = false;
 };
 
 }  // namespace cldnn
@@ -121,6 +121,10 @@ std::string fully_connected_inst::to_string(fully_connected_node const& node) {
     json_composite fc_info;
     fc_info.add("weights id", weights_id);
     fc_info.add("bias id", bias_id);
+    if (desc->compressed_weights()) {
+        fc_info.add("decompression scale id", desc->decompression_scale);
+        fc_info.add("decompression zp id", desc->decompression_zero_point != "" ? desc->decompression_zero_point : "no zp");
+    }
 
     node_info->add("fully connected info", fc_info);
     node_info->dump(primitive_description);
@@ -35,7 +35,9 @@ bool can_shuffle_features(program_node& node, stream& stream) {
         auto& fc_node = node.as<fully_connected>();
         auto& wei_node = fc_node.weights();
 
-        return wei_node.is_type<data>() && wei_node.is_constant() && !wei_node.is_output();
+        // the decompression groups of the compressed weights follow the input features
+        return !fc_node.compressed_weights() &&
+            wei_node.is_type<data>() && wei_node.is_constant() && !wei_node.is_output();
     }
 
     bool pass_through = false;
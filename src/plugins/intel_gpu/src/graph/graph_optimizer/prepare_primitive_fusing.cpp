@@ -43,6 +43,7 @@
 #include "embedding_bag_inst.h"
 #include "extract_image_patches_inst.h"
 #include "reduce_inst.h"
+#include "scaled_dot_product_attention_inst.h"
 #include <vector>
 #include <map>
 #include <list>
@@ -56,6 +57,7 @@ void prepare_primitive_fusing::run(program& p) {
     fuse_reorders(p);
     remove_redundant_reshape(p);
     fuse_sigmoid_mul_to_swish(p);
+    fuse_attention(p);
     fuse_bias(p);
     fuse_simple_primitives(p);
     fuse_activations(p);
@@ -146,6 +148,97 @@ void prepare_primitive_fusing::fuse_sigmoid_mul_to_swish(program &p) {
     }
 }
 
+void prepare_primitive_fusing::fuse_attention(program &p) {
+    // gemm(Q, K) -> [eltwise sum with the mask] -> softmax -> gemm(*, V) is replaced by scaled_dot_product_attention
+    auto is_intermediate = [](const program_node& node) {
+        return !node.is_output() && node.get_users().size() == 1 && node.get_fused_primitives().empty();
+    };
+
+    auto itr = p.get_processing_order().begin();
+    while (itr != p.get_processing_order().end()) {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        program_helpers::do_for_types<gemm>(*node, [&p, &is_intermediate](gemm_node& node) {
+            auto& gemm1 = node;
+            auto gemm1_prim = gemm1.get_primitive();
+            if (gemm1.is_output() || gemm1.get_dependencies().size() != 2 || gemm1_prim->transpose_input0 || gemm1_prim->transpose_input1 ||
+                gemm1_prim->alpha != 1.0f || !gemm1.get_fused_primitives().empty())
+                return;
+
+            auto& scores_norm = gemm1.get_dependency(0);
+            if (!scores_norm.is_type<softmax>() || !is_intermediate(scores_norm) ||
+                scores_norm.as<softmax>().get_primitive()->dimension != softmax::normalize_x)
+                return;
+
+            program_node* mask = nullptr;
+            program_node* mask_add = nullptr;
+            auto* scores = &scores_norm.get_dependency(0);
+            if (scores->is_type<eltwise>()) {
+                auto& add = scores->as<eltwise>();
+                if (!is_intermediate(add) || add.get_dependencies().size() != 2 || add.get_primitive()->mode != eltwise_mode::sum ||
+                    !add.get_primitive()->coefficients.empty())
+                    return;
+                size_t mask_idx = add.get_dependency(0).is_type<gemm>() ? 1 : 0;
+                mask_add = &add;
+                mask = &add.get_dependency(mask_idx);
+                scores = &add.get_dependency(1 - mask_idx);
+            }
+
+            if (!scores->is_type<gemm>() || !is_intermediate(*scores))
+                return;
+            auto& gemm0 = scores->as<gemm>();
+            auto gemm0_prim = gemm0.get_primitive();
+            if (gemm0.get_dependencies().size() != 2 || gemm0_prim->transpose_input0)
+                return;
+
+            auto& query = gemm0.get_dependency(0);
+            auto& key = gemm0.get_dependency(1);
+            auto& value = gemm1.get_dependency(1);
+
+            std::vector<program_node*> inputs = { &query, &key, &value };
+            if (mask)
+                inputs.push_back(mask);
+            for (auto input : inputs) {
+                auto in_layout = input->get_output_layout();
+                if (in_layout.format != format::bfyx || in_layout.data_type != query.get_output_layout().data_type)
+                    return;
+            }
+
+            // the mask is broadcasted along batch, heads and queries only
+            auto scores_layout = gemm0.get_output_layout();
+            if (mask && mask->get_output_layout().size.spatial[0] != scores_layout.size.spatial[0])
+                return;
+
+            std::vector<primitive_id> input_ids;
+            for (auto input : inputs)
+                input_ids.push_back(input->id());
+
+            auto attention_prim = std::make_shared<scaled_dot_product_attention>(gemm1.id() + "_attention", input_ids, gemm0_prim->alpha,
+                                                                                 gemm0_prim->transpose_input1);
+            auto& attention = p.get_or_create(attention_prim);
+
+            std::vector<program_node*> removed = { &gemm1, &scores_norm, &gemm0 };
+            if (mask_add)
+                removed.push_back(mask_add);
+            for (auto removed_node : removed)
+                p.add_optimized_primitive_info(removed_node->id(), {attention.id()});
+
+            for (auto input : inputs)
+                p.add_connection(*input, attention);
+            p.get_processing_order().insert(&gemm1, &attention);
+            p.replace_all_usages(gemm1, attention);
+
+            for (auto removed_node : removed)
+                p.remove_all_connections(*removed_node);
+            for (auto removed_node : removed)
+                p.remove_if_dangling(*removed_node);
+
+            attention.calc_output_layout();
+        });
+    }
+}
+
 void prepare_primitive_fusing::fuse_reorders(program &p) {
     // This loop tries fusing several reorders one by one (if present) into one reorder
     auto itr = p.get_processing_order().begin();
@@ -448,6 +541,8 @@ void prepare_primitive_fusing::fuse_bias(program &p) {
                                                                        desc->weights,
                                                                        bias_name,
                                                                        fc.get_output_layout().data_type);
+            fc_with_bias_prim->decompression_scale = desc->decompression_scale;
+            fc_with_bias_prim->decompression_zero_point = desc->decompression_zero_point;
 
             auto& new_fc_node = p.get_or_create(fc_with_bias_prim);
             fuse_bias_f(fc, new_fc_node, bias_node, eltw_node);
@@ -14,6 +14,7 @@
 #include "mvn_inst.h"
 #include "to_string_utils.h"
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <list>
@@ -367,6 +368,137 @@ void minimize_local_reorders(program& p, std::map<program_node*, format::type>&
     }
 }
 
+// The local minimization changes the format of one node at a time, so it keeps the chain of the format agnostic nodes
+// (eltwise, activation and so on) in the format, which doesn't fit their neighbours, when no single change reduces the
+// number of reorders. Such chains are reassigned here as a whole: the region of the connected nodes without preferred
+// format and with the same selected format gets the format, for which the reorders on its border move the least memory.
+bool is_format_agnostic(layout_optimizer& lo, const std::map<program_node*, format::type>& fmt_map, program_node* node) {
+    return node->is_in_data_flow() && fmt_map.count(node) > 0 && fmt_map.at(node) != format::any &&
+           lo.get_preferred_format(*node) == format::any;
+}
+
+template <direction_e dir>
+size_t region_border_cost_in_dir(const std::map<program_node*, format::type>& fmt_map, layout_optimizer& lo,
+                                 const std::set<program_node*>& region, program_node* node, format::type fmt) {
+    size_t cost = 0;
+    for (auto next : travel_direction_wrapper<dir>::next_nodes(node)) {
+        if (!next->is_in_data_flow() || region.count(next) > 0 || fmt_map.count(next) == 0)
+            continue;
+
+        auto next_fmt = fmt_map.at(next);
+        if (next_fmt == format::any || next_fmt == fmt ||
+            lo.can_fuse_reorder(*travel_direction_wrapper<dir>::first(node, next),
+                                *travel_direction_wrapper<dir>::second(node, next),
+                                travel_direction_wrapper<dir>::first(fmt, next_fmt),
+                                travel_direction_wrapper<dir>::second(fmt, next_fmt)))
+            continue;
+
+        // the reorder reads and writes the whole tensor
+        cost += 2 * travel_direction_wrapper<dir>::first(node, next)->get_output_layout().bytes_count();
+    }
+    return cost;
+}
+
+size_t region_border_cost(const std::map<program_node*, format::type>& fmt_map, layout_optimizer& lo,
+                          const std::set<program_node*>& region, format::type fmt) {
+    size_t cost = 0;
+    for (auto node : region) {
+        cost += region_border_cost_in_dir<direction_e::forwards>(fmt_map, lo, region, node, fmt);
+        cost += region_border_cost_in_dir<direction_e::backwards>(fmt_map, lo, region, node, fmt);
+    }
+    return cost;
+}
+
+std::set<program_node*> collect_region(const std::map<program_node*, format::type>& fmt_map, layout_optimizer& lo, program_node* start) {
+    auto fmt = fmt_map.at(start);
+    std::set<program_node*> region = { start };
+    std::list<program_node*> queue = { start };
+    auto try_add = [&](program_node* next) {
+        if (region.count(next) == 0 && is_format_agnostic(lo, fmt_map, next) && fmt_map.at(next) == fmt) {
+            region.insert(next);
+            queue.push_back(next);
+        }
+    };
+    while (!queue.empty()) {
+        auto node = queue.front();
+        queue.pop_front();
+        for (auto user : node->get_users())
+            try_add(user);
+        for (auto dep : node->get_dependencies())
+            try_add(dep);
+    }
+    return region;
+}
+
+void minimize_region_reorders(program& p, std::map<program_node*, format::type>& fmt_map, layout_optimizer& lo) {
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    // each reassignment strictly reduces the total cost, the limit just bounds the compilation time of the large graphs
+    const size_t max_iterations = 8;
+
+    for (size_t iteration = 0; iteration < max_iterations; iteration++) {
+        bool changed = false;
+        std::set<program_node*> visited;
+
+        for (auto node : p.get_processing_order()) {
+            if (visited.count(node) > 0 || !is_format_agnostic(lo, fmt_map, node))
+                continue;
+
+            auto region = collect_region(fmt_map, lo, node);
+            visited.insert(region.begin(), region.end());
+
+            auto sel_fmt = fmt_map.at(node);
+            auto dims = format::dimension(sel_fmt);
+            std::set<format::type> candidates;
+            for (auto region_node : region) {
+                for (auto user : region_node->get_users()) {
+                    if (user->is_in_data_flow() && region.count(user) == 0 && fmt_map.count(user) > 0)
+                        candidates.insert(fmt_map.at(user));
+                }
+                for (auto dep : region_node->get_dependencies()) {
+                    if (dep->is_in_data_flow() && region.count(dep) == 0 && fmt_map.count(dep) > 0)
+                        candidates.insert(fmt_map.at(dep));
+                }
+            }
+
+            auto best_cost = region_border_cost(fmt_map, lo, region, sel_fmt);
+            auto best_fmt = sel_fmt;
+            if (best_cost == 0)
+                continue;
+
+            for (auto fmt : candidates) {
+                if (fmt == format::any || fmt == sel_fmt || format::dimension(fmt) != dims)
+                    continue;
+
+                bool supported = std::all_of(region.begin(), region.end(), [&](program_node* region_node) {
+                    return lo.is_format_supported(*region_node, fmt);
+                });
+                if (!supported)
+                    continue;
+
+                auto cost = region_border_cost(fmt_map, lo, region, fmt);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_fmt = fmt;
+                }
+            }
+
+            if (best_fmt == sel_fmt)
+                continue;
+
+            GPU_DEBUG_IF(debug_config->verbose >= 2) {
+                GPU_DEBUG_COUT << "[clDNN][reorder_inputs] Region of " << region.size() << " nodes starting at " << node->id()
+                               << " is moved from " << fmt_to_str(sel_fmt) << " to " << fmt_to_str(best_fmt) << std::endl;
+            }
+            for (auto region_node : region)
+                fmt_map.at(region_node) = best_fmt;
+            changed = true;
+        }
+
+        if (!changed)
+            break;
+    }
+}
+
 template <direction_e dir>
 void insert_reorders_in_dir(program& p, const std::map<program_node*, format::type>& fmt_map, reorder_factory& rf, layout_optimizer& lo, program_node* node) {
     auto fmt = fmt_map.at(node);
@@ -457,6 +589,7 @@ void reorder_inputs::run(program& p, layout_optimizer& lo, reorder_factory& rf)
 
     propagate_formats(p, fmt_map, lo);
     minimize_local_reorders(p, fmt_map, lo);
+    minimize_region_reorders(p, fmt_map, lo);
 
     GPU_DEBUG_IF(debug_config->verbose >= 2) {
         GPU_DEBUG_COUT << "[clDNN][reorder_inputs] Selected formats:" << std::endl;
@@ -10,6 +10,7 @@
 #include "input_layout_inst.h"
 #include <vector>
 #include <algorithm>
+#include <unordered_map>
 
 namespace cldnn {
 namespace common {
@@ -55,8 +56,7 @@ struct loop_impl : typed_primitive_impl<loop> {
         // read trip_count from outer network
         bool update_num_iterations = false;
         const primitive_id& trip_count_id = node.get_trip_count_id();
-        memory::ptr trip_count_mem = outer_network.get_primitive(trip_count_id)->output_memory_ptr();
-        int64_t trip_count = loop_node::read_scalar_value(trip_count_mem, stream);
+        int64_t trip_count = read_scalar(outer_network.get_primitive(trip_count_id), stream);
         if (trip_count < 0) {
             const int64_t max_iteration = node.get_max_iteration();
             trip_count = max_iteration;
@@ -65,14 +65,13 @@ struct loop_impl : typed_primitive_impl<loop> {
 
         // read initial execution condition from outer network
         const primitive_id& initial_execution_id = node.get_initial_execution_id();
-        memory::ptr initial_execution_mem = outer_network.get_primitive(initial_execution_id)->output_memory_ptr();
-        int64_t execution_condition = loop_node::read_scalar_value(initial_execution_mem, stream);
+        int64_t execution_condition = read_scalar(outer_network.get_primitive(initial_execution_id), stream);
 
-        // shortcut of execution_condition memory in body network
-        memory::ptr execution_condition_mem = nullptr;
+        // shortcut of execution_condition primitive in body network
+        std::shared_ptr<primitive_inst> execution_condition_prim = nullptr;
         if (node.is_execution_condition_used()) {
             const primitive_id& condition_id = node.get_condition_id();
-            execution_condition_mem = body_network->get_primitive(condition_id)->output_memory_ptr();
+            execution_condition_prim = body_network->get_primitive(condition_id);
         }
 
         const auto& concatenated_input_mem_mappings = instance.concatenated_input_mem_mappings;
@@ -127,7 +126,7 @@ struct loop_impl : typed_primitive_impl<loop> {
             // However they are not being used yet and only TensorIterator which
             // has fixed sequence length is being validated.
             if (node.is_execution_condition_used()) {
-                execution_condition = loop_node::read_scalar_value(execution_condition_mem, stream);
+                execution_condition = read_scalar(execution_condition_prim, stream);
             }
 
             // update index & execution condition for the next iteration
@@ -163,6 +162,23 @@ struct loop_impl : typed_primitive_impl<loop> {
     }
 
     static primitive_impl* create(const loop_node& arg) { return new loop_impl(arg); }
+
+private:
+    // Reading a scalar from the device memory waits for the stream. The values of the constant primitives don't change
+    // between the iterations and the inferences, so they are read only once and the loops with the known trip count
+    // and condition are enqueued without any host synchronization
+    int64_t read_scalar(const std::shared_ptr<primitive_inst>& prim, stream& stream) {
+        auto cached = constant_scalars.find(prim.get());
+        if (cached != constant_scalars.end())
+            return cached->second;
+
+        int64_t value = loop_node::read_scalar_value(prim->output_memory_ptr(), stream);
+        if (prim->get_node().is_constant())
+            constant_scalars[prim.get()] = value;
+        return value;
+    }
+
+    std::unordered_map<const primitive_inst*, int64_t> constant_scalars;
 };
 
 namespace detail {
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "primitive_inst.h"
+#include "intel_gpu/runtime/engine.hpp"
+#include "intel_gpu/runtime/stream.hpp"
+
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace cldnn {
+namespace cpu {
+
+// Runs the body of a cpu impl on the task executor of the engine, so the enqueue of the next primitives isn't blocked
+// by the wait for the inputs and the computation on the host.
+// The body accesses the memory through a separate stream of the impl: the network queue already has the commands
+// waiting for the returned user event, which would block the map of the memory on it.
+// The exception of the body fails the returned user event, so it's rethrown by the wait of the current inference
+// and the dependent commands are not executed.
+class cpu_host_task {
+public:
+    using body_t = std::function<void(stream&)>;
+
+    cpu_host_task() = default;
+    cpu_host_task(const cpu_host_task&) : cpu_host_task() {}
+    cpu_host_task& operator=(const cpu_host_task&) = delete;
+
+    ~cpu_host_task() {
+        wait_last();
+    }
+
+    event::ptr run(primitive_inst& instance, const std::vector<event::ptr>& events, body_t body) {
+        wait_last();
+
+        auto& network_stream = instance.get_network().get_stream();
+        auto& engine = instance.get_network().get_engine();
+        if (!_host_stream)
+            _host_stream = engine.create_stream();
+
+        auto ready = network_stream.enqueue_marker(events, true);
+        auto ev = network_stream.create_user_event(false);
+        network_stream.flush();
+
+        auto host_stream = _host_stream;
+        engine.get_task_executor()->run([ready, ev, host_stream, body]() {
+            try {
+                ready->wait();
+                body(*host_stream);
+                host_stream->finish();
+            } catch (...) {
+                ev->set_exception(std::current_exception());
+                return;
+            }
+            ev->set();
+        });
+
+        _last_event = ev;
+        return ev;
+    }
+
+private:
+    // the runs share the host stream, so the next one starts after the previous one finished
+    void wait_last() {
+        if (!_last_event)
+            return;
+        try {
+            _last_event->wait();
+        } catch (...) {
+            // the failure is already reported to the inference the previous run belongs to
+        }
+    }
+
+    stream::ptr _host_stream;
+    event::ptr _last_event;
+};
+
+}  // namespace cpu
+}  // namespace cldnn
@@ -7,6 +7,7 @@
 #include "math_utils.h"
 #include "register.hpp"
 #include "cpu_impl_helpers.hpp"
+#include "cpu_host_task.hpp"
 
 #include <algorithm>
 #include <stdexcept>
@@ -792,35 +793,30 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
     }
 
     event::ptr execute_impl(const std::vector<event::ptr>& events, detection_output_inst& instance) override {
-        for (auto& a : events) {
-            a->wait();
-        }
-
-        auto& stream = instance.get_network().get_stream();
-
-        auto ev = stream.create_user_event(false);
-        const int num_of_images = instance.location_memory()->get_layout().size.batch[0];  // batch size
-        // Per image : label -> decoded bounding boxes.
-        std::vector<std::vector<std::vector<bounding_box>>> bboxes(num_of_images);
-        // Per image : class -> confidences per bounding box.
-        std::vector<std::vector<std::vector<std::pair<float, int>>>> confidences(num_of_images);
-
-        std::vector<std::vector<std::pair<float, std::pair<int, int>>>> scoreIndexPairs;
-        if (instance.location_memory()->get_layout().data_type == data_types::f32) {
-            prepare_data<data_type_to_type<data_types::f32>::type>(stream, instance, bboxes, confidences, scoreIndexPairs);
-            generate_detections<data_type_to_type<data_types::f32>::type>(stream, instance, num_of_images, bboxes, confidences, scoreIndexPairs);
-        } else {
-            prepare_data<data_type_to_type<data_types::f16>::type>(stream, instance, bboxes, confidences, scoreIndexPairs);
-            generate_detections<data_type_to_type<data_types::f16>::type>(stream, instance, num_of_images, bboxes, confidences, scoreIndexPairs);
-        }
-
-        ev->set();
-        return ev;
+        return host_task.run(instance, events, [this, &instance](stream& stream) {
+            const int num_of_images = instance.location_memory()->get_layout().size.batch[0];  // batch size
+            // Per image : label -> decoded bounding boxes.
+            std::vector<std::vector<std::vector<bounding_box>>> bboxes(num_of_images);
+            // Per image : class -> confidences per bounding box.
+            std::vector<std::vector<std::vector<std::pair<float, int>>>> confidences(num_of_images);
+
+            std::vector<std::vector<std::pair<float, std::pair<int, int>>>> scoreIndexPairs;
+            if (instance.location_memory()->get_layout().data_type == data_types::f32) {
+                prepare_data<data_type_to_type<data_types::f32>::type>(stream, instance, bboxes, confidences, scoreIndexPairs);
+                generate_detections<data_type_to_type<data_types::f32>::type>(stream, instance, num_of_images, bboxes, confidences, scoreIndexPairs);
+            } else {
+                prepare_data<data_type_to_type<data_types::f16>::type>(stream, instance, bboxes, confidences, scoreIndexPairs);
+                generate_detections<data_type_to_type<data_types::f16>::type>(stream, instance, num_of_images, bboxes, confidences, scoreIndexPairs);
+            }
+        });
     }
 
     void init_kernels() override {}
 
     static primitive_impl* create(const detection_output_node& arg) { return new detection_output_impl(arg); }
+
+private:
+    cpu_host_task host_task;
 };
 
 namespace detail {
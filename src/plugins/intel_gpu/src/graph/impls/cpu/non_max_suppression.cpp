@@ -6,6 +6,7 @@
 #include "primitive_inst.h"
 #include "register.hpp"
 #include "cpu_impl_helpers.hpp"
+#include "cpu_host_task.hpp"
 #include "impls/implementation_map.hpp"
 
 #include <vector>
@@ -329,9 +330,8 @@ void store_third_output(stream& stream, memory::ptr mem, const std::vector<resul
     }
 }
 
-void run(non_max_suppression_inst& instance) {
+void run(stream& stream, non_max_suppression_inst& instance) {
     auto prim = instance.node.get_primitive();
-    auto& stream = instance.get_network().get_stream();
 
     auto boxes = load_boxes(stream, instance.input_boxes_mem(), prim->center_point_box);
     auto scores = load_scores(stream, instance.input_scores_mem());
@@ -382,22 +382,17 @@ struct non_max_suppression_impl : typed_primitive_impl<non_max_suppression> {
     non_max_suppression_impl() : parent(kernel_selector::weights_reorder_params(), "non_max_suppression_impl") {}
 
     event::ptr execute_impl(const std::vector<event::ptr>& event, typed_primitive_inst<non_max_suppression>& instance) override {
-        for (auto e : event) {
-            e->wait();
-        }
-
-        auto& stream = instance.get_network().get_stream();
-        auto ev = stream.create_user_event(false);
-
-        run(instance);
-
-        ev->set();
-        return ev;
+        return host_task.run(instance, event, [&instance](stream& stream) {
+            run(stream, instance);
+        });
     }
 
     static primitive_impl* create(const non_max_suppression_node&) {
         return new non_max_suppression_impl();
     }
+
+private:
+    cpu_host_task host_task;
     void init_kernels() override {}
 };
 namespace detail {
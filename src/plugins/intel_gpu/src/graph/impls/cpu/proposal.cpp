@@ -7,6 +7,7 @@
 #include "impls/implementation_map.hpp"
 #include "intel_gpu/runtime/error_handler.hpp"
 #include "register.hpp"
+#include "cpu_host_task.hpp"
 
 #include <algorithm>
 #include <string>
@@ -388,43 +389,35 @@ struct proposal_impl : typed_primitive_impl<proposal> {
     }
 
     event::ptr execute_impl(const std::vector<event::ptr>& events, proposal_inst& instance) override {
-        for (auto& a : events) {
-            a->wait();
-        }
-
-        auto& stream = instance.get_network().get_stream();
-
-        auto ev = instance.get_network().get_stream().create_user_event(false);
-        im_info_t im_info;
-        if (instance.dep_memory(proposal_inst::image_info_index).get_layout().data_type == data_types::f16) {
-            read_image_info<data_type_to_type<data_types::f16>::type>(stream, instance, im_info);
-        } else {
-            read_image_info<data_type_to_type<data_types::f32>::type>(stream, instance, im_info);
-        }
-
-        if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type !=
-            instance.dep_memory(proposal_inst::bbox_pred_index).get_layout().data_type)
-            throw std::runtime_error("clDNN: proposal primitive doesn't support mixed bbox and scores types");
-
-        if (instance.dependencies().size() == 4) {
-            auto proposal_probabilities = instance.dep_memory_ptr(proposal_inst::proposal_probabilities_out);
-            if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16) {
-                mem_lock<data_type_to_type<data_types::f16>::type, mem_lock_type::read> proposal_prob_ptr{proposal_probabilities, stream};
-                execute<data_type_to_type<data_types::f16>::type>(stream, instance, im_info, proposal_prob_ptr.data());
+        return host_task.run(instance, events, [this, &instance](stream& stream) {
+            im_info_t im_info;
+            if (instance.dep_memory(proposal_inst::image_info_index).get_layout().data_type == data_types::f16) {
+                read_image_info<data_type_to_type<data_types::f16>::type>(stream, instance, im_info);
             } else {
-                mem_lock<data_type_to_type<data_types::f32>::type, mem_lock_type::read> proposal_prob_ptr{proposal_probabilities, stream};
-                execute<data_type_to_type<data_types::f32>::type>(stream, instance, im_info, proposal_prob_ptr.data());
+                read_image_info<data_type_to_type<data_types::f32>::type>(stream, instance, im_info);
             }
-        } else {
-            if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16) {
-                execute<data_type_to_type<data_types::f16>::type>(stream, instance, im_info);
+
+            if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type !=
+                instance.dep_memory(proposal_inst::bbox_pred_index).get_layout().data_type)
+                throw std::runtime_error("clDNN: proposal primitive doesn't support mixed bbox and scores types");
+
+            if (instance.dependencies().size() == 4) {
+                auto proposal_probabilities = instance.dep_memory_ptr(proposal_inst::proposal_probabilities_out);
+                if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16) {
+                    mem_lock<data_type_to_type<data_types::f16>::type, mem_lock_type::read> proposal_prob_ptr{proposal_probabilities, stream};
+                    execute<data_type_to_type<data_types::f16>::type>(stream, instance, im_info, proposal_prob_ptr.data());
+                } else {
+                    mem_lock<data_type_to_type<data_types::f32>::type, mem_lock_type::read> proposal_prob_ptr{proposal_probabilities, stream};
+                    execute<data_type_to_type<data_types::f32>::type>(stream, instance, im_info, proposal_prob_ptr.data());
+                }
             } else {
-                execute<data_type_to_type<data_types::f32>::type>(stream, instance, im_info);
+                if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16) {
+                    execute<data_type_to_type<data_types::f16>::type>(stream, instance, im_info);
+                } else {
+                    execute<data_type_to_type<data_types::f32>::type>(stream, instance, im_info);
+                }
             }
-        }
-
-        ev->set();
-        return ev;
+        });
     }
 
     void init_kernels() override {}
@@ -443,6 +436,9 @@ struct proposal_impl : typed_primitive_impl<proposal> {
 
         return new proposal_impl(arg);
     }
+
+private:
+    cpu_host_task host_task;
 };
 
 namespace detail {
@@ -36,6 +36,12 @@ protected:
         args.weights = instance.weights_memory();
         args.bias = instance.bias_term() ? instance.bias_memory() : nullptr;
 
+        if (instance.compressed_weights()) {
+            args.inputs.push_back(instance.decompression_scale_memory());
+            if (instance.decompression_zero_point_term())
+                args.inputs.push_back(instance.decompression_zero_point_memory());
+        }
+
         return args;
     }
 
@@ -52,6 +58,15 @@ public:
         if (primitive->input_size != 3)
             fc_params.output = fc_params.output.FlattenFeatureAndSpatials();
 
+        if (arg.compressed_weights()) {
+            fc_params.compressed = true;
+            fc_params.decompression_scale = convert_data_tensor(arg.decompression_scale().get_output_layout());
+            if (arg.decompression_zero_point_term()) {
+                fc_params.has_decompression_zp = true;
+                fc_params.decompression_zero_point = convert_data_tensor(arg.decompression_zero_point().get_output_layout());
+            }
+        }
+
         bool is_quantized = true;
         for (auto& input : arg.get_dependencies())
             is_quantized &= data_type_traits::is_quantized(input->get_output_layout().data_type);
@@ -81,6 +81,7 @@ void register_implementations() {
     REGISTER_OCL(embedding_bag);
     REGISTER_OCL(extract_image_patches);
     REGISTER_OCL(convert_color);
+    REGISTER_OCL(scaled_dot_product_attention);
 }
 
 }  // namespace ocl
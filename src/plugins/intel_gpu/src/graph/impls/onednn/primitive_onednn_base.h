@@ -16,12 +16,22 @@
 
 #include "reorder/reorder_weights_kernel_selector.h"
 #include "reorder/reorder_kernel_base.h"
+#include "runtime/kernels_cache.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include <list>
+#include <string>
 #include <utility>
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <oneapi/dnnl/dnnl_version.h>
+
+// the cache blobs of the primitives are available since oneDNN 2.6
+#if DNNL_VERSION_MAJOR > 2 || (DNNL_VERSION_MAJOR == 2 && DNNL_VERSION_MINOR >= 6)
+#define ONEDNN_PRIMITIVE_CACHE_BLOB
+#endif
 
 namespace cldnn {
 namespace onednn {
@@ -45,11 +55,61 @@ struct typed_primitive_onednn_impl : public typed_primitive_impl<PType> {
           _desc(desc),
           _attrs(attrs),
           _pd(pd),
-          _prim(pd) { }
+          _prim(create_primitive(arg.get_program().get_kernels_cache(), pd)) { }
 
     bool is_cpu() const override { return false; }
 
 protected:
+    // The identical primitives of the process are shared by the primitive cache of oneDNN, and when the kernels cache
+    // is enabled the compiled primitive is stored there too, so the next runs don't compile it again.
+    // The file keeps the cache blob id in front of the blob, to not use the blob of the colliding hash.
+    static PrimType create_primitive(const kernels_cache& cache, const PrimDescType& pd) {
+#ifndef ONEDNN_PRIMITIVE_CACHE_BLOB
+        // the older oneDNN has no cache blobs, the primitives are compiled on every run
+        (void)cache;
+        return PrimType(pd);
+#else
+        if (!cache.is_cache_enabled())
+            return PrimType(pd);
+
+        std::vector<uint8_t> blob_id;
+        try {
+            blob_id = pd.get_cache_blob_id();
+        } catch (dnnl::error&) { }
+        if (blob_id.empty())
+            return PrimType(pd);
+
+        const std::string id_str(blob_id.begin(), blob_id.end());
+        const auto file_name = std::to_string(std::hash<std::string>()(id_str)) + ".onednn_cache";
+
+        auto cached = cache.load_binary(file_name);
+        if (cached.size() > sizeof(uint64_t)) {
+            uint64_t id_size = 0;
+            std::memcpy(&id_size, cached.data(), sizeof(uint64_t));
+            if (id_size == blob_id.size() && cached.size() > sizeof(uint64_t) + id_size &&
+                std::equal(blob_id.begin(), blob_id.end(), cached.begin() + sizeof(uint64_t))) {
+                try {
+                    return PrimType(pd, std::vector<uint8_t>(cached.begin() + sizeof(uint64_t) + id_size, cached.end()));
+                } catch (dnnl::error&) {
+                    // the blob of the other oneDNN version or device, it's replaced by the new one below
+                }
+            }
+        }
+
+        PrimType prim(pd);
+        try {
+            auto blob = prim.get_cache_blob();
+            const uint64_t id_size = blob_id.size();
+            std::vector<unsigned char> binary(sizeof(uint64_t));
+            std::memcpy(binary.data(), &id_size, sizeof(uint64_t));
+            binary.insert(binary.end(), blob_id.begin(), blob_id.end());
+            binary.insert(binary.end(), blob.begin(), blob.end());
+            cache.save_binary(file_name, binary);
+        } catch (dnnl::error&) { }
+        return prim;
+#endif
+    }
+
     virtual bool optimized_out(typed_primitive_inst<PType>&) const { return false; }
 
     static bool has_output_scales(const std::shared_ptr<dnnl::primitive_attr>& attr) {
@@ -23,6 +23,10 @@ public:
     program_node& weights() const { return get_dependency(1); }
     program_node& bias() const { return get_dependency(2); }
     bool bias_term() const { return !get_primitive()->bias.empty(); }
+    program_node& decompression_scale() const { return get_dependency(2 + bias_term()); }
+    program_node& decompression_zero_point() const { return get_dependency(3 + bias_term()); }
+    bool compressed_weights() const { return get_primitive()->compressed_weights(); }
+    bool decompression_zero_point_term() const { return !get_primitive()->decompression_zero_point.empty(); }
 };
 
 using fully_connected_node = typed_program_node<fully_connected>;
@@ -41,7 +45,12 @@ public:
     memory::ptr weights_memory() const { return dep_memory_ptr(1); }
     memory::ptr bias_memory() const { return dep_memory_ptr(2); }
 
+    memory::ptr decompression_scale_memory() const { return dep_memory_ptr(2 + bias_term()); }
+    memory::ptr decompression_zero_point_memory() const { return dep_memory_ptr(3 + bias_term()); }
+
     bool bias_term() const { return !argument.bias.empty(); }
+    bool compressed_weights() const { return argument.compressed_weights(); }
+    bool decompression_zero_point_term() const { return !argument.decompression_zero_point.empty(); }
 };
 
 using fully_connected_inst = typed_primitive_inst<fully_connected>;
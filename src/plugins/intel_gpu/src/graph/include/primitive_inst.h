@@ -107,6 +107,8 @@ public:
     event::ptr execute(const std::vector<event::ptr>& events);
     void init_kernels();
     void set_arguments();
+    // returns true if the kernels arguments are bound to the memory the primitive uses now, so they may be reused
+    bool has_bound_arguments() const;
 
     bool validate() const {
         if (_impl == nullptr)
@@ -144,7 +146,7 @@ public:
 
     void allocate_internal_buffers();
     static memory::ptr allocate_output(engine& engine, memory_pool& pool,
-                                        const program_node& _node, bool is_internal);
+                                        const program_node& _node, bool is_internal, uint32_t net_id = 0);
 
     std::vector<memory::cptr> get_intermediates_memories() const { return _intermediates_memory; }
 
@@ -176,6 +178,9 @@ protected:
 
     std::vector<memory::cptr> _intermediates_memory;
 
+    // the memory the kernels arguments were bound to by the last set_arguments() call
+    std::vector<memory::cptr> _bound_memory;
+
     bool _output_changed;  // todo: implement output reuse if neither of inputs has changed
     bool _has_valid_input =
         true;  // by default all primitives has valid inputs, exception is input_layout (see input_layout_inst)
@@ -183,6 +188,7 @@ protected:
     bool _mem_allocated = false;
 
     memory::ptr allocate_output();
+    std::vector<memory::cptr> get_arguments_memory() const;
     static std::vector<std::shared_ptr<primitive_inst>> build_exec_deps(
         std::vector<std::shared_ptr<primitive_inst>> const& mem_deps);
 
@@ -11,6 +11,7 @@
 
 #include <string>
 #include <vector>
+#include <sstream>
 
 kernel_selector::data_type to_data_type(data_types dt) {
     switch (dt) {
@@ -842,6 +843,9 @@ void set_params(const program_node& node, kernel_selector::params& params) {
     params.engineInfo.maxThreadsPerDevice = params.engineInfo.maxThreadsPerExecutionUnit * device_info.execution_units_count;
     params.engineInfo.deviceCache = program.get_tuning_cache();
     params.engineInfo.driverVersion = device_info.driver_version;
+    std::stringstream device_id;
+    device_id << "0x" << std::hex << device_info.device_id;
+    params.engineInfo.deviceId = device_id.str();
     params.engineInfo.supportedSimdSizes = device_info.supported_simd_sizes;
 
     auto impl_forcing_bo = program.get_options().get<build_option_type::force_implementations>();
@@ -862,4 +866,5 @@ void set_optional_params(const program& program, kernel_selector::optional_param
     const auto& tuning_config = program.get_options().get<build_option_type::tuning_config>();
     params.tuningParams.mode = to_tuning_mode(tuning_config->config.mode);
     params.tuningParams.cacheFilePath = tuning_config->config.cache_file_path;
+    params.tuningParams.timeLimitMs = tuning_config->config.time_limit_ms;
 }
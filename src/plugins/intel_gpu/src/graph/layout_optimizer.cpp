@@ -1163,6 +1163,10 @@ bool layout_optimizer::are_data_types_suitable_for_onednn(program_node& node) {
         auto& fc_node = node.as<fully_connected>();
         auto wei_dt = fc_node.weights().get_output_layout().data_type;
 
+        // the weights decompression is implemented by the ocl kernels only
+        if (fc_node.compressed_weights())
+            return false;
+
         if ((in_dt == data_types::f16 && wei_dt == data_types::f16) &&
             (out_dt == data_types::f16 || out_dt == data_types::f32 || out_dt == data_types::i8))
             return true;
@@ -217,7 +217,8 @@ opt pass).
 network::network(program::ptr program, stream::ptr stream, bool is_internal, bool is_primary_stream)
     : _program(program)
     , _stream(stream)
-    , _memory_pool(new memory_pool(program->get_engine()))
+    , _memory_pool(!is_internal && program->get_engine().get_shared_memory_pool() ? program->get_engine().get_shared_memory_pool()
+                                                                                  : std::make_shared<memory_pool>(program->get_engine()))
     , _internal(is_internal)
     , _is_primary_stream(is_primary_stream)
     , _reset_arguments(true) {
@@ -231,6 +232,7 @@ network::network(program::ptr program, stream::ptr stream, bool is_internal, boo
     check_names();
     build_insts_deps();
     build_exec_order();
+    build_queues_schedule();
     validate_primitives();
     add_default_output_chains();
 }
@@ -248,12 +250,15 @@ network::network(engine& engine,
     : network(program::build_program(engine, nodes, options, is_internal), engine.create_stream(), is_internal) {}
 
 network::network(program::ptr program, uint16_t stream_id)
-    : network(program, program->get_engine().create_stream(), false, stream_id == 0) {}
+    : network(program, program->get_engine().create_stream_on_queue(stream_id), false, stream_id == 0) {}
 
 network::network(program::ptr program, stream::ptr stream, uint16_t stream_id)
     : network(program, stream, false, stream_id == 0) {}
 
 network::~network() {
+    // the released buffers may be taken by other networks right away, so the kernels using them must be completed
+    if (get_engine().get_memory_cache().is_enabled() || _memory_pool == get_engine().get_shared_memory_pool())
+        get_stream().finish();
     _memory_pool->clear_pool_for_network(net_id);
 }
 
@@ -618,6 +623,66 @@ void network::add_to_exec_order(const primitive_id& id) {
     _exec_order.push_back(inst);
 }
 
+void network::build_queues_schedule() {
+    auto queues_num = _program->get_options().get<build_option_type::queues_num>()->queues;
+    if (queues_num <= 1 || _internal || _stream->get_queue_type() != queue_types::in_order)
+        return;
+
+    _branch_streams.push_back(_stream);
+    for (uint16_t i = 1; i < queues_num; ++i)
+        _branch_streams.push_back(get_engine().create_stream());
+
+    // A primitive continues the queue of its dependency if that dependency is the last primitive of the queue,
+    // otherwise it starts a new branch on the next queue
+    std::vector<primitive_id> queue_tails(queues_num);
+    size_t next_queue = 0;
+    for (auto& inst : _exec_order) {
+        size_t queue = queues_num;
+        for (auto& dep : inst->get_node().get_dependencies()) {
+            auto dep_queue = _exec_queues.find(dep->id());
+            if (dep_queue != _exec_queues.end() && queue_tails[dep_queue->second] == dep->id()) {
+                queue = dep_queue->second;
+                break;
+            }
+        }
+
+        if (queue == queues_num) {
+            queue = next_queue;
+            next_queue = (next_queue + 1) % queues_num;
+        }
+
+        _exec_queues[inst->id()] = queue;
+        queue_tails[queue] = inst->id();
+    }
+
+    // no branches to run in parallel
+    if (std::all_of(_exec_queues.begin(), _exec_queues.end(), [](const std::pair<const primitive_id, size_t>& q) { return q.second == 0; })) {
+        _branch_streams.clear();
+        _exec_queues.clear();
+    }
+}
+
+void network::switch_to_queue(const primitive_inst& inst) {
+    const auto queue = _exec_queues.at(inst.id());
+
+    // the dependencies executed by the other queues are waited by the markers
+    std::vector<event::ptr> markers;
+    std::set<size_t> waited_queues;
+    for (auto& dep : inst.get_node().get_dependencies()) {
+        auto dep_queue = _exec_queues.find(dep->id());
+        if (dep_queue == _exec_queues.end() || dep_queue->second == queue || !waited_queues.insert(dep_queue->second).second)
+            continue;
+
+        auto& dep_stream = _branch_streams[dep_queue->second];
+        markers.push_back(dep_stream->enqueue_marker({}, true));
+        dep_stream->flush();
+    }
+
+    _stream = _branch_streams[queue];
+    if (!markers.empty())
+        _stream->enqueue_barrier(markers);
+}
+
 std::map<primitive_id, network_output> network::execute(const std::vector<event::ptr>& dependencies) {
     execute_impl(dependencies);
 
@@ -650,6 +715,15 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
     auto surf_lock = surfaces_lock::create(get_engine().type(), in_out_mem, get_stream());
 
     set_arguments();
+
+    // the branch queues start once the previous commands of the network queue are completed
+    if (!_branch_streams.empty()) {
+        auto start = _stream->enqueue_marker({}, true);
+        _stream->flush();
+        for (size_t i = 1; i < _branch_streams.size(); ++i)
+            _branch_streams[i]->enqueue_barrier({start});
+    }
+
     for (auto& inst : _exec_order) {
         GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
             auto& node = _program->get_node(inst->id());
@@ -673,10 +747,13 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
         }
 
         // If a node has mutable input or it's an output, then the input/output buffers might be changed
-        // So we need to set arguments on each execution.
-        if (inst->has_mutable_input() || inst->is_output()) {
+        // So we need to set arguments again, unless the kernels were already bound to the same memory
+        // by the previous execution. Then the recorded arguments are replayed as is.
+        if ((inst->has_mutable_input() || inst->is_output()) && !inst->has_bound_arguments()) {
             inst->set_arguments();
         }
+        if (!_branch_streams.empty())
+            switch_to_queue(*inst);
         execute_primitive(inst, events);
 
         GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
@@ -689,6 +766,17 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
         }
     }
 
+    // the network queue waits for all the branches, so the outputs are ready once it's finished
+    if (!_branch_streams.empty()) {
+        _stream = _branch_streams[0];
+        std::vector<event::ptr> branch_ends;
+        for (size_t i = 1; i < _branch_streams.size(); ++i) {
+            branch_ends.push_back(_branch_streams[i]->enqueue_marker({}, true));
+            _branch_streams[i]->flush();
+        }
+        _stream->enqueue_barrier(branch_ends);
+    }
+
     for (auto& inst : _program->get_processing_order()) {
         // Special handling for mutable data. The event should be the same as the user or dependency with highest
         // processing_num as the mutable_data can be updated when is both user or dependency.
@@ -868,13 +956,17 @@ void network::transfer_memory_to_device(std::shared_ptr<primitive_inst> instance
         return;
 
     if (alloc_type == allocation_type::usm_host || alloc_type == allocation_type::usm_shared) {
-        // Allocate and transfer memory
-        auto device_mem = inst_mem.get_engine()->allocate_memory(inst_mem.get_layout(), allocation_type::usm_device, false);
-        device_mem->copy_from(get_stream(), inst_mem);
-        GPU_DEBUG_GET_INSTANCE(debug_config);
-        GPU_DEBUG_IF(debug_config->verbose >= 2) {
-            GPU_DEBUG_COUT << "[" << node.id() << ": constant]" << std::endl;
-        }
+        // Allocate and transfer memory once per program, the device copy is shared by the networks of all the streams.
+        // The copy is blocking, so the memory is ready to be used by the queues of the other streams.
+        auto device_mem = _program->get_device_constant(node.id(), [&]() {
+            auto mem = inst_mem.get_engine()->allocate_memory(inst_mem.get_layout(), allocation_type::usm_device, false);
+            mem->copy_from(get_stream(), inst_mem);
+            GPU_DEBUG_GET_INSTANCE(debug_config);
+            GPU_DEBUG_IF(debug_config->verbose >= 2) {
+                GPU_DEBUG_COUT << "[" << node.id() << ": constant]" << std::endl;
+            }
+            return mem;
+        });
         _memory_pool->release_memory(&inst_mem, node.id(), get_id());
         instance->set_output_memory(device_mem);
     }
@@ -172,6 +172,22 @@ void primitive_inst::set_arguments() {
                      "Cannot set arguments for primitive " + primitive_id + " with invalid/unset input");
 
     _impl->set_arguments(*this);
+    _bound_memory = get_arguments_memory();
+}
+
+bool primitive_inst::has_bound_arguments() const {
+    return !_bound_memory.empty() && _bound_memory == get_arguments_memory();
+}
+
+std::vector<memory::cptr> primitive_inst::get_arguments_memory() const {
+    std::vector<memory::cptr> arguments_memory;
+    arguments_memory.reserve(_deps.size() + _intermediates_memory.size() + 1);
+    for (const auto& dep : _deps) {
+        arguments_memory.push_back(dep->output_memory_ptr());
+    }
+    arguments_memory.push_back(_output);
+    arguments_memory.insert(arguments_memory.end(), _intermediates_memory.begin(), _intermediates_memory.end());
+    return arguments_memory;
 }
 
 void primitive_inst::build_deps() {
@@ -259,11 +275,11 @@ void primitive_inst::allocate_internal_buffers(void) {
     }
 }
 memory::ptr primitive_inst::allocate_output(engine& _engine, memory_pool& pool, const program_node& _node,
-        bool is_internal) {
+        bool is_internal, uint32_t net_id) {
     auto get_memory_from_pool = [&](engine& _engine, const layout& layout, const primitive_id id, std::set<primitive_id> dependencies,
             allocation_type type, bool reusable) {
         if (_engine.configuration().use_memory_pool)
-                return pool.get_memory(layout, id, 0, dependencies, type, reusable);
+                return pool.get_memory(layout, id, net_id, dependencies, type, reusable);
         return pool.get_memory(layout, type);
     };
 
@@ -327,7 +343,7 @@ memory::ptr primitive_inst::allocate_output(engine& _engine, memory_pool& pool,
     }
 }
 memory::ptr primitive_inst::allocate_output() {
-    return allocate_output(get_network().get_engine(), _network.get_memory_pool(), _node, _network.is_internal());
+    return allocate_output(get_network().get_engine(), _network.get_memory_pool(), _node, _network.is_internal(), _network.get_id());
 }
 
 std::vector<std::shared_ptr<primitive_inst>> primitive_inst::build_exec_deps(
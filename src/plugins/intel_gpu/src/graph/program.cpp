@@ -73,6 +73,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <list>
 #include <map>
@@ -172,6 +173,22 @@ kernel::ptr program::get_kernel(kernel_id id) {
     return _kernels_cache->get_kernel(id);
 }
 
+std::map<std::string, uint64_t> program::get_kernels_build_statistics() const {
+    return _kernels_cache->get_build_statistics();
+}
+
+kernels_cache& program::get_kernels_cache() const {
+    return *_kernels_cache;
+}
+
+memory::ptr program::get_device_constant(const primitive_id& id, const std::function<memory::ptr()>& create) {
+    std::lock_guard<std::mutex> lock(_device_constants_mutex);
+    auto& mem = _device_constants[id];
+    if (!mem)
+        mem = create();
+    return mem;
+}
+
 program::ptr program::build_program(engine& engine,
                                     const topology& topology,
                                     const build_options& options,
@@ -428,6 +445,9 @@ void program::build_program(bool is_internal) {
     run_graph_compilation();
     { post_optimize_graph(is_internal); }
 
+    // the constants are final after the post optimizations, so they are uploaded to the device while the kernels are built
+    std::future<void> memory_transfer;
+
     GPU_DEBUG_GET_INSTANCE(debug_config);
 #ifdef GPU_DEBUG_CONFIG
     if (debug_config->dry_run_path.empty() || is_internal) {
@@ -440,13 +460,19 @@ void program::build_program(bool is_internal) {
             return;
         }
 
+        if (!is_internal)
+            memory_transfer = std::async(std::launch::async, [this]() { transfer_memory_to_device(); });
+
         compile();
         init_kernels();
     }
 
     if (!is_internal) {
         prim_info = get_current_stage_info();
-        transfer_memory_to_device();
+        if (memory_transfer.valid())
+            memory_transfer.get();
+        else
+            transfer_memory_to_device();
     }
 
     cleanup();
@@ -601,6 +627,8 @@ void program::transfer_memory_to_device() {
     if (!get_engine().supports_allocation(allocation_type::usm_device))
         return;
 
+    // the copies are made on a separate queue, so they don't wait for the program stream
+    auto copy_stream = get_engine().create_stream();
     for (auto& node : processing_order) {
         if (node->is_type<data>() && !node->need_lockable_memory()) {
             auto& data_node = node->as<data>();
@@ -622,17 +650,13 @@ void program::transfer_memory_to_device() {
                 }
                 // Allocate and transfer memory
                 auto device_mem = mem.get_engine()->allocate_memory(data_node_layout, allocation_type::usm_device, false);
-                device_mem->copy_from(get_stream(), mem);
+                device_mem->copy_from(*copy_stream, mem);
                 data_node.attach_memory(device_mem);
-                GPU_DEBUG_IF(debug_config->verbose >= 2) {
-                    GPU_DEBUG_COUT << "[" << data_node.id() << ": constant]" << std::endl;
-                }
                 const_cast<memory::ptr&>(data_node.get_primitive()->mem).reset();
-                // TODO: Do we need finish call here? Maybe call it in network::execute() ?
-                get_stream().finish();
             }
         }
     }
+    copy_stream->finish();
 }
 
 void program::cleanup() {
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_inst.h"
+
+#include "primitive_type_base.h"
+#include "intel_gpu/runtime/error_handler.hpp"
+#include "json_object.h"
+#include <string>
+
+namespace cldnn {
+primitive_type_id scaled_dot_product_attention::type_id() {
+    static primitive_type_base<scaled_dot_product_attention> instance;
+    return &instance;
+}
+
+layout scaled_dot_product_attention_inst::calc_output_layout(scaled_dot_product_attention_node const& node) {
+    auto desc = node.get_primitive();
+
+    auto query_layout = node.input(0).get_output_layout();
+    auto value_layout = node.input(2).get_output_layout();
+
+    auto output_size = query_layout.size;
+    output_size.spatial[0] = value_layout.size.spatial[0];
+
+    return layout{query_layout.data_type, query_layout.format, output_size, desc->output_padding};
+}
+
+std::string scaled_dot_product_attention_inst::to_string(scaled_dot_product_attention_node const& node) {
+    auto desc = node.get_primitive();
+    auto node_info = node.desc_to_json();
+
+    std::stringstream primitive_description;
+
+    json_composite attention_info;
+    attention_info.add("query id", node.input(0).id());
+    attention_info.add("key id", node.input(1).id());
+    attention_info.add("value id", node.input(2).id());
+    if (node.has_attention_mask())
+        attention_info.add("attention mask id", node.input(3).id());
+    attention_info.add("scale", desc->scale);
+    attention_info.add("transpose key", desc->transpose_key);
+    attention_info.add("is causal", desc->is_causal);
+    attention_info.add("f16 accumulation", desc->f16_accumulation);
+
+    node_info->add("scaled_dot_product_attention info", attention_info);
+    node_info->dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+scaled_dot_product_attention_inst::typed_primitive_inst(network& network, scaled_dot_product_attention_node const& node)
+    : parent(network, node) {}
+
+}  // namespace cldnn
@@ -77,7 +77,8 @@ enum class KernelType {
     DETECTION_OUTPUT,
     EXPERIMENTAL_DETECTRON_ROI_FEATURE_EXTRACTOR,
     CONVERT_COLOR,
-    RANDOM_UNIFORM
+    RANDOM_UNIFORM,
+    SCALED_DOT_PRODUCT_ATTENTION
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -8,8 +8,8 @@
 
 namespace kernel_selector {
 activation_kernel_selector::activation_kernel_selector() {
-    Attach<ActivationKernelRef>();
-    Attach<ActivationKernelOpt>();
+    ATTACH_KERNEL(ActivationKernelRef);
+    ATTACH_KERNEL(ActivationKernelOpt);
 }
 
 KernelsData activation_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -10,9 +10,9 @@
 namespace kernel_selector {
 
 arg_max_min_kernel_selector::arg_max_min_kernel_selector() {
-    Attach<ArgMaxMinKernelGPURef>();
+    ATTACH_KERNEL(ArgMaxMinKernelGPURef);
     // Attach<ArgMaxMinKernelOpt>(); not yet implemented
-    Attach<ArgMaxMinKernelAxis>();
+    ATTACH_KERNEL(ArgMaxMinKernelAxis);
 }
 
 KernelsData arg_max_min_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -8,7 +8,7 @@
 namespace kernel_selector {
 
 average_unpooling_kernel_selector::average_unpooling_kernel_selector() {
-    Attach<AverageUnpoolingKernelGPURef>();
+    ATTACH_KERNEL(AverageUnpoolingKernelGPURef);
 }
 
 KernelsData average_unpooling_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
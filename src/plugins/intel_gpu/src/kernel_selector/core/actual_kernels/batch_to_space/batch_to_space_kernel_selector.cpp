@@ -8,7 +8,7 @@
 namespace kernel_selector {
 
 batch_to_space_kernel_selector::batch_to_space_kernel_selector() {
-    Attach<BatchToSpaceKernelRef>();
+    ATTACH_KERNEL(BatchToSpaceKernelRef);
 }
 
 KernelsData batch_to_space_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -10,10 +10,10 @@
 
 namespace kernel_selector {
 binary_convolution_kernel_selector::binary_convolution_kernel_selector() {
-    Attach<BinaryConvolutionKernel1x1>();
-    Attach<BinaryConvolutionKernel1x1_b_fs_yx_fsv16>();
-    Attach<BinaryConvolutionKernelGeneric>();
-    Attach<BinaryConvolutionKernelRef>();
+    ATTACH_KERNEL(BinaryConvolutionKernel1x1);
+    ATTACH_KERNEL(BinaryConvolutionKernel1x1_b_fs_yx_fsv16);
+    ATTACH_KERNEL(BinaryConvolutionKernelGeneric);
+    ATTACH_KERNEL(BinaryConvolutionKernelRef);
 }
 
 KernelsData binary_convolution_kernel_selector::GetBestKernels(const Params& params,
@@ -6,7 +6,7 @@
 #include "border_kernel_ref.h"
 
 namespace kernel_selector {
-border_kernel_selector::border_kernel_selector() { Attach<BorderKernelRef>(); }
+border_kernel_selector::border_kernel_selector() { ATTACH_KERNEL(BorderKernelRef); }
 
 KernelsData border_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::BORDER);
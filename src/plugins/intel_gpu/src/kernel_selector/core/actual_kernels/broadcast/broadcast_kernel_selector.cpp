@@ -6,7 +6,7 @@
 #include "broadcast_kernel_ref.h"
 
 namespace kernel_selector {
-broadcast_kernel_selector::broadcast_kernel_selector() { Attach<BroadcastKernelRef>(); }
+broadcast_kernel_selector::broadcast_kernel_selector() { ATTACH_KERNEL(BroadcastKernelRef); }
 
 KernelsData broadcast_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::BROADCAST);
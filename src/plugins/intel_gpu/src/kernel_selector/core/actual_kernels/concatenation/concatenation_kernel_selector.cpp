@@ -11,11 +11,11 @@
 
 namespace kernel_selector {
 concatenation_kernel_selector::concatenation_kernel_selector() {
-    Attach<ConcatenationKernelRef>();
-    Attach<ConcatenationKernel_simple_Ref>();
-    Attach<ConcatenationKernel_depth_bfyx_no_pitch>();
-    Attach<ConcatenationKernel_b_fs_yx_fsv16>();
-    Attach<ConcatenationKernel_fs_b_yx_fsv32>();
+    ATTACH_KERNEL(ConcatenationKernelRef);
+    ATTACH_KERNEL(ConcatenationKernel_simple_Ref);
+    ATTACH_KERNEL(ConcatenationKernel_depth_bfyx_no_pitch);
+    ATTACH_KERNEL(ConcatenationKernel_b_fs_yx_fsv16);
+    ATTACH_KERNEL(ConcatenationKernel_fs_b_yx_fsv32);
 }
 
 KernelsData concatenation_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -8,7 +8,7 @@
 namespace kernel_selector {
 
 convert_color_kernel_selector::convert_color_kernel_selector() {
-    Attach<ConvertColorKernelRef>();
+    ATTACH_KERNEL(ConvertColorKernelRef);
 }
 
 KernelsData convert_color_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
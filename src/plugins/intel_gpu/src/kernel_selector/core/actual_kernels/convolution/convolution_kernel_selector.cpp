@@ -49,65 +49,65 @@
 
 namespace kernel_selector {
 convolution_kernel_selector::convolution_kernel_selector() {
-    Attach<ConvolutionKernel_Ref>();
-    Attach<DeformableConvolutionKernel_bfyx_Ref>();
+    ATTACH_KERNEL(ConvolutionKernel_Ref);
+    ATTACH_KERNEL(DeformableConvolutionKernel_bfyx_Ref);
 
     // b_fs_yx_fsv16 and b_fs_zyx_fsv16 int8
-    Attach<Convolution_kernel_b_fs_yx_fsv16_imad_1x1>();
-    Attach<Convolution_kernel_b_fs_zyx_fsv16_imad>();
+    ATTACH_KERNEL(Convolution_kernel_b_fs_yx_fsv16_imad_1x1);
+    ATTACH_KERNEL(Convolution_kernel_b_fs_zyx_fsv16_imad);
 
     // b_fs_yx_fsv16 and b_fs_zyx_fsv16
-    Attach<ConvolutionKernel_b_fs_yx_fsv16_depthwise>();
-    Attach<ConvolutionKernel_b_fs_yx_fsv16_1x1>();
-    Attach<ConvolutionKernel_b_fs_yx_fsv16>();
-    Attach<ConvolutionKernel_bfyx_to_bfyx_f16>();
-    Attach<ConvolutionKernel_b_fs_zyx_fsv16_fp32>();
-    Attach<ConvolutionKernel_b_fs_zyx_fsv16_fp16>();
+    ATTACH_KERNEL(ConvolutionKernel_b_fs_yx_fsv16_depthwise);
+    ATTACH_KERNEL(ConvolutionKernel_b_fs_yx_fsv16_1x1);
+    ATTACH_KERNEL(ConvolutionKernel_b_fs_yx_fsv16);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_to_bfyx_f16);
+    ATTACH_KERNEL(ConvolutionKernel_b_fs_zyx_fsv16_fp32);
+    ATTACH_KERNEL(ConvolutionKernel_b_fs_zyx_fsv16_fp16);
 
     // bs_fs_yx_bsv16_fsv16
-    Attach<ConvolutionKernel_bfyx_to_bfyx_bsv16_fsv16>();
-    Attach<Convolution_kernel_imad_bs_fs_yx_bsv16_fsv16_1x1>();
-    Attach<Convolution_kernel_imad_bs_fs_yx_bsv16_fsv16_3x3>();
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_to_bfyx_bsv16_fsv16);
+    ATTACH_KERNEL(Convolution_kernel_imad_bs_fs_yx_bsv16_fsv16_1x1);
+    ATTACH_KERNEL(Convolution_kernel_imad_bs_fs_yx_bsv16_fsv16_3x3);
 
     // fs_byx_fsv32
-    Attach<ConvolutionKernel_fs_byx_fsv32>();
-    Attach<ConvolutionKernel_fs_byx_fsv32_1x1>();
-    Attach<ConvolutionKernel_fs_byx_fsv32_depthwise>();
-    Attach<ConvolutionKernel_bfyx_to_fs_byx_fsv32>();
+    ATTACH_KERNEL(ConvolutionKernel_fs_byx_fsv32);
+    ATTACH_KERNEL(ConvolutionKernel_fs_byx_fsv32_1x1);
+    ATTACH_KERNEL(ConvolutionKernel_fs_byx_fsv32_depthwise);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_to_fs_byx_fsv32);
 
     // bfyx fp
-    Attach<convolution_kernel_bfyx_1x1_opt>();
-    Attach<ConvolutionKernel_bfyx_GEMMLike>();
-    Attach<ConvolutionKernel_bfyx_Direct_10_10_12>();
-    Attach<ConvolutionKernel_bfyx_os_iyx_osv16>();
-    Attach<ConvolutionKernel_bfyx_iyxo>();
-    Attach<ConvolutionKernel_bfyx_1x1>();
-    Attach<ConvolutionKernel_bfyx_1x1_gemm_buf>();
-    Attach<ConvolutionKernel_bfyx_depthwise_weights_lwg>();
+    ATTACH_KERNEL(convolution_kernel_bfyx_1x1_opt);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_GEMMLike);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_Direct_10_10_12);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_os_iyx_osv16);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_iyxo);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_1x1);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_1x1_gemm_buf);
+    ATTACH_KERNEL(ConvolutionKernel_bfyx_depthwise_weights_lwg);
 
     // yxfb fp
-    Attach<ConvolutionKernel_yxfb_Ref>();
-    Attach<ConvolutionKernel_yxfb_yxio_b16>();
-    Attach<ConvolutionKernel_yxfb_yxio_b8>();
-    Attach<ConvolutionKernel_yxfb_yxio_b1_block_mulitple_x>();
+    ATTACH_KERNEL(ConvolutionKernel_yxfb_Ref);
+    ATTACH_KERNEL(ConvolutionKernel_yxfb_yxio_b16);
+    ATTACH_KERNEL(ConvolutionKernel_yxfb_yxio_b8);
+    ATTACH_KERNEL(ConvolutionKernel_yxfb_yxio_b1_block_mulitple_x);
 
     // Winograd
-    Attach<ConvolutionKernel_Winograd_2x3_s1>();
-    Attach<ConvolutionKernel_Winograd_2x3_s1_fused>();
-    Attach<ConvolutionKernel_Winograd_6x3_s1_fused>();
+    ATTACH_KERNEL(ConvolutionKernel_Winograd_2x3_s1);
+    ATTACH_KERNEL(ConvolutionKernel_Winograd_2x3_s1_fused);
+    ATTACH_KERNEL(ConvolutionKernel_Winograd_6x3_s1_fused);
 
     // b_fs_yx_fsv4 kernels
-    Attach<ConvolutionKernel_imad>();
-    Attach<ConvolutionKernel_imad_b_fs_yx_fsv4_1x1>();
-    Attach<ConvolutionKernel_mmad_bfyx_to_b_fs_yx_fsv4>();
-    Attach<ConvolutionKernel_imad_b_fs_yx_fsv4_dw>();
-    Attach<ConvolutionKernel_b_fs_yx_fsv4_int8>();
+    ATTACH_KERNEL(ConvolutionKernel_imad);
+    ATTACH_KERNEL(ConvolutionKernel_imad_b_fs_yx_fsv4_1x1);
+    ATTACH_KERNEL(ConvolutionKernel_mmad_bfyx_to_b_fs_yx_fsv4);
+    ATTACH_KERNEL(ConvolutionKernel_imad_b_fs_yx_fsv4_dw);
+    ATTACH_KERNEL(ConvolutionKernel_b_fs_yx_fsv4_int8);
 
     // b_fs_yx_fsv32 kernels
-    Attach<ConvolutionKernel_mmad_b_fs_yx_fsv32>();
-    Attach<ConvolutionKernel_mmad_b_fs_yx_fsv32_dw>();
-    Attach<ConvolutionKernel_mmad_bfyx_to_b_fs_yx_fsv32>();
-    Attach<ConvolutionKernel_b_fs_yx_fsv_16_32_imad_dw>();
+    ATTACH_KERNEL(ConvolutionKernel_mmad_b_fs_yx_fsv32);
+    ATTACH_KERNEL(ConvolutionKernel_mmad_b_fs_yx_fsv32_dw);
+    ATTACH_KERNEL(ConvolutionKernel_mmad_bfyx_to_b_fs_yx_fsv32);
+    ATTACH_KERNEL(ConvolutionKernel_b_fs_yx_fsv_16_32_imad_dw);
 }
 
 KernelsData convolution_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -115,7 +115,7 @@ KernelsData convolution_kernel_selector::GetBestKernels(const Params& params, co
 }
 
 deformable_conv_kernel_selector::deformable_conv_kernel_selector() {
-    Attach<DeformableConvolutionKernel_bfyx_conv>();
+    ATTACH_KERNEL(DeformableConvolutionKernel_bfyx_conv);
 }
 
 KernelsData deformable_conv_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -123,7 +123,7 @@ KernelsData deformable_conv_kernel_selector::GetBestKernels(const Params& params
 }
 
 deformable_interp_kernel_selector::deformable_interp_kernel_selector() {
-    Attach<DeformableConvolutionKernel_bfyx_interp>();
+    ATTACH_KERNEL(DeformableConvolutionKernel_bfyx_interp);
 }
 
 KernelsData deformable_interp_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
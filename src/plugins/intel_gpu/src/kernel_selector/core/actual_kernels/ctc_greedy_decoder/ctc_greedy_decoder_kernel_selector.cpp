@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 ctc_greedy_decoder_kernel_selector::ctc_greedy_decoder_kernel_selector() {
-    Attach<CTCGreedyDecoderKernelRef>();
+    ATTACH_KERNEL(CTCGreedyDecoderKernelRef);
 }
 
 KernelsData ctc_greedy_decoder_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -8,8 +8,8 @@
 
 namespace kernel_selector {
 cum_sum_kernel_selector::cum_sum_kernel_selector() {
-    Attach<CumSumKernelRef>();
-    Attach<CumSumKernelPartialSum>();
+    ATTACH_KERNEL(CumSumKernelRef);
+    ATTACH_KERNEL(CumSumKernelPartialSum);
 }
 
 KernelsData cum_sum_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
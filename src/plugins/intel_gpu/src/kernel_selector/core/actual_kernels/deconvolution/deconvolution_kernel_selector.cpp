@@ -12,12 +12,12 @@
 
 namespace kernel_selector {
 deconvolution_kernel_selector::deconvolution_kernel_selector() {
-    Attach<DeconvolutionKernelRef>();
-    Attach<DeconvolutionKernel_bfyx_opt>();
-    Attach<DeconvolutionKernel_b_fs_zyx_fsv16>();
-    Attach<DeconvolutionKernel_b_fs_zyx_fsv16_dw>();
-    Attach<DeconvolutionKernel_imad_ref>();
-    Attach<DeconvolutionKernel_imad_along_f_tile_bfx>();
+    ATTACH_KERNEL(DeconvolutionKernelRef);
+    ATTACH_KERNEL(DeconvolutionKernel_bfyx_opt);
+    ATTACH_KERNEL(DeconvolutionKernel_b_fs_zyx_fsv16);
+    ATTACH_KERNEL(DeconvolutionKernel_b_fs_zyx_fsv16_dw);
+    ATTACH_KERNEL(DeconvolutionKernel_imad_ref);
+    ATTACH_KERNEL(DeconvolutionKernel_imad_along_f_tile_bfx);
 }
 
 KernelsData deconvolution_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
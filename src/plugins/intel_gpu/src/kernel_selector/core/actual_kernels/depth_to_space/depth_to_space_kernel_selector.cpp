@@ -9,8 +9,8 @@
 namespace kernel_selector {
 
 depth_to_space_kernel_selector::depth_to_space_kernel_selector() {
-    Attach<DepthToSpaceKernelRef>();
-    Attach<DepthToSpaceKernelBlock2Opt>();
+    ATTACH_KERNEL(DepthToSpaceKernelRef);
+    ATTACH_KERNEL(DepthToSpaceKernelBlock2Opt);
 }
 
 KernelsData depth_to_space_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -6,7 +6,7 @@
 #include "detection_output_kernel_ref.h"
 
 namespace kernel_selector {
-detection_output_kernel_selector::detection_output_kernel_selector() { Attach<DetectionOutputKernelRef>(); }
+detection_output_kernel_selector::detection_output_kernel_selector() { ATTACH_KERNEL(DetectionOutputKernelRef); }
 
 KernelsData detection_output_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::DETECTION_OUTPUT);
@@ -12,12 +12,12 @@
 
 namespace kernel_selector {
 eltwise_kernel_selector::eltwise_kernel_selector() {
-    Attach<EltwiseKernelRef>();
-    Attach<EltwiseKernel_vload8>();
-    Attach<EltwiseKernel_fs_b_yx_fsv32>();
-    Attach<EltwiseKernel_mixed_byxf_and_fs_b_yx_fsv32>();
-    Attach<EltwiseKernel_b_fs_yx_fsv16>();
-    Attach<EltwiseKernel_b_fs_yx_fsv4>();
+    ATTACH_KERNEL(EltwiseKernelRef);
+    ATTACH_KERNEL(EltwiseKernel_vload8);
+    ATTACH_KERNEL(EltwiseKernel_fs_b_yx_fsv32);
+    ATTACH_KERNEL(EltwiseKernel_mixed_byxf_and_fs_b_yx_fsv32);
+    ATTACH_KERNEL(EltwiseKernel_b_fs_yx_fsv16);
+    ATTACH_KERNEL(EltwiseKernel_b_fs_yx_fsv4);
 }
 
 KernelsData eltwise_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
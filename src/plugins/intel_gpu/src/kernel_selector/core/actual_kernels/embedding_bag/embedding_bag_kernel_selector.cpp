@@ -8,7 +8,7 @@
 namespace kernel_selector {
 
 embedding_bag_kernel_selector::embedding_bag_kernel_selector() {
-    Attach<EmbeddingBagKernelRef>();
+    ATTACH_KERNEL(EmbeddingBagKernelRef);
 }
 
 KernelsData embedding_bag_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 extract_image_patches_kernel_selector::extract_image_patches_kernel_selector() {
-    Attach<ExtractImagePatchesKernelRef>();
+    ATTACH_KERNEL(ExtractImagePatchesKernelRef);
 }
 
 KernelsData extract_image_patches_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -18,6 +18,34 @@ JitConstants FullyConnectedKernelBase::GetJitConstants(const fully_connected_par
 
     jit.AddConstant(MakeJitConstant("INPUT0_ELEMENTS_COUNT", x_size));
 
+    if (params.compressed) {
+        const auto& scale = params.decompression_scale;
+        const auto ofm = params.weights.OFM().v;
+        const auto group_size = params.weights.LogicalSize() / ofm / scale.Feature().v;
+
+        jit.AddConstants({MakeJitConstant("COMPRESSED_WEIGHTS", 1),
+                          MakeJitConstant("DECOMPRESSION_SCALE", scale),
+                          MakeJitConstant("DECOMPRESSION_GROUP_SIZE", group_size)});
+        jit.AddConstant(MakeJitConstant("DECOMPRESSION_SCALE_VAL(o, k)",
+                                        "decompression_scale[(o) * DECOMPRESSION_SCALE_BATCH_PITCH + "
+                                        "((k) / DECOMPRESSION_GROUP_SIZE) * DECOMPRESSION_SCALE_FEATURE_PITCH + "
+                                        "DECOMPRESSION_SCALE_OFFSET]"));
+        if (params.has_decompression_zp) {
+            const auto& zp = params.decompression_zero_point;
+            jit.AddConstants({MakeJitConstant("DECOMPRESSION_ZP_TERM", 1),
+                              MakeJitConstant("DECOMPRESSION_ZP", zp)});
+            if (zp.LogicalSize() == 1) {
+                jit.AddConstants({MakeJitConstant("DECOMPRESSION_ZP_SCALAR", 1),
+                                  MakeJitConstant("DECOMPRESSION_ZP_VAL(o, k)", "decompression_zp[DECOMPRESSION_ZP_OFFSET]")});
+            } else {
+                jit.AddConstant(MakeJitConstant("DECOMPRESSION_ZP_VAL(o, k)",
+                                                "decompression_zp[(o) * DECOMPRESSION_ZP_BATCH_PITCH + "
+                                                "((k) / DECOMPRESSION_GROUP_SIZE) * DECOMPRESSION_ZP_FEATURE_PITCH + "
+                                                "DECOMPRESSION_ZP_OFFSET]"));
+            }
+        }
+    }
+
     return jit;
 }
 
@@ -109,6 +137,15 @@ KernelsData FullyConnectedKernelBase::GetCommonKernelsData(const Params &params,
                      1,
                      fused_deps_total);
 
+    // the decompression parameters are the extra inputs of the primitive passed after the bias
+    if (newParams.compressed) {
+        auto fused_args = kernel.params.arguments.end() - fused_deps_total;
+        std::vector<ArgumentDescriptor> decompression_args = {{ArgumentDescriptor::Types::INPUT, 1}};
+        if (newParams.has_decompression_zp)
+            decompression_args.push_back({ArgumentDescriptor::Types::INPUT, 2});
+        kernel.params.arguments.insert(fused_args, decompression_args.begin(), decompression_args.end());
+    }
+
     // TODO Pass estimated time only through DispatchData
     kd.autoTuneIndex = autoTuneIndex;
     return {kd};
@@ -152,6 +189,13 @@ bool FullyConnectedKernelBase::Validate(const Params& p, const optional_params&)
             return false;
     }
 
+    if (params.compressed) {
+        const auto groups = params.decompression_scale.Feature().v;
+        const auto ifm = params.weights.LogicalSize() / params.weights.OFM().v;
+        if (groups == 0 || ifm % groups != 0 || params.decompression_scale.Batch().v != params.weights.OFM().v)
+            return false;
+    }
+
     return true;
 }
 
@@ -40,6 +40,8 @@ ParamsKey FullyConnected_bf_tiled::GetSupportedKey() const {
     k.EnableOutputDataType(Datatype::UINT8);
     k.EnableInputWeightsType(WeightsType::F16);
     k.EnableInputWeightsType(WeightsType::F32);
+    k.EnableInputWeightsType(WeightsType::INT8);
+    k.EnableInputWeightsType(WeightsType::UINT8);
     k.EnableInputLayout(DataLayout::bf);
     k.EnableInputLayout(DataLayout::bfyx);
     k.EnableOutputLayout(DataLayout::bf);
@@ -51,6 +53,7 @@ ParamsKey FullyConnected_bf_tiled::GetSupportedKey() const {
     k.EnableTensorPitches();
     k.EnableDifferentTypes();
     k.EnableDifferentInputWeightsTypes();
+    k.EnableWeightsCompression();
     return k;
 }
 
@@ -87,6 +90,22 @@ bool FullyConnected_bf_tiled::Validate(const Params& params, const optional_para
             return false;
     }
 
+    auto wei_dt = fc_params.weights.GetDType();
+    if (wei_dt == WeightsType::INT8 || wei_dt == WeightsType::UINT8) {
+        // int8 weights are supported only as the compressed ones, the int8 compute goes to the imad/mmad kernels
+        if (!fc_params.compressed || !params.engineInfo.bSubGroupCharSupport)
+            return false;
+        // the scales are loaded once per main loop iteration, so the group must cover whole iterations
+        // and the alignment correction of the first feature would shift the groups
+        auto group_size = (fc_params.weights.LogicalSize() / fc_params.weights.OFM().v) / fc_params.decompression_scale.Feature().v;
+        if (group_size % simd != 0)
+            return false;
+        if (input.GetDType() == Datatype::F16 && input.GetFirstElementOffset() % 2 != 0)
+            return false;
+    } else if (fc_params.compressed) {
+        return false;
+    }
+
     return true;
 }
 
@@ -136,6 +155,11 @@ bool TuneParamsSelector::VerifyTuneParams(const fully_connected_params& params,
 
     if (output_b % (tparams.tile_b * tparams.dispatch_bsv) != 0)
         return false;
+    if (params.compressed) {
+        auto group_size = (params.weights.LogicalSize() / params.weights.OFM().v) / params.decompression_scale.Feature().v;
+        if (group_size % (tparams.tile_ifm * simd) != 0)
+            return false;
+    }
     if (CeilDiv(output_f, tparams.tile_ofm * simd) % tparams.dispatch_fsv != 0)
         return false;
 
@@ -263,7 +287,10 @@ KernelsPriority FullyConnected_bf_tiled::GetKernelsPriority(const Params& params
         output_b *= fc_params.output.Feature().v;
 
     float estimated_time = DONT_USE_IF_HAVE_SOMETHING_ELSE;
-    if (output_b > 1 && fc_params.inputs[0].GetDType() == Datatype::F32)
+    // the reference kernel is the only alternative for the compressed weights
+    if (fc_params.compressed)
+        estimated_time = FORCE_PRIORITY_3;
+    else if (output_b > 1 && fc_params.inputs[0].GetDType() == Datatype::F32)
         estimated_time = FORCE_PRIORITY_3;
     else if (output_b > 1 && fc_params.inputs[0].GetDType() == Datatype::F16)
         estimated_time = FORCE_PRIORITY_4;
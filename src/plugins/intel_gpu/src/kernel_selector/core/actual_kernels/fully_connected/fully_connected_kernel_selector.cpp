@@ -24,23 +24,23 @@
 namespace kernel_selector {
 
 fully_connected_kernel_selector::fully_connected_kernel_selector() {
-    Attach<FullyConnected_bfyx_Ref>();
-    Attach<FullyConnected_bf_io_GEMM>();
-    Attach<FullyConnected_bs_f_bsv16_b1>();
-    Attach<FullyConnected_bs_f_bsv16_af8>();
-    Attach<FullyConnected_bs_f_bsv8_af8>();
-    Attach<FullyConnected_yxfb_ref>();
-    Attach<FullyConnected_fb_oi_ref>();
-    Attach<FullyConnected_fb_io_ref>();
-    Attach<FullyConnected_bf_io_ref>();
-    Attach<FullyConnected_fb_oi_b8_ref>();
-    Attach<FullyConnected_fb_io_block>();
-    Attach<FullyConnected_fb_io_b8_f8>();
-    Attach<FullyConnected_bf_io_input_spatial>();
-    Attach<FullyConnectedKernelMMAD>();
-    Attach<FullyConnectedKernelIMAD>();
-    Attach<FullyConnected_fs_byx_fsv32>();
-    Attach<FullyConnected_bf_tiled>();
+    ATTACH_KERNEL(FullyConnected_bfyx_Ref);
+    ATTACH_KERNEL(FullyConnected_bf_io_GEMM);
+    ATTACH_KERNEL(FullyConnected_bs_f_bsv16_b1);
+    ATTACH_KERNEL(FullyConnected_bs_f_bsv16_af8);
+    ATTACH_KERNEL(FullyConnected_bs_f_bsv8_af8);
+    ATTACH_KERNEL(FullyConnected_yxfb_ref);
+    ATTACH_KERNEL(FullyConnected_fb_oi_ref);
+    ATTACH_KERNEL(FullyConnected_fb_io_ref);
+    ATTACH_KERNEL(FullyConnected_bf_io_ref);
+    ATTACH_KERNEL(FullyConnected_fb_oi_b8_ref);
+    ATTACH_KERNEL(FullyConnected_fb_io_block);
+    ATTACH_KERNEL(FullyConnected_fb_io_b8_f8);
+    ATTACH_KERNEL(FullyConnected_bf_io_input_spatial);
+    ATTACH_KERNEL(FullyConnectedKernelMMAD);
+    ATTACH_KERNEL(FullyConnectedKernelIMAD);
+    ATTACH_KERNEL(FullyConnected_fs_byx_fsv32);
+    ATTACH_KERNEL(FullyConnected_bf_tiled);
 }
 
 KernelsData fully_connected_kernel_selector::GetBestKernels(const Params& params,
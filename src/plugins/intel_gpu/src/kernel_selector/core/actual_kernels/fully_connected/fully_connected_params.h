@@ -16,11 +16,22 @@ struct fully_connected_params : public weight_bias_params {
 
     QuantizationType quantization = QuantizationType::NONE;
 
+    // the int8 weights are decompressed by the kernel as (weights - decompression_zero_point) * decompression_scale
+    bool compressed = false;
+    bool has_decompression_zp = false;
+    // [OFM, groups] scales of the weights, the group size is IFM / groups
+    DataTensor decompression_scale;
+    // a scalar or the shape of decompression_scale
+    DataTensor decompression_zero_point;
+
     ParamsKey GetParamsKey() const override {
         ParamsKey k = weight_bias_params::GetParamsKey();
 
         k.EnableQuantization(quantization);
 
+        if (compressed)
+            k.EnableWeightsCompression();
+
         return k;
     }
 };
@@ -19,7 +19,7 @@
 
 namespace kernel_selector {
 
-gather_elements_kernel_selector::gather_elements_kernel_selector() { Attach<GatherElementsKernelRef>(); }
+gather_elements_kernel_selector::gather_elements_kernel_selector() { ATTACH_KERNEL(GatherElementsKernelRef); }
 
 KernelsData gather_elements_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::GATHER_ELEMENTS);
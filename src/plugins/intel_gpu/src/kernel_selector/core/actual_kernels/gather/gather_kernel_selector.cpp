@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-gather_kernel_selector::gather_kernel_selector() { Attach<GatherKernelRef>(); }
+gather_kernel_selector::gather_kernel_selector() { ATTACH_KERNEL(GatherKernelRef); }
 
 KernelsData gather_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::GATHER);
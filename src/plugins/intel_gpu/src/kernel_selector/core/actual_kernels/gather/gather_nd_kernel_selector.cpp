@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-gather_nd_kernel_selector::gather_nd_kernel_selector() { Attach<GatherNDKernelRef>(); }
+gather_nd_kernel_selector::gather_nd_kernel_selector() { ATTACH_KERNEL(GatherNDKernelRef); }
 
 KernelsData gather_nd_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::GATHER_ND);
@@ -6,7 +6,7 @@
 #include "gather_tree_kernel_ref.h"
 
 namespace kernel_selector {
-    gather_tree_kernel_selector::gather_tree_kernel_selector() { Attach<GatherTreeKernelRef>(); }
+    gather_tree_kernel_selector::gather_tree_kernel_selector() { ATTACH_KERNEL(GatherTreeKernelRef); }
 
     KernelsData gather_tree_kernel_selector::GetBestKernels(const Params& params,
                                                             const optional_params& options) const {
@@ -10,10 +10,10 @@
 
 namespace kernel_selector {
 gemm_kernel_selector::gemm_kernel_selector() {
-    Attach<GemmKernelRef>();
-    Attach<GemmKernelTiledOpt>();
-    Attach<GemmKernelMMADint8>();
-    Attach<GemmKernelMMADslmInt8>();
+    ATTACH_KERNEL(GemmKernelRef);
+    ATTACH_KERNEL(GemmKernelTiledOpt);
+    ATTACH_KERNEL(GemmKernelMMADint8);
+    ATTACH_KERNEL(GemmKernelMMADslmInt8);
 }
 
 KernelsData gemm_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 grn_kernel_selector::grn_kernel_selector() {
-    Attach<GRNKernelRef>();
+    ATTACH_KERNEL(GRNKernelRef);
 }
 
 KernelsData grn_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -14,14 +14,14 @@
 
 namespace kernel_selector {
 lrn_kernel_selector::lrn_kernel_selector() {
-    Attach<LRNKernelRef>();
-    Attach<LRNKernelWithinChannel>();
-    Attach<LRNKernelWithinChannelOpt>();
-    Attach<LRNKernelAcrossChannelRef>();
-    Attach<LRNKernelAcrossChannel_b8>();
-    Attach<LRNKernelWithinChannelByxfOpt>();
-    Attach<LRNKernelAcrossChannelMultipleFeatures>();
-    Attach<LRNKernelAcrossChannelMultipleFeaturesFSV16>();
+    ATTACH_KERNEL(LRNKernelRef);
+    ATTACH_KERNEL(LRNKernelWithinChannel);
+    ATTACH_KERNEL(LRNKernelWithinChannelOpt);
+    ATTACH_KERNEL(LRNKernelAcrossChannelRef);
+    ATTACH_KERNEL(LRNKernelAcrossChannel_b8);
+    ATTACH_KERNEL(LRNKernelWithinChannelByxfOpt);
+    ATTACH_KERNEL(LRNKernelAcrossChannelMultipleFeatures);
+    ATTACH_KERNEL(LRNKernelAcrossChannelMultipleFeaturesFSV16);
 }
 
 KernelsData lrn_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -6,7 +6,7 @@
 #include "lstm_elt_kernel_ref.h"
 
 namespace kernel_selector {
-lstm_elt_kernel_selector::lstm_elt_kernel_selector() { Attach<LSTMEltKernelRef>(); }
+lstm_elt_kernel_selector::lstm_elt_kernel_selector() { ATTACH_KERNEL(LSTMEltKernelRef); }
 
 KernelsData lstm_elt_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::LSTM_ELT);
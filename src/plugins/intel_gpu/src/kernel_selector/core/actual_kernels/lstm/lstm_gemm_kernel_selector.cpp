@@ -9,9 +9,9 @@
 
 namespace kernel_selector {
 lstm_gemm_kernel_selector::lstm_gemm_kernel_selector() {
-    Attach<LSTMGemmKernelRef>();
-    Attach<LSTMGemvKernel_subgroup1x64_bfyx_ff_SIMD16>();
-    Attach<LSTMGemvKernel_subgroup1x64_bfyx_hh_SIMD16>();
+    ATTACH_KERNEL(LSTMGemmKernelRef);
+    ATTACH_KERNEL(LSTMGemvKernel_subgroup1x64_bfyx_ff_SIMD16);
+    ATTACH_KERNEL(LSTMGemvKernel_subgroup1x64_bfyx_hh_SIMD16);
 }
 
 KernelsData lstm_gemm_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
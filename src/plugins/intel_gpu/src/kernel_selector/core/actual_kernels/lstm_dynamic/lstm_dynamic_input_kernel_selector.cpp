@@ -8,8 +8,8 @@
 
 namespace kernel_selector {
 lstm_dynamic_input_kernel_selector::lstm_dynamic_input_kernel_selector() {
-    Attach<LSTM_DynamicInputKernelRef>();
-    Attach<LSTM_DynamicInputKernelBfyxOpt>();
+    ATTACH_KERNEL(LSTM_DynamicInputKernelRef);
+    ATTACH_KERNEL(LSTM_DynamicInputKernelBfyxOpt);
 }
 
 KernelsData lstm_dynamic_input_kernel_selector::GetBestKernels(const Params& params,
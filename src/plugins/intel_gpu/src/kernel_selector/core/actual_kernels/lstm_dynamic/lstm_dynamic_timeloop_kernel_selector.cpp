@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 lstm_dynamic_timeloop_kernel_selector::lstm_dynamic_timeloop_kernel_selector() {
-    Attach<LSTM_DynamicTimeloopKernelRef>();
+    ATTACH_KERNEL(LSTM_DynamicTimeloopKernelRef);
 }
 
 KernelsData lstm_dynamic_timeloop_kernel_selector::GetBestKernels(const Params& params,
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-max_unpooling_kernel_selector::max_unpooling_kernel_selector() { Attach<MaxUnpoolingKernelGPURef>(); }
+max_unpooling_kernel_selector::max_unpooling_kernel_selector() { ATTACH_KERNEL(MaxUnpoolingKernelGPURef); }
 
 KernelsData max_unpooling_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::MAX_UNPOOLING);
@@ -10,10 +10,10 @@
 
 namespace kernel_selector {
 mvn_kernel_selector::mvn_kernel_selector() {
-    Attach<MVNKernelRef>();
-    Attach<MVNKernelBfyxOpt>();
-    Attach<MVNKernel_b_fs_yx_fsv16_imad>();
-    Attach<MVNKernel_bs_fs_yx_bsv32>();
+    ATTACH_KERNEL(MVNKernelRef);
+    ATTACH_KERNEL(MVNKernelBfyxOpt);
+    ATTACH_KERNEL(MVNKernel_b_fs_yx_fsv16_imad);
+    ATTACH_KERNEL(MVNKernel_bs_fs_yx_bsv32);
 }
 
 KernelsData mvn_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-non_max_suppression_kernel_selector::non_max_suppression_kernel_selector() { Attach<NonMaxSuppressionKernelRef>(); }
+non_max_suppression_kernel_selector::non_max_suppression_kernel_selector() { ATTACH_KERNEL(NonMaxSuppressionKernelRef); }
 
 KernelsData non_max_suppression_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::NON_MAX_SUPPRESSION);
@@ -8,8 +8,8 @@
 
 namespace kernel_selector {
 normalize_kernel_selector::normalize_kernel_selector() {
-    Attach<NormalizeKernelWithinSpatialRef>();
-    Attach<NormalizeKernelAcrossSpatialRef>();
+    ATTACH_KERNEL(NormalizeKernelWithinSpatialRef);
+    ATTACH_KERNEL(NormalizeKernelAcrossSpatialRef);
 }
 
 KernelsData normalize_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
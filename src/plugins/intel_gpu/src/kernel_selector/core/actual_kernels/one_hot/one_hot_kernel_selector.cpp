@@ -6,7 +6,7 @@
 #include "one_hot_kernel_ref.h"
 
 namespace kernel_selector {
-one_hot_kernel_selector::one_hot_kernel_selector() { Attach<OneHotKernelRef>(); }
+one_hot_kernel_selector::one_hot_kernel_selector() { ATTACH_KERNEL(OneHotKernelRef); }
 
 KernelsData one_hot_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::ONE_HOT);
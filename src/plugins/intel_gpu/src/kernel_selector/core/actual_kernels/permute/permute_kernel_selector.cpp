@@ -10,9 +10,9 @@
 namespace kernel_selector {
 
 permute_kernel_selector::permute_kernel_selector() {
-    Attach<PermuteKernelRef>();
-    Attach<PermuteKernel_tile_8x8_4x4>();
-    Attach<PermuteKernel_tile_8x8_4x4_fsv>();
+    ATTACH_KERNEL(PermuteKernelRef);
+    ATTACH_KERNEL(PermuteKernel_tile_8x8_4x4);
+    ATTACH_KERNEL(PermuteKernel_tile_8x8_4x4_fsv);
 }
 
 KernelsData permute_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -18,17 +18,17 @@
 namespace kernel_selector {
 
 pooling_kernel_selector::pooling_kernel_selector() {
-    Attach<PoolingKernelGPURef>();
-    Attach<PoolingKernelGPUByxfOpt>();
-    Attach<PoolingKernelGPUBfyxBlockOpt>();
-    Attach<PoolingKernelGPUByxfPaddingOpt>();
-    Attach<PoolingKernelGPUInt8Ref>();
-    Attach<PoolingKerneGPU_b_fs_yx_fsv4>();
-    Attach<PoolingKerneGPU_fs_b_yx_fsv32>();
-    Attach<PoolingKernel_b_fs_yx_fsv16>();
-    Attach<PoolingKernel_bsv16_fsv16>();
-    Attach<PoolingKernelGPU_b_fs_zyx_fsv16_imad>();
-    Attach<Pooling_kernel_gpu_bs_fs_yx_bsv_16_fsv16>();
+    ATTACH_KERNEL(PoolingKernelGPURef);
+    ATTACH_KERNEL(PoolingKernelGPUByxfOpt);
+    ATTACH_KERNEL(PoolingKernelGPUBfyxBlockOpt);
+    ATTACH_KERNEL(PoolingKernelGPUByxfPaddingOpt);
+    ATTACH_KERNEL(PoolingKernelGPUInt8Ref);
+    ATTACH_KERNEL(PoolingKerneGPU_b_fs_yx_fsv4);
+    ATTACH_KERNEL(PoolingKerneGPU_fs_b_yx_fsv32);
+    ATTACH_KERNEL(PoolingKernel_b_fs_yx_fsv16);
+    ATTACH_KERNEL(PoolingKernel_bsv16_fsv16);
+    ATTACH_KERNEL(PoolingKernelGPU_b_fs_zyx_fsv16_imad);
+    ATTACH_KERNEL(Pooling_kernel_gpu_bs_fs_yx_bsv_16_fsv16);
 }
 
 KernelsData pooling_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -6,7 +6,7 @@
 #include "pyramid_roi_align_kernel_ref.h"
 
 namespace kernel_selector {
-PyramidROIAlign_kernel_selector::PyramidROIAlign_kernel_selector() { Attach<PyramidROIAlignKernelRef>(); }
+PyramidROIAlign_kernel_selector::PyramidROIAlign_kernel_selector() { ATTACH_KERNEL(PyramidROIAlignKernelRef); }
 
 KernelsData PyramidROIAlign_kernel_selector::GetBestKernels(const Params& params,
                                                             const optional_params& options) const {
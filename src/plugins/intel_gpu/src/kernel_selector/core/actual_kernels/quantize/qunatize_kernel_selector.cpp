@@ -9,8 +9,8 @@
 namespace kernel_selector {
 
 quantize_kernel_selector::quantize_kernel_selector() {
-    Attach<QuantizeKernelRef>();
-    Attach<QuantizeKernelScaleShift>();
+    ATTACH_KERNEL(QuantizeKernelRef);
+    ATTACH_KERNEL(QuantizeKernelScaleShift);
 }
 
 KernelsData quantize_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -7,7 +7,7 @@
 namespace kernel_selector {
 
 random_uniform_kernel_selector::random_uniform_kernel_selector() {
-    Attach<RandomUniformKernelRef>();
+    ATTACH_KERNEL(RandomUniformKernelRef);
 }
 
 KernelsData random_uniform_kernel_selector::GetBestKernels(const Params &params, const optional_params &options) const {
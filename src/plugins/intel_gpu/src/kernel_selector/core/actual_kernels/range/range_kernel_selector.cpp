@@ -14,7 +14,7 @@ class range_kernel_selector: public kernel_selector_base {
     }
 public:
     range_kernel_selector() {
-        Attach<RangeKernelRef>();
+        ATTACH_KERNEL(RangeKernelRef);
     }
 };
 
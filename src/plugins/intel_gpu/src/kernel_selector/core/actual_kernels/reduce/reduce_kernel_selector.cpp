@@ -9,8 +9,8 @@
 namespace kernel_selector {
 
 reduce_kernel_selector::reduce_kernel_selector() {
-    Attach<ReduceKernelRef>();
-    Attach<ReduceKernel_b_fs_yx_fsv16>();
+    ATTACH_KERNEL(ReduceKernelRef);
+    ATTACH_KERNEL(ReduceKernel_b_fs_yx_fsv16);
 }
 
 KernelsData reduce_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
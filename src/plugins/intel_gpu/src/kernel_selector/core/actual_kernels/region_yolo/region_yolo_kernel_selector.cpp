@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-region_yolo_kernel_selector::region_yolo_kernel_selector() { Attach<RegionYoloKernelRef>(); }
+region_yolo_kernel_selector::region_yolo_kernel_selector() { ATTACH_KERNEL(RegionYoloKernelRef); }
 
 KernelsData region_yolo_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::REGION_YOLO);
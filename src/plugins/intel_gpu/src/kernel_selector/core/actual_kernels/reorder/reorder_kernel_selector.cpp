@@ -17,16 +17,16 @@
 namespace kernel_selector {
 
 reorder_kernel_selector::reorder_kernel_selector() {
-    Attach<ReorderKernelRef>();
-    Attach<ReorderKernelBinary>();
-    Attach<ReorderKernelFastBatch1>();
-    Attach<ReorderFromWinograd2x3Kernel>();
-    Attach<ReorderToWinograd2x3Kernel>();
-    Attach<ReorderKernel_to_yxfb_batched>();
-    Attach<reorder_biplanar_nv12>();
-    Attach<ReorderKernel_fs_b_yx_fsv32_to_bfyx>();
-    Attach<ReorderKernel_bfyx_to_blocked_format>();
-    Attach<ReorderKernel_b_fs_yx_fsv16_fsv32_to_bfyx>();
+    ATTACH_KERNEL(ReorderKernelRef);
+    ATTACH_KERNEL(ReorderKernelBinary);
+    ATTACH_KERNEL(ReorderKernelFastBatch1);
+    ATTACH_KERNEL(ReorderFromWinograd2x3Kernel);
+    ATTACH_KERNEL(ReorderToWinograd2x3Kernel);
+    ATTACH_KERNEL(ReorderKernel_to_yxfb_batched);
+    ATTACH_KERNEL(reorder_biplanar_nv12);
+    ATTACH_KERNEL(ReorderKernel_fs_b_yx_fsv32_to_bfyx);
+    ATTACH_KERNEL(ReorderKernel_bfyx_to_blocked_format);
+    ATTACH_KERNEL(ReorderKernel_b_fs_yx_fsv16_fsv32_to_bfyx);
 }
 
 KernelsData reorder_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -14,13 +14,13 @@
 namespace kernel_selector {
 
 ReorderWeightsKernelSelctor::ReorderWeightsKernelSelctor() {
-    Attach<ReorderWeightsKernel>();
-    Attach<ReorderWeightsWinograd2x3Kernel>();
-    Attach<ReorderWeightsWinograd6x3Kernel>();
-    Attach<ReorderWeightsImage_fyx_b_Kernel>();
-    Attach<ReorderWeightsImageWinograd6x3Kernel>();
-    Attach<ReorderWeightsBinaryKernel>();
-    Attach<ReorderWeightsOpt>();
+    ATTACH_KERNEL(ReorderWeightsKernel);
+    ATTACH_KERNEL(ReorderWeightsWinograd2x3Kernel);
+    ATTACH_KERNEL(ReorderWeightsWinograd6x3Kernel);
+    ATTACH_KERNEL(ReorderWeightsImage_fyx_b_Kernel);
+    ATTACH_KERNEL(ReorderWeightsImageWinograd6x3Kernel);
+    ATTACH_KERNEL(ReorderWeightsBinaryKernel);
+    ATTACH_KERNEL(ReorderWeightsOpt);
 }
 
 KernelsData ReorderWeightsKernelSelctor::GetBestKernels(const Params& params, const optional_params& options) const {
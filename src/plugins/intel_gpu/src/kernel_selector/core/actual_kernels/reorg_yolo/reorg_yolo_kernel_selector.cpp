@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-reorg_yolo_kernel_selector::reorg_yolo_kernel_selector() { Attach<ReorgYoloKernelRef>(); }
+reorg_yolo_kernel_selector::reorg_yolo_kernel_selector() { ATTACH_KERNEL(ReorgYoloKernelRef); }
 
 KernelsData reorg_yolo_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::REORG_YOLO);
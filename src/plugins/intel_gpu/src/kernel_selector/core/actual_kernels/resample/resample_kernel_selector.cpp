@@ -8,8 +8,8 @@
 
 namespace kernel_selector {
 resample_kernel_selector::resample_kernel_selector() {
-    Attach<ResampleKernelRef>();
-    Attach<ResampleKernelOpt>();
+    ATTACH_KERNEL(ResampleKernelRef);
+    ATTACH_KERNEL(ResampleKernelOpt);
 }
 
 KernelsData resample_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-reshape_kernel_selector::reshape_kernel_selector() { Attach<ReshapeKernelRef>(); }
+reshape_kernel_selector::reshape_kernel_selector() { ATTACH_KERNEL(ReshapeKernelRef); }
 
 KernelsData reshape_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::RESHAPE);
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-reverse_sequence_kernel_selector::reverse_sequence_kernel_selector() { Attach<ReverseSequenceKernelRef>(); }
+reverse_sequence_kernel_selector::reverse_sequence_kernel_selector() { ATTACH_KERNEL(ReverseSequenceKernelRef); }
 
 KernelsData reverse_sequence_kernel_selector::GetBestKernels(const Params& params,
                                                              const optional_params& options) const {
@@ -7,7 +7,7 @@
 namespace kernel_selector {
 
 roi_align_kernel_selector::roi_align_kernel_selector() {
-    Attach<ROIAlignKernelRef>();
+    ATTACH_KERNEL(ROIAlignKernelRef);
 }
 
 KernelsData roi_align_kernel_selector::GetBestKernels(const Params &params,
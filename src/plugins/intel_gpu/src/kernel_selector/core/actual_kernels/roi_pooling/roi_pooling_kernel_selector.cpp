@@ -8,8 +8,8 @@
 
 namespace kernel_selector {
 roi_pooling_kernel_selector::roi_pooling_kernel_selector() {
-    Attach<ROIPoolingKernelRef>();
-    Attach<PSROIPoolingKernelRef>();
+    ATTACH_KERNEL(ROIPoolingKernelRef);
+    ATTACH_KERNEL(PSROIPoolingKernelRef);
 }
 
 KernelsData roi_pooling_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
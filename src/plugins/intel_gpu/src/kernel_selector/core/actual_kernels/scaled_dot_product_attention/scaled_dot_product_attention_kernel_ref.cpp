@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_kernel_ref.h"
+#include "kernel_selector_utils.h"
+#include <string>
+#include <vector>
+
+namespace kernel_selector {
+ParamsKey ScaledDotProductAttentionKernelRef::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+    return k;
+}
+
+bool ScaledDotProductAttentionKernelRef::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::SCALED_DOT_PRODUCT_ATTENTION || o.GetType() != KernelType::SCALED_DOT_PRODUCT_ATTENTION)
+        return false;
+
+    const auto& params = static_cast<const scaled_dot_product_attention_params&>(p);
+    if (params.inputs.size() != 3 && params.inputs.size() != 4)
+        return false;
+
+    const auto& query = params.inputs[0];
+    const auto& key = params.inputs[1];
+    const auto& value = params.inputs[2];
+    const auto head_size = params.transpose_key ? key.X().v : key.Y().v;
+    const auto keys_num = params.transpose_key ? key.Y().v : key.X().v;
+    if (query.X().v != head_size || value.Y().v != keys_num)
+        return false;
+
+    return true;
+}
+
+CommonDispatchData ScaledDotProductAttentionKernelRef::SetDefault(const scaled_dot_product_attention_params& params,
+                                                                  const optional_params&) const {
+    CommonDispatchData dispatchData;
+    auto in_layout = params.inputs[0].GetLayout();
+    auto out_layout = params.output.GetLayout();
+    std::vector<std::vector<Tensor::DataChannelName>> dims_by_gws = {{ Tensor::DataChannelName::Y },
+                                                                     { Tensor::DataChannelName::FEATURE },
+                                                                     { Tensor::DataChannelName::BATCH }};
+
+    // a work item per query, it goes through all the keys
+    dispatchData.gws = { params.output.Y().v,
+                         params.output.Feature().v,
+                         params.output.Batch().v };
+
+    dispatchData.lws = GetOptimalLocalWorkGroupSizes(dispatchData.gws, params.engineInfo, in_layout, out_layout, dims_by_gws);
+
+    return dispatchData;
+}
+
+JitConstants ScaledDotProductAttentionKernelRef::GetJitConstants(const scaled_dot_product_attention_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    const auto& key = params.inputs[1];
+    jit.AddConstant(MakeJitConstant("SCALE_FACTOR", params.scale));
+    jit.AddConstant(MakeJitConstant("HEAD_SIZE", params.inputs[0].X().v));
+    jit.AddConstant(MakeJitConstant("KEYS_NUM", params.transpose_key ? key.Y().v : key.X().v));
+    if (params.transpose_key) {
+        jit.AddConstant(MakeJitConstant("KEY_GET_INDEX(b, h, s, d)", "INPUT1_GET_INDEX(b, h, s, d)"));
+    } else {
+        jit.AddConstant(MakeJitConstant("KEY_GET_INDEX(b, h, s, d)", "INPUT1_GET_INDEX(b, h, d, s)"));
+    }
+    jit.AddConstant(MakeJitConstant("IS_CAUSAL", params.is_causal));
+    jit.AddConstant(MakeJitConstant("HAS_ATTENTION_MASK", params.inputs.size() == 4));
+
+    // the f16 accumulation is opt-in, as the sums of the long sequences lose precision
+    const bool f16_accumulation = params.f16_accumulation && params.inputs[0].GetDType() == Datatype::F16;
+    jit.Merge(MakeTypeJitConstants(f16_accumulation ? Datatype::F16 : Datatype::F32, "ACCUMULATOR"));
+
+    return jit;
+}
+
+KernelsData ScaledDotProductAttentionKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options))
+        return {};
+
+    KernelData kd = KernelData::Default<scaled_dot_product_attention_params>(params);
+    scaled_dot_product_attention_params& newParams = *static_cast<scaled_dot_product_attention_params*>(kd.params.get());
+
+    auto dispatchData = SetDefault(newParams, options);
+    auto entry_point = GetEntryPoint(kernelName, newParams.layerID, params, options);
+    auto cldnn_jit = GetJitConstants(newParams);
+    auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+    auto& kernel = kd.kernels[0];
+
+    FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point, "", false, false,
+                     static_cast<int>(newParams.inputs.size()));
+
+    return {kd};
+}
+
+KernelsPriority ScaledDotProductAttentionKernelRef::GetKernelsPriority(const Params& /*params*/, const optional_params& /*options*/) const {
+    return DONT_USE_IF_HAVE_SOMETHING_ELSE;
+}
+}  // namespace kernel_selector
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_base_opencl.h"
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// scaled_dot_product_attention_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct scaled_dot_product_attention_params : public base_params {
+    scaled_dot_product_attention_params() : base_params(KernelType::SCALED_DOT_PRODUCT_ATTENTION),
+    scale(1.0f), transpose_key(true), is_causal(false), f16_accumulation(false) {}
+
+    float scale;
+    bool transpose_key;
+    bool is_causal;
+    bool f16_accumulation;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// scaled_dot_product_attention_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct scaled_dot_product_attention_optional_params : optional_params {
+    scaled_dot_product_attention_optional_params() : optional_params(KernelType::SCALED_DOT_PRODUCT_ATTENTION) {}
+};
+
+class ScaledDotProductAttentionKernelRef : public KernelBaseOpenCL {
+public:
+    ScaledDotProductAttentionKernelRef() : KernelBaseOpenCL("scaled_dot_product_attention_ref") {}
+    virtual ~ScaledDotProductAttentionKernelRef() {}
+    virtual JitConstants GetJitConstants(const scaled_dot_product_attention_params& params) const;
+    virtual CommonDispatchData SetDefault(const scaled_dot_product_attention_params& params, const optional_params&) const;
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    KernelsPriority GetKernelsPriority(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+    bool Validate(const Params& params, const optional_params& options) const override;
+};
+}  // namespace kernel_selector
@@ -0,0 +1,18 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_kernel_selector.h"
+#include "scaled_dot_product_attention_kernel_ref.h"
+
+namespace kernel_selector {
+
+scaled_dot_product_attention_kernel_selector::scaled_dot_product_attention_kernel_selector() {
+    ATTACH_KERNEL(ScaledDotProductAttentionKernelRef);
+}
+
+KernelsData scaled_dot_product_attention_kernel_selector::GetBestKernels(const Params& params,
+                                                                         const optional_params& options) const {
+    return GetNaiveBestKernel(params, options, KernelType::SCALED_DOT_PRODUCT_ATTENTION);
+}
+}  // namespace kernel_selector
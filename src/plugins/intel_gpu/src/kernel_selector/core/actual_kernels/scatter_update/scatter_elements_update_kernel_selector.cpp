@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-scatter_elements_update_kernel_selector::scatter_elements_update_kernel_selector() { Attach<ScatterElementsUpdateKernelRef>(); }
+scatter_elements_update_kernel_selector::scatter_elements_update_kernel_selector() { ATTACH_KERNEL(ScatterElementsUpdateKernelRef); }
 
 KernelsData scatter_elements_update_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::SCATTER_ELEMENTS_UPDATE);
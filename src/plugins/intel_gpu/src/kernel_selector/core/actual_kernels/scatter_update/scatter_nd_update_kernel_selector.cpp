@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-scatter_nd_update_kernel_selector::scatter_nd_update_kernel_selector() { Attach<ScatterNDUpdateKernelRef>(); }
+scatter_nd_update_kernel_selector::scatter_nd_update_kernel_selector() { ATTACH_KERNEL(ScatterNDUpdateKernelRef); }
 
 KernelsData scatter_nd_update_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::SCATTER_ND_UPDATE);
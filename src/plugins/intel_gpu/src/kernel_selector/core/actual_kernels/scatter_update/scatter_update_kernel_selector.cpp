@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-scatter_update_kernel_selector::scatter_update_kernel_selector() { Attach<ScatterUpdateKernelRef>(); }
+scatter_update_kernel_selector::scatter_update_kernel_selector() { ATTACH_KERNEL(ScatterUpdateKernelRef); }
 
 KernelsData scatter_update_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::SCATTER_UPDATE);
@@ -6,7 +6,7 @@
 #include "select_kernel_ref.h"
 
 namespace kernel_selector {
-select_kernel_selector::select_kernel_selector() { Attach<SelectKernelRef>(); }
+select_kernel_selector::select_kernel_selector() { ATTACH_KERNEL(SelectKernelRef); }
 
 KernelsData select_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::SELECT);
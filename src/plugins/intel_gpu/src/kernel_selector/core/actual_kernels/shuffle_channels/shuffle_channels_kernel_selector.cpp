@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-shuffle_channels_kernel_selector::shuffle_channels_kernel_selector() { Attach<ShuffleChannelsKernelRef>(); }
+shuffle_channels_kernel_selector::shuffle_channels_kernel_selector() { ATTACH_KERNEL(ShuffleChannelsKernelRef); }
 
 KernelsData shuffle_channels_kernel_selector::GetBestKernels(const Params& params,
                                                              const optional_params& options) const {
@@ -7,7 +7,7 @@
 namespace kernel_selector {
 
 slice_kernel_selector::slice_kernel_selector() {
-    Attach<SliceKernelRef>();
+    ATTACH_KERNEL(SliceKernelRef);
 }
 
 KernelsData slice_kernel_selector::GetBestKernels(const Params &params,
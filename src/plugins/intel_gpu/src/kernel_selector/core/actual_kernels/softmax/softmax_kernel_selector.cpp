@@ -11,10 +11,10 @@
 namespace kernel_selector {
 
 softmax_kernel_selector::softmax_kernel_selector() {
-    Attach<SoftmaxKernelRef>();
-    Attach<SoftmaxKernel_bf>();
-    Attach<SoftmaxKernel_fb>();
-    Attach<SoftmaxKerneItemsClassOptimized>();
+    ATTACH_KERNEL(SoftmaxKernelRef);
+    ATTACH_KERNEL(SoftmaxKernel_bf);
+    ATTACH_KERNEL(SoftmaxKernel_fb);
+    ATTACH_KERNEL(SoftmaxKerneItemsClassOptimized);
 }
 
 KernelsData softmax_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -8,7 +8,7 @@
 namespace kernel_selector {
 
 space_to_batch_kernel_selector::space_to_batch_kernel_selector() {
-    Attach<SpaceToBatchKernelRef>();
+    ATTACH_KERNEL(SpaceToBatchKernelRef);
 }
 
 KernelsData space_to_batch_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-    space_to_depth_kernel_selector::space_to_depth_kernel_selector() { Attach<SpaceToDepthKernelRef>(); }
+    space_to_depth_kernel_selector::space_to_depth_kernel_selector() { ATTACH_KERNEL(SpaceToDepthKernelRef); }
 
     KernelsData space_to_depth_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
         return GetNaiveBestKernel(params, options, KernelType::SPACE_TO_DEPTH);
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-strided_slice_kernel_selector::strided_slice_kernel_selector() { Attach<StridedSliceKernelRef>(); }
+strided_slice_kernel_selector::strided_slice_kernel_selector() { ATTACH_KERNEL(StridedSliceKernelRef); }
 
 KernelsData strided_slice_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::STRIDED_SLICE);
@@ -7,7 +7,7 @@
 
 namespace kernel_selector {
 
-tile_kernel_selector::tile_kernel_selector() { Attach<TileKernelRef>(); }
+tile_kernel_selector::tile_kernel_selector() { ATTACH_KERNEL(TileKernelRef); }
 
 KernelsData tile_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::TILE);
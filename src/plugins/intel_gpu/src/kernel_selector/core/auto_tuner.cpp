@@ -93,14 +93,24 @@ TuningCache::TuningCache()
     cache.AddMember(v2Name, v2Obj, cache.GetAllocator());
 }
 
+std::string TuningCache::GetDeviceKey(const Params& params) {
+    auto computeUnitsStr = std::to_string(params.engineInfo.computeUnitsCount);
+    if (params.engineInfo.deviceId.empty())
+        return computeUnitsStr;
+    return computeUnitsStr + "_" + params.engineInfo.deviceId;
+}
+
 TuningCache::Entry TuningCache::LoadKernel(const Params& params, bool update) {
+    auto result = LoadKernel_v2(params, GetDeviceKey(params));
+    if (!std::get<0>(result).empty())
+        return result;
     return LoadKernel(params, params.engineInfo.computeUnitsCount, update);
 }
 
 TuningCache::Entry TuningCache::LoadKernel(const Params& params, uint32_t computeUnitsCount, bool update) {
     bool oldVersion = false;
     // Try to load from version 2
-    auto result = LoadKernel_v2(params, computeUnitsCount);
+    auto result = LoadKernel_v2(params, std::to_string(computeUnitsCount));
     // Try to load from version 1
     if (std::get<0>(result).empty() || update) {
         auto result_v1 = LoadKernel_v1(params, computeUnitsCount);
@@ -139,18 +149,17 @@ TuningCache::Entry TuningCache::LoadKernel_v1(const Params& params, uint32_t com
     return std::make_tuple(prog[0].GetString(), prog[1].GetInt());
 }
 
-TuningCache::Entry TuningCache::LoadKernel_v2(const Params& params, uint32_t computeUnitsCount) {
+TuningCache::Entry TuningCache::LoadKernel_v2(const Params& params, const std::string& deviceKey) {
     Entry result = std::make_tuple<std::string, int>("", 0);
 
     auto kTypeStr = toString(params.GetType());
     auto paramStr = params.to_cache_string_v2();
-    auto computeUnitsStr = std::to_string(computeUnitsCount);
 
     auto v2It = cache.FindMember(version2Marker);
     if (v2It == cache.MemberEnd())
         return result;
 
-    auto computeUnitsIt = v2It->value.FindMember(computeUnitsStr.c_str());
+    auto computeUnitsIt = v2It->value.FindMember(deviceKey.c_str());
     if (computeUnitsIt == v2It->value.MemberEnd())
         return result;
 
@@ -167,28 +176,35 @@ TuningCache::Entry TuningCache::LoadKernel_v2(const Params& params, uint32_t com
 }
 
 void TuningCache::StoreKernel(const Params& params, const std::string& implementationName, int tuneIndex) {
-    StoreKernel(params, params.engineInfo.computeUnitsCount, implementationName, tuneIndex);
+    StoreKernel_v2(params, GetDeviceKey(params), implementationName, tuneIndex);
+    RemoveKernel_v1(params, params.engineInfo.computeUnitsCount);
 }
 
 void TuningCache::StoreKernel(const Params& params, uint32_t computeUnitsCount, const std::string& implementationName, int tuneIndex) {
+    StoreKernel_v2(params, std::to_string(computeUnitsCount), implementationName, tuneIndex);
+
+    // Remove from old version if present
+    RemoveKernel_v1(params, computeUnitsCount);
+}
+
+void TuningCache::StoreKernel_v2(const Params& params, const std::string& deviceKey, const std::string& implementationName, int tuneIndex) {
     auto kTypeStr = toString(params.GetType());
     auto paramStr = params.to_cache_string_v2();
-    auto computeUnitsStr = std::to_string(computeUnitsCount);
     auto& v2Cache = cache[version2Marker];
 
-    if (!v2Cache.HasMember(computeUnitsStr.c_str())) {
-        auto newName = rapidjson::Value(computeUnitsStr.c_str(), cache.GetAllocator());
+    if (!v2Cache.HasMember(deviceKey.c_str())) {
+        auto newName = rapidjson::Value(deviceKey.c_str(), cache.GetAllocator());
         auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
         v2Cache.AddMember(newName, newObj, cache.GetAllocator());
     }
 
-    if (!v2Cache[computeUnitsStr.c_str()].HasMember(kTypeStr.c_str())) {
+    if (!v2Cache[deviceKey.c_str()].HasMember(kTypeStr.c_str())) {
         auto newName = rapidjson::Value(kTypeStr.c_str(), cache.GetAllocator());
         auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
-        v2Cache[computeUnitsStr.c_str()].AddMember(newName, newObj, cache.GetAllocator());
+        v2Cache[deviceKey.c_str()].AddMember(newName, newObj, cache.GetAllocator());
     }
 
-    auto& deviceCache = v2Cache[computeUnitsStr.c_str()][kTypeStr.c_str()];
+    auto& deviceCache = v2Cache[deviceKey.c_str()][kTypeStr.c_str()];
 
     auto paramName = rapidjson::Value(paramStr.c_str(), cache.GetAllocator());
     auto implDetails = rapidjson::Value(rapidjson::Type::kArrayType);
@@ -199,16 +215,14 @@ void TuningCache::StoreKernel(const Params& params, uint32_t computeUnitsCount,
 
     deviceCache.AddMember(paramName, implDetails, cache.GetAllocator());
 
-    // Remove from old version if present
-    RemoveKernel_v1(params, computeUnitsCount);
-
     needsSave = true;
 }
 
 void TuningCache::RemoveKernel(const Params& params) {
     bool removed = false;
     // Remove from version 2
-    removed |= RemoveKernel_v2(params, params.engineInfo.computeUnitsCount);
+    removed |= RemoveKernel_v2(params, GetDeviceKey(params));
+    removed |= RemoveKernel_v2(params, std::to_string(params.engineInfo.computeUnitsCount));
     // Remove from version 1
     removed |= RemoveKernel_v1(params, params.engineInfo.computeUnitsCount);
 
@@ -235,16 +249,15 @@ bool TuningCache::RemoveKernel_v1(const Params& params, uint32_t computeUnitsCou
     return true;
 }
 
-bool TuningCache::RemoveKernel_v2(const Params& params, uint32_t computeUnitsCount) {
+bool TuningCache::RemoveKernel_v2(const Params& params, const std::string& deviceKey) {
     auto kTypeStr = toString(params.GetType());
     auto paramStr = params.to_cache_string_v2();
-    auto computeUnitsStr = std::to_string(computeUnitsCount);
 
     auto v2It = cache.FindMember(version2Marker);
     if (v2It == cache.MemberEnd())
         return false;
 
-    auto computeUnitsIt = v2It->value.FindMember(computeUnitsStr.c_str());
+    auto computeUnitsIt = v2It->value.FindMember(deviceKey.c_str());
     if (computeUnitsIt == v2It->value.MemberEnd())
         return false;
 
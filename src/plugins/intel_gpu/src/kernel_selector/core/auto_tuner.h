@@ -33,10 +33,11 @@ public:
     TuningCache();
 
     // Returns cached kernel for specified params. If "update" moves it to newest version if found, which may require saving afterwards.
+    // The kernel tuned for the device of params is preferred, the kernels tuned for the same compute units count are used otherwise.
     Entry LoadKernel(const Params& params, bool update = true);
     // Overrides the compute units count in params.
     Entry LoadKernel(const Params& params, uint32_t computeUnitsCount, bool update = true);
-    // Stores kernel for specified params.
+    // Stores kernel for specified params, keyed by the device of params.
     void StoreKernel(const Params& params, const std::string& implementationName, int tuneIndex);
     // Overrides the compute units count in params.
     void StoreKernel(const Params& params, uint32_t computeUnitsCount, const std::string& implementationName, int tuneIndex);
@@ -49,10 +50,15 @@ public:
 
 private:
     Entry LoadKernel_v1(const Params& params, uint32_t computeUnitsCount);
-    Entry LoadKernel_v2(const Params& params, uint32_t computeUnitsCount);
+    Entry LoadKernel_v2(const Params& params, const std::string& deviceKey);
+
+    void StoreKernel_v2(const Params& params, const std::string& deviceKey, const std::string& implementationName, int tuneIndex);
 
     bool RemoveKernel_v1(const Params& params, uint32_t computeUnitsCount);
-    bool RemoveKernel_v2(const Params& params, uint32_t computeUnitsCount);
+    bool RemoveKernel_v2(const Params& params, const std::string& deviceKey);
+
+    // "<compute units count>_<device id>", or the compute units count only if the device id is unknown
+    static std::string GetDeviceKey(const Params& params);
 
 
     rapidjson::Document cache;
@@ -14,6 +14,8 @@
 // TILE_K_OFM   - must be equal to TILE_OFM * TILE_K and less or equal to 8;
 // DISPATCH_FSV - output coordinates for each sub-group are calculated from linearized coordinates
 // DISPATCH_BSV   as if they laid in bs_fs_bsv_fsv format, these macros describe fsv and bsv factors;
+// COMPRESSED_WEIGHTS - the int8 weights are decompressed with the scales (and the zero points) of the group of
+//                      DECOMPRESSION_GROUP_SIZE input features, the group size must be a multiple of TILE_IFM * SIMD;
 
 // Verify JIT parameters.
 #if SIMD != 8 && SIMD != 16
@@ -80,6 +82,41 @@
 #   define INPUT_ELEMENTS_COUNT INPUT0_ELEMENTS_COUNT
 #endif
 
+#if COMPRESSED_WEIGHTS
+#   if REALIGN_FP16_OFFSET
+#       error "fully_connected_gpu_bf_tiled.cl - REALIGN_FP16_OFFSET isn't supported with COMPRESSED_WEIGHTS"
+#   endif
+// Loads the decompression parameters of the group of the input feature k for the output features of the work-item.
+#   if DECOMPRESSION_ZP_TERM
+#       define LOAD_DECOMPRESSION_ZP(ofm, k) TO_ACCUMULATOR_TYPE(DECOMPRESSION_ZP_VAL(ofm, k))
+#   else
+#       define LOAD_DECOMPRESSION_ZP(ofm, k) ACCUMULATOR_VAL_ZERO
+#   endif
+#   define LOAD_DECOMPRESSION_PARAMS(k) do {                                                              \
+            __attribute__((opencl_unroll_hint))                                                            \
+            for (uint fi = 0; fi < TILE_OFM; ++fi) {                                                       \
+                const uint ofm = MIN(out_f + fi * SIMD + get_sub_group_local_id(), TILE_OUT_F_NUM - 1);    \
+                d_scale[fi] = TO_ACCUMULATOR_TYPE(DECOMPRESSION_SCALE_VAL(ofm, k));                        \
+                d_zp[fi] = LOAD_DECOMPRESSION_ZP(ofm, k);                                                  \
+            }                                                                                              \
+        } while (false)
+#   define DECOMPRESS_WEIGHTS() do {                                                                      \
+            __attribute__((opencl_unroll_hint))                                                            \
+            for (uint kii = 0; kii < TILE_K; ++kii) {                                                      \
+                __attribute__((opencl_unroll_hint))                                                        \
+                for (uint fi = 0; fi < TILE_OFM; ++fi) {                                                   \
+                    const uint w_idx = kii * TILE_OFM + fi;                                                \
+                    wei_dec[w_idx] = (TO_ACCUMULATOR_TYPE(((FILTER_TYPE*)(&wei))[w_idx]) - d_zp[fi]) * d_scale[fi]; \
+                }                                                                                          \
+            }                                                                                              \
+        } while (false)
+#   define WEIGHTS_VAL(idx) wei_dec[idx]
+#else
+#   define LOAD_DECOMPRESSION_PARAMS(k)
+#   define DECOMPRESS_WEIGHTS()
+#   define WEIGHTS_VAL(idx) ((FILTER_TYPE*)(&wei))[idx]
+#endif
+
 __attribute__((intel_reqd_sub_group_size(SIMD)))
 KERNEL(fc)(
     const __global INPUT0_TYPE* input,
@@ -88,6 +125,12 @@ KERNEL(fc)(
 #if BIAS_TERM
     , const __global BIAS_TYPE* biases
 #endif
+#if COMPRESSED_WEIGHTS
+    , const __global DECOMPRESSION_SCALE_TYPE* decompression_scale
+#if DECOMPRESSION_ZP_TERM
+    , const __global DECOMPRESSION_ZP_TYPE* decompression_zp
+#endif
+#endif
 #if HAS_FUSED_OPS_DECLS
     , FUSED_OPS_DECLS
 #endif
@@ -111,6 +154,11 @@ KERNEL(fc)(
     INPUT_VEC_TYPE       in_0[TILE_B] = { };
 
     FILTER_VEC_TYPE wei = 0;
+#if COMPRESSED_WEIGHTS
+    ACCUMULATOR_TYPE wei_dec[TILE_K_OFM];
+    ACCUMULATOR_TYPE d_scale[TILE_OFM];
+    ACCUMULATOR_TYPE d_zp[TILE_OFM];
+#endif
     uint input_offset = out_b * TILE_IN_B_PITCH + INPUT0_OFFSET;
     uint weights_offset = out_f * INPUT_ELEMENTS_COUNT;
 
@@ -135,6 +183,7 @@ KERNEL(fc)(
     uint iterations = MAIN_LOOP_ELEMENTS_COUNT / (TILE_IFM * SIMD);
     __attribute__((opencl_unroll_hint(1)))
     for (uint ni = 0; ni < iterations; ++ni) {
+        LOAD_DECOMPRESSION_PARAMS(ni * TILE_IFM * SIMD);
         // Load input.
         #define LOAD_IN_0(bi) do {                                  \
                 in_0[bi] = INPUT_BLOCK_READ(input, input_offset);   \
@@ -151,6 +200,7 @@ KERNEL(fc)(
         for (uint ki = 0; ki < (TILE_IFM * SIMD) / TILE_K; ++ki) {
             wei = FILTER_BLOCK_READ(weights, weights_offset);
             weights_offset += TILE_K_OFM * SIMD;
+            DECOMPRESS_WEIGHTS();
 
             __attribute__((opencl_unroll_hint))
             for (uint kii = 0; kii < TILE_K; ++kii) {
@@ -160,7 +210,7 @@ KERNEL(fc)(
                     for (uint bi = 0; bi < TILE_B; ++bi) {
                         const uint total_k = ki * TILE_K + kii;
                         INPUT0_TYPE in_val = intel_sub_group_shuffle(((INPUT0_TYPE*)(&in_0[bi]))[total_k / SIMD], total_k % SIMD);
-                        ((ACCUMULATOR_TYPE*)(&acc[bi]))[fi] += in_val * ((FILTER_TYPE*)(&wei))[kii * TILE_OFM + fi];
+                        ((ACCUMULATOR_TYPE*)(&acc[bi]))[fi] += in_val * WEIGHTS_VAL(kii * TILE_OFM + fi);
                     }
                 }
             }
@@ -172,6 +222,7 @@ KERNEL(fc)(
     // Handle leftovers in normal case without alignment correction.
     #define LEFTOVER_IFM               (MAIN_LOOP_ELEMENTS_COUNT % (TILE_IFM * SIMD))
     {
+        LOAD_DECOMPRESSION_PARAMS(iterations * TILE_IFM * SIMD);
         #define LOAD_IN_0(bi) do {                                  \
                 in_0[bi] = INPUT_BLOCK_READ(input, input_offset);   \
                 input_offset += TILE_IN_B_PITCH;                    \
@@ -184,6 +235,7 @@ KERNEL(fc)(
         for (uint ki = 0; ki < CEIL_DIV(LEFTOVER_IFM, TILE_K); ++ki) {
             wei = FILTER_BLOCK_READ(weights, weights_offset);
             weights_offset += TILE_K_OFM * SIMD;
+            DECOMPRESS_WEIGHTS();
 
             __attribute__((opencl_unroll_hint))
             for (uint kii = 0; kii < TILE_K; ++kii) {
@@ -194,7 +246,7 @@ KERNEL(fc)(
                         const uint total_k = ki * TILE_K + kii;
                         if (total_k < LEFTOVER_IFM) {
                             INPUT0_TYPE in_val = intel_sub_group_shuffle(((INPUT0_TYPE*)(&in_0[bi]))[total_k / SIMD], total_k % SIMD);
-                            ((ACCUMULATOR_TYPE*)(&acc[bi]))[fi] += in_val * ((FILTER_TYPE*)(&wei))[kii * TILE_OFM + fi];
+                            ((ACCUMULATOR_TYPE*)(&acc[bi]))[fi] += in_val * WEIGHTS_VAL(kii * TILE_OFM + fi);
                         }
                     }
                 }
@@ -314,3 +366,10 @@ KERNEL(fc)(
 #undef USE_BLOCK_WRITE
 
 #undef MAIN_LOOP_ELEMENTS_COUNT
+
+#undef LOAD_DECOMPRESSION_PARAMS
+#undef DECOMPRESS_WEIGHTS
+#undef WEIGHTS_VAL
+#ifdef LOAD_DECOMPRESSION_ZP
+#undef LOAD_DECOMPRESSION_ZP
+#endif
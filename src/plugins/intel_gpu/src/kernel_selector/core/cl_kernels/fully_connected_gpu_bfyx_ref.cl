@@ -6,6 +6,15 @@
 #include "include/batch_headers/fetch_data.cl"
 #include "include/batch_headers/fetch_weights.cl"
 
+#if COMPRESSED_WEIGHTS
+    #if DECOMPRESSION_ZP_TERM
+        #define DECOMPRESSED_WEIGHT(w, o, k) ((TO_ACCUMULATOR_TYPE(w) - TO_ACCUMULATOR_TYPE(DECOMPRESSION_ZP_VAL(o, k))) * \
+                                              TO_ACCUMULATOR_TYPE(DECOMPRESSION_SCALE_VAL(o, k)))
+    #else
+        #define DECOMPRESSED_WEIGHT(w, o, k) (TO_ACCUMULATOR_TYPE(w) * TO_ACCUMULATOR_TYPE(DECOMPRESSION_SCALE_VAL(o, k)))
+    #endif
+#endif
+
 KERNEL(fc)(
     const __global INPUT0_TYPE* input,
     __global OUTPUT_TYPE* output,
@@ -13,6 +22,12 @@ KERNEL(fc)(
 #if BIAS_TERM
     , const __global BIAS_TYPE* biases
 #endif
+#if COMPRESSED_WEIGHTS
+    , const __global DECOMPRESSION_SCALE_TYPE* decompression_scale
+#if DECOMPRESSION_ZP_TERM
+    , const __global DECOMPRESSION_ZP_TYPE* decompression_zp
+#endif
+#endif
 #if HAS_FUSED_OPS_DECLS
     , FUSED_OPS_DECLS
 #endif
@@ -32,7 +47,11 @@ KERNEL(fc)(
         {
             const uint input0_idx = GET_DATA_INDEX(INPUT0, b, ofm, y, x);
             const uint filter_idx = GET_FILTER_INDEX(FILTER, 0, oym, y, 0, 0);
+#if COMPRESSED_WEIGHTS
+            dotProd += TO_ACCUMULATOR_TYPE(input[input0_idx]) * DECOMPRESSED_WEIGHT(weights[filter_idx], oym, y);
+#else
             dotProd += (ACCUMULATOR_TYPE)(input[input0_idx] * weights[filter_idx]);
+#endif
         }
     }
 
@@ -52,7 +71,12 @@ KERNEL(fc)(
            {
                const uint input0_idx = GET_DATA_INDEX(INPUT0, b, ifm, y, x);
                const uint filter_idx = GET_FILTER_INDEX(FILTER, 0, ofm, ifm, y, x);
+#if COMPRESSED_WEIGHTS
+               const uint k = (ifm * INPUT0_SIZE_Y + y) * INPUT0_SIZE_X + x;
+               dotProd += TO_ACCUMULATOR_TYPE(input[input0_idx]) * DECOMPRESSED_WEIGHT(weights[filter_idx], ofm, k);
+#else
                dotProd += (ACCUMULATOR_TYPE)(input[input0_idx] * weights[filter_idx]);
+#endif
           }
        }
     }
@@ -76,3 +100,7 @@ KERNEL(fc)(
 #endif
 
 }
+
+#ifdef DECOMPRESSED_WEIGHT
+#undef DECOMPRESSED_WEIGHT
+#endif
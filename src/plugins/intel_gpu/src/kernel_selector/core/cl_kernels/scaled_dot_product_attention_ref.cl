@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/batch_headers/data_types.cl"
+#include "include/batch_headers/fetch_data.cl"
+
+// The scores of a query are normalized on the fly (online softmax): the running sum and the output accumulators
+// are rescaled whenever the maximum score grows, so the scores are never stored.
+KERNEL(scaled_dot_product_attention_ref)(const __global INPUT0_TYPE* query,
+                                         const __global INPUT1_TYPE* key,
+                                         const __global INPUT2_TYPE* value,
+#if HAS_ATTENTION_MASK
+                                         const __global INPUT3_TYPE* attention_mask,
+#endif
+                                         __global OUTPUT_TYPE* output)
+{
+    const uint l = get_global_id(0);
+    const uint h = get_global_id(1);
+    const uint b = get_global_id(2);
+
+    ACCUMULATOR_TYPE acc[OUTPUT_SIZE_X];
+    for (uint d = 0; d < OUTPUT_SIZE_X; ++d)
+        acc[d] = ACCUMULATOR_VAL_ZERO;
+    ACCUMULATOR_TYPE max_score = ACCUMULATOR_VAL_MIN;
+    ACCUMULATOR_TYPE sum = ACCUMULATOR_VAL_ZERO;
+
+#if IS_CAUSAL
+    // the last queries are aligned with the last keys
+    const uint keys_num = min((uint)KEYS_NUM, l + KEYS_NUM - INPUT0_SIZE_Y + 1);
+#else
+    const uint keys_num = KEYS_NUM;
+#endif
+
+    for (uint s = 0; s < keys_num; ++s) {
+        ACCUMULATOR_TYPE score = ACCUMULATOR_VAL_ZERO;
+        for (uint d = 0; d < HEAD_SIZE; ++d) {
+            score += TO_ACCUMULATOR_TYPE(query[INPUT0_GET_INDEX(b, h, l, d)]) * TO_ACCUMULATOR_TYPE(key[KEY_GET_INDEX(b, h, s, d)]);
+        }
+        score *= TO_ACCUMULATOR_TYPE(SCALE_FACTOR);
+#if HAS_ATTENTION_MASK
+        score += TO_ACCUMULATOR_TYPE(attention_mask[INPUT3_GET_INDEX(b % INPUT3_BATCH_NUM, h % INPUT3_FEATURE_NUM, l % INPUT3_SIZE_Y, s)]);
+#endif
+
+        const ACCUMULATOR_TYPE new_max = ACCUMULATOR_MAX_FUNC(max_score, score);
+        const ACCUMULATOR_TYPE correction = exp(max_score - new_max);
+        const ACCUMULATOR_TYPE p = exp(score - new_max);
+        sum = sum * correction + p;
+        for (uint d = 0; d < OUTPUT_SIZE_X; ++d) {
+            acc[d] = acc[d] * correction + p * TO_ACCUMULATOR_TYPE(value[INPUT2_GET_INDEX(b, h, s, d)]);
+        }
+        max_score = new_max;
+    }
+
+    for (uint d = 0; d < OUTPUT_SIZE_X; ++d) {
+        output[OUTPUT_GET_INDEX(b, h, l, d)] = TO_OUTPUT_TYPE(acc[d] / sum);
+    }
+}
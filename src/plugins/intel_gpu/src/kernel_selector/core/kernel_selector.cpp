@@ -14,7 +14,9 @@
 #include <tuple>
 #include <set>
 #include <iostream>
+#include <chrono>
 #include "intel_gpu/runtime/debug_configuration.hpp"
+#include <openvino/itt.hpp>
 
 // #define ENABLE_ENV
 // #define ENABLE_ENV_PRINT
@@ -65,6 +67,16 @@ kernel_selector_base::kernel_selector_base() {
 #endif
 }
 
+void kernel_selector_base::MarkSelected(const std::shared_ptr<KernelBase>& implementation) const {
+#if defined(SELECTIVE_BUILD_ANALYZER)
+    // the scopes of the implementations define kernel_selector_<Impl> macros the ATTACH_KERNEL checks
+    const auto name = implementationNames.find(implementation.get());
+    if (name != implementationNames.end()) {
+        openvino::itt::ScopedTask<SIMPLE_kernel_selector> task(openvino::itt::handle(name->second));
+    }
+#endif
+}
+
 KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
                                                      const optional_params& options,
                                                      KernelType kType) const {
@@ -94,6 +106,7 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
 #endif
                     kernelsData = kds;
                     kernelName = implementation->GetName();
+                    MarkSelected(implementation);
                     break;
 #ifdef ENABLE_ENV
                 }
@@ -124,6 +137,7 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
                                                         KernelType kType) const {
     KernelsData kernelsData;
     std::string kernelName;
+    std::shared_ptr<KernelBase> bestImplementation;
 
     auto allImplementations = GetAllImplementations(params, options, kType);
     auto kernel_params = static_cast<const base_params&>(params);
@@ -153,6 +167,7 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
                 if (kds.size() && kds[0].kernels.size()) {
                     kernelsData = kds;
                     kernelsData[0].kernelName = cachedkernelName;
+                    MarkSelected(implementation);
                     kernelsData[0].kernels[0].params.layerID = params.layerID;
                 }
                 break;
@@ -180,7 +195,21 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
     // Start on-line tuning
     assert(options.tuningParams.runner);
 
+    const auto tuningStart = std::chrono::steady_clock::now();
+    auto timeLimitExceeded = [&]() {
+        return options.tuningParams.timeLimitMs != 0 &&
+               std::chrono::steady_clock::now() - tuningStart >= std::chrono::milliseconds(options.tuningParams.timeLimitMs);
+    };
+
     for (const auto& implementation : allImplementations) {
+        // the implementations are sorted by priority, so the best ones are measured within the time limit
+        if (!kernelsData.empty() && timeLimitExceeded()) {
+            GPU_DEBUG_GET_INSTANCE(debug_config);
+            GPU_DEBUG_IF(debug_config->verbose >= 2) {
+                GPU_DEBUG_COUT << "layerID: " << params.layerID << " tuning time limit is exceeded" << std::endl;
+            }
+            break;
+        }
         const ParamsKey implKey = implementation->GetSupportedKey();
         if (implKey.TuningSupport()) {
             try {
@@ -192,6 +221,7 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
                     if (kernelsData.size() == 0 || kds[i].runTime < kernelsData[0].runTime) {
                         kernelsData = {kds[i]};
                         kernelName = implementation->GetName();
+                        bestImplementation = implementation;
                     }
                 }
             } catch (std::runtime_error& ex) {
@@ -221,6 +251,7 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
                         if (kernelsData.size() == 0 || kds[i].runTime < kernelsData[0].runTime) {
                             kernelsData = {kds[i]};
                             kernelName = implementation->GetName();
+                            bestImplementation = implementation;
                         }
                     }
                 } catch (std::runtime_error& ex) {
@@ -243,6 +274,7 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
                                 params,
                                 kernelName,
                                 kernelsData[0].autoTuneIndex);
+        MarkSelected(bestImplementation);
     } else {
         // Tuning failed, fall back to naive path
         return GetNaiveBestKernel(params, options, kType);
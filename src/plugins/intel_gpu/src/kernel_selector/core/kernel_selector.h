@@ -7,12 +7,15 @@
 #include "kernel_selector_common.h"
 #include "kernel_runner_interface.h"
 #include "auto_tuner.h"
+#include <openvino/cc/selective_build.h>
 #include <vector>
 #include <memory>
 #include <string>
 #include <map>
 
 namespace kernel_selector {
+OV_CC_DOMAINS(kernel_selector)
+
 class KernelBase;
 
 using KernelList = std::vector<std::shared_ptr<KernelBase>>;
@@ -31,6 +34,38 @@ protected:
         implementations.push_back(std::make_shared<T>());
     }
 
+/*
+ * ATTACH_KERNEL macro attaches the implementation if it's enabled by the selective build:
+ * only the implementations selected for the profiled models are compiled in.
+ */
+#if defined(SELECTIVE_BUILD_ANALYZER)
+#define ATTACH_KERNEL(Impl) Attach<Impl>(OV_PP_TOSTRING(Impl))
+
+    template <typename T>
+    inline void Attach(const char* typeName) {
+        Attach<T>();
+        implementationNames[implementations.back().get()] = typeName;
+    }
+
+    std::map<const KernelBase*, std::string> implementationNames;
+#elif defined(SELECTIVE_BUILD)
+#define ATTACH_KERNEL(Impl) \
+    OV_PP_EXPAND(OV_PP_CAT(AttachIfEnabled, OV_CC_SCOPE_IS_ENABLED(OV_PP_CAT3(kernel_selector, _, Impl)))<Impl>())
+
+    template <typename T>
+    inline void AttachIfEnabled0() {}
+
+    template <typename T>
+    inline void AttachIfEnabled1() {
+        Attach<T>();
+    }
+#else
+#define ATTACH_KERNEL(Impl) Attach<Impl>()
+#endif
+
+    // records the implementation chosen for the layer in the selective build statistics
+    void MarkSelected(const std::shared_ptr<KernelBase>& implementation) const;
+
     virtual KernelsData GetNaiveBestKernel(const Params& params,
                                            const optional_params& options,
                                            KernelType kType) const;
@@ -104,6 +104,9 @@ void ParamsKey::EnableInputWeightsType(WeightsType wt) {
         case WeightsType::INT8:
             key.inputWeightsType.val.int8 = 1;
             break;
+        case WeightsType::UINT8:
+            key.inputWeightsType.val.uint8 = 1;
+            break;
         case WeightsType::BINARY:
             key.inputWeightsType.val.binary = 1;
             break;
@@ -125,6 +128,9 @@ void ParamsKey::EnableOutputWeightsType(WeightsType wt) {
         case WeightsType::INT8:
             key.outputWeightsType.val.int8 = 1;
             break;
+        case WeightsType::UINT8:
+            key.outputWeightsType.val.uint8 = 1;
+            break;
         case WeightsType::BINARY:
             key.outputWeightsType.val.binary = 1;
             break;
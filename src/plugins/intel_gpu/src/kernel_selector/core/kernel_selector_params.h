@@ -137,6 +137,7 @@ public:
                         uint32_t deformable_mask_enabled : 1;
                     } conv;
                     struct fc_t {
+                        uint32_t compressed_weights : 1;
                     } fc;
                     struct softmax_t {
                         uint32_t dimX : 1;
@@ -295,6 +296,8 @@ public:
     void EnableBilinearInterpolationPad() { key.restrict.val.dedicated.conv.bilinear_interpolation_pad = 1; }
     void EnableDeformableMask() { key.restrict.val.dedicated.conv.deformable_mask_enabled = 1; }
 
+    void EnableWeightsCompression() { key.restrict.val.dedicated.fc.compressed_weights = 1; }
+
     void EnableQuantizePackedBinaryOutput() { key.restrict.val.dedicated.quantize.packed_binary_output = 1; }
     void EnableQuantizeScaleShiftOpt() { key.restrict.val.dedicated.quantize.scale_shift_opt = 1; }
 
@@ -607,8 +610,9 @@ struct TuningParams {
     TuningMode mode;
     std::string cacheFilePath;
     std::shared_ptr<KernelRunnerInterface> runner;
+    uint32_t timeLimitMs;  // the implementations not measured yet are skipped once it's exceeded, 0 means no limit
 
-    TuningParams() : mode(TuningMode::TUNING_DISABLED), cacheFilePath(""), runner(nullptr) {}
+    TuningParams() : mode(TuningMode::TUNING_DISABLED), cacheFilePath(""), runner(nullptr), timeLimitMs(0) {}
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,29 @@ namespace ov {
 namespace runtime {
 namespace intel_gpu {
 
+namespace {
+
+// Runs the task on the wait executor from the completion callback of the device event of the request,
+// so no host thread is blocked while the inference and the output copies are executed
+class CompletionExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    CompletionExecutor(InferRequest& request, const InferenceEngine::ITaskExecutor::Ptr& executor)
+        : _request(request), _executor(executor) {}
+
+    void run(InferenceEngine::Task task) override {
+        auto executor = _executor;
+        auto ev = _request.get_completion_event();
+        if (!ev || !ev->add_event_handler([executor, task](void*) { executor->run(task); }, nullptr))
+            executor->run(task);
+    }
+
+private:
+    InferRequest& _request;
+    InferenceEngine::ITaskExecutor::Ptr _executor;
+};
+
+}  // namespace
+
 AsyncInferRequest::AsyncInferRequest(const InferRequest::Ptr &inferRequest,
                                      const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                      const InferenceEngine::ITaskExecutor::Ptr& waitExecutor,
@@ -17,7 +40,23 @@ AsyncInferRequest::AsyncInferRequest(const InferRequest::Ptr &inferRequest,
     : AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor), _inferRequest(inferRequest), _waitExecutor(waitExecutor) {
     _pipeline = {};
 
-    if (!_inferRequest->use_external_queue()) {
+    if (!_inferRequest->use_external_queue() && !_inferRequest->use_profiling()) {
+        // the stream is released right after the enqueue, the outputs are collected once the device completes the request
+        _completionExecutor = std::make_shared<CompletionExecutor>(*_inferRequest, _waitExecutor);
+        _pipeline.push_back({taskExecutor,
+                    [this] {
+                        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::PreprocessingAndStartPipeline");
+                        _inferRequest->setup_stream_graph();
+                        _inferRequest->preprocess();
+                        _inferRequest->enqueue();
+        } });
+        _pipeline.push_back({_completionExecutor,
+                    [this] {
+                        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::WaitPipeline");
+                        _inferRequest->wait();
+        } });
+    } else if (!_inferRequest->use_external_queue()) {
+        // the perf statistics are collected from the network of the stream, so the next request must not start it before
         _pipeline.push_back({taskExecutor,
                     [this] {
                         OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::PreprocessingAndStartPipeline");
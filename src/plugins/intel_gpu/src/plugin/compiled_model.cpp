@@ -8,11 +8,13 @@
 #include "intel_gpu/plugin/infer_request.hpp"
 #include "intel_gpu/plugin/compiled_model.hpp"
 #include "intel_gpu/plugin/async_infer_request.hpp"
+#include "intel_gpu/plugin/network_serializer.hpp"
 
 #include <description_buffer.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include "threading/ie_cpu_streams_executor.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 
 #include <fstream>
@@ -29,19 +31,24 @@ namespace ov {
 namespace runtime {
 namespace intel_gpu {
 
-CompiledModel::CompiledModel(InferenceEngine::CNNNetwork &network, std::shared_ptr<InferenceEngine::RemoteContext> context, Config config) :
-    InferenceEngine::ExecutableNetworkThreadSafeDefault{[&]() -> InferenceEngine::ITaskExecutor::Ptr {
-        if (config.exclusiveAsyncRequests) {
-            //exclusiveAsyncRequests essentially disables the streams (and hence should be checked first) => aligned with the CPU behavior
-            return ExecutorManager::getInstance()->getExecutor("GPU");
-        }  else if (config.throughput_streams > 1) {
-            return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
-                IStreamsExecutor::Config{"Intel GPU plugin executor", config.throughput_streams});
-        } else {
-            return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
-                IStreamsExecutor::Config{"Intel GPU plugin executor", 1});
-        }
-    }()},
+namespace {
+InferenceEngine::ITaskExecutor::Ptr CreateTaskExecutor(const Config& config) {
+    if (config.exclusiveAsyncRequests) {
+        //exclusiveAsyncRequests essentially disables the streams (and hence should be checked first) => aligned with the CPU behavior
+        return ExecutorManager::getInstance()->getExecutor("GPU");
+    }  else if (config.throughput_streams > 1) {
+        return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"Intel GPU plugin executor", config.throughput_streams});
+    } else {
+        return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"Intel GPU plugin executor", 1});
+    }
+}
+}  // namespace
+
+CompiledModel::CompiledModel(InferenceEngine::CNNNetwork &network, std::shared_ptr<InferenceEngine::RemoteContext> context, Config config,
+                             std::shared_ptr<Program> program, const std::vector<InferenceEngine::gpu::ClContext::Ptr>& extra_contexts) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{CreateTaskExecutor(config)},
     m_config(config),
     m_taskExecutor{ _taskExecutor },
     m_waitExecutor(InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor({ "GPUWaitExecutor" })) {
@@ -53,27 +60,50 @@ CompiledModel::CompiledModel(InferenceEngine::CNNNetwork &network, std::shared_p
 
     m_context = casted_context;
 
-    auto graph_base = std::make_shared<Graph>(network, m_context, m_config, 0);
+    auto graph_base = program ? std::make_shared<Graph>(program, network.getName(), m_context, m_config, 0)
+                              : std::make_shared<Graph>(network, m_context, m_config, 0);
     for (uint16_t n = 0; n < m_config.throughput_streams; n++) {
         auto graph = n == 0 ? graph_base : std::make_shared<Graph>(graph_base, n);
         m_graphs.push_back(graph);
     }
+
+    if (!extra_contexts.empty() && program) {
+        IE_THROW() << "The precompiled program can't be used for the multi-device model";
+    }
+    for (const auto& extra_context : extra_contexts) {
+        DeviceGraphs device;
+        device.context = extra_context;
+        // the executors are separate, the request of the device only runs on the stream graphs of the same device
+        device.taskExecutor = m_config.exclusiveAsyncRequests ? m_taskExecutor : CreateTaskExecutor(m_config);
+        auto device_graph_base = std::make_shared<Graph>(network, extra_context, m_config, 0);
+        for (uint16_t n = 0; n < m_config.throughput_streams; n++) {
+            device.graphs.push_back(n == 0 ? device_graph_base : std::make_shared<Graph>(device_graph_base, n));
+        }
+        m_extraDevices.push_back(std::move(device));
+    }
+}
+
+size_t CompiledModel::NextRequestDevice() {
+    return m_requestsCounter++ % (m_extraDevices.size() + 1);
 }
 
 IInferRequestInternal::Ptr CompiledModel::CreateInferRequestImpl(InputsDataMap networkInputs,
                                                                  OutputsDataMap networkOutputs) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "CompiledModel::CreateInferRequestImpl");
     auto ptr = std::make_shared<InferRequest>(networkInputs, networkOutputs,
-                                              std::static_pointer_cast<CompiledModel>(shared_from_this()));
+                                              std::static_pointer_cast<CompiledModel>(shared_from_this()),
+                                              NextRequestDevice());
     if (m_config.throughput_streams > 1) {
         ptr->EnableStreams();
     }
     if (m_config.useProfiling)
         ptr->EnableProfiling();
+    else if (m_config.profiling_sampling_rate > 0)
+        ptr->EnableProfilingSampling(m_config.profiling_sampling_rate);
     if (m_graphs.front()->use_external_queue()) {
         ptr->enable_external_queue();
     }
-    ptr->SetGraph(m_graphs.front());
+    ptr->SetGraph(ptr->GetStreamGraphs().front());
 
     return ptr;
 }
@@ -82,17 +112,20 @@ IInferRequestInternal::Ptr CompiledModel::CreateInferRequestImpl(const std::vect
                                                                  const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "CompiledModel::CreateInferRequestImpl");
     auto ptr = std::make_shared<InferRequest>(inputs, outputs,
-                                              std::static_pointer_cast<CompiledModel>(shared_from_this()));
+                                              std::static_pointer_cast<CompiledModel>(shared_from_this()),
+                                              NextRequestDevice());
     if (m_config.throughput_streams > 1) {
         ptr->EnableStreams();
     }
     if (m_config.useProfiling)
         ptr->EnableProfiling();
+    else if (m_config.profiling_sampling_rate > 0)
+        ptr->EnableProfilingSampling(m_config.profiling_sampling_rate);
 
     if (m_graphs.front()->use_external_queue()) {
         ptr->enable_external_queue();
     }
-    ptr->SetGraph(m_graphs.front());
+    ptr->SetGraph(ptr->GetStreamGraphs().front());
 
     return ptr;
 }
@@ -119,12 +152,23 @@ IInferRequestInternal::Ptr CompiledModel::CreateInferRequest() {
     if (!internalRequest)
         internalRequest = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     internalRequest->setPointerToExecutableNetworkInternal(shared_from_this());
-    return std::make_shared<AsyncInferRequest>(std::static_pointer_cast<InferRequest>(internalRequest),
-                                               m_taskExecutor,
+    auto request = std::static_pointer_cast<InferRequest>(internalRequest);
+    const auto device = request->GetDevice();
+    return std::make_shared<AsyncInferRequest>(request,
+                                               device == 0 ? m_taskExecutor : m_extraDevices[device - 1].taskExecutor,
                                                m_waitExecutor,
                                                _callbackExecutor);
 }
 
+void CompiledModel::Export(std::ostream& networkModel) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "CompiledModel::Export");
+    if (!m_network.getFunction())
+        IE_THROW(NetworkNotLoaded);
+
+    NetworkSerializer serializer(networkModel);
+    serializer << m_network;
+}
+
 std::shared_ptr<ngraph::Function> CompiledModel::GetExecGraphInfo() {
     if (m_graphs.empty())
         IE_THROW(NetworkNotLoaded);
@@ -151,6 +195,7 @@ InferenceEngine::Parameter CompiledModel::GetMetric(const std::string &name) con
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(GPU_KERNELS_BUILD_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -158,10 +203,22 @@ InferenceEngine::Parameter CompiledModel::GetMetric(const std::string &name) con
             configKeys.push_back(value.first);
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
-        unsigned int nr = m_config.throughput_streams;
+        // the streams of every device of the multi-device model are fed by the separate requests
+        unsigned int nr = m_config.throughput_streams * static_cast<unsigned int>(m_extraDevices.size() + 1);
         if (m_config.perfHintsConfig.ovPerfHint != CONFIG_VALUE(LATENCY))
             nr *= 2;
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, nr);
+    } else if (name == METRIC_KEY(GPU_KERNELS_BUILD_STATISTICS)) {
+        IE_ASSERT(!m_graphs.empty());
+        // the streams graphs share the programs, the networks of the dynamic batch have separate ones
+        std::map<std::string, uint64_t> statistics;
+        const auto networks = m_graphs[0]->GetNetworksCount();
+        for (size_t i = 0; i < networks; i++) {
+            const auto prefix = networks > 1 ? "NETWORK_" + std::to_string(i) + "_" : std::string();
+            for (const auto& value : m_graphs[0]->GetNetwork(i)->get_program()->get_kernels_build_statistics())
+                statistics[prefix + value.first] = value.second;
+        }
+        IE_SET_METRIC_RETURN(GPU_KERNELS_BUILD_STATISTICS, statistics);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
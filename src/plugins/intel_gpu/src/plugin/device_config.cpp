@@ -12,6 +12,7 @@
 #include "intel_gpu/plugin/device_config.hpp"
 #include "intel_gpu/plugin/itt.hpp"
 #include <ie_system_conf.h>
+#include <limits>
 #include <thread>
 
 #ifdef _WIN32
@@ -219,6 +220,13 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
             }
         } else if (key.compare(PluginConfigParams::KEY_TUNING_FILE) == 0) {
             tuningConfig.cache_file_path = val;
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_TUNING_TIME_LIMIT) == 0) {
+            try {
+                tuningConfig.time_limit_ms = static_cast<uint32_t>(std::stoul(val));
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_GPU_TUNING_TIME_LIMIT << ": " << val
+                           << "\nSpecify the time limit in milliseconds as an unsigned integer.";
+            }
         } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_MEM_POOL) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 memory_pool_on = true;
@@ -227,6 +235,45 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
             } else {
                 IE_THROW(NotFound) << "Unsupported memory pool flag value: " << val;
             }
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_MEMORY_CACHE_CAPACITY) == 0) {
+            try {
+                memory_cache_capacity = std::stoull(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_GPU_MEMORY_CACHE_CAPACITY << ": " << val
+                           << "\nSpecify the capacity in bytes as an unsigned integer.";
+            }
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_SHARED_ACTIVATIONS) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                shared_activations = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                shared_activations = false;
+            } else {
+                IE_THROW(NotFound) << "Unsupported shared activations flag value: " << val;
+            }
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_PROFILING_SAMPLING_RATE) == 0) {
+            try {
+                profiling_sampling_rate = static_cast<uint32_t>(std::stoul(val));
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_GPU_PROFILING_SAMPLING_RATE << ": " << val
+                           << "\nSpecify the sampling rate of the profiled inferences as an unsigned integer.";
+            }
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_SHAPES_CACHE_SIZE) == 0) {
+            try {
+                shapes_cache_size = static_cast<size_t>(std::stoull(val));
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_GPU_SHAPES_CACHE_SIZE << ": " << val
+                           << "\nSpecify the number of the programs as an unsigned integer.";
+            }
+        } else if (key.compare(PluginConfigInternalParams::KEY_GPU_QUEUES_NUM) == 0) {
+            try {
+                int val_i = std::stoi(val);
+                if (val_i < 1 || val_i > std::numeric_limits<uint16_t>::max())
+                    throw std::invalid_argument("out of range");
+                queues_num = static_cast<uint16_t>(val_i);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_GPU_QUEUES_NUM << ": " << val
+                           << "\nSpecify the number of the queues as a positive integer.";
+            }
         } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR) == 0) {
             if (!val.empty()) {
                 graph_dumps_dir = val;
@@ -351,6 +398,14 @@ void Config::adjustKeyMapValues() {
         key_config_map[CLDNNConfigParams::KEY_CLDNN_MEM_POOL] = PluginConfigParams::YES;
     else
         key_config_map[CLDNNConfigParams::KEY_CLDNN_MEM_POOL] = PluginConfigParams::NO;
+    key_config_map[PluginConfigInternalParams::KEY_GPU_MEMORY_CACHE_CAPACITY] = std::to_string(memory_cache_capacity);
+    if (shared_activations)
+        key_config_map[PluginConfigInternalParams::KEY_GPU_SHARED_ACTIVATIONS] = PluginConfigParams::YES;
+    else
+        key_config_map[PluginConfigInternalParams::KEY_GPU_SHARED_ACTIVATIONS] = PluginConfigParams::NO;
+    key_config_map[PluginConfigInternalParams::KEY_GPU_SHAPES_CACHE_SIZE] = std::to_string(shapes_cache_size);
+    key_config_map[PluginConfigInternalParams::KEY_GPU_PROFILING_SAMPLING_RATE] = std::to_string(profiling_sampling_rate);
+    key_config_map[PluginConfigInternalParams::KEY_GPU_QUEUES_NUM] = std::to_string(queues_num);
 
     if (enableDynamicBatch)
         key_config_map[PluginConfigParams::KEY_DYN_BATCH_ENABLED] = PluginConfigParams::YES;
@@ -425,6 +480,7 @@ void Config::adjustKeyMapValues() {
         }
         key_config_map[PluginConfigParams::KEY_TUNING_MODE] = tm;
         key_config_map[PluginConfigParams::KEY_TUNING_FILE] = tuningConfig.cache_file_path;
+        key_config_map[PluginConfigInternalParams::KEY_GPU_TUNING_TIME_LIMIT] = std::to_string(tuningConfig.time_limit_ms);
     }
 
     key_config_map[CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR] = graph_dumps_dir;
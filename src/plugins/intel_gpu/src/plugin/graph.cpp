@@ -52,6 +52,16 @@ Graph::Graph(InferenceEngine::CNNNetwork& network, gpu::ClContext::Ptr context,
     Build();
 }
 
+Graph::Graph(std::shared_ptr<Program> program, const std::string& name, gpu::ClContext::Ptr context, Config config, uint16_t stream_id)
+    : m_context(context)
+    , m_program(program)
+    , m_networkName(name)
+    , m_config(config)
+    , m_stream_id(stream_id)
+    , m_state(0) {
+    Build();
+}
+
 Graph::Graph(std::shared_ptr<Graph> graph, uint16_t stream_id)
         : m_context(graph->m_context)
         , m_program(graph->m_program)
@@ -472,10 +482,18 @@ std::shared_ptr<ngraph::Function> Graph::GetExecGraphInfo() {
 
 
 void Graph::UpdatePerfStatistics() {
+    if (GetNetworksCount() == 0) {
+        return;
+    }
+    UpdatePerfStatistics(GetNetwork()->get_executed_primitives());
+}
+
+void Graph::UpdatePerfStatistics(std::map<cldnn::primitive_id, cldnn::event::ptr> executedPrimitives) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Graph::UpdatePerfStatistics");
     if (GetNetworksCount() == 0) {
         return;
     }
+    std::lock_guard<std::mutex> lock(m_perf_mutex);
 
     // Collect timings
     auto collectTimings = [](cldnn::instrumentation::profiling_info& cldnnInfo, PerfCounter& pc) {
@@ -496,9 +514,6 @@ void Graph::UpdatePerfStatistics() {
         }
     };
 
-    std::map<cldnn::primitive_id, cldnn::event::ptr> executedPrimitives = GetNetwork()->get_executed_primitives();
-    auto allPrimitives = GetNetwork()->get_all_primitives();
-
     // Get profiling info for all layers
     for (auto &profiledID : profilingIDs) {
         auto pcIter = perfMap.find(profiledID);
@@ -545,6 +560,7 @@ bool Graph::IsLoaded() const {
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> Graph::GetPerformanceCounts() const {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Graph::GetPerformanceCounts");
+    std::lock_guard<std::mutex> lock(m_perf_mutex);
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> result;
     bool combinePrimByIRLayers = false;
     unsigned i = 0;
@@ -172,6 +172,23 @@ bool same_host_mem(cldnn::memory::ptr memPtr, uint8_t* hostPtr) {
     return bufferMem == hostPtr;
 }
 
+// The integrated devices access the host memory directly when it's aligned on the page and its size on the cache line,
+// so such user blob is wrapped instead of copied. Returns nullptr when the memory can't be shared.
+cldnn::memory::ptr share_host_mem(cldnn::engine& engine, const cldnn::layout& layout, const uint8_t* hostPtr, size_t hostSize) {
+    constexpr size_t page_size = 4096;
+    constexpr size_t cache_line_size = 64;
+    if (engine.get_device_info().dev_type != cldnn::device_type::integrated_gpu)
+        return nullptr;
+    const auto bytes = layout.bytes_count();
+    if (reinterpret_cast<uintptr_t>(hostPtr) % page_size != 0 || bytes != hostSize || bytes % cache_line_size != 0)
+        return nullptr;
+    try {
+        return engine.share_host_ptr(layout, const_cast<uint8_t*>(hostPtr));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 }  // namespace
 
 namespace ov {
@@ -388,20 +405,19 @@ void InferRequest::SetBlobs(const std::string& name, const std::vector<Blob::Ptr
         IE_THROW(NotImplemented) << cannot_set_compound;
     }
 
-    bool is_buffer = std::all_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
-        return blob->is<gpu::ClBufferBlob>();
-    });
     bool is_surface = std::all_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
         return blob->is<gpu::ClImage2DBlob>();
     });
-    bool is_remote = is_buffer || is_surface;
+    bool is_remote = std::any_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
+        return blob->is<gpu::ClBlob>();
+    });
 
-    bool is_host = std::all_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
-        return blob->is<InferenceEngine::MemoryBlob>();
+    // the host and the buffer blobs may be mixed, they are gathered into the single device input on enqueue
+    bool is_gathered = std::all_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
+        return blob->is<InferenceEngine::MemoryBlob>() && !blob->is<gpu::ClImage2DBlob>();
     });
-    is_host &= !is_remote;
 
-    if (!is_host && !is_remote) {
+    if (!is_surface && !is_gathered) {
         IE_THROW() << "Incorrect input blobs. All blobs must be of the same type";
     }
 
@@ -413,11 +429,10 @@ void InferRequest::SetBlobs(const std::string& name, const std::vector<Blob::Ptr
         IE_THROW() << "SetBlobs method doesn't support outputs";
     }
 
-    if (is_buffer) {
-        IE_THROW(NotImplemented) << "SetBlobs method doesn't support buffer blobs";
-    }
-
     const TensorDesc& desc = foundInput->getTensorDesc();
+    if (is_gathered && (desc.getPrecision() == Precision::I16 || desc.getPrecision() == Precision::U16)) {
+        IE_THROW(NotImplemented) << "SetBlobs method doesn't support " << desc.getPrecision() << " input precision";
+    }
 
     size_t dataBinSize = blobs.front()->size() * blobs.front()->element_size() * blobs.size();
     size_t netReqBinSize = std::accumulate(desc.getDims().begin(), desc.getDims().end(),
@@ -440,14 +455,17 @@ void InferRequest::SetBlobs(const std::string& name, const std::vector<Blob::Ptr
 
     if (is_remote) {
         for (auto& blob : blobs) {
-            auto impl = getBlobImpl(blob->as<gpu::ClBlob>());
+            auto remote_ptr = blob->as<gpu::ClBlob>();
+            if (!remote_ptr)
+                continue;
+            auto impl = getBlobImpl(remote_ptr);
             if (!impl->is_allocated()) {
                 impl->allocate();
             }
         }
     }
 
-    inputTensorsMap.insert({ name, blobs });
+    inputTensorsMap[name] = blobs;
 }
 
 void InferRequest::checkBlobs() {
@@ -568,18 +586,18 @@ void InferRequest::SetBatch(int new_batch) {
 }
 
 InferRequest::InferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs,
-                                     const CompiledModel::Ptr& execNetwork)
+                                     const CompiledModel::Ptr& execNetwork, size_t device)
         : IInferRequestInternal(networkInputs, networkOutputs) {
     IE_ASSERT(nullptr != execNetwork);
-    streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(execNetwork->m_taskExecutor.get());
+    bind_to_device(execNetwork, device);
 }
 
 InferRequest::InferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                      const std::vector<std::shared_ptr<const ov::Node>>& outputs,
-                                     const CompiledModel::Ptr& execNetwork)
+                                     const CompiledModel::Ptr& execNetwork, size_t device)
         : IInferRequestInternal(inputs, outputs) {
     IE_ASSERT(nullptr != execNetwork);
-    streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(execNetwork->m_taskExecutor.get());
+    bind_to_device(execNetwork, device);
 }
 
 // ----------------------------------------------------------------------------------------- //
@@ -632,6 +650,8 @@ void InferRequest::enqueue() {
                 _inputs[new_name] = blobs[i];
                 _deviceInputs[new_name] = blobs[i];
             }
+        } else {
+            gather_input(inputTensor.first, blobs, dependencies);
         }
     }
 
@@ -672,7 +692,23 @@ void InferRequest::enqueue() {
     }
 
     internal_outputs.clear();
-    internal_outputs = m_graph->GetNetwork()->execute(dependencies);
+    auto network = m_graph->GetNetwork();
+    const bool sampled = m_profilingSamplingRate > 0 && m_inferCount++ % m_profilingSamplingRate == 0;
+    if (sampled) {
+        network->set_profiling_events(true);
+        try {
+            internal_outputs = network->execute(dependencies);
+        } catch (...) {
+            network->set_profiling_events(false);
+            throw;
+        }
+        network->set_profiling_events(false);
+        // the events are taken now, the next inference on the graph is allowed to start before this one is waited for
+        m_sampledEvents = network->get_executed_primitives();
+    } else {
+        internal_outputs = network->execute(dependencies);
+    }
+    enqueue_output_copies();
 
     // If dump layers path is set, only runs first inference.
     GPU_DEBUG_GET_INSTANCE(debug_config);
@@ -697,8 +733,13 @@ void InferRequest::wait() {
         IE_THROW() << "Inference was not started!\n";
     }
 
+    for (auto& ev : output_copy_events)
+        ev->wait();
+
     // wait for completion & collect outputs as requested by the model
     for (auto& no : _networkOutputs) {
+        if (copied_outputs.count(no.first) > 0)
+            continue;
         Blob::Ptr bptr = _outputs[no.first];
         std::string outputID = outputsMap.at(no.first);
         auto outputMemory = internal_outputs.at(outputID).get_memory();
@@ -721,6 +762,9 @@ void InferRequest::wait() {
     // finally collect profiling info
     if (m_useProfiling) {
         m_graph->UpdatePerfStatistics();
+    } else if (!m_sampledEvents.empty()) {
+        m_graph->UpdatePerfStatistics(std::move(m_sampledEvents));
+        m_sampledEvents.clear();
     }
 }
 
@@ -752,6 +796,47 @@ void InferRequest::enqueue_dynamic() {
     }
 }
 
+// The plain host output blobs with the same layout as the output memory are read back by the non-blocking copies
+// enqueued right after the network, so the readback doesn't wait for the host thread, which waits for the completion.
+// The in-order queue keeps the copies after the kernels writing the outputs.
+void InferRequest::enqueue_output_copies() {
+    copied_outputs.clear();
+    output_copy_events.clear();
+    if (m_graph->GetEngine()->configuration().queue_type != cldnn::queue_types::in_order)
+        return;
+
+    auto& stream = m_graph->GetNetwork()->get_stream();
+    for (auto& no : _networkOutputs) {
+        Blob::Ptr bptr = _outputs[no.first];
+        if (bptr->is<gpu::ClBlob>())
+            continue;
+
+        auto outputMemory = internal_outputs.at(outputsMap.at(no.first)).get_memory_no_wait();
+        const auto& layout = outputMemory->get_layout();
+        {
+            auto dst_lock = bptr->cbuffer();
+            if (same_host_mem(outputMemory, dst_lock.as<uint8_t*>()))
+                continue;
+        }
+        if (layout.data_padding || layout.format.is_image() || bptr->byteSize() != outputMemory->size() ||
+            bptr->element_size() != cldnn::data_type_traits::size_of(layout.data_type))
+            continue;
+
+        auto dst_lock = bptr->buffer();
+        output_copy_events.push_back(outputMemory->copy_to(stream, dst_lock.as<uint8_t*>(), false));
+        copied_outputs.insert(no.first);
+    }
+}
+
+cldnn::event::ptr InferRequest::get_completion_event() {
+    if (m_graph == nullptr || m_graph->GetMaxDynamicBatchSize() > 1)
+        return nullptr;
+    auto& stream = m_graph->GetNetwork()->get_stream();
+    auto ev = stream.enqueue_marker({}, true);
+    stream.flush();
+    return ev;
+}
+
 void InferRequest::wait_dynamic() {
     if (internal_outputs_dynamic.empty()) {
         IE_THROW() << "Inference was not started!\n";
@@ -776,9 +861,17 @@ void InferRequest::wait_dynamic() {
 // ----------------------------------------------------------------------------------------- //
 // ---------------------------- internal utils --------- ----------------------------------- //
 // ----------------------------------------------------------------------------------------- //
+void InferRequest::bind_to_device(const CompiledModel::Ptr& execNetwork, size_t device) {
+    IE_ASSERT(device <= execNetwork->m_extraDevices.size());
+    m_device = device;
+    const auto& taskExecutor = device == 0 ? execNetwork->m_taskExecutor : execNetwork->m_extraDevices[device - 1].taskExecutor;
+    m_streamGraphs = device == 0 ? &execNetwork->m_graphs : &execNetwork->m_extraDevices[device - 1].graphs;
+    streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(taskExecutor.get());
+}
+
 void InferRequest::setup_stream_graph() {
     int streamID = 0;
-    auto& streamGraphs = static_cast<CompiledModel*>(_exeNetwork.get())->m_graphs;
+    auto& streamGraphs = *m_streamGraphs;
     if (nullptr != streamExecutor) {
         streamID = streamExecutor->GetStreamId();
         int numGraphs = streamGraphs.size();
@@ -1053,7 +1146,7 @@ void InferRequest::InferImpl() {
 
 std::map<std::string, InferenceEngineProfileInfo> InferRequest::GetPerformanceCounts() const {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::GetPerformanceCounts");
-    if (!m_useProfiling) {
+    if (!m_useProfiling && m_profilingSamplingRate == 0) {
         IE_THROW() << "Performance counters were not enabled";
     } else {
         return m_graph->GetPerformanceCounts();
@@ -1114,8 +1207,13 @@ void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr
                     auto src_lock = inputBlob->cbuffer();
                     auto src_ptr = src_lock.as<uint8_t*>();
                     if (!same_host_mem(inputMem, src_ptr)) {
-                        auto ev = inputMem->copy_from(stream, src_ptr);
-                        dependencies.push_back(ev);
+                        auto userMem = share_host_mem(_nw_ptr->get_engine(), inputMem->get_layout(), src_ptr, inputBlob->byteSize());
+                        if (userMem) {
+                            inputMem = userMem;
+                        } else {
+                            auto ev = inputMem->copy_from(stream, src_ptr);
+                            dependencies.push_back(ev);
+                        }
                     }
                 }
             }
@@ -1127,6 +1225,42 @@ void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr
     }
 }
 
+void InferRequest::gather_input(const cldnn::primitive_id& inputName, const std::vector<Blob::Ptr>& blobs,
+                                std::vector<cldnn::event::ptr>& dependencies) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::gather_input");
+    auto inputLayoutItr = m_graph->GetInputLayouts().find(inputName);
+    if (inputLayoutItr == m_graph->GetInputLayouts().end()) {
+        IE_THROW() << "Input name mismatch.";
+    }
+    auto impl = getBlobImpl(_deviceInputs.at(inputName)->as<gpu::ClBlob>());
+    if (!impl->is_allocated()) {
+        IE_THROW() << str_input_not_allocated;
+    }
+    auto inputMem = impl->getMemory();
+    if (inputLayoutItr->second.format != inputMem->get_layout().format) {
+        inputMem = m_graph->GetNetwork()->get_engine().reinterpret_buffer(*inputMem, inputLayoutItr->second);
+    }
+
+    // every blob is copied to its own range of the device input by the stream, so the copies of the whole batch are
+    // enqueued at once and no blob data is touched by the host; the blobs are kept alive by inputTensorsMap
+    auto& stream = m_graph->GetNetwork()->get_stream();
+    size_t offset = 0;
+    for (const auto& blob : blobs) {
+        const size_t size = blob->byteSize();
+        if (auto remote_ptr = blob->as<gpu::ClBlob>()) {
+            dependencies.push_back(inputMem->copy_from(stream, *getBlobImpl(remote_ptr)->getMemory(), offset, size));
+        } else {
+            auto src_lock = blob->cbuffer();
+            auto src_ptr = src_lock.as<uint8_t*>();
+            // the slices of the request's own input blob are in place already
+            if (!same_host_mem(inputMem, src_ptr - offset))
+                dependencies.push_back(inputMem->copy_from(stream, src_ptr, offset, size));
+        }
+        offset += size;
+    }
+    m_graph->GetNetwork()->set_input_data("parameter:" + inputName, inputMem);
+}
+
 void InferRequest::prepare_output(const cldnn::primitive_id& outputName, Blob::Ptr& outputBlob) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::prepare_output");
     Blob::Ptr reqBlob = _deviceOutputs.at(outputName);
@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "intel_gpu/plugin/network_serializer.hpp"
+
+#include <sstream>
+#include <unordered_map>
+#include <openvino/pass/serialize.hpp>
+#include <pugixml.hpp>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace runtime {
+namespace intel_gpu {
+
+namespace {
+
+std::string layout_to_string(Layout layout) {
+    std::stringstream ss;
+    ss << layout;
+    return ss.str();
+}
+
+Layout layout_from_string(const std::string& name) {
+    static const std::unordered_map<std::string, Layout> layouts = {
+        { "ANY", Layout::ANY },
+        { "NCHW", Layout::NCHW },
+        { "NHWC", Layout::NHWC },
+        { "NCDHW", Layout::NCDHW },
+        { "NDHWC", Layout::NDHWC },
+        { "OIHW", Layout::OIHW },
+        { "C", Layout::C },
+        { "CHW", Layout::CHW },
+        { "HWC", Layout::HWC },
+        { "HW", Layout::HW },
+        { "NC", Layout::NC },
+        { "CN", Layout::CN },
+        { "BLOCKED", Layout::BLOCKED }
+    };
+    auto it = layouts.find(name);
+    if (it == layouts.end())
+        IE_THROW(NetworkNotRead) << "Unknown layout with name '" << name << "'";
+    return it->second;
+}
+
+template <typename Map>
+void append_info(pugi::xml_node node, const char* name, const Map& info) {
+    for (const auto& data : info) {
+        auto child = node.append_child(name);
+        child.append_attribute("name").set_value(data.first.c_str());
+        child.append_attribute("precision").set_value(data.second->getPrecision().name());
+        child.append_attribute("layout").set_value(layout_to_string(data.second->getLayout()).c_str());
+    }
+}
+
+template <typename Map>
+void read_info(pugi::xml_object_range<pugi::xml_named_node_iterator>&& nodes, Map&& info) {
+    for (auto node : nodes) {
+        auto name = node.attribute("name");
+        auto precision = node.attribute("precision");
+        auto layout = node.attribute("layout");
+        if (!name || !precision || !layout)
+            IE_THROW(NetworkNotRead) << "The inputs/outputs information is invalid.";
+
+        auto it = info.find(name.value());
+        if (it == info.end())
+            IE_THROW(NetworkNotRead) << "The input/output with name '" << name.value() << "' not found";
+
+        it->second->setPrecision(Precision::FromStr(precision.value()));
+        it->second->setLayout(layout_from_string(layout.value()));
+    }
+}
+
+}  // namespace
+
+NetworkSerializer::NetworkSerializer(std::ostream& ostream) : m_ostream(ostream) {}
+
+void NetworkSerializer::operator<<(const CNNNetwork& network) {
+    auto write_inputs_outputs = [&](std::ostream& stream) {
+        pugi::xml_document doc;
+        auto root = doc.append_child("cnndata");
+        append_info(root.append_child("inputs"), "in", network.getInputsInfo());
+        append_info(root.append_child("outputs"), "out", network.getOutputsInfo());
+        doc.save(stream);
+    };
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    ov::pass::StreamSerialize serializer(m_ostream, {}, write_inputs_outputs);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+    serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+}
+
+NetworkDeserializer::NetworkDeserializer(std::istream& istream, network_builder builder)
+    : m_istream(istream), m_builder(std::move(builder)) {}
+
+void NetworkDeserializer::operator>>(CNNNetwork& network) {
+    ov::pass::StreamSerialize::DataHeader hdr = {};
+    m_istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
+
+    std::string inputs_outputs(hdr.custom_data_size, '\0');
+    m_istream.seekg(hdr.custom_data_offset);
+    m_istream.read(&inputs_outputs[0], hdr.custom_data_size);
+    pugi::xml_document doc;
+    if (doc.load_string(inputs_outputs.c_str()).status != pugi::status_ok)
+        IE_THROW(NetworkNotRead) << "The inputs and outputs information is invalid.";
+
+    Blob::Ptr weights;
+    if (hdr.consts_size) {
+        weights = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {hdr.consts_size}, Layout::C));
+        weights->allocate();
+        m_istream.seekg(hdr.consts_offset);
+        m_istream.read(weights->buffer(), hdr.consts_size);
+    }
+
+    std::string model(hdr.model_size, '\0');
+    m_istream.seekg(hdr.model_offset);
+    m_istream.read(&model[0], hdr.model_size);
+
+    network = m_builder(model, weights);
+
+    auto root = doc.child("cnndata");
+    read_info(root.child("inputs").children("in"), network.getInputsInfo());
+    read_info(root.child("outputs").children("out"), network.getOutputsInfo());
+}
+
+}  // namespace intel_gpu
+}  // namespace runtime
+}  // namespace ov
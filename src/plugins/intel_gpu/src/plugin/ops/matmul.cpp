@@ -8,6 +8,10 @@
 #include "ngraph/op/matmul.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/fake_quantize.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/reshape.hpp"
 
 #include "intel_gpu/primitives/gemm.hpp"
 #include "intel_gpu/primitives/fully_connected.hpp"
@@ -54,6 +58,90 @@ static std::pair<ngraph::Shape, ngraph::Shape> get_aligned_shapes(const ngraph::
     return {shape_a_aligned, shape_b_aligned};
 }
 
+/*
+*  The int8 weights of the fully connected are decompressed by the kernel, when the decompression subgraph isn't folded:
+*  Constant(i8/u8) -> Convert -> [Subtract(zero point)] -> Multiply(scale) -> [Reshape] -> MatMul
+*  The supported scales are per output channel, or per group of the input channels of the transposed weights [N, G, K / G]
+*  reshaped to [N, K]. The zero point is a scalar or has the shape of the scale.
+*/
+struct WeightsDecompression {
+    std::shared_ptr<ngraph::Node> convert;
+    std::shared_ptr<ngraph::Node> multiply;
+    size_t scale_idx = 0;
+    std::shared_ptr<ngraph::Node> subtract;
+    bool scalar_zero_point = false;
+    ngraph::Shape weights_shape;
+    size_t ofm = 0;
+    size_t groups = 1;
+};
+
+static bool GetWeightsDecompression(const std::shared_ptr<ngraph::op::v0::MatMul>& op, WeightsDecompression& res) {
+    auto node = op->get_input_node_shared_ptr(1);
+    auto reshape = std::dynamic_pointer_cast<ngraph::op::v1::Reshape>(node);
+    if (reshape)
+        node = reshape->get_input_node_shared_ptr(0);
+
+    auto multiply = std::dynamic_pointer_cast<ngraph::op::v1::Multiply>(node);
+    if (!multiply)
+        return false;
+    size_t scale_idx = ngraph::is_type<ngraph::op::v0::Constant>(multiply->get_input_node_ptr(1)) ? 1 : 0;
+    if (!ngraph::is_type<ngraph::op::v0::Constant>(multiply->get_input_node_ptr(scale_idx)))
+        return false;
+
+    node = multiply->get_input_node_shared_ptr(1 - scale_idx);
+    auto subtract = std::dynamic_pointer_cast<ngraph::op::v1::Subtract>(node);
+    if (subtract) {
+        if (!ngraph::is_type<ngraph::op::v0::Constant>(subtract->get_input_node_ptr(1)))
+            return false;
+        node = subtract->get_input_node_shared_ptr(0);
+    }
+
+    auto convert = std::dynamic_pointer_cast<ngraph::op::v0::Convert>(node);
+    if (!convert || !ngraph::is_type<ngraph::op::v0::Constant>(convert->get_input_node_ptr(0)))
+        return false;
+    auto weights_type = convert->get_input_element_type(0);
+    if (weights_type != ngraph::element::i8 && weights_type != ngraph::element::u8)
+        return false;
+
+    const auto& weights_shape = convert->get_input_shape(0);
+    const auto& scale_shape = multiply->get_input_shape(scale_idx);
+    size_t ofm = 0;
+    size_t groups = 1;
+    if (op->get_transpose_b()) {
+        ofm = weights_shape[0];
+        if (reshape && weights_shape.size() == 3) {
+            groups = weights_shape[1];
+            if (scale_shape != ngraph::Shape{ofm, groups, 1})
+                return false;
+        } else if (reshape || weights_shape.size() != 2 || scale_shape != ngraph::Shape{ofm, 1}) {
+            return false;
+        }
+    } else {
+        // the permute of the weights moves the whole columns, so only the per channel scales are supported
+        if (reshape || weights_shape.size() != 2)
+            return false;
+        ofm = weights_shape[1];
+        if (scale_shape != ngraph::Shape{1, ofm} && scale_shape != ngraph::Shape{ofm})
+            return false;
+    }
+
+    if (subtract) {
+        const auto& zp_shape = subtract->get_input_shape(1);
+        res.scalar_zero_point = ngraph::shape_size(zp_shape) == 1;
+        if (!res.scalar_zero_point && zp_shape != scale_shape)
+            return false;
+    }
+
+    res.convert = convert;
+    res.multiply = multiply;
+    res.scale_idx = scale_idx;
+    res.subtract = subtract;
+    res.weights_shape = weights_shape;
+    res.ofm = ofm;
+    res.groups = groups;
+    return true;
+}
+
 static void CreateMatMulOp(Program& p, const std::shared_ptr<ngraph::op::v0::MatMul>& op) {
     p.ValidateInputs(op, {2});
     auto inputPrimitives = p.GetInputPrimitiveIDs(op);
@@ -78,6 +166,32 @@ static void CreateMatMulOp(Program& p, const std::shared_ptr<ngraph::op::v0::Mat
         auto inputName = inputPrimitives[0];
         auto weightsName = inputPrimitives[1];
 
+        WeightsDecompression decompression;
+        bool compressed = GetWeightsDecompression(op, decompression);
+        std::string scaleName, zeroPointName;
+        if (compressed) {
+            weightsName = p.GetInputPrimitiveIDs(decompression.convert)[0];
+
+            // the kernels expect the decompression parameters as [OFM, groups]
+            auto decompressionTensor = cldnn::tensor(cldnn::batch(decompression.ofm), cldnn::feature(decompression.groups),
+                                                     cldnn::spatial(1, 1));
+            auto reshapeDecompression = [&](const std::string& decompressionName, const std::string& suffix) -> std::string {
+                auto reshapeName = op->get_friendly_name() + suffix;
+                auto reshapePrim = cldnn::reshape(reshapeName, decompressionName, decompressionTensor, op->get_friendly_name());
+                p.AddPrimitive(reshapePrim);
+                p.AddInnerPrimitiveToProfiler(reshapeName, layerName, op);
+                return reshapeName;
+            };
+
+            scaleName = reshapeDecompression(p.GetInputPrimitiveIDs(decompression.multiply)[decompression.scale_idx],
+                                             "_cldnn_reshape_decompression_scale");
+            if (decompression.subtract) {
+                zeroPointName = p.GetInputPrimitiveIDs(decompression.subtract)[1];
+                if (!decompression.scalar_zero_point)
+                    zeroPointName = reshapeDecompression(zeroPointName, "_cldnn_reshape_decompression_zp");
+            }
+        }
+
         // Weights normalization
         if (!op->get_transpose_b()) {
             std::vector<uint16_t> transpose_order(shape_b.size());
@@ -143,17 +257,29 @@ static void CreateMatMulOp(Program& p, const std::shared_ptr<ngraph::op::v0::Mat
 
         if (shape_b.size() != 2) {
             weightsName = reshape_to_2d(shape_b, weightsName, K, "_cldnn_reshape_weights");
+        } else if (compressed && decompression.weights_shape.size() != 2) {
+            weightsName = reshape_to_2d(decompression.weights_shape, weightsName, K, "_cldnn_reshape_weights");
         }
 
         auto input_rank = reshape_fc ? 2 : shape_a.size();
-        auto fcPrim = cldnn::fully_connected(layerName,
-                                             inputName,
-                                             weightsName,
-                                             "",
-                                             DataTypeFromPrecision(op->get_output_element_type(0)),
-                                             op->get_friendly_name(),
-                                             cldnn::padding(),
-                                             input_rank);
+        auto fcPrim = compressed ? cldnn::fully_connected(layerName,
+                                                          inputName,
+                                                          weightsName,
+                                                          "",
+                                                          scaleName,
+                                                          zeroPointName,
+                                                          DataTypeFromPrecision(op->get_output_element_type(0)),
+                                                          op->get_friendly_name(),
+                                                          cldnn::padding(),
+                                                          input_rank)
+                                 : cldnn::fully_connected(layerName,
+                                                          inputName,
+                                                          weightsName,
+                                                          "",
+                                                          DataTypeFromPrecision(op->get_output_element_type(0)),
+                                                          op->get_friendly_name(),
+                                                          cldnn::padding(),
+                                                          input_rank);
 
         p.AddPrimitive(fcPrim);
 
@@ -11,6 +11,7 @@
 #include <tuple>
 #include <cctype>
 #include <memory>
+#include <sstream>
 #include "ie_metric_helpers.hpp"
 #include "ie_plugin_config.hpp"
 #include <ie_ngraph_utils.hpp>
@@ -21,10 +22,13 @@
 #include "intel_gpu/plugin/transformations_pipeline.hpp"
 #include "intel_gpu/plugin/custom_layer.hpp"
 #include "intel_gpu/plugin/itt.hpp"
+#include "intel_gpu/plugin/network_serializer.hpp"
 #include "gpu/gpu_config.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 #include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/hash.hpp>
+#include <ngraph/pass/manager.hpp>
 
 #include "intel_gpu/runtime/device_query.hpp"
 #include "intel_gpu/runtime/debug_configuration.hpp"
@@ -66,6 +70,29 @@ struct Plugin::impl {
     Configs m_configs;
 };
 
+namespace {
+template <typename T>
+void hash_combine(uint64_t& seed, const T& value) {
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// splits the comma separated device IDs of the multi-device model, the IDs may be set as the device names, e.g. "GPU.0,GPU.1"
+std::vector<std::string> ParseDeviceIDs(const std::string& device_id) {
+    std::vector<std::string> ids;
+    std::stringstream ss(device_id);
+    std::string id;
+    while (std::getline(ss, id, ',')) {
+        const std::string prefix = "GPU.";
+        if (id.compare(0, prefix.size(), prefix) == 0)
+            id = id.substr(prefix.size());
+        if (id.empty() || std::find(ids.begin(), ids.end(), id) != ids.end())
+            IE_THROW() << "Invalid device ID list: " << device_id;
+        ids.push_back(id);
+    }
+    return ids;
+}
+}  // namespace
+
 std::string Plugin::GetDeviceIDFromConfig(const std::map<std::string, std::string>& config) const {
     std::string device_id;
     if (config.find(PluginConfigParams::KEY_DEVICE_ID) != config.end()) {
@@ -196,6 +223,74 @@ void Plugin::UpdateStatistics(const RemoteCLContext::Ptr& context) const {
     }
 }
 
+uint64_t Plugin::ComputeProgramHash(const InferenceEngine::CNNNetwork& network, const Config& config) const {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::ComputeProgramHash");
+    // the model hash covers the topology, the shapes and the weights
+    uint64_t hash = 0;
+    ngraph::pass::Manager manager;
+    manager.register_pass<ov::pass::Hash>(hash);
+    manager.run_passes(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+
+    for (const auto& input : network.getInputsInfo()) {
+        hash_combine(hash, input.first);
+        hash_combine(hash, input.second->getPrecision().name());
+        hash_combine(hash, static_cast<int>(input.second->getLayout()));
+        hash_combine(hash, static_cast<int>(input.second->getPreProcess().getColorFormat()));
+    }
+    for (const auto& output : network.getOutputsInfo()) {
+        hash_combine(hash, output.first);
+        hash_combine(hash, output.second->getPrecision().name());
+        hash_combine(hash, static_cast<int>(output.second->getLayout()));
+    }
+    for (const auto& item : config.key_config_map) {
+        hash_combine(hash, item.first);
+        hash_combine(hash, item.second);
+    }
+    hash_combine(hash, config.max_dynamic_batch);
+    return hash;
+}
+
+CompiledModel::Ptr Plugin::CreateCompiledModel(const InferenceEngine::CNNNetwork& network,
+                                               const InferenceEngine::gpu::ClContext::Ptr& context,
+                                               const Config& config) const {
+    if (config.shapes_cache_size == 0) {
+        auto transformedNetwork = CloneAndTransformNetwork(network, config);
+        return std::make_shared<CompiledModel>(transformedNetwork, context, config);
+    }
+
+    const auto hash = ComputeProgramHash(network, config);
+    std::shared_ptr<Program> program;
+    {
+        std::lock_guard<std::mutex> lock(programs_cache_mutex);
+        auto it = std::find_if(programs_cache.begin(), programs_cache.end(), [&](const CachedProgram& cached) {
+            return cached.hash == hash && cached.context == context;
+        });
+        if (it != programs_cache.end()) {
+            program = it->program;
+            programs_cache.splice(programs_cache.begin(), programs_cache, it);
+        }
+    }
+
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    if (program) {
+        GPU_DEBUG_IF(debug_config->verbose >= 1) {
+            GPU_DEBUG_COUT << "[" << network.getName() << "] the program compiled for the same shapes is reused" << std::endl;
+        }
+        auto networkCopy = network;
+        return std::make_shared<CompiledModel>(networkCopy, context, config, program);
+    }
+
+    auto transformedNetwork = CloneAndTransformNetwork(network, config);
+    auto exeNetwork = std::make_shared<CompiledModel>(transformedNetwork, context, config);
+    {
+        std::lock_guard<std::mutex> lock(programs_cache_mutex);
+        programs_cache.push_front({hash, context, exeNetwork->m_graphs.front()->GetProgram()});
+        if (programs_cache.size() > config.shapes_cache_size)
+            programs_cache.pop_back();
+    }
+    return exeNetwork;
+}
+
 std::map<std::string, std::string> Plugin::ConvertPerfHintsToConfig(
         const std::map<std::string, std::string>& network_config,
         const Config& plugin_config) const {
@@ -235,6 +330,9 @@ IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine
 
     Configs confs = _impl->m_configs;
     std::string device_id = GetDeviceIDFromConfig(orig_config);
+    if (device_id.find(',') != std::string::npos)
+        return LoadMultiDeviceExeNetwork(network, orig_config, ParseDeviceIDs(device_id));
+
     Config conf = confs.GetConfig(device_id);
 
     auto config = ConvertPerfHintsToConfig(orig_config, conf);
@@ -251,8 +349,11 @@ IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine
 
         return context_config.throughput_streams == current_config.throughput_streams &&
                context_config.useProfiling == current_config.useProfiling &&
+               context_config.profiling_sampling_rate == current_config.profiling_sampling_rate &&
                context_config.dumpCustomKernels == current_config.dumpCustomKernels &&
                context_config.memory_pool_on == current_config.memory_pool_on &&
+               context_config.memory_cache_capacity == current_config.memory_cache_capacity &&
+               context_config.shared_activations == current_config.shared_activations &&
                context_config.queueThrottle == current_config.queueThrottle &&
                context_config.queuePriority == current_config.queuePriority &&
                context_config.sources_dumps_dir == current_config.sources_dumps_dir &&
@@ -275,15 +376,47 @@ IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine
 
     context = m_defaultContext;
 
-    auto transformedNetwork = CloneAndTransformNetwork(network, conf);
     {
         OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::LoadExeNetworkImpl::CreateExeNetwork");
-        CompiledModel::Ptr exeNetwork = std::make_shared<CompiledModel>(transformedNetwork, context, conf);
+        CompiledModel::Ptr exeNetwork = CreateCompiledModel(network, context, conf);
+        // the network is copied for the export since the passed one can be changed after the load, e.g. reshaped
+        exeNetwork->m_network = InferenceEngine::details::cloneNetwork(network);
         UpdateStatistics(context);
         return exeNetwork;
     }
 }
 
+IExecutableNetworkInternal::Ptr Plugin::LoadMultiDeviceExeNetwork(const InferenceEngine::CNNNetwork &network,
+                                                                  const std::map<std::string, std::string> &orig_config,
+                                                                  const std::vector<std::string>& device_ids) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::LoadMultiDeviceExeNetwork");
+    // Each device gets its own context, so the program and the weights are replicated per device,
+    // while the kernels are compiled once for the identical devices (e.g. the tiles of one GPU)
+    std::vector<RemoteCLContext::Ptr> contexts;
+    Config conf;
+    for (const auto& id : device_ids) {
+        auto device_config = orig_config;
+        device_config[PluginConfigParams::KEY_DEVICE_ID] = id;
+        Config device_conf = _impl->m_configs.GetConfig(id);
+        auto config = ConvertPerfHintsToConfig(device_config, device_conf);
+        UpdateConfig(device_conf, network, config);
+        if (contexts.empty())
+            conf = device_conf;
+
+        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::LoadMultiDeviceExeNetwork::CreateContext");
+        contexts.emplace_back(new RemoteCLContext(shared_from_this(), ParamMap(), device_conf));
+    }
+
+    cldnn::kernels_binaries_sharing_scope binaries_sharing;
+    auto transformedNetwork = CloneAndTransformNetwork(network, conf);
+    std::vector<InferenceEngine::gpu::ClContext::Ptr> extra_contexts(contexts.begin() + 1, contexts.end());
+    auto exeNetwork = std::make_shared<CompiledModel>(transformedNetwork, contexts.front(), conf, nullptr, extra_contexts);
+    exeNetwork->m_network = InferenceEngine::details::cloneNetwork(network);
+    for (const auto& context : contexts)
+        UpdateStatistics(context);
+    return exeNetwork;
+}
+
 IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
                                                            const InferenceEngine::RemoteContext::Ptr &context,
                                                            const std::map<std::string, std::string> &orig_config) {
@@ -299,8 +432,27 @@ IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine
     auto config = ConvertPerfHintsToConfig(orig_config, conf);
     UpdateConfig(conf, network, config);
 
-    auto transformedNetwork = CloneAndTransformNetwork(network, conf);
-    return std::make_shared<CompiledModel>(transformedNetwork, casted, conf);
+    CompiledModel::Ptr exeNetwork = CreateCompiledModel(network, casted, conf);
+    exeNetwork->m_network = InferenceEngine::details::cloneNetwork(network);
+    return exeNetwork;
+}
+
+IExecutableNetworkInternal::Ptr Plugin::ImportNetwork(std::istream& networkModel,
+                                                      const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::ImportNetwork");
+    NetworkDeserializer deserializer(networkModel, [this](const std::string& model, const Blob::CPtr& weights) {
+        return GetCore()->ReadNetwork(model, weights);
+    });
+
+    CNNNetwork network;
+    deserializer >> network;
+
+    // the kernels are taken from the kernels cache, which is set together with the models cache by the core
+    auto exeNetwork = LoadExeNetworkImpl(network, config);
+    exeNetwork->setNetworkInputs(network.getInputsInfo());
+    exeNetwork->setNetworkOutputs(network.getOutputsInfo());
+    SetExeNetworkInfo(exeNetwork, network.getFunction());
+    return exeNetwork;
 }
 
 InferenceEngine::RemoteContext::Ptr Plugin::CreateContext(const ParamMap& params) {
@@ -688,6 +840,8 @@ Parameter Plugin::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(GPU_METRIC_KEY(UARCH_VERSION));
         metrics.push_back(GPU_METRIC_KEY(EXECUTION_UNITS_COUNT));
         metrics.push_back(GPU_METRIC_KEY(MEMORY_STATISTICS));
+        metrics.push_back(METRIC_KEY(GPU_MEMORY_CACHE_STATISTICS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
         std::vector<std::string> availableDevices = { };
@@ -792,6 +946,8 @@ Parameter Plugin::GetMetric(const std::string& name, const std::map<std::string,
         auto deviceName = StringRightTrim(device_info.dev_name, "NEO", false);
         deviceName += std::string(" (") + (device_info.dev_type == cldnn::device_type::discrete_gpu ? "dGPU" : "iGPU") + ")";
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, deviceName);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
         for (auto opt : _impl->m_configs.GetConfig(device_id).key_config_map)
@@ -831,6 +987,23 @@ Parameter Plugin::GetMetric(const std::string& name, const std::map<std::string,
             }
         }
         IE_SET_METRIC_RETURN(GPU_MEMORY_STATISTICS, statistics);
+    } else if (name == METRIC_KEY(GPU_MEMORY_CACHE_STATISTICS)) {
+        std::map<std::string, uint64_t> statistics;
+        {
+            std::lock_guard<std::mutex> lock(engine_mutex);
+            for (auto const &item : statistics_map) {
+                auto impl = getContextImpl(item.first);
+                impl->acquire_lock();
+                for (auto const &kv : impl->GetEngine()->get_memory_cache().get_statistics())
+                    statistics[kv.first] += kv.second;
+                impl->release_lock();
+            }
+        }
+        // the fragmentation is recomputed for the memory of all the contexts
+        const auto used = statistics["USED_BYTES"];
+        const auto requested = std::min(used, statistics["REQUESTED_BYTES"]);
+        statistics["FRAGMENTATION_PERCENT"] = used ? (used - requested) * 100 / used : 0;
+        IE_SET_METRIC_RETURN(GPU_MEMORY_CACHE_STATISTICS, statistics);
     } else if (name == GPU_METRIC_KEY(MAX_BATCH_SIZE)) {
         const auto& config = _impl->m_configs.GetConfig(device_id);
         uint32_t n_streams = static_cast<uint32_t>(config.throughput_streams);
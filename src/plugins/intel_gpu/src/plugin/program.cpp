@@ -188,6 +188,7 @@ std::shared_ptr<cldnn::program> Program::BuildProgram(const std::vector<std::sha
 
     options.set_option(cldnn::build_option::optimize_data(true));
     options.set_option(cldnn::build_option::tuning_config(m_config.tuningConfig));
+    options.set_option(cldnn::build_option::queues_num(m_config.queues_num));
     if (partialBuild) {
         options.set_option(cldnn::build_option::partial_build_program(true));
     }
@@ -311,8 +311,13 @@ ExecutionContextImpl::ExecutionContextImpl(const std::shared_ptr<IInferencePlugi
                                          m_config.memory_pool_on,
                                          engine_params.use_unified_shared_memory,
                                          m_config.kernels_cache_dir,
-                                         m_config.throughput_streams),
+                                         m_config.throughput_streams,
+                                         "cache.json",
+                                         !enable_profiling && m_config.profiling_sampling_rate > 0),
                                      engine_params.task_executor);
+    m_engine->get_memory_cache().set_capacity(m_config.memory_cache_capacity);
+    // the networks of the several streams are executed concurrently, so they can't share the intermediate buffers
+    m_engine->set_shared_memory_pool(m_config.shared_activations && m_config.throughput_streams == 1);
 }
 
 ParamMap ExecutionContextImpl::getParams() const {
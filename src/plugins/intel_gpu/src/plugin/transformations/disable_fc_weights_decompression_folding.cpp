@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "intel_gpu/plugin/transformations/disable_fc_weights_decompression_folding.hpp"
+
+#include <memory>
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/pattern/op/or.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+namespace ov {
+namespace runtime {
+namespace intel_gpu {
+
+DisableFCWeightsDecompressionFolding::DisableFCWeightsDecompressionFolding() {
+    using namespace ov::pass::pattern;
+
+    // i4/u4 weights are converted to i8/u8 later by the plugin pipeline
+    auto weights = wrap_type<opset8::Constant>(type_matches_any({element::i8, element::u8, element::i4, element::u4}));
+    auto convert = wrap_type<opset8::Convert>({weights});
+    auto subtract = wrap_type<opset8::Subtract>({convert, wrap_type<opset8::Constant>()});
+    auto convert_or_subtract = std::make_shared<ov::pass::pattern::op::Or>(OutputVector{convert, subtract});
+    auto multiply = wrap_type<opset8::Multiply>({convert_or_subtract, wrap_type<opset8::Constant>()});
+    auto reshape = wrap_type<opset8::Reshape>({multiply, wrap_type<opset8::Constant>()});
+    auto multiply_or_reshape = std::make_shared<ov::pass::pattern::op::Or>(OutputVector{multiply, reshape});
+    auto matmul = wrap_type<opset8::MatMul>({any_input(), multiply_or_reshape});
+
+    matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        ov::disable_constant_folding(pattern_map.at(convert).get_node_shared_ptr());
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(matmul, "DisableFCWeightsDecompressionFolding");
+    register_matcher(m, callback);
+}
+
+}  // namespace intel_gpu
+}  // namespace runtime
+}  // namespace ov
@@ -31,6 +31,7 @@
 #include <transformations/control_flow/unroll_tensor_iterator.hpp>
 
 #include <transformations/common_optimizations/common_optimizations.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
@@ -87,6 +88,7 @@
 #include <low_precision/network_helper.hpp>
 
 #include "intel_gpu/plugin/itt.hpp"
+#include "intel_gpu/plugin/transformations/disable_fc_weights_decompression_folding.hpp"
 
 namespace {
 template<typename T>
@@ -121,6 +123,9 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
         if (enableInt8) {
             manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
                 std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+        } else {
+            // the int8 weights are decompressed by the fully_connected kernels, so the decompression isn't folded
+            manager.register_pass<DisableFCWeightsDecompressionFolding>();
         }
 
         manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -322,12 +327,18 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
             pass_config->set_callback<ngraph::pass::ConvertQuantizeDequantize>([](const_node_ptr &node) -> bool {
                 return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForMultiply(node);
             });
-
-            pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
-                return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node);
-            });
         }
 
+        // keeps the zero point subtraction of the compressed weights for the fully_connected
+        auto isWeightsDecompressionSubtract = [](const_node_ptr &node) -> bool {
+            auto input = node->get_input_node_shared_ptr(0);
+            return ov::is_type<ngraph::opset1::Convert>(input) && ov::constant_folding_is_disabled(input);
+        };
+        pass_config->set_callback<ngraph::pass::ConvertSubtract>([=](const_node_ptr &node) -> bool {
+            return isWeightsDecompressionSubtract(node) ||
+                   (enableInt8 && ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node));
+        });
+
         manager.run_passes(func);
     }
 
@@ -114,6 +114,7 @@ static void print_help_messages() {
     message_list.emplace_back("OV_GPU_DumpLayersLimitBatch", "Limit the size of batch to dump");
     message_list.emplace_back("OV_GPU_DryRunPath", "Dry run and serialize execution graph into the specified path");
     message_list.emplace_back("OV_GPU_BaseBatchForMemEstimation", "Base batch size to be used in memory estimation");
+    message_list.emplace_back("OV_GPU_MaxKernelsPerBatch", "Maximum number of kernels in a batch compiled as one program");
 
     auto max_name_length_item = std::max_element(message_list.begin(), message_list.end(),
         [](std::pair<std::string, std::string>& a, std::pair<std::string, std::string>& b){
@@ -141,7 +142,8 @@ debug_configuration::debug_configuration()
         , dry_run_path(std::string())
         , disable_onednn(0)
         , dump_layers_limit_batch(std::numeric_limits<int>::max())
-        , base_batch_for_memory_estimation(-1) {
+        , base_batch_for_memory_estimation(-1)
+        , max_kernels_per_batch(0) {
 #ifdef GPU_DEBUG_CONFIG
     get_gpu_debug_env_var("Help", help);
     get_common_debug_env_var("Verbose", verbose);
@@ -155,6 +157,7 @@ debug_configuration::debug_configuration()
     get_gpu_debug_env_var("DisableOnednn", disable_onednn);
     get_gpu_debug_env_var("DryRunPath", dry_run_path);
     get_gpu_debug_env_var("BaseBatchForMemEstimation", base_batch_for_memory_estimation);
+    get_gpu_debug_env_var("MaxKernelsPerBatch", max_kernels_per_batch);
     std::string dump_layers_str;
     get_gpu_debug_env_var("DumpLayers", dump_layers_str);
 
@@ -22,7 +22,21 @@ namespace cldnn {
 engine::engine(const device::ptr device, const engine_configuration& configuration, const InferenceEngine::ITaskExecutor::Ptr task_executor)
 : _device(device)
 , _configuration(configuration)
-, _task_executor(task_executor) {}
+, _task_executor(task_executor)
+, _memory_cache(new memory_cache(*this)) {}
+
+void engine::set_shared_memory_pool(bool enabled) {
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!enabled)
+        _shared_memory_pool.reset();
+    else if (!_shared_memory_pool)
+        _shared_memory_pool = std::make_shared<memory_pool>(*this, true);
+}
+
+std::shared_ptr<memory_pool> engine::get_shared_memory_pool() const {
+    std::lock_guard<std::mutex> guard(_mutex);
+    return _shared_memory_pool;
+}
 
 device_info engine::get_device_info() const {
     return _device->get_info();
@@ -103,6 +117,17 @@ memory_ptr engine::share_usm(const layout& layout, shared_handle usm_ptr) {
     return reinterpret_handle(layout, params);
 }
 
+memory_ptr engine::share_host_ptr(const layout& layout, shared_handle ptr) {
+    shared_mem_params params = { shared_mem_type::shared_mem_host_ptr, nullptr, nullptr, ptr,
+#ifdef _WIN32
+        nullptr,
+#else
+        0,
+#endif
+        0 };
+    return reinterpret_handle(layout, params);
+}
+
 memory::ptr engine::share_image(const layout& layout, shared_handle img) {
     shared_mem_params params = { shared_mem_type::shared_mem_image, nullptr, nullptr, img,
 #ifdef _WIN32
@@ -12,20 +12,29 @@
 namespace cldnn {
 
 void event::wait() {
+    if (!_set) {
+        // TODO: refactor in context of multiple simultaneous calls (for generic engine)
+        wait_impl();
+        _set = true;
+    }
+    if (_exception)
+        std::rethrow_exception(_exception);
+}
+
+void event::set() {
     if (_set)
         return;
-
-    // TODO: refactor in context of multiple simultaneous calls (for generic engine)
-    wait_impl();
     _set = true;
-    return;
+    set_impl();
+    call_handlers();
 }
 
-void event::set() {
+void event::set_exception(std::exception_ptr exception) {
     if (_set)
         return;
+    _exception = exception;
     _set = true;
-    set_impl();
+    set_exception_impl();
     call_handlers();
 }
 
@@ -9,11 +9,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdio>
 #include <sstream>
 #include <fstream>
 #include <set>
 #include <string>
 #include <memory>
+#include <thread>
 #include <utility>
 
 #include "cldnn_itt.hpp"
@@ -43,6 +46,11 @@
 namespace {
 std::mutex cacheAccessMutex;
 
+// the batch binaries shared between the kernels caches of the identical devices, see kernels_binaries_sharing_scope
+std::mutex sharedBinariesMutex;
+size_t sharedBinariesScopes = 0;
+std::map<std::string, std::vector<unsigned char>> sharedBinaries;
+
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 std::wstring multiByteCharToWString(const char* str) {
 #ifdef _WIN32
@@ -94,16 +102,41 @@ static std::vector<unsigned char> loadBinaryFromFile(std::string path) {
 }
 static void saveBinaryToFile(std::string path, const std::vector<unsigned char> buffer) {
     std::lock_guard<std::mutex> lock(cacheAccessMutex);
+    // the cache directory may be shared by several processes, so the file is written under a unique temporary name
+    // and then renamed, thus the readers never see the partially written file
+    const auto tmp_path = path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "_" +
+                          std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     std::wstring widefilename = multiByteCharToWString(path.c_str());
+    std::wstring widetmpfilename = multiByteCharToWString(tmp_path.c_str());
     const wchar_t* filename = widefilename.c_str();
+    const wchar_t* tmp_filename = widetmpfilename.c_str();
 #else
     const char* filename = path.c_str();
+    const char* tmp_filename = tmp_path.c_str();
 #endif
-    std::ofstream out_file(filename, std::ios::out | std::ios::binary);
-    if (out_file.is_open()) {
+    {
+        std::ofstream out_file(tmp_filename, std::ios::out | std::ios::binary);
+        if (!out_file.is_open())
+            return;
         out_file.write(reinterpret_cast<const char*>(&buffer[0]), buffer.size());
+        if (!out_file.good()) {
+            out_file.close();
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            _wremove(tmp_filename);
+#else
+            std::remove(tmp_filename);
+#endif
+            return;
+        }
     }
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    if (!MoveFileExW(tmp_filename, filename, MOVEFILE_REPLACE_EXISTING))
+        _wremove(tmp_filename);
+#else
+    if (std::rename(tmp_filename, filename) != 0)
+        std::remove(tmp_filename);
+#endif
 }
 
 std::string reorder_options(const std::string& org_options) {
@@ -133,8 +166,6 @@ inline bool does_options_support_batch_compilation(const std::string& options) {
 
 namespace cldnn {
 
-std::mutex kernels_cache::_mutex;
-
 std::string kernels_cache::get_cache_path() const {
     auto path = _engine.configuration().kernels_cache_path;
     if (path.empty()) {
@@ -151,7 +182,56 @@ bool kernels_cache::is_cache_enabled() const {
     return !_engine.configuration().kernels_cache_path.empty();
 }
 
+std::vector<unsigned char> kernels_cache::load_binary(const std::string& name) const {
+    if (!is_cache_enabled())
+        return {};
+    return loadBinaryFromFile(get_cache_path() + name);
+}
+
+void kernels_cache::save_binary(const std::string& name, const std::vector<unsigned char>& binary) const {
+    if (!is_cache_enabled() || binary.empty())
+        return;
+    saveBinaryToFile(get_cache_path() + name, binary);
+}
+
+kernels_binaries_sharing_scope::kernels_binaries_sharing_scope() {
+    std::lock_guard<std::mutex> lock(sharedBinariesMutex);
+    sharedBinariesScopes++;
+}
+
+kernels_binaries_sharing_scope::~kernels_binaries_sharing_scope() {
+    std::lock_guard<std::mutex> lock(sharedBinariesMutex);
+    if (--sharedBinariesScopes == 0)
+        sharedBinaries.clear();
+}
+
+std::string kernels_cache::get_shared_binary_key(size_t hash_value) const {
+    const auto& info = _engine.get_device_info();
+    return info.dev_name + "_" + info.driver_version + "_" + std::to_string(hash_value);
+}
+
+std::vector<unsigned char> kernels_cache::load_shared_binary(size_t hash_value) const {
+    std::lock_guard<std::mutex> lock(sharedBinariesMutex);
+    if (sharedBinariesScopes == 0)
+        return {};
+    auto it = sharedBinaries.find(get_shared_binary_key(hash_value));
+    return it != sharedBinaries.end() ? it->second : std::vector<unsigned char>{};
+}
+
+void kernels_cache::save_shared_binary(size_t hash_value, std::function<std::vector<unsigned char>()> get_binary) const {
+    std::lock_guard<std::mutex> lock(sharedBinariesMutex);
+    if (sharedBinariesScopes == 0)
+        return;
+    auto& binary = sharedBinaries[get_shared_binary_key(hash_value)];
+    if (binary.empty())
+        binary = get_binary();
+}
+
 size_t kernels_cache::get_max_kernels_per_batch() const {
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    GPU_DEBUG_IF(debug_config->max_kernels_per_batch >= 1) {
+        return static_cast<size_t>(debug_config->max_kernels_per_batch);
+    }
     return 10;
 }
 
@@ -201,6 +281,8 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
         auto& current_batch = current_bucket.back();
         current_batch.dump_custom_program = dump_custom_program;
         current_batch.entry_point_to_id[entry_point] = code.id;
+        if (is_cache_enabled())
+            current_batch.kernels_cache_keys.push_back(get_kernel_cache_key(code));
 
         assert(org_source_code.size() == 1);
 
@@ -226,6 +308,71 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
     }
 }
 
+size_t kernels_cache::get_kernel_cache_key(const kernel_code& code) const {
+    // the kernel binary depends on the kernel code and options, the common headers of the batches and the device/driver
+    const auto& device_info = _engine.get_device_info();
+    std::string key = std::to_string(code.hash_value) + " " + device_info.dev_name + " " +
+                      std::to_string(device_info.device_id) + " " + device_info.driver_version;
+    for (const auto& header : batch_header_str)
+        key += " " + std::to_string(std::hash<std::string>()(header));
+    return std::hash<std::string>()(key);
+}
+
+void kernels_cache::load_cached_kernels(const engine& build_engine, kernels_code& kernels_to_build) {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "KernelsCache::LoadCachedKernels");
+    auto& cl_build_engine = dynamic_cast<const ocl::ocl_engine&>(build_engine);
+
+    // ${kernel_key}.cl_kernel files refer to the ${hash_value}.cl_cache binary of the batch the kernel was compiled in,
+    // so the kernels compiled for any model are found by their content regardless of the batches composition
+    std::map<std::string, std::vector<kernels_code::const_iterator>> cached_batches;
+    for (auto it = kernels_to_build.cbegin(); it != kernels_to_build.cend(); ++it) {
+        if (it->dump_custom_program)
+            continue;
+        auto ref = loadBinaryFromFile(get_cache_path() + std::to_string(get_kernel_cache_key(*it)) + ".cl_kernel");
+        if (!ref.empty())
+            cached_batches[std::string(ref.begin(), ref.end())].push_back(it);
+    }
+    if (cached_batches.empty())
+        return;
+
+    std::mutex loaded_mutex;
+    std::vector<kernels_code::const_iterator> loaded;
+    std::vector<InferenceEngine::Task> tasks;
+    for (const auto& cached_batch : cached_batches) {
+        tasks.push_back([&, this] {
+            auto bin = loadBinaryFromFile(get_cache_path() + cached_batch.first + ".cl_cache");
+            if (bin.empty())
+                return;
+            try {
+                cl::vector<cl::Kernel> kernels;
+                cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, cl::Program::Binaries{bin});
+                program.build(cl_build_engine.get_cl_device(), cached_batch.second.front()->kernel_strings->options.c_str());
+                program.createKernels(&kernels);
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (const auto& code : cached_batch.second) {
+                    auto k = std::find_if(kernels.begin(), kernels.end(), [&](const cl::Kernel& k) {
+                        return k.getInfo<CL_KERNEL_FUNCTION_NAME>() == code->kernel_strings->entry_point;
+                    });
+                    if (k == kernels.end())
+                        continue;
+                    cl_context context = cl_build_engine.get_cl_context().get();
+                    _kernels.insert({code->id, kernels_factory::create(_engine, context, k->get(), code->kernel_strings->entry_point)});
+                    std::lock_guard<std::mutex> loaded_lock(loaded_mutex);
+                    loaded.push_back(code);
+                    _loaded_kernels++;
+                }
+            } catch (const cl::Error&) {
+                // the binary is stale or corrupted, so the kernels are compiled from the sources
+            }
+        });
+    }
+    _engine.get_task_executor()->runAndWait(tasks);
+
+    for (const auto& code : loaded)
+        kernels_to_build.erase(code);
+}
+
 kernels_cache::kernels_cache(engine& engine) : _engine(engine) { }
 
 kernel_id kernels_cache::set_kernel_source(
@@ -297,6 +444,7 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
 
     std::string cached_bin_name = get_cache_path() + std::to_string(batch.hash_value) + ".cl_cache";
     cl::Program::Binaries precompiled_kernels = {};
+    const auto start = std::chrono::steady_clock::now();
 
     if (is_cache_enabled()) {
         // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket
@@ -306,6 +454,13 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
             precompiled_kernels.push_back(bin);
         }
     }
+    if (precompiled_kernels.empty()) {
+        // The same batch may be already compiled for the identical device of the multi-device model
+        auto bin = load_shared_binary(batch.hash_value);
+        if (!bin.empty()) {
+            precompiled_kernels.push_back(bin);
+        }
+    }
     try {
         cl::vector<cl::Kernel> kernels;
 
@@ -326,13 +481,19 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
             }
 
             program.createKernels(&kernels);
+            save_shared_binary(batch.hash_value, [&program]() { return getProgramBinaries(program); });
 
             if (is_cache_enabled()) {
                 // If kernels caching is enabled, then we save compiled bucket to binary file with name ${code_hash_value}.cl_cache
-                // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
-                // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
-                // compile time.
+                // Note: Bin file contains full bucket, not separate kernels, so ${kernel_key}.cl_kernel reference files are saved
+                // as well to reuse the kernels across different models (see load_cached_kernels())
                 saveBinaryToFile(cached_bin_name, getProgramBinaries(program));
+                if (!batch.dump_custom_program) {
+                    const auto batch_ref = std::to_string(batch.hash_value);
+                    for (const auto& key : batch.kernels_cache_keys)
+                        saveBinaryToFile(get_cache_path() + std::to_string(key) + ".cl_kernel",
+                                         std::vector<unsigned char>(batch_ref.begin(), batch_ref.end()));
+                }
             }
         } else {
             cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
@@ -354,6 +515,14 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
                     throw std::runtime_error("Could not find entry point");
                 }
             }
+            const auto build_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            _batches_statistics.push_back({batch.bucket_id, batch.batch_id, batch.kernels_counter, !precompiled_kernels.empty(),
+                                           static_cast<uint64_t>(build_time.count())});
+            GPU_DEBUG_IF(debug_config->verbose >= 2) {
+                GPU_DEBUG_COUT << "Kernels batch " << batch.bucket_id << "_part_" << batch.batch_id << " with "
+                               << batch.kernels_counter << " kernels is " << (precompiled_kernels.empty() ? "compiled" : "loaded")
+                               << " in " << build_time.count() / 1000 << " ms" << std::endl;
+            }
         }
     } catch (const cl::BuildError& err) {
         if (dump_sources && dump_file.good())
@@ -414,28 +583,54 @@ void kernels_cache::build_all() {
         _build_engine = std::unique_ptr<ocl::ocl_engine>(new ocl::ocl_engine(_engine.get_device(), runtime_types::ocl,
                                                                     _engine.configuration(), _engine.get_task_executor()));
     }
+    kernels_code kernels_to_build;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        kernels_to_build = _kernels_code;
+    }
+    // the kernels compiled before by any model are taken from the cache, so only the new ones are compiled
+    if (is_cache_enabled() && _build_engine)
+        load_cached_kernels(*_build_engine, kernels_to_build);
+
     std::vector<batch_program> batches;
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        get_program_source(_kernels_code, &batches);
+        get_program_source(kernels_to_build, &batches);
     }
 
+    // the batches are separate OpenCL programs, so they are built concurrently by the streams of the plugin task executor
+    // (GPU_MAX_NUM_THREADS), the largest batches go first to balance the streams load
+    std::stable_sort(batches.begin(), batches.end(), [](const batch_program& lhs, const batch_program& rhs) {
+        return lhs.kernels_counter > rhs.kernels_counter;
+    });
     auto _task_executor = _engine.get_task_executor();
+    std::mutex exception_mutex;
     std::exception_ptr exception;
+    std::atomic<size_t> built_batches{0};
     std::vector<InferenceEngine::Task> tasks;
-    for (int idx = 0; idx < batches.size(); idx++) {
+    for (size_t idx = 0; idx < batches.size(); idx++) {
         auto& batch = batches[idx];
-        tasks.push_back([this, &_build_engine, batch, &exception] {
+        tasks.push_back([this, &_build_engine, &batch, &exception, &exception_mutex, &built_batches, &batches] {
             try {
                 build_batch(*_build_engine, batch);
             } catch(...) {
-                exception = std::current_exception();
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!exception)
+                    exception = std::current_exception();
+            }
+            const auto built = ++built_batches;
+            GPU_DEBUG_GET_INSTANCE(debug_config);
+            GPU_DEBUG_IF(debug_config->verbose >= 1) {
+                GPU_DEBUG_COUT << "Kernels batches built: " << built << "/" << batches.size() << std::endl;
             }
         });
     }
     _task_executor->runAndWait(tasks);
     tasks.clear();
 
+    if (exception)
+        std::rethrow_exception(exception);
+
     {
         std::lock_guard<std::mutex> lock(_mutex);
         _kernels_code.clear();
@@ -451,9 +646,27 @@ void kernels_cache::build_all() {
     }
 }
 
+std::map<std::string, uint64_t> kernels_cache::get_build_statistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::map<std::string, uint64_t> statistics{{"BATCHES", _batches_statistics.size()}, {"KERNELS", 0},
+                                               {"LOADED_KERNELS", _loaded_kernels}, {"BUILD_TIME_US", 0}};
+    for (const auto& batch : _batches_statistics) {
+        const auto prefix = "BATCH_" + std::to_string(batch.bucket_id) + "_" + std::to_string(batch.batch_id);
+        statistics[prefix + "_KERNELS"] = batch.kernels_counter;
+        statistics[prefix + "_TIME_US"] = batch.build_time_us;
+        statistics["KERNELS"] += batch.kernels_counter;
+        statistics["BUILD_TIME_US"] += batch.build_time_us;
+        if (batch.from_cache)
+            statistics["LOADED_KERNELS"] += batch.kernels_counter;
+    }
+    return statistics;
+}
+
 void kernels_cache::reset() {
     _kernels.clear();
     _kernels_code.clear();
+    _batches_statistics.clear();
+    _loaded_kernels = 0;
     _pending_compilation = false;
 }
 
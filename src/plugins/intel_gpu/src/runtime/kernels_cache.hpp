@@ -8,6 +8,7 @@
 #include "intel_gpu/runtime/kernel.hpp"
 
 #include <map>
+#include <functional>
 #include <mutex>
 #include <vector>
 #include <memory>
@@ -30,6 +31,7 @@ public:
         std::string options;
         bool dump_custom_program;
         std::map<std::string, std::string> entry_point_to_id;
+        std::vector<size_t> kernels_cache_keys;
 
         explicit batch_program(int32_t _bucket_id, int32_t _batch_id, std::string _options, const std::vector<std::string>& batch_header_str)
             : bucket_id(_bucket_id),
@@ -39,7 +41,8 @@ public:
               source(std::move(batch_header_str)),
               options(_options),
               dump_custom_program(false),
-              entry_point_to_id({}) {
+              entry_point_to_id({}),
+              kernels_cache_keys({}) {
         }
     };
 
@@ -70,21 +73,37 @@ public:
 
     using kernels_code = std::set<kernel_code, cmp_kernel_code>;
 
+    struct batch_statistics {
+        int32_t bucket_id;
+        int32_t batch_id;
+        uint32_t kernels_counter;
+        bool from_cache;         // the batch binary was loaded from the cache instead of the compilation
+        uint64_t build_time_us;
+    };
+
 private:
-    static std::mutex _mutex;
+    // guards the kernels of this cache only, so the different programs are compiled independently
+    mutable std::mutex _mutex;
     engine& _engine;
     kernels_code _kernels_code;
     std::atomic<bool> _pending_compilation{false};
     std::map<const std::string, kernel::ptr> _kernels;
     std::vector<std::string> batch_header_str;
+    std::vector<batch_statistics> _batches_statistics;
+    size_t _loaded_kernels = 0;
 
     void get_program_source(const kernels_code& kernels_source_code, std::vector<batch_program>*) const;
     void build_batch(const engine& build_engine, const batch_program& batch);
+    void load_cached_kernels(const engine& build_engine, kernels_code& kernels_to_build);
+    size_t get_kernel_cache_key(const kernel_code& code) const;
 
     std::string get_cache_path() const;
-    bool is_cache_enabled() const;
     size_t get_max_kernels_per_batch() const;
 
+    std::string get_shared_binary_key(size_t hash_value) const;
+    std::vector<unsigned char> load_shared_binary(size_t hash_value) const;
+    void save_shared_binary(size_t hash_value, std::function<std::vector<unsigned char>()> get_binary) const;
+
 public:
     explicit kernels_cache(engine& engine);
     kernel_id set_kernel_source(const std::shared_ptr<kernel_string>& kernel_string,
@@ -95,7 +114,17 @@ public:
     }
     // forces compilation of all pending kernels/programs
     void build_all();
+    // returns the build time of every compiled batch and the number of the kernels loaded from the cache
+    // ("BATCHES", "KERNELS", "LOADED_KERNELS", "BUILD_TIME_US" and per batch "BATCH_<bucket>_<part>_KERNELS",
+    // "BATCH_<bucket>_<part>_TIME_US" keys)
+    std::map<std::string, uint64_t> get_build_statistics() const;
     void reset();
+
+    bool is_cache_enabled() const;
+    // loads and saves the binaries of the other kinds (e.g. the oneDNN primitives) in the kernels cache directory,
+    // the load returns an empty vector when there is no such file
+    std::vector<unsigned char> load_binary(const std::string& name) const;
+    void save_binary(const std::string& name, const std::vector<unsigned char>& binary) const;
 };
 
 }  // namespace cldnn
@@ -21,14 +21,112 @@ namespace cldnn {
 memory_record::memory_record(memory_set users,
                              std::shared_ptr<memory>& memory,
                              uint32_t net_id,
-                             allocation_type type)
-    : _users(users), _memory(memory), _network_id(net_id), _type(type) {}
+                             allocation_type type,
+                             bool from_cache)
+    : _users(users), _memory(memory), _network_id(net_id), _type(type), _from_cache(from_cache) {}
+
+memory_cache::memory_cache(engine& engine) : _engine(&engine) { }
+
+void memory_cache::set_capacity(uint64_t capacity) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _capacity = capacity;
+    }
+    if (capacity == 0)
+        clear();
+}
+
+bool memory_cache::is_enabled() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity != 0;
+}
+
+uint64_t memory_cache::get_size_class(uint64_t bytes) {
+    // 256 bytes alignment for the small buffers, then 4 classes per power of two: 2^k * {1, 1.25, 1.5, 1.75}
+    const uint64_t min_granularity = 256;
+    uint64_t power = 1;
+    while (power * 2 <= bytes)
+        power *= 2;
+    const auto granularity = std::max(min_granularity, power / 4);
+    return (bytes + granularity - 1) / granularity * granularity;
+}
+
+memory_ptr memory_cache::get_memory(uint64_t bytes, allocation_type type) {
+    const auto size_class = get_size_class(std::max<uint64_t>(bytes, 1));
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _buffers.find({type, size_class});
+        if (it != _buffers.end()) {
+            auto buffer = it->second;
+            _buffers.erase(it);
+            _cached_bytes -= size_class;
+            _reuses++;
+            _used_bytes += size_class;
+            _requested_bytes += bytes;
+            _peak_used_bytes = std::max(_peak_used_bytes, _used_bytes);
+            return buffer;
+        }
+    }
+    // the multiple of 256 bytes is represented as 2d layout to fit the large buffers into the int32 dimensions
+    const layout buffer_layout(data_types::u8, format::bfyx, tensor(1, 1, 256, static_cast<tensor::value_type>(size_class / 256)));
+    auto buffer = _engine->allocate_memory(buffer_layout, type);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _allocations++;
+    _used_bytes += size_class;
+    _requested_bytes += bytes;
+    _peak_used_bytes = std::max(_peak_used_bytes, _used_bytes);
+    return buffer;
+}
+
+void memory_cache::release_memory(const memory_ptr& buffer, uint64_t requested_bytes) {
+    const auto size_class = buffer->get_layout().bytes_count();
+    std::lock_guard<std::mutex> lock(_mutex);
+    _used_bytes -= std::min<uint64_t>(_used_bytes, size_class);
+    _requested_bytes -= std::min<uint64_t>(_requested_bytes, requested_bytes);
+    if (_cached_bytes + size_class > _capacity) {
+        _evictions++;
+        return;
+    }
+    _buffers.emplace(std::make_pair(buffer->get_allocation_type(), size_class), buffer);
+    _cached_bytes += size_class;
+    _peak_cached_bytes = std::max(_peak_cached_bytes, _cached_bytes);
+}
+
+void memory_cache::clear() {
+    std::multimap<std::pair<allocation_type, uint64_t>, memory_ptr> buffers;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::swap(buffers, _buffers);
+        _cached_bytes = 0;
+    }
+}
+
+std::map<std::string, uint64_t> memory_cache::get_statistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {{"ALLOCATIONS", _allocations},
+            {"REUSES", _reuses},
+            {"EVICTIONS", _evictions},
+            {"USED_BYTES", _used_bytes},
+            {"REQUESTED_BYTES", _requested_bytes},
+            {"PEAK_USED_BYTES", _peak_used_bytes},
+            {"CACHED_BYTES", _cached_bytes},
+            {"PEAK_CACHED_BYTES", _peak_cached_bytes},
+            {"FRAGMENTATION_PERCENT", _used_bytes ? (_used_bytes - std::min(_used_bytes, _requested_bytes)) * 100 / _used_bytes : 0}};
+}
 
 memory::ptr memory_pool::alloc_memory(const layout& layout, allocation_type type) {
     return _engine->allocate_memory(layout, type);
 }
 
-memory_pool::~memory_pool() {}
+void memory_pool::free_record(memory_record& record) {
+    if (record._from_cache)
+        _engine->get_memory_cache().release_memory(record._memory, record._requested_bytes);
+}
+
+memory_pool::~memory_pool() {
+    // the size class buffers are returned to the engine memory_cache
+    clear_pool();
+}
 
 bool memory_pool::has_conflict(const memory_set& a,
                                const std::set<primitive_id>& b,
@@ -50,6 +148,7 @@ bool memory_pool::has_conflict(const memory_set& a,
 }
 
 void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t network_id) {
+    std::lock_guard<std::mutex> lock(_mutex);
     // check nonpadded pool first
     auto _layout = mem->get_layout();
     auto type = mem->get_allocation_type();
@@ -59,7 +158,7 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
         auto it = range.first;
 
         while (it != range.second && it != _non_padded_pool.end()) {
-            if (it->second._network_id == network_id &&
+            if (is_available_for(it->second, network_id) &&
                 it->second._type == type &&
                 it->second._memory.get() == mem) {
                 auto user_it = it->second._users.find({ id, network_id });
@@ -70,6 +169,7 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
                 }
                 if (it->second._users.empty()) {
                     // if this was the only user of the memory, then free it up
+                    free_record(it->second);
                     it = _non_padded_pool.erase(it);
                 }
 
@@ -89,7 +189,7 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
 
             while (list_itr != list.end()) {
                 if (list_itr->_memory.get() == mem &&
-                    list_itr->_network_id == network_id &&
+                    is_available_for(*list_itr, network_id) &&
                     list_itr->_type == type) {
                     auto user_it = list_itr->_users.find({ id, network_id });
 
@@ -121,9 +221,10 @@ memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
                                                   uint32_t network_id,
                                                   const std::set<primitive_id>& restrictions,
                                                   allocation_type type) {
+    std::lock_guard<std::mutex> lock(_mutex);
     auto it = _non_padded_pool.lower_bound(layout.bytes_count());
     while (it != _non_padded_pool.end()) {
-        if (it->second._network_id == network_id &&
+        if (is_available_for(it->second, network_id) &&
             it->second._type == type &&
             it->second._memory->get_layout().format != format::fs_b_yx_fsv32 &&
             layout.format != format::fs_b_yx_fsv32 &&
@@ -142,6 +243,15 @@ memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
         GPU_DEBUG_COUT << "[" << id << ": output]" << std::endl;
     }
     // didn't find anything for you? create new resource
+    auto& cache = _engine->get_memory_cache();
+    if (cache.is_enabled()) {
+        // the size class buffer may be already released by another network
+        auto buffer = cache.get_memory(layout.bytes_count(), type);
+        auto it = _non_padded_pool.emplace(buffer->get_layout().bytes_count(),
+                                           memory_record({{id, network_id}}, buffer, network_id, type, true));
+        it->second._requested_bytes = layout.bytes_count();
+        return _engine->reinterpret_buffer(*buffer, layout);
+    }
     auto mem = alloc_memory(layout, type);
     {
         _non_padded_pool.emplace(layout.bytes_count(),
@@ -155,11 +265,12 @@ memory::ptr memory_pool::get_from_padded_pool(const layout& layout,
                                               uint32_t network_id,
                                               const std::set<primitive_id>& restrictions,
                                               allocation_type type) {
+    std::lock_guard<std::mutex> lock(_mutex);
     auto first_level_cache = _padded_pool.find(layout);
 
     if (first_level_cache != _padded_pool.end()) {
         for (auto& rec_list : first_level_cache->second) {
-            if (rec_list._network_id == network_id &&
+            if (is_available_for(rec_list, network_id) &&
                 rec_list._type == type &&
                 ((layout.format != format::b_fs_yx_fsv32 && layout.format != format::b_fs_zyx_fsv32) ||
                  (layout.size.feature[0] % 32 == 0)) &&
@@ -197,6 +308,7 @@ memory::ptr memory_pool::get_from_across_networks_pool(const layout& layout,
                                                        const primitive_id& id,
                                                        uint32_t network_id,
                                                        allocation_type type) {
+    std::lock_guard<std::mutex> lock(_mutex);
     auto it = _no_reusable_pool.lower_bound(layout.bytes_count());
 
     while (it != _no_reusable_pool.end()) {
@@ -245,9 +357,51 @@ memory::ptr memory_pool::get_memory(const layout& layout,
     }
 }
 
-void memory_pool::clear_pool() { _non_padded_pool.clear(); }
+void memory_pool::clear_pool() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& record : _non_padded_pool)
+        free_record(record.second);
+    _non_padded_pool.clear();
+}
+
+void memory_pool::release_network_users(memory_record& record, uint32_t network_id) {
+    for (auto it = record._users.begin(); it != record._users.end();) {
+        if (it->_network_id == network_id)
+            it = record._users.erase(it);
+        else
+            ++it;
+    }
+}
 
 void memory_pool::clear_pool_for_network(uint32_t network_id) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // the records of the shared pool are freed when the last network using them is cleared
+    if (_shared_across_networks) {
+        for (auto itr = _non_padded_pool.begin(); itr != _non_padded_pool.end();) {
+            release_network_users(itr->second, network_id);
+            if (itr->second._users.empty()) {
+                free_record(itr->second);
+                itr = _non_padded_pool.erase(itr);
+            } else {
+                itr++;
+            }
+        }
+        for (auto itr = _padded_pool.begin(); itr != _padded_pool.end();) {
+            auto& list = itr->second;
+            for (auto list_itr = list.begin(); list_itr != list.end();) {
+                release_network_users(*list_itr, network_id);
+                if (list_itr->_users.empty())
+                    list_itr = list.erase(list_itr);
+                else
+                    list_itr++;
+            }
+            if (list.empty())
+                itr = _padded_pool.erase(itr);
+            else
+                itr++;
+        }
+    }
+
     // free up _non_padded_pool for this network
     {
         auto itr = _non_padded_pool.begin();
@@ -255,7 +409,8 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
         while (itr != _non_padded_pool.end()) {
             auto& record = itr->second;
 
-            if (record._network_id == network_id) {
+            if (!_shared_across_networks && record._network_id == network_id) {
+                free_record(record);
                 itr = _non_padded_pool.erase(itr);
             } else {
                 itr++;
@@ -272,7 +427,7 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
             auto list_itr = list.begin();
 
             while (list_itr != list.end()) {
-                if (list_itr->_network_id == network_id) {
+                if (!_shared_across_networks && list_itr->_network_id == network_id) {
                     list_itr = list.erase(list_itr);
                 } else {
                     list_itr++;
@@ -303,6 +458,7 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
     }
 }
 
-memory_pool::memory_pool(engine& engine) : _engine(&engine) { }
+memory_pool::memory_pool(engine& engine, bool shared_across_networks)
+    : _engine(&engine), _shared_across_networks(shared_across_networks) { }
 
 }  // namespace cldnn
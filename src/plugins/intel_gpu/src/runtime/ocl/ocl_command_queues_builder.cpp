@@ -76,12 +76,12 @@ std::vector<cl_queue_properties> command_queues_builder::get_properties(const cl
     return properties;
 }
 
-ocl_queue_type command_queues_builder::build(const cl::Context& context, const cl::Device& device) {
+ocl_queue_type command_queues_builder::build(const cl::Context& context, const cl::Device& device, int32_t queue_index) {
     ocl_queue_type queue;
     cl_int error_code = CL_SUCCESS;
     static std::atomic<uint16_t> stream_id{0};
 
-    auto properties = get_properties(device, stream_id++);
+    auto properties = get_properties(device, queue_index < 0 ? stream_id++ : static_cast<uint16_t>(queue_index));
 
     queue = clCreateCommandQueueWithProperties(context.get(), device.get(), properties.data(), &error_code);
 
@@ -13,7 +13,8 @@ namespace ocl {
 class command_queues_builder {
 public:
     command_queues_builder();
-    ocl_queue_type build(const cl::Context& context, const cl::Device& device);
+    // @p queue_index selects the hardware queue of the queue family, the negative value means the next one in round-robin order
+    ocl_queue_type build(const cl::Context& context, const cl::Device& device, int32_t queue_index = -1);
     void set_throttle_mode(throttle_mode_types throttle, bool extension_support);
     void set_priority_mode(priority_mode_types priority, bool extension_support);
     void set_profiling(bool flag) { _profiling = flag; }
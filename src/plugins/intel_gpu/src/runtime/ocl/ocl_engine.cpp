@@ -59,6 +59,11 @@ ocl_engine::ocl_engine(const device::ptr dev, runtime_types runtime_type,
     _program_stream.reset(new ocl_stream(*this));
 }
 
+ocl_engine::~ocl_engine() {
+    // the cached USM buffers are freed by the USM helper of this engine
+    _memory_cache->clear();
+}
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
 dnnl::engine& ocl_engine::get_onednn_engine() const {
     if (!_onednn_engine)
@@ -171,6 +176,9 @@ memory::ptr ocl_engine::reinterpret_handle(const layout& new_layout, shared_mem_
         } else if (params.mem_type == shared_mem_type::shared_mem_usm) {
             cl::UsmMemory usm_buffer(get_usm_helper(), params.mem);
             return std::make_shared<ocl::gpu_usm>(this, new_layout, usm_buffer);
+        } else if (params.mem_type == shared_mem_type::shared_mem_host_ptr) {
+            cl::Buffer buf(get_cl_context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, new_layout.bytes_count(), params.mem);
+            return std::make_shared<ocl::gpu_buffer>(this, new_layout, buf);
         } else {
             throw std::runtime_error("unknown shared object fromat or type");
         }
@@ -221,6 +229,10 @@ stream::ptr ocl_engine::create_stream(void* handle) const {
     return std::make_shared<ocl_stream>(*this, handle);
 }
 
+stream::ptr ocl_engine::create_stream_on_queue(uint16_t queue_index) const {
+    return std::make_shared<ocl_stream>(*this, static_cast<int32_t>(queue_index));
+}
+
 stream& ocl_engine::get_program_stream() const {
     return *_program_stream;
 }
@@ -21,6 +21,7 @@ namespace ocl {
 class ocl_engine : public engine {
 public:
     ocl_engine(const device::ptr dev, runtime_types runtime_type, const engine_configuration& conf, const InferenceEngine::ITaskExecutor::Ptr task_executor);
+    ~ocl_engine() override;
     engine_types type() const override { return engine_types::ocl; };
     runtime_types runtime_type() const override { return runtime_types::ocl; };
 
@@ -41,6 +42,7 @@ public:
 
     stream_ptr create_stream() const override;
     stream_ptr create_stream(void *handle) const override;
+    stream_ptr create_stream_on_queue(uint16_t queue_index) const override;
     stream& get_program_stream() const override;
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
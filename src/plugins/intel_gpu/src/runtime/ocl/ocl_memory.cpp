@@ -110,6 +110,35 @@ event::ptr gpu_buffer::copy_from(stream& stream, const void* host_ptr) {
     return ev;
 }
 
+event::ptr gpu_buffer::copy_from(stream& stream, const memory& other, size_t dst_offset, size_t size) {
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    cl::Event ev_ocl;
+    if (auto usm_inst = dynamic_cast<const gpu_usm*>(&other)) {
+        cl_stream.get_cl_queue().enqueueWriteBuffer(_buffer, false, dst_offset, size, usm_inst->get_buffer().get(), nullptr, &ev_ocl);
+    } else {
+        auto& mem_inst = downcast<const gpu_buffer>(other);
+        cl_stream.get_cl_queue().enqueueCopyBuffer(mem_inst.get_buffer(), get_buffer(), 0, dst_offset, size, nullptr, &ev_ocl);
+    }
+
+    return std::make_shared<ocl_event>(ev_ocl);
+}
+
+event::ptr gpu_buffer::copy_from(stream& stream, const void* host_ptr, size_t dst_offset, size_t size) {
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    cl::Event ev_ocl;
+    cl_stream.get_cl_queue().enqueueWriteBuffer(_buffer, false, dst_offset, size, host_ptr, nullptr, &ev_ocl);
+
+    return std::make_shared<ocl_event>(ev_ocl);
+}
+
+event::ptr gpu_buffer::copy_to(stream& stream, void* host_ptr, bool blocking) {
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    cl::Event ev_ocl;
+    cl_stream.get_cl_queue().enqueueReadBuffer(_buffer, blocking, 0, size(), host_ptr, nullptr, &ev_ocl);
+
+    return std::make_shared<ocl_event>(ev_ocl);
+}
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
 dnnl::memory gpu_buffer::get_onednn_memory(dnnl::memory::desc desc) {
     auto onednn_engine = _engine->get_onednn_engine();
@@ -244,6 +273,18 @@ event::ptr gpu_image2d::copy_from(stream& /* stream */, const void* /* host_ptr
     throw std::runtime_error("[clDNN] copy_from is not implemented for gpu_image2d");
 }
 
+event::ptr gpu_image2d::copy_from(stream& /* stream */, const memory& /* other */, size_t /* dst_offset */, size_t /* size */) {
+    throw std::runtime_error("[clDNN] copy_from is not implemented for gpu_image2d");
+}
+
+event::ptr gpu_image2d::copy_from(stream& /* stream */, const void* /* host_ptr */, size_t /* dst_offset */, size_t /* size */) {
+    throw std::runtime_error("[clDNN] copy_from is not implemented for gpu_image2d");
+}
+
+event::ptr gpu_image2d::copy_to(stream& /* stream */, void* /* host_ptr */, bool /* blocking */) {
+    throw std::runtime_error("[clDNN] copy_to is not implemented for gpu_image2d");
+}
+
 gpu_media_buffer::gpu_media_buffer(ocl_engine* engine,
                                    const layout& new_layout,
                                    shared_mem_params params)
@@ -395,6 +436,40 @@ event::ptr gpu_usm::copy_from(stream& stream, const void* host_ptr) {
     return ev;
 }
 
+event::ptr gpu_usm::copy_from(stream& stream, const memory& other, size_t dst_offset, size_t size) {
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    cl::Event ev_ocl;
+    auto dst_ptr = static_cast<uint8_t*>(get_buffer().get()) + dst_offset;
+    if (auto buffer_inst = dynamic_cast<const gpu_buffer*>(&other)) {
+        // the USM pointers are accepted in place of the host pointers
+        cl_stream.get_cl_queue().enqueueReadBuffer(buffer_inst->get_buffer(), false, 0, size, dst_ptr, nullptr, &ev_ocl);
+    } else {
+        auto& casted = downcast<const gpu_usm>(other);
+        cl_stream.get_usm_helper().enqueue_memcpy(cl_stream.get_cl_queue(), dst_ptr, casted.get_buffer().get(), size,
+                                                  false, nullptr, &ev_ocl);
+    }
+
+    return std::make_shared<ocl_event>(ev_ocl);
+}
+
+event::ptr gpu_usm::copy_from(stream& stream, const void* host_ptr, size_t dst_offset, size_t size) {
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    cl::Event ev_ocl;
+    auto dst_ptr = static_cast<uint8_t*>(get_buffer().get()) + dst_offset;
+    cl_stream.get_usm_helper().enqueue_memcpy(cl_stream.get_cl_queue(), dst_ptr, host_ptr, size, false, nullptr, &ev_ocl);
+
+    return std::make_shared<ocl_event>(ev_ocl);
+}
+
+event::ptr gpu_usm::copy_to(stream& stream, void* host_ptr, bool blocking) {
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    cl::Event ev_ocl;
+    cl_stream.get_usm_helper().enqueue_memcpy(cl_stream.get_cl_queue(), host_ptr, get_buffer().get(), _bytes_count,
+                                              blocking, nullptr, &ev_ocl);
+
+    return std::make_shared<ocl_event>(ev_ocl);
+}
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
 dnnl::memory gpu_usm::get_onednn_memory(dnnl::memory::desc desc) {
     auto onednn_engine = _engine->get_onednn_engine();
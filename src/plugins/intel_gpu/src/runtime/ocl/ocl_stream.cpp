@@ -49,6 +49,18 @@ inline cl::NDRange toNDRange(const std::vector<size_t>& v) {
     }
 }
 
+// The user events which are still to be set by the host, e.g. by the cpu impls running asynchronously.
+// The commands synchronized without the events wait for them explicitly, since the queue knows nothing about them
+std::vector<cl::Event> get_host_events(std::vector<event::ptr> const& deps) {
+    std::vector<cl::Event> host_events;
+    for (auto& dep : deps) {
+        if (auto user_ev = dynamic_cast<ocl_user_event*>(dep.get()))
+            if (!user_ev->is_set())
+                host_events.push_back(user_ev->get());
+    }
+    return host_events;
+}
+
 void set_arguments_impl(ocl_kernel_type& kernel,
                         const arguments_desc& args,
                         const kernel_arguments_data& data) {
@@ -261,7 +273,7 @@ sync_methods get_expected_sync_method(const engine_configuration &config) {
 
 }  // namespace
 
-ocl_stream::ocl_stream(const ocl_engine &engine)
+ocl_stream::ocl_stream(const ocl_engine &engine, int32_t queue_index)
     : stream(engine.configuration().queue_type)
     , _engine(engine)
     , sync_method(get_expected_sync_method(engine.configuration())) {
@@ -269,7 +281,7 @@ ocl_stream::ocl_stream(const ocl_engine &engine)
     auto device = engine.get_cl_device();
     auto config = engine.configuration();
     ocl::command_queues_builder queue_builder;
-    queue_builder.set_profiling(config.enable_profiling);
+    queue_builder.set_profiling(config.enable_profiling || config.enable_sampled_profiling);
     queue_builder.set_out_of_order((config.queue_type == queue_types::out_of_order));
 
     if (sync_method == sync_methods::none && config.queue_type == queue_types::out_of_order) {
@@ -285,7 +297,7 @@ ocl_stream::ocl_stream(const ocl_engine &engine)
     bool queue_families_extension = engine.get_device_info().supports_queue_families;
     queue_builder.set_supports_queue_families(queue_families_extension);
 
-    _command_queue = queue_builder.build(context, device);
+    _command_queue = queue_builder.build(context, device, queue_index);
 #ifdef ENABLE_ONEDNN_FOR_GPU
     if (config.queue_type == queue_types::in_order) {
         auto onednn_engine = engine.get_onednn_engine();
@@ -367,13 +379,17 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
             }
         }
         dep_events_ptr = &dep_events;
-    } else if (sync_method == sync_methods::barriers) {
-        sync_events(deps, is_output);
+    } else {
+        if (sync_method == sync_methods::barriers)
+            sync_events(deps, is_output);
+        dep_events = get_host_events(deps);
+        if (!dep_events.empty())
+            dep_events_ptr = &dep_events;
     }
 
     cl::Event ret_ev;
 
-    bool set_output_event = sync_method == sync_methods::events || is_output;
+    bool set_output_event = sync_method == sync_methods::events || is_output || profiling_events;
 
     try {
         _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, set_output_event ? &ret_ev : nullptr);
@@ -388,7 +404,55 @@ void ocl_stream::enqueue_barrier() {
     _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
 }
 
+void ocl_stream::enqueue_barrier(std::vector<event::ptr> const& deps) {
+    std::vector<cl::Event> dep_events;
+    for (auto& dep : deps) {
+        if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get()))
+            if (ocl_base_ev->get().get() != nullptr)
+                dep_events.push_back(ocl_base_ev->get());
+    }
+
+    if (dep_events.empty())
+        return;
+
+    try {
+        _command_queue.enqueueBarrierWithWaitList(&dep_events, nullptr);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+}
+
 event::ptr ocl_stream::enqueue_marker(std::vector<event::ptr> const& deps, bool is_output) {
+    if (sync_method != sync_methods::events) {
+        auto host_events = get_host_events(deps);
+        if (!host_events.empty()) {
+            // the barrier waits for both the previous commands and the host events
+            cl::Event ret_ev;
+            try {
+                _command_queue.enqueueBarrierWithWaitList(&host_events, &ret_ev);
+            } catch (cl::Error const& err) {
+                throw ocl_error(err);
+            }
+            if (sync_method == sync_methods::barriers) {
+                _last_barrier_ev = ret_ev;
+                _last_barrier = ++_queue_counter;
+                return std::make_shared<ocl_event>(ret_ev, _last_barrier);
+            }
+            return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
+        }
+    }
+
+    if (sync_method == sync_methods::none && is_output) {
+        // the in-order queue completes the deps before the marker, the event is used to synchronize the other queues with it
+        cl::Event ret_ev;
+        try {
+            _command_queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
+        } catch (cl::Error const& err) {
+            throw ocl_error(err);
+        }
+        return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
+    }
+
     if (deps.empty())
         return std::make_shared<ocl_user_event>(_engine.get_cl_context(), true);
 
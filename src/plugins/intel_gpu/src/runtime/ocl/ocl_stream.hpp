@@ -49,7 +49,8 @@ class ocl_stream : public stream {
 public:
     const ocl_queue_type& get_cl_queue() const { return _command_queue; }
 
-    explicit ocl_stream(const ocl_engine& engine);
+    // The queue is bound to the hardware queue @p queue_index of the queue family, -1 means the next one in round-robin order
+    explicit ocl_stream(const ocl_engine& engine, int32_t queue_index = -1);
     ocl_stream(const ocl_engine &engine, void *handle);
     ocl_stream(ocl_stream&& other)
         : stream(other._engine.configuration().queue_type)
@@ -75,6 +76,7 @@ public:
     event::ptr group_events(std::vector<event::ptr> const& deps) override;
     void wait_for_events(const std::vector<event::ptr>& events) override;
     void enqueue_barrier() override;
+    void enqueue_barrier(std::vector<event::ptr> const& deps) override;
     event::ptr create_user_event(bool set) override;
     event::ptr create_base_event() override;
 
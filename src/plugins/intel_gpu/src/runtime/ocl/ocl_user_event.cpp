@@ -17,6 +17,11 @@ void ocl_user_event::set_impl() {
         new cldnn::instrumentation::profiling_period_basic(_timer.uptime()));
 }
 
+void ocl_user_event::set_exception_impl() {
+    // a negative status fails the event, so the commands waiting for it are terminated instead of being executed
+    static_cast<cl::UserEvent&&>(get()).setStatus(-1);
+}
+
 bool ocl_user_event::get_profiling_info_impl(std::list<cldnn::instrumentation::profiling_interval>& info) {
     if (_duration == nullptr) {
         return false;
@@ -28,18 +33,22 @@ bool ocl_user_event::get_profiling_info_impl(std::list<cldnn::instrumentation::p
 }
 
 void ocl_user_event::wait_impl() {
-    if (!_set) {
-        throw std::runtime_error("[CLDNN] ocl_user_event::wait_impl is called before marking event handle as complete");
-    }
-
+    // the event may be set by another thread, e.g. by a host task of the cpu impls, so the wait blocks until then
     if (_event.get() != nullptr) {
-        _event.wait();
+        try {
+            _event.wait();
+        } catch (const cl::Error&) {
+            // the event failed by set_exception, the original exception is rethrown by the event
+            if (!_exception)
+                throw;
+        }
     }
 }
 
 bool ocl_user_event::is_set_impl() {
     if (_event.get() != nullptr) {
-        return _event.getInfo<CL_EVENT_COMMAND_EXECUTION_STATUS>() == CL_COMPLETE;
+        const auto status = _event.getInfo<CL_EVENT_COMMAND_EXECUTION_STATUS>();
+        return status == CL_COMPLETE || status < 0;
     }
     return true;
 }
@@ -10,6 +10,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
 
 namespace {
@@ -20,11 +21,13 @@ enum class cache_version {
     version_2,
     version_2_invalid,
     version_2_from_1,
-    version_2_empty
+    version_2_empty,
+    version_2_device  // kernels tuned for the device and for the compute units count only
 };
 
 std::string reference_impl_name = "convolution_gpu_ref";
 std::string eus_marker = "__EUs__";
+std::string device_marker = "__DEVICE__";
 
 std::string cache_v1 =
 R"__a({
@@ -89,6 +92,22 @@ R"__a({
     }
 })__a";
 
+std::string cache_v2_device =
+R"__a({
+    "version_2": {
+        "__EUs__": {
+            "CONVOLUTION": {
+                "F32_BFYX_v3_p0_0_v3_p0_0_v16_p0_0_v1_p0_0;F32_BFYX_v3_p0_0_v3_p0_0_v16_p0_0_v1_p0_0;1_1_1;1_1_1;1_1_1;0_0_0;1;1": ["non_existent", 0]
+            }
+        },
+        "__EUs_____DEVICE__": {
+            "CONVOLUTION": {
+                "F32_BFYX_v3_p0_0_v3_p0_0_v16_p0_0_v1_p0_0;F32_BFYX_v3_p0_0_v3_p0_0_v16_p0_0_v1_p0_0;1_1_1;1_1_1;1_1_1;0_0_0;1;1": ["convolution_gpu_ref", 0]
+            }
+        }
+    }
+})__a";
+
 std::string get_cache_version(cache_version version) {
     std::string cache;
     switch (version) {
@@ -110,6 +129,9 @@ std::string get_cache_version(cache_version version) {
     case cache_version::version_2_empty:
         cache = cache_v2_empty;
         break;
+    case cache_version::version_2_device:
+        cache = cache_v2_device;
+        break;
     default:
         throw std::invalid_argument("invalid cache version");
     }
@@ -132,6 +154,20 @@ void replace(std::string& text, const std::string& replaced, T replacement) {
     }
 }
 
+void replace(std::string& text, const std::string& replaced, const std::string& replacement) {
+    auto it = text.find(replaced);
+    while (it != std::string::npos) {
+        text.replace(it, replaced.length(), replacement);
+        it = text.find(replaced);
+    }
+}
+
+std::string get_device_id(cldnn::engine& engine) {
+    std::stringstream ss;
+    ss << "0x" << std::hex << engine.get_device_info().device_id;
+    return ss.str();
+}
+
 void write(const std::string& filename, const std::string& text) {
     std::ofstream file;
     file.open(filename);
@@ -173,6 +209,7 @@ public:
         auto cache = get_cache_version(v);
         auto eus = engine.get_device_info().execution_units_count;
         replace(cache, eus_marker, eus);
+        replace(cache, device_marker, get_device_id(engine));
 
         write(cache_filename, cache);
     }
@@ -239,6 +276,7 @@ public:
             auto expected_cache = get_cache_version(compare_cache.value);
             auto eus = _engine.get_device_info().execution_units_count;
             replace(expected_cache, eus_marker, eus);
+            replace(expected_cache, device_marker, get_device_id(_engine));
 
             EXPECT_EQ(cache, expected_cache);
         }
@@ -291,6 +329,9 @@ public:
         case cache_version::version_2_empty:
             result = "version_2_empty";
             break;
+        case cache_version::version_2_device:
+            result = "version_2_device";
+            break;
         default:
             result = std::to_string(static_cast<int>(param.param));
             break;
@@ -351,3 +392,13 @@ TEST(cache_test, remove_invalid) {
         .expect_cache(cache_version::version_2_empty)
         .test();
 }
+
+TEST(cache_test, device_entry_preferred) {
+    auto& engine = tests::get_test_engine();
+
+    cache_test_helper helper(engine, cache_version::version_2_device);
+    helper.with_mode(cldnn::tuning_mode::tuning_use_cache)
+        .expect_implementation(reference_impl_name)
+        .expect_cache(cache_version::version_2_device)
+        .test();
+}
@@ -320,3 +320,31 @@ TEST(cl_mem_check, check_read_access_type) {
     bool are_equal = std::equal(src_buffer.begin(), src_buffer.begin() + values_count, dst_buffer.begin());
     ASSERT_TRUE(are_equal);
 }
+
+TEST(cl_mem_check, check_host_ptr_input) {
+    auto& engine = get_test_engine();
+
+    const size_t values_count = 1024;
+    const size_t page_size = 4096;
+    std::vector<uint8_t> host_buffer(values_count * sizeof(float) + page_size);
+    auto aligned_ptr = reinterpret_cast<float*>((reinterpret_cast<uintptr_t>(host_buffer.data()) + page_size - 1) / page_size * page_size);
+    for (size_t i = 0; i < values_count; i++) {
+        aligned_ptr[i] = static_cast<float>(i % 7) - 3.0f;
+    }
+
+    cldnn::layout input_layout_desc(data_types::f32, format::bfyx, { 1, 1, 32, 32 });
+    auto input_memory = engine.share_host_ptr(input_layout_desc, aligned_ptr);
+
+    topology topology(
+        input_layout("input", input_layout_desc),
+        activation("relu", "input", activation_func::relu));
+    network network(engine, topology);
+    network.set_input_data("input", input_memory);
+    auto outputs = network.execute();
+
+    auto output_memory = outputs.at("relu").get_memory();
+    cldnn::mem_lock<float> output_ptr(output_memory, get_test_stream());
+    for (size_t i = 0; i < values_count; i++) {
+        EXPECT_FLOAT_EQ(std::max(aligned_ptr[i], 0.0f), output_ptr[i]);
+    }
+}
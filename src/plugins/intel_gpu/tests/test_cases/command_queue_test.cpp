@@ -7,6 +7,7 @@
 
 #include <intel_gpu/primitives/input_layout.hpp>
 #include <intel_gpu/primitives/arg_max_min.hpp>
+#include <intel_gpu/primitives/activation.hpp>
 
 using namespace cldnn;
 using namespace ::tests;
@@ -99,3 +100,43 @@ TEST(command_queue_test, test_priority_and_throttle_hints) {
     auto engine = engine::create(engine_types::ocl, runtime_types::ocl, configuration);
     exexute_network(*engine);
 }
+
+TEST(command_queue_test, test_sampled_profiling_events) {
+    engine_configuration configuration =
+        engine_configuration(
+            false,          // profiling
+            queue_types::in_order,
+            "",             // sources_dumps_dir
+            priority_mode_types::disabled,
+            throttle_mode_types::disabled,
+            true,           // use_memory_pool
+            true,           // use_unified_shared_memory
+            "",             // kernels_cache_path
+            1,              // throughput_streams
+            "cache.json",   // tuning_cache_path
+            true);          // enable_sampled_profiling
+    auto engine = engine::create(engine_types::ocl, runtime_types::ocl, configuration);
+
+    auto input = engine->allocate_memory({ data_types::f32, format::bfyx, { 1, 3, 2, 2 } });
+    set_values(input, std::vector<float>(12, 1.f));
+    topology topology;
+    topology.add(input_layout("input", input->get_layout()));
+    topology.add(activation("relu", "input", activation_func::relu));
+    topology.add(arg_max_min("arg_max", { "relu" }, arg_max_min::max));
+
+    network network(*engine, topology);
+    network.set_input_data("input", input);
+
+    auto relu_profiled = [&]() {
+        network.execute().at("arg_max").get_event()->wait();
+        auto executed = network.get_executed_primitives();
+        return executed.count("relu") > 0 && !executed.at("relu")->get_profiling_info().empty();
+    };
+
+    // the intermediate kernels of the in-order queue return no events unless the inference is sampled
+    EXPECT_FALSE(relu_profiled());
+    network.set_profiling_events(true);
+    EXPECT_TRUE(relu_profiled());
+    network.set_profiling_events(false);
+    EXPECT_FALSE(relu_profiled());
+}
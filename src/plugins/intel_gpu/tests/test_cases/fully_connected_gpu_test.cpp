@@ -467,6 +467,130 @@ TEST(fully_connected_gpu, x_f32) {
     EXPECT_EQ(7.00f, output_ptr[3]);
 }
 
+TEST(fully_connected_gpu, compressed_int8_weights_grouped_scale_zp_f32) {
+    //  Input  : 2x4
+    //  Output : 2x3
+    //  Weights: 3x4 int8 with the scales and the zero points of 2 groups of 2 input features
+    const int32_t batch = 2, ifm = 4, ofm = 3, groups = 2;
+
+    auto& engine = get_test_engine();
+
+    auto input_prim = engine.allocate_memory({ data_types::f32, format::bfyx, { batch, ifm, 1, 1 } });
+    auto weights_prim = engine.allocate_memory({ data_types::i8, format::bfyx, { ofm, ifm, 1, 1 } });
+    auto scale_prim = engine.allocate_memory({ data_types::f32, format::bfyx, { ofm, groups, 1, 1 } });
+    auto zp_prim = engine.allocate_memory({ data_types::f32, format::bfyx, { ofm, groups, 1, 1 } });
+
+    std::vector<float> input_data = { -0.5f, 2.0f, 0.5f, 1.0f,
+                                       1.5f, -1.0f, 0.0f, 2.0f };
+    std::vector<int8_t> weights_data = { 1, -2, 3, 4,
+                                         -5, 6, 7, -8,
+                                         9, 10, -11, 12 };
+    std::vector<float> scale_data = { 0.5f, 0.25f,
+                                      1.0f, 2.0f,
+                                      0.125f, 0.5f };
+    std::vector<float> zp_data = { 1.0f, -1.0f,
+                                   0.0f, 2.0f,
+                                   -3.0f, 1.0f };
+    set_values(input_prim, input_data);
+    set_values(weights_prim, weights_data);
+    set_values(scale_prim, scale_data);
+    set_values(zp_prim, zp_data);
+
+    topology topology(
+        input_layout("input", input_prim->get_layout()),
+        data("weights", weights_prim),
+        data("scale", scale_prim),
+        data("zp", zp_prim),
+        fully_connected("full_con_prim", "input", "weights", "", "scale", "zp", data_types::f32)
+    );
+
+    network network(engine, topology);
+    network.set_input_data("input", input_prim);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "full_con_prim");
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    cldnn::mem_lock<float> output_ptr(output_prim, get_test_stream());
+
+    for (int32_t b = 0; b < batch; b++) {
+        for (int32_t o = 0; o < ofm; o++) {
+            float expected = 0.0f;
+            for (int32_t k = 0; k < ifm; k++) {
+                const int32_t g = k / (ifm / groups);
+                const float weight = (weights_data[o * ifm + k] - zp_data[o * groups + g]) * scale_data[o * groups + g];
+                expected += input_data[b * ifm + k] * weight;
+            }
+            EXPECT_FLOAT_EQ(expected, output_ptr[b * ofm + o]) << "b = " << b << ", o = " << o;
+        }
+    }
+}
+
+TEST(fully_connected_gpu, compressed_uint8_weights_per_channel_scale_scalar_zp_f16) {
+    auto& engine = get_test_engine();
+
+    if (!engine.get_device_info().supports_fp16) {
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    // The sizes are big enough for the tiled kernel.
+    const int32_t batch = 8, ifm = 64, ofm = 32;
+
+    auto input_prim = engine.allocate_memory({ data_types::f16, format::bfyx, { batch, ifm, 1, 1 } });
+    auto weights_prim = engine.allocate_memory({ data_types::u8, format::bfyx, { ofm, ifm, 1, 1 } });
+    auto scale_prim = engine.allocate_memory({ data_types::f16, format::bfyx, { ofm, 1, 1, 1 } });
+    auto zp_prim = engine.allocate_memory({ data_types::f16, format::bfyx, { 1, 1, 1, 1 } });
+
+    // The values and the partial sums are exactly representable in fp16.
+    std::vector<float> input_data(batch * ifm);
+    for (size_t i = 0; i < input_data.size(); i++)
+        input_data[i] = static_cast<float>(static_cast<int>(i % 5) - 2) * 0.5f;
+    std::vector<uint8_t> weights_data(ofm * ifm);
+    for (size_t i = 0; i < weights_data.size(); i++)
+        weights_data[i] = static_cast<uint8_t>(i * 7 % 16);
+    std::vector<float> scale_data(ofm);
+    for (int32_t o = 0; o < ofm; o++)
+        scale_data[o] = 0.0625f * static_cast<float>(o % 2 + 1);
+    const float zp = 8.0f;
+
+    std::vector<FLOAT16> input_f16(input_data.begin(), input_data.end());
+    std::vector<FLOAT16> scale_f16(scale_data.begin(), scale_data.end());
+    set_values(input_prim, input_f16);
+    set_values(weights_prim, weights_data);
+    set_values(scale_prim, scale_f16);
+    set_values(zp_prim, { FLOAT16(zp) });
+
+    topology topology(
+        input_layout("input", input_prim->get_layout()),
+        data("weights", weights_prim),
+        data("scale", scale_prim),
+        data("zp", zp_prim),
+        fully_connected("full_con_prim", "input", "weights", "", "scale", "zp", data_types::f16)
+    );
+
+    network network(engine, topology);
+    network.set_input_data("input", input_prim);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "full_con_prim");
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    cldnn::mem_lock<FLOAT16> output_ptr(output_prim, get_test_stream());
+
+    for (int32_t b = 0; b < batch; b++) {
+        for (int32_t o = 0; o < ofm; o++) {
+            float expected = 0.0f;
+            for (int32_t k = 0; k < ifm; k++)
+                expected += input_data[b * ifm + k] * (weights_data[o * ifm + k] - zp) * scale_data[o];
+            EXPECT_NEAR(expected, static_cast<float>(output_ptr[b * ofm + o]), 1e-2f) << "b = " << b << ", o = " << o;
+        }
+    }
+}
+
 TEST(fully_connected_gpu, yxfn_f32) {
     //  Input  : 1x2x1x2 - 1 batch 2 feature maps of size 2x1
     //  Output : 2x1 - 2 batches 1 neuron each
@@ -15,6 +15,8 @@
 #include <intel_gpu/primitives/crop.hpp>
 #include <intel_gpu/primitives/scale.hpp>
 
+#include <numeric>
+
 using namespace cldnn;
 using namespace ::tests;
 
@@ -556,3 +558,112 @@ TEST(memory_pool, add_mem_dep_test) {
     EXPECT_EQ(out2_ptr[2], 7.0f);
     EXPECT_EQ(out2_ptr[3], 8.0f);
 }
+
+TEST(memory_pool, size_classes) {
+    EXPECT_EQ(memory_cache::get_size_class(1), (uint64_t)256);
+    EXPECT_EQ(memory_cache::get_size_class(256), (uint64_t)256);
+    EXPECT_EQ(memory_cache::get_size_class(1000), (uint64_t)1024);
+    EXPECT_EQ(memory_cache::get_size_class(1025), (uint64_t)1280);
+    EXPECT_EQ(memory_cache::get_size_class(4096), (uint64_t)4096);
+    EXPECT_EQ(memory_cache::get_size_class(6000), (uint64_t)6144);
+    EXPECT_EQ(memory_cache::get_size_class(7200), (uint64_t)8192);
+}
+
+TEST(memory_pool, memory_cache_reuse_across_networks) {
+    auto engine = create_test_engine();
+    engine->get_memory_cache().set_capacity(1024 * 1024);
+
+    auto make_topology = [](const layout& in_layout) {
+        topology topology;
+        topology.add(input_layout("input", in_layout));
+        topology.add(activation("relu", "input", activation_func::relu));
+        topology.add(activation("relu1", "relu", activation_func::relu));
+        topology.add(activation("relu2", "relu1", activation_func::relu));
+        return topology;
+    };
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    auto run = [&](int32_t x_size) {
+        auto input = engine->allocate_memory({ data_types::f32, format::bfyx, { 1, 4, x_size, 1 } });
+        std::vector<float> input_vec(input->get_layout().count(), -1.f);
+        input_vec[0] = 2.f;
+        set_values(input, input_vec);
+
+        network network(*engine, make_topology(input->get_layout()), bo);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        cldnn::mem_lock<float> output_ptr(outputs.at("relu2").get_memory(), get_test_stream());
+        EXPECT_EQ(output_ptr[0], 2.f);
+        EXPECT_EQ(output_ptr[1], 0.f);
+    };
+
+    run(60);
+    const auto allocations = engine->get_memory_cache().get_statistics().at("ALLOCATIONS");
+    EXPECT_GT(allocations, (uint64_t)0);
+
+    // the slightly smaller shapes fit the same size classes, so the released buffers are reused
+    run(58);
+    const auto statistics = engine->get_memory_cache().get_statistics();
+    EXPECT_EQ(statistics.at("ALLOCATIONS"), allocations);
+    EXPECT_GT(statistics.at("REUSES"), (uint64_t)0);
+    EXPECT_EQ(statistics.at("USED_BYTES"), (uint64_t)0);
+}
+
+TEST(memory_pool, shared_pool_across_networks) {
+    auto engine = create_test_engine();
+    engine->set_shared_memory_pool(true);
+
+    auto used_memory = [&]() {
+        return engine->get_used_device_memory(allocation_type::usm_device) +
+               engine->get_used_device_memory(allocation_type::usm_host) +
+               engine->get_used_device_memory(allocation_type::cl_mem);
+    };
+
+    layout in_layout = { data_types::f32, format::bfyx, { 1, 4, 64, 1 } };
+    topology topology;
+    topology.add(input_layout("input", in_layout));
+    topology.add(activation("relu", "input", activation_func::relu));
+    topology.add(activation("relu1", "relu", activation_func::relu));
+    topology.add(activation("relu2", "relu1", activation_func::relu));
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    auto input = engine->allocate_memory(in_layout);
+    std::vector<float> input_vec(in_layout.count(), -1.f);
+    input_vec[0] = 2.f;
+    set_values(input, input_vec);
+
+    auto before_first = used_memory();
+    network network_first(*engine, topology, bo);
+    auto first_size = used_memory() - before_first;
+
+    // the second network reuses the intermediate buffers of the first one, only its output is allocated
+    auto before_second = used_memory();
+    network network_second(*engine, topology, bo);
+    auto second_size = used_memory() - before_second;
+    EXPECT_LT(second_size, first_size);
+
+    for (auto net : { &network_first, &network_second, &network_first }) {
+        net->set_input_data("input", input);
+        auto outputs = net->execute();
+        cldnn::mem_lock<float> output_ptr(outputs.at("relu2").get_memory(), get_test_stream());
+        EXPECT_EQ(output_ptr[0], 2.f);
+        EXPECT_EQ(output_ptr[1], 0.f);
+    }
+}
+
+TEST(memory_tests, non_blocking_copy_to_host) {
+    auto& engine = get_test_engine();
+    auto mem = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 16, 4 } });
+    std::vector<float> src(mem->get_layout().count());
+    std::iota(src.begin(), src.end(), 0.f);
+    set_values(mem, src);
+
+    std::vector<float> dst(src.size(), -1.f);
+    auto ev = mem->copy_to(get_test_stream(), dst.data(), false);
+    get_test_stream().flush();
+    ev->wait();
+    EXPECT_EQ(src, dst);
+}
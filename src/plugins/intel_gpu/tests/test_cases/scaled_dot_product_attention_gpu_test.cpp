@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "test_utils.h"
+
+#include <intel_gpu/primitives/input_layout.hpp>
+#include <intel_gpu/primitives/gemm.hpp>
+#include <intel_gpu/primitives/softmax.hpp>
+#include <intel_gpu/primitives/eltwise.hpp>
+#include <intel_gpu/primitives/reorder.hpp>
+#include <intel_gpu/primitives/scaled_dot_product_attention.hpp>
+
+#include <cmath>
+#include <cstddef>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+// query [B, H, L, D], key [B, H, S, D], value [B, H, S, D], mask [1, 1, L, S]
+std::vector<float> attention_ref(const std::vector<float>& query, const std::vector<float>& key, const std::vector<float>& value,
+                                 const std::vector<float>& mask, size_t B, size_t H, size_t L, size_t S, size_t D, float scale,
+                                 bool is_causal) {
+    std::vector<float> output(B * H * L * D, 0.0f);
+    for (size_t bh = 0; bh < B * H; ++bh) {
+        for (size_t l = 0; l < L; ++l) {
+            std::vector<float> scores(S, -INFINITY);
+            float max_score = -INFINITY;
+            for (size_t s = 0; s < S; ++s) {
+                if (is_causal && s > l + S - L)
+                    continue;
+                float score = 0.0f;
+                for (size_t d = 0; d < D; ++d)
+                    score += query[(bh * L + l) * D + d] * key[(bh * S + s) * D + d];
+                scores[s] = score * scale + (mask.empty() ? 0.0f : mask[l * S + s]);
+                max_score = std::max(max_score, scores[s]);
+            }
+            float sum = 0.0f;
+            for (auto& score : scores) {
+                score = std::exp(score - max_score);
+                sum += score;
+            }
+            for (size_t s = 0; s < S; ++s) {
+                for (size_t d = 0; d < D; ++d)
+                    output[(bh * L + l) * D + d] += scores[s] / sum * value[(bh * S + s) * D + d];
+            }
+        }
+    }
+    return output;
+}
+}  // namespace
+
+TEST(scaled_dot_product_attention_gpu_test, fused_from_gemm_softmax_gemm) {
+    auto& engine = get_test_engine();
+
+    const size_t B = 2, H = 2, L = 5, S = 7, D = 8;
+    const float scale = 1.0f / std::sqrt(static_cast<float>(D));
+
+    auto query = engine.allocate_memory({ data_types::f32, format::bfyx, { B, H, D, L } });
+    auto key = engine.allocate_memory({ data_types::f32, format::bfyx, { B, H, D, S } });
+    auto value = engine.allocate_memory({ data_types::f32, format::bfyx, { B, H, D, S } });
+    auto mask = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, S, L } });
+
+    auto query_data = generate_random_1d<float>(B * H * L * D, -1, 1);
+    auto key_data = generate_random_1d<float>(B * H * S * D, -1, 1);
+    auto value_data = generate_random_1d<float>(B * H * S * D, -1, 1);
+    auto mask_data = generate_random_1d<float>(L * S, -2, 0);
+    set_values(query, query_data);
+    set_values(key, key_data);
+    set_values(value, value_data);
+    set_values(mask, mask_data);
+
+    topology topology;
+    topology.add(input_layout("query", query->get_layout()));
+    topology.add(input_layout("key", key->get_layout()));
+    topology.add(input_layout("value", value->get_layout()));
+    topology.add(input_layout("mask", mask->get_layout()));
+    topology.add(gemm("scores", { "query", "key" }, data_types::f32, false, true, scale));
+    topology.add(eltwise("masked_scores", { "scores", "mask" }, eltwise_mode::sum));
+    topology.add(softmax("probs", "masked_scores", softmax::normalize_x));
+    topology.add(gemm("attention", { "probs", "value" }, data_types::f32));
+    topology.add(reorder("output", "attention", format::bfyx, data_types::f32));
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    network network(engine, topology, options);
+
+    network.set_input_data("query", query);
+    network.set_input_data("key", key);
+    network.set_input_data("value", value);
+    network.set_input_data("mask", mask);
+
+    auto outputs = network.execute();
+
+    // the gemm -> eltwise -> softmax -> gemm chain is executed as a single primitive
+    auto executed = network.get_executed_primitives();
+    ASSERT_EQ(executed.count("scores"), 0);
+    ASSERT_EQ(executed.count("probs"), 0);
+    ASSERT_EQ(executed.count("attention"), 0);
+
+    auto output = outputs.at("output").get_memory();
+    cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+
+    auto expected = attention_ref(query_data, key_data, value_data, mask_data, B, H, L, S, D, scale, false);
+    ASSERT_EQ(output_ptr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(expected[i], output_ptr[i], 1e-4f) << "index = " << i;
+    }
+}
+
+TEST(scaled_dot_product_attention_gpu_test, causal) {
+    auto& engine = get_test_engine();
+
+    const size_t B = 1, H = 3, L = 4, S = 6, D = 4;
+    const float scale = 0.5f;
+
+    auto query = engine.allocate_memory({ data_types::f32, format::bfyx, { B, H, D, L } });
+    auto key = engine.allocate_memory({ data_types::f32, format::bfyx, { B, H, D, S } });
+    auto value = engine.allocate_memory({ data_types::f32, format::bfyx, { B, H, D, S } });
+
+    auto query_data = generate_random_1d<float>(B * H * L * D, -1, 1);
+    auto key_data = generate_random_1d<float>(B * H * S * D, -1, 1);
+    auto value_data = generate_random_1d<float>(B * H * S * D, -1, 1);
+    set_values(query, query_data);
+    set_values(key, key_data);
+    set_values(value, value_data);
+
+    topology topology;
+    topology.add(input_layout("query", query->get_layout()));
+    topology.add(input_layout("key", key->get_layout()));
+    topology.add(input_layout("value", value->get_layout()));
+    topology.add(scaled_dot_product_attention("attention", { "query", "key", "value" }, scale, true, true));
+
+    network network(engine, topology);
+
+    network.set_input_data("query", query);
+    network.set_input_data("key", key);
+    network.set_input_data("value", value);
+
+    auto outputs = network.execute();
+
+    auto output = outputs.at("attention").get_memory();
+    cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+
+    auto expected = attention_ref(query_data, key_data, value_data, {}, B, H, L, S, D, scale, true);
+    ASSERT_EQ(output_ptr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(expected[i], output_ptr[i], 1e-4f) << "index = " << i;
+    }
+}
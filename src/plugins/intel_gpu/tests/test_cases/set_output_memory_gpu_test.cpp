@@ -381,3 +381,58 @@ TEST(set_output_memory_gpu, mutable_output_data) {
     network.execute();
     network.set_output_memory("pred/sink_port_0", final_output);
 }
+
+TEST(set_output_memory_gpu, rebinds_arguments_for_new_memory_only) {
+    auto& engine = get_test_engine();
+
+    const int b = 3;
+    const int f = 2;
+    const int y = 5;
+    const int x = 5;
+
+    auto input_data = engine.allocate_memory({ data_types::f32, format::bfyx, { b, f, x, y } });
+    auto input_data_new = engine.allocate_memory({ data_types::f32, format::bfyx, { b, f, x, y } });
+    auto output_mem = engine.allocate_memory({ data_types::f32, format::bfyx, { b, f, x, y } });
+    auto output_mem_new = engine.allocate_memory({ data_types::f32, format::bfyx, { b, f, x, y } });
+
+    const int inputSize = input_data->get_layout().count();
+    auto inputVals = generateVector(inputSize);
+    auto inputValsNew = inputVals;
+    std::reverse(inputValsNew.begin(), inputValsNew.end());
+    set_values(input_data, inputVals);
+    set_values(input_data_new, inputValsNew);
+
+    topology topology;
+    topology.add(input_layout("Input", input_data->get_layout()));
+    topology.add(
+        reorder("reorder", "Input", input_data->get_layout())
+    );
+
+    network network(engine, topology);
+
+    auto check_output = [&](memory::ptr expected_mem, const std::vector<float>& expected) {
+        auto outputs = network.execute();
+        auto output = outputs.at("reorder").get_memory();
+        EXPECT_TRUE(engine.is_the_same_buffer(*expected_mem, *output));
+
+        cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_TRUE(are_equal(expected[i], output_ptr[i])) << i;
+        }
+    };
+
+    network.set_input_data("Input", input_data);
+    network.set_output_memory("reorder", output_mem);
+    check_output(output_mem, inputVals);
+
+    // the arguments bound by the previous execution are reused
+    set_values(input_data, inputValsNew);
+    check_output(output_mem, inputValsNew);
+
+    network.set_input_data("Input", input_data_new);
+    set_values(input_data_new, inputVals);
+    check_output(output_mem, inputVals);
+
+    network.set_output_memory("reorder", output_mem_new);
+    check_output(output_mem_new, inputVals);
+}
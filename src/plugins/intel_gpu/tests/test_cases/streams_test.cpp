@@ -7,6 +7,7 @@
 #include <intel_gpu/primitives/input_layout.hpp>
 #include <intel_gpu/primitives/data.hpp>
 #include <intel_gpu/primitives/mutable_data.hpp>
+#include <intel_gpu/primitives/eltwise.hpp>
 
 using namespace cldnn;
 using namespace ::tests;
@@ -186,3 +187,43 @@ TEST(gpu_streams, check_networks_use_unique_mutable_data_per_stream) {
         }
     }
 }
+
+TEST(gpu_streams, independent_branches_on_multiple_queues) {
+    auto engine = create_test_engine(queue_types::in_order);
+    auto stream = engine->create_stream();
+
+    auto input = engine->allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 4, 1 } });
+    set_values(input, { -2.0f, -1.0f, 1.0f, 2.0f });
+
+    //          input
+    //        /       \
+    //     relu      linear (x / 2)
+    //       |         |
+    //     abs       linear (x + 1)
+    //        \       /
+    //          sum
+    topology topology(
+            input_layout("input", input->get_layout()),
+            activation("relu", "input", activation_func::relu),
+            activation("abs", "relu", activation_func::abs),
+            activation("half", "input", activation_func::linear, activation_additional_params{ 0.5f, 0.f }),
+            activation("shifted", "half", activation_func::linear, activation_additional_params{ 1.f, 1.f }),
+            eltwise("sum", { "abs", "shifted" }, eltwise_mode::sum));
+
+    build_options options;
+    options.set_option(build_option::queues_num(2));
+    network network(*engine, topology, options);
+
+    for (int iter = 0; iter < 3; ++iter) {
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        auto output_memory = outputs.at("sum").get_memory();
+        cldnn::mem_lock<float> output_ptr(output_memory, *stream);
+
+        VF<float> output_vec = { 0.0f, 0.5f, 2.5f, 4.0f };
+        for (size_t i = 0; i < output_vec.size(); ++i) {
+            EXPECT_FLOAT_EQ(output_vec[i], output_ptr[i]);
+        }
+    }
+}
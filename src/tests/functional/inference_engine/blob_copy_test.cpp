@@ -472,3 +472,42 @@ INSTANTIATE_TEST_SUITE_P(accuracy, BlobCopySetLayoutTest,
     ::testing::Combine(::testing::ValuesIn(BlobCopySetLayout_Dims),
                        ::testing::ValuesIn(BlobCopySetLayout_Precisions)));
 
+
+TEST(BlobCopyNDTest, BlobCopyWithTransposedOrderAndPaddedStrides) {
+    // 6D blobs: the source is dense in the order of its dims,
+    // the destination has the dims 1 and 5 swapped and the padded rows
+    const SizeVector dims = {2, 5, 3, 1, 4, 37};
+    const SizeVector dstOrder = {0, 5, 2, 3, 4, 1};
+    const SizeVector dstBlkDims = {2, 37, 3, 1, 4, 5};
+    SizeVector dstStrides(dstBlkDims.size());
+    size_t dstSize = 1;
+    for (size_t i = dstBlkDims.size(); i-- > 0;) {
+        dstStrides[i] = dstSize;
+        dstSize *= dstBlkDims[i] + (i == 4 ? 3 : 0);
+    }
+
+    auto src = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, TensorDesc::getLayoutByDims(dims)));
+    src->allocate();
+    auto dstData = std::vector<float>(dstSize, -1.f);
+    auto dst = make_shared_blob<float>(
+        TensorDesc(Precision::FP32, dims, BlockingDesc(dstBlkDims, dstOrder, 0, SizeVector(dims.size(), 0), dstStrides)),
+        dstData.data(),
+        dstData.size());
+    auto srcData = src->buffer().as<float*>();
+    for (size_t i = 0; i < src->size(); i++)
+        srcData[i] = static_cast<float>(i);
+
+    blob_copy(src, dst);
+
+    size_t i = 0;
+    for (size_t d0 = 0; d0 < dims[0]; d0++)
+        for (size_t d1 = 0; d1 < dims[1]; d1++)
+            for (size_t d2 = 0; d2 < dims[2]; d2++)
+                for (size_t d3 = 0; d3 < dims[3]; d3++)
+                    for (size_t d4 = 0; d4 < dims[4]; d4++)
+                        for (size_t d5 = 0; d5 < dims[5]; d5++, i++) {
+                            const size_t dstIdx = d0 * dstStrides[0] + d5 * dstStrides[1] + d2 * dstStrides[2] +
+                                                  d3 * dstStrides[3] + d4 * dstStrides[4] + d1 * dstStrides[5];
+                            ASSERT_EQ(srcData[i], dstData[dstIdx]) << "element " << i;
+                        }
+}
@@ -8,6 +8,7 @@
 #include <thread>
 #include <chrono>
 #include <mutex>
+#include <fstream>
 #include <functional>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -15,6 +16,7 @@
 #include "ie_core.hpp"
 #include "ngraph/function.hpp"
 #include "ie_metric_helpers.hpp"
+#include "ie_mapped_memory_stream.hpp"
 #include "openvino/op/logical_not.hpp"
 
 #include "ie_remote_context.hpp"
@@ -561,6 +563,97 @@ TEST_P(CachingTest, TestLoadCustomImportExport) {
     }
 }
 
+// Brief: the cached blob is imported from the mapped file, the plugin can refer to its data in place
+TEST_P(CachingTest, TestLoadMappedBlob) {
+    const char customData[] = {1, 2, 3, 4, 5};
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    auto importMapped = [&](std::istream& s) {
+        auto mappedStream = dynamic_cast<MappedMemoryStream*>(&s);
+        EXPECT_NE(mappedStream, nullptr);
+        if (mappedStream) {
+            auto blob = mappedStream->makeBlob(static_cast<size_t>(s.tellg()), sizeof(customData));
+            auto data = blob->cbuffer().as<const char*>();
+            EXPECT_EQ(memcmp(data, customData, sizeof(customData)), 0);
+            // no copy of the data
+            EXPECT_EQ(data, mappedStream->memory()->data() + static_cast<size_t>(s.tellg()));
+        }
+        s.seekg(sizeof(customData), std::ios_base::cur);
+        std::string name;
+        s >> name;
+        std::lock_guard<std::mutex> lock(mock_creation_mutex);
+        return createMockIExecutableNet({}, m_inputs_map[name], m_outputs_map[name]);
+    };
+    ON_CALL(*mockPlugin, ImportNetwork(_, _, _)).
+            WillByDefault(Invoke([&](std::istream& s, const RemoteContext::Ptr&,
+                                     const std::map<std::string, std::string> &) {
+        return importMapped(s);
+    }));
+
+    ON_CALL(*mockPlugin, ImportNetwork(_, _)).
+            WillByDefault(Invoke([&](std::istream &s, const std::map<std::string, std::string> &) {
+        return importMapped(s);
+    }));
+
+    m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+        ON_CALL(net, Export(_)).WillByDefault(Invoke([&] (std::ostream& s) {
+            s.write(customData, sizeof(customData));
+            s << net.get_model()->get_friendly_name();
+        }));
+    });
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            m_testFunction(ie);
+        });
+    }
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            m_testFunction(ie);
+        });
+    }
+}
+
+// Brief: the network exported to a file (e.g. in the shared memory) is imported by its path from the mapped file
+TEST_P(CachingTest, TestImportMappedFile) {
+    const char customData[] = {1, 2, 3, 4, 5};
+    const auto blobFileName = m_cacheDir + "/exported.blob";
+    {
+        std::ofstream blobFile(blobFileName, std::ios::binary);
+        blobFile.write(customData, sizeof(customData));
+    }
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(1).
+            WillOnce(Invoke([&](std::istream &s, const std::map<std::string, std::string> &) {
+        auto mappedStream = dynamic_cast<MappedMemoryStream*>(&s);
+        EXPECT_NE(mappedStream, nullptr);
+        if (mappedStream) {
+            EXPECT_EQ(mappedStream->memory()->size(), sizeof(customData));
+            EXPECT_EQ(memcmp(mappedStream->memory()->data(), customData, sizeof(customData)), 0);
+        }
+        return createMockIExecutableNet({}, {}, {});
+    }));
+    testLoad([&](Core &ie) {
+        ie.ImportNetwork(blobFileName, deviceToLoad);
+    });
+}
+
 // Brief: when LoadNetwork is called from different config - old cache shall not be used
 TEST_P(CachingTest, TestChangeLoadConfig) {
     const std::string CUSTOM_KEY = "CUSTOM_KEY";
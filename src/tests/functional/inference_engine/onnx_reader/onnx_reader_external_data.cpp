@@ -14,6 +14,7 @@
 #include <streambuf>
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/unicode_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include <ngraph/ngraph.hpp>
 
 TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromFile) {
@@ -49,6 +50,80 @@ TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromFile) {
     ASSERT_TRUE(external_data_node_const->get_vector<float>() == (std::vector<float>{1, 2, 3, 4}));
 }
 
+TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromConvertedModelsCache) {
+    const std::string cacheDir = "onnx_reader_converted_models_cache";
+    CommonTestUtils::removeFilesWithExt(cacheDir, "xml");
+    CommonTestUtils::removeFilesWithExt(cacheDir, "bin");
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}, {CONFIG_KEY_INTERNAL(CACHE_CONVERTED_MODELS), CONFIG_VALUE(YES)}});
+    const auto path = CommonTestUtils::getModelFromTestModelZoo(
+        std::string(ONNX_TEST_MODELS) + "onnx_external_data.onnx");
+
+    const auto converted = ie.ReadNetwork(path).getFunction();
+    ASSERT_EQ(CommonTestUtils::listFilesWithExt(cacheDir, "xml").size(), 1);
+    const auto cached = ie.ReadNetwork(path).getFunction();
+    CommonTestUtils::removeFilesWithExt(cacheDir, "xml");
+    CommonTestUtils::removeFilesWithExt(cacheDir, "bin");
+    CommonTestUtils::removeDir(cacheDir);
+
+    ASSERT_EQ(converted->get_ops().size(), cached->get_ops().size());
+    ASSERT_EQ(cached->get_output_shape(0), ngraph::Shape({2, 2}));
+    std::shared_ptr<ngraph::op::Constant> external_data_node_const;
+    for (auto op : cached->get_ops()) {
+        if (auto constant = ngraph::as_type_ptr<ngraph::op::Constant>(op))
+            external_data_node_const = constant;
+    }
+    ASSERT_NE(external_data_node_const, nullptr);
+    ASSERT_TRUE(external_data_node_const->get_vector<float>() == (std::vector<float>{1, 2, 3, 4}));
+}
+
+TEST(ONNX_Reader_Tests, ConvertedModelsCacheDependsOnExternalData) {
+    const std::string cacheDir = "onnx_reader_converted_models_cache_external_data";
+    const std::string modelDir = "onnx_reader_converted_models_external_data_model";
+    CommonTestUtils::createDirectoryRecursive(modelDir + "/data");
+    const auto srcPath = CommonTestUtils::getModelFromTestModelZoo(
+        std::string(ONNX_TEST_MODELS) + "onnx_external_data.onnx");
+    const auto srcDir = srcPath.substr(0, srcPath.find_last_of("/\\"));
+    const auto copyFile = [](const std::string& from, const std::string& to) {
+        std::ifstream src(from, std::ios::binary);
+        std::ofstream dst(to, std::ios::binary);
+        dst << src.rdbuf();
+    };
+    const auto path = modelDir + "/onnx_external_data.onnx";
+    copyFile(srcPath, path);
+    copyFile(srcDir + "/data/tensor.data", modelDir + "/data/tensor.data");
+
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}, {CONFIG_KEY_INTERNAL(CACHE_CONVERTED_MODELS), CONFIG_VALUE(YES)}});
+    ie.ReadNetwork(path);
+
+    // the model file is the same, but the cached model must not be used for the new external data
+    const std::vector<float> newData{5, 6, 7, 8};
+    {
+        std::ofstream data(modelDir + "/data/tensor.data", std::ios::binary);
+        data.write(reinterpret_cast<const char*>(newData.data()), newData.size() * sizeof(float));
+    }
+    const auto function = ie.ReadNetwork(path).getFunction();
+    const auto cachedModels = CommonTestUtils::listFilesWithExt(cacheDir, "xml").size();
+
+    CommonTestUtils::removeFilesWithExt(cacheDir, "xml");
+    CommonTestUtils::removeFilesWithExt(cacheDir, "bin");
+    CommonTestUtils::removeDir(cacheDir);
+    CommonTestUtils::removeFile(modelDir + "/data/tensor.data");
+    CommonTestUtils::removeFile(path);
+    CommonTestUtils::removeDir(modelDir + "/data");
+    CommonTestUtils::removeDir(modelDir);
+
+    ASSERT_EQ(cachedModels, 2);
+    std::shared_ptr<ngraph::op::Constant> external_data_node_const;
+    for (auto op : function->get_ops()) {
+        if (auto constant = ngraph::as_type_ptr<ngraph::op::Constant>(op))
+            external_data_node_const = constant;
+    }
+    ASSERT_NE(external_data_node_const, nullptr);
+    ASSERT_TRUE(external_data_node_const->get_vector<float>() == newData);
+}
+
 TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromStringException) {
     InferenceEngine::Core ie;
     const auto path = CommonTestUtils::getModelFromTestModelZoo(
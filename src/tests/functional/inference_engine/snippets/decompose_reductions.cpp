@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset6.hpp>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/decompose_reductions.hpp>
+
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+TEST(TransformationTests, DecomposeSoftmax) {
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 17});
+        auto softmax = std::make_shared<opset1::Softmax>(data, 2);
+        f = std::make_shared<Function>(NodeVector{softmax}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::DecomposeReductions>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<opset1::Softmax>(f), 0);
+    ASSERT_EQ(count_ops_of_type<snippets::op::ReduceMax>(f), 1);
+    ASSERT_EQ(count_ops_of_type<snippets::op::ReduceSum>(f), 1);
+    ASSERT_EQ(f->get_results()[0]->get_shape(), (Shape{2, 3, 17}));
+}
+
+TEST(TransformationTests, DecomposeMVN) {
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 17});
+        auto axes = opset1::Constant::create(element::i64, Shape{1}, {-1});
+        auto mvn = std::make_shared<opset6::MVN>(data, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+        f = std::make_shared<Function>(NodeVector{mvn}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::DecomposeReductions>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<opset6::MVN>(f), 0);
+    // mean and variance
+    ASSERT_EQ(count_ops_of_type<snippets::op::ReduceSum>(f), 2);
+    ASSERT_EQ(count_ops_of_type<opset1::Sqrt>(f), 1);
+    ASSERT_EQ(f->get_results()[0]->get_shape(), (Shape{2, 3, 17}));
+}
@@ -285,3 +285,88 @@ TEST(TransformationTests, DontAttachToSubgraphIfLoop) {
     auto res = compare_functions(f, f_ref);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, TokenizeSoftmaxByInnermostAxis) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Model> f(nullptr);
+    {
+        auto data0 = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 16});
+        auto data1 = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 16});
+        auto add = std::make_shared<op::v1::Add>(data0, data1);
+        auto softmax = std::make_shared<op::v1::Softmax>(add, 2);
+        auto relu = std::make_shared<op::v0::Relu>(softmax);
+        f = std::make_shared<Model>(NodeVector{relu}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<InitNodeInfo>();
+        m.register_pass<EnumerateNodes>();
+        m.register_pass<TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Softmax>(f), 0);
+}
+
+TEST(TransformationTests, DoNotTokenizeSoftmaxByOuterAxis) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Model> f(nullptr);
+    {
+        auto data0 = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 16});
+        auto data1 = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 16});
+        auto add = std::make_shared<op::v1::Add>(data0, data1);
+        auto softmax = std::make_shared<op::v1::Softmax>(add, 1);
+        auto relu = std::make_shared<op::v0::Relu>(softmax);
+        f = std::make_shared<Model>(NodeVector{relu}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<InitNodeInfo>();
+        m.register_pass<EnumerateNodes>();
+        m.register_pass<TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::v1::Softmax>(f), 1);
+}
+
+TEST(TransformationTests, TokenizeDynamicShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Model> f(nullptr);
+    {
+        auto data0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 3, -1});
+        auto data1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 1, -1});
+        auto add = std::make_shared<op::v1::Add>(data0, data1);
+        auto relu = std::make_shared<op::v0::Relu>(add);
+        auto mul = std::make_shared<op::v1::Multiply>(relu, data0);
+        f = std::make_shared<Model>(NodeVector{mul}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<InitNodeInfo>();
+        m.register_pass<EnumerateNodes>();
+        m.register_pass<TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 1);
+}
+
+TEST(TransformationTests, DoNotTokenizeDynamicRank) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Model> f(nullptr);
+    {
+        auto data0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+        auto data1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+        auto add = std::make_shared<op::v1::Add>(data0, data1);
+        auto relu = std::make_shared<op::v0::Relu>(add);
+        f = std::make_shared<Model>(NodeVector{relu}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<InitNodeInfo>();
+        m.register_pass<EnumerateNodes>();
+        m.register_pass<TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 0);
+}
@@ -2,13 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
 #include <future>
+#include <mutex>
 
 #include <gtest/gtest.h>
 
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <threading/ie_streams_scheduler.hpp>
 #include <ie_system_conf.h>
 #include <thread>
 
@@ -106,6 +110,28 @@ TEST_P(TaskExecutorTests, canRunMultipleTasksFromMultipleThreads) {
     for (auto&& thread : threads) if (thread.joinable()) thread.join();
 }
 
+TEST_P(TaskExecutorTests, canRunTasksPushedFromTasks) {
+    auto taskExecutor = GetParam()();
+    std::atomic<int> executed{0};
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        auto promise = std::make_shared<std::promise<void>>();
+        futures.emplace_back(promise->get_future());
+        taskExecutor->run([taskExecutor, promise, &executed] {
+            executed++;
+            // e.g. the next stage of the pipeline, which the same stream executes first
+            taskExecutor->run([promise, &executed] {
+                executed++;
+                promise->set_value();
+            });
+        });
+    }
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    ASSERT_EQ(2 * MAX_NUMBER_OF_TASKS_IN_QUEUE, executed);
+}
+
 TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     std::mutex mutex_block_emulation;
     std::condition_variable cv_block_emulation;
@@ -189,6 +215,142 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+class StreamsSchedulerTests : public ::testing::Test {};
+
+TEST_F(StreamsSchedulerTests, higherPriorityModelTasksGoFirst) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestStreamsScheduler", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    auto scheduler = std::make_shared<StreamsScheduler>(executor, 1);
+    auto lowPriority = scheduler->CreateModelExecutor(1, 1);
+    auto highPriority = scheduler->CreateModelExecutor(0, 1);
+
+    // the only stream is busy, so the following tasks wait in the queues of their models
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto busy = async(lowPriority, [released] { released.wait(); });
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<Future> futures;
+    for (int i = 0; i < 3; ++i) {
+        futures.emplace_back(async(lowPriority, [&] { std::lock_guard<std::mutex> l{mutex}; order.push_back(1); }));
+        futures.emplace_back(async(highPriority, [&] { std::lock_guard<std::mutex> l{mutex}; order.push_back(0); }));
+    }
+    release.set_value();
+    busy.wait();
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    ASSERT_EQ((std::vector<int>{0, 0, 0, 1, 1, 1}), order);
+}
+
+TEST_F(StreamsSchedulerTests, modelsOfSamePriorityShareStreamsByWeights) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestStreamsScheduler", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    auto scheduler = std::make_shared<StreamsScheduler>(executor, 1);
+    auto light = scheduler->CreateModelExecutor(0, 1);
+    auto heavy = scheduler->CreateModelExecutor(0, 3);
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto busy = async(light, [released] { released.wait(); });
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<Future> futures;
+    auto task = [&](int model) {
+        return [&, model] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            std::lock_guard<std::mutex> l{mutex};
+            order.push_back(model);
+        };
+    };
+    for (int i = 0; i < 8; ++i) {
+        futures.emplace_back(async(light, task(1)));
+        futures.emplace_back(async(heavy, task(3)));
+    }
+    release.set_value();
+    busy.wait();
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    // while both models have the tasks, the heavier one runs about 3 times more of them
+    auto heavyTasks = std::count(order.begin(), order.begin() + 8, 3);
+    ASSERT_GE(heavyTasks, 5);
+}
+
+class CPUStreamsExecutorPriorityTests : public ::testing::Test {};
+
+template<typename F>
+static std::future<void> asyncWithPriority(const IStreamsExecutor::Ptr& executor, F&& f,
+                                           IStreamsExecutor::TaskPriority priority, const void* group) {
+    auto p = std::make_shared<std::packaged_task<void()>>(f);
+    auto future = p->get_future();
+    executor->runWithPriority([p] {(*p)();}, priority, group);
+    return future;
+}
+
+TEST_F(CPUStreamsExecutorPriorityTests, higherPriorityTasksGoFirst) {
+    IStreamsExecutor::Ptr executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestStreamsPriority", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+
+    // the only stream is busy, so the following tasks wait in the queues
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto busy = async(executor, [released] { released.wait(); });
+    std::mutex mutex;
+    std::vector<IStreamsExecutor::TaskPriority> order;
+    std::vector<Future> futures;
+    for (auto priority : {IStreamsExecutor::TaskPriority::LOW,
+                          IStreamsExecutor::TaskPriority::NORMAL,
+                          IStreamsExecutor::TaskPriority::HIGH}) {
+        futures.emplace_back(asyncWithPriority(executor, [&, priority] {
+            std::lock_guard<std::mutex> l{mutex};
+            order.push_back(priority);
+        }, priority, nullptr));
+    }
+    release.set_value();
+    busy.wait();
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    ASSERT_EQ((std::vector<IStreamsExecutor::TaskPriority>{IStreamsExecutor::TaskPriority::HIGH,
+                                                           IStreamsExecutor::TaskPriority::NORMAL,
+                                                           IStreamsExecutor::TaskPriority::LOW}), order);
+}
+
+TEST_F(CPUStreamsExecutorPriorityTests, highPriorityTaskPreemptsTaskOfAnotherGroup) {
+    IStreamsExecutor::Ptr executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestStreamsPriority", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    int lowGroup = 0, highGroup = 0;
+
+    std::promise<void> start, queue;
+    auto queued = queue.get_future().share();
+    std::atomic<bool> sameGroupDone{false}, highDone{false};
+    bool preempted = false, preemptedAgain = true, sameGroupDoneOnResume = true, highDoneOnResume = false;
+    auto low = asyncWithPriority(executor, [&, queued] {
+        start.set_value();
+        queued.wait();
+        preempted = executor->Preempt();
+        preemptedAgain = executor->Preempt();
+        sameGroupDoneOnResume = sameGroupDone;
+        highDoneOnResume = highDone;
+    }, IStreamsExecutor::TaskPriority::LOW, &lowGroup);
+    start.get_future().wait();
+    auto sameGroup = asyncWithPriority(executor, [&] { sameGroupDone = true; },
+                                       IStreamsExecutor::TaskPriority::HIGH, &lowGroup);
+    auto high = asyncWithPriority(executor, [&] { highDone = true; }, IStreamsExecutor::TaskPriority::HIGH, &highGroup);
+    queue.set_value();
+    low.wait();
+    high.wait();
+    sameGroup.wait();
+    // the running task executes the waiting task of the other group only and then resumes
+    ASSERT_TRUE(preempted);
+    ASSERT_FALSE(preemptedAgain);
+    ASSERT_FALSE(sameGroupDoneOnResume);
+    ASSERT_TRUE(highDoneOnResume);
+    // the preemption is not available outside of the streams
+    ASSERT_FALSE(executor->Preempt());
+}
+
 TEST_F(StreamsExecutorConfigTest, streamsExecutorConfigReturnStrings) {
     auto streams = getNumberOfCPUCores();
     auto threads = parallel_get_max_threads();
@@ -218,8 +380,23 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._spinWaitUs = 100;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                               streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+        return std::make_shared<StreamsScheduler>(executor, streams)->CreateModelExecutor(0, 1);
     }
 );
 
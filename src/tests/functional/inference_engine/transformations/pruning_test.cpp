@@ -699,3 +699,71 @@ TEST(TransformationTests, TestConcatMaskPropagationUpEmpty) {
 
     compare_masks(*getMask(concat->output(0)),  Mask({{}, {}, {}, {}}));
 }
+
+
+TEST(TransformationTests, TestReshapeMaskPropagation) {
+    Shape input_shape{1, 3, 16, 16};
+    Shape weights_shape1{8, 3, 3, 3};
+    Shape weights_shape2{6, 8, 3, 3};
+
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights_1 = create_constant_with_zeros(weights_shape1, {{1, 2, 5}, {}, {}, {}});
+    auto conv1 = std::make_shared<opset5::Convolution>(input, weights_1, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+
+    auto reshape1 = std::make_shared<opset5::Reshape>(conv1, opset5::Constant::create(element::i64, Shape{3}, {1, 8, 196}), false);
+    auto relu = std::make_shared<opset5::Relu>(reshape1);
+    auto reshape2 = std::make_shared<opset5::Reshape>(relu, opset5::Constant::create(element::i64, Shape{4}, {1, 8, 14, 14}), true);
+
+    auto weights_2 = opset5::Constant::create(element::f32, weights_shape2, {1});
+    auto conv2 = std::make_shared<opset5::Convolution>(reshape2, weights_2, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+
+    auto f = std::make_shared<Function>(NodeVector{conv2}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights_1.get_node_shared_ptr()->output(0)),  Mask({{1, 2, 5}, {}, {}, {}}));
+    compare_masks(*getMask(conv1->output(0)),  Mask({{}, {1, 2, 5}, {}, {}}));
+    compare_masks(*getMask(reshape1->output(0)),  Mask({{}, {1, 2, 5}, {}}));
+    compare_masks(*getMask(relu->output(0)),  Mask({{}, {1, 2, 5}, {}}));
+    compare_masks(*getMask(reshape2->output(0)),  Mask({{}, {1, 2, 5}, {}, {}}));
+    compare_masks(*getMask(weights_2->output(0)),  Mask({{}, {1, 2, 5}, {}, {}}));
+    compare_masks(*getMask(conv2->output(0)),  Mask({{}, {}, {}, {}}));
+
+    pass::Manager shrink;
+    shrink.register_pass<pass::ShrinkWeights>();
+    shrink.run_passes(f);
+
+    ASSERT_EQ(conv1->get_output_shape(0), Shape({1, 5, 14, 14}));
+    ASSERT_EQ(reshape1->get_output_shape(0), Shape({1, 5, 196}));
+    ASSERT_EQ(reshape2->get_output_shape(0), Shape({1, 5, 14, 14}));
+    ASSERT_EQ(conv2->get_output_shape(0), Shape({1, 6, 12, 12}));
+}
+
+
+TEST(TransformationTests, TestReshapeMaskPropagationStopsOnChannelsChange) {
+    Shape input_shape{1, 3, 16, 16};
+    Shape weights_shape{8, 3, 3, 3};
+
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights = create_constant_with_zeros(weights_shape, {{1, 2, 5}, {}, {}, {}});
+    auto conv = std::make_shared<opset5::Convolution>(input, weights, Strides(2, 1),
+                                                      CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+
+    // Flattening of the channels with the spatial dims can't be pruned by channels
+    auto reshape = std::make_shared<opset5::Reshape>(conv, opset5::Constant::create(element::i64, Shape{2}, {1, -1}), true);
+
+    auto f = std::make_shared<Function>(NodeVector{reshape}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights.get_node_shared_ptr()->output(0)),  Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)),  Mask({{}, {}, {}, {}}));
+}
@@ -312,4 +312,139 @@ TEST_F(TransformationTestsF, TransposeConvertNegativeConsumers) {
         function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ convert, transpose }, ngraph::ParameterVector{ input });
         manager.register_pass<ngraph::pass::TransposeConvert>();
     }
-}
\ No newline at end of file
+}
+TEST_F(TransformationTestsF, TransposeUnary) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto relu = std::make_shared<ngraph::opset6::Relu>(transpose);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu }, ngraph::ParameterVector{ input });
+        manager.register_pass<ngraph::pass::TransposeUnary>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto relu = std::make_shared<ngraph::opset6::Relu>(input);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(relu, order);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeBinaryEltwise) {
+    {
+        auto input_a = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto input_b = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 1, 16 });
+        auto order_a = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto order_b = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose_a = std::make_shared<ngraph::opset6::Transpose>(input_a, order_a);
+        auto transpose_b = std::make_shared<ngraph::opset6::Transpose>(input_b, order_b);
+        auto add = std::make_shared<ngraph::opset6::Add>(transpose_a, transpose_b);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ add }, ngraph::ParameterVector{ input_a, input_b });
+        manager.register_pass<ngraph::pass::TransposeBinaryEltwise>();
+    }
+
+    {
+        auto input_a = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto input_b = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 1, 16 });
+        auto add = std::make_shared<ngraph::opset6::Add>(input_a, input_b);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(add, order);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input_a, input_b });
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeBinaryEltwiseNegativeOrders) {
+    {
+        auto input_a = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto input_b = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 3, 16 });
+        auto order_a = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto order_b = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 1, 3, 2 });
+        auto transpose_a = std::make_shared<ngraph::opset6::Transpose>(input_a, order_a);
+        auto transpose_b = std::make_shared<ngraph::opset6::Transpose>(input_b, order_b);
+        auto add = std::make_shared<ngraph::opset6::Add>(transpose_a, transpose_b);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ add }, ngraph::ParameterVector{ input_a, input_b });
+        manager.register_pass<ngraph::pass::TransposeBinaryEltwise>();
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeConcat) {
+    {
+        auto input_a = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto input_b = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 5, 16, 16 });
+        auto order_a = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto order_b = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose_a = std::make_shared<ngraph::opset6::Transpose>(input_a, order_a);
+        auto transpose_b = std::make_shared<ngraph::opset6::Transpose>(input_b, order_b);
+        auto concat = std::make_shared<ngraph::opset6::Concat>(ngraph::OutputVector{ transpose_a, transpose_b }, -1);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ concat }, ngraph::ParameterVector{ input_a, input_b });
+        manager.register_pass<ngraph::pass::TransposeConcat>();
+    }
+
+    {
+        auto input_a = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto input_b = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 5, 16, 16 });
+        auto concat = std::make_shared<ngraph::opset6::Concat>(ngraph::OutputVector{ input_a, input_b }, 1);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(concat, order);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input_a, input_b });
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeSplitEliminatesTransposes) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 4, 16, 16 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto axis = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 3 });
+        auto split = std::make_shared<ngraph::opset6::Split>(transpose, axis, 2);
+        auto back_order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose_0 = std::make_shared<ngraph::opset6::Transpose>(split->output(0), back_order);
+        auto transpose_1 = std::make_shared<ngraph::opset6::Transpose>(split->output(1), back_order);
+        auto relu_0 = std::make_shared<ngraph::opset6::Relu>(transpose_0);
+        auto relu_1 = std::make_shared<ngraph::opset6::Relu>(transpose_1);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu_0, relu_1 }, ngraph::ParameterVector{ input });
+        manager.register_pass<ngraph::pass::TransposeSinking>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 4, 16, 16 });
+        auto axis = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 1 });
+        auto split = std::make_shared<ngraph::opset6::Split>(input, axis, 2);
+        auto relu_0 = std::make_shared<ngraph::opset6::Relu>(split->output(0));
+        auto relu_1 = std::make_shared<ngraph::opset6::Relu>(split->output(1));
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu_0, relu_1 }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST(TransformationTests, TransposeSinkingReportsEliminatedTransposes) {
+    auto input_a = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+    auto input_b = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+    auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+    auto transpose_a = std::make_shared<ngraph::opset6::Transpose>(input_a, order);
+    auto transpose_b = std::make_shared<ngraph::opset6::Transpose>(input_b, order);
+    auto relu = std::make_shared<ngraph::opset6::Relu>(transpose_a);
+    auto mul = std::make_shared<ngraph::opset6::Multiply>(relu, transpose_b);
+    auto back_order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+    auto transpose_back = std::make_shared<ngraph::opset6::Transpose>(mul, back_order);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose_back }, ngraph::ParameterVector{ input_a, input_b });
+
+    ngraph::pass::Manager manager;
+    auto transpose_sinking = manager.register_pass<ngraph::pass::TransposeSinking>();
+    manager.run_passes(f);
+
+    ASSERT_EQ(transpose_sinking->get_eliminated_transposes_count(), 3u);
+    for (const auto& op : f->get_ops()) {
+        ASSERT_FALSE(ngraph::is_type<ngraph::opset6::Transpose>(op)) << op;
+    }
+}
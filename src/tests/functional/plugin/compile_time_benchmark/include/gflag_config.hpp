@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gflags/gflags.h>
+#include <iostream>
+
+static const char help_message[] = "Print a usage message.";
+static const char devices_message[] = "Optional. Comma separated list of devices to compile the models on. "
+                                      "Devices which are not available are skipped";
+static const char filter_message[] = "Optional. Regular expression, only the topologies with matching names are measured";
+static const char onnx_models_message[] = "Optional. Comma separated paths to ONNX models to measure in addition "
+                                          "to the synthetic topologies";
+static const char niter_message[] = "Optional. Number of repetitions of every phase, the median time is reported";
+static const char work_dir_message[] = "Optional. Path to the folder where the IRs of the synthetic topologies are serialized";
+static const char output_message[] = "Optional. Path to the JSON file to write the results";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(d, "CPU,GPU", devices_message);
+DEFINE_string(filter, ".*", filter_message);
+DEFINE_string(onnx_models, "", onnx_models_message);
+DEFINE_uint32(niter, 3, niter_message);
+DEFINE_string(work_dir, ".", work_dir_message);
+DEFINE_string(output, "compile_time.json", output_message);
+
+/**
+* @brief This function shows a help message
+*/
+static void showUsage() {
+    std::cout << "\n";
+    std::cout << "Compile Time Benchmark [OPTION]\n";
+    std::cout << "Options:\n";
+    std::cout << "\n";
+    std::cout << "    -h                                     " << help_message << "\n";
+    std::cout << "    --d \"<devices>\"                        " << devices_message << "\n";
+    std::cout << "    --filter \"<regex>\"                     " << filter_message << "\n";
+    std::cout << "    --onnx_models \"<paths>\"                " << onnx_models_message << "\n";
+    std::cout << "    --niter \"<value>\"                      " << niter_message << "\n";
+    std::cout << "    --work_dir \"<path>\"                    " << work_dir_message << "\n";
+    std::cout << "    --output \"<path>\"                      " << output_message << "\n";
+    std::cout << std::flush;
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace CompileTimeBenchmark {
+
+/**
+ * @brief Time and memory of a single run of a phase
+ */
+struct PhaseMeasurement {
+    double timeMs = 0;
+    size_t peakRssKb = 0;    // peak resident set size reached during the phase
+    size_t rssDeltaKb = 0;   // resident set size kept after the phase
+};
+
+/**
+ * @brief Measures the time and the peak RSS of a phase
+ *
+ * On Linux the peak RSS of the process is reset at the start of the phase, so the
+ * peak belongs to the phase only. Other systems can't reset it and report the
+ * peak of the process reached by the end of the phase.
+ */
+class PhaseMeter {
+public:
+    PhaseMeter();
+
+    PhaseMeasurement stop() const;
+
+private:
+    std::chrono::steady_clock::time_point start;
+    size_t startRssKb;
+};
+
+size_t getRssKb();
+
+size_t getPeakRssKb();
+
+}  // namespace CompileTimeBenchmark
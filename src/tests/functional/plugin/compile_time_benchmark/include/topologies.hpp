@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <openvino/core/model.hpp>
+
+namespace CompileTimeBenchmark {
+
+/**
+ * @brief Synthetic topology measured by the benchmark
+ */
+struct Topology {
+    std::string name;
+    std::function<std::shared_ptr<ov::Model>()> create;
+};
+
+/**
+ * @brief Returns the curated set of synthetic topologies: small subgraphs of the
+ * functional tests and deep CNN, transformer and recurrent models built from the
+ * same builders, so both per-node overheads and graph-size dependent costs are covered
+ */
+std::vector<Topology> getTopologies();
+
+}  // namespace CompileTimeBenchmark
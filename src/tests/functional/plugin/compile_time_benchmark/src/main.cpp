@@ -0,0 +1,215 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <sstream>
+
+#include <ngraph/graph_util.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/core.hpp>
+#include <transformations/common_optimizations/common_optimizations.hpp>
+#include <transformations/common_optimizations/moc_transformations.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+
+#include "gflag_config.hpp"
+#include "phase_meter.hpp"
+#include "topologies.hpp"
+
+using namespace CompileTimeBenchmark;
+
+namespace {
+
+struct PhaseResult {
+    std::string name;
+    std::vector<PhaseMeasurement> runs;
+};
+
+struct ModelResult {
+    std::string name;
+    std::string frontend;
+    std::vector<PhaseResult> phases;
+
+    PhaseResult& phase(const std::string& phaseName) {
+        for (auto& phase : phases) {
+            if (phase.name == phaseName)
+                return phase;
+        }
+        phases.push_back({phaseName, {}});
+        return phases.back();
+    }
+};
+
+std::vector<std::string> splitList(const std::string& s) {
+    std::vector<std::string> result;
+    std::stringstream ss(s);
+    for (std::string item; std::getline(ss, item, ',');) {
+        if (!item.empty())
+            result.push_back(item);
+    }
+    return result;
+}
+
+template <typename T>
+T median(std::vector<T> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+/**
+ * @brief Runs the phases after the frontend: the offline and the common transformations
+ * on copies of the model and the compilation on every device
+ */
+void measureCompilation(ov::runtime::Core& core, const std::shared_ptr<ov::Model>& model,
+                        const std::vector<std::string>& devices, ModelResult& result) {
+    {
+        auto copy = ngraph::clone_function(*model);
+        PhaseMeter meter;
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::MOCTransformations>(false);
+        manager.run_passes(copy);
+        result.phase("transformations_moc").runs.push_back(meter.stop());
+    }
+    {
+        auto copy = ngraph::clone_function(*model);
+        PhaseMeter meter;
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::CommonOptimizations>();
+        manager.run_passes(copy);
+        result.phase("transformations_common").runs.push_back(meter.stop());
+    }
+    for (const auto& device : devices) {
+        PhaseMeter meter;
+        auto compiledModel = core.compile_model(model, device);
+        result.phase("compile_model_" + device).runs.push_back(meter.stop());
+    }
+}
+
+ModelResult measureTopology(ov::runtime::Core& core, const Topology& topology, const std::vector<std::string>& devices) {
+    ModelResult result{topology.name, "ir", {}};
+    const auto xml = FLAGS_work_dir + "/" + topology.name + ".xml";
+    const auto bin = FLAGS_work_dir + "/" + topology.name + ".bin";
+    for (size_t i = 0; i < FLAGS_niter; ++i) {
+        {
+            PhaseMeter meter;
+            auto model = topology.create();
+            result.phase("build").runs.push_back(meter.stop());
+
+            PhaseMeter serializeMeter;
+            ngraph::pass::Manager manager;
+            manager.register_pass<ov::pass::Serialize>(xml, bin);
+            manager.run_passes(model);
+            result.phase("serialize_ir").runs.push_back(serializeMeter.stop());
+        }
+
+        std::shared_ptr<ov::Model> model;
+        {
+            PhaseMeter meter;
+            model = core.read_model(xml);
+            result.phase("read_model").runs.push_back(meter.stop());
+        }
+        measureCompilation(core, model, devices, result);
+    }
+    CommonTestUtils::removeIRFiles(xml, bin);
+    return result;
+}
+
+ModelResult measureOnnxModel(ov::runtime::Core& core, const std::string& path, const std::vector<std::string>& devices) {
+    ModelResult result{path, "onnx", {}};
+    for (size_t i = 0; i < FLAGS_niter; ++i) {
+        std::shared_ptr<ov::Model> model;
+        {
+            PhaseMeter meter;
+            model = core.read_model(path);
+            result.phase("read_model").runs.push_back(meter.stop());
+        }
+        measureCompilation(core, model, devices, result);
+    }
+    return result;
+}
+
+void writeResults(const std::vector<ModelResult>& results, const std::vector<std::string>& devices) {
+    std::ofstream file(FLAGS_output);
+    if (!file.good())
+        throw std::runtime_error("Results file \"" + FLAGS_output + "\" can't be used for writing");
+
+    char date[32];
+    const auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    file << "{\n  \"context\": {\n    \"date\": \"" << date << "\",\n    \"devices\": [";
+    for (size_t i = 0; i < devices.size(); ++i)
+        file << (i ? ", " : "") << "\"" << devices[i] << "\"";
+    file << "],\n    \"iterations\": " << FLAGS_niter << "\n  },\n  \"models\": [";
+    for (size_t m = 0; m < results.size(); ++m) {
+        const auto& result = results[m];
+        file << (m ? "," : "") << "\n    {\n      \"name\": \"" << result.name << "\",\n      \"frontend\": \""
+             << result.frontend << "\",\n      \"phases\": [";
+        for (size_t p = 0; p < result.phases.size(); ++p) {
+            const auto& phase = result.phases[p];
+            std::vector<double> times;
+            std::vector<size_t> deltas;
+            size_t peak = 0;
+            for (const auto& run : phase.runs) {
+                times.push_back(run.timeMs);
+                deltas.push_back(run.rssDeltaKb);
+                peak = std::max(peak, run.peakRssKb);
+            }
+            file << (p ? "," : "") << "\n        {\"name\": \"" << phase.name << "\", \"time_ms\": " << median(times)
+                 << ", \"peak_rss_kb\": " << peak << ", \"rss_delta_kb\": " << median(deltas) << "}";
+        }
+        file << "\n      ]\n    }";
+    }
+    file << "\n  ]\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return 0;
+    }
+    if (FLAGS_niter == 0) {
+        std::cerr << "--niter must be positive" << std::endl;
+        return 1;
+    }
+
+    try {
+        ov::runtime::Core core;
+        const auto available = core.get_available_devices();
+        std::vector<std::string> devices;
+        for (const auto& device : splitList(FLAGS_d)) {
+            if (std::find(available.begin(), available.end(), device) == available.end()) {
+                std::cout << "[ WARNING ] " << device << " is not available, skipped" << std::endl;
+                continue;
+            }
+            devices.push_back(device);
+        }
+
+        std::vector<ModelResult> results;
+        const std::regex filter(FLAGS_filter);
+        for (const auto& topology : getTopologies()) {
+            if (!std::regex_match(topology.name, filter))
+                continue;
+            std::cout << "[ RUN ] " << topology.name << std::endl;
+            results.push_back(measureTopology(core, topology, devices));
+        }
+        for (const auto& path : splitList(FLAGS_onnx_models)) {
+            std::cout << "[ RUN ] " << path << std::endl;
+            results.push_back(measureOnnxModel(core, path, devices));
+        }
+        writeResults(results, devices);
+    } catch (const std::exception& ex) {
+        std::cerr << "[ ERROR ] " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
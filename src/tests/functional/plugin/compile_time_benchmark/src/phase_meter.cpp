@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "phase_meter.hpp"
+
+#include <fstream>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace CompileTimeBenchmark {
+
+#ifdef _WIN32
+static PROCESS_MEMORY_COUNTERS getMemoryInfo() {
+    PROCESS_MEMORY_COUNTERS pmc;
+    pmc.cb = sizeof(PROCESS_MEMORY_COUNTERS);
+    GetProcessMemoryInfo(GetCurrentProcess(), &pmc, pmc.cb);
+    return pmc;
+}
+
+size_t getRssKb() {
+    return getMemoryInfo().WorkingSetSize / 1024;
+}
+
+size_t getPeakRssKb() {
+    return getMemoryInfo().PeakWorkingSetSize / 1024;
+}
+
+static void resetPeakRss() {}
+#elif defined(__linux__)
+static size_t getStatusValueKb(const std::string& name) {
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);) {
+        if (line.compare(0, name.size(), name) == 0)
+            return std::stoul(line.substr(name.size()));
+    }
+    return 0;
+}
+
+size_t getRssKb() {
+    return getStatusValueKb("VmRSS:");
+}
+
+size_t getPeakRssKb() {
+    return getStatusValueKb("VmHWM:");
+}
+
+static void resetPeakRss() {
+    // "5" resets the peak RSS of the process to the current one (Linux 4.0+)
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+}
+#else
+size_t getRssKb() {
+    return 0;
+}
+
+size_t getPeakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    // ru_maxrss is in bytes on macOS
+    return static_cast<size_t>(usage.ru_maxrss) / 1024;
+}
+
+static void resetPeakRss() {}
+#endif
+
+PhaseMeter::PhaseMeter() {
+    resetPeakRss();
+    startRssKb = getRssKb();
+    start = std::chrono::steady_clock::now();
+}
+
+PhaseMeasurement PhaseMeter::stop() const {
+    PhaseMeasurement measurement;
+    measurement.timeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    measurement.peakRssKb = getPeakRssKb();
+    const auto rss = getRssKb();
+    measurement.rssDeltaKb = rss > startRssKb ? rss - startRssKb : 0;
+    return measurement;
+}
+
+}  // namespace CompileTimeBenchmark
@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topologies.hpp"
+
+#include <cmath>
+
+#include <ngraph/opsets/opset8.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace CompileTimeBenchmark {
+
+namespace {
+
+using ngraph::helpers::ActivationTypes;
+using ngraph::helpers::EltwiseTypes;
+
+const auto precision = ngraph::element::f32;
+
+std::shared_ptr<ngraph::Node> makeConvAct(const ngraph::Output<ngraph::Node>& in, size_t kernel, size_t stride,
+                                          size_t outChannels, bool activation = true) {
+    const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+    auto conv = ngraph::builder::makeConvolution(in, precision, {kernel, kernel}, {stride, stride}, {pad, pad}, {pad, pad},
+                                                 {1, 1}, ngraph::op::PadType::EXPLICIT, outChannels, true);
+    return activation ? ngraph::builder::makeActivation(conv, precision, ActivationTypes::Relu) : conv;
+}
+
+/**
+ * @brief ResNet-50 like model: a stem and `blocks` bottleneck residual blocks
+ */
+std::shared_ptr<ov::Model> makeResNetLike(size_t blocks) {
+    auto params = ngraph::builder::makeParams(precision, {{1, 3, 224, 224}});
+    std::shared_ptr<ngraph::Node> x = makeConvAct(params[0], 7, 2, 64);
+    x = ngraph::builder::makePooling(x, {2, 2}, {0, 0}, {0, 0}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                     ngraph::op::PadType::SAME_UPPER, false, ngraph::helpers::PoolingTypes::MAX);
+    size_t channels = 64;
+    for (size_t i = 0; i < blocks; ++i) {
+        // downsample and widen every quarter of the blocks
+        const bool downsample = i != 0 && i % (blocks / 4 > 0 ? blocks / 4 : 1) == 0 && channels < 512;
+        const size_t stride = downsample ? 2 : 1;
+        const size_t outChannels = downsample ? channels * 2 : channels;
+        std::shared_ptr<ngraph::Node> shortcut = x;
+        if (downsample || i == 0)
+            shortcut = makeConvAct(x, 1, stride, outChannels * 4, false);
+        auto y = makeConvAct(x, 1, 1, outChannels);
+        y = makeConvAct(y, 3, stride, outChannels);
+        y = makeConvAct(y, 1, 1, outChannels * 4, false);
+        auto sum = ngraph::builder::makeEltwise(y, shortcut, EltwiseTypes::ADD);
+        x = ngraph::builder::makeActivation(sum, precision, ActivationTypes::Relu);
+        channels = outChannels;
+    }
+    auto axes = ngraph::opset8::Constant::create(ngraph::element::i64, {2}, {2, 3});
+    auto pool = std::make_shared<ngraph::opset8::ReduceMean>(x, axes, false);
+    auto fc = ngraph::builder::makeFullyConnected(pool, precision, 1000);
+    auto softmax = std::make_shared<ngraph::opset8::Softmax>(fc, 1);
+    return std::make_shared<ov::Model>(ngraph::OutputVector{softmax}, params, "resnet_like");
+}
+
+/**
+ * @brief MobileNet like model: depthwise and pointwise convolution blocks
+ */
+std::shared_ptr<ov::Model> makeMobileNetLike(size_t blocks) {
+    auto params = ngraph::builder::makeParams(precision, {{1, 3, 224, 224}});
+    std::shared_ptr<ngraph::Node> x = makeConvAct(params[0], 3, 2, 32);
+    size_t channels = 32;
+    for (size_t i = 0; i < blocks; ++i) {
+        const size_t stride = i % 3 == 1 ? 2 : 1;
+        auto dw = ngraph::builder::makeGroupConvolution(x, precision, {3, 3}, {stride, stride}, {1, 1}, {1, 1}, {1, 1},
+                                                        ngraph::op::PadType::EXPLICIT, channels, channels, true);
+        auto act = ngraph::builder::makeActivation(dw, precision, ActivationTypes::Relu);
+        if (stride == 2 && channels < 1024)
+            channels *= 2;
+        x = makeConvAct(act, 1, 1, channels);
+    }
+    auto axes = ngraph::opset8::Constant::create(ngraph::element::i64, {2}, {2, 3});
+    auto pool = std::make_shared<ngraph::opset8::ReduceMean>(x, axes, false);
+    auto fc = ngraph::builder::makeFullyConnected(pool, precision, 1000);
+    return std::make_shared<ov::Model>(ngraph::OutputVector{fc}, params, "mobilenet_like");
+}
+
+std::shared_ptr<ngraph::Node> makeReshape(const ngraph::Output<ngraph::Node>& in, const std::vector<int64_t>& shape) {
+    auto pattern = ngraph::opset8::Constant::create(ngraph::element::i64, {shape.size()}, shape);
+    return std::make_shared<ngraph::opset8::Reshape>(in, pattern, false);
+}
+
+std::shared_ptr<ngraph::Node> makeTranspose(const ngraph::Output<ngraph::Node>& in, const std::vector<int64_t>& order) {
+    auto orderConst = ngraph::opset8::Constant::create(ngraph::element::i64, {order.size()}, order);
+    return std::make_shared<ngraph::opset8::Transpose>(in, orderConst);
+}
+
+/**
+ * @brief BERT like encoder: `layers` blocks of multi-head attention and feed forward network
+ */
+std::shared_ptr<ov::Model> makeTransformerLike(size_t layers, size_t tokens, size_t hidden, size_t heads) {
+    const auto T = static_cast<int64_t>(tokens);
+    const auto H = static_cast<int64_t>(heads);
+    const auto D = static_cast<int64_t>(hidden / heads);
+    auto params = ngraph::builder::makeParams(precision, {{tokens, hidden}});
+    std::shared_ptr<ngraph::Node> x = params[0];
+    for (size_t i = 0; i < layers; ++i) {
+        auto q = makeTranspose(makeReshape(ngraph::builder::makeFullyConnected(x, precision, hidden), {T, H, D}), {1, 0, 2});
+        auto k = makeTranspose(makeReshape(ngraph::builder::makeFullyConnected(x, precision, hidden), {T, H, D}), {1, 2, 0});
+        auto v = makeTranspose(makeReshape(ngraph::builder::makeFullyConnected(x, precision, hidden), {T, H, D}), {1, 0, 2});
+        auto scores = ngraph::builder::makeMatMul(q, k);
+        auto scale = ngraph::opset8::Constant::create(precision, {}, {1.f / std::sqrt(static_cast<float>(D))});
+        auto scaled = std::make_shared<ngraph::opset8::Multiply>(scores, scale);
+        auto probs = std::make_shared<ngraph::opset8::Softmax>(scaled, 2);
+        auto context = makeReshape(makeTranspose(ngraph::builder::makeMatMul(probs, v), {1, 0, 2}),
+                                   {T, static_cast<int64_t>(hidden)});
+        auto attention = ngraph::builder::makeFullyConnected(context, precision, hidden);
+        auto norm1 = ngraph::builder::makeMVN(ngraph::builder::makeEltwise(attention, x, EltwiseTypes::ADD),
+                                              ngraph::AxisSet{1}, true, 1e-5);
+        auto ffn = ngraph::builder::makeActivation(ngraph::builder::makeFullyConnected(norm1, precision, hidden * 4),
+                                                   precision, ActivationTypes::Gelu);
+        auto ffnOut = ngraph::builder::makeFullyConnected(ffn, precision, hidden);
+        x = ngraph::builder::makeMVN(ngraph::builder::makeEltwise(ffnOut, norm1, EltwiseTypes::ADD),
+                                     ngraph::AxisSet{1}, true, 1e-5);
+    }
+    return std::make_shared<ov::Model>(ngraph::OutputVector{x}, params, "transformer_like");
+}
+
+}  // namespace
+
+std::vector<Topology> getTopologies() {
+    return {
+        {"conv_pool_relu", [] { return ngraph::builder::subgraph::makeConvPoolRelu(); }},
+        {"split_conv_concat", [] { return ngraph::builder::subgraph::makeSplitConvConcat(); }},
+        {"nested_split_conv_concat", [] { return ngraph::builder::subgraph::makeNestedSplitConvConcat(); }},
+        {"kso_function", [] { return ngraph::builder::subgraph::makeKSOFunction(); }},
+        {"matmul_bias", [] { return ngraph::builder::subgraph::makeMatMulBias(); }},
+        {"ti_with_lstm_cell", [] { return ngraph::builder::subgraph::makeTIwithLSTMcell(); }},
+        {"resnet_like_16", [] { return makeResNetLike(16); }},
+        {"resnet_like_64", [] { return makeResNetLike(64); }},
+        {"mobilenet_like_13", [] { return makeMobileNetLike(13); }},
+        {"transformer_like_4x256", [] { return makeTransformerLike(4, 128, 256, 4); }},
+        {"transformer_like_12x768", [] { return makeTransformerLike(12, 128, 768, 12); }},
+    };
+}
+
+}  // namespace CompileTimeBenchmark
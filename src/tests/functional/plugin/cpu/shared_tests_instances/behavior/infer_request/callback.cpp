@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
 #include "behavior/infer_request/callback.hpp"
 
 using namespace BehaviorTestsDefinitions;
@@ -13,7 +15,9 @@ const std::vector<std::map<std::string, std::string>> configs = {
 };
 
 const std::vector<std::map<std::string, std::string>> multiConfigs = {
-        {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
+        {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}},
+        {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU},
+         {InferenceEngine::PluginConfigInternalParams::KEY_MULTI_LOAD_AWARE_SCHEDULING, InferenceEngine::PluginConfigParams::YES}}
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, InferRequestCallbackTests,
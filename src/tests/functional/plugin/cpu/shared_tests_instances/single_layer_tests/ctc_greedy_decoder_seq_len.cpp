@@ -39,7 +39,7 @@ INSTANTIATE_TEST_SUITE_P(smoke_set1, CTCGreedyDecoderSeqLenLayerTest,
 
 INSTANTIATE_TEST_SUITE_P(smoke_set2, CTCGreedyDecoderSeqLenLayerTest,
         ::testing::Combine(
-                        ::testing::ValuesIn(std::vector<std::vector<size_t>>{{2, 8, 11}, {4, 10, 55}}),
+                        ::testing::ValuesIn(std::vector<std::vector<size_t>>{{2, 8, 11}, {4, 10, 55}, {64, 100, 96}}),
                         ::testing::ValuesIn(std::vector<int>{5, 100}),
                         ::testing::ValuesIn(probPrecisions),
                         ::testing::ValuesIn(idxPrecisions),
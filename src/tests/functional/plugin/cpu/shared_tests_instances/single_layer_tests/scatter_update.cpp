@@ -33,7 +33,9 @@ std::map<std::vector<size_t>, std::map<std::vector<size_t>, std::vector<int>>> a
 };
 //indices should not be random value
 const std::vector<std::vector<int64_t>> idxValue = {
-        {0, 2, 4, 6, 1, 3, 5, 7}
+        {0, 2, 4, 6, 1, 3, 5, 7},
+        // the last update of the repeated index is written
+        {7, 2, 4, 2, 1, 7, 5, 2}
 };
 
 const auto ScatterUpdateCase = ::testing::Combine(
@@ -9,6 +9,7 @@
 #include "ngraph_functions/utils/ngraph_helpers.hpp"
 #include "ngraph_functions/builders.hpp"
 #include <shared_test_classes/single_layer/convolution.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace InferenceEngine;
 using namespace CPUTestUtils;
@@ -842,6 +843,41 @@ INSTANTIATE_TEST_SUITE_P(smoke_Conv_2D_FP32, ConvolutionLayerCPUTest,
                                  ::testing::Values(cpuEmptyPluginConfig)),
                          ConvolutionLayerCPUTest::getTestCaseName);
 
+std::vector<InputShape> inputShapesDynamicBatch2d = {
+        {
+            //dynamic shape
+            { -1, 64, 7, 7 },
+            { //target static shapes
+                { 1, 64, 7, 7 },
+                { 3, 64, 7, 7 },
+                { 7, 64, 7, 7 },
+                { 2, 64, 7, 7 }
+            }
+        }
+};
+
+const std::vector<fusingSpecificParams> fusingParamsSetBatchBuckets{
+        emptyFusingSpec,
+        fusingRelu,
+        fusingSum,
+        fusingAddPerChannel
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Conv_2D_FP32_BatchBuckets, ConvolutionLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Combine(
+                                         convParams_ExplicitPadding_2D,
+                                         ::testing::Values(ElementType::f32),
+                                         ::testing::Values(ElementType::undefined),
+                                         ::testing::Values(ElementType::undefined),
+                                         ::testing::ValuesIn(inputShapesDynamicBatch2d),
+                                         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                                 ::testing::ValuesIn(filterCPUInfoForDevice(CPUParams_2D)),
+                                 ::testing::ValuesIn(fusingParamsSetBatchBuckets),
+                                 ::testing::Values(std::map<std::string, std::string>{
+                                     {PluginConfigInternalParams::KEY_CPU_BATCH_BUCKETS, "2,4"}})),
+                         ConvolutionLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_Conv_2D_BF16, ConvolutionLayerCPUTest,
                          ::testing::Combine(
                                  ::testing::Combine(
@@ -67,7 +67,7 @@ protected:
         bool withWeights;
         std::tie(inputShapes, indices, withWeights) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        selectedType = makeSelectedTypeStr(with_cpu_x86_avx2() ? getPrimitiveType() : "ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -129,6 +129,8 @@ const std::vector<InputShape> input_shapes = {
         {{5, 6}, {{5, 6}}},
         {{10, 35}, {{10, 35}}},
         {{5, 4, 16}, {{5, 4, 16}}},
+        // the depth covers the blocked loop and all the tails of the jit kernel
+        {{5, 3, 67}, {{5, 3, 67}}},
 };
 
 const std::vector<std::vector<std::vector<size_t>>> indices =
@@ -77,7 +77,7 @@ protected:
         size_t numSegments, defaultIndex;
         std::tie(inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        selectedType = makeSelectedTypeStr(with_cpu_x86_avx2() ? getPrimitiveType() : "ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -142,6 +142,8 @@ const std::vector<InputShape> input_shapes = {
     {{5, 6}, {{5, 6}}},
     {{10, 35}, {{10, 35}}},
     {{5, 4, 16}, {{5, 4, 16}}},
+    // the depth covers the blocked loop and all the tails of the jit kernel
+    {{5, 3, 67}, {{5, 3, 67}}},
 };
 
 const std::vector<std::vector<size_t>> indices =
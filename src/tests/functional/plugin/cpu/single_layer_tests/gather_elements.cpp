@@ -136,5 +136,26 @@ INSTANTIATE_TEST_SUITE_P(smoke_set1, GatherElementsCPUTest,
                 ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D))),
         GatherElementsCPUTest::getTestCaseName);
 
+std::vector<CPUSpecificParams> cpuParams_3D = {
+        CPUSpecificParams({ncw}, {ncw}, {}, {})
+};
+
+// the rows long enough for the vectorized gather along the inner dims and along the last axis
+const std::vector<std::vector<InputShape>> inDynamicShapeParamsLongRows = {
+    {{{-1, -1, -1}, {{2, 5, 40}, {3, 4, 21}}},
+     {{-1, -1, -1}, {{2, 5, 40}, {3, 4, 21}}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_set2, GatherElementsCPUTest,
+            ::testing::Combine(
+                ::testing::Combine(
+                    ::testing::ValuesIn(inDynamicShapeParamsLongRows),        // shape
+                    ::testing::ValuesIn(std::vector<int>({1, -1})),           // Axis
+                    ::testing::Values(ElementType::f32),
+                    ::testing::Values(ElementType::i32),
+                    ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_3D))),
+        GatherElementsCPUTest::getTestCaseName);
+
 } // namespace
 } // namespace CPULayerTestsDefinitions
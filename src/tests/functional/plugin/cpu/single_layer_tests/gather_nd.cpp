@@ -128,6 +128,10 @@ const std::vector<std::pair<Shape, std::vector<int>>> indexesShapesBD_0 = {
         std::pair<Shape, std::vector<int>>{{2, 2}, {3, 3, 2, 1}},
         std::pair<Shape, std::vector<int>>{{1, 2, 3}, {0, 1, 1, 1, 0, 2}},
         std::pair<Shape, std::vector<int>>{{2, 1, 1, 2}, {0, 2, 1, 1}},
+        // enough index tuples for the vectorized gather of the elements
+        std::pair<Shape, std::vector<int>>{{18, 3}, {2, 1, 3, 0, 0, 0, 2, 0, 1, 0, 0, 3, 3, 0, 1, 0, 3, 0,
+                                                     0, 1, 0, 3, 0, 1, 0, 1, 2, 3, 1, 0, 2, 1, 0, 1, 2, 0,
+                                                     0, 0, 1, 3, 3, 2, 3, 3, 2, 2, 1, 1, 1, 0, 2, 3, 2, 3}},
 };
 
 const auto subset_BD0 = ::testing::Combine(
@@ -297,6 +297,16 @@ std::vector<std::vector<ov::test::InputShape>> inputShapes_6D = {
     {{{{1, 5}, 19, {1, 5}, {1, 5}, {1, 5}, {1, 5}}, {{2, 19, 2, 2, 2, 2}, {2, 19, 2, 2, 3, 2}}}},
 };
 
+// the planes are fewer than the threads, so their chunks are reduced in parallel
+std::vector<std::vector<ov::test::InputShape>> inputShapes_SplitHW = {
+    {{{}, {{1, 16, 32, 48}}}},
+    {{{}, {{1, 19, 32, 48}}}},
+};
+
+std::vector<CPUSpecificParams> cpuParams_SplitHW_4D = {
+        CPUSpecificParams({nChw16c}, {nChw16c}, {}, {})
+};
+
 std::vector<CPUSpecificParams> cpuParams_4D = {
         CPUSpecificParams({nChw16c}, {nChw16c}, {}, {}),
         CPUSpecificParams({nchw}, {nchw}, {}, {}),
@@ -357,6 +367,32 @@ const auto params_MultiAxis_4D = testing::Combine(
         testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
         testing::Values(emptyFusingSpec));
 
+const std::vector<std::vector<int>> axesSplitHW = {
+        {2, 3},
+        {1, 2, 3}
+};
+
+const std::vector<ngraph::helpers::ReductionType> reductionTypesSplitHW = {
+        ngraph::helpers::ReductionType::Mean,
+        ngraph::helpers::ReductionType::Max,
+        ngraph::helpers::ReductionType::Sum,
+        ngraph::helpers::ReductionType::L1,
+        ngraph::helpers::ReductionType::L2,
+};
+
+const auto params_SplitHW_4D = testing::Combine(
+        testing::Combine(
+                testing::ValuesIn(axesSplitHW),
+                testing::Values(CommonTestUtils::OpType::VECTOR),
+                testing::Values(true),
+                testing::ValuesIn(reductionTypesSplitHW),
+                testing::Values(ElementType::f32),
+                testing::Values(ElementType::undefined),
+                testing::Values(ElementType::undefined),
+                testing::ValuesIn(inputShapes_SplitHW)),
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_SplitHW_4D)),
+        testing::Values(emptyFusingSpec));
+
 const auto params_MultiAxis_5D = testing::Combine(
         testing::Combine(
                 testing::ValuesIn(axes5D),
@@ -423,6 +459,13 @@ INSTANTIATE_TEST_SUITE_P(
         ReduceCPULayerTest::getTestCaseName
 );
 
+INSTANTIATE_TEST_SUITE_P(
+        smoke_Reduce_SplitHW_4D_CPU,
+        ReduceCPULayerTest,
+        params_SplitHW_4D,
+        ReduceCPULayerTest::getTestCaseName
+);
+
 INSTANTIATE_TEST_SUITE_P(
         smoke_Reduce_MultiAxis_5D_CPU,
         ReduceCPULayerTest,
@@ -169,4 +169,27 @@ const auto testCases = ::testing::Combine(
 
 INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs, TopKLayerCPUTest, testCases, TopKLayerCPUTest::getTestCaseName);
 
+// the large k over the large last axis is selected by the radix
+const std::vector<InputShape> inShapesLargeAxis = {
+    InputShape{
+        // dynamic
+        {-1, -1},
+        // target
+        {
+            {1, 10000},
+            {70, 5000}
+        }
+    },
+};
+
+const auto testCasesLargeAxis = ::testing::Combine(
+    ::testing::ValuesIn(inputPrecisions),
+    ::testing::ValuesIn(inShapesLargeAxis),
+    ::testing::Values(1),
+    ::testing::ValuesIn(modes),
+    ::testing::ValuesIn(sortTypes)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_LargeAxis, TopKLayerCPUTest, testCasesLargeAxis, TopKLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
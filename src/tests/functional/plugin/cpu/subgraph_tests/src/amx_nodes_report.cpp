@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter    Parameter
+ *        \        /
+ *          MatMul
+ *            |
+ *       Convolution
+ *            |
+ *          Result
+ */
+
+class AmxNodesReportTest : public testing::WithParamInterface<std::string>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "EnforceBF16=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, this->GetParam()});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 32, 16, 16}, {1, 32, 16, 16}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto matMul = builder::makeMatMul(paramOuts[0], paramOuts[1]);
+        auto conv = builder::makeConvolution(matMul, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 32);
+
+        ResultVector results{std::make_shared<opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "AmxNodesReport");
+    }
+};
+
+TEST_P(AmxNodesReportTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the implementations are selected when the network is compiled, the bf16 accuracy is not checked here
+    LoadNetwork();
+
+    // the nodes of the executable graph with the AMX implementations and only them are reported
+    const auto amxNodes = executableNetwork.GetMetric(METRIC_KEY(CPU_AMX_NODES)).as<std::map<std::string, std::string>>();
+    size_t execAmxNodes = 0;
+    for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::IMPL_TYPE);
+        ASSERT_NE(rtInfo.end(), it);
+        const auto implType = it->second.as<std::string>();
+        if (implType.find("amx") != std::string::npos) {
+            execAmxNodes++;
+            ASSERT_EQ(1, amxNodes.count(node->get_friendly_name())) << "Not reported AMX node " << node->get_friendly_name();
+            ASSERT_EQ(implType, amxNodes.at(node->get_friendly_name()));
+        }
+    }
+    ASSERT_EQ(execAmxNodes, amxNodes.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_AmxNodesReport, AmxNodesReportTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         AmxNodesReportTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
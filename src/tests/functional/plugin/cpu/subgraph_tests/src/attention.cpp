@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      Q       K
+ *       \     /
+ *       MatMul    Constant
+ *           \     /
+ *          Multiply   Mask
+ *               \     /
+ *                 Add
+ *                  |
+ *               Softmax    V
+ *                    \    /
+ *                    MatMul
+ *                      |
+ *                    Result
+ */
+
+using AttentionTestParams = std::tuple<std::vector<SizeVector>, // Q, K, V and optional Mask shapes
+                                       bool,                    // transpose K
+                                       bool>;                   // enable the fusion
+
+class AttentionTest : public testing::WithParamInterface<AttentionTestParams>,
+                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<AttentionTestParams> obj) {
+        std::vector<SizeVector> inputShapes;
+        bool transposeK, attentionFusion;
+        std::tie(inputShapes, transposeK, attentionFusion) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShapes) << "_";
+        result << "transposeK=" << transposeK << "_";
+        result << "fusion=" << attentionFusion;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<SizeVector> inputShapes;
+        bool transposeK;
+        std::tie(inputShapes, transposeK, attentionFusion) = this->GetParam();
+        if (attentionFusion)
+            configuration.insert({PluginConfigInternalParams::KEY_CPU_ATTENTION_FUSION, PluginConfigParams::YES});
+
+        const auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, inputShapes);
+        const auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        const auto qk = builder::makeMatMul(paramOuts[0], paramOuts[1], false, transposeK);
+        const auto scale = opset1::Constant::create(ngPrc, Shape{}, {0.125f});
+        std::shared_ptr<Node> scores = std::make_shared<opset1::Multiply>(qk, scale);
+        if (inputShapes.size() == 4)
+            scores = std::make_shared<opset1::Add>(scores, paramOuts[3]);
+        const auto softmax = std::make_shared<opset1::Softmax>(scores, inputShapes[0].size() - 1);
+        const auto qkv = builder::makeMatMul(softmax, paramOuts[2], false, false);
+
+        ResultVector results{std::make_shared<opset1::Result>(qkv)};
+        function = std::make_shared<Function>(results, inputParams, "Attention");
+    }
+
+    bool attentionFusion = false;
+};
+
+TEST_P(AttentionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the fusion is opt-in, the oneDNN MatMuls are used by default
+    CheckNodeOfTypeCount(executableNetwork, "Attention", attentionFusion ? 1 : 0);
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", attentionFusion ? 0 : 1);
+}
+
+namespace {
+
+const std::vector<std::vector<SizeVector>> transposedKShapes = {
+    {{1, 8, 128, 64}, {1, 8, 100, 64}, {1, 8, 100, 64}},
+    {{2, 4, 77, 32}, {2, 4, 77, 32}, {2, 4, 77, 32}, {2, 1, 1, 77}},
+    {{3, 50, 16}, {1, 40, 16}, {3, 40, 24}, {50, 40}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Attention_TransposedK, AttentionTest,
+                         ::testing::Combine(::testing::ValuesIn(transposedKShapes),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true, false)),
+                         AttentionTest::getTestCaseName);
+
+const std::vector<std::vector<SizeVector>> plainKShapes = {
+    {{1, 2, 33, 16}, {1, 2, 16, 65}, {1, 2, 65, 8}, {1, 2, 33, 65}},
+    {{4, 10, 8}, {4, 8, 10}, {4, 10, 8}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Attention_PlainK, AttentionTest,
+                         ::testing::Combine(::testing::ValuesIn(plainKShapes),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true, false)),
+                         AttentionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
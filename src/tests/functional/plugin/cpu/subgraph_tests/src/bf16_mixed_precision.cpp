@@ -0,0 +1,111 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      Parameter
+ *          |
+ *     Convolution (conv1)
+ *          |
+ *       Softmax
+ *          |
+ *        Relu
+ *          |
+ *     Convolution (conv2)
+ *          |
+ *        Result
+ */
+
+using BF16MixedPrecisionParams = std::tuple<std::string,   // CPU_BF16_MIXED_PRECISION
+                                            std::string>;  // CPU_FP32_NODES
+
+class BF16MixedPrecisionTest : public testing::WithParamInterface<BF16MixedPrecisionParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<BF16MixedPrecisionParams> obj) {
+        std::string mixedPrecision, fp32Nodes;
+        std::tie(mixedPrecision, fp32Nodes) = obj.param;
+
+        std::ostringstream result;
+        result << "MixedPrecision=" << mixedPrecision << "_";
+        result << "FP32Nodes=" << (fp32Nodes.empty() ? "none" : fp32Nodes);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::string mixedPrecision, fp32Nodes;
+        std::tie(mixedPrecision, fp32Nodes) = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES});
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_BF16_MIXED_PRECISION, mixedPrecision});
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_FP32_NODES, fp32Nodes});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 8, 8}});
+
+        auto makeConv = [&](const Output<Node>& in, const std::string& name) {
+            auto conv = builder::makeConvolution(in, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 op::PadType::EXPLICIT, 16);
+            conv->set_friendly_name(name);
+            return conv;
+        };
+
+        auto conv1 = makeConv(inputParams[0], "conv1");
+        auto softmax = std::make_shared<opset1::Softmax>(conv1, 1);
+        softmax->set_friendly_name("softmax");
+        auto relu = builder::makeActivation(softmax, ngPrc, helpers::ActivationTypes::Relu);
+        auto conv2 = makeConv(relu, "conv2");
+
+        ResultVector results{std::make_shared<opset1::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "BF16MixedPrecision");
+    }
+
+    std::map<std::string, std::string> getRuntimePrecisions() {
+        std::map<std::string, std::string> precisions;
+        for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+            if (it != rtInfo.end())
+                precisions[node->get_friendly_name()] = it->second.as<std::string>();
+        }
+        return precisions;
+    }
+};
+
+TEST_P(BF16MixedPrecisionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the precisions are selected when the network is compiled, the bf16 accuracy is not checked here
+    LoadNetwork();
+
+    std::string mixedPrecision, fp32Nodes;
+    std::tie(mixedPrecision, fp32Nodes) = this->GetParam();
+    const auto precisions = getRuntimePrecisions();
+    ASSERT_EQ(1, precisions.count("conv1"));
+    ASSERT_EQ(1, precisions.count("softmax"));
+    ASSERT_EQ(1, precisions.count("conv2"));
+
+    // the sensitive Softmax is kept in fp32, the significant nodes stay in bf16 unless they are requested in fp32
+    ASSERT_EQ("BF16", precisions.at("conv1"));
+    ASSERT_EQ(mixedPrecision == PluginConfigParams::YES ? "FP32" : "BF16", precisions.at("softmax"));
+    ASSERT_EQ(fp32Nodes == "conv2" ? "FP32" : "BF16", precisions.at("conv2"));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_BF16MixedPrecision, BF16MixedPrecisionTest,
+                         ::testing::Combine(::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                                            ::testing::Values("", "conv2")),
+                         BF16MixedPrecisionTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter
+ *       |
+ *   Broadcast   Parameter
+ *        \       /
+ *        Multiply
+ *            |
+ *          Result
+ *
+ * The Eltwise broadcasts the data of the Broadcast itself, so no Broadcast node is executed.
+ */
+
+using BroadcastEltwiseParams = std::tuple<std::vector<size_t>,   // broadcast data shape
+                                          std::vector<size_t>,   // broadcast target shape
+                                          std::vector<size_t>>;  // other eltwise input shape
+
+class BroadcastEltwiseTest : public testing::WithParamInterface<BroadcastEltwiseParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<BroadcastEltwiseParams> obj) {
+        std::vector<size_t> dataShape, targetShape, otherShape;
+        std::tie(dataShape, targetShape, otherShape) = obj.param;
+
+        std::ostringstream result;
+        result << "DataShape=" << CommonTestUtils::vec2str(dataShape) << "_";
+        result << "TargetShape=" << CommonTestUtils::vec2str(targetShape) << "_";
+        result << "OtherShape=" << CommonTestUtils::vec2str(otherShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> dataShape, targetShape, otherShape;
+        std::tie(dataShape, targetShape, otherShape) = this->GetParam();
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {dataShape, otherShape});
+
+        auto target = opset3::Constant::create(element::i64, Shape{targetShape.size()}, targetShape);
+        auto broadcast = std::make_shared<opset3::Broadcast>(inputParams[0], target);
+        auto multiply = std::make_shared<opset1::Multiply>(broadcast, inputParams[1]);
+
+        function = std::make_shared<ngraph::Function>(NodeVector{multiply}, inputParams, "BroadcastEltwise");
+    }
+};
+
+TEST_P(BroadcastEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "Broadcast", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_BroadcastEltwise, BroadcastEltwiseTest,
+                         ::testing::Values(
+                                 // attention positional bias
+                                 BroadcastEltwiseParams{{2, 1, 8, 1}, {2, 4, 8, 16}, {2, 4, 1, 16}},
+                                 // attention mask
+                                 BroadcastEltwiseParams{{2, 1, 1, 8}, {2, 4, 8, 8}, {2, 4, 8, 8}},
+                                 BroadcastEltwiseParams{{16}, {2, 4, 8, 16}, {2, 4, 8, 1}}),
+                         BroadcastEltwiseTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
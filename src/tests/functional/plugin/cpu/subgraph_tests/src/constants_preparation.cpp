@@ -0,0 +1,70 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                Parameter
+ *             /      |      \
+ *    Convolution Convolution Convolution   (the weights reorders are independent constant nodes)
+ *             \      |      /
+ *                  Concat
+ *                    |
+ *               Convolution
+ *                    |
+ *                  Result
+ */
+
+class ConstantsPreparationTest : public testing::WithParamInterface<std::string>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "ConstantsPreparation=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_CONSTANTS_PREPARATION, this->GetParam()});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 8, 16, 16}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel) {
+            const ptrdiff_t pad = kernel / 2;
+            return builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                            op::PadType::EXPLICIT, 8);
+        };
+
+        auto concat = builder::makeConcat({makeConv(paramOuts[0], 1), makeConv(paramOuts[0], 3), makeConv(paramOuts[0], 5)}, 1);
+        auto conv = makeConv(concat, 3);
+
+        ResultVector results{std::make_shared<opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ConstantsPreparation");
+    }
+};
+
+TEST_P(ConstantsPreparationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConstantsPreparation, ConstantsPreparationTest,
+                         ::testing::Values(PluginConfigInternalParams::CPU_CONSTANTS_ON_COMPILE,
+                                           PluginConfigInternalParams::CPU_CONSTANTS_ON_FIRST_INFERENCE,
+                                           PluginConfigInternalParams::CPU_CONSTANTS_IN_BACKGROUND),
+                         ConstantsPreparationTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
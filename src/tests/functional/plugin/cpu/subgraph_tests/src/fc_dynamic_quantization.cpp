@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter   Constant
+ *        \       /
+ *         MatMul    Constant (bias)
+ *            \       /
+ *               Add
+ *                |
+ *              Result
+ */
+
+using FCDynamicQuantizationParams = std::tuple<std::vector<size_t>,  // the shape of the 'data' input
+                                               bool>;                // with bias
+
+class FCDynamicQuantizationTest : public testing::WithParamInterface<FCDynamicQuantizationParams>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCDynamicQuantizationParams> obj) {
+        std::vector<size_t> inputShape;
+        bool withBias;
+        std::tie(inputShape, withBias) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "Bias=" << withBias;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t N = 37;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_DYNAMIC_QUANTIZATION, PluginConfigParams::YES});
+        // the activations are quantized to 8 bits per row
+        abs_threshold = 0.5f;
+
+        std::vector<size_t> inputShape;
+        bool withBias;
+        std::tie(inputShape, withBias) = this->GetParam();
+        const size_t K = inputShape.back();
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        std::vector<float> values(K * N);
+        for (size_t i = 0; i < values.size(); i++)
+            values[i] = 0.01f * static_cast<float>(static_cast<int>(i * 7 % 23) - 11);
+        auto weights = opset1::Constant::create(ngPrc, Shape{N, K}, values);
+
+        std::shared_ptr<Node> output = builder::makeMatMul(paramOuts[0], weights, false, true);
+        if (withBias) {
+            auto bias = builder::makeConstant<float>(ngPrc, {N}, {}, true);
+            output = std::make_shared<opset1::Add>(output, bias);
+        }
+
+        ResultVector results{std::make_shared<opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "FCDynamicQuantization");
+    }
+};
+
+TEST_P(FCDynamicQuantizationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCDynamicQuantization, FCDynamicQuantizationTest,
+                         ::testing::Combine(::testing::Values(std::vector<size_t>{1, 64},
+                                                              std::vector<size_t>{5, 96},
+                                                              std::vector<size_t>{2, 7, 64}),
+                                            ::testing::Values(true, false)),
+                         FCDynamicQuantizationTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
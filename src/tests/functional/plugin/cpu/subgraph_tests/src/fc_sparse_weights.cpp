@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter   Constant (sparse)
+ *        \       /
+ *         MatMul
+ *           |
+ *         Result
+ */
+
+using FCSparseWeightsParams = std::tuple<bool,     // transpose B
+                                         size_t,   // the number of the zero weights of 10
+                                         size_t>;  // M
+
+class FCSparseWeightsTest : public testing::WithParamInterface<FCSparseWeightsParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCSparseWeightsParams> obj) {
+        bool transposeB;
+        size_t zeros, M;
+        std::tie(transposeB, zeros, M) = obj.param;
+
+        std::ostringstream result;
+        result << "TransposeB=" << transposeB << "_";
+        result << "Zeros=" << zeros << "_";
+        result << "M=" << M;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t K = 64;
+    static constexpr size_t N = 21;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the weights with the density below 0.5 are sparse
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY, "0.5"});
+
+        bool transposeB;
+        size_t zeros, M;
+        std::tie(transposeB, zeros, M) = this->GetParam();
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{M, K}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        // the zeros are scattered irregularly, so some vectors of the weights are empty and some are full
+        std::vector<float> values(K * N);
+        for (size_t i = 0; i < values.size(); i++)
+            values[i] = (i * 7 + i / 13) % 10 < zeros ? 0.0f : 0.1f * static_cast<float>(static_cast<int>(i % 19) - 9);
+        auto weights = opset1::Constant::create(ngPrc, transposeB ? Shape{N, K} : Shape{K, N}, values);
+
+        auto matMul = builder::makeMatMul(paramOuts[0], weights, false, transposeB);
+
+        ResultVector results{std::make_shared<opset1::Result>(matMul)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "FCSparseWeights");
+    }
+};
+
+TEST_P(FCSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCSparseWeights, FCSparseWeightsTest,
+                         ::testing::Combine(::testing::Values(true, false),
+                                            ::testing::Values(3, 8, 10),
+                                            ::testing::Values(1, 3)),
+                         FCSparseWeightsTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
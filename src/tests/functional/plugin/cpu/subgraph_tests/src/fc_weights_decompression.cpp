@@ -0,0 +1,126 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                      Constant (i8/u8)
+ *                         |
+ *                      Convert   Constant (zero points)
+ *                          \      /
+ *                          Subtract (optional)   Constant (scales)
+ *                               \                 /
+ *   Parameter                      Multiply
+ *        \                            |
+ *         \                        Reshape (group-wise scales)
+ *          \                        /
+ *                    MatMul
+ *                      |
+ *                    Result
+ */
+
+using FCWeightsDecompressionParams = std::tuple<element::Type,  // weights precision
+                                                bool,           // transpose B
+                                                size_t,         // group size, 0 for the per-channel scales
+                                                bool>;          // with zero points
+
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionParams>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionParams> obj) {
+        element::Type weightsPrc;
+        bool transposeB, withZeroPoints;
+        size_t groupSize;
+        std::tie(weightsPrc, transposeB, groupSize, withZeroPoints) = obj.param;
+
+        std::ostringstream result;
+        result << "WeightsPrc=" << weightsPrc << "_";
+        result << "TransposeB=" << transposeB << "_";
+        result << "GroupSize=" << groupSize << "_";
+        result << "WithZeroPoints=" << withZeroPoints;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t M = 3;
+    static constexpr size_t K = 64;
+    static constexpr size_t N = 21;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION, PluginConfigParams::YES});
+
+        element::Type weightsPrc;
+        bool transposeB, withZeroPoints;
+        size_t groupSize;
+        std::tie(weightsPrc, transposeB, groupSize, withZeroPoints) = this->GetParam();
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{M, K}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        Shape weightsShape, scalesShape;
+        if (groupSize) {
+            weightsShape = {N, K / groupSize, groupSize};
+            scalesShape = {N, K / groupSize, 1};
+        } else {
+            weightsShape = transposeB ? Shape{N, K} : Shape{K, N};
+            scalesShape = transposeB ? Shape{N, 1} : Shape{1, N};
+        }
+
+        auto weights = builder::makeConstant<uint8_t>(weightsPrc, weightsShape, {}, true, 16);
+        std::shared_ptr<Node> decompressed = std::make_shared<opset1::Convert>(weights, ngPrc);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<uint8_t>(weightsPrc, scalesShape, {}, true, 8);
+            decompressed = std::make_shared<opset1::Subtract>(decompressed, std::make_shared<opset1::Convert>(zeroPoints, ngPrc));
+        }
+        auto scales = builder::makeConstant<float>(ngPrc, scalesShape, {}, true, 0.1f, 0.01f);
+        decompressed = std::make_shared<opset1::Multiply>(decompressed, scales);
+        if (groupSize) {
+            auto shape = opset1::Constant::create(element::i64, Shape{2}, {N, K});
+            decompressed = std::make_shared<opset1::Reshape>(decompressed, shape, false);
+        }
+
+        auto matMul = builder::makeMatMul(paramOuts[0], decompressed, false, transposeB);
+
+        ResultVector results{std::make_shared<opset1::Result>(matMul)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "FCWeightsDecompression");
+    }
+};
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the decompression subgraph is executed by the FullyConnected node itself
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+        CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+        CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_PerChannel, FCWeightsDecompressionTest,
+                         ::testing::Combine(::testing::Values(element::u8, element::i8),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(0),
+                                            ::testing::Values(true, false)),
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_Grouped, FCWeightsDecompressionTest,
+                         ::testing::Combine(::testing::Values(element::u8, element::i8),
+                                            ::testing::Values(true),
+                                            ::testing::Values(16, 32),
+                                            ::testing::Values(true, false)),
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
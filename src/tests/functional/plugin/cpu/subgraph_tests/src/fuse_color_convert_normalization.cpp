@@ -0,0 +1,80 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <openvino/op/nv12_to_rgb.hpp>
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The color converter writes the normalized fp32 image of the pre-processing at once.
+
+    Parameter[U8]
+          |
+    NV12toRGB[U8]
+          |
+    Convert[FP32]     Constant[FP32]
+           \           /
+           Subtract[FP32]     Constant[FP32]
+                  \            /
+                  Multiply[FP32]
+                        |
+                   Output[FP32]
+*/
+using FuseColorConvertNormalizationParams = std::tuple<size_t,     // height
+                                                       size_t>;    // width
+
+class FuseColorConvertNormalizationTest : public testing::WithParamInterface<FuseColorConvertNormalizationParams>,
+                                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FuseColorConvertNormalizationParams> obj) {
+        size_t height, width;
+        std::tie(height, width) = obj.param;
+        std::ostringstream result;
+        result << "H=" << height << "_W=" << width;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = Precision::U8;
+        outPrc = Precision::FP32;
+
+        size_t height, width;
+        std::tie(height, width) = this->GetParam();
+        auto params = ngraph::builder::makeParams(ngraph::element::u8, {{1, height * 3 / 2, width, 1}});
+        auto colorConvert = std::make_shared<ov::op::v8::NV12toRGB>(params[0]);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(colorConvert, ngraph::element::f32);
+        auto mean = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1, 3}, {123.f, 117.f, 104.f});
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, mean);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1, 3}, {0.017f, 0.018f, 0.019f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "FuseColorConvertNormalization");
+    }
+};
+
+TEST_P(FuseColorConvertNormalizationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+// the widths which aren't multiple of the vector length check the tail of the row
+INSTANTIATE_TEST_SUITE_P(smoke_FuseColorConvertNormalization, FuseColorConvertNormalizationTest,
+                         ::testing::Combine(::testing::Values(16, 32),
+                                            ::testing::Values(22, 64)),
+                         FuseColorConvertNormalizationTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
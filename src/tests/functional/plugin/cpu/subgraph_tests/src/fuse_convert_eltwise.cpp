@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The convert of the u8 image is executed by the mean and scale eltwise which reads the u8 input.
+
+    Parameter[U8]
+          |
+    Convert[FP32]     Constant[FP32]
+           \           /
+           Subtract[FP32]     Constant[FP32]
+                  \            /
+                  Multiply[FP32]
+                        |
+                   Output[FP32]
+*/
+class FuseConvertAndEltwiseTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = Precision::U8;
+        outPrc = Precision::FP32;
+
+        const std::vector<size_t> inputShape{1, 3, 32, 48};
+        auto params = ngraph::builder::makeParams(ngraph::element::u8, {inputShape});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(params[0], ngraph::element::f32);
+        auto mean = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {123.f, 117.f, 104.f});
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, mean);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {0.017f, 0.018f, 0.019f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "FuseConvertAndEltwise");
+    }
+};
+
+namespace {
+TEST_F(FuseConvertAndEltwiseTest, smoke_FuseConvertAndEltwise_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+}
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,117 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/op/util/variable.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+
+namespace CPUSubgraphTestsDefinitions {
+namespace {
+constexpr size_t channels = 4;
+} // namespace
+
+// Subgraph:
+/*
+ *   Parameter    ReadValue
+ *         \      /
+ *          Concat      <- the token is appended to (or prepended to) the cache along the sequence axis
+ *          /    \
+ *      Assign  Result
+ *
+ * The cache has the dynamic sequence length, it grows by a token per inference.
+ */
+
+class GrowableStateTest : public ::testing::TestWithParam<bool> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<bool>& obj) {
+        return obj.param ? "append" : "prepend";
+    }
+
+protected:
+    std::shared_ptr<ov::Model> createModel(bool append) const {
+        const ov::PartialShape shape{1, -1, static_cast<int64_t>(channels)};
+        auto token = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "cache"});
+        auto cache = std::make_shared<ov::opset8::ReadValue>(token, variable);
+        auto concat = append ? std::make_shared<ov::opset8::Concat>(ov::OutputVector{cache, token}, 1)
+                             : std::make_shared<ov::opset8::Concat>(ov::OutputVector{token, cache}, 1);
+        auto assign = std::make_shared<ov::opset8::Assign>(concat, variable);
+        auto result = std::make_shared<ov::opset8::Result>(concat);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                           ov::ParameterVector{token}, "GrowableState");
+    }
+
+    // the cache of the tokens 1, 2, ..., n in the order of the inferences
+    static std::vector<float> expectedCache(size_t length, bool append) {
+        std::vector<float> cache;
+        for (size_t i = 0; i < length; i++) {
+            const auto token = static_cast<float>(append ? i + 1 : length - i);
+            cache.insert(cache.end(), channels, token);
+        }
+        return cache;
+    }
+
+    static std::vector<float> toVector(const ov::runtime::Tensor& tensor) {
+        const auto data = tensor.data<const float>();
+        return {data, data + tensor.get_size()};
+    }
+};
+
+TEST_P(GrowableStateTest, CacheGrowsByTokens) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const bool append = GetParam();
+    ov::runtime::Core core;
+    auto compiledModel = core.compile_model(createModel(append), CommonTestUtils::DEVICE_CPU);
+    auto request = compiledModel.create_infer_request();
+
+    ov::runtime::Tensor token{ov::element::f32, ov::Shape{1, 1, channels}};
+    const size_t length = 1000;
+    for (size_t i = 1; i <= length; i++) {
+        std::fill_n(token.data<float>(), channels, static_cast<float>(i));
+        request.set_tensor(compiledModel.input(), token);
+        request.infer();
+
+        const auto output = request.get_tensor(compiledModel.output());
+        ASSERT_EQ((ov::Shape{1, i, channels}), output.get_shape());
+        if (i % 100 == 0 || i < 10)
+            ASSERT_EQ(expectedCache(i, append), toVector(output));
+    }
+
+    auto states = request.query_state();
+    ASSERT_EQ(1u, states.size());
+    ASSERT_EQ((ov::Shape{1, length, channels}), states[0].get_state().get_shape());
+    ASSERT_EQ(expectedCache(length, append), toVector(states[0].get_state()));
+
+    // the cache restarts empty
+    states[0].reset();
+    ASSERT_EQ((ov::Shape{1, 0, channels}), states[0].get_state().get_shape());
+    std::fill_n(token.data<float>(), channels, 1.f);
+    request.infer();
+    ASSERT_EQ(expectedCache(1, append), toVector(request.get_tensor(compiledModel.output())));
+
+    // the state of another length is set by the user
+    const auto cache = expectedCache(3, append);
+    ov::runtime::Tensor newState{ov::element::f32, ov::Shape{1, 3, channels}};
+    std::copy(cache.begin(), cache.end(), newState.data<float>());
+    states[0].set_state(newState);
+    std::fill_n(token.data<float>(), channels, 4.f);
+    request.infer();
+    ASSERT_EQ(expectedCache(4, append), toVector(request.get_tensor(compiledModel.output())));
+
+    // the requests keep their own states
+    auto otherRequest = compiledModel.create_infer_request();
+    otherRequest.set_tensor(compiledModel.input(), token);
+    otherRequest.infer();
+    ASSERT_EQ((ov::Shape{1, 1, channels}), otherRequest.get_tensor(compiledModel.output()).get_shape());
+    ASSERT_EQ((ov::Shape{1, 4, channels}), request.query_state()[0].get_state().get_shape());
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GrowableState, GrowableStateTest,
+                         ::testing::Values(true, false),
+                         GrowableStateTest::getTestCaseName);
+
+} // namespace CPUSubgraphTestsDefinitions
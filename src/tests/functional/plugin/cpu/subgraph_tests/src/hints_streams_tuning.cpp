@@ -0,0 +1,67 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include <fstream>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter
+ *       |
+ *   Convolution
+ *       |
+ *     Result
+ */
+
+class HintsStreamsTuningTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    const std::string cacheDir = "hints_streams_tuning_cache";
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        CommonTestUtils::createDirectory(cacheDir);
+        configuration.insert({PluginConfigParams::KEY_PERFORMANCE_HINT, PluginConfigParams::THROUGHPUT});
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_HINTS_TUNING_TIME_LIMIT, "300"});
+        configuration.insert({PluginConfigParams::KEY_CACHE_DIR, cacheDir});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 8, 8}});
+        auto conv = builder::makeConvolution(inputParams[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+
+        ResultVector results{std::make_shared<opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "HintsStreamsTuning");
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "cpu_hints");
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+};
+
+TEST_F(HintsStreamsTuningTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the measured choice is persisted per model and machine and applied to the loaded network
+    const auto tuned = CommonTestUtils::listFilesWithExt(cacheDir, "cpu_hints");
+    ASSERT_EQ(1, tuned.size());
+    std::ifstream file(tuned.front());
+    int streams = 0, threads = -1;
+    ASSERT_TRUE(file >> streams >> threads);
+    ASSERT_GT(streams, 0);
+    ASSERT_EQ(std::to_string(streams), executableNetwork.GetConfig(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS).as<std::string>());
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,84 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CPUSubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *  Parameter(cond)     Parameter(x)
+ *        |             /         \
+ *        |          Relu       Sigmoid
+ *        |           |            |
+ *        +--------- If(then: 2 * x, else: x)
+ *                    |
+ *                  Result
+ *
+ * Relu feeds only the then branch and Sigmoid only the else one, so they are executed by the If node
+ * with the selected branch.
+ */
+
+class IfLazyBranchesTest : public ::testing::Test {
+protected:
+    static std::shared_ptr<ov::Model> createModel() {
+        auto cond = std::make_shared<ov::opset8::Parameter>(ov::element::boolean, ov::Shape{1});
+        cond->output(0).get_tensor().set_names({"cond"});
+        auto x = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 4, 8, 8});
+        x->output(0).get_tensor().set_names({"x"});
+        auto relu = std::make_shared<ov::opset8::Relu>(x);
+        auto sigmoid = std::make_shared<ov::opset8::Sigmoid>(x);
+
+        auto thenParam = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 4, 8, 8});
+        auto two = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {2.f});
+        auto thenResult = std::make_shared<ov::opset8::Result>(std::make_shared<ov::opset8::Multiply>(thenParam, two));
+        auto thenBody = std::make_shared<ov::Model>(ov::ResultVector{thenResult}, ov::ParameterVector{thenParam});
+
+        auto elseParam = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 4, 8, 8});
+        auto elseResult = std::make_shared<ov::opset8::Result>(elseParam);
+        auto elseBody = std::make_shared<ov::Model>(ov::ResultVector{elseResult}, ov::ParameterVector{elseParam});
+
+        auto ifOp = std::make_shared<ov::opset8::If>(cond);
+        ifOp->set_then_body(thenBody);
+        ifOp->set_else_body(elseBody);
+        ifOp->set_input(relu, thenParam, nullptr);
+        ifOp->set_input(sigmoid, nullptr, elseParam);
+        auto output = ifOp->set_output(thenResult, elseResult);
+        auto result = std::make_shared<ov::opset8::Result>(output);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{cond, x}, "IfLazyBranches");
+    }
+};
+
+TEST_F(IfLazyBranchesTest, SelectedBranchInputsAreComputed) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::runtime::Core core;
+    auto compiledModel = core.compile_model(createModel(), CommonTestUtils::DEVICE_CPU);
+    auto request = compiledModel.create_infer_request();
+    ov::runtime::Tensor x{ov::element::f32, ov::Shape{1, 4, 8, 8}};
+    for (size_t i = 0; i < x.get_size(); i++)
+        x.data<float>()[i] = static_cast<float>(i % 11) / 11.f - 0.5f;
+    request.set_tensor("x", x);
+
+    for (const bool condition : {true, false, true}) {
+        ov::runtime::Tensor cond{ov::element::boolean, ov::Shape{1}};
+        cond.data<bool>()[0] = condition;
+        request.set_tensor("cond", cond);
+        request.infer();
+
+        const auto output = request.get_tensor(compiledModel.output());
+        ASSERT_EQ(x.get_size(), output.get_size());
+        for (size_t i = 0; i < x.get_size(); i++) {
+            const float value = x.data<const float>()[i];
+            const float expected = condition ? 2.f * std::max(value, 0.f) : 1.f / (1.f + std::exp(-value));
+            ASSERT_NEAR(expected, output.data<const float>()[i], 1e-5f) << "condition: " << condition << ", index: " << i;
+        }
+    }
+}
+
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *     Parameter
+ *         |
+ *    Convolution   (the weights are reordered to the layout of the selected primitive)
+ *         |
+ *       Relu
+ *         |
+ *    Convolution
+ *         |
+ *       Result
+ */
+
+class ImportPrepackedWeightsTest : public testing::WithParamInterface<size_t>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<size_t> obj) {
+        std::ostringstream result;
+        result << "IC=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t inputChannels = this->GetParam();
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, inputChannels, 16, 16}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv1 = builder::makeConvolution(paramOuts[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset1::Relu>(conv1);
+        auto conv2 = builder::makeConvolution(relu, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, 8);
+
+        ResultVector results{std::make_shared<opset1::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ImportPrepackedWeights");
+    }
+
+    // the network is inferred after the import of the exported blob, the imported network consumes the prepacked
+    // weights of the blob and exports them again
+    void LoadNetwork() override {
+        LayerTestsCommon::LoadNetwork();
+        for (size_t i = 0; i < 2; i++) {
+            std::stringstream blob;
+            executableNetwork.Export(blob);
+            executableNetwork = core->ImportNetwork(blob, targetDevice, configuration);
+        }
+    }
+};
+
+TEST_P(ImportPrepackedWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "Convolution", 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ImportPrepackedWeights, ImportPrepackedWeightsTest,
+                         ::testing::Values(3, 16),
+                         ImportPrepackedWeightsTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter (converted by the inputs preparation stage)
+ *       |
+ *   Convolution
+ *       |
+ *     Result
+ */
+
+class InputsPreparationStageTest : public testing::WithParamInterface<Precision>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<Precision> obj) {
+        std::ostringstream result;
+        result << "InputPrecision=" << obj.param.name();
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t requestsNum = 3;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"});
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_INPUTS_PREPARATION_THREADS, "1"});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 8, 8}});
+        auto conv = builder::makeConvolution(inputParams[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+
+        ResultVector results{std::make_shared<opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "InputsPreparationStage");
+    }
+
+    // several requests are in flight, so the inputs of the next ones are prepared while the streams compute
+    void Infer() override {
+        std::vector<InferRequest> requests;
+        for (size_t i = 0; i < requestsNum; i++) {
+            inferRequest = executableNetwork.CreateInferRequest();
+            ConfigureInferRequest();
+            requests.push_back(inferRequest);
+        }
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+
+        const auto expected = requests.back().GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+        for (auto& request : requests)
+            LayerTestsCommon::Compare(expected, request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first));
+    }
+};
+
+TEST_P(InputsPreparationStageTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_InputsPreparationStage, InputsPreparationStageTest,
+                         ::testing::Values(Precision::FP32, Precision::FP16),
+                         InputsPreparationStageTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
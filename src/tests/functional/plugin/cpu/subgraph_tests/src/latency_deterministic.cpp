@@ -0,0 +1,64 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter
+ *       |
+ *   Convolution
+ *       |
+ *      Relu
+ *       |
+ *     Result
+ */
+
+class LatencyDeterministicTest : public testing::WithParamInterface<std::string>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "Deterministic=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_LATENCY_DETERMINISTIC, this->GetParam()});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 8, 8}});
+        auto conv = builder::makeConvolution(inputParams[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = builder::makeActivation(conv, ngPrc, helpers::ActivationTypes::Relu);
+
+        ResultVector results{std::make_shared<opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "LatencyDeterministic");
+    }
+};
+
+TEST_P(LatencyDeterministicTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // everything of the static network is allocated and prepared at the compilation
+    const auto report = executableNetwork.GetMetric(METRIC_KEY(CPU_LATE_ALLOCATIONS)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(0, report.at("ALLOCATIONS"));
+    ASSERT_EQ(0, report.at("PREPARATIONS"));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_LatencyDeterministic, LatencyDeterministicTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         LatencyDeterministicTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                     Parameter
+ *             /           |           \
+ *      Convolution   Convolution   Convolution
+ *           |             |             |
+ *         Relu        Convolution      Relu
+ *             \           |           /
+ *                       Concat
+ *                         |
+ *                       Result
+ */
+
+class ParallelBranchesTest : public testing::WithParamInterface<std::string>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "ParallelBranches=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES, this->GetParam()});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 8, 16, 16}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel) {
+            const ptrdiff_t pad = kernel / 2;
+            return builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                            op::PadType::EXPLICIT, 8);
+        };
+
+        auto branch0 = builder::makeActivation(makeConv(paramOuts[0], 1), ngPrc, helpers::ActivationTypes::Relu);
+        auto branch1 = makeConv(makeConv(paramOuts[0], 3), 3);
+        auto branch2 = builder::makeActivation(makeConv(paramOuts[0], 5), ngPrc, helpers::ActivationTypes::Relu);
+
+        auto concat = builder::makeConcat({branch0, branch1, branch2}, 1);
+
+        ResultVector results{std::make_shared<opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ParallelBranches");
+    }
+};
+
+TEST_P(ParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranches, ParallelBranchesTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         ParallelBranchesTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,70 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpu/cpu_params.hpp>
+#include <openvino/runtime/pooled_allocator.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter
+ *       |
+ *   Convolution
+ *       |
+ *     Relu
+ *       |
+ *   Convolution
+ *       |
+ *     Result
+ */
+
+class RemoteContextMemoryTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    std::shared_ptr<ov::runtime::PooledAllocator> allocator = std::make_shared<ov::runtime::PooledAllocator>();
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 8, 8}});
+        auto conv1 = builder::makeConvolution(inputParams[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset1::Relu>(conv1);
+        auto conv2 = builder::makeConvolution(relu, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+
+        ResultVector results{std::make_shared<opset1::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "RemoteContextMemory");
+    }
+
+    void LoadNetwork() override {
+        cnnNetwork = InferenceEngine::CNNNetwork{function};
+        ConfigureNetwork();
+        ParamMap params{{CPU_PARAM_KEY(ALLOCATOR), ov::runtime::Allocator{allocator}},
+                        {CPU_PARAM_KEY(NUMA_NODE_ID), -1}};
+        auto context = getCore()->CreateContext(targetDevice, params);
+        executableNetwork = getCore()->LoadNetwork(cnnNetwork, context, configuration);
+    }
+};
+
+TEST_F(RemoteContextMemoryTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the workspace of the graph and the request blobs are allocated from the context
+    ASSERT_GE(allocator->get_statistics().live_bytes, 16 * 8 * 8 * sizeof(float));
+    ASSERT_EQ(CommonTestUtils::DEVICE_CPU, executableNetwork.GetContext()->getDeviceName());
+
+    auto blob = executableNetwork.GetContext()->CreateBlob(TensorDesc(Precision::FP32, {1, 16, 8, 8}, Layout::NCHW));
+    blob->allocate();
+    ASSERT_NE(nullptr, blob->as<MemoryBlob>()->wmap().as<float*>());
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *            Parameter
+ *                |
+ *           Convolution
+ *            /       \
+ *         Relu      Add <-- Constant
+ *          |          |
+ *   Convolution     MVN
+ *           \        /
+ *             Concat
+ *               |
+ *             Result
+ */
+
+class ReordersMinimizationTest : public testing::WithParamInterface<std::string>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "GlobalLayoutSelection=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, this->GetParam()});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 8, 8}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto makeConv = [&](const Output<Node>& in) {
+            return builder::makeConvolution(in, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                            op::PadType::EXPLICIT, 16);
+        };
+
+        auto conv = makeConv(paramOuts[0]);
+        auto branch0 = makeConv(builder::makeActivation(conv, ngPrc, helpers::ActivationTypes::Relu));
+        auto add = std::make_shared<opset1::Add>(conv, builder::makeConstant<float>(ngPrc, {1, 16, 1, 1}, {}, true));
+        auto branch1 = builder::makeMVN(add, false, true, 1e-9);
+
+        auto concat = builder::makeConcat({branch0, branch1}, 1);
+
+        ResultVector results{std::make_shared<opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ReordersMinimization");
+    }
+
+    static std::map<std::string, uint64_t> getReorders(ExecutableNetwork& execNet) {
+        return execNet.GetMetric(METRIC_KEY(CPU_REORDERS_BYTES)).as<std::map<std::string, uint64_t>>();
+    }
+};
+
+TEST_P(ReordersMinimizationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // every reorder of the executable graph is reported
+    const auto reorders = getReorders(executableNetwork);
+    std::set<std::string> execReorders;
+    for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        ASSERT_NE(rtInfo.end(), it);
+        if (it->second.as<std::string>() == "Reorder")
+            execReorders.insert(node->get_friendly_name());
+    }
+    ASSERT_EQ(execReorders.size(), reorders.size());
+    for (const auto& reorder : reorders) {
+        ASSERT_EQ(1, execReorders.count(reorder.first)) << "Unexpected reorder " << reorder.first;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ReordersMinimization, ReordersMinimizationTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         ReordersMinimizationTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
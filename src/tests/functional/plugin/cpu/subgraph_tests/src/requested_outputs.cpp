@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+
+namespace CPUSubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *           Parameter
+ *           /       \
+ *   Convolution   Convolution
+ *        |             |
+ *      Relu         Sigmoid
+ *        |             |
+ *     Result        Result
+ *
+ * The request computes only one of the heads.
+ */
+
+class RequestedOutputsTest : public ::testing::Test {
+protected:
+    static std::shared_ptr<ov::Model> createModel() {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 8, 8, 8});
+        param->output(0).get_tensor().set_names({"input"});
+        auto conv1 = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<ov::opset8::Relu>(conv1);
+        relu->output(0).get_tensor().set_names({"detection"});
+        auto conv2 = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 8);
+        auto sigmoid = std::make_shared<ov::opset8::Sigmoid>(conv2);
+        sigmoid->output(0).get_tensor().set_names({"segmentation"});
+        ov::ResultVector results{std::make_shared<ov::opset8::Result>(relu), std::make_shared<ov::opset8::Result>(sigmoid)};
+        return std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "RequestedOutputs");
+    }
+
+    static std::vector<float> toVector(const ov::runtime::Tensor& tensor) {
+        const auto data = tensor.data<const float>();
+        return {data, data + tensor.get_size()};
+    }
+};
+
+TEST_F(RequestedOutputsTest, OnlyRequestedOutputsAreComputed) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::runtime::Core core;
+    auto compiledModel = core.compile_model(createModel(), CommonTestUtils::DEVICE_CPU);
+    ov::runtime::Tensor input{ov::element::f32, compiledModel.input().get_shape()};
+    for (size_t i = 0; i < input.get_size(); i++)
+        input.data<float>()[i] = static_cast<float>(i % 13) / 13.f - 0.5f;
+
+    auto reference = compiledModel.create_infer_request();
+    reference.set_tensor("input", input);
+    reference.infer();
+
+    auto request = compiledModel.create_infer_request();
+    request.set_tensor("input", input);
+    request.set_requested_outputs({compiledModel.output("detection")});
+    auto segmentation = request.get_tensor("segmentation");
+    std::fill_n(segmentation.data<float>(), segmentation.get_size(), -1.f);
+    request.infer();
+    ASSERT_EQ(toVector(reference.get_tensor("detection")), toVector(request.get_tensor("detection")));
+    ASSERT_EQ(std::vector<float>(segmentation.get_size(), -1.f), toVector(request.get_tensor("segmentation")));
+
+    // the empty subset selects all the outputs again
+    request.set_requested_outputs({});
+    request.infer();
+    ASSERT_EQ(toVector(reference.get_tensor("segmentation")), toVector(request.get_tensor("segmentation")));
+}
+
+} // namespace CPUSubgraphTestsDefinitions
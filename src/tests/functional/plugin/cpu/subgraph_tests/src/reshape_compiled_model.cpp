@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/core/graph_util.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+
+namespace CPUSubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter
+ *       |
+ *   Convolution
+ *       |
+ *     Relu
+ *       |
+ *   Convolution
+ *       |
+ *     Result
+ *
+ * The model compiled for a resolution is reshaped to another one.
+ */
+
+class ReshapeCompiledModelTest : public ::testing::Test {
+protected:
+    static std::shared_ptr<ov::Model> createModel() {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 16, 8, 8});
+        param->output(0).get_tensor().set_names({"input"});
+        auto conv1 = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<ov::opset8::Relu>(conv1);
+        auto conv2 = ngraph::builder::makeConvolution(relu, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        auto result = std::make_shared<ov::opset8::Result>(conv2);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "ReshapeCompiledModel");
+    }
+
+    static std::vector<float> infer(ov::runtime::CompiledModel compiledModel, const ov::runtime::Tensor& input) {
+        auto request = compiledModel.create_infer_request();
+        request.set_tensor("input", input);
+        request.infer();
+        const auto output = request.get_tensor(compiledModel.output());
+        const auto data = output.data<const float>();
+        return {data, data + output.get_size()};
+    }
+
+    static ov::runtime::Tensor makeInput(const ov::Shape& shape) {
+        ov::runtime::Tensor input{ov::element::f32, shape};
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>(i % 17) / 17.f - 0.5f;
+        return input;
+    }
+};
+
+TEST_F(ReshapeCompiledModelTest, VariantInfersAsReshapedModel) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::runtime::Core core;
+    auto model = createModel();
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    const ov::Shape shape{1, 16, 16, 16};
+    auto variant = compiledModel.reshape({{"input", shape}});
+    ASSERT_EQ(shape, variant.input("input").get_shape());
+
+    auto reshapedModel = ov::clone_model(*model);
+    reshapedModel->reshape({{"input", shape}});
+    auto reference = core.compile_model(reshapedModel, CommonTestUtils::DEVICE_CPU);
+    const auto input = makeInput(shape);
+    ASSERT_EQ(infer(reference, input), infer(variant, input));
+
+    // the original compiled model stays valid
+    const auto originalInput = makeInput(ov::Shape{1, 16, 8, 8});
+    ASSERT_EQ(infer(core.compile_model(model, CommonTestUtils::DEVICE_CPU), originalInput),
+              infer(compiledModel, originalInput));
+
+    ASSERT_THROW(compiledModel.reshape({{"unknown", shape}}), ov::Exception);
+}
+
+} // namespace CPUSubgraphTestsDefinitions
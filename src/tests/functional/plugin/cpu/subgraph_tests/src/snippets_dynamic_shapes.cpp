@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPUSubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *  Parameter  Parameter  Parameter  Parameter
+ *       \      /              \      /
+ *        Concat                Concat
+ *              \              /
+ *                    Add
+ *                     |
+ *                  Multiply    <- by scalar constant
+ *                     |
+ *                    Relu
+ *                     |
+ *                   Result
+ *
+ * The eltwise operations are executed by a single snippet, its kernels are generated for the broadcasting patterns
+ * of the actual shapes and reused when the pattern repeats.
+ */
+
+using SnippetsDynamicShapesParams = std::vector<InputShape>;
+
+class SnippetsDynamicShapesTest : public testing::WithParamInterface<SnippetsDynamicShapesParams>,
+                                  virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsDynamicShapesParams> &obj) {
+        std::ostringstream results;
+        results << "IS=(";
+        for (const auto& shape : obj.param) {
+            results << CommonTestUtils::partialShape2str({shape.first}) << "_";
+        }
+        results << ")_TS=(";
+        for (const auto& shape : obj.param) {
+            for (const auto& item : shape.second) {
+                results << CommonTestUtils::vec2str(item) << "_";
+            }
+        }
+        results << ")";
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        init_input_shapes(GetParam());
+
+        const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ov::op::v0::Parameter>(params));
+
+        const auto concat0 = ngraph::builder::makeConcat({paramOuts[0], paramOuts[1]}, 0);
+        const auto concat1 = ngraph::builder::makeConcat({paramOuts[2], paramOuts[3]}, 0);
+        const auto add = std::make_shared<ov::op::v1::Add>(concat0, concat1);
+        const auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {0.5f});
+        const auto relu = std::make_shared<ov::op::v0::Relu>(std::make_shared<ov::op::v1::Multiply>(add, scale));
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(relu)};
+        function = std::make_shared<ov::Model>(results, params, "SnippetsDynamicShapes");
+    }
+};
+
+TEST_P(SnippetsDynamicShapesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+    }
+}
+
+namespace {
+
+const std::vector<SnippetsDynamicShapesParams> inputShapes = {
+    // no broadcasting between the inputs, some of the shapes are repeated
+    {
+        {{-1, -1, -1, -1}, {{1, 3, 16, 17}, {2, 5, 4, 3}, {1, 3, 16, 17}, {1, 8, 1, 40}}},
+        {{-1, -1, -1, -1}, {{1, 3, 16, 17}, {2, 5, 4, 3}, {1, 3, 16, 17}, {1, 8, 1, 40}}},
+        {{-1, -1, -1, -1}, {{1, 3, 16, 17}, {2, 5, 4, 3}, {1, 3, 16, 17}, {1, 8, 1, 40}}},
+        {{-1, -1, -1, -1}, {{1, 3, 16, 17}, {2, 5, 4, 3}, {1, 3, 16, 17}, {1, 8, 1, 40}}},
+    },
+    // the broadcasting pattern changes between the inferences
+    {
+        {{-1, -1, -1, -1}, {{1, 3, 16, 17}, {1, 3, 5, 7}, {1, 8, 4, 33}, {1, 3, 5, 7}}},
+        {{-1, -1, -1, -1}, {{1, 3, 16, 17}, {1, 3, 5, 7}, {1, 8, 4, 33}, {1, 3, 5, 7}}},
+        {{-1, -1, -1, -1}, {{1, 3, 16, 17}, {1, 1, 5, 7}, {1, 8, 4, 1}, {1, 1, 5, 7}}},
+        {{-1, -1, -1, -1}, {{1, 3, 16, 17}, {1, 1, 5, 7}, {1, 8, 4, 1}, {1, 1, 5, 7}}},
+    },
+    // bounded dims
+    {
+        {{{1, 2}, {1, 16}, -1}, {{1, 16, 64}, {2, 4, 9}, {1, 16, 64}}},
+        {{{1, 2}, {1, 16}, -1}, {{1, 16, 64}, {2, 4, 9}, {1, 16, 64}}},
+        {{{1, 2}, {1, 16}, -1}, {{1, 1, 64}, {2, 4, 1}, {1, 16, 64}}},
+        {{{1, 2}, {1, 16}, -1}, {{1, 1, 64}, {2, 4, 1}, {1, 16, 64}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsDynamicShapes, SnippetsDynamicShapesTest,
+                         ::testing::ValuesIn(inputShapes),
+                         SnippetsDynamicShapesTest::getTestCaseName);
+
+} // namespace
+
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,114 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/common_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *     Parameter    Parameter
+ *           \      /
+ *            Concat    Constant
+ *                \     /
+ *                  Add
+ *                   |
+ *             Softmax / MVN    <- over the innermost dimension
+ *                   |
+ *                Multiply  Constant
+ *                    \     /
+ *                      Add
+ *                       |
+ *                     Result
+ */
+
+enum class ReductionType {
+    Softmax,
+    MVN
+};
+
+using SnippetsReductionParams = std::tuple<SizeVector,      // input shape
+                                           ReductionType>;
+
+class SnippetsReductionTest : public testing::WithParamInterface<SnippetsReductionParams>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SnippetsReductionParams> obj) {
+        SizeVector inputShape;
+        ReductionType reductionType;
+        std::tie(inputShape, reductionType) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "Reduction=" << (reductionType == ReductionType::Softmax ? "Softmax" : "MVN");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        std::tie(inputShape, reductionType) = this->GetParam();
+
+        const auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {inputShape, inputShape});
+        const auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        const auto rank = inputShape.size();
+        const auto concat = builder::makeConcat(paramOuts, rank - 2);
+        const Shape rowShape{inputShape.back()};
+        const auto bias = builder::makeConstant<float>(ngPrc, rowShape, {}, true);
+        const auto add = std::make_shared<opset1::Add>(concat, bias);
+
+        std::shared_ptr<Node> reduction;
+        if (reductionType == ReductionType::Softmax) {
+            reduction = std::make_shared<opset1::Softmax>(add, rank - 1);
+        } else {
+            const auto axes = opset1::Constant::create(element::i64, Shape{1}, {-1});
+            reduction = std::make_shared<opset6::MVN>(add, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+        }
+
+        const auto scale = builder::makeConstant<float>(ngPrc, rowShape, {}, true);
+        const auto shift = builder::makeConstant<float>(ngPrc, rowShape, {}, true);
+        const auto out = std::make_shared<opset1::Add>(std::make_shared<opset1::Multiply>(reduction, scale), shift);
+
+        ResultVector results{std::make_shared<opset1::Result>(out)};
+        function = std::make_shared<Function>(results, inputParams, "SnippetsReduction");
+    }
+
+    ReductionType reductionType;
+};
+
+TEST_P(SnippetsReductionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+        CheckNodeOfTypeCount(executableNetwork, reductionType == ReductionType::Softmax ? "Softmax" : "MVN", 0);
+    }
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 4, 16, 33},
+    {2, 10, 7},
+    {3, 64},
+    {1, 2, 5, 3},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsReduction, SnippetsReductionTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ReductionType::Softmax, ReductionType::MVN)),
+                         SnippetsReductionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
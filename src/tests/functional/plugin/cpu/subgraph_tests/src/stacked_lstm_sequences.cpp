@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter   Parameter (H, C)
+ *        \       /
+ *       LSTMSequence --- Result (H, C)
+ *            |
+ *         Squeeze     Parameter (H, C)
+ *             \       /
+ *            LSTMSequence --- Result (H, C)
+ *                 |
+ *                ...
+ *                 |
+ *               Result
+ */
+
+using StackedLSTMSequencesParams = std::tuple<size_t,   // input size of the first layer
+                                              size_t>;  // number of layers
+
+class StackedLSTMSequencesTest : public testing::WithParamInterface<StackedLSTMSequencesParams>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<StackedLSTMSequencesParams> obj) {
+        size_t inputSize, layers;
+        std::tie(inputSize, layers) = obj.param;
+
+        std::ostringstream result;
+        result << "InputSize=" << inputSize << "_";
+        result << "Layers=" << layers;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t batch = 2;
+    static constexpr size_t seqLength = 5;
+    static constexpr size_t hiddenSize = 16;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        size_t inputSize, layers;
+        std::tie(inputSize, layers) = this->GetParam();
+
+        auto ngPrc = element::f32;
+        std::vector<std::vector<size_t>> inputShapes{{batch, seqLength, inputSize}};
+        for (size_t layer = 0; layer < layers; layer++) {
+            inputShapes.push_back({batch, 1, hiddenSize});
+            inputShapes.push_back({batch, 1, hiddenSize});
+        }
+        auto inputParams = builder::makeParams(ngPrc, inputShapes);
+
+        ResultVector results;
+        Output<Node> data = inputParams[0];
+        for (size_t layer = 0; layer < layers; layer++) {
+            const size_t layerInputSize = layer == 0 ? inputSize : hiddenSize;
+            auto seqLengths = opset1::Constant::create(element::i64, Shape{batch}, std::vector<int64_t>(batch, seqLength));
+            auto W = builder::makeConstant<float>(ngPrc, {1, 4 * hiddenSize, layerInputSize}, {}, true, 1.0f, -1.0f);
+            auto R = builder::makeConstant<float>(ngPrc, {1, 4 * hiddenSize, hiddenSize}, {}, true, 1.0f, -1.0f);
+            auto B = builder::makeConstant<float>(ngPrc, {1, 4 * hiddenSize}, {}, true, 1.0f, -1.0f);
+            auto lstm = std::make_shared<opset5::LSTMSequence>(data, inputParams[1 + 2 * layer], inputParams[2 + 2 * layer],
+                                                               seqLengths, W, R, B, hiddenSize,
+                                                               op::RecurrentSequenceDirection::FORWARD);
+            results.push_back(std::make_shared<opset1::Result>(lstm->output(1)));
+            results.push_back(std::make_shared<opset1::Result>(lstm->output(2)));
+
+            auto axis = opset1::Constant::create(element::i64, Shape{1}, {1});
+            data = std::make_shared<opset1::Squeeze>(lstm->output(0), axis);
+        }
+        results.push_back(std::make_shared<opset1::Result>(data));
+        function = std::make_shared<ngraph::Function>(results, inputParams, "StackedLSTMSequences");
+    }
+};
+
+TEST_P(StackedLSTMSequencesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the layers with the input of the hidden size are executed by one multi-layer primitive
+    size_t inputSize, layers;
+    std::tie(inputSize, layers) = this->GetParam();
+    CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "RNNSeq", inputSize == hiddenSize ? 1 : 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_StackedLSTMSequences, StackedLSTMSequencesTest,
+                         ::testing::Combine(::testing::Values(16, 10),
+                                            ::testing::Values(2, 3)),
+                         StackedLSTMSequencesTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,88 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <openvino/op/util/variable.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+namespace {
+constexpr size_t channels = 4;
+} // namespace
+
+// Subgraph:
+/*
+ *   Parameter    ReadValue
+ *         \      /
+ *          Concat
+ *          /    \
+ *      Assign  Result
+ *
+ * The warm start runs the dynamic graphs with the recorded shapes before the first user inference. The stateful
+ * graphs are not warmed up, since the inference would append the zero tokens to the state.
+ */
+class StatefulShapesWarmStartTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cacheDir = std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + "_cache";
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "cpu_shapes");
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    static std::shared_ptr<ov::Model> createModel() {
+        const ov::PartialShape shape{1, -1, static_cast<int64_t>(channels)};
+        auto token = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "cache"});
+        auto cache = std::make_shared<ov::opset8::ReadValue>(token, variable);
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{cache, token}, 1);
+        auto assign = std::make_shared<ov::opset8::Assign>(concat, variable);
+        auto result = std::make_shared<ov::opset8::Result>(concat);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                           ov::ParameterVector{token}, "StatefulShapesWarmStart");
+    }
+
+    // compiles the model and returns the output of the first inference with the tokens of the given length
+    std::vector<float> firstInference(ov::runtime::Core& core, size_t length) const {
+        auto compiledModel = core.compile_model(createModel(), CommonTestUtils::DEVICE_CPU,
+                                                {{PluginConfigInternalParams::KEY_CPU_SHAPES_WARM_START, PluginConfigParams::YES}});
+        auto request = compiledModel.create_infer_request();
+        ov::runtime::Tensor token{ov::element::f32, ov::Shape{1, length, channels}};
+        std::fill_n(token.data<float>(), token.get_size(), 1.f);
+        request.set_tensor(compiledModel.input(), token);
+        request.infer();
+
+        const auto output = request.get_tensor(compiledModel.output());
+        const auto data = output.data<const float>();
+        return {data, data + output.get_size()};
+    }
+
+    std::string cacheDir;
+};
+
+TEST_F(StatefulShapesWarmStartTest, FirstInferenceMatchesRunWithoutWarmUp) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::runtime::Core core;
+    core.set_config({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+
+    // there is no shapes profile yet, so the first network is not warmed up; the profile is written on its release
+    const auto reference = firstInference(core, 2);
+    ASSERT_FALSE(CommonTestUtils::listFilesWithExt(cacheDir, "cpu_shapes").empty());
+
+    // the profile of the previous run is found, but the stateful graph must not be executed by the warm up
+    const auto output = firstInference(core, 2);
+    ASSERT_EQ(reference, output);
+}
+
+} // namespace CPUSubgraphTestsDefinitions
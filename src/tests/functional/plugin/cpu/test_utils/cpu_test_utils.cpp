@@ -327,9 +327,8 @@ auto adjustBlockedFormatByIsa = [](std::vector<cpu_memory_format_t>& formats) {
     return paramsVector;
 }
 
-void CheckNodeOfTypeCount(InferenceEngine::ExecutableNetwork &execNet, std::string nodeType, size_t expectedCount) {
-    InferenceEngine::CNNNetwork execGraphInfo = execNet.GetExecGraphInfo();
-    auto function = execGraphInfo.getFunction();
+namespace {
+void CheckNodeOfTypeCountImpl(std::shared_ptr<const ov::Model> function, std::string nodeType, size_t expectedCount) {
     ASSERT_NE(nullptr, function);
     size_t actualNodeCount = 0;
     for (const auto &node : function->get_ops()) {
@@ -346,6 +345,16 @@ void CheckNodeOfTypeCount(InferenceEngine::ExecutableNetwork &execNet, std::stri
 
     ASSERT_EQ(expectedCount, actualNodeCount) << "Unexpected count of the node type '" << nodeType << "' ";
 }
+} // namespace
+
+void CheckNodeOfTypeCount(InferenceEngine::ExecutableNetwork &execNet, std::string nodeType, size_t expectedCount) {
+    InferenceEngine::CNNNetwork execGraphInfo = execNet.GetExecGraphInfo();
+    CheckNodeOfTypeCountImpl(execGraphInfo.getFunction(), std::move(nodeType), expectedCount);
+}
+
+void CheckNodeOfTypeCount(ov::runtime::CompiledModel &execNet, std::string nodeType, size_t expectedCount) {
+    CheckNodeOfTypeCountImpl(execNet.get_runtime_model(), std::move(nodeType), expectedCount);
+}
 std::vector<CPUSpecificParams> filterCPUInfoForDevice(std::vector<CPUSpecificParams> CPUParams) {
     std::vector<CPUSpecificParams> resCPUParams;
     const int selectedTypeIndex = 3;
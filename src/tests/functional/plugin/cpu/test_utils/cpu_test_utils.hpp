@@ -170,4 +170,5 @@ const std::map<std::string, std::string> cpuBF16PluginConfig =
 std::vector<CPUSpecificParams> filterCPUSpecificParams(std::vector<CPUSpecificParams>& paramsVector);
 std::vector<CPUSpecificParams> filterCPUInfoForDevice(std::vector<CPUSpecificParams> CPUParams);
 void CheckNodeOfTypeCount(InferenceEngine::ExecutableNetwork &execNet, std::string nodeType, size_t expectedCount);
+void CheckNodeOfTypeCount(ov::runtime::CompiledModel &execNet, std::string nodeType, size_t expectedCount);
 } // namespace CPUTestUtils
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "openvino/runtime/core.hpp"
+
+#include <ie_plugin_config.hpp>
+#include <common_test_utils/test_common.hpp>
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ::testing;
+
+// The comma separated DEVICE_ID compiles one model for all the listed devices, the requests are distributed over them
+class MultiDeviceIdTest : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        function = ngraph::builder::subgraph::makeSplitMultiConvConcat();
+        for (const auto& device : core.get_available_devices()) {
+            const std::string prefix = std::string(CommonTestUtils::DEVICE_GPU) + ".";
+            if (device.compare(0, prefix.size(), prefix) == 0)
+                deviceIds.push_back(device.substr(prefix.size()));
+        }
+    }
+
+    // infers every request once and compares the outputs with the reference
+    void InferAndCompare(const std::map<std::string, std::string>& config, size_t numRequests) {
+        auto execNet = core.compile_model(function, CommonTestUtils::DEVICE_GPU, config);
+        const auto input = function->get_parameters().at(0);
+        const auto output = function->get_results().at(0);
+
+        std::vector<ov::runtime::InferRequest> requests;
+        std::vector<std::vector<uint8_t>> refs;
+        for (size_t i = 0; i < numRequests; i++) {
+            auto request = execNet.create_infer_request();
+            auto tensor = FuncTestUtils::create_and_fill_tensor(input->get_element_type(), input->get_shape());
+            request.set_tensor(input, tensor);
+            const auto inData = static_cast<uint8_t*>(tensor.data());
+            refs.push_back(ngraph::helpers::interpreterFunction(
+                function, {std::vector<uint8_t>(inData, inData + tensor.get_byte_size())}).front().second);
+            requests.push_back(request);
+        }
+
+        for (auto& request : requests)
+            request.start_async();
+        for (auto& request : requests)
+            request.wait();
+
+        const auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
+        const auto outElementsCount = ov::shape_size(function->get_output_shape(0));
+        for (size_t i = 0; i < requests.size(); i++) {
+            const auto outTensor = requests[i].get_tensor(output);
+            ASSERT_EQ(outElementsCount, outTensor.get_size());
+            FuncTestUtils::compareRawBuffers(outTensor.data<float>(), reinterpret_cast<const float*>(refs[i].data()),
+                                             outElementsCount, outElementsCount, thr);
+        }
+    }
+
+    ov::runtime::Core core;
+    std::shared_ptr<ngraph::Function> function;
+    std::vector<std::string> deviceIds;
+};
+
+TEST_F(MultiDeviceIdTest, canInferOnSingleDevice) {
+    if (deviceIds.empty())
+        GTEST_SKIP() << "No GPU devices";
+    InferAndCompare({{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, deviceIds.front()}}, 2);
+}
+
+TEST_F(MultiDeviceIdTest, canInferOnSingleDeviceList) {
+    if (deviceIds.empty())
+        GTEST_SKIP() << "No GPU devices";
+    // the list of one device takes the multi-device path without the additional devices
+    InferAndCompare({{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, deviceIds.front() + ","}}, 2);
+}
+
+TEST_F(MultiDeviceIdTest, canInferOnDeviceIdList) {
+    if (deviceIds.size() < 2)
+        GTEST_SKIP() << "At least two GPU devices are required";
+    std::string idList;
+    for (const auto& id : deviceIds)
+        idList += (idList.empty() ? "" : ",") + id;
+    // every device gets at least two requests with the round-robin binding
+    InferAndCompare({{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, idList}}, 2 * deviceIds.size());
+}
+
+TEST_F(MultiDeviceIdTest, canInferOnDeviceNamesList) {
+    if (deviceIds.size() < 2)
+        GTEST_SKIP() << "At least two GPU devices are required";
+    const std::string prefix = std::string(CommonTestUtils::DEVICE_GPU) + ".";
+    InferAndCompare({{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID,
+                      prefix + deviceIds[0] + "," + prefix + deviceIds[1]}}, 4);
+}
+
+TEST_F(MultiDeviceIdTest, throwsOnDuplicatedDeviceIds) {
+    if (deviceIds.empty())
+        GTEST_SKIP() << "No GPU devices";
+    ASSERT_ANY_THROW(core.compile_model(function, CommonTestUtils::DEVICE_GPU,
+                                        {{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID,
+                                          deviceIds.front() + "," + deviceIds.front()}}));
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "import_export_tests/import_export_performance.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+    {}
+};
+
+const std::vector<std::vector<size_t>> inputShapes = {
+    {1, 512},
+};
+
+// the measurements are recorded for the tracking only, so the suite is not a part of the smoke runs
+INSTANTIATE_TEST_SUITE_P(ImportExportPerformance, ImportExportPerformance,
+                        ::testing::Combine(
+                            ::testing::ValuesIn(inputShapes),
+                            ::testing::ValuesIn(netPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_GPU),
+                            ::testing::ValuesIn(configs)),
+                        ImportExportPerformance::getTestCaseName);
+
+} // namespace
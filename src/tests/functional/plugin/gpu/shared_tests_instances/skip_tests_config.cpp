@@ -50,8 +50,6 @@ std::vector<std::string> disabledTestPatterns() {
             R"(.*ConstantResultSubgraphTest.*inPrc=I16.*)",
             // TODO: Issue: 54194
             R"(.*ActivationLayerTest.*SoftPlus.*)",
-            // need to implement Export / Import
-            R"(.*IEClassImportExportTestP.*)",
             R"(.*Behavior.*InferRequestSetBlobByType.*Device=HETERO.*)",
             // TODO: Issue: 59586, NormalizeL2 output mismatch for empty axes case
             R"(.*NormalizeL2LayerTest.*axes=\(\).*)",
@@ -69,7 +67,6 @@ std::vector<std::string> disabledTestPatterns() {
             R"(.*Gather8LayerTest.*)",
             // Not implemented yet:
             R"(.*Behavior.*ExecutableNetworkBaseTest.*canSetConfigToExecNet.*)",
-            R"(.*Behavior.*ExecutableNetworkBaseTest.*canExport.*)",
             R"(.*OVExecutableNetworkBaseTest.*CanSetConfigToExecNet.*)",
             R"(.*OVExecutableNetworkBaseTest.*CanSetConfigToExecNetAndCheckConfigAndCheck.*)",
             // TODO: Issue 67408
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include <gpu/gpu_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <common_test_utils/test_common.hpp>
 #include <functional_test_utils/plugin_cache.hpp>
 
@@ -51,7 +52,8 @@ protected:
     size_t num_batch;
     std::vector<std::shared_ptr<ngraph::Function>> fn_ptrs;
 
-    void TestAutoBatch() {
+    // @p latency_budget (ms) enables the adaptive timeout instead of the fixed one, @p ladder the smaller compiled batches
+    void TestAutoBatch(unsigned int latency_budget = 0, bool ladder = false) {
         std::vector<InferenceEngine::CNNNetwork> nets;
         for (auto &fn_ptr : fn_ptrs) {
             nets.push_back(CNNNetwork(fn_ptr));
@@ -62,6 +64,7 @@ protected:
         std::vector<InferRequest> irs;
         std::vector<std::vector<uint8_t>> ref;
         std::vector<int> outElementsCount;
+        std::vector<ExecutableNetwork> exec_nets;
 
         for (size_t i = 0; i < nets.size(); ++i) {
             auto net = nets[i];
@@ -76,9 +79,14 @@ protected:
                 config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
             // minimize timeout to reduce test time
             config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+            if (latency_budget)
+                config[PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_BUDGET] = std::to_string(latency_budget);
+            if (ladder)
+                config[PluginConfigInternalParams::KEY_AUTO_BATCH_LADDER] = PluginConfigParams::YES;
             auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
                                                     device_name + "(" + std::to_string(num_batch) + ")",
                                                config);
+            exec_nets.push_back(exec_net_ref);
 
             for (size_t j = 0; j < num_requests; j++) {
                 outputs.push_back(net.getOutputsInfo().begin()->first); //single output
@@ -128,6 +136,39 @@ protected:
                                              outElementsCount[i],
                                              thr);
         }
+
+        // every request is executed either batched or with batch1 at the timeout
+        if (latency_budget) {
+            for (auto& exec_net : exec_nets) {
+                auto stats = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_STATISTICS)).as<std::map<std::string, uint64_t>>();
+                const auto batch = stats.at("BATCH_SIZE");
+                uint64_t executed = 0;
+                for (size_t w = 0; stats.count("WORKER_" + std::to_string(w) + "_BATCHES"); ++w) {
+                    const auto prefix = "WORKER_" + std::to_string(w) + "_";
+                    ASSERT_LE(stats.at(prefix + "TIMEOUT_MS"), latency_budget);
+                    executed += stats.at(prefix + "BATCHES") * batch + stats.at(prefix + "TIMED_OUT_REQUESTS");
+                }
+                if (batch > 1)
+                    ASSERT_EQ(num_requests * niter, executed);
+            }
+        }
+
+        // the data of the blobs got with the GetBlob are in the batched blob already, the others are copied or gathered
+        for (auto& exec_net : exec_nets) {
+            auto stats = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_STATISTICS)).as<std::map<std::string, uint64_t>>();
+            for (size_t w = 0; stats.count("WORKER_" + std::to_string(w) + "_BATCHES"); ++w) {
+                const auto prefix = "WORKER_" + std::to_string(w) + "_";
+                const auto moved = stats.at(prefix + "COPIED_BYTES") + stats.at(prefix + "GATHERED_BYTES");
+                if (use_get_blob)
+                    ASSERT_EQ(0, moved);
+                else if (stats.at(prefix + "BATCHES"))
+                    ASSERT_LT(0, moved);
+                // the requests executed with the smaller batches are a part of the timed out ones
+                ASSERT_LE(stats.at(prefix + "LADDER_REQUESTS"), stats.at(prefix + "TIMED_OUT_REQUESTS"));
+                if (!ladder)
+                    ASSERT_EQ(0, stats.at(prefix + "LADDER_BATCHES"));
+            }
+        }
     }
 };
 
@@ -154,6 +195,14 @@ TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test, compareAutoBatchingWithLatencyBudgetToSingleBatch) {
+    TestAutoBatch(100);
+}
+
+TEST_P(AutoBatching_Test, compareAutoBatchingWithLadderToSingleBatch) {
+    TestAutoBatch(0, true);
+}
+
 TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -862,6 +862,27 @@ TEST_P(OVClassNetworkTestP, LoadNetworkActualHeteroDevice2NoThrow) {
     ASSERT_NO_THROW(ie.compile_model(actualNetwork, CommonTestUtils::DEVICE_HETERO, {{"TARGET_FALLBACK", deviceName}}));
 }
 
+TEST_P(OVClassNetworkTestP, LoadNetworkAsyncSeveralModelsNoThrow) {
+    ov::runtime::Core ie = createCoreWithTemplate();
+    std::vector<std::shared_future<ov::runtime::CompiledModel>> futures;
+    for (int i = 0; i < 8; ++i) {
+        futures.push_back(ie.compile_model_async(i % 2 ? actualNetwork : simpleNetwork, deviceName));
+    }
+    // the identical requests in flight may share the executable network, the other ones are compiled at once
+    futures.push_back(ie.compile_model_async(actualNetwork, deviceName));
+    for (auto&& future : futures) {
+        ov::runtime::CompiledModel net;
+        ASSERT_NO_THROW(net = future.get());
+        ASSERT_NO_THROW(net.create_infer_request());
+    }
+}
+
+TEST_P(OVClassNetworkTestP, LoadNetworkAsyncRethrowsTheError) {
+    ov::runtime::Core ie = createCoreWithTemplate();
+    auto future = ie.compile_model_async(actualNetwork, "UNREGISTERED_DEVICE");
+    ASSERT_THROW(future.get(), ov::Exception);
+}
+
 TEST_P(OVClassNetworkTestP, LoadNetworkCreateDefaultExecGraphResult) {
     auto ie = createCoreWithTemplate();
     auto net = ie.compile_model(actualNetwork, deviceName);
@@ -12,6 +12,7 @@
 #include "common_test_utils/test_assertions.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/unicode_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 #include <iostream>
@@ -818,6 +819,20 @@ TEST_P(IEClassGetAvailableDevices, GetAvailableDevicesNoThrow) {
     ASSERT_TRUE(deviceFound);
 }
 
+TEST_P(IEClassGetAvailableDevices, GetAvailableDevicesFromCacheNoThrow) {
+    InferenceEngine::Core  ie = BehaviorTestsUtils::createIECoreWithTemplate();
+    ASSERT_NO_THROW(ie.SetConfig({{CONFIG_KEY_INTERNAL(AVAILABLE_DEVICES_CACHE_TTL), "60000"}}));
+    std::vector<std::string> devices;
+    ASSERT_NO_THROW(devices = ie.GetAvailableDevices());
+
+    std::vector<std::string> cachedDevices;
+    ASSERT_NO_THROW(cachedDevices = ie.GetAvailableDevices());
+    ASSERT_EQ(devices, cachedDevices);
+    ASSERT_NE(cachedDevices.end(), std::find_if(cachedDevices.begin(), cachedDevices.end(), [&](const std::string& device) {
+        return device.find(deviceName) != std::string::npos;
+    }));
+}
+
 //
 // QueryNetwork with HETERO on particular device
 //
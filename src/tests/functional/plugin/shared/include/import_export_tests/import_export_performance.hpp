@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+
+typedef std::tuple<
+    std::vector<size_t>,                // Input Shape
+    InferenceEngine::Precision,         // Network Precision
+    std::string,                        // Target Device
+    std::map<std::string, std::string>  // Configuration
+> importExportPerformanceParams;
+
+namespace LayerTestsDefinitions {
+
+/**
+ * @brief Measures the export / import round trip used by CACHE_DIR: the size of the exported blob,
+ * the import time and the time to the first inference after the import.
+ * The measurements are recorded as test properties, so they are tracked in the gtest XML reports;
+ * the timings depend on the machine load, so they are not compared with any thresholds.
+ */
+class ImportExportPerformance : public testing::WithParamInterface<importExportPerformanceParams>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<importExportPerformanceParams> obj);
+    void Run() override;
+
+protected:
+    void SetUp() override;
+
+    // the best of several runs is taken to make the measurements robust to the noise
+    size_t repetitions = 3;
+};
+
+} // namespace LayerTestsDefinitions
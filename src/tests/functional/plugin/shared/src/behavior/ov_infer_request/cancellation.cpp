@@ -61,6 +61,28 @@ TEST_P(OVInferRequestCancellationTests, canCancelInferRequest) {
     }
 }
 
+TEST_P(OVInferRequestCancellationTests, canInferBeforeDeadline) {
+    runtime::InferRequest req;
+    OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+    OV_ASSERT_NO_THROW(req.set_deadline(std::chrono::steady_clock::now() + std::chrono::hours{1}));
+    OV_ASSERT_NO_THROW(req.infer());
+    OV_ASSERT_NO_THROW(req.start_async());
+    OV_ASSERT_NO_THROW(req.wait());
+}
+
+TEST_P(OVInferRequestCancellationTests, CanResetAfterDeadlineExceeded) {
+    runtime::InferRequest req;
+    OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+    OV_ASSERT_NO_THROW(req.set_deadline(std::chrono::steady_clock::now() - std::chrono::milliseconds{1}));
+    try {
+        req.infer();
+    } catch (const ov::runtime::Cancelled&) {
+        SUCCEED();
+    }
+    OV_ASSERT_NO_THROW(req.set_deadline(std::chrono::steady_clock::time_point::max()));
+    OV_ASSERT_NO_THROW(req.infer());
+}
+
 }  // namespace behavior
 }  // namespace test
 }  // namespace ov
@@ -91,6 +91,28 @@ TEST_P(OVInferRequestIOTensorTest, failToSetOutputWithIncorrectSizes) {
     ASSERT_THROW(req.set_tensor(output, tensor), ov::Exception);
 }
 
+TEST_P(OVInferRequestIOTensorTest, failToSetInputReshapedAfterSet) {
+    auto tensor = utils::create_and_fill_tensor(input.get_element_type(), input.get_shape());
+    OV_ASSERT_NO_THROW(req.set_tensor(input, tensor));
+    auto shape = input.get_shape();
+    shape[0] *= 2;
+    tensor.set_shape(shape);
+    ASSERT_THROW(req.set_tensor(input, tensor), ov::Exception);
+}
+
+TEST_P(OVInferRequestIOTensorTest, canSetTensorByIndexAgain) {
+    auto input_tensor = utils::create_and_fill_tensor(input.get_element_type(), input.get_shape());
+    auto output_tensor = utils::create_and_fill_tensor(output.get_element_type(), output.get_shape());
+    for (size_t i = 0; i < 2; i++) {
+        OV_ASSERT_NO_THROW(req.set_input_tensor(0, input_tensor));
+        OV_ASSERT_NO_THROW(req.set_output_tensor(0, output_tensor));
+        OV_ASSERT_NO_THROW(req.infer());
+        ASSERT_EQ(input_tensor.data(), req.get_input_tensor(0).data());
+        ASSERT_EQ(output_tensor.data(), req.get_output_tensor(0).data());
+        ASSERT_EQ(input_tensor.data(), req.get_tensor(input).data());
+    }
+}
+
 TEST_P(OVInferRequestIOTensorTest, canInferWithoutSetAndGetInOutSync) {
     OV_ASSERT_NO_THROW(req.infer());
 }
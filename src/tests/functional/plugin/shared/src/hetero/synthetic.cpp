@@ -9,6 +9,7 @@
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
 #include "ie_algorithm.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -183,4 +184,131 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelined) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[InferenceEngine::PluginConfigInternalParams::KEY_HETERO_PIPELINE_STAGE_REQUESTS] = "1";
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    // more requests than a subgraph executes at once, so they wait for the subgraphs
+    std::vector<InferenceEngine::InferRequest> requests(4);
+    for (auto&& request : requests) {
+        request = executableNetwork.CreateInferRequest();
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            request.SetBlob(input.first, inferRequest.GetBlob(input.first));
+        }
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        request.Wait(InferenceEngine::InferRequest::RESULT_READY);
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            Compare(inferRequest.GetBlob(output.first), request.GetBlob(output.first));
+        }
+    }
+    auto statistics = executableNetwork.GetMetric(METRIC_KEY(HETERO_PIPELINE_STATISTICS)).as<std::map<std::string, uint64_t>>();
+    ASSERT_FALSE(statistics.empty());
+    for (size_t i = 0; statistics.count("STAGE_" + std::to_string(i) + "_INFERENCES"); ++i) {
+        const auto prefix = "STAGE_" + std::to_string(i) + "_";
+        ASSERT_EQ(requests.size(), statistics.at(prefix + "INFERENCES"));
+        ASSERT_EQ(1, statistics.at(prefix + "REQUESTS"));
+        ASSERT_GT(requests.size(), statistics.at(prefix + "MAX_QUEUED"));
+    }
+}
+
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackTransferFP16) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[InferenceEngine::PluginConfigInternalParams::KEY_HETERO_TRANSFER_PRECISION] = "FP16";
+    // the tensors crossing the devices lose the precision
+    threshold = 1e-2f;
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    // the tensors are converted on both sides of every cut between the devices
+    auto partition = executableNetwork.GetMetric(METRIC_KEY(HETERO_PARTITION)).as<std::map<std::string, std::string>>();
+    size_t producerConverts = 0, consumerConverts = 0;
+    for (auto&& layer : partition) {
+        const std::string suffix = "_parameter_transfer";
+        if (layer.first.size() > suffix.size() &&
+            layer.first.compare(layer.first.size() - suffix.size(), suffix.size(), suffix) == 0) {
+            consumerConverts++;
+        } else if (layer.first.find("_transfer") != std::string::npos) {
+            producerConverts++;
+        }
+    }
+    ASSERT_EQ(producerConverts, consumerConverts);
+    bool crossDevice = false;
+    for (auto&& node : function->get_ordered_ops()) {
+        for (auto&& input : node->input_values()) {
+            if (partition.count(node->get_friendly_name()) && partition.count(input.get_node()->get_friendly_name()) &&
+                input.get_element_type() == ngraph::element::f32 &&
+                partition.at(node->get_friendly_name()) != partition.at(input.get_node()->get_friendly_name())) {
+                crossDevice = true;
+            }
+        }
+    }
+    ASSERT_EQ(crossDevice, producerConverts != 0);
+}
+
+TEST_P(HeteroSyntheticTest, costBasedPartitioningWithMemoryCap) {
+    auto& pluginParameters = std::get<Plugin>(GetParam());
+    for (auto&& node : function->get_ordered_ops()) {
+        node->get_rt_info().erase("affinity");
+    }
+    // the weights don't fit the first device, so the layers with the weights go to the second one
+    configuration[InferenceEngine::PluginConfigInternalParams::KEY_HETERO_COST_BASED_PARTITIONING] =
+        InferenceEngine::PluginConfigParams::YES;
+    configuration[InferenceEngine::PluginConfigInternalParams::KEY_HETERO_DEVICES_MEMORY_CAP] =
+        pluginParameters.at(0)._name + ":1";
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    auto partition = executableNetwork.GetMetric(METRIC_KEY(HETERO_PARTITION)).as<std::map<std::string, std::string>>();
+    ASSERT_FALSE(partition.empty());
+    for (auto&& node : function->get_ordered_ops()) {
+        ASSERT_TRUE(partition.count(node->get_friendly_name())) << node->get_friendly_name();
+        auto& device = partition.at(node->get_friendly_name());
+        ASSERT_TRUE(device == pluginParameters.at(0)._name || device == pluginParameters.at(1)._name) << device;
+        for (auto&& input : node->input_values()) {
+            if (ngraph::op::is_constant(input.get_node()) && !ngraph::op::is_output(node)) {
+                ASSERT_EQ(pluginParameters.at(1)._name, device) << node->get_friendly_name();
+            }
+        }
+    }
+}
+
+TEST_P(HeteroSyntheticTest, pipelinePartitioning) {
+    auto& pluginParameters = std::get<Plugin>(GetParam());
+    for (auto&& node : function->get_ordered_ops()) {
+        node->get_rt_info().erase("affinity");
+    }
+    configuration[InferenceEngine::PluginConfigInternalParams::KEY_HETERO_PIPELINE_PARTITIONING] =
+        InferenceEngine::PluginConfigParams::YES;
+    configuration[InferenceEngine::PluginConfigInternalParams::KEY_HETERO_PIPELINE_STAGE_REQUESTS] = "1";
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    // the layers are split to the ranges in the order of the devices
+    auto partition = executableNetwork.GetMetric(METRIC_KEY(HETERO_PARTITION)).as<std::map<std::string, std::string>>();
+    bool secondStage = false;
+    for (auto&& node : function->get_ordered_ops()) {
+        if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
+            continue;
+        }
+        ASSERT_TRUE(partition.count(node->get_friendly_name())) << node->get_friendly_name();
+        auto& device = partition.at(node->get_friendly_name());
+        if (device == pluginParameters.at(1)._name) {
+            secondStage = true;
+        } else {
+            ASSERT_EQ(pluginParameters.at(0)._name, device);
+            ASSERT_FALSE(secondStage) << node->get_friendly_name();
+        }
+    }
+}
+
 }  //  namespace HeteroTests
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "import_export_tests/import_export_performance.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+template <typename F>
+double measureMs(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+std::string ImportExportPerformance::getTestCaseName(testing::TestParamInfo<importExportPerformanceParams> obj) {
+    std::vector<size_t> inputShape;
+    InferenceEngine::Precision netPrecision;
+    std::string targetDevice;
+    std::map<std::string, std::string> configuration;
+    std::tie(inputShape, netPrecision, targetDevice, configuration) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "netPRC=" << netPrecision.name() << "_";
+    result << "targetDevice=" << targetDevice << "_";
+    for (auto const& configItem : configuration) {
+        result << "_configItem=" << configItem.first << "_" << configItem.second;
+    }
+    return result.str();
+}
+
+void ImportExportPerformance::SetUp() {
+    std::vector<size_t> inputShape;
+    InferenceEngine::Precision netPrecision;
+    std::tie(inputShape, netPrecision, targetDevice, configuration) = this->GetParam();
+    const auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+
+    // a chain of fully connected layers: big enough for the compilation to dominate the noise
+    // and supported by every plugin able to export
+    auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+    std::shared_ptr<ngraph::Node> last = params[0];
+    for (size_t i = 0; i < 8; ++i) {
+        auto fc = ngraph::builder::makeFullyConnected(last, ngPrc, inputShape.back());
+        last = ngraph::builder::makeActivation(fc, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+    }
+    function = std::make_shared<ngraph::Function>(ngraph::OutputVector{last}, params, "ImportExportPerformance");
+}
+
+void ImportExportPerformance::Run() {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const InferenceEngine::CNNNetwork network{function};
+
+    double compileMs = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < repetitions; ++i) {
+        compileMs = std::min(compileMs, measureMs([&] {
+            executableNetwork = core->LoadNetwork(network, targetDevice, configuration);
+        }));
+    }
+
+    std::stringstream blob;
+    const auto exportMs = measureMs([&] { executableNetwork.Export(blob); });
+    const auto blobSize = blob.str().size();
+    ASSERT_GT(blobSize, 0);
+
+    double importMs = std::numeric_limits<double>::max();
+    double firstInferMs = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < repetitions; ++i) {
+        blob.clear();
+        blob.seekg(0, blob.beg);
+        importMs = std::min(importMs, measureMs([&] {
+            executableNetwork = core->ImportNetwork(blob, targetDevice, configuration);
+        }));
+        // the first inference includes the lazy initialization some plugins postpone after the import
+        firstInferMs = std::min(firstInferMs, measureMs([&] {
+            inferRequest = executableNetwork.CreateInferRequest();
+            inferRequest.Infer();
+        }));
+    }
+
+    RecordProperty("export_size_bytes", std::to_string(blobSize));
+    RecordProperty("compile_ms", std::to_string(compileMs));
+    RecordProperty("export_ms", std::to_string(exportMs));
+    RecordProperty("import_ms", std::to_string(importMs));
+    RecordProperty("first_infer_ms", std::to_string(firstInferMs));
+}
+
+TEST_P(ImportExportPerformance, MeasureImportAndExport) {
+    Run();
+};
+
+} // namespace LayerTestsDefinitions
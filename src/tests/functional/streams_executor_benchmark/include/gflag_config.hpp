@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gflags/gflags.h>
+#include <iostream>
+
+static const char help_message[] = "Print a usage message.";
+static const char executors_message[] = "Optional. Comma separated list of executors to measure: CPU (CPUStreamsExecutor) "
+                                        "and TBB (TBBStreamsExecutor, available in the TBB builds only)";
+static const char streams_message[] = "Optional. Comma separated list of the numbers of streams";
+static const char producers_message[] = "Optional. Comma separated list of the numbers of producer threads";
+static const char spin_wait_message[] = "Optional. Comma separated list of the spin wait times of the idle streams, "
+                                        "in microseconds (CPUStreamsExecutor only)";
+static const char tasks_message[] = "Optional. Number of tasks submitted by every producer in the throughput test";
+static const char task_work_message[] = "Optional. Number of busy loop iterations of every task, 0 means an empty task";
+static const char wakeups_message[] = "Optional. Number of tasks submitted one by one to the idle executor "
+                                      "in the wake-up latency test";
+static const char output_message[] = "Optional. Path to the JSON file to write the results";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(executors, "CPU,TBB", executors_message);
+DEFINE_string(streams, "1,2,4,8", streams_message);
+DEFINE_string(producers, "1,2,4,8", producers_message);
+DEFINE_string(spin_wait, "0,50", spin_wait_message);
+DEFINE_uint32(tasks, 100000, tasks_message);
+DEFINE_uint32(task_work, 0, task_work_message);
+DEFINE_uint32(wakeups, 1000, wakeups_message);
+DEFINE_string(output, "streams_executor.json", output_message);
+
+/**
+* @brief This function shows a help message
+*/
+static void showUsage() {
+    std::cout << "\n";
+    std::cout << "Streams Executor Benchmark [OPTION]\n";
+    std::cout << "Options:\n";
+    std::cout << "\n";
+    std::cout << "    -h                                     " << help_message << "\n";
+    std::cout << "    --executors \"<list>\"                   " << executors_message << "\n";
+    std::cout << "    --streams \"<list>\"                     " << streams_message << "\n";
+    std::cout << "    --producers \"<list>\"                   " << producers_message << "\n";
+    std::cout << "    --spin_wait \"<list>\"                   " << spin_wait_message << "\n";
+    std::cout << "    --tasks \"<value>\"                      " << tasks_message << "\n";
+    std::cout << "    --task_work \"<value>\"                  " << task_work_message << "\n";
+    std::cout << "    --wakeups \"<value>\"                    " << wakeups_message << "\n";
+    std::cout << "    --output \"<path>\"                      " << output_message << "\n";
+    std::cout << std::flush;
+}
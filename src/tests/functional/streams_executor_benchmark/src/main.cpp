@@ -0,0 +1,283 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_tbb_streams_executor.hpp>
+
+#include "gflag_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Percentiles {
+    double p50 = 0;
+    double p99 = 0;
+    double max = 0;
+};
+
+struct ThroughputResult {
+    std::string executor;
+    int streams;
+    int producers;
+    int spinWaitUs;
+    double tasksPerSec;
+    Percentiles submitNs;               // time spent in run() by a producer, grows with the queue contention
+    std::vector<uint64_t> streamTasks;  // tasks executed by every stream, CPUStreamsExecutor only
+};
+
+struct WakeupResult {
+    std::string executor;
+    int streams;
+    int spinWaitUs;
+    Percentiles latencyUs;  // time from run() to the start of the task on the idle executor
+};
+
+std::vector<int> splitList(const std::string& s) {
+    std::vector<int> result;
+    std::stringstream ss(s);
+    for (std::string item; std::getline(ss, item, ',');) {
+        if (!item.empty())
+            result.push_back(std::stoi(item));
+    }
+    return result;
+}
+
+std::vector<std::string> splitNames(const std::string& s) {
+    std::vector<std::string> result;
+    std::stringstream ss(s);
+    for (std::string item; std::getline(ss, item, ',');) {
+        if (!item.empty())
+            result.push_back(item);
+    }
+    return result;
+}
+
+template <typename T>
+Percentiles percentiles(std::vector<T> values) {
+    Percentiles result;
+    if (values.empty())
+        return result;
+    std::sort(values.begin(), values.end());
+    result.p50 = static_cast<double>(values[values.size() / 2]);
+    result.p99 = static_cast<double>(values[std::min(values.size() - 1, values.size() * 99 / 100)]);
+    result.max = static_cast<double>(values.back());
+    return result;
+}
+
+const char* threadingName() {
+#if IE_THREAD == IE_THREAD_TBB
+    return "TBB";
+#elif IE_THREAD == IE_THREAD_TBB_AUTO
+    return "TBB_AUTO";
+#elif IE_THREAD == IE_THREAD_OMP
+    return "OMP";
+#else
+    return "SEQ";
+#endif
+}
+
+bool isExecutorSupported(const std::string& executor) {
+    if (executor == "CPU")
+        return true;
+#if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
+    if (executor == "TBB")
+        return true;
+#endif
+    return false;
+}
+
+IStreamsExecutor::Ptr createExecutor(const std::string& executor, int streams, int spinWaitUs) {
+    IStreamsExecutor::Config config{"StreamsExecutorBenchmark", streams};
+    config._spinWaitUs = spinWaitUs;
+#if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
+    if (executor == "TBB")
+        return std::make_shared<TBBStreamsExecutor>(config);
+#endif
+    return std::make_shared<CPUStreamsExecutor>(config);
+}
+
+void doWork(size_t iterations) {
+    volatile size_t sink = 0;
+    for (size_t i = 0; i < iterations; ++i)
+        sink = sink + i;
+}
+
+/**
+ * @brief M producers submit the tiny tasks as fast as they can, the throughput is the number of the tasks
+ * executed per second from the start of the submission to the completion of the last task
+ */
+ThroughputResult measureThroughput(const std::string& executorName, int streams, int producers, int spinWaitUs) {
+    auto executor = createExecutor(executorName, streams, spinWaitUs);
+    const size_t tasksPerProducer = FLAGS_tasks;
+    const size_t total = tasksPerProducer * producers;
+    const size_t taskWork = FLAGS_task_work;
+
+    std::atomic<size_t> done{0};
+    std::atomic<bool> start{false};
+    std::vector<std::vector<uint32_t>> submitNs(producers);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            auto& samples = submitNs[p];
+            samples.reserve(tasksPerProducer);
+            while (!start.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            for (size_t i = 0; i < tasksPerProducer; ++i) {
+                const auto t0 = Clock::now();
+                executor->run([&] {
+                    doWork(taskWork);
+                    done.fetch_add(1, std::memory_order_relaxed);
+                });
+                samples.push_back(static_cast<uint32_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count()));
+            }
+        });
+    }
+
+    const auto begin = Clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads)
+        thread.join();
+    while (done.load(std::memory_order_relaxed) < total)
+        std::this_thread::yield();
+    const auto seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    ThroughputResult result{executorName, streams, producers, spinWaitUs, total / seconds, {}, {}};
+    std::vector<uint32_t> allSamples;
+    allSamples.reserve(total);
+    for (const auto& samples : submitNs)
+        allSamples.insert(allSamples.end(), samples.begin(), samples.end());
+    result.submitNs = percentiles(std::move(allSamples));
+    if (auto cpuExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(executor)) {
+        for (const auto& stream : cpuExecutor->GetStreamsStatistics())
+            result.streamTasks.push_back(stream.tasks);
+    }
+    return result;
+}
+
+/**
+ * @brief Submits the tasks one by one with the pauses long enough for the streams to park,
+ * so every task measures the wake-up of an idle stream
+ */
+WakeupResult measureWakeup(const std::string& executorName, int streams, int spinWaitUs) {
+    auto executor = createExecutor(executorName, streams, spinWaitUs);
+    std::vector<double> latencies;
+    latencies.reserve(FLAGS_wakeups);
+    for (size_t i = 0; i < FLAGS_wakeups; ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(spinWaitUs + 1000));
+        std::atomic<bool> started{false};
+        Clock::time_point startedAt;
+        const auto submittedAt = Clock::now();
+        executor->run([&] {
+            startedAt = Clock::now();
+            started.store(true, std::memory_order_release);
+        });
+        while (!started.load(std::memory_order_acquire))
+            std::this_thread::yield();
+        latencies.push_back(std::chrono::duration<double, std::micro>(startedAt - submittedAt).count());
+    }
+    return {executorName, streams, spinWaitUs, percentiles(std::move(latencies))};
+}
+
+void writePercentiles(std::ostream& file, const std::string& name, const Percentiles& value) {
+    file << "\"" << name << "\": {\"p50\": " << value.p50 << ", \"p99\": " << value.p99 << ", \"max\": " << value.max
+         << "}";
+}
+
+void writeResults(const std::vector<ThroughputResult>& throughput, const std::vector<WakeupResult>& wakeup) {
+    std::ofstream file(FLAGS_output);
+    if (!file.good())
+        throw std::runtime_error("Results file \"" + FLAGS_output + "\" can't be used for writing");
+
+    char date[32];
+    const auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    file << "{\n  \"context\": {\n    \"date\": \"" << date << "\",\n    \"threading\": \"" << threadingName()
+         << "\",\n    \"hardware_concurrency\": " << std::thread::hardware_concurrency()
+         << ",\n    \"tasks_per_producer\": " << FLAGS_tasks << ",\n    \"task_work\": " << FLAGS_task_work
+         << "\n  },\n  \"throughput\": [";
+    for (size_t i = 0; i < throughput.size(); ++i) {
+        const auto& r = throughput[i];
+        file << (i ? "," : "") << "\n    {\"executor\": \"" << r.executor << "\", \"streams\": " << r.streams
+             << ", \"producers\": " << r.producers << ", \"spin_wait_us\": " << r.spinWaitUs
+             << ", \"tasks_per_sec\": " << r.tasksPerSec << ", ";
+        writePercentiles(file, "submit_ns", r.submitNs);
+        file << ", \"stream_tasks\": [";
+        for (size_t s = 0; s < r.streamTasks.size(); ++s)
+            file << (s ? ", " : "") << r.streamTasks[s];
+        file << "]}";
+    }
+    file << "\n  ],\n  \"wakeup\": [";
+    for (size_t i = 0; i < wakeup.size(); ++i) {
+        const auto& r = wakeup[i];
+        file << (i ? "," : "") << "\n    {\"executor\": \"" << r.executor << "\", \"streams\": " << r.streams
+             << ", \"spin_wait_us\": " << r.spinWaitUs << ", ";
+        writePercentiles(file, "latency_us", r.latencyUs);
+        file << "}";
+    }
+    file << "\n  ]\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return 0;
+    }
+
+    try {
+        std::vector<ThroughputResult> throughput;
+        std::vector<WakeupResult> wakeup;
+        std::cout << "[ INFO ] Threading: " << threadingName() << std::endl;
+        for (const auto& executor : splitNames(FLAGS_executors)) {
+            if (!isExecutorSupported(executor)) {
+                std::cout << "[ WARNING ] " << executor << " executor is not available in this build, skipped"
+                          << std::endl;
+                continue;
+            }
+            auto spinWaits = splitList(FLAGS_spin_wait);
+            // TBBStreamsExecutor has no spin wait
+            if (executor != "CPU" || spinWaits.empty())
+                spinWaits = {0};
+            for (const auto streams : splitList(FLAGS_streams)) {
+                for (const auto spinWaitUs : spinWaits) {
+                    for (const auto producers : splitList(FLAGS_producers)) {
+                        throughput.push_back(measureThroughput(executor, streams, producers, spinWaitUs));
+                        const auto& r = throughput.back();
+                        std::cout << "[ RUN ] " << executor << " streams=" << streams << " producers=" << producers
+                                  << " spin_wait_us=" << spinWaitUs << ": " << r.tasksPerSec << " tasks/s, submit p99 "
+                                  << r.submitNs.p99 << " ns" << std::endl;
+                    }
+                    if (FLAGS_wakeups > 0) {
+                        wakeup.push_back(measureWakeup(executor, streams, spinWaitUs));
+                        std::cout << "[ RUN ] " << executor << " streams=" << streams << " spin_wait_us=" << spinWaitUs
+                                  << ": wake-up p50 " << wakeup.back().latencyUs.p50 << " us, p99 "
+                                  << wakeup.back().latencyUs.p99 << " us" << std::endl;
+                    }
+                }
+            }
+        }
+        writeResults(throughput, wakeup);
+    } catch (const std::exception& ex) {
+        std::cerr << "[ ERROR ] " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
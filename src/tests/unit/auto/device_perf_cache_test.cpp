@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <ie_plugin_config.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include "device_perf_cache.hpp"
+
+using namespace MockMultiDevicePlugin;
+
+class DevicePerfCacheTest : public ::testing::Test {
+public:
+    const std::string cacheDir = ".";
+    const std::string modelKey = "device_perf_cache_test";
+
+    void TearDown() override {
+        std::remove((cacheDir + "/" + modelKey + ".auto_perf").c_str());
+    }
+};
+
+TEST_F(DevicePerfCacheTest, measurementsArePersisted) {
+    {
+        DevicePerfCache cache(cacheDir, modelKey);
+        DevicePerfCache::Record record;
+        ASSERT_FALSE(cache.Get("CPU_01", record));
+        cache.Update("CPU_01", 100, 10, 4);
+        cache.Update("dGPU_01", 50, 20, 8);
+        cache.Save();
+    }
+
+    DevicePerfCache cache(cacheDir, modelKey);
+    DevicePerfCache::Record record;
+    ASSERT_TRUE(cache.Get("CPU_01", record));
+    EXPECT_DOUBLE_EQ(100, record.latencyUs);
+    EXPECT_EQ(10, record.inferences);
+    EXPECT_EQ(4, record.requests);
+    ASSERT_TRUE(cache.Get("dGPU_01", record));
+    EXPECT_DOUBLE_EQ(50, record.latencyUs);
+    EXPECT_EQ(8, record.requests);
+}
+
+TEST_F(DevicePerfCacheTest, measurementsAreAveraged) {
+    DevicePerfCache cache(cacheDir, modelKey);
+    cache.Update("CPU_01", 100, 10, 4);
+    cache.Update("CPU_01", 200, 30, 2);
+    // ignored
+    cache.Update("CPU_01", 0, 0, 4);
+
+    DevicePerfCache::Record record;
+    ASSERT_TRUE(cache.Get("CPU_01", record));
+    EXPECT_DOUBLE_EQ(175, record.latencyUs);
+    EXPECT_EQ(40, record.inferences);
+    EXPECT_EQ(2, record.requests);
+}
+
+TEST_F(DevicePerfCacheTest, modelKeyDependsOnModelAndHint) {
+    InferenceEngine::CNNNetwork conv(ngraph::builder::subgraph::makeConvPoolRelu());
+    InferenceEngine::CNNNetwork split(ngraph::builder::subgraph::makeSplitConvConcat());
+    const auto latency = InferenceEngine::PluginConfigParams::LATENCY;
+    const auto throughput = InferenceEngine::PluginConfigParams::THROUGHPUT;
+
+    EXPECT_EQ(DevicePerfCache::ComputeModelKey("", conv, latency), DevicePerfCache::ComputeModelKey("", conv, latency));
+    EXPECT_NE(DevicePerfCache::ComputeModelKey("", conv, latency), DevicePerfCache::ComputeModelKey("", split, latency));
+    EXPECT_NE(DevicePerfCache::ComputeModelKey("", conv, latency), DevicePerfCache::ComputeModelKey("", conv, throughput));
+    EXPECT_NE(DevicePerfCache::ComputeModelKey("a.xml", {}, latency), DevicePerfCache::ComputeModelKey("b.xml", {}, latency));
+}
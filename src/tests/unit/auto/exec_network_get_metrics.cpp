@@ -260,6 +260,46 @@ TEST_P(ExecNetworkGetMetric, OPTIMAL_NUMBER_OF_INFER_REQUESTS) {
     EXPECT_EQ(result, expectOptimalNum);
 }
 
+using ExecNetworkGetHandoffMetric = ExecNetworkGetMetric;
+
+TEST_F(ExecNetworkGetHandoffMetric, AUTO_HANDOFF_STATISTICS) {
+    metaDevices.push_back({CommonTestUtils::DEVICE_CPU, {}, -1, ""});
+    metaDevices.push_back({CommonTestUtils::DEVICE_GPU, {}, -1, ""});
+    ON_CALL(*plugin, SelectDevice(_, _, _)).WillByDefault(Return(metaDevices[1]));
+    ON_CALL(*plugin, ParseMetaDevices(_, _)).WillByDefault(Return(metaDevices));
+    ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_CPU)),
+                ::testing::Matcher<const Config&>(_))).WillByDefault(Return(cpuMockExeNetwork));
+    ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_GPU)),
+                ::testing::Matcher<const Config&>(_))).WillByDefault(InvokeWithoutArgs([this]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            return gpuMockExeNetwork;
+            }));
+    unsigned int optimalNum = 2;
+    ON_CALL(*cpuMockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+           .WillByDefault(RETURN_MOCK_VALUE(optimalNum));
+    ON_CALL(*gpuMockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+           .WillByDefault(RETURN_MOCK_VALUE(optimalNum));
+    EXPECT_CALL(*cpuMockIExeNet.get(), GetMetric(_)).Times(AnyNumber());
+    EXPECT_CALL(*gpuMockIExeNet.get(), GetMetric(_)).Times(AnyNumber());
+    config.insert({CONFIG_KEY_INTERNAL(AUTO_CPU_HELP_OVERFLOW), InferenceEngine::PluginConfigParams::YES});
+
+    auto AutoExecNetwork = plugin->LoadExeNetworkImpl(cnnNet, config);
+    using Stats = std::map<std::string, uint64_t>;
+    auto stats = AutoExecNetwork->GetMetric(METRIC_KEY(AUTO_HANDOFF_STATISTICS)).as<Stats>();
+    // no inferences yet
+    EXPECT_EQ(0, stats.at("FIRST_INFERENCE_TIME_US"));
+    EXPECT_EQ(0, stats.at("ACTUAL_DEVICE_FIRST_INFERENCE_TIME_US"));
+    EXPECT_EQ(0, stats.at("CPU_HELP_INFERENCES"));
+    EXPECT_EQ(0, stats.at("ACTUAL_DEVICE_INFERENCES"));
+    // the time to the actual device includes its (slow) loading
+    for (int i = 0; i < 100 && !stats.at("ACTUAL_DEVICE_READY_TIME_US"); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        stats = AutoExecNetwork->GetMetric(METRIC_KEY(AUTO_HANDOFF_STATISTICS)).as<Stats>();
+    }
+    EXPECT_LE(100000, stats.at("ACTUAL_DEVICE_READY_TIME_US"));
+}
 
 // ConfigParams {bool, unsigned int, int, bool,
 //               unsigned int, int, bool, unsigned int}
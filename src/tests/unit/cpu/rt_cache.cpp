@@ -8,6 +8,7 @@
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "cache/multi_cache.h"
 
 using namespace MKLDNNPlugin;
@@ -96,6 +97,116 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(LruCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i <= 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i <= 2 * capacity; ++i) {
+        cache.get({i});
+    }
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, capacity);
+    ASSERT_EQ(statistics.misses, capacity);
+    ASSERT_EQ(statistics.evictions, capacity);
+}
+
+TEST(ShardedLruCacheTests, Evict) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({10}, 10));
+    }
+    ASSERT_NO_THROW(cache.evict(5));
+    ASSERT_NO_THROW(cache.evict(10));
+    int result = cache.get({10});
+    ASSERT_EQ(result, int());
+    ASSERT_NO_THROW(cache.evict(0));
+    ASSERT_NO_THROW(cache.put({10}, 10));
+    ASSERT_EQ(cache.get({10}), 10);
+}
+
+TEST(ShardedLruCacheTests, Get) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ShardedLruCacheTests, LruPolicy) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr size_t attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ShardedLruCacheTests, Shards) {
+    constexpr size_t capacity = 16;
+    constexpr size_t shards = 4;
+    ShardedLruCache<IntKey, int> cache(capacity, shards);
+    for (int i = 1; i <= 4 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    size_t found = 0;
+    for (int i = 1; i <= 4 * capacity; ++i) {
+        auto result = cache.get({i});
+        if (result != int()) {
+            ASSERT_EQ(result, i);
+            ++found;
+        }
+    }
+    // every shard is filled up to its capacity
+    ASSERT_EQ(found, capacity);
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, capacity);
+    ASSERT_EQ(statistics.misses, 3 * capacity);
+    ASSERT_EQ(statistics.evictions, 3 * capacity);
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -379,3 +490,38 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 100;
+    constexpr size_t numThreads = 8;
+    constexpr int numKeys = 50;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, numThreads);
+
+    auto testRoutine = [&]() {
+        for (int n = 0; n < 10; ++n) {
+            for (int i = 0; i < numKeys; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, numThreads * numKeys * 10);
+    ASSERT_GE(statistics.misses, numKeys);
+    ASSERT_EQ(statistics.evictions, 0);
+}
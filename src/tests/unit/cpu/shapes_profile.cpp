@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset8.hpp>
+#include "cache/shapes_profile.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(ShapesProfileTests, SaveLoad) {
+    ShapesProfile profile(10);
+    profile.add({{"input 0", {1, 3, 224, 224}}, {"input:1", {1, 10}}});
+    profile.add({{"input 0", {2, 3, 112, 112}}, {"input:1", {2, 10}}});
+    profile.add({{"input 0", {1, 3, 224, 224}}, {"input:1", {1, 10}}});
+    profile.add({{"input 0", {}}, {"input:1", {0}}});
+
+    std::stringstream stream;
+    profile.save(stream);
+
+    ShapesProfile loaded(10);
+    ASSERT_NO_THROW(loaded.load(stream));
+    ASSERT_EQ(loaded.get(), profile.get());
+    ASSERT_EQ(loaded.get().size(), 3);
+}
+
+TEST(ShapesProfileTests, Capacity) {
+    ShapesProfile profile(2);
+    for (size_t i = 1; i < 5; ++i) {
+        profile.add({{"input", {i, 10}}});
+    }
+    ASSERT_EQ(profile.get().size(), 2);
+
+    std::stringstream stream;
+    profile.save(stream);
+    ShapesProfile loaded(1);
+    ASSERT_NO_THROW(loaded.load(stream));
+    ASSERT_EQ(loaded.get().size(), 1);
+}
+
+TEST(ShapesProfileTests, InvalidFormat) {
+    ShapesProfile profile(10);
+    std::stringstream stream("not a profile\n1\n2 1 2 input\n");
+    ASSERT_ANY_THROW(profile.load(stream));
+    ASSERT_TRUE(profile.empty());
+}
+
+TEST(ShapesProfileTests, ComputeKey) {
+    auto makeFunction = [](const std::string& name) {
+        auto param = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::PartialShape{-1, 10});
+        auto relu = std::make_shared<ngraph::opset8::Relu>(param);
+        relu->set_friendly_name(name);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{param});
+    };
+    ASSERT_EQ(ShapesProfile::computeKey(makeFunction("relu")), ShapesProfile::computeKey(makeFunction("relu")));
+    ASSERT_NE(ShapesProfile::computeKey(makeFunction("relu")), ShapesProfile::computeKey(makeFunction("other")));
+}
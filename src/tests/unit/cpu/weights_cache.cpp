@@ -0,0 +1,116 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <limits>
+
+#include "mkldnn_weights_cache.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+MKLDNNMemoryPtr createMemory(const mkldnn::engine& eng, size_t elements) {
+    MKLDNNMemoryPtr memory = std::make_shared<MKLDNNMemory>(eng);
+    memory->Create(CpuBlockedMemoryDesc(Precision::FP32, Shape(SizeVector{elements})));
+    return memory;
+}
+} // namespace
+
+TEST(WeightsSharingTests, ResidentBytes) {
+    const mkldnn::engine eng(dnnl::engine::kind::cpu, 0);
+    MKLDNNWeightsSharing cache;
+
+    auto first = *cache.findOrCreate("first", [&] { return createMemory(eng, 16); });
+    auto second = *cache.findOrCreate("second", [&] { return createMemory(eng, 32); });
+    ASSERT_EQ(cache.getResidentBytes(), 48 * sizeof(float));
+
+    // the cache doesn't own the memory, the released objects are not resident anymore
+    second.reset();
+    ASSERT_EQ(cache.getResidentBytes(), 16 * sizeof(float));
+}
+
+TEST(WeightsSharingTests, ReplicationBySize) {
+    const mkldnn::engine eng(dnnl::engine::kind::cpu, 0);
+    auto sharedCache = std::make_shared<MKLDNNWeightsSharing>();
+    auto localCache0 = std::make_shared<MKLDNNWeightsSharing>();
+    auto localCache1 = std::make_shared<MKLDNNWeightsSharing>();
+    const size_t threshold = 16 * sizeof(float);
+    MKLDNNWeightsSharing node0(localCache0, sharedCache, threshold);
+    MKLDNNWeightsSharing node1(localCache1, sharedCache, threshold);
+
+    int created = 0;
+    auto createSmall = [&] { ++created; return createMemory(eng, 16); };
+    auto createBig = [&] { ++created; return createMemory(eng, 64); };
+
+    MKLDNNMemoryPtr small0 = *node0.findOrCreate("small", createSmall);
+    MKLDNNMemoryPtr big0 = *node0.findOrCreate("big", createBig);
+    MKLDNNMemoryPtr small1 = *node1.findOrCreate("small", createSmall);
+    MKLDNNMemoryPtr big1 = *node1.findOrCreate("big", createBig);
+
+    // the small weights are replicated, the big ones are stored once
+    ASSERT_EQ(created, 3);
+    ASSERT_NE(small0, small1);
+    ASSERT_EQ(big0, big1);
+
+    ASSERT_EQ(localCache0->getResidentBytes(), 16 * sizeof(float));
+    ASSERT_EQ(localCache1->getResidentBytes(), 16 * sizeof(float));
+    ASSERT_EQ(sharedCache->getResidentBytes(), 64 * sizeof(float));
+
+    ASSERT_EQ(static_cast<MKLDNNMemoryPtr>(*node1.get("big")), big0);
+    ASSERT_EQ(static_cast<MKLDNNMemoryPtr>(*node1.get("small")), small1);
+    ASSERT_ANY_THROW(node1.get("unknown"));
+}
+
+TEST(WeightsSharingTests, NoReplication) {
+    const mkldnn::engine eng(dnnl::engine::kind::cpu, 0);
+    auto sharedCache = std::make_shared<MKLDNNWeightsSharing>();
+    MKLDNNWeightsSharing node0(std::make_shared<MKLDNNWeightsSharing>(), sharedCache, 0);
+    MKLDNNWeightsSharing node1(std::make_shared<MKLDNNWeightsSharing>(), sharedCache, 0);
+
+    MKLDNNMemoryPtr memory0 = *node0.findOrCreate("weights", [&] { return createMemory(eng, 8); });
+    MKLDNNMemoryPtr memory1 = *node1.findOrCreate("weights", [&] { return createMemory(eng, 8); });
+
+    ASSERT_EQ(memory0, memory1);
+    ASSERT_EQ(sharedCache->getResidentBytes(), 8 * sizeof(float));
+}
+
+TEST(WeightsSharingTests, NetworkKeys) {
+    const mkldnn::engine eng(dnnl::engine::kind::cpu, 0);
+    auto localCache = std::make_shared<MKLDNNWeightsSharing>();
+    auto sharedCache = std::make_shared<MKLDNNWeightsSharing>();
+    const auto fullReplication = std::numeric_limits<size_t>::max();
+    MKLDNNWeightsSharing network0(localCache, sharedCache, fullReplication, "content_0_", true);
+    MKLDNNWeightsSharing network1(localCache, sharedCache, fullReplication, "content_0_", true);
+    MKLDNNWeightsSharing network2(localCache, sharedCache, fullReplication, "content_1_", true);
+
+    MKLDNNMemoryPtr memory0 = *network0.findOrCreate("weights", [&] { return createMemory(eng, 8); });
+    MKLDNNMemoryPtr memory1 = *network1.findOrCreate("weights", [&] { return createMemory(eng, 8); });
+    MKLDNNMemoryPtr memory2 = *network2.findOrCreate("weights", [&] { return createMemory(eng, 8); });
+
+    // the networks with the same key share the weights, the other ones don't
+    ASSERT_EQ(memory0, memory1);
+    ASSERT_NE(memory0, memory2);
+    ASSERT_TRUE(network0.hasContentKeys());
+    ASSERT_ANY_THROW(network2.get("unknown"));
+    ASSERT_EQ(localCache->getResidentBytes(), 16 * sizeof(float));
+}
+
+TEST(WeightsSharingTests, ExpiredEntriesArePruned) {
+    const mkldnn::engine eng(dnnl::engine::kind::cpu, 0);
+    auto localCache = std::make_shared<MKLDNNWeightsSharing>();
+    auto sharedCache = std::make_shared<MKLDNNWeightsSharing>();
+    const auto fullReplication = std::numeric_limits<size_t>::max();
+
+    // the networks are loaded and released one by one, the cache keeps the entries of the alive one only
+    MKLDNNMemoryPtr alive;
+    for (size_t i = 0; i < 2000; i++) {
+        MKLDNNWeightsSharing network(localCache, sharedCache, fullReplication, "network_" + std::to_string(i) + "_");
+        alive = *network.findOrCreate("weights", [&] { return createMemory(eng, 8); });
+    }
+
+    ASSERT_LT(localCache->getEntriesCount(), 1000);
+    ASSERT_EQ(localCache->getResidentBytes(), 8 * sizeof(float));
+}
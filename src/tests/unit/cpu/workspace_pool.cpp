@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_workspace_pool.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(WorkspacePoolTests, ResidentCountIsLimited) {
+    constexpr size_t capacity = 2;
+    constexpr size_t arenaSize = 1 << 20;
+    auto pool = std::make_shared<MKLDNNWorkspacePool>(capacity);
+
+    std::vector<MKLDNNWorkspacePool::Arena::Ptr> arenas;
+    for (size_t i = 0; i < 4; ++i) {
+        arenas.push_back(pool->createArena(arenaSize));
+        ASSERT_NE(arenas.back()->getData(), nullptr);
+        ASSERT_LE(pool->getResidentCount(), capacity);
+    }
+
+    for (auto& arena : arenas) {
+        MKLDNNWorkspacePool::Lease lease(arena);
+        std::memset(arena->getData(), 1, arena->getSize());
+        ASSERT_LE(pool->getResidentCount(), capacity);
+    }
+}
+
+TEST(WorkspacePoolTests, LeasedArenasStayResident) {
+    constexpr size_t capacity = 1;
+    auto pool = std::make_shared<MKLDNNWorkspacePool>(capacity);
+    auto arena0 = pool->createArena(4096);
+    auto arena1 = pool->createArena(4096);
+
+    {
+        MKLDNNWorkspacePool::Lease lease0(arena0);
+        MKLDNNWorkspacePool::Lease lease1(arena1);
+        // both arenas are in use, so neither may be released
+        ASSERT_EQ(pool->getResidentCount(), 2);
+        std::memset(arena0->getData(), 1, arena0->getSize());
+        std::memset(arena1->getData(), 1, arena1->getSize());
+    }
+    ASSERT_EQ(pool->getResidentCount(), capacity);
+
+    arena0.reset();
+    arena1.reset();
+    ASSERT_EQ(pool->getResidentCount(), 0);
+}
+
+TEST(WorkspacePoolTests, EmptyArena) {
+    auto pool = std::make_shared<MKLDNNWorkspacePool>(1);
+    auto arena = pool->createArena(0);
+    ASSERT_EQ(arena->getData(), nullptr);
+    ASSERT_NO_THROW(MKLDNNWorkspacePool::Lease lease(arena));
+}
@@ -247,4 +247,31 @@ TEST_F(GNAMemoryCompactTest, canOptimizeReservePtrWithOffset) {
     mem.commit(isCompact);
     ASSERT_EQ(mem.getRWBytes(), 4 * sizeof(float));
     ASSERT_EQ(mem.getTotalBytes(), 4 * sizeof(float));
-}
\ No newline at end of file
+}
+TEST_F(GNAMemoryCompactTest, canPlaceRequestsWithoutLayerAfterOptimizedOnes) {
+    IE_SUPPRESS_DEPRECATED_START
+    CNNLayerPtr layer1 = std::make_shared<CNNLayer>(LayerParams("layer1", "test", Precision::FP32));
+    CNNLayerPtr layer2 = std::make_shared<CNNLayer>(LayerParams("layer2", "test", Precision::FP32));
+    layer1->userValue.v_int = 1;
+    layer2->userValue.v_int = 2;
+    IE_SUPPRESS_DEPRECATED_END
+
+    float* pFuture1 = reinterpret_cast<float*>(&pFuture1);
+    float* pFuture2 = reinterpret_cast<float*>(&pFuture2);
+    float* pFuture3 = reinterpret_cast<float*>(&pFuture3);
+
+    mem.reserve_ptr(layer1, pFuture1, 3 * sizeof(float));
+    mem.reserve_ptr(layer2, pFuture2, 2 * sizeof(float));
+    mem.setCompactMode(isCompact);
+    ASSERT_EQ(mem.getRWBytesNotCompact(), 5 * sizeof(float));
+    ASSERT_EQ(mem.getRWBytes(), 3 * sizeof(float));
+    // e.g. the copy of the region for the parallel infer request, it must follow the region of the first request
+    mem.reserve_ptr(nullptr, pFuture3, 3 * sizeof(float));
+
+    mem.commit(isCompact);
+    ASSERT_EQ(mem.getRWBytes(), 6 * sizeof(float));
+    ASSERT_EQ(mem.getTotalBytes(), 6 * sizeof(float));
+    ASSERT_EQ(pFuture1, reinterpret_cast<float*>(mem.getBasePtr()));
+    ASSERT_EQ(pFuture2, reinterpret_cast<float*>(mem.getBasePtr()));
+    ASSERT_EQ(pFuture3, reinterpret_cast<float*>(mem.getBasePtr()) + 3);
+}
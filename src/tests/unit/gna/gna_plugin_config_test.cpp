@@ -21,6 +21,7 @@ const std::map<std::string, std::string>  supportedConfigKeysWithDefaults = {
     {GNA_CONFIG_KEY(COMPACT_MODE), CONFIG_VALUE(YES)},
     {CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(PRECISION), Precision(Precision::I16).name()},
+    {GNA_CONFIG_KEY(PRECISION_I16_LAYERS), ""},
     {GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT), "1.000000"},
     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
@@ -138,6 +139,14 @@ TEST_F(GNAPluginConfigTest, GnaConfigPrecisionTest) {
     ExpectThrow(GNA_CONFIG_KEY(PRECISION), "");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigPrecisionI16LayersTest) {
+    SetAndCompare(GNA_CONFIG_KEY(PRECISION_I16_LAYERS), "affine_1,affine_2");
+    EXPECT_EQ(config.i16PrecisionLayers, std::set<std::string>({"affine_1", "affine_2"}));
+    SetAndCompare(GNA_CONFIG_KEY(PRECISION_I16_LAYERS), "");
+    EXPECT_TRUE(config.i16PrecisionLayers.empty());
+    ExpectThrow(GNA_CONFIG_KEY(PRECISION_I16_LAYERS), "affine_1,,affine_2");
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigPwlUniformDesignTest) {
     SetAndCheckFlag(GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN),
                     config.gnaFlags.uniformPwlDesign);
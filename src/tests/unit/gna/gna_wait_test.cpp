@@ -32,6 +32,10 @@ class GNAPluginForGNAWaitTest : public GNAPlugin {
         gnaRequestConfigToRequestIdMap.push_back(std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>{ 0, 0, {} });
         InitGNADevice();
     }
+
+    bool IsRequestConfigFree() const {
+        return std::get<1>(gnaRequestConfigToRequestIdMap.front()) == -1;
+    }
 };
 
 class GNAInferRequestForGNAWaitTest : public GNAInferRequest {
@@ -64,3 +68,17 @@ TEST_F(GNAWaitTest, ReturnsGna2StatusWarningDeviceBusy) {
     GNAInferRequestForGNAWaitTest inferRequest{ plugin };
     ASSERT_EQ(InferenceEngine::RESULT_NOT_READY, inferRequest.Wait(0));
 }
+
+TEST_F(GNAWaitTest, ReleasesRequestConfigOnlyWhenRequestIsDone) {
+    GNACppApi enableMocks;
+    EXPECT_CALL(enableMocks, Gna2RequestWait(_, _)).
+        Times(2).
+        WillOnce(Return(Gna2StatusWarningDeviceBusy)).
+        WillOnce(Return(Gna2StatusDriverQoSTimeoutExceeded));
+    auto plugin = std::make_shared<GNAPluginForGNAWaitTest>();
+    GNAInferRequestForGNAWaitTest inferRequest{ plugin };
+    ASSERT_EQ(InferenceEngine::RESULT_NOT_READY, inferRequest.Wait(0));
+    ASSERT_FALSE(plugin->IsRequestConfigFree());
+    ASSERT_EQ(InferenceEngine::INFER_NOT_STARTED, inferRequest.Wait(0));
+    ASSERT_TRUE(plugin->IsRequestConfigFree());
+}
@@ -103,4 +103,24 @@ TEST_F(PwlTest, neghalflog) {
     EXPECT_FALSE(GetPwl(DnnActivation::fromType(kActNegHalfLog), 1e-10, LOG_DOMAIN, 0, pwl));
 }
 
+TEST_F(PwlTest, designOptGivesSameSegmentsForRepeatedActivations) {
+    auto activation = DnnActivation::fromType(kActSigmoid);
+    std::vector<gna_pwl_segment_t> segments;
+    std::vector<gna_pwl_segment_t> repeated;
+    PwlDesignOpt(activation, segments, 2048.0f, 2048.0f, 1.0f, false);
+    PwlDesignOpt(activation, repeated, 2048.0f, 2048.0f, 1.0f, false);
+    ASSERT_FALSE(segments.empty());
+    ASSERT_EQ(segments.size(), repeated.size());
+    for (size_t i = 0; i < segments.size(); i++) {
+        EXPECT_EQ(segments[i].xBase, repeated[i].xBase);
+        EXPECT_EQ(segments[i].yBase, repeated[i].yBase);
+        EXPECT_EQ(segments[i].slope, repeated[i].slope);
+    }
+
+    // the segments depend on the output scale factor, not only on the cached approximation
+    PwlDesignOpt(activation, repeated, 2048.0f, 4096.0f, 1.0f, false);
+    ASSERT_EQ(segments.size(), repeated.size());
+    EXPECT_NE(segments[segments.size() / 2].yBase, repeated[repeated.size() / 2].yBase);
+}
+
 } // namespace
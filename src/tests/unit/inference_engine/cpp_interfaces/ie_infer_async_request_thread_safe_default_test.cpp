@@ -13,6 +13,7 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 
 #include "unit_test_utils/mocks/cpp_interfaces/mock_task_executor.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/impl/mock_async_infer_request_default.hpp"
 
@@ -194,3 +195,74 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, canRecordInferRequestsStatistics) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto mockExeNetwork = std::make_shared<MockIExecutableNetworkInternal>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    testRequest->setPointerToExecutableNetworkInternal(mockExeNetwork);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(2)
+            .WillOnce(Return())
+            .WillOnce(Throw(GeneralError{""}));
+
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    auto statistics = mockExeNetwork->GetInferRequestsStatistics()->GetStatistics();
+    EXPECT_EQ(1, statistics["IN_FLIGHT"]);
+    EXPECT_EQ(0, statistics["INFERENCES"]);
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    taskExecutor->executeAll();
+    ASSERT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), GeneralError);
+
+    statistics = mockExeNetwork->GetInferRequestsStatistics()->GetStatistics();
+    EXPECT_EQ(0, statistics["IN_FLIGHT"]);
+    EXPECT_EQ(1, statistics["MAX_IN_FLIGHT"]);
+    EXPECT_EQ(2, statistics["INFERENCES"]);
+    EXPECT_LE(statistics["LATENCY_US_P50"], statistics["LATENCY_US_MAX"]);
+    EXPECT_LE(statistics["QUEUE_WAIT_US_MAX"], statistics["LATENCY_US_SUM"]);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canInferBlobSetsOneAfterAnotherWithOneCallback) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    std::vector<std::map<std::string, Blob::Ptr>> blobSets(3);
+    for (size_t i = 0; i < blobSets.size(); ++i) {
+        blobSets[i]["input"] = make_shared_blob<float>({Precision::FP32, {1}, Layout::C});
+    }
+    {
+        InSequence sequence;
+        for (auto&& blobs : blobSets) {
+            EXPECT_CALL(*mockInferRequestInternal, SetBlob("input", blobs["input"])).Times(1);
+            EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1);
+        }
+    }
+    size_t callbacks = 0;
+    testRequest->SetCallback([&](std::exception_ptr exceptionPtr) {
+        ASSERT_EQ(nullptr, exceptionPtr);
+        ++callbacks;
+    });
+    ASSERT_NO_THROW(testRequest->StartAsyncSets(blobSets));
+    ASSERT_THROW(testRequest->StartAsync(), RequestBusy);
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(1, callbacks);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, stopsInferBlobSetsAtFirstFailure) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    std::vector<std::map<std::string, Blob::Ptr>> blobSets(3);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(2)
+            .WillOnce(Return())
+            .WillOnce(Throw(GeneralError{""}));
+    ASSERT_NO_THROW(testRequest->StartAsyncSets(blobSets));
+    taskExecutor->executeAll();
+    ASSERT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), GeneralError);
+
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1);
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
@@ -403,6 +403,37 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentWeights) {
+    auto createNetworkWithWeights = [](const std::vector<float>& weights) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{weights.size()});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{weights.size()}, weights);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto duplicate = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{weights.size()}, weights);
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(add, duplicate);
+        auto res = std::make_shared<ngraph::opset6::Result>(mul);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    std::vector<float> weights(1027);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = static_cast<float>(i);
+    }
+    auto net1 = createNetworkWithWeights(weights);
+    auto net2 = createNetworkWithWeights(weights);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+
+    // the last values are not the whole lanes of the hash
+    weights.back() = -1.f;
+    auto net3 = createNetworkWithWeights(weights);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+
+    weights[weights.size() / 2] = -1.f;
+    auto net4 = createNetworkWithWeights(weights);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net3, {}),
+              NetworkCompilationContext::computeHash(net4, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -36,3 +36,17 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, returnTheSameSharedCPUStreamsExecutorForTheSameConfig) {
+    ExecutorManagerImpl _manager;
+    IStreamsExecutor::Config config{"CallbackExecutor", 2, 1};
+    auto executor1 = _manager.getSharedCPUStreamsExecutor(config);
+    auto executor2 = _manager.getSharedCPUStreamsExecutor(config);
+    config._streams = 1;
+    auto executor3 = _manager.getSharedCPUStreamsExecutor(config);
+
+    ASSERT_EQ(executor1, executor2);
+    ASSERT_NE(executor1, executor3);
+    _manager.clear("CallbackExecutor");
+    ASSERT_NE(executor1, _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"CallbackExecutor", 2, 1}));
+}
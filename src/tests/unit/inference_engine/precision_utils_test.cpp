@@ -6,7 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <limits>
+#include <vector>
 
 using namespace InferenceEngine;
 
@@ -46,3 +48,32 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+TEST_F(PrecisionUtilsTests, FP16ToFP32ArraysAsElements) {
+    // all the FP16 values, the arrays of a few blocks are converted in parallel and the tail is not vectored
+    std::vector<ie_fp16> src(3 * 65536 + 5);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<ie_fp16>(i);
+    std::vector<float> dst(src.size());
+    InferenceEngine::PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), 2.f, 1.f);
+    for (size_t i = 0; i < src.size(); i++) {
+        const float expected = InferenceEngine::PrecisionUtils::f16tof32(src[i]) * 2.f + 1.f;
+        if (std::isnan(expected))
+            ASSERT_TRUE(std::isnan(dst[i])) << "element " << i;
+        else
+            ASSERT_EQ(expected, dst[i]) << "element " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToFP16ArraysAsElements) {
+    std::vector<float> src = {0.f, -0.f, 1e-8f, 3e-5f, 6e-5f, 0.5f, 1.f, -1.f, 65504.f, 65519.f, 65520.f, 1e10f, -1e10f,
+                              std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                              std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::min(),
+                              std::numeric_limits<float>::denorm_min()};
+    for (size_t i = 0; src.size() < 2 * 65536 + 3; i++)
+        src.push_back(static_cast<float>(i) * 0.37f - 12000.f);
+    std::vector<ie_fp16> dst(src.size());
+    InferenceEngine::PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++)
+        ASSERT_EQ(InferenceEngine::PrecisionUtils::f32tof16(src[i]), dst[i]) << "element " << i << ": " << src[i];
+}
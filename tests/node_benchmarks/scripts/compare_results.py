@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2018-2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+This script compares two JSON files written by node_benchmarks and reports
+the benchmarks which became slower than the given threshold or changed
+the implementation of the measured node.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+    """Loads node_benchmarks results as a dictionary indexed by benchmark name"""
+    with open(path) as results_file:
+        return {benchmark["name"]: benchmark for benchmark in json.load(results_file)["benchmarks"]}
+
+
+def compare(reference, current, threshold, metric):
+    """Returns the list of regressions: (name, reference time, current time, reference exec type, exec type)"""
+    regressions = []
+    for name, result in sorted(current.items()):
+        ref = reference.get(name)
+        if ref is None or ref[metric] <= 0:
+            continue
+        slower = result[metric] / ref[metric] - 1 > threshold
+        if slower or result["exec_type"] != ref["exec_type"]:
+            regressions.append((name, ref[metric], result[metric], ref["exec_type"], result["exec_type"]))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("reference", help="results of the reference build")
+    parser.add_argument("current", help="results of the checked build")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="allowed relative slowdown, 0.1 by default")
+    parser.add_argument("--metric", default="median_time",
+                        choices=["median_time", "mean_time", "min_time", "nodes_time"],
+                        help="compared time, median_time by default")
+    args = parser.parse_args()
+
+    regressions = compare(load_results(args.reference), load_results(args.current), args.threshold, args.metric)
+    for name, ref_time, time, ref_exec_type, exec_type in regressions:
+        print("{}: {:.1f} us -> {:.1f} us ({:+.1%}), {} -> {}".format(
+            name, ref_time, time, time / ref_time - 1, ref_exec_type, exec_type))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gflags/gflags.h>
+#include <iostream>
+#include <string>
+
+/// @brief message for help argument
+static const char help_message[] =
+    "Print a usage message.";
+
+/// @brief message for target device argument
+static const char target_device_message[] =
+    "Optional. Specify a target device to infer on. Default value is CPU.";
+
+/// @brief message for output argument
+static const char output_message[] =
+    "Optional. Path to a JSON file to write the results. Default value is node_benchmarks.json.";
+
+/// @brief message for filter argument
+static const char filter_message[] =
+    "Optional. Regular expression, only the benchmarks with matching names are run.";
+
+/// @brief message for precisions argument
+static const char precisions_message[] =
+    "Optional. Comma-separated list of inference precisions to sweep (f32, bf16). Default value is f32,bf16. \n"
+    "bf16 benchmarks are skipped on devices without native BF16 support.";
+
+/// @brief message for minimal time argument
+static const char min_time_message[] =
+    "Optional. Minimal time in seconds to run every benchmark. Default value is 0.5.";
+
+/// @brief message for minimal iterations argument
+static const char niter_message[] =
+    "Optional. Minimal number of iterations to run every benchmark. Default value is 10.";
+
+/// @brief message for threads argument
+static const char nthreads_message[] =
+    "Optional. Number of threads to use for inference. Default value is 0 (the device default).";
+
+/// @brief message for list argument
+static const char list_message[] =
+    "Optional. Only print the names of the benchmarks.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief Define parameter for set target device to infer on <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Define parameter for set path to a file to write results <br>
+DEFINE_string(o, "node_benchmarks.json", output_message);
+
+/// @brief Define parameter for set benchmarks filter <br>
+DEFINE_string(filter, "", filter_message);
+
+/// @brief Define parameter for set swept precisions <br>
+DEFINE_string(p, "f32,bf16", precisions_message);
+
+/// @brief Define parameter for set minimal time of the benchmark <br>
+DEFINE_double(min_time, 0.5, min_time_message);
+
+/// @brief Define parameter for set minimal number of iterations <br>
+DEFINE_uint32(niter, 10, niter_message);
+
+/// @brief Define parameter for set number of threads <br>
+DEFINE_uint32(nthreads, 0, nthreads_message);
+
+/// @brief Define flag for listing benchmarks <br>
+DEFINE_bool(list, false, list_message);
+
+/**
+ * @brief This function show a help message
+ */
+static void showUsage() {
+  std::cout << std::endl;
+  std::cout << "node_benchmarks [OPTION]" << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << std::endl;
+  std::cout << "    -h, --help                " << help_message << std::endl;
+  std::cout << "    -d \"<device>\"             " << target_device_message << std::endl;
+  std::cout << "    -o \"<path>\"               " << output_message << std::endl;
+  std::cout << "    -filter \"<regex>\"         " << filter_message << std::endl;
+  std::cout << "    -p \"<precisions>\"         " << precisions_message << std::endl;
+  std::cout << "    -min_time \"<seconds>\"     " << min_time_message << std::endl;
+  std::cout << "    -niter \"<integer>\"        " << niter_message << std::endl;
+  std::cout << "    -nthreads \"<integer>\"     " << nthreads_message << std::endl;
+  std::cout << "    -list                     " << list_message << std::endl;
+}
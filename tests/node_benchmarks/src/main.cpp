@@ -0,0 +1,176 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cli.h"
+#include "node_benchmarks.h"
+#include "results_writer.h"
+
+#include <ie_plugin_config.hpp>
+#include <openvino/runtime/core.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <sstream>
+
+namespace {
+
+/**
+ * @brief Parses command line and check arguments
+ */
+bool parseAndCheckCommandLine(int argc, char **argv) {
+  gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+  if (FLAGS_help || FLAGS_h) {
+    showUsage();
+    return false;
+  }
+
+  if (FLAGS_min_time < 0)
+    throw std::logic_error("Minimal time can't be negative. Please check -min_time option.");
+
+  return true;
+}
+
+std::vector<std::string> split(const std::string &s, char delim) {
+  std::vector<std::string> result;
+  std::stringstream ss(s);
+  for (std::string item; std::getline(ss, item, delim);) {
+    if (!item.empty())
+      result.push_back(item);
+  }
+  return result;
+}
+
+void fillTensor(ov::runtime::Tensor &tensor) {
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(0.f, 1.f);
+  if (tensor.get_element_type() == ov::element::f32) {
+    auto data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i)
+      data[i] = dist(gen);
+  } else {
+    auto data = static_cast<uint8_t *>(tensor.data());
+    std::fill(data, data + tensor.get_byte_size(), 0);
+  }
+}
+
+BenchmarkResult runBenchmark(ov::runtime::Core &core, const BenchmarkCase &benchmark) {
+  ov::runtime::ConfigMap config = {{CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES)}};
+  if (FLAGS_d == "CPU") {
+    config[CONFIG_KEY(ENFORCE_BF16)] = benchmark.precision == "bf16" ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
+    if (FLAGS_nthreads != 0)
+      config[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(FLAGS_nthreads);
+  }
+
+  auto compiledModel = core.compile_model(benchmark.create_model(), FLAGS_d, config);
+  auto request = compiledModel.create_infer_request();
+  for (const auto &input : compiledModel.inputs()) {
+    auto tensor = request.get_tensor(input);
+    fillTensor(tensor);
+  }
+
+  // warm up: the first inference includes the lazy initialization of the primitives
+  request.infer();
+
+  BenchmarkResult result;
+  result.benchmark = &benchmark;
+
+  std::vector<double> latencies;
+  double nodeTime = 0, reorderTime = 0;
+  const auto start = std::chrono::steady_clock::now();
+  while (latencies.size() < FLAGS_niter ||
+         std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < FLAGS_min_time) {
+    const auto iterStart = std::chrono::steady_clock::now();
+    request.infer();
+    const auto iterEnd = std::chrono::steady_clock::now();
+    latencies.push_back(std::chrono::duration<double, std::micro>(iterEnd - iterStart).count());
+
+    for (const auto &info : request.get_profiling_info()) {
+      if (info.status != ov::runtime::ProfilingInfo::Status::EXECUTED)
+        continue;
+      if (info.node_type == "Reorder") {
+        reorderTime += info.real_time.count();
+      } else if (info.node_type != "Input" && info.node_type != "Output") {
+        nodeTime += info.real_time.count();
+      }
+      if (info.node_name == target_name)
+        result.execType = info.exec_type;
+    }
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  result.iterations = latencies.size();
+  result.medianUs = latencies[latencies.size() / 2];
+  result.minUs = latencies.front();
+  result.meanUs = 0;
+  for (const auto &latency : latencies)
+    result.meanUs += latency;
+  result.meanUs /= latencies.size();
+  result.nodesUs = nodeTime / latencies.size();
+  result.reordersUs = reorderTime / latencies.size();
+  return result;
+}
+
+bool hasNativeBF16(ov::runtime::Core &core, const std::string &device) {
+  try {
+    const auto capabilities = core.get_metric(device, METRIC_KEY(OPTIMIZATION_CAPABILITIES))
+                                  .as<std::vector<std::string>>();
+    return std::find(capabilities.begin(), capabilities.end(), METRIC_VALUE(BF16)) != capabilities.end();
+  } catch (...) {
+    return false;
+  }
+}
+
+} // namespace
+
+/**
+ * @brief Main entry point
+ */
+int main(int argc, char **argv) {
+  try {
+    if (!parseAndCheckCommandLine(argc, argv))
+      return 0;
+
+    ov::runtime::Core core;
+    auto precisions = split(FLAGS_p, ',');
+    if (std::find(precisions.begin(), precisions.end(), "bf16") != precisions.end() && !hasNativeBF16(core, FLAGS_d)) {
+      std::cerr << "[ WARNING ] " << FLAGS_d << " has no native BF16 support, bf16 benchmarks are skipped" << std::endl;
+      precisions.erase(std::remove(precisions.begin(), precisions.end(), "bf16"), precisions.end());
+    }
+
+    const std::regex filter(FLAGS_filter);
+    std::vector<BenchmarkCase> cases;
+    for (auto &benchmark : getBenchmarkCases(precisions)) {
+      if (std::regex_search(benchmark.name, filter))
+        cases.push_back(std::move(benchmark));
+    }
+
+    if (FLAGS_list) {
+      for (const auto &benchmark : cases)
+        std::cout << benchmark.name << std::endl;
+      return 0;
+    }
+
+    ResultsWriter writer(FLAGS_o, FLAGS_d);
+    int status = 0;
+    for (const auto &benchmark : cases) {
+      try {
+        const auto result = runBenchmark(core, benchmark);
+        std::cout << benchmark.name << ": " << result.medianUs << " us (" << result.iterations << " iterations, "
+                  << result.execType << ")" << std::endl;
+        writer.add(result);
+      } catch (const std::exception &ex) {
+        std::cerr << "[ ERROR ] " << benchmark.name << " failed: " << ex.what() << std::endl;
+        status = 1;
+      }
+    }
+    writer.write();
+    return status;
+  } catch (const std::exception &ex) {
+    std::cerr << "[ ERROR ] " << ex.what() << std::endl;
+    return 1;
+  }
+}
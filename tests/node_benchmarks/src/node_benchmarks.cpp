@@ -0,0 +1,315 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_benchmarks.h"
+
+#include <openvino/opsets/opset8.hpp>
+
+#include <random>
+#include <sstream>
+
+using namespace ov;
+
+namespace {
+
+std::string toString(const Shape &shape) {
+  std::stringstream ss;
+  for (size_t i = 0; i < shape.size(); ++i)
+    ss << (i ? "x" : "") << shape[i];
+  return ss.str();
+}
+
+std::shared_ptr<opset8::Constant> makeRandomConstant(const Shape &shape) {
+  std::vector<float> values(shape_size(shape));
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  for (auto &value : values)
+    value = dist(gen);
+  return opset8::Constant::create(element::f32, shape, values);
+}
+
+/**
+ * @brief Creates a 4D NCHW input; in NHWC layout the parameter is NHWC and is
+ * transposed to NCHW as in the models converted from TensorFlow
+ */
+Output<Node> makeInput4D(const Shape &nchw, const std::string &layout, ParameterVector &params) {
+  if (layout != "nhwc") {
+    params.push_back(std::make_shared<opset8::Parameter>(element::f32, nchw));
+    return params.back();
+  }
+  params.push_back(std::make_shared<opset8::Parameter>(element::f32, Shape{nchw[0], nchw[2], nchw[3], nchw[1]}));
+  auto order = opset8::Constant::create(element::i64, Shape{4}, {0, 3, 1, 2});
+  return std::make_shared<opset8::Transpose>(params.back(), order);
+}
+
+/**
+ * @brief Transposes a 4D NCHW output back to NHWC in NHWC layout
+ */
+std::shared_ptr<Model> makeModel4D(const Output<Node> &output, const std::string &layout, const ParameterVector &params) {
+  Output<Node> result = output;
+  if (layout == "nhwc") {
+    auto order = opset8::Constant::create(element::i64, Shape{4}, {0, 2, 3, 1});
+    result = std::make_shared<opset8::Transpose>(output, order);
+  }
+  return std::make_shared<Model>(OutputVector{result}, params, "node_benchmark");
+}
+
+std::shared_ptr<Node> named(const std::shared_ptr<Node> &node) {
+  node->set_friendly_name(target_name);
+  return node;
+}
+
+struct ConvolutionParams {
+  Shape input;  // NCHW
+  size_t outChannels;
+  size_t kernel;
+  size_t stride;
+};
+
+struct MatMulParams {
+  Shape a;
+  Shape b;
+  bool constB;  // constant B is executed as FullyConnected by the CPU plugin
+};
+
+struct GatherParams {
+  Shape data;
+  size_t indices;
+  int64_t axis;
+};
+
+struct ReduceParams {
+  Shape input;  // NCHW for 4D inputs
+  std::vector<int64_t> axes;
+};
+
+struct InterpolateParams {
+  Shape input;  // NCHW
+  float scale;
+  op::v4::Interpolate::InterpolateMode mode;
+};
+
+struct NMSParams {
+  size_t boxes;
+  size_t classes;
+};
+
+void addConvolutions(std::vector<BenchmarkCase> &cases, const std::string &precision) {
+  const std::vector<ConvolutionParams> sweep = {
+      {{1, 64, 56, 56}, 64, 3, 1},
+      {{1, 64, 56, 56}, 256, 1, 1},
+      {{1, 256, 56, 56}, 128, 3, 2},
+      {{1, 512, 14, 14}, 512, 3, 1},
+      {{8, 32, 112, 112}, 64, 3, 2},
+  };
+  for (const auto &layout : {"nchw", "nhwc"}) {
+    for (const auto &p : sweep) {
+      std::stringstream shape;
+      shape << toString(p.input) << "_oc" << p.outChannels << "_k" << p.kernel << "_s" << p.stride;
+      const std::string layoutName = layout;
+      cases.push_back({"Convolution/" + precision + "/" + layoutName + "/" + shape.str(), "Convolution",
+                       precision, layoutName, shape.str(), [p, layoutName]() {
+        ParameterVector params;
+        auto input = makeInput4D(p.input, layoutName, params);
+        auto weights = makeRandomConstant({p.outChannels, p.input[1], p.kernel, p.kernel});
+        const auto pad = static_cast<std::ptrdiff_t>(p.kernel / 2);
+        auto conv = named(std::make_shared<opset8::Convolution>(input, weights, Strides{p.stride, p.stride},
+                                                                 CoordinateDiff{pad, pad}, CoordinateDiff{pad, pad},
+                                                                 Strides{1, 1}));
+        return makeModel4D(conv, layoutName, params);
+      }});
+    }
+  }
+}
+
+void addMatMuls(std::vector<BenchmarkCase> &cases, const std::string &precision) {
+  const std::vector<MatMulParams> sweep = {
+      {{1, 384, 768}, {768, 768}, true},
+      {{1, 128, 1024}, {1024, 4096}, true},
+      {{64, 2048}, {2048, 1000}, true},
+      {{12, 384, 64}, {12, 64, 384}, false},
+      {{16, 128, 128}, {16, 128, 64}, false},
+  };
+  for (const auto &p : sweep) {
+    const auto shape = toString(p.a) + "_" + toString(p.b) + (p.constB ? "_const" : "");
+    cases.push_back({"MatMul/" + precision + "/any/" + shape, "MatMul", precision, "any", shape, [p]() {
+      ParameterVector params{std::make_shared<opset8::Parameter>(element::f32, p.a)};
+      Output<Node> b;
+      if (p.constB) {
+        b = makeRandomConstant(p.b);
+      } else {
+        params.push_back(std::make_shared<opset8::Parameter>(element::f32, p.b));
+        b = params.back();
+      }
+      auto matmul = named(std::make_shared<opset8::MatMul>(params[0], b));
+      return std::make_shared<Model>(OutputVector{matmul}, params, "node_benchmark");
+    }});
+  }
+}
+
+void addEltwiseChains(std::vector<BenchmarkCase> &cases, const std::string &precision) {
+  const std::vector<Shape> sweep = {
+      {1, 3, 224, 224},
+      {1, 64, 112, 112},
+      {1, 256, 56, 56},
+      {1, 1024, 14, 14},
+      {1, 384, 768},
+  };
+  for (const auto &p : sweep) {
+    const auto shape = toString(p);
+    cases.push_back({"EltwiseChain/" + precision + "/any/" + shape, "Eltwise", precision, "any", shape, [p]() {
+      ParameterVector params{std::make_shared<opset8::Parameter>(element::f32, p),
+                             std::make_shared<opset8::Parameter>(element::f32, p)};
+      // per-channel constants, as the ones of the fused scale shifts
+      Shape channelShape(p.size(), 1);
+      channelShape[1] = p[1];
+      auto add = named(std::make_shared<opset8::Add>(params[0], params[1]));
+      auto mul = std::make_shared<opset8::Multiply>(add, makeRandomConstant(channelShape));
+      auto sub = std::make_shared<opset8::Subtract>(mul, makeRandomConstant(channelShape));
+      auto relu = std::make_shared<opset8::Relu>(sub);
+      auto sigmoid = std::make_shared<opset8::Sigmoid>(relu);
+      return std::make_shared<Model>(OutputVector{sigmoid}, params, "node_benchmark");
+    }});
+  }
+}
+
+void addGathers(std::vector<BenchmarkCase> &cases, const std::string &precision) {
+  const std::vector<GatherParams> sweep = {
+      {{30522, 768}, 128, 0},
+      {{30522, 768}, 4096, 0},
+      {{1, 256, 56, 56}, 64, 1},
+      {{8, 1024, 64}, 512, 1},
+  };
+  for (const auto &p : sweep) {
+    std::stringstream shape;
+    shape << toString(p.data) << "_idx" << p.indices << "_axis" << p.axis;
+    cases.push_back({"Gather/" + precision + "/any/" + shape.str(), "Gather", precision, "any", shape.str(), [p]() {
+      ParameterVector params{std::make_shared<opset8::Parameter>(element::f32, p.data)};
+      std::vector<int32_t> indices(p.indices);
+      std::mt19937 gen(0);
+      std::uniform_int_distribution<int32_t> dist(0, static_cast<int32_t>(p.data[p.axis]) - 1);
+      for (auto &index : indices)
+        index = dist(gen);
+      auto indicesConst = opset8::Constant::create(element::i32, Shape{p.indices}, indices);
+      auto axis = opset8::Constant::create(element::i64, Shape{}, {p.axis});
+      auto gather = named(std::make_shared<opset8::Gather>(params[0], indicesConst, axis));
+      return std::make_shared<Model>(OutputVector{gather}, params, "node_benchmark");
+    }});
+  }
+}
+
+void addReduces(std::vector<BenchmarkCase> &cases, const std::string &precision) {
+  const std::vector<ReduceParams> sweep = {
+      {{1, 64, 56, 56}, {2, 3}},
+      {{1, 2048, 7, 7}, {2, 3}},
+      {{1, 256, 56, 56}, {1}},
+  };
+  for (const auto &layout : {"nchw", "nhwc"}) {
+    for (const auto &p : sweep) {
+      std::stringstream shape;
+      shape << toString(p.input) << "_axes";
+      for (const auto &axis : p.axes)
+        shape << axis;
+      const std::string layoutName = layout;
+      cases.push_back({"Reduce/" + precision + "/" + layoutName + "/" + shape.str(), "Reduce", precision, layoutName,
+                       shape.str(), [p, layoutName]() {
+        ParameterVector params;
+        auto input = makeInput4D(p.input, layoutName, params);
+        auto axes = opset8::Constant::create(element::i64, Shape{p.axes.size()}, p.axes);
+        auto reduce = named(std::make_shared<opset8::ReduceMean>(input, axes, true));
+        return makeModel4D(reduce, layoutName, params);
+      }});
+    }
+  }
+  // 3D reductions over the last axis, as in the normalizations of transformers
+  const std::vector<ReduceParams> sweep3D = {
+      {{1, 384, 768}, {2}},
+      {{8, 128, 1024}, {2}},
+  };
+  for (const auto &p : sweep3D) {
+    const auto shape = toString(p.input) + "_axes2";
+    cases.push_back({"Reduce/" + precision + "/any/" + shape, "Reduce", precision, "any", shape, [p]() {
+      ParameterVector params{std::make_shared<opset8::Parameter>(element::f32, p.input)};
+      auto axes = opset8::Constant::create(element::i64, Shape{p.axes.size()}, p.axes);
+      auto reduce = named(std::make_shared<opset8::ReduceSum>(params[0], axes, true));
+      return std::make_shared<Model>(OutputVector{reduce}, params, "node_benchmark");
+    }});
+  }
+}
+
+void addInterpolates(std::vector<BenchmarkCase> &cases, const std::string &precision) {
+  using InterpolateMode = op::v4::Interpolate::InterpolateMode;
+  const std::vector<InterpolateParams> sweep = {
+      {{1, 64, 56, 56}, 2.f, InterpolateMode::NEAREST},
+      {{1, 64, 56, 56}, 2.f, InterpolateMode::LINEAR_ONNX},
+      {{1, 256, 28, 28}, 2.f, InterpolateMode::LINEAR},
+      {{1, 3, 224, 224}, 0.5f, InterpolateMode::CUBIC},
+  };
+  for (const auto &layout : {"nchw", "nhwc"}) {
+    for (const auto &p : sweep) {
+      std::stringstream shape;
+      shape << toString(p.input) << "_scale" << p.scale << "_" << p.mode;
+      const std::string layoutName = layout;
+      cases.push_back({"Interpolate/" + precision + "/" + layoutName + "/" + shape.str(), "Interpolate", precision,
+                       layoutName, shape.str(), [p, layoutName]() {
+        ParameterVector params;
+        auto input = makeInput4D(p.input, layoutName, params);
+        const std::vector<int64_t> sizes = {static_cast<int64_t>(p.input[2] * p.scale),
+                                            static_cast<int64_t>(p.input[3] * p.scale)};
+        op::v4::Interpolate::InterpolateAttrs attrs;
+        attrs.mode = p.mode;
+        attrs.shape_calculation_mode = op::v4::Interpolate::ShapeCalcMode::SIZES;
+        attrs.pads_begin = {0, 0, 0, 0};
+        attrs.pads_end = {0, 0, 0, 0};
+        auto interpolate = named(std::make_shared<opset8::Interpolate>(
+            input, opset8::Constant::create(element::i64, Shape{2}, sizes),
+            opset8::Constant::create(element::f32, Shape{2}, {p.scale, p.scale}),
+            opset8::Constant::create(element::i64, Shape{2}, {2, 3}), attrs));
+        return makeModel4D(interpolate, layoutName, params);
+      }});
+    }
+  }
+}
+
+void addNMS(std::vector<BenchmarkCase> &cases, const std::string &precision) {
+  const std::vector<NMSParams> sweep = {
+      {1000, 1},
+      {5000, 1},
+      {1000, 80},
+  };
+  for (const auto &p : sweep) {
+    std::stringstream shape;
+    shape << "boxes" << p.boxes << "_classes" << p.classes;
+    cases.push_back({"NMS/" + precision + "/any/" + shape.str(), "NonMaxSuppression", precision, "any", shape.str(),
+                     [p]() {
+      ParameterVector params{std::make_shared<opset8::Parameter>(element::f32, Shape{1, p.boxes, 4}),
+                             std::make_shared<opset8::Parameter>(element::f32, Shape{1, p.classes, p.boxes})};
+      auto nms = named(std::make_shared<opset8::NonMaxSuppression>(
+          params[0], params[1],
+          opset8::Constant::create(element::i64, Shape{}, {100}),
+          opset8::Constant::create(element::f32, Shape{}, {0.5f}),
+          opset8::Constant::create(element::f32, Shape{}, {0.05f}),
+          opset8::Constant::create(element::f32, Shape{}, {0.f})));
+      return std::make_shared<Model>(nms->outputs(), params, "node_benchmark");
+    }});
+  }
+}
+
+} // namespace
+
+std::vector<BenchmarkCase> getBenchmarkCases(const std::vector<std::string> &precisions) {
+  std::vector<BenchmarkCase> cases;
+  for (const auto &precision : precisions) {
+    addConvolutions(cases, precision);
+    addMatMuls(cases, precision);
+    addEltwiseChains(cases, precision);
+    addGathers(cases, precision);
+    addReduces(cases, precision);
+    addInterpolates(cases, precision);
+    // NMS has no reduced precision implementation
+    if (precision == "f32")
+      addNMS(cases, precision);
+  }
+  return cases;
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/model.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Single-operation model measured by the benchmark runner
+ *
+ * The measured operation is named `target_name` in the model, so the runner can
+ * find its execution type among the profiling information of the device.
+ */
+struct BenchmarkCase {
+  std::string name;       // unique name: <family>/<precision>/<layout>/<shape>
+  std::string family;     // Convolution, MatMul, EltwiseChain, Gather, Reduce, Interpolate, NMS
+  std::string precision;  // inference precision: f32 or bf16
+  std::string layout;     // nchw, nhwc or "any" for layout-agnostic operations
+  std::string shape;      // human readable description of the shapes
+  std::function<std::shared_ptr<ov::Model>()> create_model;
+};
+
+/// @brief Name of the measured operation in every benchmark model
+static const char target_name[] = "benchmark_target";
+
+/**
+ * @brief Returns all benchmark cases swept over the given inference precisions
+ */
+std::vector<BenchmarkCase> getBenchmarkCases(const std::vector<std::string> &precisions);
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node_benchmarks.h"
+
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Measurements of a single benchmark, the times are in microseconds per inference
+ */
+struct BenchmarkResult {
+  const BenchmarkCase *benchmark = nullptr;
+  size_t iterations = 0;
+  double medianUs = 0;
+  double meanUs = 0;
+  double minUs = 0;
+  double nodesUs = 0;     // execution time of all nodes except reorders and inputs/outputs
+  double reordersUs = 0;  // execution time of the layout conversions inserted by the plugin
+  std::string execType;   // implementation of the measured node, e.g. jit_avx512_FP32
+};
+
+/**
+ * @brief Class response for writing the benchmark results
+ *
+ * The results are written in JSON format, one object per benchmark, so they
+ * can be compared between builds by scripts/compare_results.py.
+ */
+class ResultsWriter {
+private:
+  std::string path;
+  std::string device;
+  std::vector<BenchmarkResult> results;
+
+  static std::string escape(const std::string &s) {
+    std::string escaped;
+    for (const auto c : s) {
+      if (c == '"' || c == '\\')
+        escaped += '\\';
+      escaped += c;
+    }
+    return escaped;
+  }
+
+public:
+  ResultsWriter(const std::string &path, const std::string &device) : path(path), device(device) {}
+
+  void add(const BenchmarkResult &result) {
+    results.push_back(result);
+  }
+
+  /**
+   * @brief Writes the collected results in JSON format.
+   */
+  void write() const {
+    std::ofstream file(path);
+    if (!file.good()) {
+      std::stringstream err;
+      err << "Results file \"" << path << "\" can't be used for writing";
+      throw std::runtime_error(err.str());
+    }
+
+    char date[32];
+    const auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    file << "{\n"
+         << "  \"context\": {\n"
+         << "    \"device\": \"" << escape(device) << "\",\n"
+         << "    \"date\": \"" << date << "\",\n"
+         << "    \"time_unit\": \"us\"\n"
+         << "  },\n"
+         << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+      const auto &result = results[i];
+      const auto &benchmark = *result.benchmark;
+      file << (i ? "," : "") << "\n"
+           << "    {\n"
+           << "      \"name\": \"" << escape(benchmark.name) << "\",\n"
+           << "      \"family\": \"" << benchmark.family << "\",\n"
+           << "      \"precision\": \"" << benchmark.precision << "\",\n"
+           << "      \"layout\": \"" << benchmark.layout << "\",\n"
+           << "      \"shape\": \"" << escape(benchmark.shape) << "\",\n"
+           << "      \"exec_type\": \"" << escape(result.execType) << "\",\n"
+           << "      \"iterations\": " << result.iterations << ",\n"
+           << "      \"median_time\": " << result.medianUs << ",\n"
+           << "      \"mean_time\": " << result.meanUs << ",\n"
+           << "      \"min_time\": " << result.minUs << ",\n"
+           << "      \"nodes_time\": " << result.nodesUs << ",\n"
+           << "      \"reorders_time\": " << result.reordersUs << "\n"
+           << "    }";
+    }
+    file << "\n  ]\n}\n";
+  }
+};
@@ -7,6 +7,8 @@
 #include <fstream>
 #include <algorithm>
 #include <chrono>
+#include <future>
+#include <sstream>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -38,6 +40,11 @@ static constexpr char targetDeviceMessage[] =
 static constexpr char output_message[] =
                                              "Optional. Path to the output file. Default value: \"<model_xml_file>.blob\".";
 
+static constexpr char targets_message[] =
+                                             "Optional. Path to a file with the targets to compile the model for, instead of -d, -c and -o.\n"
+"                                             A target per line: \"d=<device> c=<config file> o=<output file>\", c is optional.\n"
+"                                             The model is read and preprocessed once, the targets are compiled in parallel.";
+
 static constexpr char log_level_message[] =
                                              "Optional. Log level for InferenceEngine library.";
 
@@ -104,6 +111,7 @@ DEFINE_bool(h, false, help_message);
 DEFINE_string(m, "", model_message);
 DEFINE_string(d, "", targetDeviceMessage);
 DEFINE_string(o, "", output_message);
+DEFINE_string(targets, "", targets_message);
 DEFINE_string(log_level, "", log_level_message);
 DEFINE_string(c, "", config_message);
 DEFINE_string(ip, "", inputs_precision_message);
@@ -128,6 +136,7 @@ static void showUsage() {
     std::cout << "    -m                           <value>     "   << model_message                << std::endl;
     std::cout << "    -d                           <value>     "   << targetDeviceMessage          << std::endl;
     std::cout << "    -o                           <value>     "   << output_message               << std::endl;
+    std::cout << "    -targets                     <value>     "   << targets_message              << std::endl;
     std::cout << "    -c                           <value>     "   << config_message               << std::endl;
     std::cout << "    -ip                          <value>     "   << inputs_precision_message     << std::endl;
     std::cout << "    -op                          <value>     "   << outputs_precision_message    << std::endl;
@@ -159,10 +168,14 @@ static bool parseCommandLine(int* argc, char*** argv) {
         throw std::invalid_argument("Path to model xml file is required");
     }
 
-    if (FLAGS_d.empty()) {
+    if (FLAGS_d.empty() && FLAGS_targets.empty()) {
         throw std::invalid_argument("Target device name is required");
     }
 
+    if (!FLAGS_targets.empty() && !(FLAGS_d.empty() && FLAGS_c.empty() && FLAGS_o.empty())) {
+        throw std::invalid_argument("-targets replaces -d, -c and -o, they can't be set together");
+    }
+
     if (1 < *argc) {
         std::stringstream message;
         message << "Unknown arguments: ";
@@ -178,10 +191,59 @@ static bool parseCommandLine(int* argc, char*** argv) {
     return true;
 }
 
-static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
+struct Target {
+    std::string device;
+    std::string configFile;
+    std::string output;
+};
+
+static std::vector<Target> parseTargetsFile(const std::string& path, char comment = '#') {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Targets file " + path + " can't be opened");
+    }
+
+    std::vector<Target> targets;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == comment) {
+            continue;
+        }
+        std::istringstream tokens(line);
+        std::string token;
+        Target target;
+        while (tokens >> token) {
+            const auto pos = token.find('=');
+            const auto key = token.substr(0, pos);
+            const auto value = pos == std::string::npos ? std::string() : token.substr(pos + 1);
+            if (key == "d") {
+                target.device = value;
+            } else if (key == "c") {
+                target.configFile = value;
+            } else if (key == "o") {
+                target.output = value;
+            } else {
+                throw std::invalid_argument("Unknown option \"" + token + "\" of the targets file, d=, c= or o= is expected");
+            }
+        }
+        if (target.device.empty() && target.output.empty()) {
+            continue;
+        }
+        if (target.device.empty() || target.output.empty()) {
+            throw std::invalid_argument("Both the device and the output file are required for the target \"" + line + "\"");
+        }
+        targets.push_back(target);
+    }
+    if (targets.empty()) {
+        throw std::invalid_argument("Targets file " + path + " has no targets");
+    }
+    return targets;
+}
+
+static std::map<std::string, std::string> parseConfigFile(const std::string& configFile, char comment = '#') {
     std::map<std::string, std::string> config;
 
-    std::ifstream file(FLAGS_c);
+    std::ifstream file(configFile);
     if (file.is_open()) {
         std::string option;
         while (std::getline(file, option)) {
@@ -200,10 +262,10 @@ static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
     return config;
 }
 
-static std::map<std::string, std::string> configure() {
-    const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
+static std::map<std::string, std::string> configure(const Target& target) {
+    const bool isMYRIAD = target.device.find("MYRIAD") != std::string::npos;
 
-    auto config = parseConfigFile();
+    auto config = parseConfigFile(target.configFile);
 
     if (isMYRIAD) {
         if (!FLAGS_VPU_NUMBER_OF_SHAVES.empty()) {
@@ -234,9 +296,9 @@ bool isFloat(InferenceEngine::Precision precision) {
     return isFP16(precision) || isFP32(precision);
 }
 
-static void setDefaultIO(InferenceEngine::CNNNetwork& network) {
-    const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    const bool isVPUX = FLAGS_d.find("VPUX") != std::string::npos;
+static void setDefaultIO(InferenceEngine::CNNNetwork& network, const std::string& device) {
+    const bool isMYRIAD = device.find("MYRIAD") != std::string::npos;
+    const bool isVPUX = device.find("VPUX") != std::string::npos;
 
     if (isMYRIAD) {
         const InferenceEngine::Precision fp16 = InferenceEngine::Precision::FP16;
@@ -284,8 +346,46 @@ std::string getFileNameFromPath(const std::string& path,
 
 using TimeDiff = std::chrono::milliseconds;
 
+static std::ofstream openOutputFile(const std::string& outputName) {
+    std::ofstream outputFile{outputName, std::ios::out | std::ios::binary};
+    if (!outputFile.is_open()) {
+        throw std::runtime_error("Output file " + outputName + " can't be opened for writing");
+    }
+    return outputFile;
+}
+
+// Compiles the targets by compile(index), which returns the LoadNetwork time, several targets are compiled in parallel
+template <typename Compile>
+static std::vector<TimeDiff> compileTargets(const std::vector<Target>& targets, const Compile& compile) {
+    if (targets.size() == 1) {
+        return {compile(0)};
+    }
+
+    std::vector<std::future<TimeDiff>> futures;
+    for (size_t i = 0; i < targets.size(); i++) {
+        futures.push_back(std::async(std::launch::async, [&compile, i] {
+            return compile(i);
+        }));
+    }
+
+    std::vector<TimeDiff> times;
+    std::string errors;
+    for (size_t i = 0; i < targets.size(); i++) {
+        try {
+            times.push_back(futures[i].get());
+        } catch (const std::exception& error) {
+            errors += "\n" + targets[i].device + " -> " + targets[i].output + ": " + error.what();
+        }
+    }
+    if (!errors.empty()) {
+        throw std::runtime_error("Compilation failed for the targets:" + errors);
+    }
+    return times;
+}
+
 int main(int argc, char* argv[]) {
-    TimeDiff loadNetworkTimeElapsed {0};
+    std::vector<Target> targets;
+    std::vector<TimeDiff> loadNetworkTimes;
 
     try {
         const auto& version = ov::get_openvino_version();
@@ -298,61 +398,86 @@ int main(int argc, char* argv[]) {
         if (!parseCommandLine(&argc, &argv)) {
             return EXIT_SUCCESS;
         }
+
+        if (FLAGS_targets.empty()) {
+            std::string outputName = FLAGS_o;
+            if (outputName.empty()) {
+                outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
+            }
+            targets.push_back({FLAGS_d, FLAGS_c, outputName});
+        } else {
+            targets = parseTargetsFile(FLAGS_targets);
+        }
+
         if (FLAGS_ov_api_1_0) {
             InferenceEngine::Core ie;
             if (!FLAGS_log_level.empty()) {
-                ie.SetConfig({{CONFIG_KEY(LOG_LEVEL), FLAGS_log_level}}, FLAGS_d);
+                for (auto&& target : targets) {
+                    ie.SetConfig({{CONFIG_KEY(LOG_LEVEL), FLAGS_log_level}}, target.device);
+                }
             }
 
             auto network = ie.ReadNetwork(FLAGS_m);
 
-            setDefaultIO(network);
-            processPrecision(network, FLAGS_ip, FLAGS_op, FLAGS_iop);
-            processLayout(network, FLAGS_il, FLAGS_ol, FLAGS_iol);
-
-            printInputAndOutputsInfo(network);
-
-            auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-            auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure());
-            loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+            // the default IO depends on the device, so each target sets up its own copy of the network
+            std::vector<InferenceEngine::CNNNetwork> networks;
+            for (auto&& target : targets) {
+                if (&target != &targets.front() && !network.getFunction()) {
+                    throw std::invalid_argument("Several targets require the model in the IR v10 or newer");
+                }
+                InferenceEngine::CNNNetwork targetNetwork =
+                    &target == &targets.front() ? network : InferenceEngine::CNNNetwork(ov::clone_model(*network.getFunction()));
+                setDefaultIO(targetNetwork, target.device);
+                processPrecision(targetNetwork, FLAGS_ip, FLAGS_op, FLAGS_iop);
+                processLayout(targetNetwork, FLAGS_il, FLAGS_ol, FLAGS_iol);
+                networks.push_back(targetNetwork);
+            }
 
-            std::string outputName = FLAGS_o;
-            if (outputName.empty()) {
-                outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
+            for (size_t i = 0; i < targets.size(); i++) {
+                if (targets.size() > 1) {
+                    std::cout << "Target " << targets[i].device << " -> " << targets[i].output << ":" << std::endl;
+                }
+                printInputAndOutputsInfo(networks[i]);
             }
 
-            std::ofstream outputFile{outputName, std::ios::out | std::ios::binary};
-            if (!outputFile.is_open()) {
-                std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
-                return EXIT_FAILURE;
-            } else {
+            loadNetworkTimes = compileTargets(targets, [&](size_t i) {
+                auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+                auto executableNetwork = ie.LoadNetwork(networks[i], targets[i].device, configure(targets[i]));
+                auto loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+
+                auto outputFile = openOutputFile(targets[i].output);
                 executableNetwork.Export(outputFile);
-            }
+                return loadNetworkTimeElapsed;
+            });
         } else {
             ov::runtime::Core core;
             if (!FLAGS_log_level.empty()) {
-                core.set_config({{CONFIG_KEY(LOG_LEVEL), FLAGS_log_level}}, FLAGS_d);
+                for (auto&& target : targets) {
+                    core.set_config({{CONFIG_KEY(LOG_LEVEL), FLAGS_log_level}}, target.device);
+                }
             }
 
             auto model = core.read_model(FLAGS_m);
 
             configurePrePostProcessing(model, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol, FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
             printInputAndOutputsInfo(*model);
-            auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-            auto compiledModel = core.compile_model(model, FLAGS_d, configure());
-            loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
-            std::string outputName = FLAGS_o;
-            if (outputName.empty()) {
-                outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
+
+            // the read and preprocessed model is shared, each target compiles its own copy, so the parallel
+            // compilations don't touch the same graph
+            std::vector<std::shared_ptr<ov::Model>> models = {model};
+            for (size_t i = 1; i < targets.size(); i++) {
+                models.push_back(ov::clone_model(*model));
             }
 
-            std::ofstream outputFile{outputName, std::ios::out | std::ios::binary};
-            if (!outputFile.is_open()) {
-                std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
-                return EXIT_FAILURE;
-            } else {
+            loadNetworkTimes = compileTargets(targets, [&](size_t i) {
+                auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+                auto compiledModel = core.compile_model(models[i], targets[i].device, configure(targets[i]));
+                auto loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+
+                auto outputFile = openOutputFile(targets[i].output);
                 compiledModel.export_model(outputFile);
-            }
+                return loadNetworkTimeElapsed;
+            });
         }
     } catch (const std::exception& error) {
         std::cerr << error.what() << std::endl;
@@ -362,6 +487,14 @@ int main(int argc, char* argv[]) {
         return EXIT_FAILURE;
     }
 
-    std::cout << "Done. LoadNetwork time elapsed: " << loadNetworkTimeElapsed.count() << " ms" << std::endl;
+    if (targets.size() == 1) {
+        std::cout << "Done. LoadNetwork time elapsed: " << loadNetworkTimes.front().count() << " ms" << std::endl;
+    } else {
+        for (size_t i = 0; i < targets.size(); i++) {
+            std::cout << targets[i].device << " -> " << targets[i].output << ": LoadNetwork time elapsed: "
+                      << loadNetworkTimes[i].count() << " ms" << std::endl;
+        }
+        std::cout << "Done." << std::endl;
+    }
     return EXIT_SUCCESS;
 }